@@ -34,12 +34,29 @@
 #include "stb_image_aug.h"
 #include "image_helper.h"
 #include "image_DXT.h"
+#include "image_BC7.h"
+#include "image_KTX2.h"
+#include "texture_residency.h"
+#include "texture_stream.h"
+#include "texture_package.h"
+#include "image_jobs.h"
+#include "image_atlas.h"
+#include "image_anim.h"
 
 #include <stdlib.h>
 #include <string.h>
+#ifndef WIN32
+	#include <sys/time.h>
+#endif
 
-/*	error reporting	*/
-char *result_string_pointer = "SOIL initialized";
+/*	error reporting, one per thread: the batch loads prepare textures on
+	worker threads, which hand their results back to the GL thread	*/
+#ifdef WIN32
+	#define SOIL_THREAD_LOCAL __declspec(thread)
+#else
+	#define SOIL_THREAD_LOCAL __thread
+#endif
+SOIL_THREAD_LOCAL char *result_string_pointer = "SOIL initialized";
 
 /*	for loading cube maps	*/
 enum{
@@ -78,20 +95,91 @@ int query_DXT_capability( void );
 #define SOIL_RGBA_S3TC_DXT1		0x83F1
 #define SOIL_RGBA_S3TC_DXT3		0x83F2
 #define SOIL_RGBA_S3TC_DXT5		0x83F3
+/*	for using RGTC (BC4 / BC5) compression	*/
+static int has_RGTC_capability = SOIL_CAPABILITY_UNKNOWN;
+int query_RGTC_capability( void );
+#define SOIL_COMPRESSED_RED_RGTC1	0x8DBB
+#define SOIL_COMPRESSED_RG_RGTC2	0x8DBD
+/*	for loading BPTC (BC7) DDS files	*/
+static int has_BPTC_capability = SOIL_CAPABILITY_UNKNOWN;
+int query_BPTC_capability( void );
+#define SOIL_COMPRESSED_RGBA_BPTC_UNORM	0x8E8C
+#define SOIL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM	0x8E8D
 typedef void (APIENTRY * P_SOIL_GLCOMPRESSEDTEXIMAGE2DPROC) (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const GLvoid * data);
 P_SOIL_GLCOMPRESSEDTEXIMAGE2DPROC soilGlCompressedTexImage2D = NULL;
+/*	for 2D texture arrays and 3D (volume) textures	*/
+static int has_texture_array_capability = SOIL_CAPABILITY_UNKNOWN;
+int query_texture_array_capability( void );
+static int has_3D_capability = SOIL_CAPABILITY_UNKNOWN;
+int query_3D_capability( void );
+#define SOIL_TEXTURE_3D					0x806F
+#define SOIL_MAX_3D_TEXTURE_SIZE		0x8073
+#define SOIL_TEXTURE_2D_ARRAY			0x8C1A
+#define SOIL_MAX_ARRAY_TEXTURE_LAYERS	0x88FF
+/*	the limits SOIL asks about, each queried once	*/
+enum{
+	SOIL_LIMIT_TEXTURE_SIZE = 0,
+	SOIL_LIMIT_CUBE_MAP_TEXTURE_SIZE = 1,
+	SOIL_LIMIT_3D_TEXTURE_SIZE = 2,
+	SOIL_LIMIT_ARRAY_TEXTURE_LAYERS = 3,
+	SOIL_NUM_LIMITS = 4
+};
+static int SOIL_limits[SOIL_NUM_LIMITS] = { -1, -1, -1, -1 };
+int SOIL_internal_GL_limit( unsigned int limit_enum );
+typedef void (APIENTRY * P_SOIL_GLTEXIMAGE3DPROC) (GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const GLvoid * pixels);
+typedef void (APIENTRY * P_SOIL_GLCOMPRESSEDTEXIMAGE3DPROC) (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const GLvoid * data);
+typedef void (APIENTRY * P_SOIL_GLPROC) ( void );
+P_SOIL_GLTEXIMAGE3DPROC soilGlTexImage3D = NULL;
+P_SOIL_GLCOMPRESSEDTEXIMAGE3DPROC soilGlCompressedTexImage3D = NULL;
+/*	what a direct (DDS or KTX2) load is asked to create	*/
+enum{
+	SOIL_DIRECT_2D = 0,
+	SOIL_DIRECT_CUBEMAP = 1,
+	SOIL_DIRECT_ARRAY = 2,
+	SOIL_DIRECT_VOLUME = 3
+};
 unsigned int SOIL_direct_load_DDS(
 		const char *filename,
 		unsigned int reuse_texture_ID,
 		int flags,
-		int loading_as_cubemap );
+		int loading_as );
 unsigned int SOIL_direct_load_DDS_from_memory(
 		const unsigned char *const buffer,
 		int buffer_length,
 		unsigned int reuse_texture_ID,
 		int flags,
-		int loading_as_cubemap );
+		int loading_as );
+unsigned int SOIL_internal_DDS_format( unsigned int fourCC, int *block_size );
+unsigned int SOIL_internal_DDS_DX10_format(
+		const unsigned char *const buffer,
+		int buffer_length,
+		const DDS_header *header,
+		unsigned int *offset,
+		int *block_size );
+int SOIL_internal_DDS_format_supported( unsigned int format );
+unsigned int SOIL_direct_load_KTX2_from_memory(
+		const unsigned char *const buffer,
+		int buffer_length,
+		unsigned int reuse_texture_ID,
+		int flags,
+		int loading_as );
+unsigned int SOIL_internal_KTX2_format( unsigned int vkFormat, int *block_size, int *compressed );
+void SOIL_internal_finish_direct_load(
+		unsigned int opengl_texture_type,
+		unsigned int tex_ID,
+		int mipmaps,
+		int flags );
+void SOIL_internal_direct_upload(
+		unsigned int tex_ID,
+		unsigned int opengl_texture_target,
+		int level,
+		unsigned int format,
+		int compressed,
+		int width, int height, int depth,
+		int size,
+		const unsigned char *data );
 /*	other functions	*/
+void check_for_GL_errors( const char *calling_location );
 unsigned int
 	SOIL_internal_create_OGL_texture
 	(
@@ -103,6 +191,172 @@ unsigned int
 		unsigned int opengl_texture_target,
 		unsigned int texture_check_size_enum
 	);
+/*	what the OpenGL implementation can do, queried on the GL thread
+	so the CPU side of creating a texture can run on any thread	*/
+typedef struct
+{
+	int tex_rectangle;
+	int NPOT;
+	int DXT;
+	int RGTC;
+	int max_supported_size;
+	int drop_levels;
+}
+SOIL_internal_caps;
+/*	a texture ready to be uploaded, every MIP level raw or DXT compressed	*/
+#define SOIL_MAX_LEVELS		32
+typedef struct
+{
+	int width, height;
+	int size;
+	int compressed;
+	unsigned char *data;
+	/*	the data belongs to the caller, with rows row_length texels apart	*/
+	int borrowed;
+	int row_length;
+}
+SOIL_internal_level;
+typedef struct
+{
+	unsigned int flags;
+	unsigned int opengl_texture_type;
+	unsigned int opengl_texture_target;
+	unsigned int internal_texture_format;
+	unsigned int original_texture_format;
+	int num_levels;
+	SOIL_internal_level levels[SOIL_MAX_LEVELS];
+	/*	the processed base image the levels are made from	*/
+	const unsigned char *base;
+	int base_borrowed;
+	int row_stride;
+	int channels;
+	int compress_to_DXT;
+	int compress_to_RGTC;
+}
+SOIL_internal_texture;
+void
+	SOIL_internal_query_caps
+	(
+		unsigned int flags,
+		unsigned int texture_check_size_enum,
+		SOIL_internal_caps *caps
+	);
+int
+	SOIL_internal_prepare_texture
+	(
+		const unsigned char *const data,
+		int width, int height, int channels,
+		int row_stride, int borrow_data,
+		unsigned int flags,
+		unsigned int opengl_texture_type,
+		unsigned int opengl_texture_target,
+		const SOIL_internal_caps *caps,
+		SOIL_internal_texture *texture
+	);
+int
+	SOIL_internal_prepare_base
+	(
+		const unsigned char *const data,
+		int width, int height, int channels,
+		int row_stride, int borrow_data,
+		unsigned int flags,
+		unsigned int opengl_texture_type,
+		unsigned int opengl_texture_target,
+		const SOIL_internal_caps *caps,
+		SOIL_internal_texture *texture
+	);
+void
+	SOIL_internal_build_level
+	(
+		SOIL_internal_texture *texture,
+		int level
+	);
+unsigned int
+	SOIL_internal_upload_texture
+	(
+		const SOIL_internal_texture *texture,
+		unsigned int reuse_texture_ID
+	);
+void
+	SOIL_internal_upload_level
+	(
+		const SOIL_internal_texture *texture,
+		unsigned int tex_id,
+		int level
+	);
+void
+	SOIL_internal_set_parameters
+	(
+		const SOIL_internal_texture *texture
+	);
+void
+	SOIL_internal_free_texture
+	(
+		SOIL_internal_texture *texture
+	);
+int
+	SOIL_internal_prepare_DDS_blocks
+	(
+		const unsigned char *const buffer,
+		int buffer_length,
+		int force_channels,
+		unsigned int flags,
+		const SOIL_internal_caps *caps,
+		SOIL_internal_texture *texture
+	);
+unsigned int
+	SOIL_internal_create_OGL_texture_from_DDS
+	(
+		const unsigned char *const buffer,
+		int buffer_length,
+		int force_channels,
+		unsigned int reuse_texture_ID,
+		unsigned int flags
+	);
+unsigned char*
+	SOIL_internal_read_file
+	(
+		const char *filename,
+		int *length
+	);
+/*	for keeping the texture memory within a budget	*/
+#define SOIL_TEXTURE_BINDING_RECTANGLE_ARB		0x84F6
+static texture_residency SOIL_residency;
+/*	set while the residency manager reloads a texture	*/
+static int SOIL_residency_reloading = 0;
+static int SOIL_residency_reload_drop_levels = 0;
+typedef struct
+{
+	char *filename;
+	int force_channels;
+	unsigned int flags;
+}
+SOIL_residency_source;
+void SOIL_internal_residency_note_upload(
+		unsigned int tex_id,
+		unsigned int opengl_texture_target,
+		int level,
+		unsigned int internal_texture_format,
+		int width, int height );
+void SOIL_internal_residency_note_upload_layers(
+		unsigned int tex_id,
+		int level,
+		unsigned int internal_texture_format,
+		int width, int height, int depth );
+void SOIL_internal_residency_set_source(
+		unsigned int tex_id,
+		const char *filename,
+		int force_channels,
+		unsigned int flags,
+		int can_drop_levels );
+void SOIL_internal_residency_enforce( unsigned int tex_id );
+void SOIL_internal_residency_free_source( void *source );
+double SOIL_internal_time_ms( void );
+/*	for streaming in the MIP levels of large textures over several frames	*/
+#define SOIL_TEXTURE_BASE_LEVEL		0x813C
+#define SOIL_TEXTURE_MAX_LEVEL		0x813D
+static texture_stream SOIL_stream;
+int SOIL_internal_progressive_cancel( unsigned int tex_id );
 
 /*	and the code magic begins here [8^)	*/
 unsigned int
@@ -116,7 +370,8 @@ unsigned int
 {
 	/*	variables	*/
 	unsigned char* img;
-	int width, height, channels;
+	unsigned char *buffer = NULL;
+	int width, height, channels, buffer_length = 0;
 	unsigned int tex_id;
 	/*	does the user want direct uploading of the image as a DDS file?	*/
 	if( flags & SOIL_FLAG_DDS_LOAD_DIRECT )
@@ -128,12 +383,40 @@ unsigned int
 		tex_id = SOIL_direct_load_DDS( filename, reuse_texture_ID, flags, 0 );
 		if( tex_id )
 		{
-			/*	hey, it worked!!	*/
+			/*	hey, it worked!!
+				(it can be reloaded, but only at full size)	*/
+			SOIL_internal_residency_set_source(
+					tex_id, filename, force_channels, flags, 0 );
 			return tex_id;
 		}
 	}
-	/*	try to load the image	*/
-	img = SOIL_load_image( filename, &width, &height, &channels, force_channels );
+	/*	compressing to DXT?  a DXT DDS file can keep the blocks it has	*/
+	if( flags & SOIL_FLAG_COMPRESS_TO_DXT )
+	{
+		buffer = SOIL_internal_read_file( filename, &buffer_length );
+		tex_id = SOIL_internal_create_OGL_texture_from_DDS(
+				buffer, buffer_length, force_channels,
+				reuse_texture_ID, flags );
+		if( tex_id )
+		{
+			SOIL_free_image_data( buffer );
+			SOIL_internal_residency_set_source(
+					tex_id, filename, force_channels, flags,
+					(flags & SOIL_FLAG_MIPMAPS) != 0 );
+			return tex_id;
+		}
+	}
+	/*	try to load the image (it may have been read in already)	*/
+	if( buffer )
+	{
+		img = SOIL_load_image_from_memory(
+				buffer, buffer_length,
+				&width, &height, &channels, force_channels );
+		SOIL_free_image_data( buffer );
+	} else
+	{
+		img = SOIL_load_image( filename, &width, &height, &channels, force_channels );
+	}
 	/*	channels holds the original number of channels, which may have been forced	*/
 	if( (force_channels >= 1) && (force_channels <= 4) )
 	{
@@ -153,321 +436,475 @@ unsigned int
 			GL_MAX_TEXTURE_SIZE );
 	/*	and nuke the image data	*/
 	SOIL_free_image_data( img );
+	/*	remember where it came from, in case it gets evicted	*/
+	if( tex_id )
+	{
+		SOIL_internal_residency_set_source(
+				tex_id, filename, force_channels, flags,
+				!(flags & SOIL_FLAG_TEXTURE_RECTANGLE) && (flags & SOIL_FLAG_MIPMAPS) );
+	}
 	/*	and return the handle, such as it is	*/
 	return tex_id;
 }
 
-unsigned int
-	SOIL_load_OGL_HDR_texture
+/*	one file of SOIL_load_OGL_textures()	*/
+typedef struct
+{
+	/*	the file, only kept if it may be uploaded as a DDS directly	*/
+	unsigned char *buffer;
+	int buffer_length;
+	SOIL_internal_texture texture;
+	int prepared;
+	const char *result;
+	double read_ms, decode_ms;
+}
+SOIL_internal_batch_item;
+
+typedef struct
+{
+	const char *const *filenames;
+	int force_channels;
+	unsigned int flags;
+	SOIL_internal_caps caps;
+	SOIL_internal_batch_item *items;
+}
+SOIL_internal_batch;
+
+unsigned char*
+	SOIL_internal_read_file
 	(
 		const char *filename,
-		int fake_HDR_format,
-		int rescale_to_max,
-		unsigned int reuse_texture_ID,
-		unsigned int flags
+		int *length
 	)
 {
-	/*	variables	*/
-	unsigned char* img;
+	FILE *f;
+	unsigned char *buffer;
+	long file_length;
+	*length = 0;
+	if( NULL == filename )
+	{
+		return NULL;
+	}
+	f = fopen( filename, "rb" );
+	if( NULL == f )
+	{
+		return NULL;
+	}
+	/*	one big sequential read of the whole file	*/
+	fseek( f, 0, SEEK_END );
+	file_length = ftell( f );
+	fseek( f, 0, SEEK_SET );
+	buffer = (file_length > 0) ? (unsigned char*)malloc( file_length ) : NULL;
+	if( buffer )
+	{
+		*length = (int)fread( (void*)buffer, 1, file_length, f );
+	}
+	fclose( f );
+	return buffer;
+}
+
+/*	runs on a worker thread: no OpenGL calls in here!	*/
+void SOIL_internal_batch_job( void *user_data, int index )
+{
+	SOIL_internal_batch *batch = (SOIL_internal_batch*)user_data;
+	SOIL_internal_batch_item *item = &batch->items[index];
+	unsigned char *img;
 	int width, height, channels;
-	unsigned int tex_id;
-	/*	no direct uploading of the image as a DDS file	*/
-	/* error check */
-	if( (fake_HDR_format != SOIL_HDR_RGBE) &&
-		(fake_HDR_format != SOIL_HDR_RGBdivA) &&
-		(fake_HDR_format != SOIL_HDR_RGBdivA2) )
+	double start_ms = SOIL_internal_time_ms();
+	item->buffer = SOIL_internal_read_file( batch->filenames[index], &item->buffer_length );
+	item->read_ms = SOIL_internal_time_ms() - start_ms;
+	if( NULL == item->buffer )
 	{
-		result_string_pointer = "Invalid fake HDR format specified";
-		return 0;
+		item->result = "Unable to read the file";
+		return;
 	}
-	/*	try to load the image (only the HDR type) */
-	img = stbi_hdr_load_rgbe( filename, &width, &height, &channels, 4 );
-	/*	channels holds the original number of channels, which may have been forced	*/
-	if( NULL == img )
+	/*	DDS and KTX2 files may go straight to OpenGL, that has to wait for the GL thread	*/
+	if( (batch->flags & SOIL_FLAG_DDS_LOAD_DIRECT) &&
+		(item->buffer_length >= 8) &&
+		((0 == memcmp( item->buffer, "DDS ", 4 )) ||
+		 (0 == memcmp( item->buffer, "\xABKTX 20\xBB", 8 ))) )
 	{
-		/*	image loading failed	*/
-		result_string_pointer = stbi_failure_reason();
-		return 0;
+		return;
 	}
-	/* the load worked, do I need to convert it? */
-	if( fake_HDR_format == SOIL_HDR_RGBdivA )
+	start_ms = SOIL_internal_time_ms();
+	/*	compressing a DXT DDS file to DXT just keeps its blocks	*/
+	if( (batch->flags & SOIL_FLAG_COMPRESS_TO_DXT) &&
+		(item->buffer_length >= 4) && (0 == memcmp( item->buffer, "DDS ", 4 )) )
 	{
-		RGBE_to_RGBdivA( img, width, height, rescale_to_max );
-	} else if( fake_HDR_format == SOIL_HDR_RGBdivA2 )
+		item->prepared = SOIL_internal_prepare_DDS_blocks(
+				item->buffer, item->buffer_length, batch->force_channels,
+				batch->flags, &batch->caps, &item->texture );
+	}
+	if( item->prepared )
 	{
-		RGBE_to_RGBdivA2( img, width, height, rescale_to_max );
+		SOIL_free_image_data( item->buffer );
+		item->buffer = NULL;
+		item->decode_ms = SOIL_internal_time_ms() - start_ms;
+		return;
 	}
-	/*	OK, make it a texture!	*/
-	tex_id = SOIL_internal_create_OGL_texture(
-			img, width, height, channels,
-			reuse_texture_ID, flags,
-			GL_TEXTURE_2D, GL_TEXTURE_2D,
-			GL_MAX_TEXTURE_SIZE );
-	/*	and nuke the image data	*/
-	SOIL_free_image_data( img );
-	/*	and return the handle, such as it is	*/
-	return tex_id;
+	img = SOIL_load_image_from_memory(
+			item->buffer, item->buffer_length,
+			&width, &height, &channels, batch->force_channels );
+	SOIL_free_image_data( item->buffer );
+	item->buffer = NULL;
+	if( (batch->force_channels >= 1) && (batch->force_channels <= 4) )
+	{
+		channels = batch->force_channels;
+	}
+	if( NULL == img )
+	{
+		item->result = stbi_failure_reason();
+	} else
+	{
+		item->prepared = SOIL_internal_prepare_texture(
+				img, width, height, channels, 0, 0, batch->flags,
+				GL_TEXTURE_2D, GL_TEXTURE_2D,
+				&batch->caps, &item->texture );
+		if( !item->prepared )
+		{
+			item->result = result_string_pointer;
+		}
+		SOIL_free_image_data( img );
+	}
+	item->decode_ms = SOIL_internal_time_ms() - start_ms;
 }
 
-unsigned int
-	SOIL_load_OGL_texture_from_memory
-	(
-		const unsigned char *const buffer,
-		int buffer_length,
-		int force_channels,
-		unsigned int reuse_texture_ID,
-		unsigned int flags
-	)
+/*	runs on the GL thread	*/
+unsigned int SOIL_internal_batch_upload( SOIL_internal_batch *batch, int index )
 {
-	/*	variables	*/
-	unsigned char* img;
-	int width, height, channels;
-	unsigned int tex_id;
-	/*	does the user want direct uploading of the image as a DDS file?	*/
-	if( flags & SOIL_FLAG_DDS_LOAD_DIRECT )
+	SOIL_internal_batch_item *item = &batch->items[index];
+	const char *filename = batch->filenames[index];
+	unsigned int tex_id = 0;
+	int can_drop_levels = 0;
+	if( item->buffer )
 	{
-		/*	1st try direct loading of the image as a DDS file
-			note: direct uploading will only load what is in the
-			DDS file, no MIPmaps will be generated, the image will
-			not be flipped, etc.	*/
+		/*	a DDS file, try loading it directly	*/
 		tex_id = SOIL_direct_load_DDS_from_memory(
-				buffer, buffer_length,
-				reuse_texture_ID, flags, 0 );
-		if( tex_id )
+				item->buffer, item->buffer_length, 0, batch->flags, 0 );
+		SOIL_free_image_data( item->buffer );
+		item->buffer = NULL;
+		if( 0 == tex_id )
 		{
-			/*	hey, it worked!!	*/
-			return tex_id;
+			/*	no luck, do it the slow way	*/
+			tex_id = SOIL_load_OGL_texture(
+					filename, batch->force_channels, 0,
+					batch->flags & ~SOIL_FLAG_DDS_LOAD_DIRECT );
+			can_drop_levels = -1;
 		}
-	}
-	/*	try to load the image	*/
-	img = SOIL_load_image_from_memory(
-					buffer, buffer_length,
-					&width, &height, &channels,
-					force_channels );
-	/*	channels holds the original number of channels, which may have been forced	*/
-	if( (force_channels >= 1) && (force_channels <= 4) )
+	} else if( item->prepared )
 	{
-		channels = force_channels;
+		tex_id = SOIL_internal_upload_texture( &item->texture, 0 );
+		SOIL_internal_free_texture( &item->texture );
+		can_drop_levels =
+				!(batch->flags & SOIL_FLAG_TEXTURE_RECTANGLE) &&
+				(batch->flags & SOIL_FLAG_MIPMAPS);
+	} else if( item->result )
+	{
+		result_string_pointer = (char*)item->result;
 	}
-	if( NULL == img )
+	/*	remember where it came from, in case it gets evicted
+		(SOIL_load_OGL_texture already did that itself)	*/
+	if( tex_id && (can_drop_levels >= 0) )
 	{
-		/*	image loading failed	*/
-		result_string_pointer = stbi_failure_reason();
-		return 0;
+		SOIL_internal_residency_set_source(
+				tex_id, filename, batch->force_channels,
+				batch->flags, can_drop_levels );
 	}
-	/*	OK, make it a texture!	*/
-	tex_id = SOIL_internal_create_OGL_texture(
-			img, width, height, channels,
-			reuse_texture_ID, flags,
-			GL_TEXTURE_2D, GL_TEXTURE_2D,
-			GL_MAX_TEXTURE_SIZE );
-	/*	and nuke the image data	*/
-	SOIL_free_image_data( img );
-	/*	and return the handle, such as it is	*/
 	return tex_id;
 }
 
-unsigned int
-	SOIL_load_OGL_cubemap
+int
+	SOIL_load_OGL_textures
 	(
-		const char *x_pos_file,
-		const char *x_neg_file,
-		const char *y_pos_file,
-		const char *y_neg_file,
-		const char *z_pos_file,
-		const char *z_neg_file,
+		const char *const *filenames,
+		int count,
 		int force_channels,
-		unsigned int reuse_texture_ID,
-		unsigned int flags
+		unsigned int flags,
+		unsigned int *texture_IDs,
+		SOIL_load_timing *timings
 	)
 {
-	/*	variables	*/
-	unsigned char* img;
-	int width, height, channels;
-	unsigned int tex_id;
-	/*	error checking	*/
-	if( (x_pos_file == NULL) ||
-		(x_neg_file == NULL) ||
-		(y_pos_file == NULL) ||
-		(y_neg_file == NULL) ||
-		(z_pos_file == NULL) ||
-		(z_neg_file == NULL) )
+	SOIL_internal_batch batch;
+	image_job_batch *jobs;
+	int i, loaded = 0;
+	if( (NULL == filenames) || (NULL == texture_IDs) || (count < 1) )
 	{
-		result_string_pointer = "Invalid cube map files list";
+		result_string_pointer = "Nothing to load";
 		return 0;
 	}
-	/*	capability checking	*/
-	if( query_cubemap_capability() != SOIL_CAPABILITY_PRESENT )
+	batch.filenames = filenames;
+	batch.force_channels = force_channels;
+	batch.flags = flags & ~SOIL_FLAG_COMPLETION_ORDER;
+	batch.items = (SOIL_internal_batch_item*)malloc( count * sizeof( SOIL_internal_batch_item ) );
+	if( NULL == batch.items )
 	{
-		result_string_pointer = "No cube map capability present";
+		result_string_pointer = "malloc failed";
 		return 0;
 	}
-	/*	1st face: try to load the image	*/
-	img = SOIL_load_image( x_pos_file, &width, &height, &channels, force_channels );
-	/*	channels holds the original number of channels, which may have been forced	*/
-	if( (force_channels >= 1) && (force_channels <= 4) )
-	{
-		channels = force_channels;
-	}
-	if( NULL == img )
-	{
-		/*	image loading failed	*/
-		result_string_pointer = stbi_failure_reason();
-		return 0;
-	}
-	/*	upload the texture, and create a texture ID if necessary	*/
-	tex_id = SOIL_internal_create_OGL_texture(
-			img, width, height, channels,
-			reuse_texture_ID, flags,
-			SOIL_TEXTURE_CUBE_MAP, SOIL_TEXTURE_CUBE_MAP_POSITIVE_X,
-			SOIL_MAX_CUBE_MAP_TEXTURE_SIZE );
-	/*	and nuke the image data	*/
-	SOIL_free_image_data( img );
-	/*	continue?	*/
-	if( tex_id != 0 )
+	memset( batch.items, 0, count * sizeof( SOIL_internal_batch_item ) );
+	/*	ask OpenGL everything up front, the workers can't	*/
+	SOIL_internal_query_caps( batch.flags, GL_MAX_TEXTURE_SIZE, &batch.caps );
+	/*	read and decode everything in parallel, upload on this thread	*/
+	jobs = image_jobs_start( SOIL_internal_batch_job, &batch, count, 0 );
+	for( i = 0; i < count; ++i )
 	{
-		/*	1st face: try to load the image	*/
-		img = SOIL_load_image( x_neg_file, &width, &height, &channels, force_channels );
-		/*	channels holds the original number of channels, which may have been forced	*/
-		if( (force_channels >= 1) && (force_channels <= 4) )
+		int index = i;
+		double start_ms;
+		if( NULL == jobs )
 		{
-			channels = force_channels;
-		}
-		if( NULL == img )
+			/*	out of RAM, one at a time then	*/
+			SOIL_internal_batch_job( &batch, index );
+		} else if( flags & SOIL_FLAG_COMPLETION_ORDER )
 		{
-			/*	image loading failed	*/
-			result_string_pointer = stbi_failure_reason();
-			return 0;
+			index = image_jobs_wait_any( jobs );
+		} else
+		{
+			image_jobs_wait( jobs, index );
 		}
-		/*	upload the texture, but reuse the assigned texture ID	*/
-		tex_id = SOIL_internal_create_OGL_texture(
-				img, width, height, channels,
-				tex_id, flags,
-				SOIL_TEXTURE_CUBE_MAP, SOIL_TEXTURE_CUBE_MAP_NEGATIVE_X,
-				SOIL_MAX_CUBE_MAP_TEXTURE_SIZE );
-		/*	and nuke the image data	*/
-		SOIL_free_image_data( img );
-	}
-	/*	continue?	*/
-	if( tex_id != 0 )
-	{
-		/*	1st face: try to load the image	*/
-		img = SOIL_load_image( y_pos_file, &width, &height, &channels, force_channels );
-		/*	channels holds the original number of channels, which may have been forced	*/
-		if( (force_channels >= 1) && (force_channels <= 4) )
+		start_ms = SOIL_internal_time_ms();
+		texture_IDs[index] = SOIL_internal_batch_upload( &batch, index );
+		if( texture_IDs[index] )
 		{
-			channels = force_channels;
+			++loaded;
 		}
-		if( NULL == img )
+		if( timings )
 		{
-			/*	image loading failed	*/
-			result_string_pointer = stbi_failure_reason();
-			return 0;
+			timings[index].read_ms = batch.items[index].read_ms;
+			timings[index].decode_ms = batch.items[index].decode_ms;
+			timings[index].upload_ms = SOIL_internal_time_ms() - start_ms;
 		}
-		/*	upload the texture, but reuse the assigned texture ID	*/
-		tex_id = SOIL_internal_create_OGL_texture(
-				img, width, height, channels,
-				tex_id, flags,
-				SOIL_TEXTURE_CUBE_MAP, SOIL_TEXTURE_CUBE_MAP_POSITIVE_Y,
-				SOIL_MAX_CUBE_MAP_TEXTURE_SIZE );
-		/*	and nuke the image data	*/
-		SOIL_free_image_data( img );
 	}
-	/*	continue?	*/
-	if( tex_id != 0 )
+	image_jobs_finish( jobs );
+	free( batch.items );
+	if( loaded == count )
 	{
-		/*	1st face: try to load the image	*/
-		img = SOIL_load_image( y_neg_file, &width, &height, &channels, force_channels );
-		/*	channels holds the original number of channels, which may have been forced	*/
-		if( (force_channels >= 1) && (force_channels <= 4) )
+		result_string_pointer = "Images loaded as OpenGL textures";
+	}
+	return loaded;
+}
+
+/*	the images and pages of SOIL_load_OGL_atlas()	*/
+typedef struct
+{
+	const char *const *filenames;
+	int channels;
+	unsigned int flags;
+	int page_size, padding;
+	SOIL_internal_caps caps;
+	unsigned char **images;
+	int *widths, *heights;
+	image_atlas_rect *placed;
+	int count;
+	unsigned char **pages;
+	SOIL_internal_texture *textures;
+	int *prepared;
+}
+SOIL_internal_atlas;
+
+/*	runs on a worker thread: decode one image	*/
+void SOIL_internal_atlas_decode_job( void *user_data, int index )
+{
+	SOIL_internal_atlas *atlas = (SOIL_internal_atlas*)user_data;
+	int channels;
+	atlas->images[index] = SOIL_load_image(
+			atlas->filenames[index],
+			&atlas->widths[index], &atlas->heights[index],
+			&channels, atlas->channels );
+	if( NULL == atlas->images[index] )
+	{
+		atlas->widths[index] = atlas->heights[index] = 0;
+	}
+}
+
+/*	runs on a worker thread: fill in one page, and compress it	*/
+void SOIL_internal_atlas_page_job( void *user_data, int page )
+{
+	SOIL_internal_atlas *atlas = (SOIL_internal_atlas*)user_data;
+	int i;
+	atlas->pages[page] = (unsigned char*)calloc(
+			atlas->page_size * atlas->page_size, atlas->channels );
+	if( NULL == atlas->pages[page] )
+	{
+		return;
+	}
+	for( i = 0; i < atlas->count; ++i )
+	{
+		if( atlas->placed[i].page == page )
 		{
-			channels = force_channels;
+			image_atlas_blit(
+					atlas->pages[page], atlas->page_size, atlas->page_size,
+					atlas->channels, &atlas->placed[i], atlas->padding,
+					atlas->images[i] );
 		}
-		if( NULL == img )
+	}
+	atlas->prepared[page] = SOIL_internal_prepare_texture(
+			atlas->pages[page], atlas->page_size, atlas->page_size, atlas->channels,
+			0, 1, atlas->flags, GL_TEXTURE_2D, GL_TEXTURE_2D,
+			&atlas->caps, &atlas->textures[page] );
+}
+
+int
+	SOIL_load_OGL_atlas
+	(
+		const char *const *filenames,
+		int count,
+		int force_channels,
+		int page_size,
+		int padding,
+		unsigned int flags,
+		SOIL_atlas_rect *rects,
+		SOIL_atlas_stats *stats
+	)
+{
+	SOIL_internal_atlas atlas;
+	unsigned int *page_IDs = NULL;
+	int num_pages, i, packed = 0;
+	double used_texels = 0.0, start_ms, decode_ms, pack_ms, compress_ms;
+	if( (NULL == filenames) || (NULL == rects) || (count < 1) )
+	{
+		result_string_pointer = "Nothing to load";
+		return 0;
+	}
+	memset( &atlas, 0, sizeof( SOIL_internal_atlas ) );
+	atlas.filenames = filenames;
+	atlas.count = count;
+	/*	all the pages are alike, RGBA unless told otherwise	*/
+	atlas.channels = ((force_channels >= 1) && (force_channels <= 4)) ? force_channels : 4;
+	/*	the UVs are normalized, so no rectangles, and DDS files get decoded	*/
+	atlas.flags = flags & ~(SOIL_FLAG_TEXTURE_RECTANGLE | SOIL_FLAG_DDS_LOAD_DIRECT | SOIL_FLAG_COMPLETION_ORDER);
+	atlas.padding = (padding > 0) ? padding : 0;
+	SOIL_internal_query_caps( atlas.flags, GL_MAX_TEXTURE_SIZE, &atlas.caps );
+	atlas.page_size = (page_size > 0) ? page_size : SOIL_ATLAS_DEFAULT_PAGE_SIZE;
+	if( atlas.page_size > atlas.caps.max_supported_size )
+	{
+		atlas.page_size = atlas.caps.max_supported_size;
+	}
+	atlas.images = (unsigned char**)calloc( count, sizeof( unsigned char* ) );
+	atlas.widths = (int*)calloc( count, sizeof( int ) );
+	atlas.heights = (int*)calloc( count, sizeof( int ) );
+	atlas.placed = (image_atlas_rect*)calloc( count, sizeof( image_atlas_rect ) );
+	if( (NULL == atlas.images) || (NULL == atlas.widths) ||
+		(NULL == atlas.heights) || (NULL == atlas.placed) )
+	{
+		result_string_pointer = "malloc failed";
+		free( atlas.images );
+		free( atlas.widths );
+		free( atlas.heights );
+		free( atlas.placed );
+		return 0;
+	}
+	/*	decode everything in parallel	*/
+	start_ms = SOIL_internal_time_ms();
+	image_jobs_run( SOIL_internal_atlas_decode_job, &atlas, count );
+	decode_ms = SOIL_internal_time_ms() - start_ms;
+	/*	decide where everything goes, keeping the images out of
+		each other's DXT blocks	*/
+	start_ms = SOIL_internal_time_ms();
+	num_pages = image_atlas_pack(
+			atlas.widths, atlas.heights, count,
+			atlas.page_size, atlas.page_size,
+			atlas.padding, (atlas.flags & (SOIL_FLAG_COMPRESS_TO_DXT | SOIL_FLAG_COMPRESS_TO_RGTC)) ? 4 : 1,
+			atlas.placed );
+	pack_ms = SOIL_internal_time_ms() - start_ms;
+	start_ms = SOIL_internal_time_ms();
+	if( num_pages > 0 )
+	{
+		atlas.pages = (unsigned char**)calloc( num_pages, sizeof( unsigned char* ) );
+		atlas.textures = (SOIL_internal_texture*)calloc( num_pages, sizeof( SOIL_internal_texture ) );
+		atlas.prepared = (int*)calloc( num_pages, sizeof( int ) );
+		page_IDs = (unsigned int*)calloc( num_pages, sizeof( unsigned int ) );
+		if( atlas.pages && atlas.textures && atlas.prepared && page_IDs )
 		{
-			/*	image loading failed	*/
-			result_string_pointer = stbi_failure_reason();
-			return 0;
+			/*	put the pages together (and compress them) in parallel	*/
+			image_jobs_run( SOIL_internal_atlas_page_job, &atlas, num_pages );
 		}
-		/*	upload the texture, but reuse the assigned texture ID	*/
-		tex_id = SOIL_internal_create_OGL_texture(
-				img, width, height, channels,
-				tex_id, flags,
-				SOIL_TEXTURE_CUBE_MAP, SOIL_TEXTURE_CUBE_MAP_NEGATIVE_Y,
-				SOIL_MAX_CUBE_MAP_TEXTURE_SIZE );
-		/*	and nuke the image data	*/
-		SOIL_free_image_data( img );
 	}
-	/*	continue?	*/
-	if( tex_id != 0 )
+	compress_ms = SOIL_internal_time_ms() - start_ms;
+	/*	and upload them	*/
+	start_ms = SOIL_internal_time_ms();
+	for( i = 0; (i < num_pages) && page_IDs; ++i )
 	{
-		/*	1st face: try to load the image	*/
-		img = SOIL_load_image( z_pos_file, &width, &height, &channels, force_channels );
-		/*	channels holds the original number of channels, which may have been forced	*/
-		if( (force_channels >= 1) && (force_channels <= 4) )
+		if( atlas.prepared && atlas.prepared[i] )
 		{
-			channels = force_channels;
+			page_IDs[i] = SOIL_internal_upload_texture( &atlas.textures[i], 0 );
+			SOIL_internal_free_texture( &atlas.textures[i] );
 		}
-		if( NULL == img )
+		if( atlas.pages )
 		{
-			/*	image loading failed	*/
-			result_string_pointer = stbi_failure_reason();
-			return 0;
+			free( atlas.pages[i] );
 		}
-		/*	upload the texture, but reuse the assigned texture ID	*/
-		tex_id = SOIL_internal_create_OGL_texture(
-				img, width, height, channels,
-				tex_id, flags,
-				SOIL_TEXTURE_CUBE_MAP, SOIL_TEXTURE_CUBE_MAP_POSITIVE_Z,
-				SOIL_MAX_CUBE_MAP_TEXTURE_SIZE );
-		/*	and nuke the image data	*/
-		SOIL_free_image_data( img );
 	}
-	/*	continue?	*/
-	if( tex_id != 0 )
+	/*	where everything ended up	*/
+	for( i = 0; i < count; ++i )
 	{
-		/*	1st face: try to load the image	*/
-		img = SOIL_load_image( z_neg_file, &width, &height, &channels, force_channels );
-		/*	channels holds the original number of channels, which may have been forced	*/
-		if( (force_channels >= 1) && (force_channels <= 4) )
-		{
-			channels = force_channels;
-		}
-		if( NULL == img )
+		const image_atlas_rect *placed = &atlas.placed[i];
+		SOIL_atlas_rect *rect = &rects[i];
+		float size = (float)atlas.page_size;
+		memset( rect, 0, sizeof( SOIL_atlas_rect ) );
+		rect->page = -1;
+		if( (num_pages > 0) && page_IDs && (placed->page >= 0) && page_IDs[placed->page] )
 		{
-			/*	image loading failed	*/
-			result_string_pointer = stbi_failure_reason();
-			return 0;
+			rect->texture_ID = page_IDs[placed->page];
+			rect->page = placed->page;
+			rect->x = placed->x;
+			rect->y = placed->y;
+			rect->width = placed->width;
+			rect->height = placed->height;
+			rect->u0 = placed->x / size;
+			rect->u1 = (placed->x + placed->width) / size;
+			if( atlas.flags & SOIL_FLAG_INVERT_Y )
+			{
+				/*	the page was flipped on the way up	*/
+				rect->v0 = 1.0f - placed->y / size;
+				rect->v1 = 1.0f - (placed->y + placed->height) / size;
+			} else
+			{
+				rect->v0 = placed->y / size;
+				rect->v1 = (placed->y + placed->height) / size;
+			}
+			used_texels += (double)placed->width * placed->height;
+			++packed;
 		}
-		/*	upload the texture, but reuse the assigned texture ID	*/
-		tex_id = SOIL_internal_create_OGL_texture(
-				img, width, height, channels,
-				tex_id, flags,
-				SOIL_TEXTURE_CUBE_MAP, SOIL_TEXTURE_CUBE_MAP_NEGATIVE_Z,
-				SOIL_MAX_CUBE_MAP_TEXTURE_SIZE );
-		/*	and nuke the image data	*/
-		SOIL_free_image_data( img );
+		SOIL_free_image_data( atlas.images[i] );
 	}
-	/*	and return the handle, such as it is	*/
-	return tex_id;
+	if( stats )
+	{
+		stats->num_pages = (num_pages > 0) ? num_pages : 0;
+		stats->page_size = atlas.page_size;
+		stats->efficiency = (num_pages > 0) ?
+				used_texels / ((double)num_pages * atlas.page_size * atlas.page_size) : 0.0;
+		stats->decode_ms = decode_ms;
+		stats->pack_ms = pack_ms;
+		stats->compress_ms = compress_ms;
+		stats->upload_ms = SOIL_internal_time_ms() - start_ms;
+	}
+	free( page_IDs );
+	free( atlas.prepared );
+	free( atlas.textures );
+	free( atlas.pages );
+	free( atlas.placed );
+	free( atlas.heights );
+	free( atlas.widths );
+	free( atlas.images );
+	if( num_pages < 0 )
+	{
+		result_string_pointer = "malloc failed";
+	} else if( packed == count )
+	{
+		result_string_pointer = "Images packed into an OpenGL texture atlas";
+	} else
+	{
+		result_string_pointer = "Some images could not be loaded or were too large for a page";
+	}
+	return packed;
 }
 
 unsigned int
-	SOIL_load_OGL_cubemap_from_memory
+	SOIL_load_OGL_HDR_texture
 	(
-		const unsigned char *const x_pos_buffer,
-		int x_pos_buffer_length,
-		const unsigned char *const x_neg_buffer,
-		int x_neg_buffer_length,
-		const unsigned char *const y_pos_buffer,
-		int y_pos_buffer_length,
-		const unsigned char *const y_neg_buffer,
-		int y_neg_buffer_length,
-		const unsigned char *const z_pos_buffer,
-		int z_pos_buffer_length,
-		const unsigned char *const z_neg_buffer,
-		int z_neg_buffer_length,
-		int force_channels,
+		const char *filename,
+		int fake_HDR_format,
+		int rescale_to_max,
 		unsigned int reuse_texture_ID,
 		unsigned int flags
 	)
@@ -476,190 +913,49 @@ unsigned int
 	unsigned char* img;
 	int width, height, channels;
 	unsigned int tex_id;
-	/*	error checking	*/
-	if( (x_pos_buffer == NULL) ||
-		(x_neg_buffer == NULL) ||
-		(y_pos_buffer == NULL) ||
-		(y_neg_buffer == NULL) ||
-		(z_pos_buffer == NULL) ||
-		(z_neg_buffer == NULL) )
-	{
-		result_string_pointer = "Invalid cube map buffers list";
-		return 0;
-	}
-	/*	capability checking	*/
-	if( query_cubemap_capability() != SOIL_CAPABILITY_PRESENT )
+	/*	no direct uploading of the image as a DDS file	*/
+	/* error check */
+	if( (fake_HDR_format != SOIL_HDR_RGBE) &&
+		(fake_HDR_format != SOIL_HDR_RGBdivA) &&
+		(fake_HDR_format != SOIL_HDR_RGBdivA2) )
 	{
-		result_string_pointer = "No cube map capability present";
+		result_string_pointer = "Invalid fake HDR format specified";
 		return 0;
 	}
-	/*	1st face: try to load the image	*/
-	img = SOIL_load_image_from_memory(
-			x_pos_buffer, x_pos_buffer_length,
-			&width, &height, &channels, force_channels );
+	/*	try to load the image (only the HDR type) */
+	img = stbi_hdr_load_rgbe( filename, &width, &height, &channels, 4 );
 	/*	channels holds the original number of channels, which may have been forced	*/
-	if( (force_channels >= 1) && (force_channels <= 4) )
-	{
-		channels = force_channels;
-	}
 	if( NULL == img )
 	{
 		/*	image loading failed	*/
 		result_string_pointer = stbi_failure_reason();
 		return 0;
 	}
-	/*	upload the texture, and create a texture ID if necessary	*/
+	/* the load worked, do I need to convert it? */
+	if( fake_HDR_format == SOIL_HDR_RGBdivA )
+	{
+		RGBE_to_RGBdivA( img, width, height, rescale_to_max );
+	} else if( fake_HDR_format == SOIL_HDR_RGBdivA2 )
+	{
+		RGBE_to_RGBdivA2( img, width, height, rescale_to_max );
+	}
+	/*	OK, make it a texture!	*/
 	tex_id = SOIL_internal_create_OGL_texture(
 			img, width, height, channels,
 			reuse_texture_ID, flags,
-			SOIL_TEXTURE_CUBE_MAP, SOIL_TEXTURE_CUBE_MAP_POSITIVE_X,
-			SOIL_MAX_CUBE_MAP_TEXTURE_SIZE );
+			GL_TEXTURE_2D, GL_TEXTURE_2D,
+			GL_MAX_TEXTURE_SIZE );
 	/*	and nuke the image data	*/
 	SOIL_free_image_data( img );
-	/*	continue?	*/
-	if( tex_id != 0 )
-	{
-		/*	1st face: try to load the image	*/
-		img = SOIL_load_image_from_memory(
-				x_neg_buffer, x_neg_buffer_length,
-				&width, &height, &channels, force_channels );
-		/*	channels holds the original number of channels, which may have been forced	*/
-		if( (force_channels >= 1) && (force_channels <= 4) )
-		{
-			channels = force_channels;
-		}
-		if( NULL == img )
-		{
-			/*	image loading failed	*/
-			result_string_pointer = stbi_failure_reason();
-			return 0;
-		}
-		/*	upload the texture, but reuse the assigned texture ID	*/
-		tex_id = SOIL_internal_create_OGL_texture(
-				img, width, height, channels,
-				tex_id, flags,
-				SOIL_TEXTURE_CUBE_MAP, SOIL_TEXTURE_CUBE_MAP_NEGATIVE_X,
-				SOIL_MAX_CUBE_MAP_TEXTURE_SIZE );
-		/*	and nuke the image data	*/
-		SOIL_free_image_data( img );
-	}
-	/*	continue?	*/
-	if( tex_id != 0 )
-	{
-		/*	1st face: try to load the image	*/
-		img = SOIL_load_image_from_memory(
-				y_pos_buffer, y_pos_buffer_length,
-				&width, &height, &channels, force_channels );
-		/*	channels holds the original number of channels, which may have been forced	*/
-		if( (force_channels >= 1) && (force_channels <= 4) )
-		{
-			channels = force_channels;
-		}
-		if( NULL == img )
-		{
-			/*	image loading failed	*/
-			result_string_pointer = stbi_failure_reason();
-			return 0;
-		}
-		/*	upload the texture, but reuse the assigned texture ID	*/
-		tex_id = SOIL_internal_create_OGL_texture(
-				img, width, height, channels,
-				tex_id, flags,
-				SOIL_TEXTURE_CUBE_MAP, SOIL_TEXTURE_CUBE_MAP_POSITIVE_Y,
-				SOIL_MAX_CUBE_MAP_TEXTURE_SIZE );
-		/*	and nuke the image data	*/
-		SOIL_free_image_data( img );
-	}
-	/*	continue?	*/
-	if( tex_id != 0 )
-	{
-		/*	1st face: try to load the image	*/
-		img = SOIL_load_image_from_memory(
-				y_neg_buffer, y_neg_buffer_length,
-				&width, &height, &channels, force_channels );
-		/*	channels holds the original number of channels, which may have been forced	*/
-		if( (force_channels >= 1) && (force_channels <= 4) )
-		{
-			channels = force_channels;
-		}
-		if( NULL == img )
-		{
-			/*	image loading failed	*/
-			result_string_pointer = stbi_failure_reason();
-			return 0;
-		}
-		/*	upload the texture, but reuse the assigned texture ID	*/
-		tex_id = SOIL_internal_create_OGL_texture(
-				img, width, height, channels,
-				tex_id, flags,
-				SOIL_TEXTURE_CUBE_MAP, SOIL_TEXTURE_CUBE_MAP_NEGATIVE_Y,
-				SOIL_MAX_CUBE_MAP_TEXTURE_SIZE );
-		/*	and nuke the image data	*/
-		SOIL_free_image_data( img );
-	}
-	/*	continue?	*/
-	if( tex_id != 0 )
-	{
-		/*	1st face: try to load the image	*/
-		img = SOIL_load_image_from_memory(
-				z_pos_buffer, z_pos_buffer_length,
-				&width, &height, &channels, force_channels );
-		/*	channels holds the original number of channels, which may have been forced	*/
-		if( (force_channels >= 1) && (force_channels <= 4) )
-		{
-			channels = force_channels;
-		}
-		if( NULL == img )
-		{
-			/*	image loading failed	*/
-			result_string_pointer = stbi_failure_reason();
-			return 0;
-		}
-		/*	upload the texture, but reuse the assigned texture ID	*/
-		tex_id = SOIL_internal_create_OGL_texture(
-				img, width, height, channels,
-				tex_id, flags,
-				SOIL_TEXTURE_CUBE_MAP, SOIL_TEXTURE_CUBE_MAP_POSITIVE_Z,
-				SOIL_MAX_CUBE_MAP_TEXTURE_SIZE );
-		/*	and nuke the image data	*/
-		SOIL_free_image_data( img );
-	}
-	/*	continue?	*/
-	if( tex_id != 0 )
-	{
-		/*	1st face: try to load the image	*/
-		img = SOIL_load_image_from_memory(
-				z_neg_buffer, z_neg_buffer_length,
-				&width, &height, &channels, force_channels );
-		/*	channels holds the original number of channels, which may have been forced	*/
-		if( (force_channels >= 1) && (force_channels <= 4) )
-		{
-			channels = force_channels;
-		}
-		if( NULL == img )
-		{
-			/*	image loading failed	*/
-			result_string_pointer = stbi_failure_reason();
-			return 0;
-		}
-		/*	upload the texture, but reuse the assigned texture ID	*/
-		tex_id = SOIL_internal_create_OGL_texture(
-				img, width, height, channels,
-				tex_id, flags,
-				SOIL_TEXTURE_CUBE_MAP, SOIL_TEXTURE_CUBE_MAP_NEGATIVE_Z,
-				SOIL_MAX_CUBE_MAP_TEXTURE_SIZE );
-		/*	and nuke the image data	*/
-		SOIL_free_image_data( img );
-	}
 	/*	and return the handle, such as it is	*/
 	return tex_id;
 }
 
 unsigned int
-	SOIL_load_OGL_single_cubemap
+	SOIL_load_OGL_texture_from_memory
 	(
-		const char *filename,
-		const char face_order[6],
+		const unsigned char *const buffer,
+		int buffer_length,
 		int force_channels,
 		unsigned int reuse_texture_ID,
 		unsigned int flags
@@ -667,14 +963,8 @@ unsigned int
 {
 	/*	variables	*/
 	unsigned char* img;
-	int width, height, channels, i;
-	unsigned int tex_id = 0;
-	/*	error checking	*/
-	if( filename == NULL )
-	{
-		result_string_pointer = "Invalid single cube map file name";
-		return 0;
-	}
+	int width, height, channels;
+	unsigned int tex_id;
 	/*	does the user want direct uploading of the image as a DDS file?	*/
 	if( flags & SOIL_FLAG_DDS_LOAD_DIRECT )
 	{
@@ -682,21 +972,313 @@ unsigned int
 			note: direct uploading will only load what is in the
 			DDS file, no MIPmaps will be generated, the image will
 			not be flipped, etc.	*/
-		tex_id = SOIL_direct_load_DDS( filename, reuse_texture_ID, flags, 1 );
+		tex_id = SOIL_direct_load_DDS_from_memory(
+				buffer, buffer_length,
+				reuse_texture_ID, flags, 0 );
 		if( tex_id )
 		{
 			/*	hey, it worked!!	*/
 			return tex_id;
 		}
 	}
-	/*	face order checking	*/
-	for( i = 0; i < 6; ++i )
+	/*	compressing a DXT DDS file to DXT just keeps its blocks	*/
+	tex_id = SOIL_internal_create_OGL_texture_from_DDS(
+			buffer, buffer_length, force_channels,
+			reuse_texture_ID, flags );
+	if( tex_id )
 	{
-		if( (face_order[i] != 'N') &&
-			(face_order[i] != 'S') &&
-			(face_order[i] != 'W') &&
-			(face_order[i] != 'E') &&
-			(face_order[i] != 'U') &&
+		return tex_id;
+	}
+	/*	try to load the image	*/
+	img = SOIL_load_image_from_memory(
+					buffer, buffer_length,
+					&width, &height, &channels,
+					force_channels );
+	/*	channels holds the original number of channels, which may have been forced	*/
+	if( (force_channels >= 1) && (force_channels <= 4) )
+	{
+		channels = force_channels;
+	}
+	if( NULL == img )
+	{
+		/*	image loading failed	*/
+		result_string_pointer = stbi_failure_reason();
+		return 0;
+	}
+	/*	OK, make it a texture!	*/
+	tex_id = SOIL_internal_create_OGL_texture(
+			img, width, height, channels,
+			reuse_texture_ID, flags,
+			GL_TEXTURE_2D, GL_TEXTURE_2D,
+			GL_MAX_TEXTURE_SIZE );
+	/*	and nuke the image data	*/
+	SOIL_free_image_data( img );
+	/*	and return the handle, such as it is	*/
+	return tex_id;
+}
+
+/*	the six faces of a cubemap, from files or from memory	*/
+typedef struct
+{
+	const char *const *filenames;
+	const unsigned char *const *buffers;
+	const int *buffer_lengths;
+	int force_channels;
+	unsigned int flags;
+	SOIL_internal_caps caps;
+	SOIL_internal_texture faces[6];
+	int prepared[6];
+	const char *result[6];
+}
+SOIL_internal_cubemap_batch;
+
+/*	runs on a worker thread: no OpenGL calls in here!	*/
+void SOIL_internal_cubemap_face_job( void *user_data, int face )
+{
+	static const unsigned int targets[6] =
+	{
+		SOIL_TEXTURE_CUBE_MAP_POSITIVE_X, SOIL_TEXTURE_CUBE_MAP_NEGATIVE_X,
+		SOIL_TEXTURE_CUBE_MAP_POSITIVE_Y, SOIL_TEXTURE_CUBE_MAP_NEGATIVE_Y,
+		SOIL_TEXTURE_CUBE_MAP_POSITIVE_Z, SOIL_TEXTURE_CUBE_MAP_NEGATIVE_Z
+	};
+	SOIL_internal_cubemap_batch *batch = (SOIL_internal_cubemap_batch*)user_data;
+	unsigned char* img;
+	int width, height, channels;
+	/*	try to load the image	*/
+	if( batch->filenames )
+	{
+		img = SOIL_load_image( batch->filenames[face],
+				&width, &height, &channels, batch->force_channels );
+	} else
+	{
+		img = SOIL_load_image_from_memory(
+				batch->buffers[face], batch->buffer_lengths[face],
+				&width, &height, &channels, batch->force_channels );
+	}
+	/*	channels holds the original number of channels, which may have been forced	*/
+	if( (batch->force_channels >= 1) && (batch->force_channels <= 4) )
+	{
+		channels = batch->force_channels;
+	}
+	if( NULL == img )
+	{
+		/*	image loading failed	*/
+		batch->result[face] = stbi_failure_reason();
+		return;
+	}
+	/*	resample, MIPmap, compress...	*/
+	batch->prepared[face] = SOIL_internal_prepare_texture(
+			img, width, height, channels, 0, 0, batch->flags,
+			SOIL_TEXTURE_CUBE_MAP, targets[face],
+			&batch->caps, &batch->faces[face] );
+	if( !batch->prepared[face] )
+	{
+		batch->result[face] = result_string_pointer;
+	}
+	/*	and nuke the image data	*/
+	SOIL_free_image_data( img );
+}
+
+unsigned int
+	SOIL_internal_load_OGL_cubemap_faces
+	(
+		const char *const *filenames,
+		const unsigned char *const *buffers,
+		const int *buffer_lengths,
+		int force_channels,
+		unsigned int reuse_texture_ID,
+		unsigned int flags
+	)
+{
+	SOIL_internal_cubemap_batch batch;
+	unsigned int tex_id = 0;
+	int i, all_prepared = 1;
+	memset( &batch, 0, sizeof( SOIL_internal_cubemap_batch ) );
+	batch.filenames = filenames;
+	batch.buffers = buffers;
+	batch.buffer_lengths = buffer_lengths;
+	batch.force_channels = force_channels;
+	batch.flags = flags;
+	SOIL_internal_query_caps( flags, SOIL_MAX_CUBE_MAP_TEXTURE_SIZE, &batch.caps );
+	/*	decode and process the six faces in parallel	*/
+	image_jobs_run( SOIL_internal_cubemap_face_job, &batch, 6 );
+	/*	only touch OpenGL if every face made it	*/
+	for( i = 0; i < 6; ++i )
+	{
+		if( !batch.prepared[i] )
+		{
+			result_string_pointer = (char*)batch.result[i];
+			all_prepared = 0;
+			break;
+		}
+	}
+	/*	upload the faces, creating a texture ID if necessary on the 1st one	*/
+	if( all_prepared )
+	{
+		tex_id = reuse_texture_ID;
+	}
+	for( i = 0; all_prepared && (i < 6); ++i )
+	{
+		tex_id = SOIL_internal_upload_texture( &batch.faces[i], tex_id );
+		if( 0 == tex_id )
+		{
+			break;
+		}
+	}
+	for( i = 0; i < 6; ++i )
+	{
+		SOIL_internal_free_texture( &batch.faces[i] );
+	}
+	return tex_id;
+}
+
+unsigned int
+	SOIL_load_OGL_cubemap
+	(
+		const char *x_pos_file,
+		const char *x_neg_file,
+		const char *y_pos_file,
+		const char *y_neg_file,
+		const char *z_pos_file,
+		const char *z_neg_file,
+		int force_channels,
+		unsigned int reuse_texture_ID,
+		unsigned int flags
+	)
+{
+	/*	error checking	*/
+	if( (x_pos_file == NULL) ||
+		(x_neg_file == NULL) ||
+		(y_pos_file == NULL) ||
+		(y_neg_file == NULL) ||
+		(z_pos_file == NULL) ||
+		(z_neg_file == NULL) )
+	{
+		result_string_pointer = "Invalid cube map files list";
+		return 0;
+	}
+	/*	capability checking	*/
+	if( query_cubemap_capability() != SOIL_CAPABILITY_PRESENT )
+	{
+		result_string_pointer = "No cube map capability present";
+		return 0;
+	}
+	/*	decode all the faces at once	*/
+	{
+		const char *filenames[6];
+		filenames[0] = x_pos_file;
+		filenames[1] = x_neg_file;
+		filenames[2] = y_pos_file;
+		filenames[3] = y_neg_file;
+		filenames[4] = z_pos_file;
+		filenames[5] = z_neg_file;
+		return SOIL_internal_load_OGL_cubemap_faces(
+				filenames, NULL, NULL,
+				force_channels, reuse_texture_ID, flags );
+	}
+}
+
+unsigned int
+	SOIL_load_OGL_cubemap_from_memory
+	(
+		const unsigned char *const x_pos_buffer,
+		int x_pos_buffer_length,
+		const unsigned char *const x_neg_buffer,
+		int x_neg_buffer_length,
+		const unsigned char *const y_pos_buffer,
+		int y_pos_buffer_length,
+		const unsigned char *const y_neg_buffer,
+		int y_neg_buffer_length,
+		const unsigned char *const z_pos_buffer,
+		int z_pos_buffer_length,
+		const unsigned char *const z_neg_buffer,
+		int z_neg_buffer_length,
+		int force_channels,
+		unsigned int reuse_texture_ID,
+		unsigned int flags
+	)
+{
+	/*	error checking	*/
+	if( (x_pos_buffer == NULL) ||
+		(x_neg_buffer == NULL) ||
+		(y_pos_buffer == NULL) ||
+		(y_neg_buffer == NULL) ||
+		(z_pos_buffer == NULL) ||
+		(z_neg_buffer == NULL) )
+	{
+		result_string_pointer = "Invalid cube map buffers list";
+		return 0;
+	}
+	/*	capability checking	*/
+	if( query_cubemap_capability() != SOIL_CAPABILITY_PRESENT )
+	{
+		result_string_pointer = "No cube map capability present";
+		return 0;
+	}
+	/*	decode all the faces at once	*/
+	{
+		const unsigned char *buffers[6];
+		int buffer_lengths[6];
+		buffers[0] = x_pos_buffer;
+		buffer_lengths[0] = x_pos_buffer_length;
+		buffers[1] = x_neg_buffer;
+		buffer_lengths[1] = x_neg_buffer_length;
+		buffers[2] = y_pos_buffer;
+		buffer_lengths[2] = y_pos_buffer_length;
+		buffers[3] = y_neg_buffer;
+		buffer_lengths[3] = y_neg_buffer_length;
+		buffers[4] = z_pos_buffer;
+		buffer_lengths[4] = z_pos_buffer_length;
+		buffers[5] = z_neg_buffer;
+		buffer_lengths[5] = z_neg_buffer_length;
+		return SOIL_internal_load_OGL_cubemap_faces(
+				NULL, buffers, buffer_lengths,
+				force_channels, reuse_texture_ID, flags );
+	}
+}
+
+unsigned int
+	SOIL_load_OGL_single_cubemap
+	(
+		const char *filename,
+		const char face_order[6],
+		int force_channels,
+		unsigned int reuse_texture_ID,
+		unsigned int flags
+	)
+{
+	/*	variables	*/
+	unsigned char* img;
+	int width, height, channels, i;
+	unsigned int tex_id = 0;
+	/*	error checking	*/
+	if( filename == NULL )
+	{
+		result_string_pointer = "Invalid single cube map file name";
+		return 0;
+	}
+	/*	does the user want direct uploading of the image as a DDS file?	*/
+	if( flags & SOIL_FLAG_DDS_LOAD_DIRECT )
+	{
+		/*	1st try direct loading of the image as a DDS file
+			note: direct uploading will only load what is in the
+			DDS file, no MIPmaps will be generated, the image will
+			not be flipped, etc.	*/
+		tex_id = SOIL_direct_load_DDS( filename, reuse_texture_ID, flags, 1 );
+		if( tex_id )
+		{
+			/*	hey, it worked!!	*/
+			return tex_id;
+		}
+	}
+	/*	face order checking	*/
+	for( i = 0; i < 6; ++i )
+	{
+		if( (face_order[i] != 'N') &&
+			(face_order[i] != 'S') &&
+			(face_order[i] != 'W') &&
+			(face_order[i] != 'E') &&
+			(face_order[i] != 'U') &&
 			(face_order[i] != 'D') )
 		{
 			result_string_pointer = "Invalid single cube map face order";
@@ -842,7 +1424,7 @@ unsigned int
 	)
 {
 	/*	variables	*/
-	unsigned char* sub_img;
+	SOIL_internal_caps caps;
 	int dw, dh, sz, i;
 	unsigned int tex_id;
 	/*	error checking	*/
@@ -889,21 +1471,14 @@ unsigned int
 		dh = width;
 	}
 	sz = dw+dh;
-	sub_img = (unsigned char *)malloc( sz*sz*channels );
+	/*	ask OpenGL what it can do, once for all the faces	*/
+	SOIL_internal_query_caps( flags, SOIL_MAX_CUBE_MAP_TEXTURE_SIZE, &caps );
 	/*	do the splitting and uploading	*/
 	tex_id = reuse_texture_ID;
-	for( i = 0; i < 6; ++i )
+	for( i = 0; (i < 6) && ((i == 0) || (tex_id != 0)); ++i )
 	{
-		int x, y, idx = 0;
+		SOIL_internal_texture face;
 		unsigned int cubemap_target = 0;
-		/*	copy in the sub-image	*/
-		for( y = i*dh; y < i*dh+sz; ++y )
-		{
-			for( x = i*dw*channels; x < (i*dw+sz)*channels; ++x )
-			{
-				sub_img[idx++] = data[y*width*channels+x];
-			}
-		}
 		/*	what is my texture target?
 			remember, this coordinate system is
 			LHS if viewed from inside the cube!	*/
@@ -928,1097 +1503,3958 @@ unsigned int
 			cubemap_target = SOIL_TEXTURE_CUBE_MAP_NEGATIVE_Y;
 			break;
 		}
+		/*	the face stays where it is in the strip: the rows are
+			width*channels bytes apart, and the base level is uploaded
+			from there directly whenever it needs no changes	*/
+		if( !SOIL_internal_prepare_texture(
+				&data[(i*dh*width + i*dw)*channels], sz, sz, channels,
+				width*channels, 1, flags,
+				SOIL_TEXTURE_CUBE_MAP, cubemap_target,
+				&caps, &face ) )
+		{
+			return 0;
+		}
 		/*	upload it as a texture	*/
-		tex_id = SOIL_internal_create_OGL_texture(
-				sub_img, sz, sz, channels,
-				tex_id, flags,
-				SOIL_TEXTURE_CUBE_MAP,
-				cubemap_target,
-				SOIL_MAX_CUBE_MAP_TEXTURE_SIZE );
-	}
-	/*	and nuke the image and sub-image data	*/
-	SOIL_free_image_data( sub_img );
+		tex_id = SOIL_internal_upload_texture( &face, tex_id );
+		SOIL_internal_free_texture( &face );
+	}
 	/*	and return the handle, such as it is	*/
 	return tex_id;
 }
 
-unsigned int
-	SOIL_create_OGL_texture
-	(
-		const unsigned char *const data,
-		int width, int height, int channels,
-		unsigned int reuse_texture_ID,
-		unsigned int flags
-	)
+/*	the layers of a texture array, decoded and processed in parallel
+	(or, with images set, just processed: the layers are already decoded
+	one after another in there)	*/
+typedef struct
 {
-	/*	wrapper function for 2D textures	*/
-	return SOIL_internal_create_OGL_texture(
-				data, width, height, channels,
-				reuse_texture_ID, flags,
-				GL_TEXTURE_2D, GL_TEXTURE_2D,
-				GL_MAX_TEXTURE_SIZE );
+	const char *const *filenames;
+	const unsigned char *images;
+	int width, height;
+	int force_channels;
+	unsigned int flags;
+	SOIL_internal_caps caps;
+	SOIL_internal_texture *layers;
+	int *prepared;
+	const char **result;
 }
+SOIL_internal_array_batch;
 
-#if SOIL_CHECK_FOR_GL_ERRORS
-void check_for_GL_errors( const char *calling_location )
+/*	runs on a worker thread: no OpenGL calls in here!	*/
+void SOIL_internal_array_layer_job( void *user_data, int layer )
 {
-	/*	check for errors	*/
-	GLenum err_code = glGetError();
-	while( GL_NO_ERROR != err_code )
+	SOIL_internal_array_batch *batch = (SOIL_internal_array_batch*)user_data;
+	unsigned char* img;
+	int width, height, channels;
+	if( batch->images )
 	{
-		printf( "OpenGL Error @ %s: %i", calling_location, err_code );
-		err_code = glGetError();
+		/*	the layer is right there, resample, MIPmap, compress...	*/
+		size_t layer_size = (size_t)batch->width * batch->height * batch->force_channels;
+		batch->prepared[layer] = SOIL_internal_prepare_texture(
+				batch->images + layer * layer_size,
+				batch->width, batch->height, batch->force_channels, 0, 1, batch->flags,
+				SOIL_TEXTURE_2D_ARRAY, SOIL_TEXTURE_2D_ARRAY,
+				&batch->caps, &batch->layers[layer] );
+		if( !batch->prepared[layer] )
+		{
+			batch->result[layer] = result_string_pointer;
+		}
+		return;
 	}
+	/*	try to load the image	*/
+	img = SOIL_load_image( batch->filenames[layer],
+			&width, &height, &channels, batch->force_channels );
+	/*	channels holds the original number of channels, which may have been forced	*/
+	if( (batch->force_channels >= 1) && (batch->force_channels <= 4) )
+	{
+		channels = batch->force_channels;
+	}
+	if( NULL == img )
+	{
+		/*	image loading failed	*/
+		batch->result[layer] = stbi_failure_reason();
+		return;
+	}
+	/*	resample, MIPmap, compress...	*/
+	batch->prepared[layer] = SOIL_internal_prepare_texture(
+			img, width, height, channels, 0, 0, batch->flags,
+			SOIL_TEXTURE_2D_ARRAY, SOIL_TEXTURE_2D_ARRAY,
+			&batch->caps, &batch->layers[layer] );
+	if( !batch->prepared[layer] )
+	{
+		batch->result[layer] = result_string_pointer;
+	}
+	/*	and nuke the image data	*/
+	SOIL_free_image_data( img );
 }
-#else
-void check_for_GL_errors( const char *calling_location )
-{
-	/*	no check for errors	*/
-}
-#endif
 
+/*	uploads every layer of every level with one call per level, so the
+	driver allocates each level of the whole array at once	*/
 unsigned int
-	SOIL_internal_create_OGL_texture
+	SOIL_internal_upload_texture_array
 	(
-		const unsigned char *const data,
-		int width, int height, int channels,
-		unsigned int reuse_texture_ID,
-		unsigned int flags,
-		unsigned int opengl_texture_type,
-		unsigned int opengl_texture_target,
-		unsigned int texture_check_size_enum
+		const SOIL_internal_texture *layers,
+		int num_layers,
+		unsigned int reuse_texture_ID
 	)
 {
-	/*	variables	*/
-	unsigned char* img;
+	const SOIL_internal_texture *first = &layers[0];
+	unsigned char *level_data;
 	unsigned int tex_id;
-	unsigned int internal_texture_format = 0, original_texture_format = 0;
-	int DXT_mode = SOIL_CAPABILITY_UNKNOWN;
-	int max_supported_size;
-	/*	If the user wants to use the texture rectangle I kill a few flags	*/
-	if( flags & SOIL_FLAG_TEXTURE_RECTANGLE )
+	int level, layer, level_size;
+	/*	the levels are put together in here, the largest one first	*/
+	level_data = (unsigned char*)malloc( first->levels[0].size * num_layers );
+	if( NULL == level_data )
 	{
-		/*	well, the user asked for it, can we do that?	*/
-		if( query_tex_rectangle_capability() == SOIL_CAPABILITY_PRESENT )
+		result_string_pointer = "malloc failed";
+		return 0;
+	}
+	/*	create the OpenGL texture ID handle
+		(note: allowing a forced texture ID lets me reload a texture)	*/
+	tex_id = reuse_texture_ID;
+	if( tex_id == 0 )
+	{
+		glGenTextures( 1, &tex_id );
+	}
+	check_for_GL_errors( "glGenTextures" );
+	if( 0 == tex_id )
+	{
+		SOIL_free_image_data( level_data );
+		result_string_pointer = "Failed to generate an OpenGL texture name; missing OpenGL context?";
+		return 0;
+	}
+	glBindTexture( SOIL_TEXTURE_2D_ARRAY, tex_id );
+	check_for_GL_errors( "glBindTexture" );
+	/*	a texture that was still streaming in starts over	*/
+	if( SOIL_internal_progressive_cancel( reuse_texture_ID ) )
+	{
+		SOIL_internal_residency_free_source(
+				texture_residency_forget( &SOIL_residency, tex_id ) );
+		glTexParameteri( SOIL_TEXTURE_2D_ARRAY, SOIL_TEXTURE_BASE_LEVEL, 0 );
+	}
+	for( level = 0; level < first->num_levels; ++level )
+	{
+		const SOIL_internal_level *L = &first->levels[level];
+		level_size = L->size;
+		for( layer = 0; layer < num_layers; ++layer )
 		{
-			/*	only allow this if the user in _NOT_ trying to do a cubemap!	*/
-			if( opengl_texture_type == GL_TEXTURE_2D )
-			{
-				/*	clean out the flags that cannot be used with texture rectangles	*/
-				flags &= ~(
-						SOIL_FLAG_POWER_OF_TWO | SOIL_FLAG_MIPMAPS |
-						SOIL_FLAG_TEXTURE_REPEATS
-					);
-				/*	and change my target	*/
-				opengl_texture_target = SOIL_TEXTURE_RECTANGLE_ARB;
-				opengl_texture_type = SOIL_TEXTURE_RECTANGLE_ARB;
-			} else
-			{
-				/*	not allowed for any other uses (yes, I'm looking at you, cubemaps!)	*/
-				flags &= ~SOIL_FLAG_TEXTURE_RECTANGLE;
-			}
-
+			memcpy( &level_data[layer * level_size],
+					layers[layer].levels[level].data, level_size );
+		}
+		if( L->compressed )
+		{
+			soilGlCompressedTexImage3D(
+				SOIL_TEXTURE_2D_ARRAY, level,
+				first->internal_texture_format, L->width, L->height, num_layers, 0,
+				level_size * num_layers, level_data );
+			check_for_GL_errors( "glCompressedTexImage3D" );
 		} else
 		{
-			/*	can't do it, and that is a breakable offense (uv coords use pixels instead of [0,1]!)	*/
-			result_string_pointer = "Texture Rectangle extension unsupported";
-			return 0;
+			/*	the rows of my levels are tightly packed	*/
+			GLint previous_alignment = 4;
+			glGetIntegerv( GL_UNPACK_ALIGNMENT, &previous_alignment );
+			glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+			soilGlTexImage3D(
+				SOIL_TEXTURE_2D_ARRAY, level,
+				first->internal_texture_format, L->width, L->height, num_layers, 0,
+				first->original_texture_format, GL_UNSIGNED_BYTE, level_data );
+			check_for_GL_errors( "glTexImage3D" );
+			glPixelStorei( GL_UNPACK_ALIGNMENT, previous_alignment );
 		}
+		SOIL_internal_residency_note_upload_layers(
+				tex_id, level, first->internal_texture_format,
+				L->width, L->height, num_layers );
 	}
-	/*	create a copy the image data	*/
-	img = (unsigned char*)malloc( width*height*channels );
-	memcpy( img, data, width*height*channels );
-	/*	does the user want me to invert the image?	*/
-	if( flags & SOIL_FLAG_INVERT_Y )
+	SOIL_free_image_data( level_data );
+	SOIL_internal_set_parameters( first );
+	/*	no file to reload it from, and keep within the budget	*/
+	SOIL_internal_residency_set_source( tex_id, NULL, 0, 0, 0 );
+	SOIL_internal_residency_enforce( tex_id );
+	result_string_pointer = "Images loaded as an OpenGL texture array";
+	return tex_id;
+}
+
+/*	decodes and processes all the layers in parallel, then uploads them	*/
+unsigned int
+	SOIL_internal_create_texture_array
+	(
+		SOIL_internal_array_batch *batch,
+		int num_layers,
+		unsigned int reuse_texture_ID
+	)
+{
+	unsigned int tex_id;
+	int i, level, all_prepared = 1;
+	batch->flags &= ~SOIL_FLAG_TEXTURE_RECTANGLE;
+	batch->layers = (SOIL_internal_texture*)calloc( num_layers, sizeof( SOIL_internal_texture ) );
+	batch->prepared = (int*)calloc( num_layers, sizeof( int ) );
+	batch->result = (const char**)calloc( num_layers, sizeof( const char* ) );
+	if( (NULL == batch->layers) || (NULL == batch->prepared) || (NULL == batch->result) )
 	{
-		int i, j;
-		for( j = 0; j*2 < height; ++j )
+		free( batch->layers );
+		free( batch->prepared );
+		free( batch->result );
+		result_string_pointer = "malloc failed";
+		return 0;
+	}
+	SOIL_internal_query_caps( batch->flags, GL_MAX_TEXTURE_SIZE, &batch->caps );
+	image_jobs_run( SOIL_internal_array_layer_job, batch, num_layers );
+	/*	only touch OpenGL if every layer made it, all alike	*/
+	for( i = 0; all_prepared && (i < num_layers); ++i )
+	{
+		const SOIL_internal_texture *layer = &batch->layers[i];
+		if( !batch->prepared[i] )
 		{
-			int index1 = j * width * channels;
-			int index2 = (height - 1 - j) * width * channels;
-			for( i = width * channels; i > 0; --i )
+			result_string_pointer = (char*)batch->result[i];
+			all_prepared = 0;
+			break;
+		}
+		if( (layer->num_levels != batch->layers[0].num_levels) ||
+			(layer->internal_texture_format != batch->layers[0].internal_texture_format) ||
+			(layer->original_texture_format != batch->layers[0].original_texture_format) )
+		{
+			result_string_pointer = "Texture array layers do not all have the same format";
+			all_prepared = 0;
+			break;
+		}
+		for( level = 0; level < layer->num_levels; ++level )
+		{
+			const SOIL_internal_level *L = &layer->levels[level];
+			const SOIL_internal_level *L0 = &batch->layers[0].levels[level];
+			if( (L->width != L0->width) || (L->height != L0->height) ||
+				(L->size != L0->size) || (L->compressed != L0->compressed) )
 			{
-				unsigned char temp = img[index1];
-				img[index1] = img[index2];
-				img[index2] = temp;
-				++index1;
-				++index2;
+				result_string_pointer = "Texture array layers are not all the same size";
+				all_prepared = 0;
+				break;
 			}
 		}
 	}
-	/*	does the user want me to scale the colors into the NTSC safe RGB range?	*/
-	if( flags & SOIL_FLAG_NTSC_SAFE_RGB )
+	if( all_prepared && batch->layers[0].levels[0].compressed &&
+		(NULL == soilGlCompressedTexImage3D) )
 	{
-		scale_image_RGB_to_NTSC_safe( img, width, height, channels );
+		result_string_pointer = "Compressed texture arrays not supported by the OpenGL driver";
+		all_prepared = 0;
 	}
-	/*	does the user want me to convert from straight to pre-multiplied alpha?
-		(and do we even _have_ alpha?)	*/
-	if( flags & SOIL_FLAG_MULTIPLY_ALPHA )
+	tex_id = 0;
+	if( all_prepared )
 	{
-		int i;
-		switch( channels )
+		tex_id = SOIL_internal_upload_texture_array(
+				batch->layers, num_layers, reuse_texture_ID );
+	}
+	for( i = 0; i < num_layers; ++i )
+	{
+		SOIL_internal_free_texture( &batch->layers[i] );
+	}
+	free( batch->layers );
+	free( batch->prepared );
+	free( batch->result );
+	return tex_id;
+}
+
+unsigned int
+	SOIL_load_OGL_texture_array
+	(
+		const char *const *filenames,
+		int num_layers,
+		int force_channels,
+		unsigned int reuse_texture_ID,
+		unsigned int flags
+	)
+{
+	SOIL_internal_array_batch batch;
+	GLint max_layers = 0;
+	unsigned int tex_id = 0;
+	int i;
+	/*	error checking	*/
+	if( (NULL == filenames) || (num_layers < 1) )
+	{
+		result_string_pointer = "Invalid texture array files list";
+		return 0;
+	}
+	for( i = 0; i < num_layers; ++i )
+	{
+		if( NULL == filenames[i] )
 		{
-		case 2:
-			for( i = 0; i < 2*width*height; i += 2 )
-			{
-				img[i] = (img[i] * img[i+1] + 128) >> 8;
-			}
-			break;
-		case 4:
-			for( i = 0; i < 4*width*height; i += 4 )
-			{
-				img[i+0] = (img[i+0] * img[i+3] + 128) >> 8;
-				img[i+1] = (img[i+1] * img[i+3] + 128) >> 8;
-				img[i+2] = (img[i+2] * img[i+3] + 128) >> 8;
-			}
-			break;
-		default:
-			/*	no other number of channels contains alpha data	*/
-			break;
+			result_string_pointer = "Invalid texture array files list";
+			return 0;
 		}
 	}
-	/*	if the user can't support NPOT textures, make sure we force the POT option	*/
-	if( (query_NPOT_capability() == SOIL_CAPABILITY_NONE) &&
-		!(flags & SOIL_FLAG_TEXTURE_RECTANGLE) )
+	/*	capability checking	*/
+	if( query_texture_array_capability() != SOIL_CAPABILITY_PRESENT )
 	{
-		/*	add in the POT flag */
-		flags |= SOIL_FLAG_POWER_OF_TWO;
+		result_string_pointer = "No texture array capability present";
+		return 0;
 	}
-	/*	how large of a texture can this OpenGL implementation handle?	*/
-	/*	texture_check_size_enum will be GL_MAX_TEXTURE_SIZE or SOIL_MAX_CUBE_MAP_TEXTURE_SIZE	*/
-	glGetIntegerv( texture_check_size_enum, &max_supported_size );
-	/*	do I need to make it a power of 2?	*/
-	if(
-		(flags & SOIL_FLAG_POWER_OF_TWO) ||	/*	user asked for it	*/
-		(flags & SOIL_FLAG_MIPMAPS) ||		/*	need it for the MIP-maps	*/
-		(width > max_supported_size) ||		/*	it's too big, (make sure it's	*/
-		(height > max_supported_size) )		/*	2^n for later down-sampling)	*/
+	/*	a single KTX2 file may hold the whole array	*/
+	if( (num_layers == 1) && (flags & SOIL_FLAG_DDS_LOAD_DIRECT) )
 	{
-		int new_width = 1;
-		int new_height = 1;
-		while( new_width < width )
+		tex_id = SOIL_direct_load_DDS( filenames[0], reuse_texture_ID, flags, SOIL_DIRECT_ARRAY );
+		if( tex_id )
 		{
-			new_width *= 2;
+			/*	hey, it worked!!	*/
+			return tex_id;
 		}
-		while( new_height < height )
+	}
+	max_layers = SOIL_internal_GL_limit( SOIL_MAX_ARRAY_TEXTURE_LAYERS );
+	if( num_layers > max_layers )
+	{
+		result_string_pointer = "Too many texture array layers for the OpenGL driver";
+		return 0;
+	}
+	/*	decode and process all the layers in parallel	*/
+	memset( &batch, 0, sizeof( SOIL_internal_array_batch ) );
+	batch.filenames = filenames;
+	batch.force_channels = force_channels;
+	batch.flags = flags;
+	return SOIL_internal_create_texture_array( &batch, num_layers, reuse_texture_ID );
+}
+
+unsigned int
+	SOIL_load_OGL_texture_volume
+	(
+		const char *filename,
+		unsigned int reuse_texture_ID,
+		unsigned int flags
+	)
+{
+	/*	error checking	*/
+	if( NULL == filename )
+	{
+		result_string_pointer = "Invalid volume texture file name";
+		return 0;
+	}
+	/*	capability checking	*/
+	if( query_3D_capability() != SOIL_CAPABILITY_PRESENT )
+	{
+		result_string_pointer = "No 3D texture capability present";
+		return 0;
+	}
+	/*	volumes only come from DDS and KTX2 files, just as they are	*/
+	return SOIL_direct_load_DDS( filename, reuse_texture_ID, flags, SOIL_DIRECT_VOLUME );
+}
+
+/*	the open packages, a handle is the index + 1	*/
+static texture_package *SOIL_packages = NULL;
+static int SOIL_num_packages = 0;
+
+int
+	SOIL_open_package
+	(
+		const char *filename
+	)
+{
+	texture_package package;
+	int slot;
+	if( NULL == filename )
+	{
+		result_string_pointer = "NULL filename";
+		return 0;
+	}
+	if( !texture_package_open( &package, filename ) )
+	{
+		result_string_pointer = "Can not open the package, or it is not a texture package";
+		return 0;
+	}
+	/*	reuse the slot of a closed package	*/
+	for( slot = 0; slot < SOIL_num_packages; ++slot )
+	{
+		if( NULL == SOIL_packages[slot].data )
 		{
-			new_height *= 2;
+			break;
 		}
-		/*	still?	*/
-		if( (new_width != width) || (new_height != height) )
+	}
+	if( slot == SOIL_num_packages )
+	{
+		texture_package *packages = (texture_package*)realloc(
+				SOIL_packages, (SOIL_num_packages + 1) * sizeof( texture_package ) );
+		if( NULL == packages )
 		{
-			/*	yep, resize	*/
-			unsigned char *resampled = (unsigned char*)malloc( channels*new_width*new_height );
-			up_scale_image(
-					img, width, height, channels,
-					resampled, new_width, new_height );
-			/*	OJO	this is for debug only!	*/
-			/*
-			SOIL_save_image( "\\showme.bmp", SOIL_SAVE_TYPE_BMP,
-							new_width, new_height, channels,
-							resampled );
-			*/
-			/*	nuke the old guy, then point it at the new guy	*/
-			SOIL_free_image_data( img );
-			img = resampled;
-			width = new_width;
-			height = new_height;
+			texture_package_close( &package );
+			result_string_pointer = "malloc failed";
+			return 0;
 		}
+		SOIL_packages = packages;
+		++SOIL_num_packages;
+	}
+	SOIL_packages[slot] = package;
+	result_string_pointer = "Package opened";
+	return slot + 1;
+}
+
+void
+	SOIL_close_package
+	(
+		int package
+	)
+{
+	if( (package >= 1) && (package <= SOIL_num_packages) )
+	{
+		texture_package_close( &SOIL_packages[package - 1] );
+	}
+}
+
+unsigned int
+	SOIL_load_OGL_texture_from_package
+	(
+		int package,
+		const char *name,
+		int force_channels,
+		unsigned int reuse_texture_ID,
+		unsigned int flags
+	)
+{
+	texture_package_entry entry;
+	/*	error checking	*/
+	if( (package < 1) || (package > SOIL_num_packages) ||
+		(NULL == SOIL_packages[package - 1].data) )
+	{
+		result_string_pointer = "Invalid package handle";
+		return 0;
+	}
+	if( (NULL == name) ||
+		!texture_package_find( &SOIL_packages[package - 1], name, &entry ) )
+	{
+		result_string_pointer = "The texture is not in the package";
+		return 0;
+	}
+	if( entry.size > 0x7FFFFFFF )
+	{
+		result_string_pointer = "The texture is too large to load";
+		return 0;
+	}
+	/*	the entry is the original file, in the mapping	*/
+	return SOIL_load_OGL_texture_from_memory(
+			entry.data, (int)entry.size,
+			force_channels, reuse_texture_ID, flags );
+}
+
+/*	the open animations, a handle is the index + 1	*/
+typedef struct
+{
+	image_anim anim;
+	unsigned char *file;
+	/*	the texture that shows what the canvas shows, if any, and
+		whether it can be updated a rectangle at a time	*/
+	unsigned int texture;
+	int sub_updates;
+}
+SOIL_internal_animation;
+
+static SOIL_internal_animation *SOIL_animations = NULL;
+static int SOIL_num_animations = 0;
+
+int
+	SOIL_open_animation
+	(
+		const char *filename,
+		size_t cache_bytes
+	)
+{
+	SOIL_internal_animation animation;
+	int length, slot;
+	memset( &animation, 0, sizeof( SOIL_internal_animation ) );
+	animation.file = SOIL_internal_read_file( filename, &length );
+	if( NULL == animation.file )
+	{
+		result_string_pointer = "Can not read the animation file";
+		return 0;
+	}
+	if( !image_anim_open_memory( &animation.anim, animation.file, length ) )
+	{
+		result_string_pointer = (char*)animation.anim.error;
+		free( animation.file );
+		return 0;
+	}
+	image_anim_set_cache( &animation.anim, cache_bytes );
+	/*	reuse the slot of a closed animation	*/
+	for( slot = 0; slot < SOIL_num_animations; ++slot )
+	{
+		if( NULL == SOIL_animations[slot].file )
+		{
+			break;
+		}
+	}
+	if( slot == SOIL_num_animations )
+	{
+		SOIL_internal_animation *animations = (SOIL_internal_animation*)realloc(
+				SOIL_animations, (SOIL_num_animations + 1) * sizeof( SOIL_internal_animation ) );
+		if( NULL == animations )
+		{
+			image_anim_free( &animation.anim );
+			free( animation.file );
+			result_string_pointer = "malloc failed";
+			return 0;
+		}
+		SOIL_animations = animations;
+		++SOIL_num_animations;
+	}
+	SOIL_animations[slot] = animation;
+	result_string_pointer = "Animation opened";
+	return slot + 1;
+}
+
+void
+	SOIL_close_animation
+	(
+		int animation
+	)
+{
+	if( (animation >= 1) && (animation <= SOIL_num_animations) &&
+		(NULL != SOIL_animations[animation - 1].file) )
+	{
+		SOIL_internal_animation *A = &SOIL_animations[animation - 1];
+		image_anim_free( &A->anim );
+		free( A->file );
+		memset( A, 0, sizeof( SOIL_internal_animation ) );
+	}
+}
+
+int
+	SOIL_animation_info
+	(
+		int animation,
+		int *width, int *height,
+		int *num_frames,
+		int *loop_count
+	)
+{
+	const image_anim *anim;
+	if( (animation < 1) || (animation > SOIL_num_animations) ||
+		(NULL == SOIL_animations[animation - 1].file) )
+	{
+		result_string_pointer = "Invalid animation handle";
+		return 0;
+	}
+	anim = &SOIL_animations[animation - 1].anim;
+	if( width )
+	{
+		*width = anim->width;
+	}
+	if( height )
+	{
+		*height = anim->height;
+	}
+	if( num_frames )
+	{
+		*num_frames = anim->num_frames;
+	}
+	if( loop_count )
+	{
+		*loop_count = anim->loop_count;
+	}
+	return 1;
+}
+
+unsigned int
+	SOIL_load_OGL_animation_frame
+	(
+		int animation,
+		int frame,
+		unsigned int reuse_texture_ID,
+		int *delay_ms
+	)
+{
+	SOIL_internal_animation *A;
+	image_anim_rect dirty;
+	SOIL_internal_caps caps;
+	SOIL_internal_texture texture;
+	unsigned int tex_id;
+	/*	error checking	*/
+	if( (animation < 1) || (animation > SOIL_num_animations) ||
+		(NULL == SOIL_animations[animation - 1].file) )
+	{
+		result_string_pointer = "Invalid animation handle";
+		return 0;
+	}
+	A = &SOIL_animations[animation - 1];
+	if( (frame < 0) || (frame >= A->anim.num_frames) )
+	{
+		result_string_pointer = "No such animation frame";
+		return 0;
+	}
+	if( !image_anim_seek( &A->anim, frame, &dirty ) )
+	{
+		A->texture = 0;
+		result_string_pointer = (char*)A->anim.error;
+		return 0;
+	}
+	if( delay_ms )
+	{
+		*delay_ms = A->anim.frames[frame].delay_ms;
+	}
+	if( (0 != reuse_texture_ID) && (reuse_texture_ID == A->texture) && A->sub_updates )
+	{
+		/*	the texture shows the frame before, only what changed goes up	*/
+		if( (dirty.width > 0) && (dirty.height > 0) )
+		{
+			GLint previous_alignment = 4, previous_row_length = 0;
+			glBindTexture( GL_TEXTURE_2D, reuse_texture_ID );
+			check_for_GL_errors( "glBindTexture" );
+			glGetIntegerv( GL_UNPACK_ALIGNMENT, &previous_alignment );
+			glGetIntegerv( GL_UNPACK_ROW_LENGTH, &previous_row_length );
+			glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+			glPixelStorei( GL_UNPACK_ROW_LENGTH, A->anim.width );
+			glTexSubImage2D( GL_TEXTURE_2D, 0, dirty.x, dirty.y, dirty.width, dirty.height,
+					GL_RGBA, GL_UNSIGNED_BYTE,
+					A->anim.canvas + ((size_t)dirty.y * A->anim.width + dirty.x) * 4 );
+			check_for_GL_errors( "glTexSubImage2D" );
+			glPixelStorei( GL_UNPACK_ROW_LENGTH, previous_row_length );
+			glPixelStorei( GL_UNPACK_ALIGNMENT, previous_alignment );
+		}
+		result_string_pointer = "Animation frame updated";
+		return reuse_texture_ID;
+	}
+	/*	the whole frame, straight from the canvas: no MIPmaps, so later
+		frames can be put in a rectangle at a time	*/
+	SOIL_internal_query_caps( 0, GL_MAX_TEXTURE_SIZE, &caps );
+	if( !SOIL_internal_prepare_texture(
+			A->anim.canvas, A->anim.width, A->anim.height, 4, 0, 1, 0,
+			GL_TEXTURE_2D, GL_TEXTURE_2D, &caps, &texture ) )
+	{
+		A->texture = 0;
+		return 0;
+	}
+	/*	if it had to be resized (no NPOT, or too large), every frame will be	*/
+	A->sub_updates = (texture.num_levels == 1) &&
+			(texture.levels[0].width == A->anim.width) &&
+			(texture.levels[0].height == A->anim.height) &&
+			!texture.levels[0].compressed;
+	tex_id = SOIL_internal_upload_texture( &texture, reuse_texture_ID );
+	SOIL_internal_free_texture( &texture );
+	A->texture = tex_id;
+	return tex_id;
+}
+
+unsigned int
+	SOIL_load_OGL_animation_array
+	(
+		int animation,
+		unsigned int reuse_texture_ID,
+		unsigned int flags
+	)
+{
+	SOIL_internal_animation *A;
+	SOIL_internal_array_batch batch;
+	unsigned char *frames;
+	size_t frame_size;
+	GLint max_layers = 0;
+	unsigned int tex_id;
+	int i;
+	/*	error checking	*/
+	if( (animation < 1) || (animation > SOIL_num_animations) ||
+		(NULL == SOIL_animations[animation - 1].file) )
+	{
+		result_string_pointer = "Invalid animation handle";
+		return 0;
+	}
+	A = &SOIL_animations[animation - 1];
+	/*	capability checking	*/
+	if( query_texture_array_capability() != SOIL_CAPABILITY_PRESENT )
+	{
+		result_string_pointer = "No texture array capability present";
+		return 0;
+	}
+	max_layers = SOIL_internal_GL_limit( SOIL_MAX_ARRAY_TEXTURE_LAYERS );
+	if( A->anim.num_frames > max_layers )
+	{
+		result_string_pointer = "Too many texture array layers for the OpenGL driver";
+		return 0;
+	}
+	/*	the frames have to be decoded in order, each one is drawn over the last	*/
+	frame_size = (size_t)A->anim.width * A->anim.height * 4;
+	frames = (unsigned char*)malloc( frame_size * A->anim.num_frames );
+	if( NULL == frames )
+	{
+		result_string_pointer = "malloc failed";
+		return 0;
+	}
+	/*	whatever texture showed the canvas will not after this	*/
+	A->texture = 0;
+	for( i = 0; i < A->anim.num_frames; ++i )
+	{
+		if( !image_anim_seek( &A->anim, i, NULL ) )
+		{
+			free( frames );
+			result_string_pointer = (char*)A->anim.error;
+			return 0;
+		}
+		memcpy( frames + i * frame_size, A->anim.canvas, frame_size );
+	}
+	/*	then the layers are processed in parallel	*/
+	memset( &batch, 0, sizeof( SOIL_internal_array_batch ) );
+	batch.images = frames;
+	batch.width = A->anim.width;
+	batch.height = A->anim.height;
+	batch.force_channels = 4;
+	batch.flags = flags;
+	tex_id = SOIL_internal_create_texture_array( &batch, A->anim.num_frames, reuse_texture_ID );
+	free( frames );
+	return tex_id;
+}
+
+unsigned int
+	SOIL_create_OGL_texture
+	(
+		const unsigned char *const data,
+		int width, int height, int channels,
+		unsigned int reuse_texture_ID,
+		unsigned int flags
+	)
+{
+	/*	wrapper function for 2D textures	*/
+	return SOIL_internal_create_OGL_texture(
+				data, width, height, channels,
+				reuse_texture_ID, flags,
+				GL_TEXTURE_2D, GL_TEXTURE_2D,
+				GL_MAX_TEXTURE_SIZE );
+}
+
+#if SOIL_CHECK_FOR_GL_ERRORS
+void check_for_GL_errors( const char *calling_location )
+{
+	/*	check for errors	*/
+	GLenum err_code = glGetError();
+	while( GL_NO_ERROR != err_code )
+	{
+		printf( "OpenGL Error @ %s: %i", calling_location, err_code );
+		err_code = glGetError();
+	}
+}
+#else
+void check_for_GL_errors( const char *calling_location )
+{
+	/*	no check for errors	*/
+}
+#endif
+
+void
+	SOIL_internal_query_caps
+	(
+		unsigned int flags,
+		unsigned int texture_check_size_enum,
+		SOIL_internal_caps *caps
+	)
+{
+	caps->tex_rectangle = SOIL_CAPABILITY_UNKNOWN;
+	caps->DXT = SOIL_CAPABILITY_UNKNOWN;
+	caps->RGTC = SOIL_CAPABILITY_UNKNOWN;
+	if( flags & SOIL_FLAG_TEXTURE_RECTANGLE )
+	{
+		caps->tex_rectangle = query_tex_rectangle_capability();
+	}
+	if( flags & SOIL_FLAG_COMPRESS_TO_DXT )
+	{
+		caps->DXT = query_DXT_capability();
+	}
+	if( flags & SOIL_FLAG_COMPRESS_TO_RGTC )
+	{
+		caps->RGTC = query_RGTC_capability();
+	}
+	caps->NPOT = query_NPOT_capability();
+	/*	how large of a texture can this OpenGL implementation handle?	*/
+	/*	texture_check_size_enum will be GL_MAX_TEXTURE_SIZE or SOIL_MAX_CUBE_MAP_TEXTURE_SIZE	*/
+	caps->max_supported_size = SOIL_internal_GL_limit( texture_check_size_enum );
+	caps->drop_levels = SOIL_residency_reload_drop_levels;
+}
+
+int
+	SOIL_internal_prepare_base
+	(
+		const unsigned char *const data,
+		int width, int height, int channels,
+		int row_stride, int borrow_data,
+		unsigned int flags,
+		unsigned int opengl_texture_type,
+		unsigned int opengl_texture_target,
+		const SOIL_internal_caps *caps,
+		SOIL_internal_texture *texture
+	)
+{
+	/*	variables	*/
+	unsigned char* img;
+	int max_supported_size = caps->max_supported_size;
+	int DXT_mode = SOIL_CAPABILITY_UNKNOWN;
+	int RGTC_mode = SOIL_CAPABILITY_UNKNOWN;
+	int level, in_place;
+	memset( texture, 0, sizeof( SOIL_internal_texture ) );
+	if( row_stride < 1 )
+	{
+		row_stride = width*channels;
+	}
+	/*	If the user wants to use the texture rectangle I kill a few flags	*/
+	if( flags & SOIL_FLAG_TEXTURE_RECTANGLE )
+	{
+		/*	well, the user asked for it, can we do that?	*/
+		if( caps->tex_rectangle == SOIL_CAPABILITY_PRESENT )
+		{
+			/*	only allow this if the user in _NOT_ trying to do a cubemap!	*/
+			if( opengl_texture_type == GL_TEXTURE_2D )
+			{
+				/*	clean out the flags that cannot be used with texture rectangles	*/
+				flags &= ~(
+						SOIL_FLAG_POWER_OF_TWO | SOIL_FLAG_MIPMAPS |
+						SOIL_FLAG_TEXTURE_REPEATS
+					);
+				/*	and change my target	*/
+				opengl_texture_target = SOIL_TEXTURE_RECTANGLE_ARB;
+				opengl_texture_type = SOIL_TEXTURE_RECTANGLE_ARB;
+			} else
+			{
+				/*	not allowed for any other uses (yes, I'm looking at you, cubemaps!)	*/
+				flags &= ~SOIL_FLAG_TEXTURE_RECTANGLE;
+			}
+
+		} else
+		{
+			/*	can't do it, and that is a breakable offense (uv coords use pixels instead of [0,1]!)	*/
+			result_string_pointer = "Texture Rectangle extension unsupported";
+			return 0;
+		}
+	}
+	/*	if the user can't support NPOT textures, make sure we force the POT option	*/
+	if( (caps->NPOT == SOIL_CAPABILITY_NONE) &&
+		!(flags & SOIL_FLAG_TEXTURE_RECTANGLE) )
+	{
+		/*	add in the POT flag */
+		flags |= SOIL_FLAG_POWER_OF_TWO;
+	}
+	/*	RGTC wins if both compressions were asked for	*/
+	if( (flags & SOIL_FLAG_COMPRESS_TO_RGTC) &&
+		(caps->RGTC == SOIL_CAPABILITY_PRESENT) )
+	{
+		RGTC_mode = SOIL_CAPABILITY_PRESENT;
+	} else if( (flags & SOIL_FLAG_COMPRESS_TO_DXT) &&
+		(caps->DXT == SOIL_CAPABILITY_PRESENT) )
+	{
+		DXT_mode = SOIL_CAPABILITY_PRESENT;
+	}
+	/*	can the base level be uploaded straight from the caller's data?
+		(only if nothing below is going to change it)	*/
+	in_place = borrow_data &&
+		!(flags & (	SOIL_FLAG_INVERT_Y | SOIL_FLAG_NTSC_SAFE_RGB |
+					SOIL_FLAG_MULTIPLY_ALPHA | SOIL_FLAG_CoCg_Y )) &&
+		(DXT_mode != SOIL_CAPABILITY_PRESENT) &&
+		(RGTC_mode != SOIL_CAPABILITY_PRESENT) &&
+		(caps->drop_levels < 1) &&
+		(width <= max_supported_size) && (height <= max_supported_size) &&
+		(	!(flags & (SOIL_FLAG_POWER_OF_TWO | SOIL_FLAG_MIPMAPS)) ||
+			(((width & (width - 1)) == 0) && ((height & (height - 1)) == 0)) );
+	if( in_place )
+	{
+		img = (unsigned char*)data;
+	} else
+	{
+		/*	create a copy the image data	*/
+		img = (unsigned char*)malloc( width*height*channels );
+		if( NULL == img )
+		{
+			result_string_pointer = "malloc failed";
+			return 0;
+		}
+		if( row_stride == width*channels )
+		{
+			memcpy( img, data, width*height*channels );
+		} else
+		{
+			int j;
+			for( j = 0; j < height; ++j )
+			{
+				memcpy( &img[j*width*channels], &data[j*row_stride], width*channels );
+			}
+		}
+	}
+	/*	does the user want me to invert the image?	*/
+	if( flags & SOIL_FLAG_INVERT_Y )
+	{
+		int i, j;
+		for( j = 0; j*2 < height; ++j )
+		{
+			int index1 = j * width * channels;
+			int index2 = (height - 1 - j) * width * channels;
+			for( i = width * channels; i > 0; --i )
+			{
+				unsigned char temp = img[index1];
+				img[index1] = img[index2];
+				img[index2] = temp;
+				++index1;
+				++index2;
+			}
+		}
+	}
+	/*	does the user want me to scale the colors into the NTSC safe RGB range?	*/
+	if( flags & SOIL_FLAG_NTSC_SAFE_RGB )
+	{
+		scale_image_RGB_to_NTSC_safe( img, width, height, channels );
+	}
+	/*	does the user want me to convert from straight to pre-multiplied alpha?
+		(and do we even _have_ alpha?)	*/
+	if( flags & SOIL_FLAG_MULTIPLY_ALPHA )
+	{
+		int i;
+		switch( channels )
+		{
+		case 2:
+			for( i = 0; i < 2*width*height; i += 2 )
+			{
+				img[i] = (img[i] * img[i+1] + 128) >> 8;
+			}
+			break;
+		case 4:
+			for( i = 0; i < 4*width*height; i += 4 )
+			{
+				img[i+0] = (img[i+0] * img[i+3] + 128) >> 8;
+				img[i+1] = (img[i+1] * img[i+3] + 128) >> 8;
+				img[i+2] = (img[i+2] * img[i+3] + 128) >> 8;
+			}
+			break;
+		default:
+			/*	no other number of channels contains alpha data	*/
+			break;
+		}
+	}
+	/*	do I need to make it a power of 2?	*/
+	if(
+		(flags & SOIL_FLAG_POWER_OF_TWO) ||	/*	user asked for it	*/
+		(flags & SOIL_FLAG_MIPMAPS) ||		/*	need it for the MIP-maps	*/
+		(width > max_supported_size) ||		/*	it's too big, (make sure it's	*/
+		(height > max_supported_size) )		/*	2^n for later down-sampling)	*/
+	{
+		int new_width = 1;
+		int new_height = 1;
+		while( new_width < width )
+		{
+			new_width *= 2;
+		}
+		while( new_height < height )
+		{
+			new_height *= 2;
+		}
+		/*	still?	*/
+		if( (new_width != width) || (new_height != height) )
+		{
+			/*	yep, resize	*/
+			unsigned char *resampled = (unsigned char*)malloc( channels*new_width*new_height );
+			up_scale_image(
+					img, width, height, channels,
+					resampled, new_width, new_height );
+			/*	OJO	this is for debug only!	*/
+			/*
+			SOIL_save_image( "\\showme.bmp", SOIL_SAVE_TYPE_BMP,
+							new_width, new_height, channels,
+							resampled );
+			*/
+			/*	nuke the old guy, then point it at the new guy	*/
+			SOIL_free_image_data( img );
+			img = resampled;
+			width = new_width;
+			height = new_height;
+		}
+	}
+	/*	now, if it is too large...	*/
+	if( (width > max_supported_size) || (height > max_supported_size) )
+	{
+		/*	I've already made it a power of two, so simply use the MIPmapping
+			code to reduce its size to the allowable maximum.	*/
+		unsigned char *resampled;
+		int reduce_block_x = 1, reduce_block_y = 1;
+		int new_width, new_height;
+		if( width > max_supported_size )
+		{
+			reduce_block_x = width / max_supported_size;
+		}
+		if( height > max_supported_size )
+		{
+			reduce_block_y = height / max_supported_size;
+		}
+		new_width = width / reduce_block_x;
+		new_height = height / reduce_block_y;
+		resampled = (unsigned char*)malloc( channels*new_width*new_height );
+		/*	perform the actual reduction	*/
+		mipmap_image(	img, width, height, channels,
+						resampled, reduce_block_x, reduce_block_y );
+		/*	nuke the old guy, then point it at the new guy	*/
+		SOIL_free_image_data( img );
+		img = resampled;
+		width = new_width;
+		height = new_height;
+	}
+	/*	is the residency manager reloading this without its top MIP levels?	*/
+	if( caps->drop_levels > 0 )
+	{
+		unsigned char *resampled;
+		int reduce_block_x = 1 << caps->drop_levels;
+		int reduce_block_y = reduce_block_x;
+		while( reduce_block_x > width )
+		{
+			reduce_block_x >>= 1;
+		}
+		while( reduce_block_y > height )
+		{
+			reduce_block_y >>= 1;
+		}
+		if( (reduce_block_x > 1) || (reduce_block_y > 1) )
+		{
+			int new_width = width / reduce_block_x;
+			int new_height = height / reduce_block_y;
+			resampled = (unsigned char*)malloc( channels*new_width*new_height );
+			mipmap_image(	img, width, height, channels,
+							resampled, reduce_block_x, reduce_block_y );
+			SOIL_free_image_data( img );
+			img = resampled;
+			width = new_width;
+			height = new_height;
+		}
+	}
+	/*	does the user want us to use YCoCg color space?	*/
+	if( flags & SOIL_FLAG_CoCg_Y )
+	{
+		/*	this will only work with RGB and RGBA images */
+		convert_RGB_to_YCoCg( img, width, height, channels );
+		/*
+		save_image_as_DDS( "CoCg_Y.dds", width, height, channels, img );
+		*/
+	}
+	/*	and what type am I using as the internal texture format?	*/
+	switch( channels )
+	{
+	case 1:
+		texture->original_texture_format = GL_LUMINANCE;
+		break;
+	case 2:
+		texture->original_texture_format = GL_LUMINANCE_ALPHA;
+		break;
+	case 3:
+		texture->original_texture_format = GL_RGB;
+		break;
+	case 4:
+		texture->original_texture_format = GL_RGBA;
+		break;
+	}
+	texture->internal_texture_format = texture->original_texture_format;
+	/*	does the user want me to, and can I, save as DXT?	*/
+	if( DXT_mode == SOIL_CAPABILITY_PRESENT )
+	{
+		/*	I can use DXT, whether I compress it or OpenGL does	*/
+		if( (channels & 1) == 1 )
+		{
+			/*	1 or 3 channels = DXT1	*/
+			texture->internal_texture_format = SOIL_RGB_S3TC_DXT1;
+		} else
+		{
+			/*	2 or 4 channels = DXT5	*/
+			texture->internal_texture_format = SOIL_RGBA_S3TC_DXT5;
+		}
+	}
+	/*	or RGTC?	*/
+	if( RGTC_mode == SOIL_CAPABILITY_PRESENT )
+	{
+		if( channels == 1 )
+		{
+			/*	1 channel = BC4 (it ends up in red)	*/
+			texture->internal_texture_format = SOIL_COMPRESSED_RED_RGTC1;
+		} else
+		{
+			/*	the first 2 channels = BC5 (in red and green)	*/
+			texture->internal_texture_format = SOIL_COMPRESSED_RG_RGTC2;
+		}
+	}
+	texture->flags = flags;
+	texture->opengl_texture_type = opengl_texture_type;
+	texture->opengl_texture_target = opengl_texture_target;
+	/*	the main image, and any MIPmaps that are desired
+		(a copy may have been resized, so its rows are tightly packed)	*/
+	if( !in_place )
+	{
+		row_stride = width*channels;
+	}
+	texture->num_levels = 1;
+	if( flags & SOIL_FLAG_MIPMAPS )
+	{
+		while( ((1<<texture->num_levels) <= width) || ((1<<texture->num_levels) <= height) )
+		{
+			++texture->num_levels;
+		}
+	}
+	texture->levels[0].width = width;
+	texture->levels[0].height = height;
+	for( level = 1; level < texture->num_levels; ++level )
+	{
+		texture->levels[level].width = (texture->levels[level-1].width + 1) / 2;
+		texture->levels[level].height = (texture->levels[level-1].height + 1) / 2;
+	}
+	texture->base = img;
+	texture->base_borrowed = in_place;
+	texture->row_stride = row_stride;
+	texture->channels = channels;
+	texture->compress_to_DXT = (DXT_mode == SOIL_CAPABILITY_PRESENT);
+	texture->compress_to_RGTC = (RGTC_mode == SOIL_CAPABILITY_PRESENT);
+	return 1;
+}
+
+void
+	SOIL_internal_build_level
+	(
+		SOIL_internal_texture *texture,
+		int level
+	)
+{
+	SOIL_internal_level *L = &texture->levels[level];
+	const int channels = texture->channels;
+	unsigned char *level_img = (unsigned char*)texture->base;
+	if( level > 0 )
+	{
+		/*	do this MIPmap level	*/
+		level_img = (unsigned char*)malloc( channels*L->width*L->height );
+		mipmap_image_strided(
+				texture->base, texture->levels[0].width, texture->levels[0].height,
+				channels, texture->row_stride,
+				level_img,
+				(1 << level), (1 << level) );
+	}
+	L->size = channels*L->width*L->height;
+	L->data = level_img;
+	L->compressed = 0;
+	L->borrowed = 0;
+	L->row_length = 0;
+	if( level == 0 )
+	{
+		/*	the base image still belongs to whoever prepared it	*/
+		L->borrowed = 1;
+		if( texture->row_stride != L->width*channels )
+		{
+			L->row_length = texture->row_stride / channels;
+		}
+	}
+	if( texture->compress_to_DXT || texture->compress_to_RGTC )
+	{
+		/*	user wants me to do the DXT conversion!	*/
+		int DDS_size;
+		unsigned char *DDS_data = NULL;
+		/*	the flags pick the speed / quality trade off	*/
+		int DXT_quality = DXT_QUALITY_DEFAULT;
+		if( texture->flags & SOIL_FLAG_DXT_FAST )
+		{
+			DXT_quality = DXT_QUALITY_FAST;
+		} else if( texture->flags & SOIL_FLAG_DXT_HIGH_QUALITY )
+		{
+			DXT_quality = DXT_QUALITY_HIGH;
+		}
+		if( texture->compress_to_RGTC )
+		{
+			/*	BC4 for 1 channel, BC5 for the rest	*/
+			if( channels == 1 )
+			{
+				DDS_data = convert_image_to_BC4( level_img, L->width, L->height, channels, &DDS_size );
+			} else
+			{
+				DDS_data = convert_image_to_BC5( level_img, L->width, L->height, channels, &DDS_size );
+			}
+		} else if( (channels & 1) == 1 )
+		{
+			/*	RGB, use DXT1	*/
+			DDS_data = convert_image_to_DXT1_quality( level_img, L->width, L->height, channels,
+					DXT_quality, &DDS_size );
+		} else
+		{
+			/*	RGBA, use DXT5	*/
+			DDS_data = convert_image_to_DXT5_quality( level_img, L->width, L->height, channels,
+					DXT_quality, &DDS_size );
+		}
+		if( DDS_data )
+		{
+			/*	the base image is still needed for the MIPmaps	*/
+			if( level > 0 )
+			{
+				SOIL_free_image_data( level_img );
+			}
+			L->data = DDS_data;
+			L->size = DDS_size;
+			L->compressed = 1;
+			L->borrowed = 0;
+			L->row_length = 0;
+		}
+		/*	else my compression failed, the OpenGL driver's version will be used	*/
+	}
+}
+
+int
+	SOIL_internal_prepare_texture
+	(
+		const unsigned char *const data,
+		int width, int height, int channels,
+		int row_stride, int borrow_data,
+		unsigned int flags,
+		unsigned int opengl_texture_type,
+		unsigned int opengl_texture_target,
+		const SOIL_internal_caps *caps,
+		SOIL_internal_texture *texture
+	)
+{
+	int level;
+	if( !SOIL_internal_prepare_base(
+			data, width, height, channels,
+			row_stride, borrow_data, flags,
+			opengl_texture_type, opengl_texture_target,
+			caps, texture ) )
+	{
+		return 0;
+	}
+	/*	the main image, and any MIPmaps that are desired	*/
+	for( level = 0; level < texture->num_levels; ++level )
+	{
+		SOIL_internal_build_level( texture, level );
+	}
+	/*	hand my copy of the base image over to the base level,
+		or if that was compressed the raw image is no longer needed	*/
+	if( !texture->base_borrowed )
+	{
+		if( texture->levels[0].data == texture->base )
+		{
+			texture->levels[0].borrowed = 0;
+		} else
+		{
+			SOIL_free_image_data( (unsigned char*)texture->base );
+		}
+	}
+	texture->base = NULL;
+	return 1;
+}
+
+void
+	SOIL_internal_upload_level
+	(
+		const SOIL_internal_texture *texture,
+		unsigned int tex_id,
+		int level
+	)
+{
+	const SOIL_internal_level *L = &texture->levels[level];
+	if( L->compressed )
+	{
+		soilGlCompressedTexImage2D(
+			texture->opengl_texture_target, level,
+			texture->internal_texture_format, L->width, L->height, 0,
+			L->size, L->data );
+		check_for_GL_errors( "glCompressedTexImage2D" );
+	} else if( L->row_length )
+	{
+		/*	straight out of a larger image, tell OpenGL how far apart the rows are	*/
+		GLint previous_row_length = 0, previous_alignment = 4;
+		glGetIntegerv( GL_UNPACK_ROW_LENGTH, &previous_row_length );
+		glGetIntegerv( GL_UNPACK_ALIGNMENT, &previous_alignment );
+		glPixelStorei( GL_UNPACK_ROW_LENGTH, L->row_length );
+		glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+		glTexImage2D(
+			texture->opengl_texture_target, level,
+			texture->internal_texture_format, L->width, L->height, 0,
+			texture->original_texture_format, GL_UNSIGNED_BYTE, L->data );
+		check_for_GL_errors( "glTexImage2D" );
+		glPixelStorei( GL_UNPACK_ROW_LENGTH, previous_row_length );
+		glPixelStorei( GL_UNPACK_ALIGNMENT, previous_alignment );
+	} else
+	{
+		/*	user want OpenGL to do all the work!	*/
+		glTexImage2D(
+			texture->opengl_texture_target, level,
+			texture->internal_texture_format, L->width, L->height, 0,
+			texture->original_texture_format, GL_UNSIGNED_BYTE, L->data );
+		check_for_GL_errors( "glTexImage2D" );
+	}
+	SOIL_internal_residency_note_upload(
+			tex_id, texture->opengl_texture_target, level,
+			texture->internal_texture_format, L->width, L->height );
+}
+
+void
+	SOIL_internal_set_parameters
+	(
+		const SOIL_internal_texture *texture
+	)
+{
+	unsigned int opengl_texture_type = texture->opengl_texture_type;
+	/*	are any MIPmaps desired?	*/
+	if( texture->flags & SOIL_FLAG_MIPMAPS )
+	{
+		/*	instruct OpenGL to use the MIPmaps	*/
+		glTexParameteri( opengl_texture_type, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
+		glTexParameteri( opengl_texture_type, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR );
+		check_for_GL_errors( "GL_TEXTURE_MIN/MAG_FILTER" );
+	} else
+	{
+		/*	instruct OpenGL _NOT_ to use the MIPmaps	*/
+		glTexParameteri( opengl_texture_type, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
+		glTexParameteri( opengl_texture_type, GL_TEXTURE_MIN_FILTER, GL_LINEAR );
+		check_for_GL_errors( "GL_TEXTURE_MIN/MAG_FILTER" );
+	}
+	/*	does the user want clamping, or wrapping?	*/
+	if( texture->flags & SOIL_FLAG_TEXTURE_REPEATS )
+	{
+		glTexParameteri( opengl_texture_type, GL_TEXTURE_WRAP_S, GL_REPEAT );
+		glTexParameteri( opengl_texture_type, GL_TEXTURE_WRAP_T, GL_REPEAT );
+		if( opengl_texture_type == SOIL_TEXTURE_CUBE_MAP )
+		{
+			/*	SOIL_TEXTURE_WRAP_R is invalid if cubemaps aren't supported	*/
+			glTexParameteri( opengl_texture_type, SOIL_TEXTURE_WRAP_R, GL_REPEAT );
+		}
+		check_for_GL_errors( "GL_TEXTURE_WRAP_*" );
+	} else
+	{
+		/*	unsigned int clamp_mode = SOIL_CLAMP_TO_EDGE;	*/
+		unsigned int clamp_mode = GL_CLAMP;
+		glTexParameteri( opengl_texture_type, GL_TEXTURE_WRAP_S, clamp_mode );
+		glTexParameteri( opengl_texture_type, GL_TEXTURE_WRAP_T, clamp_mode );
+		if( opengl_texture_type == SOIL_TEXTURE_CUBE_MAP )
+		{
+			/*	SOIL_TEXTURE_WRAP_R is invalid if cubemaps aren't supported	*/
+			glTexParameteri( opengl_texture_type, SOIL_TEXTURE_WRAP_R, clamp_mode );
+		}
+		check_for_GL_errors( "GL_TEXTURE_WRAP_*" );
+	}
+}
+
+unsigned int
+	SOIL_internal_upload_texture
+	(
+		const SOIL_internal_texture *texture,
+		unsigned int reuse_texture_ID
+	)
+{
+	unsigned int tex_id;
+	unsigned int opengl_texture_type = texture->opengl_texture_type;
+	int level;
+	/*	create the OpenGL texture ID handle
+    	(note: allowing a forced texture ID lets me reload a texture)	*/
+    tex_id = reuse_texture_ID;
+    if( tex_id == 0 )
+    {
+		glGenTextures( 1, &tex_id );
+    }
+	check_for_GL_errors( "glGenTextures" );
+	/* Note: sometimes glGenTextures fails (usually no OpenGL context)	*/
+	if( tex_id )
+	{
+		/*  bind an OpenGL texture ID	*/
+		glBindTexture( opengl_texture_type, tex_id );
+		check_for_GL_errors( "glBindTexture" );
+		/*	a texture that was still streaming in starts over	*/
+		if( SOIL_internal_progressive_cancel( reuse_texture_ID ) )
+		{
+			SOIL_internal_residency_free_source(
+					texture_residency_forget( &SOIL_residency, tex_id ) );
+			glTexParameteri( opengl_texture_type, SOIL_TEXTURE_BASE_LEVEL, 0 );
+		}
+		/*  upload the main image, and the MIPmaps	*/
+		for( level = 0; level < texture->num_levels; ++level )
+		{
+			SOIL_internal_upload_level( texture, tex_id, level );
+		}
+		SOIL_internal_set_parameters( texture );
+		/*	no file to reload it from (yet), and keep within the budget	*/
+		SOIL_internal_residency_set_source( tex_id, NULL, 0, 0, 0 );
+		SOIL_internal_residency_enforce( tex_id );
+		/*	done	*/
+		result_string_pointer = "Image loaded as an OpenGL texture";
+	} else
+	{
+		/*	failed	*/
+		result_string_pointer = "Failed to generate an OpenGL texture name; missing OpenGL context?";
+	}
+	return tex_id;
+}
+
+void
+	SOIL_internal_free_texture
+	(
+		SOIL_internal_texture *texture
+	)
+{
+	int level;
+	for( level = 0; level < texture->num_levels; ++level )
+	{
+		if( !texture->levels[level].borrowed )
+		{
+			SOIL_free_image_data( texture->levels[level].data );
+		}
+		texture->levels[level].data = NULL;
+	}
+	texture->num_levels = 0;
+}
+
+unsigned int
+	SOIL_internal_create_OGL_texture
+	(
+		const unsigned char *const data,
+		int width, int height, int channels,
+		unsigned int reuse_texture_ID,
+		unsigned int flags,
+		unsigned int opengl_texture_type,
+		unsigned int opengl_texture_target,
+		unsigned int texture_check_size_enum
+	)
+{
+	/*	variables	*/
+	SOIL_internal_caps caps;
+	SOIL_internal_texture texture;
+	unsigned int tex_id;
+	/*	ask OpenGL what it can do, then do the CPU work, then upload it	*/
+	SOIL_internal_query_caps( flags, texture_check_size_enum, &caps );
+	if( !SOIL_internal_prepare_texture(
+			data, width, height, channels, 0, 1, flags,
+			opengl_texture_type, opengl_texture_target,
+			&caps, &texture ) )
+	{
+		return 0;
+	}
+	tex_id = SOIL_internal_upload_texture( &texture, reuse_texture_ID );
+	SOIL_internal_free_texture( &texture );
+	return tex_id;
+}
+
+/*	a DXT1/3/5 DDS file that would only be decoded to be compressed to DXT
+	again: keep its blocks, and only make the MIPmap levels it is missing
+	(from its smallest level).  Returns 0 if anything needs the pixels, for
+	the usual decode.  No OpenGL calls in here, the caps say what it can do.	*/
+int
+	SOIL_internal_prepare_DDS_blocks
+	(
+		const unsigned char *const buffer,
+		int buffer_length,
+		int force_channels,
+		unsigned int flags,
+		const SOIL_internal_caps *caps,
+		SOIL_internal_texture *texture
+	)
+{
+	DDS_header header;
+	unsigned int offset = sizeof( DDS_header );
+	unsigned int format;
+	int block_size, file_levels, first, level;
+	int width, height, num_levels;
+	/*	anything that changes the pixels, or another format, needs them decoded	*/
+	if( !(flags & SOIL_FLAG_COMPRESS_TO_DXT) ||
+		(caps->DXT != SOIL_CAPABILITY_PRESENT) ||
+		((flags & SOIL_FLAG_COMPRESS_TO_RGTC) && (caps->RGTC == SOIL_CAPABILITY_PRESENT)) ||
+		(flags & (	SOIL_FLAG_INVERT_Y | SOIL_FLAG_NTSC_SAFE_RGB |
+					SOIL_FLAG_MULTIPLY_ALPHA | SOIL_FLAG_CoCg_Y |
+					SOIL_FLAG_TEXTURE_RECTANGLE )) ||
+		((force_channels != SOIL_LOAD_AUTO) && (force_channels != SOIL_LOAD_RGBA)) ||
+		(buffer_length < (int)sizeof( DDS_header )) )
+	{
+		return 0;
+	}
+	memcpy( (void*)(&header), (const void *)buffer, sizeof( DDS_header ) );
+	if( (header.dwMagic != (('D'<<0)|('D'<<8)|('S'<<16)|(' '<<24))) ||
+		(header.dwSize != 124) ||
+		!(header.sPixelFormat.dwFlags & DDPF_FOURCC) ||
+		!(header.sCaps.dwCaps1 & DDSCAPS_TEXTURE) ||
+		(header.sCaps.dwCaps2 & (DDSCAPS2_CUBEMAP | DDSCAPS2_VOLUME)) ||
+		(header.dwWidth < 1) || (header.dwHeight < 1) )
+	{
+		return 0;
+	}
+	/*	(only the formats stb_image would have decoded)	*/
+	format = SOIL_internal_DDS_format( header.sPixelFormat.dwFourCC, &block_size );
+	if( (format != SOIL_RGBA_S3TC_DXT1) &&
+		(format != SOIL_RGBA_S3TC_DXT3) &&
+		(format != SOIL_RGBA_S3TC_DXT5) )
+	{
+		return 0;
+	}
+	/*	the base level has to be used as it is, no resizing	*/
+	width = (int)header.dwWidth;
+	height = (int)header.dwHeight;
+	if( (width > caps->max_supported_size) || (height > caps->max_supported_size) )
+	{
+		return 0;
+	}
+	if( ((flags & (SOIL_FLAG_POWER_OF_TWO | SOIL_FLAG_MIPMAPS)) ||
+		(caps->NPOT == SOIL_CAPABILITY_NONE)) &&
+		(((width & (width - 1)) != 0) || ((height & (height - 1)) != 0)) )
+	{
+		return 0;
+	}
+	file_levels = 1;
+	if( (header.sCaps.dwCaps1 & DDSCAPS_MIPMAP) && (header.dwMipMapCount > 1) )
+	{
+		file_levels = (header.dwMipMapCount < SOIL_MAX_LEVELS) ?
+				(int)header.dwMipMapCount : SOIL_MAX_LEVELS;
+	}
+	/*	the residency manager's smaller reload starts further down the chain	*/
+	first = (caps->drop_levels > 0) ? caps->drop_levels : 0;
+	if( first >= file_levels )
+	{
+		return 0;
+	}
+	width = (width >> first) ? (width >> first) : 1;
+	height = (height >> first) ? (height >> first) : 1;
+	num_levels = 1;
+	if( flags & SOIL_FLAG_MIPMAPS )
+	{
+		while( ((1<<num_levels) <= width) || ((1<<num_levels) <= height) )
+		{
+			++num_levels;
+		}
+	}
+	/*	there is no DXT3 encoder for any missing levels	*/
+	if( (first + num_levels > file_levels) && (format == SOIL_RGBA_S3TC_DXT3) )
+	{
+		return 0;
+	}
+	memset( texture, 0, sizeof( SOIL_internal_texture ) );
+	texture->flags = flags;
+	texture->opengl_texture_type = GL_TEXTURE_2D;
+	texture->opengl_texture_target = GL_TEXTURE_2D;
+	texture->internal_texture_format = format;
+	texture->original_texture_format = GL_RGBA;
+	texture->channels = 4;
+	texture->compress_to_DXT = 1;
+	texture->base_borrowed = 1;
+	/*	copy the blocks of the levels that are in the file	*/
+	for( level = 0; level < first + num_levels; ++level )
+	{
+		int level_width = ((int)header.dwWidth >> level) ? ((int)header.dwWidth >> level) : 1;
+		int level_height = ((int)header.dwHeight >> level) ? ((int)header.dwHeight >> level) : 1;
+		unsigned int size = ((level_width+3)/4)*((level_height+3)/4)*block_size;
+		SOIL_internal_level *L;
+		if( level >= file_levels )
+		{
+			break;
+		}
+		if( offset + size > (unsigned int)buffer_length )
+		{
+			/*	cut short, let stb_image have a go	*/
+			SOIL_internal_free_texture( texture );
+			return 0;
+		}
+		if( level >= first )
+		{
+			L = &texture->levels[level - first];
+			L->width = level_width;
+			L->height = level_height;
+			L->size = size;
+			L->compressed = 1;
+			L->data = (unsigned char*)malloc( size );
+			if( NULL == L->data )
+			{
+				SOIL_internal_free_texture( texture );
+				result_string_pointer = "malloc failed";
+				return 0;
+			}
+			memcpy( L->data, &buffer[offset], size );
+			texture->num_levels = level - first + 1;
+		}
+		offset += size;
+	}
+	/*	MIPmaps the file doesn't have come from its smallest level	*/
+	if( texture->num_levels < num_levels )
+	{
+		const SOIL_internal_level *last = &texture->levels[texture->num_levels - 1];
+		int last_level = texture->num_levels - 1;
+		int decoded_width, decoded_height, decoded_channels, i;
+		int DXT_quality = DXT_QUALITY_DEFAULT;
+		unsigned char *decoded;
+		/*	that level on its own, as a DDS file stb_image can decode	*/
+		unsigned char *single = (unsigned char*)malloc( sizeof( DDS_header ) + last->size );
+		if( NULL == single )
+		{
+			SOIL_internal_free_texture( texture );
+			result_string_pointer = "malloc failed";
+			return 0;
+		}
+		header.dwWidth = last->width;
+		header.dwHeight = last->height;
+		header.dwMipMapCount = 0;
+		header.sCaps.dwCaps1 &= ~(DDSCAPS_MIPMAP | DDSCAPS_COMPLEX);
+		memcpy( single, &header, sizeof( DDS_header ) );
+		memcpy( single + sizeof( DDS_header ), last->data, last->size );
+		decoded = SOIL_load_image_from_memory(
+				single, (int)(sizeof( DDS_header ) + last->size),
+				&decoded_width, &decoded_height, &decoded_channels, SOIL_LOAD_RGBA );
+		free( single );
+		if( NULL == decoded )
+		{
+			SOIL_internal_free_texture( texture );
+			return 0;
+		}
+		/*	the DXT1 encoder has no 1 bit alpha: a DXT1 file with cut out
+			texels goes the old way (decoded, and DXT5 all the way down)	*/
+		if( format == SOIL_RGBA_S3TC_DXT1 )
+		{
+			for( i = 3; i < 4*decoded_width*decoded_height; i += 4 )
+			{
+				if( decoded[i] < 255 )
+				{
+					SOIL_free_image_data( decoded );
+					SOIL_internal_free_texture( texture );
+					return 0;
+				}
+			}
+		}
+		if( flags & SOIL_FLAG_DXT_FAST )
+		{
+			DXT_quality = DXT_QUALITY_FAST;
+		} else if( flags & SOIL_FLAG_DXT_HIGH_QUALITY )
+		{
+			DXT_quality = DXT_QUALITY_HIGH;
+		}
+		for( level = texture->num_levels; level < num_levels; ++level )
+		{
+			SOIL_internal_level *L = &texture->levels[level];
+			int DDS_size = 0;
+			unsigned char *level_img;
+			L->width = (texture->levels[level-1].width + 1) / 2;
+			L->height = (texture->levels[level-1].height + 1) / 2;
+			level_img = (unsigned char*)malloc( 4*L->width*L->height );
+			if( NULL == level_img )
+			{
+				break;
+			}
+			mipmap_image(
+					decoded, decoded_width, decoded_height, 4,
+					level_img,
+					(1 << (level - last_level)), (1 << (level - last_level)) );
+			if( format == SOIL_RGBA_S3TC_DXT1 )
+			{
+				L->data = convert_image_to_DXT1_quality( level_img, L->width, L->height, 4,
+						DXT_quality, &DDS_size );
+			} else
+			{
+				L->data = convert_image_to_DXT5_quality( level_img, L->width, L->height, 4,
+						DXT_quality, &DDS_size );
+			}
+			SOIL_free_image_data( level_img );
+			if( NULL == L->data )
+			{
+				break;
+			}
+			L->size = DDS_size;
+			L->compressed = 1;
+			texture->num_levels = level + 1;
+		}
+		SOIL_free_image_data( decoded );
+		if( texture->num_levels < num_levels )
+		{
+			SOIL_internal_free_texture( texture );
+			return 0;
+		}
+	}
+	return 1;
+}
+
+unsigned int
+	SOIL_internal_create_OGL_texture_from_DDS
+	(
+		const unsigned char *const buffer,
+		int buffer_length,
+		int force_channels,
+		unsigned int reuse_texture_ID,
+		unsigned int flags
+	)
+{
+	/*	variables	*/
+	SOIL_internal_caps caps;
+	SOIL_internal_texture texture;
+	unsigned int tex_id;
+	/*	only worth a look if it would be compressed to DXT anyway	*/
+	if( !(flags & SOIL_FLAG_COMPRESS_TO_DXT) || (NULL == buffer) ||
+		(buffer_length < 4) || (0 != memcmp( buffer, "DDS ", 4 )) )
+	{
+		return 0;
+	}
+	SOIL_internal_query_caps( flags, GL_MAX_TEXTURE_SIZE, &caps );
+	if( !SOIL_internal_prepare_DDS_blocks(
+			buffer, buffer_length, force_channels, flags, &caps, &texture ) )
+	{
+		return 0;
+	}
+	tex_id = SOIL_internal_upload_texture( &texture, reuse_texture_ID );
+	SOIL_internal_free_texture( &texture );
+	return tex_id;
+}
+
+int
+	SOIL_save_screenshot
+	(
+		const char *filename,
+		int image_type,
+		int x, int y,
+		int width, int height
+	)
+{
+	unsigned char *pixel_data;
+	int i, j;
+	int save_result;
+
+	/*	error checks	*/
+	if( (width < 1) || (height < 1) )
+	{
+		result_string_pointer = "Invalid screenshot dimensions";
+		return 0;
+	}
+	if( (x < 0) || (y < 0) )
+	{
+		result_string_pointer = "Invalid screenshot location";
+		return 0;
+	}
+	if( filename == NULL )
+	{
+		result_string_pointer = "Invalid screenshot filename";
+		return 0;
+	}
+
+    /*  Get the data from OpenGL	*/
+    pixel_data = (unsigned char*)malloc( 3*width*height );
+    glReadPixels (x, y, width, height, GL_RGB, GL_UNSIGNED_BYTE, pixel_data);
+
+    /*	invert the image	*/
+    for( j = 0; j*2 < height; ++j )
+	{
+		int index1 = j * width * 3;
+		int index2 = (height - 1 - j) * width * 3;
+		for( i = width * 3; i > 0; --i )
+		{
+			unsigned char temp = pixel_data[index1];
+			pixel_data[index1] = pixel_data[index2];
+			pixel_data[index2] = temp;
+			++index1;
+			++index2;
+		}
+	}
+
+    /*	save the image	*/
+    save_result = SOIL_save_image( filename, image_type, width, height, 3, pixel_data);
+
+    /*  And free the memory	*/
+    SOIL_free_image_data( pixel_data );
+	return save_result;
+}
+
+unsigned char*
+	SOIL_load_image
+	(
+		const char *filename,
+		int *width, int *height, int *channels,
+		int force_channels
+	)
+{
+	unsigned char *result = stbi_load( filename,
+			width, height, channels, force_channels );
+	if( result == NULL )
+	{
+		result_string_pointer = stbi_failure_reason();
+	} else
+	{
+		result_string_pointer = "Image loaded";
+	}
+	return result;
+}
+
+unsigned char*
+	SOIL_load_image_from_memory
+	(
+		const unsigned char *const buffer,
+		int buffer_length,
+		int *width, int *height, int *channels,
+		int force_channels
+	)
+{
+	unsigned char *result = stbi_load_from_memory(
+				buffer, buffer_length,
+				width, height, channels,
+				force_channels );
+	if( result == NULL )
+	{
+		result_string_pointer = stbi_failure_reason();
+	} else
+	{
+		result_string_pointer = "Image loaded from memory";
+	}
+	return result;
+}
+
+int
+	SOIL_save_image
+	(
+		const char *filename,
+		int image_type,
+		int width, int height, int channels,
+		const unsigned char *const data
+	)
+{
+	return SOIL_save_image_quality( filename, image_type,
+			width, height, channels, data, SOIL_DXT_QUALITY_DEFAULT );
+}
+
+/*	the compressed format (DDS_STREAM_*) of a DDS or KTX2 save type	*/
+int SOIL_internal_save_format( int image_type )
+{
+	switch( image_type )
+	{
+	case SOIL_SAVE_TYPE_DDS_RGTC:
+	case SOIL_SAVE_TYPE_KTX2_RGTC:
+		return DDS_STREAM_RGTC;
+	case SOIL_SAVE_TYPE_DDS_BC7:
+	case SOIL_SAVE_TYPE_KTX2_BC7:
+		return DDS_STREAM_BC7;
+	default:
+		return DDS_STREAM_DXT;
+	}
+}
+
+int
+	SOIL_save_image_quality
+	(
+		const char *filename,
+		int image_type,
+		int width, int height, int channels,
+		const unsigned char *const data,
+		int quality
+	)
+{
+	int save_result;
+
+	/*	error check	*/
+	if( (width < 1) || (height < 1) ||
+		(channels < 1) || (channels > 4) ||
+		(data == NULL) ||
+		(filename == NULL) )
+	{
+		return 0;
+	}
+	if( image_type == SOIL_SAVE_TYPE_BMP )
+	{
+		save_result = stbi_write_bmp( filename,
+				width, height, channels, (void*)data );
+	} else
+	if( image_type == SOIL_SAVE_TYPE_TGA )
+	{
+		save_result = stbi_write_tga( filename,
+				width, height, channels, (void*)data );
+	} else
+	if( image_type == SOIL_SAVE_TYPE_DDS )
+	{
+		save_result = save_image_as_DDS_quality( filename,
+				width, height, channels, (const unsigned char *const)data, quality );
+	} else
+	if( image_type == SOIL_SAVE_TYPE_DDS_RGTC )
+	{
+		save_result = save_image_as_DDS_RGTC( filename,
+				width, height, channels, (const unsigned char *const)data );
+	} else
+	if( image_type == SOIL_SAVE_TYPE_DDS_BC7 )
+	{
+		save_result = save_image_as_DDS_BC7( filename,
+				width, height, channels, (const unsigned char *const)data,
+				(quality >= SOIL_DXT_QUALITY_HIGH) ? BC7_PRESET_SLOW : BC7_PRESET_FAST );
+	} else
+	if( (image_type >= SOIL_SAVE_TYPE_KTX2) && (image_type <= SOIL_SAVE_TYPE_KTX2_BC7) )
+	{
+		save_result = save_image_as_KTX2( filename,
+				width, height, channels, (const unsigned char *const)data,
+				SOIL_internal_save_format( image_type ), quality, 0 );
+	} else
+	{
+		save_result = 0;
+	}
+	if( save_result == 0 )
+	{
+		result_string_pointer = "Saving the image failed";
+	} else
+	{
+		result_string_pointer = "Image saved";
+	}
+	return save_result;
+}
+
+int
+	SOIL_save_image_mipmapped
+	(
+		const char *filename,
+		int image_type,
+		int width, int height, int channels,
+		const unsigned char *const data,
+		int quality
+	)
+{
+	int save_result;
+	if( (image_type >= SOIL_SAVE_TYPE_DDS) && (image_type <= SOIL_SAVE_TYPE_DDS_BC7) )
+	{
+		save_result = save_image_as_DDS_mipmapped( filename,
+				width, height, channels, data,
+				SOIL_internal_save_format( image_type ), quality );
+	} else
+	if( (image_type >= SOIL_SAVE_TYPE_KTX2) && (image_type <= SOIL_SAVE_TYPE_KTX2_BC7) )
+	{
+		save_result = save_image_as_KTX2( filename,
+				width, height, channels, data,
+				SOIL_internal_save_format( image_type ), quality, 1 );
+	} else
+	{
+		/*	only DDS and KTX2 files have MIPmaps	*/
+		save_result = 0;
+	}
+	if( save_result == 0 )
+	{
+		result_string_pointer = "Saving the image failed";
+	} else
+	{
+		result_string_pointer = "Image saved";
+	}
+	return save_result;
+}
+
+void
+	SOIL_free_image_data
+	(
+		unsigned char *img_data
+	)
+{
+	free( (void*)img_data );
+}
+
+const char*
+	SOIL_last_result
+	(
+		void
+	)
+{
+	return result_string_pointer;
+}
+
+/*	the OpenGL format of a compressed DDS file, 0 if it is one I don't know	*/
+unsigned int SOIL_internal_DDS_format( unsigned int fourCC, int *block_size )
+{
+	if( fourCC == (('D'<<0)|('X'<<8)|('T'<<16)|('1'<<24)) )
+	{
+		*block_size = 8;
+		return SOIL_RGBA_S3TC_DXT1;
+	}
+	if( fourCC == (('D'<<0)|('X'<<8)|('T'<<16)|('3'<<24)) )
+	{
+		*block_size = 16;
+		return SOIL_RGBA_S3TC_DXT3;
+	}
+	if( fourCC == (('D'<<0)|('X'<<8)|('T'<<16)|('5'<<24)) )
+	{
+		*block_size = 16;
+		return SOIL_RGBA_S3TC_DXT5;
+	}
+	/*	BC4 and BC5 go by two names each	*/
+	if( (fourCC == (('A'<<0)|('T'<<8)|('I'<<16)|('1'<<24))) ||
+		(fourCC == (('B'<<0)|('C'<<8)|('4'<<16)|('U'<<24))) )
+	{
+		*block_size = 8;
+		return SOIL_COMPRESSED_RED_RGTC1;
+	}
+	if( (fourCC == (('A'<<0)|('T'<<8)|('I'<<16)|('2'<<24))) ||
+		(fourCC == (('B'<<0)|('C'<<8)|('5'<<16)|('U'<<24))) )
+	{
+		*block_size = 16;
+		return SOIL_COMPRESSED_RG_RGTC2;
+	}
+	return 0;
+}
+
+/*	the OpenGL format of a DDS file, reading the DX10 header after the DDS
+	header if the four CC says there is one (and moving *offset past it),
+	0 if it is a format I don't know	*/
+unsigned int SOIL_internal_DDS_DX10_format(
+		const unsigned char *const buffer,
+		int buffer_length,
+		const DDS_header *header,
+		unsigned int *offset,
+		int *block_size )
+{
+	DDS_header_DX10 header_DX10;
+	if( header->sPixelFormat.dwFourCC != (('D'<<0)|('X'<<8)|('1'<<16)|('0'<<24)) )
+	{
+		return SOIL_internal_DDS_format( header->sPixelFormat.dwFourCC, block_size );
+	}
+	if( buffer_length < (int)(*offset + sizeof( DDS_header_DX10 )) )
+	{
+		return 0;
+	}
+	memcpy( (void*)(&header_DX10), (const void *)(&buffer[*offset]), sizeof( DDS_header_DX10 ) );
+	/*	only plain 2D textures (or cubemaps, flagged in the DDS header)
+		and volume textures, no arrays	*/
+	if( ((header_DX10.resourceDimension != DDS_DIMENSION_TEXTURE2D) &&
+		(header_DX10.resourceDimension != DDS_DIMENSION_TEXTURE3D)) ||
+		(header_DX10.arraySize > 1) )
+	{
+		return 0;
+	}
+	*offset += sizeof( DDS_header_DX10 );
+	switch( header_DX10.dxgiFormat )
+	{
+	case DDS_DXGI_FORMAT_BC1_UNORM:
+		*block_size = 8;
+		return SOIL_RGBA_S3TC_DXT1;
+	case DDS_DXGI_FORMAT_BC2_UNORM:
+		*block_size = 16;
+		return SOIL_RGBA_S3TC_DXT3;
+	case DDS_DXGI_FORMAT_BC3_UNORM:
+		*block_size = 16;
+		return SOIL_RGBA_S3TC_DXT5;
+	case DDS_DXGI_FORMAT_BC4_UNORM:
+		*block_size = 8;
+		return SOIL_COMPRESSED_RED_RGTC1;
+	case DDS_DXGI_FORMAT_BC5_UNORM:
+		*block_size = 16;
+		return SOIL_COMPRESSED_RG_RGTC2;
+	case DDS_DXGI_FORMAT_BC7_UNORM:
+		*block_size = 16;
+		return SOIL_COMPRESSED_RGBA_BPTC_UNORM;
+	case DDS_DXGI_FORMAT_BC7_UNORM_SRGB:
+		*block_size = 16;
+		return SOIL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM;
+	default:
+		return 0;
+	}
+}
+
+/*	can the OpenGL driver take this compressed format directly?	*/
+int SOIL_internal_DDS_format_supported( unsigned int format )
+{
+	switch( format )
+	{
+	case SOIL_RGB_S3TC_DXT1:
+	case SOIL_RGBA_S3TC_DXT1:
+	case SOIL_RGBA_S3TC_DXT3:
+	case SOIL_RGBA_S3TC_DXT5:
+		return (query_DXT_capability() == SOIL_CAPABILITY_PRESENT);
+	case SOIL_COMPRESSED_RED_RGTC1:
+	case SOIL_COMPRESSED_RG_RGTC2:
+		return (query_RGTC_capability() == SOIL_CAPABILITY_PRESENT);
+	case SOIL_COMPRESSED_RGBA_BPTC_UNORM:
+	case SOIL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM:
+		return (query_BPTC_capability() == SOIL_CAPABILITY_PRESENT);
+	default:
+		return 0;
+	}
+}
+
+unsigned int SOIL_direct_load_DDS_from_memory(
+		const unsigned char *const buffer,
+		int buffer_length,
+		unsigned int reuse_texture_ID,
+		int flags,
+		int loading_as )
+{
+	/*	variables	*/
+	DDS_header header;
+	unsigned int buffer_index = 0;
+	unsigned int tex_ID = 0;
+	/*	file reading variables	*/
+	unsigned int S3TC_type = 0;
+	unsigned char *DDS_data = NULL;
+	const unsigned char *DDS_source;
+	unsigned int DDS_main_size;
+	unsigned int DDS_full_size;
+	unsigned int width, height, depth;
+	int mipmaps, cubemap, volume, uncompressed, block_size = 16;
+	unsigned int flag;
+	unsigned int cf_target, ogl_target_start, ogl_target_end;
+	unsigned int opengl_texture_type;
+	int i;
+	/*	1st off, does the filename even exist?	*/
+	if( NULL == buffer )
+	{
+		/*	we can't do it!	*/
+		result_string_pointer = "NULL buffer";
+		return 0;
+	}
+	/*	KTX2 files go straight to OpenGL too	*/
+	if( (buffer_length >= 12) && (0 == memcmp( buffer, "\xABKTX 20\xBB", 8 )) )
+	{
+		return SOIL_direct_load_KTX2_from_memory(
+				buffer, buffer_length, reuse_texture_ID, flags, loading_as );
+	}
+	if( buffer_length < sizeof( DDS_header ) )
+	{
+		/*	we can't do it!	*/
+		result_string_pointer = "DDS file was too small to contain the DDS header";
+		return 0;
+	}
+	/*	try reading in the header	*/
+	memcpy ( (void*)(&header), (const void *)buffer, sizeof( DDS_header ) );
+	buffer_index = sizeof( DDS_header );
+	/*	guilty until proven innocent	*/
+	result_string_pointer = "Failed to read a known DDS header";
+	/*	validate the header (warning, "goto"'s ahead, shield your eyes!!)	*/
+	flag = ('D'<<0)|('D'<<8)|('S'<<16)|(' '<<24);
+	if( header.dwMagic != flag ) {goto quick_exit;}
+	if( header.dwSize != 124 ) {goto quick_exit;}
+	/*	I need all of these	*/
+	flag = DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT;
+	if( (header.dwFlags & flag) != flag ) {goto quick_exit;}
+	/*	According to the MSDN spec, the dwFlags should contain
+		DDSD_LINEARSIZE if it's compressed, or DDSD_PITCH if
+		uncompressed.  Some DDS writers do not conform to the
+		spec, so I need to make my reader more tolerant	*/
+	/*	I need one of these	*/
+	flag = DDPF_FOURCC | DDPF_RGB;
+	if( (header.sPixelFormat.dwFlags & flag) == 0 ) {goto quick_exit;}
+	if( header.sPixelFormat.dwSize != 32 ) {goto quick_exit;}
+	if( (header.sCaps.dwCaps1 & DDSCAPS_TEXTURE) == 0 ) {goto quick_exit;}
+	/*	make sure it is a type we can upload	*/
+	if( header.sPixelFormat.dwFlags & DDPF_FOURCC )
+	{
+		/*	(this skips the DX10 header, if there is one)	*/
+		S3TC_type = SOIL_internal_DDS_DX10_format(
+				buffer, buffer_length, &header, &buffer_index, &block_size );
+		if( 0 == S3TC_type ) {goto quick_exit;}
+	}
+	/*	OK, validated the header, let's load the image data	*/
+	result_string_pointer = "DDS header loaded and validated";
+	width = header.dwWidth;
+	height = header.dwHeight;
+	uncompressed = 1 - (header.sPixelFormat.dwFlags & DDPF_FOURCC) / DDPF_FOURCC;
+	cubemap = (header.sCaps.dwCaps2 & DDSCAPS2_CUBEMAP) / DDSCAPS2_CUBEMAP;
+	volume = !cubemap && (header.sCaps.dwCaps2 & DDSCAPS2_VOLUME) && (header.dwDepth > 0);
+	depth = volume ? header.dwDepth : 1;
+	if( uncompressed )
+	{
+		S3TC_type = GL_RGB;
+		block_size = 3;
+		if( header.sPixelFormat.dwFlags & DDPF_ALPHAPIXELS )
+		{
+			S3TC_type = GL_RGBA;
+			block_size = 4;
+		}
+		DDS_main_size = width * height * block_size;
+	} else
+	{
+		/*	well, we know it is DXT1/3/5, BC4/5 or BC7, because we checked above	*/
+		/*	can we even handle direct uploading to OpenGL of these compressed images?	*/
+		if( !SOIL_internal_DDS_format_supported( S3TC_type ) )
+		{
+			/*	we can't do it!	*/
+			if( (S3TC_type == SOIL_COMPRESSED_RED_RGTC1) ||
+				(S3TC_type == SOIL_COMPRESSED_RG_RGTC2) )
+			{
+				result_string_pointer = "Direct upload of RGTC images not supported by the OpenGL driver";
+			} else
+			if( (S3TC_type == SOIL_COMPRESSED_RGBA_BPTC_UNORM) ||
+				(S3TC_type == SOIL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM) )
+			{
+				result_string_pointer = "Direct upload of BPTC images not supported by the OpenGL driver";
+			} else
+			{
+				result_string_pointer = "Direct upload of S3TC images not supported by the OpenGL driver";
+			}
+			return 0;
+		}
+		DDS_main_size = ((width+3)>>2)*((height+3)>>2)*block_size;
+	}
+	/*	a volume holds depth slices in every level, the smaller ones fewer	*/
+	DDS_main_size *= depth;
+	if( cubemap )
+	{
+		/* does the user want a cubemap?	*/
+		if( loading_as != SOIL_DIRECT_CUBEMAP )
+		{
+			/*	we can't do it!	*/
+			result_string_pointer = "DDS image was a cubemap";
+			return 0;
+		}
+		/*	can we even handle cubemaps with the OpenGL driver?	*/
+		if( query_cubemap_capability() != SOIL_CAPABILITY_PRESENT )
+		{
+			/*	we can't do it!	*/
+			result_string_pointer = "Direct upload of cubemap images not supported by the OpenGL driver";
+			return 0;
+		}
+		ogl_target_start = SOIL_TEXTURE_CUBE_MAP_POSITIVE_X;
+		ogl_target_end =   SOIL_TEXTURE_CUBE_MAP_NEGATIVE_Z;
+		opengl_texture_type = SOIL_TEXTURE_CUBE_MAP;
+	} else
+	if( volume )
+	{
+		/* does the user want a volume texture?	*/
+		if( loading_as != SOIL_DIRECT_VOLUME )
+		{
+			/*	we can't do it!	*/
+			result_string_pointer = "DDS image was a volume texture";
+			return 0;
+		}
+		/*	can we even handle 3D textures (of this format) with the OpenGL driver?	*/
+		if( (query_3D_capability() != SOIL_CAPABILITY_PRESENT) ||
+			(!uncompressed && (NULL == soilGlCompressedTexImage3D)) )
+		{
+			/*	we can't do it!	*/
+			result_string_pointer = "Direct upload of volume textures not supported by the OpenGL driver";
+			return 0;
+		}
+		ogl_target_start = SOIL_TEXTURE_3D;
+		ogl_target_end =   SOIL_TEXTURE_3D;
+		opengl_texture_type = SOIL_TEXTURE_3D;
+	} else
+	{
+		/* does the user want a plain 2D texture?	*/
+		if( loading_as != SOIL_DIRECT_2D )
+		{
+			/*	we can't do it!	*/
+			if( loading_as == SOIL_DIRECT_CUBEMAP )
+			{
+				result_string_pointer = "DDS image was not a cubemap";
+			} else
+			if( loading_as == SOIL_DIRECT_VOLUME )
+			{
+				result_string_pointer = "DDS image was not a volume texture";
+			} else
+			{
+				result_string_pointer = "DDS image was not a texture array";
+			}
+			return 0;
+		}
+		ogl_target_start = GL_TEXTURE_2D;
+		ogl_target_end =   GL_TEXTURE_2D;
+		opengl_texture_type = GL_TEXTURE_2D;
+	}
+	if( (header.sCaps.dwCaps1 & DDSCAPS_MIPMAP) && (header.dwMipMapCount > 1) )
+	{
+		mipmaps = header.dwMipMapCount - 1;
+		DDS_full_size = DDS_main_size;
+		for( i = 1; i <= mipmaps; ++ i )
+		{
+			int w, h, d;
+			w = width >> i;
+			h = height >> i;
+			d = depth >> i;
+			if( w < 1 )
+			{
+				w = 1;
+			}
+			if( h < 1 )
+			{
+				h = 1;
+			}
+			if( d < 1 )
+			{
+				d = 1;
+			}
+			if( !uncompressed )
+			{
+				/*	compressed DDS, MIPmap size calculation is block based
+					(rounding up, a 6 wide level is 2 blocks wide)	*/
+				w = (w + 3) >> 2;
+				h = (h + 3) >> 2;
+			}
+			DDS_full_size += w*h*d*block_size;
+		}
+	} else
+	{
+		mipmaps = 0;
+		DDS_full_size = DDS_main_size;
+	}
+	/*	compressed data goes to OpenGL straight from the buffer (which
+		may be a mapped package), only BGR(A) needs swapping in RAM	*/
+	if( uncompressed )
+	{
+		DDS_data = (unsigned char*)malloc( DDS_full_size );
+		if( NULL == DDS_data )
+		{
+			result_string_pointer = "malloc failed";
+			goto quick_exit;
+		}
+	}
+	/*	create or use an existing OpenGL texture handle	*/
+	tex_ID = reuse_texture_ID;
+	if( tex_ID == 0 )
+	{
+		glGenTextures( 1, &tex_ID );
+	}
+	/*  bind an OpenGL texture ID	*/
+	glBindTexture( opengl_texture_type, tex_ID );
+	/*	do this for each face of the cubemap!	*/
+	for( cf_target = ogl_target_start; cf_target <= ogl_target_end; ++cf_target )
+	{
+		if( buffer_index + DDS_full_size <= buffer_length )
+		{
+			unsigned int byte_offset = DDS_main_size;
+			DDS_source = &buffer[buffer_index];
+			buffer_index += DDS_full_size;
+			/*	upload the main chunk	*/
+			if( uncompressed )
+			{
+				/*	and remember, DXT uncompressed uses BGR(A),
+					so swap to RGB(A) for ALL MIPmap levels	*/
+				memcpy( (void*)DDS_data, (const void*)DDS_source, DDS_full_size );
+				for( i = 0; i < DDS_full_size; i += block_size )
+				{
+					unsigned char temp = DDS_data[i];
+					DDS_data[i] = DDS_data[i+2];
+					DDS_data[i+2] = temp;
+				}
+				DDS_source = DDS_data;
+			}
+			SOIL_internal_direct_upload(
+					tex_ID, cf_target, 0, S3TC_type, !uncompressed,
+					width, height, volume ? depth : 0,
+					DDS_main_size, DDS_source );
+			/*	upload the mipmaps, if we have them	*/
+			for( i = 1; i <= mipmaps; ++i )
+			{
+				int w, h, d, mip_size;
+				w = width >> i;
+				h = height >> i;
+				d = depth >> i;
+				if( w < 1 )
+				{
+					w = 1;
+				}
+				if( h < 1 )
+				{
+					h = 1;
+				}
+				if( d < 1 )
+				{
+					d = 1;
+				}
+				/*	upload this mipmap	*/
+				if( uncompressed )
+				{
+					mip_size = w*h*d*block_size;
+				} else
+				{
+					mip_size = ((w+3)/4)*((h+3)/4)*d*block_size;
+				}
+				SOIL_internal_direct_upload(
+						tex_ID, cf_target, i, S3TC_type, !uncompressed,
+						w, h, volume ? d : 0,
+						mip_size, &DDS_source[byte_offset] );
+				/*	and move to the next mipmap	*/
+				byte_offset += mip_size;
+			}
+			/*	it worked!	*/
+			result_string_pointer = "DDS file loaded";
+		} else
+		{
+			glDeleteTextures( 1, & tex_ID );
+			SOIL_internal_residency_free_source(
+					texture_residency_forget( &SOIL_residency, tex_ID ) );
+			tex_ID = 0;
+			cf_target = ogl_target_end + 1;
+			result_string_pointer = "DDS file was too small for expected image data";
+		}
+	}/* end reading each face */
+	SOIL_free_image_data( DDS_data );
+	if( tex_ID )
+	{
+		SOIL_internal_finish_direct_load( opengl_texture_type, tex_ID, mipmaps, flags );
+	}
+
+quick_exit:
+	/*	report success or failure	*/
+	return tex_ID;
+}
+
+/*	sets up a texture that was loaded directly from a DDS or KTX2 file	*/
+void SOIL_internal_finish_direct_load(
+		unsigned int opengl_texture_type,
+		unsigned int tex_ID,
+		int mipmaps,
+		int flags )
+{
+	/*	did I have MIPmaps?	*/
+	if( mipmaps > 0 )
+	{
+		/*	instruct OpenGL to use the MIPmaps	*/
+		glTexParameteri( opengl_texture_type, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
+		glTexParameteri( opengl_texture_type, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR );
+	} else
+	{
+		/*	instruct OpenGL _NOT_ to use the MIPmaps	*/
+		glTexParameteri( opengl_texture_type, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
+		glTexParameteri( opengl_texture_type, GL_TEXTURE_MIN_FILTER, GL_LINEAR );
+	}
+	/*	does the user want clamping, or wrapping?	*/
+	if( flags & SOIL_FLAG_TEXTURE_REPEATS )
+	{
+		glTexParameteri( opengl_texture_type, GL_TEXTURE_WRAP_S, GL_REPEAT );
+		glTexParameteri( opengl_texture_type, GL_TEXTURE_WRAP_T, GL_REPEAT );
+		glTexParameteri( opengl_texture_type, SOIL_TEXTURE_WRAP_R, GL_REPEAT );
+	} else
+	{
+		/*	unsigned int clamp_mode = SOIL_CLAMP_TO_EDGE;	*/
+		unsigned int clamp_mode = GL_CLAMP;
+		glTexParameteri( opengl_texture_type, GL_TEXTURE_WRAP_S, clamp_mode );
+		glTexParameteri( opengl_texture_type, GL_TEXTURE_WRAP_T, clamp_mode );
+		glTexParameteri( opengl_texture_type, SOIL_TEXTURE_WRAP_R, clamp_mode );
+	}
+	/*	no file to reload it from (yet), and keep within the budget	*/
+	SOIL_internal_residency_set_source( tex_ID, NULL, 0, 0, 0 );
+	SOIL_internal_residency_enforce( tex_ID );
+}
+
+/*	uploads one level of a texture loaded directly from a DDS or KTX2 file:
+	a 2D image or cubemap face if depth is 0, else all the layers of a
+	texture array level or all the slices of a volume texture level	*/
+void SOIL_internal_direct_upload(
+		unsigned int tex_ID,
+		unsigned int opengl_texture_target,
+		int level,
+		unsigned int format,
+		int compressed,
+		int width, int height, int depth,
+		int size,
+		const unsigned char *data )
+{
+	if( depth > 0 )
+	{
+		if( compressed )
+		{
+			soilGlCompressedTexImage3D(
+				opengl_texture_target, level,
+				format, width, height, depth, 0,
+				size, data );
+			check_for_GL_errors( "glCompressedTexImage3D" );
+		} else
+		{
+			soilGlTexImage3D(
+				opengl_texture_target, level,
+				format, width, height, depth, 0,
+				format, GL_UNSIGNED_BYTE, data );
+			check_for_GL_errors( "glTexImage3D" );
+		}
+		SOIL_internal_residency_note_upload_layers(
+				tex_ID, level, format, width, height, depth );
+		return;
+	}
+	if( compressed )
+	{
+		soilGlCompressedTexImage2D(
+			opengl_texture_target, level,
+			format, width, height, 0,
+			size, data );
+	} else
+	{
+		glTexImage2D(
+			opengl_texture_target, level,
+			format, width, height, 0,
+			format, GL_UNSIGNED_BYTE, data );
+	}
+	SOIL_internal_residency_note_upload(
+			tex_ID, opengl_texture_target, level, format, width, height );
+}
+
+/*	the OpenGL format of a KTX2 vkFormat, 0 if it is one I don't know;
+	block_size is per 4x4 block if compressed, else per texel	*/
+unsigned int SOIL_internal_KTX2_format( unsigned int vkFormat, int *block_size, int *compressed )
+{
+	*compressed = 1;
+	switch( vkFormat )
+	{
+	case KTX2_VK_FORMAT_BC1_RGB_UNORM:
+		*block_size = 8;
+		return SOIL_RGB_S3TC_DXT1;
+	case KTX2_VK_FORMAT_BC1_RGBA_UNORM:
+		*block_size = 8;
+		return SOIL_RGBA_S3TC_DXT1;
+	case KTX2_VK_FORMAT_BC2_UNORM:
+		*block_size = 16;
+		return SOIL_RGBA_S3TC_DXT3;
+	case KTX2_VK_FORMAT_BC3_UNORM:
+		*block_size = 16;
+		return SOIL_RGBA_S3TC_DXT5;
+	case KTX2_VK_FORMAT_BC4_UNORM:
+		*block_size = 8;
+		return SOIL_COMPRESSED_RED_RGTC1;
+	case KTX2_VK_FORMAT_BC5_UNORM:
+		*block_size = 16;
+		return SOIL_COMPRESSED_RG_RGTC2;
+	case KTX2_VK_FORMAT_BC7_UNORM:
+		*block_size = 16;
+		return SOIL_COMPRESSED_RGBA_BPTC_UNORM;
+	case KTX2_VK_FORMAT_BC7_SRGB:
+		*block_size = 16;
+		return SOIL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM;
+	case KTX2_VK_FORMAT_R8G8B8_UNORM:
+		*block_size = 3;
+		*compressed = 0;
+		return GL_RGB;
+	case KTX2_VK_FORMAT_R8G8B8A8_UNORM:
+		*block_size = 4;
+		*compressed = 0;
+		return GL_RGBA;
+	default:
+		return 0;
+	}
+}
+
+unsigned int SOIL_direct_load_KTX2_from_memory(
+		const unsigned char *const buffer,
+		int buffer_length,
+		unsigned int reuse_texture_ID,
+		int flags,
+		int loading_as )
+{
+	KTX2_header header;
+	unsigned int tex_ID, internal_format, opengl_texture_type, target_start;
+	int block_size, compressed, level, face, layers, kind;
+	GLint previous_alignment = 4;
+	if( !read_KTX2_header( buffer, buffer_length, &header ) )
+	{
+		result_string_pointer = "Failed to read a known KTX2 header";
+		return 0;
+	}
+	/*	everything goes to OpenGL as it is, nothing is decoded here	*/
+	if( header.supercompressionScheme != 0 )
+	{
+		result_string_pointer = "Supercompressed KTX2 files are not supported";
+		return 0;
+	}
+	/*	no 1D textures, arrays of cubemaps or of 3D textures	*/
+	if( (header.pixelHeight == 0) ||
+		((header.layerCount != 0) && (header.faceCount == 6)) ||
+		((header.pixelDepth != 0) && ((header.layerCount != 0) || (header.faceCount == 6))) )
+	{
+		result_string_pointer = "KTX2 file was not a 2D texture, cubemap, texture array or volume texture";
+		return 0;
+	}
+	internal_format = SOIL_internal_KTX2_format( header.vkFormat, &block_size, &compressed );
+	if( 0 == internal_format )
+	{
+		result_string_pointer = "KTX2 file was in a format I don't know";
+		return 0;
+	}
+	if( compressed && !SOIL_internal_DDS_format_supported( internal_format ) )
+	{
+		result_string_pointer = "Direct upload of KTX2 compressed images not supported by the OpenGL driver";
+		return 0;
+	}
+	/*	what is in the file, and is that what the user wants?	*/
+	kind = SOIL_DIRECT_2D;
+	target_start = GL_TEXTURE_2D;
+	opengl_texture_type = GL_TEXTURE_2D;
+	if( header.faceCount == 6 )
+	{
+		kind = SOIL_DIRECT_CUBEMAP;
+		target_start = SOIL_TEXTURE_CUBE_MAP_POSITIVE_X;
+		opengl_texture_type = SOIL_TEXTURE_CUBE_MAP;
+	} else
+	if( header.layerCount != 0 )
+	{
+		kind = SOIL_DIRECT_ARRAY;
+		target_start = SOIL_TEXTURE_2D_ARRAY;
+		opengl_texture_type = SOIL_TEXTURE_2D_ARRAY;
+	} else
+	if( header.pixelDepth != 0 )
+	{
+		kind = SOIL_DIRECT_VOLUME;
+		target_start = SOIL_TEXTURE_3D;
+		opengl_texture_type = SOIL_TEXTURE_3D;
+	}
+	if( kind != loading_as )
+	{
+		/*	we can't do it!	*/
+		if( kind == SOIL_DIRECT_CUBEMAP )
+		{
+			result_string_pointer = "KTX2 image was a cubemap";
+		} else
+		if( kind == SOIL_DIRECT_ARRAY )
+		{
+			result_string_pointer = "KTX2 image was a texture array";
+		} else
+		if( kind == SOIL_DIRECT_VOLUME )
+		{
+			result_string_pointer = "KTX2 image was a volume texture";
+		} else
+		if( loading_as == SOIL_DIRECT_CUBEMAP )
+		{
+			result_string_pointer = "KTX2 image was not a cubemap";
+		} else
+		if( loading_as == SOIL_DIRECT_ARRAY )
+		{
+			result_string_pointer = "KTX2 image was not a texture array";
+		} else
+		{
+			result_string_pointer = "KTX2 image was not a volume texture";
+		}
+		return 0;
+	}
+	if( (kind == SOIL_DIRECT_CUBEMAP) &&
+		(query_cubemap_capability() != SOIL_CAPABILITY_PRESENT) )
+	{
+		result_string_pointer = "Direct upload of cubemap images not supported by the OpenGL driver";
+		return 0;
+	}
+	if( ((kind == SOIL_DIRECT_ARRAY) && (query_texture_array_capability() != SOIL_CAPABILITY_PRESENT)) ||
+		((kind == SOIL_DIRECT_VOLUME) && (query_3D_capability() != SOIL_CAPABILITY_PRESENT)) ||
+		((kind >= SOIL_DIRECT_ARRAY) && compressed && (NULL == soilGlCompressedTexImage3D)) )
+	{
+		result_string_pointer = "Direct upload of KTX2 texture arrays or volume textures not supported by the OpenGL driver";
+		return 0;
+	}
+	layers = (header.layerCount > 0) ? header.layerCount : 1;
+	/*	make sure every level holds all of its images before touching OpenGL	*/
+	for( level = 0; level < (int)header.levelCount; ++level )
+	{
+		int w = header.pixelWidth >> level;
+		int h = header.pixelHeight >> level;
+		int d = header.pixelDepth >> level;
+		double image_size;
+		if( w < 1 )
+		{
+			w = 1;
+		}
+		if( h < 1 )
+		{
+			h = 1;
+		}
+		if( d < 1 )
+		{
+			d = 1;
+		}
+		/*	all in floating point, so a huge size or layer count can't
+			overflow (once it passes, it fits in the buffer, and in an int)	*/
+		image_size = compressed ?
+				(double)(((unsigned int)w+3)>>2) * (((unsigned int)h+3)>>2) * block_size :
+				(double)w * h * block_size;
+		if( (double)header.levelLength[level] <
+			image_size * header.faceCount * layers * d )
+		{
+			result_string_pointer = "KTX2 file was too small for expected image data";
+			return 0;
+		}
+	}
+	tex_ID = reuse_texture_ID;
+	if( tex_ID == 0 )
+	{
+		glGenTextures( 1, &tex_ID );
+	}
+	glBindTexture( opengl_texture_type, tex_ID );
+	if( !compressed )
+	{
+		/*	KTX2 rows are not padded	*/
+		glGetIntegerv( GL_UNPACK_ALIGNMENT, &previous_alignment );
+		glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+	}
+	for( level = 0; level < (int)header.levelCount; ++level )
+	{
+		const unsigned char *data = &buffer[header.levelOffset[level]];
+		int w = header.pixelWidth >> level;
+		int h = header.pixelHeight >> level;
+		int d = header.pixelDepth >> level;
+		int image_size;
+		if( w < 1 )
+		{
+			w = 1;
+		}
+		if( h < 1 )
+		{
+			h = 1;
+		}
+		if( d < 1 )
+		{
+			d = 1;
+		}
+		image_size = compressed ?
+				((w+3)>>2) * ((h+3)>>2) * block_size :
+				w * h * block_size;
+		if( kind == SOIL_DIRECT_ARRAY )
+		{
+			/*	the layers of a level are one after the other, just as OpenGL wants them	*/
+			SOIL_internal_direct_upload(
+					tex_ID, target_start, level, internal_format, compressed,
+					w, h, layers, image_size * layers, data );
+		} else
+		if( kind == SOIL_DIRECT_VOLUME )
+		{
+			/*	and so are the slices	*/
+			SOIL_internal_direct_upload(
+					tex_ID, target_start, level, internal_format, compressed,
+					w, h, d, image_size * d, data );
+		} else
+		{
+			/*	the faces of a level are one after the other	*/
+			for( face = 0; face < (int)header.faceCount; ++face )
+			{
+				SOIL_internal_direct_upload(
+						tex_ID, target_start + face, level, internal_format, compressed,
+						w, h, 0, image_size, &data[face * image_size] );
+			}
+		}
+	}
+	if( !compressed )
+	{
+		glPixelStorei( GL_UNPACK_ALIGNMENT, previous_alignment );
+	}
+	result_string_pointer = "KTX2 file loaded";
+	SOIL_internal_finish_direct_load( opengl_texture_type, tex_ID, header.levelCount - 1, flags );
+	return tex_ID;
+}
+
+unsigned int SOIL_direct_load_DDS(
+		const char *filename,
+		unsigned int reuse_texture_ID,
+		int flags,
+		int loading_as )
+{
+	FILE *f;
+	unsigned char *buffer;
+	size_t buffer_length, bytes_read;
+	unsigned int tex_ID = 0;
+	/*	error checks	*/
+	if( NULL == filename )
+	{
+		result_string_pointer = "NULL filename";
+		return 0;
+	}
+	f = fopen( filename, "rb" );
+	if( NULL == f )
+	{
+		/*	the file doesn't seem to exist (or be open-able)	*/
+		result_string_pointer = "Can not find DDS file";
+		return 0;
+	}
+	fseek( f, 0, SEEK_END );
+	buffer_length = ftell( f );
+	fseek( f, 0, SEEK_SET );
+	buffer = (unsigned char *) malloc( buffer_length );
+	if( NULL == buffer )
+	{
+		result_string_pointer = "malloc failed";
+		fclose( f );
+		return 0;
+	}
+	bytes_read = fread( (void*)buffer, 1, buffer_length, f );
+	fclose( f );
+	if( bytes_read < buffer_length )
+	{
+		/*	huh?	*/
+		buffer_length = bytes_read;
+	}
+	/*	now try to do the loading	*/
+	tex_ID = SOIL_direct_load_DDS_from_memory(
+		(const unsigned char *const)buffer, buffer_length,
+		reuse_texture_ID, flags, loading_as );
+	SOIL_free_image_data( buffer );
+	return tex_ID;
+}
+
+int query_NPOT_capability( void )
+{
+	/*	check for the capability	*/
+	if( has_NPOT_capability == SOIL_CAPABILITY_UNKNOWN )
+	{
+		/*	we haven't yet checked for the capability, do so	*/
+		if(
+			(NULL == strstr( (char const*)glGetString( GL_EXTENSIONS ),
+				"GL_ARB_texture_non_power_of_two" ) )
+			)
+		{
+			/*	not there, flag the failure	*/
+			has_NPOT_capability = SOIL_CAPABILITY_NONE;
+		} else
+		{
+			/*	it's there!	*/
+			has_NPOT_capability = SOIL_CAPABILITY_PRESENT;
+		}
+	}
+	/*	let the user know if we can do non-power-of-two textures or not	*/
+	return has_NPOT_capability;
+}
+
+int query_tex_rectangle_capability( void )
+{
+	/*	check for the capability	*/
+	if( has_tex_rectangle_capability == SOIL_CAPABILITY_UNKNOWN )
+	{
+		/*	we haven't yet checked for the capability, do so	*/
+		if(
+			(NULL == strstr( (char const*)glGetString( GL_EXTENSIONS ),
+				"GL_ARB_texture_rectangle" ) )
+		&&
+			(NULL == strstr( (char const*)glGetString( GL_EXTENSIONS ),
+				"GL_EXT_texture_rectangle" ) )
+		&&
+			(NULL == strstr( (char const*)glGetString( GL_EXTENSIONS ),
+				"GL_NV_texture_rectangle" ) )
+			)
+		{
+			/*	not there, flag the failure	*/
+			has_tex_rectangle_capability = SOIL_CAPABILITY_NONE;
+		} else
+		{
+			/*	it's there!	*/
+			has_tex_rectangle_capability = SOIL_CAPABILITY_PRESENT;
+		}
+	}
+	/*	let the user know if we can do texture rectangles or not	*/
+	return has_tex_rectangle_capability;
+}
+
+int query_cubemap_capability( void )
+{
+	/*	check for the capability	*/
+	if( has_cubemap_capability == SOIL_CAPABILITY_UNKNOWN )
+	{
+		/*	we haven't yet checked for the capability, do so	*/
+		if(
+			(NULL == strstr( (char const*)glGetString( GL_EXTENSIONS ),
+				"GL_ARB_texture_cube_map" ) )
+		&&
+			(NULL == strstr( (char const*)glGetString( GL_EXTENSIONS ),
+				"GL_EXT_texture_cube_map" ) )
+			)
+		{
+			/*	not there, flag the failure	*/
+			has_cubemap_capability = SOIL_CAPABILITY_NONE;
+		} else
+		{
+			/*	it's there!	*/
+			has_cubemap_capability = SOIL_CAPABILITY_PRESENT;
+		}
+	}
+	/*	let the user know if we can do cubemaps or not	*/
+	return has_cubemap_capability;
+}
+
+/*	finds an OpenGL function that is not in every opengl32 / libGL	*/
+P_SOIL_GLPROC SOIL_internal_get_proc_address( const char *name )
+{
+	P_SOIL_GLPROC ext_addr = NULL;
+	#ifdef WIN32
+		ext_addr = (P_SOIL_GLPROC)
+				wglGetProcAddress
+				(
+					name
+				);
+	#elif defined(__APPLE__) || defined(__APPLE_CC__)
+		/*	I can't test this Apple stuff!	*/
+		CFBundleRef bundle;
+		CFURLRef bundleURL =
+			CFURLCreateWithFileSystemPath(
+				kCFAllocatorDefault,
+				CFSTR("/System/Library/Frameworks/OpenGL.framework"),
+				kCFURLPOSIXPathStyle,
+				true );
+		CFStringRef extensionName =
+			CFStringCreateWithCString(
+				kCFAllocatorDefault,
+				name,
+				kCFStringEncodingASCII );
+		bundle = CFBundleCreate( kCFAllocatorDefault, bundleURL );
+		assert( bundle != NULL );
+		ext_addr = (P_SOIL_GLPROC)
+				CFBundleGetFunctionPointerForName
+				(
+					bundle, extensionName
+				);
+		CFRelease( bundleURL );
+		CFRelease( extensionName );
+		CFRelease( bundle );
+	#else
+		ext_addr = (P_SOIL_GLPROC)
+				glXGetProcAddressARB
+				(
+					(const GLubyte *)name
+				);
+	#endif
+	return ext_addr;
+}
+
+/*	finds glCompressedTexImage2D, shared by DXT and RGTC	*/
+P_SOIL_GLCOMPRESSEDTEXIMAGE2DPROC SOIL_internal_get_compressed_upload( void )
+{
+	return (P_SOIL_GLCOMPRESSEDTEXIMAGE2DPROC)
+			SOIL_internal_get_proc_address( "glCompressedTexImage2DARB" );
+}
+
+/*	finds glTexImage3D and glCompressedTexImage3D (which may be missing)
+	\return 1 if glTexImage3D was found	*/
+int SOIL_internal_get_3D_upload( void )
+{
+	if( NULL == soilGlTexImage3D )
+	{
+		soilGlTexImage3D = (P_SOIL_GLTEXIMAGE3DPROC)
+				SOIL_internal_get_proc_address( "glTexImage3D" );
+	}
+	if( NULL == soilGlTexImage3D )
+	{
+		soilGlTexImage3D = (P_SOIL_GLTEXIMAGE3DPROC)
+				SOIL_internal_get_proc_address( "glTexImage3DEXT" );
+	}
+	if( NULL == soilGlCompressedTexImage3D )
+	{
+		soilGlCompressedTexImage3D = (P_SOIL_GLCOMPRESSEDTEXIMAGE3DPROC)
+				SOIL_internal_get_proc_address( "glCompressedTexImage3D" );
+	}
+	if( NULL == soilGlCompressedTexImage3D )
+	{
+		soilGlCompressedTexImage3D = (P_SOIL_GLCOMPRESSEDTEXIMAGE3DPROC)
+				SOIL_internal_get_proc_address( "glCompressedTexImage3DARB" );
+	}
+	return (NULL != soilGlTexImage3D);
+}
+
+/*	a capability loaded by SOIL_load_capabilities() looks up the function
+	it needs when it is first asked for, and is gone if it is missing	*/
+void SOIL_internal_check_compressed_upload( int *capability )
+{
+	if( (*capability == SOIL_CAPABILITY_PRESENT) &&
+		(NULL == soilGlCompressedTexImage2D) )
+	{
+		soilGlCompressedTexImage2D = SOIL_internal_get_compressed_upload();
+		if( NULL == soilGlCompressedTexImage2D )
+		{
+			*capability = SOIL_CAPABILITY_NONE;
+		}
+	}
+}
+
+void SOIL_internal_check_3D_upload( int *capability )
+{
+	if( (*capability == SOIL_CAPABILITY_PRESENT) &&
+		(NULL == soilGlTexImage3D) &&
+		!SOIL_internal_get_3D_upload() )
+	{
+		*capability = SOIL_CAPABILITY_NONE;
+	}
+}
+
+/*	the major version number of the OpenGL context (0 if unknown)	*/
+int SOIL_internal_GL_major_version( void )
+{
+	const char *version = (char const*)glGetString( GL_VERSION );
+	if( NULL == version )
+	{
+		return 0;
 	}
-	/*	now, if it is too large...	*/
-	if( (width > max_supported_size) || (height > max_supported_size) )
+	return atoi( version );
+}
+
+int query_texture_array_capability( void )
+{
+	SOIL_internal_check_3D_upload( &has_texture_array_capability );
+	/*	check for the capability	*/
+	if( has_texture_array_capability == SOIL_CAPABILITY_UNKNOWN )
 	{
-		/*	I've already made it a power of two, so simply use the MIPmapping
-			code to reduce its size to the allowable maximum.	*/
-		unsigned char *resampled;
-		int reduce_block_x = 1, reduce_block_y = 1;
-		int new_width, new_height;
-		if( width > max_supported_size )
+		/*	we haven't yet checked for the capability, do so
+			(texture arrays are core in OpenGL 3.0)	*/
+		const char *extensions = (char const*)glGetString( GL_EXTENSIONS );
+		if( (SOIL_internal_GL_major_version() < 3) &&
+			(	(NULL == extensions) ||
+				(NULL == strstr( extensions, "GL_EXT_texture_array" )) ) )
 		{
-			reduce_block_x = width / max_supported_size;
-		}
-		if( height > max_supported_size )
+			/*	not there, flag the failure	*/
+			has_texture_array_capability = SOIL_CAPABILITY_NONE;
+		} else
+		if( !SOIL_internal_get_3D_upload() )
 		{
-			reduce_block_y = height / max_supported_size;
+			/*	I need glTexImage3D to upload them	*/
+			has_texture_array_capability = SOIL_CAPABILITY_NONE;
+		} else
+		{
+			/*	it's there!	*/
+			has_texture_array_capability = SOIL_CAPABILITY_PRESENT;
 		}
-		new_width = width / reduce_block_x;
-		new_height = height / reduce_block_y;
-		resampled = (unsigned char*)malloc( channels*new_width*new_height );
-		/*	perform the actual reduction	*/
-		mipmap_image(	img, width, height, channels,
-						resampled, reduce_block_x, reduce_block_y );
-		/*	nuke the old guy, then point it at the new guy	*/
-		SOIL_free_image_data( img );
-		img = resampled;
-		width = new_width;
-		height = new_height;
 	}
-	/*	does the user want us to use YCoCg color space?	*/
-	if( flags & SOIL_FLAG_CoCg_Y )
+	/*	let the user know if we can do texture arrays or not	*/
+	return has_texture_array_capability;
+}
+
+int query_3D_capability( void )
+{
+	SOIL_internal_check_3D_upload( &has_3D_capability );
+	/*	check for the capability	*/
+	if( has_3D_capability == SOIL_CAPABILITY_UNKNOWN )
 	{
-		/*	this will only work with RGB and RGBA images */
-		convert_RGB_to_YCoCg( img, width, height, channels );
-		/*
-		save_image_as_DDS( "CoCg_Y.dds", width, height, channels, img );
-		*/
+		/*	we haven't yet checked for the capability, do so
+			(3D textures are core in OpenGL 1.2)	*/
+		const char *extensions = (char const*)glGetString( GL_EXTENSIONS );
+		const char *version = (char const*)glGetString( GL_VERSION );
+		if( (	(NULL == version) ||
+				(0 == strncmp( version, "1.0", 3 )) ||
+				(0 == strncmp( version, "1.1", 3 )) ) &&
+			(	(NULL == extensions) ||
+				(NULL == strstr( extensions, "GL_EXT_texture3D" )) ) )
+		{
+			/*	not there, flag the failure	*/
+			has_3D_capability = SOIL_CAPABILITY_NONE;
+		} else
+		if( !SOIL_internal_get_3D_upload() )
+		{
+			/*	I need glTexImage3D to upload them	*/
+			has_3D_capability = SOIL_CAPABILITY_NONE;
+		} else
+		{
+			/*	it's there!	*/
+			has_3D_capability = SOIL_CAPABILITY_PRESENT;
+		}
 	}
-	/*	create the OpenGL texture ID handle
-    	(note: allowing a forced texture ID lets me reload a texture)	*/
-    tex_id = reuse_texture_ID;
-    if( tex_id == 0 )
-    {
-		glGenTextures( 1, &tex_id );
-    }
-	check_for_GL_errors( "glGenTextures" );
-	/* Note: sometimes glGenTextures fails (usually no OpenGL context)	*/
-	if( tex_id )
+	/*	let the user know if we can do 3D textures or not	*/
+	return has_3D_capability;
+}
+
+int query_DXT_capability( void )
+{
+	SOIL_internal_check_compressed_upload( &has_DXT_capability );
+	/*	check for the capability	*/
+	if( has_DXT_capability == SOIL_CAPABILITY_UNKNOWN )
 	{
-		/*	and what type am I using as the internal texture format?	*/
-		switch( channels )
+		/*	we haven't yet checked for the capability, do so	*/
+		if( NULL == strstr(
+				(char const*)glGetString( GL_EXTENSIONS ),
+				"GL_EXT_texture_compression_s3tc" ) )
 		{
-		case 1:
-			original_texture_format = GL_LUMINANCE;
-			break;
-		case 2:
-			original_texture_format = GL_LUMINANCE_ALPHA;
-			break;
-		case 3:
-			original_texture_format = GL_RGB;
-			break;
-		case 4:
-			original_texture_format = GL_RGBA;
-			break;
-		}
-		internal_texture_format = original_texture_format;
-		/*	does the user want me to, and can I, save as DXT?	*/
-		if( flags & SOIL_FLAG_COMPRESS_TO_DXT )
+			/*	not there, flag the failure	*/
+			has_DXT_capability = SOIL_CAPABILITY_NONE;
+		} else
 		{
-			DXT_mode = query_DXT_capability();
-			if( DXT_mode == SOIL_CAPABILITY_PRESENT )
+			/*	and find the address of the extension function	*/
+			P_SOIL_GLCOMPRESSEDTEXIMAGE2DPROC ext_addr =
+					SOIL_internal_get_compressed_upload();
+			/*	Flag it so no checks needed later	*/
+			if( NULL == ext_addr )
 			{
-				/*	I can use DXT, whether I compress it or OpenGL does	*/
-				if( (channels & 1) == 1 )
-				{
-					/*	1 or 3 channels = DXT1	*/
-					internal_texture_format = SOIL_RGB_S3TC_DXT1;
-				} else
-				{
-					/*	2 or 4 channels = DXT5	*/
-					internal_texture_format = SOIL_RGBA_S3TC_DXT5;
-				}
+				/*	hmm, not good!!  This should not happen, but does on my
+					laptop's VIA chipset.  The GL_EXT_texture_compression_s3tc
+					spec requires that ARB_texture_compression be present too.
+					this means I can upload and have the OpenGL drive do the
+					conversion, but I can't use my own routines or load DDS files
+					from disk and upload them directly [8^(	*/
+				has_DXT_capability = SOIL_CAPABILITY_NONE;
+			} else
+			{
+				/*	all's well!	*/
+				soilGlCompressedTexImage2D = ext_addr;
+				has_DXT_capability = SOIL_CAPABILITY_PRESENT;
 			}
 		}
-		/*  bind an OpenGL texture ID	*/
-		glBindTexture( opengl_texture_type, tex_id );
-		check_for_GL_errors( "glBindTexture" );
-		/*  upload the main image	*/
-		if( DXT_mode == SOIL_CAPABILITY_PRESENT )
+	}
+	/*	let the user know if we can do DXT or not	*/
+	return has_DXT_capability;
+}
+
+int query_RGTC_capability( void )
+{
+	SOIL_internal_check_compressed_upload( &has_RGTC_capability );
+	/*	check for the capability	*/
+	if( has_RGTC_capability == SOIL_CAPABILITY_UNKNOWN )
+	{
+		/*	we haven't yet checked for the capability, do so	*/
+		const char *extensions = (char const*)glGetString( GL_EXTENSIONS );
+		if( (NULL == extensions) ||
+			(	(NULL == strstr( extensions, "GL_ARB_texture_compression_rgtc" )) &&
+				(NULL == strstr( extensions, "GL_EXT_texture_compression_rgtc" )) ) )
 		{
-			/*	user wants me to do the DXT conversion!	*/
-			int DDS_size;
-			unsigned char *DDS_data = NULL;
-			if( (channels & 1) == 1 )
-			{
-				/*	RGB, use DXT1	*/
-				DDS_data = convert_image_to_DXT1( img, width, height, channels, &DDS_size );
-			} else
+			/*	not there, flag the failure	*/
+			has_RGTC_capability = SOIL_CAPABILITY_NONE;
+		} else
+		{
+			/*	I need glCompressedTexImage2D too (the DXT check may have found it)	*/
+			if( NULL == soilGlCompressedTexImage2D )
 			{
-				/*	RGBA, use DXT5	*/
-				DDS_data = convert_image_to_DXT5( img, width, height, channels, &DDS_size );
+				soilGlCompressedTexImage2D = SOIL_internal_get_compressed_upload();
 			}
-			if( DDS_data )
+			if( NULL == soilGlCompressedTexImage2D )
 			{
-				soilGlCompressedTexImage2D(
-					opengl_texture_target, 0,
-					internal_texture_format, width, height, 0,
-					DDS_size, DDS_data );
-				check_for_GL_errors( "glCompressedTexImage2D" );
-				SOIL_free_image_data( DDS_data );
-				/*	printf( "Internal DXT compressor\n" );	*/
+				has_RGTC_capability = SOIL_CAPABILITY_NONE;
 			} else
 			{
-				/*	my compression failed, try the OpenGL driver's version	*/
-				glTexImage2D(
-					opengl_texture_target, 0,
-					internal_texture_format, width, height, 0,
-					original_texture_format, GL_UNSIGNED_BYTE, img );
-				check_for_GL_errors( "glTexImage2D" );
-				/*	printf( "OpenGL DXT compressor\n" );	*/
+				has_RGTC_capability = SOIL_CAPABILITY_PRESENT;
 			}
-		} else
+		}
+	}
+	/*	let the user know if we can do RGTC or not	*/
+	return has_RGTC_capability;
+}
+
+int query_BPTC_capability( void )
+{
+	SOIL_internal_check_compressed_upload( &has_BPTC_capability );
+	/*	check for the capability	*/
+	if( has_BPTC_capability == SOIL_CAPABILITY_UNKNOWN )
+	{
+		/*	we haven't yet checked for the capability, do so	*/
+		const char *extensions = (char const*)glGetString( GL_EXTENSIONS );
+		if( (NULL == extensions) ||
+			(	(NULL == strstr( extensions, "GL_ARB_texture_compression_bptc" )) &&
+				(NULL == strstr( extensions, "GL_EXT_texture_compression_bptc" )) ) )
 		{
-			/*	user want OpenGL to do all the work!	*/
-			glTexImage2D(
-				opengl_texture_target, 0,
-				internal_texture_format, width, height, 0,
-				original_texture_format, GL_UNSIGNED_BYTE, img );
-			check_for_GL_errors( "glTexImage2D" );
-			/*printf( "OpenGL DXT compressor\n" );	*/
-		}
-		/*	are any MIPmaps desired?	*/
-		if( flags & SOIL_FLAG_MIPMAPS )
-		{
-			int MIPlevel = 1;
-			int MIPwidth = (width+1) / 2;
-			int MIPheight = (height+1) / 2;
-			unsigned char *resampled = (unsigned char*)malloc( channels*MIPwidth*MIPheight );
-			while( ((1<<MIPlevel) <= width) || ((1<<MIPlevel) <= height) )
-			{
-				/*	do this MIPmap level	*/
-				mipmap_image(
-						img, width, height, channels,
-						resampled,
-						(1 << MIPlevel), (1 << MIPlevel) );
-				/*  upload the MIPmaps	*/
-				if( DXT_mode == SOIL_CAPABILITY_PRESENT )
-				{
-					/*	user wants me to do the DXT conversion!	*/
-					int DDS_size;
-					unsigned char *DDS_data = NULL;
-					if( (channels & 1) == 1 )
-					{
-						/*	RGB, use DXT1	*/
-						DDS_data = convert_image_to_DXT1(
-								resampled, MIPwidth, MIPheight, channels, &DDS_size );
-					} else
-					{
-						/*	RGBA, use DXT5	*/
-						DDS_data = convert_image_to_DXT5(
-								resampled, MIPwidth, MIPheight, channels, &DDS_size );
-					}
-					if( DDS_data )
-					{
-						soilGlCompressedTexImage2D(
-							opengl_texture_target, MIPlevel,
-							internal_texture_format, MIPwidth, MIPheight, 0,
-							DDS_size, DDS_data );
-						check_for_GL_errors( "glCompressedTexImage2D" );
-						SOIL_free_image_data( DDS_data );
-					} else
-					{
-						/*	my compression failed, try the OpenGL driver's version	*/
-						glTexImage2D(
-							opengl_texture_target, MIPlevel,
-							internal_texture_format, MIPwidth, MIPheight, 0,
-							original_texture_format, GL_UNSIGNED_BYTE, resampled );
-						check_for_GL_errors( "glTexImage2D" );
-					}
-				} else
-				{
-					/*	user want OpenGL to do all the work!	*/
-					glTexImage2D(
-						opengl_texture_target, MIPlevel,
-						internal_texture_format, MIPwidth, MIPheight, 0,
-						original_texture_format, GL_UNSIGNED_BYTE, resampled );
-					check_for_GL_errors( "glTexImage2D" );
-				}
-				/*	prep for the next level	*/
-				++MIPlevel;
-				MIPwidth = (MIPwidth + 1) / 2;
-				MIPheight = (MIPheight + 1) / 2;
-			}
-			SOIL_free_image_data( resampled );
-			/*	instruct OpenGL to use the MIPmaps	*/
-			glTexParameteri( opengl_texture_type, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
-			glTexParameteri( opengl_texture_type, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR );
-			check_for_GL_errors( "GL_TEXTURE_MIN/MAG_FILTER" );
+			/*	not there, flag the failure	*/
+			has_BPTC_capability = SOIL_CAPABILITY_NONE;
 		} else
 		{
-			/*	instruct OpenGL _NOT_ to use the MIPmaps	*/
-			glTexParameteri( opengl_texture_type, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
-			glTexParameteri( opengl_texture_type, GL_TEXTURE_MIN_FILTER, GL_LINEAR );
-			check_for_GL_errors( "GL_TEXTURE_MIN/MAG_FILTER" );
-		}
-		/*	does the user want clamping, or wrapping?	*/
-		if( flags & SOIL_FLAG_TEXTURE_REPEATS )
-		{
-			glTexParameteri( opengl_texture_type, GL_TEXTURE_WRAP_S, GL_REPEAT );
-			glTexParameteri( opengl_texture_type, GL_TEXTURE_WRAP_T, GL_REPEAT );
-			if( opengl_texture_type == SOIL_TEXTURE_CUBE_MAP )
+			/*	I need glCompressedTexImage2D too	*/
+			if( NULL == soilGlCompressedTexImage2D )
 			{
-				/*	SOIL_TEXTURE_WRAP_R is invalid if cubemaps aren't supported	*/
-				glTexParameteri( opengl_texture_type, SOIL_TEXTURE_WRAP_R, GL_REPEAT );
+				soilGlCompressedTexImage2D = SOIL_internal_get_compressed_upload();
 			}
-			check_for_GL_errors( "GL_TEXTURE_WRAP_*" );
-		} else
-		{
-			/*	unsigned int clamp_mode = SOIL_CLAMP_TO_EDGE;	*/
-			unsigned int clamp_mode = GL_CLAMP;
-			glTexParameteri( opengl_texture_type, GL_TEXTURE_WRAP_S, clamp_mode );
-			glTexParameteri( opengl_texture_type, GL_TEXTURE_WRAP_T, clamp_mode );
-			if( opengl_texture_type == SOIL_TEXTURE_CUBE_MAP )
+			if( NULL == soilGlCompressedTexImage2D )
+			{
+				has_BPTC_capability = SOIL_CAPABILITY_NONE;
+			} else
 			{
-				/*	SOIL_TEXTURE_WRAP_R is invalid if cubemaps aren't supported	*/
-				glTexParameteri( opengl_texture_type, SOIL_TEXTURE_WRAP_R, clamp_mode );
+				has_BPTC_capability = SOIL_CAPABILITY_PRESENT;
 			}
-			check_for_GL_errors( "GL_TEXTURE_WRAP_*" );
 		}
-		/*	done	*/
-		result_string_pointer = "Image loaded as an OpenGL texture";
-	} else
-	{
-		/*	failed	*/
-		result_string_pointer = "Failed to generate an OpenGL texture name; missing OpenGL context?";
 	}
-	SOIL_free_image_data( img );
-	return tex_id;
+	/*	let the user know if we can do BPTC or not	*/
+	return has_BPTC_capability;
 }
 
-int
-	SOIL_save_screenshot
-	(
-		const char *filename,
-		int image_type,
-		int x, int y,
-		int width, int height
-	)
+int SOIL_internal_GL_limit( unsigned int limit_enum )
 {
-	unsigned char *pixel_data;
-	int i, j;
-	int save_result;
-
-	/*	error checks	*/
-	if( (width < 1) || (height < 1) )
-	{
-		result_string_pointer = "Invalid screenshot dimensions";
-		return 0;
-	}
-	if( (x < 0) || (y < 0) )
+	int which = SOIL_LIMIT_TEXTURE_SIZE;
+	GLint value = 0;
+	switch( limit_enum )
 	{
-		result_string_pointer = "Invalid screenshot location";
-		return 0;
+	case SOIL_MAX_CUBE_MAP_TEXTURE_SIZE:	which = SOIL_LIMIT_CUBE_MAP_TEXTURE_SIZE; break;
+	case SOIL_MAX_3D_TEXTURE_SIZE:		which = SOIL_LIMIT_3D_TEXTURE_SIZE; break;
+	case SOIL_MAX_ARRAY_TEXTURE_LAYERS:	which = SOIL_LIMIT_ARRAY_TEXTURE_LAYERS; break;
+	default:
+		if( limit_enum != GL_MAX_TEXTURE_SIZE )
+		{
+			/*	not one SOIL keeps	*/
+			glGetIntegerv( limit_enum, &value );
+			return value;
+		}
 	}
-	if( filename == NULL )
+	if( SOIL_limits[which] < 0 )
 	{
-		result_string_pointer = "Invalid screenshot filename";
-		return 0;
+		glGetIntegerv( limit_enum, &value );
+		SOIL_limits[which] = value;
 	}
+	return SOIL_limits[which];
+}
 
-    /*  Get the data from OpenGL	*/
-    pixel_data = (unsigned char*)malloc( 3*width*height );
-    glReadPixels (x, y, width, height, GL_RGB, GL_UNSIGNED_BYTE, pixel_data);
+/*	the capability snapshot, all little endian:
+		"SOILCAPS", version, the length of the key, the key (the
+		vendor, renderer and version strings, each ending in '\n'),
+		a byte per capability, the limits, then the FNV-1a hash of
+		everything before it	*/
+#define SOIL_CAPS_VERSION		1
+#define SOIL_CAPS_MAX_KEY		1024
+#define SOIL_CAPS_NUM			8
 
-    /*	invert the image	*/
-    for( j = 0; j*2 < height; ++j )
-	{
-		int index1 = j * width * 3;
-		int index2 = (height - 1 - j) * width * 3;
-		for( i = width * 3; i > 0; --i )
-		{
-			unsigned char temp = pixel_data[index1];
-			pixel_data[index1] = pixel_data[index2];
-			pixel_data[index2] = temp;
-			++index1;
-			++index2;
-		}
-	}
+static int *const SOIL_caps_snapshot[SOIL_CAPS_NUM] =
+{
+	&has_cubemap_capability,
+	&has_NPOT_capability,
+	&has_tex_rectangle_capability,
+	&has_DXT_capability,
+	&has_RGTC_capability,
+	&has_BPTC_capability,
+	&has_texture_array_capability,
+	&has_3D_capability
+};
+static const unsigned int SOIL_caps_limit_enums[SOIL_NUM_LIMITS] =
+{
+	GL_MAX_TEXTURE_SIZE,
+	SOIL_MAX_CUBE_MAP_TEXTURE_SIZE,
+	SOIL_MAX_3D_TEXTURE_SIZE,
+	SOIL_MAX_ARRAY_TEXTURE_LAYERS
+};
 
-    /*	save the image	*/
-    save_result = SOIL_save_image( filename, image_type, width, height, 3, pixel_data);
+static void SOIL_caps_put_u32( unsigned char *p, unsigned int value )
+{
+	p[0] = (unsigned char)(value);
+	p[1] = (unsigned char)(value >> 8);
+	p[2] = (unsigned char)(value >> 16);
+	p[3] = (unsigned char)(value >> 24);
+}
 
-    /*  And free the memory	*/
-    SOIL_free_image_data( pixel_data );
-	return save_result;
+static unsigned int SOIL_caps_get_u32( const unsigned char *p )
+{
+	return (unsigned int)p[0] | ((unsigned int)p[1] << 8) |
+			((unsigned int)p[2] << 16) | ((unsigned int)p[3] << 24);
 }
 
-unsigned char*
-	SOIL_load_image
-	(
-		const char *filename,
-		int *width, int *height, int *channels,
-		int force_channels
-	)
+static unsigned int SOIL_caps_hash( const unsigned char *data, int length )
 {
-	unsigned char *result = stbi_load( filename,
-			width, height, channels, force_channels );
-	if( result == NULL )
+	unsigned int hash = 2166136261u;
+	int i;
+	for( i = 0; i < length; ++i )
 	{
-		result_string_pointer = stbi_failure_reason();
-	} else
+		hash ^= data[i];
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+/*	who made the context: a snapshot only fits the same	*/
+static int SOIL_caps_key( char key[SOIL_CAPS_MAX_KEY] )
+{
+	static const GLenum names[3] = { GL_VENDOR, GL_RENDERER, GL_VERSION };
+	int length = 0, i;
+	for( i = 0; i < 3; ++i )
 	{
-		result_string_pointer = "Image loaded";
+		const char *value = (const char*)glGetString( names[i] );
+		int value_length;
+		if( NULL == value )
+		{
+			return 0;
+		}
+		value_length = (int)strlen( value );
+		if( length + value_length + 1 > SOIL_CAPS_MAX_KEY )
+		{
+			return 0;
+		}
+		memcpy( key + length, value, value_length );
+		length += value_length;
+		key[length++] = '\n';
 	}
-	return result;
+	return length;
 }
 
-unsigned char*
-	SOIL_load_image_from_memory
+int
+	SOIL_save_capabilities
 	(
-		const unsigned char *const buffer,
-		int buffer_length,
-		int *width, int *height, int *channels,
-		int force_channels
+		const char *filename
 	)
 {
-	unsigned char *result = stbi_load_from_memory(
-				buffer, buffer_length,
-				width, height, channels,
-				force_channels );
-	if( result == NULL )
+	unsigned char buffer[16 + SOIL_CAPS_MAX_KEY + SOIL_CAPS_NUM + 4 * SOIL_NUM_LIMITS + 4];
+	int key_length, size, i;
+	FILE *f;
+	key_length = SOIL_caps_key( (char*)&buffer[16] );
+	if( 0 == key_length )
 	{
-		result_string_pointer = stbi_failure_reason();
-	} else
+		result_string_pointer = "No OpenGL context to save the capabilities of";
+		return 0;
+	}
+	/*	find out everything, then write it down	*/
+	query_cubemap_capability();
+	query_NPOT_capability();
+	query_tex_rectangle_capability();
+	query_DXT_capability();
+	query_RGTC_capability();
+	query_BPTC_capability();
+	query_texture_array_capability();
+	query_3D_capability();
+	memcpy( buffer, "SOILCAPS", 8 );
+	SOIL_caps_put_u32( &buffer[8], SOIL_CAPS_VERSION );
+	SOIL_caps_put_u32( &buffer[12], (unsigned int)key_length );
+	size = 16 + key_length;
+	for( i = 0; i < SOIL_CAPS_NUM; ++i )
+	{
+		buffer[size++] = (unsigned char)*SOIL_caps_snapshot[i];
+	}
+	for( i = 0; i < SOIL_NUM_LIMITS; ++i )
+	{
+		SOIL_caps_put_u32( &buffer[size], (unsigned int)SOIL_internal_GL_limit( SOIL_caps_limit_enums[i] ) );
+		size += 4;
+	}
+	SOIL_caps_put_u32( &buffer[size], SOIL_caps_hash( buffer, size ) );
+	size += 4;
+	f = fopen( filename, "wb" );
+	if( NULL == f )
+	{
+		result_string_pointer = "Unable to open the capabilities file for writing";
+		return 0;
+	}
+	if( fwrite( buffer, 1, size, f ) != (size_t)size )
 	{
-		result_string_pointer = "Image loaded from memory";
+		fclose( f );
+		result_string_pointer = "Unable to write the capabilities file";
+		return 0;
 	}
-	return result;
+	fclose( f );
+	result_string_pointer = "Capabilities saved";
+	return 1;
 }
 
 int
-	SOIL_save_image
+	SOIL_load_capabilities
 	(
-		const char *filename,
-		int image_type,
-		int width, int height, int channels,
-		const unsigned char *const data
+		const char *filename
 	)
 {
-	int save_result;
-
-	/*	error check	*/
-	if( (width < 1) || (height < 1) ||
-		(channels < 1) || (channels > 4) ||
-		(data == NULL) ||
-		(filename == NULL) )
+	unsigned char buffer[16 + SOIL_CAPS_MAX_KEY + SOIL_CAPS_NUM + 4 * SOIL_NUM_LIMITS + 4];
+	char key[SOIL_CAPS_MAX_KEY];
+	int key_length, size, i;
+	const unsigned char *p;
+	FILE *f = fopen( filename, "rb" );
+	if( NULL == f )
 	{
+		result_string_pointer = "Unable to open the capabilities file";
 		return 0;
 	}
-	if( image_type == SOIL_SAVE_TYPE_BMP )
-	{
-		save_result = stbi_write_bmp( filename,
-				width, height, channels, (void*)data );
-	} else
-	if( image_type == SOIL_SAVE_TYPE_TGA )
-	{
-		save_result = stbi_write_tga( filename,
-				width, height, channels, (void*)data );
-	} else
-	if( image_type == SOIL_SAVE_TYPE_DDS )
+	size = (int)fread( buffer, 1, sizeof(buffer), f );
+	fclose( f );
+	if( (size < 16) || (0 != memcmp( buffer, "SOILCAPS", 8 )) ||
+		(SOIL_caps_get_u32( &buffer[8] ) != SOIL_CAPS_VERSION) ||
+		(SOIL_caps_get_u32( &buffer[12] ) > SOIL_CAPS_MAX_KEY) ||
+		(size != 16 + (int)SOIL_caps_get_u32( &buffer[12] ) + SOIL_CAPS_NUM + 4 * SOIL_NUM_LIMITS + 4) ||
+		(SOIL_caps_get_u32( &buffer[size - 4] ) != SOIL_caps_hash( buffer, size - 4 )) )
 	{
-		save_result = save_image_as_DDS( filename,
-				width, height, channels, (const unsigned char *const)data );
-	} else
+		result_string_pointer = "Not a capabilities file, or a damaged one";
+		return 0;
+	}
+	/*	the three strings are all that is asked of the driver here	*/
+	key_length = SOIL_caps_key( key );
+	if( (0 == key_length) || (key_length != (int)SOIL_caps_get_u32( &buffer[12] )) ||
+		(0 != memcmp( key, &buffer[16], key_length )) )
 	{
-		save_result = 0;
+		result_string_pointer = "The capabilities were saved for another OpenGL implementation";
+		return 0;
 	}
-	if( save_result == 0 )
+	/*	what this run already found out stays	*/
+	p = &buffer[16 + key_length];
+	for( i = 0; i < SOIL_CAPS_NUM; ++i, ++p )
 	{
-		result_string_pointer = "Saving the image failed";
-	} else
+		if( (*SOIL_caps_snapshot[i] == SOIL_CAPABILITY_UNKNOWN) &&
+			((*p == SOIL_CAPABILITY_NONE) || (*p == SOIL_CAPABILITY_PRESENT)) )
+		{
+			*SOIL_caps_snapshot[i] = *p;
+		}
+	}
+	for( i = 0; i < SOIL_NUM_LIMITS; ++i, p += 4 )
 	{
-		result_string_pointer = "Image saved";
+		if( SOIL_limits[i] < 0 )
+		{
+			SOIL_limits[i] = (int)SOIL_caps_get_u32( p );
+		}
 	}
-	return save_result;
+	result_string_pointer = "Capabilities loaded";
+	return 1;
 }
 
-void
-	SOIL_free_image_data
-	(
-		unsigned char *img_data
-	)
+/*	the texture residency manager	*/
+/*	a texture that is still streaming in its larger MIP levels	*/
+typedef struct
 {
-	free( (void*)img_data );
+	SOIL_internal_texture texture;
+	/*	the DDS file the levels come from, or NULL if they are made from texture.base	*/
+	unsigned char *DDS_buffer;
 }
+SOIL_internal_progressive;
 
-const char*
-	SOIL_last_result
-	(
-		void
-	)
+void SOIL_internal_free_level( SOIL_internal_level *level )
 {
-	return result_string_pointer;
+	if( !level->borrowed )
+	{
+		SOIL_free_image_data( level->data );
+	}
+	level->data = NULL;
 }
 
-unsigned int SOIL_direct_load_DDS_from_memory(
-		const unsigned char *const buffer,
+void SOIL_internal_free_progressive( SOIL_internal_progressive *progressive )
+{
+	if( progressive )
+	{
+		SOIL_internal_free_texture( &progressive->texture );
+		if( !progressive->texture.base_borrowed )
+		{
+			SOIL_free_image_data( (unsigned char*)progressive->texture.base );
+		}
+		SOIL_free_image_data( progressive->DDS_buffer );
+		free( progressive );
+	}
+}
+
+/*	gets the levels of a compressed 2D DDS file with MIPmaps, without copying them	*/
+int SOIL_internal_progressive_DDS(
+		unsigned char *buffer,
 		int buffer_length,
-		unsigned int reuse_texture_ID,
-		int flags,
-		int loading_as_cubemap )
+		SOIL_internal_texture *texture )
 {
-	/*	variables	*/
 	DDS_header header;
-	unsigned int buffer_index = 0;
-	unsigned int tex_ID = 0;
-	/*	file reading variables	*/
-	unsigned int S3TC_type = 0;
-	unsigned char *DDS_data;
-	unsigned int DDS_main_size;
-	unsigned int DDS_full_size;
-	unsigned int width, height;
-	int mipmaps, cubemap, uncompressed, block_size = 16;
-	unsigned int flag;
-	unsigned int cf_target, ogl_target_start, ogl_target_end;
-	unsigned int opengl_texture_type;
-	int i;
-	/*	1st off, does the filename even exist?	*/
-	if( NULL == buffer )
+	unsigned int offset;
+	int block_size = 16, level;
+	if( buffer_length < (int)sizeof( DDS_header ) )
 	{
-		/*	we can't do it!	*/
-		result_string_pointer = "NULL buffer";
 		return 0;
 	}
-	if( buffer_length < sizeof( DDS_header ) )
+	memcpy( (void*)(&header), (const void *)buffer, sizeof( DDS_header ) );
+	if( (header.dwMagic != (('D'<<0)|('D'<<8)|('S'<<16)|(' '<<24))) ||
+		(header.dwSize != 124) ||
+		!(header.sPixelFormat.dwFlags & DDPF_FOURCC) ||
+		(header.sCaps.dwCaps2 & (DDSCAPS2_CUBEMAP | DDSCAPS2_VOLUME)) ||
+		!(header.sCaps.dwCaps1 & DDSCAPS_MIPMAP) ||
+		(header.dwMipMapCount < 2) )
 	{
-		/*	we can't do it!	*/
-		result_string_pointer = "DDS file was too small to contain the DDS header";
 		return 0;
 	}
-	/*	try reading in the header	*/
-	memcpy ( (void*)(&header), (const void *)buffer, sizeof( DDS_header ) );
-	buffer_index = sizeof( DDS_header );
-	/*	guilty until proven innocent	*/
-	result_string_pointer = "Failed to read a known DDS header";
-	/*	validate the header (warning, "goto"'s ahead, shield your eyes!!)	*/
-	flag = ('D'<<0)|('D'<<8)|('S'<<16)|(' '<<24);
-	if( header.dwMagic != flag ) {goto quick_exit;}
-	if( header.dwSize != 124 ) {goto quick_exit;}
-	/*	I need all of these	*/
-	flag = DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT;
-	if( (header.dwFlags & flag) != flag ) {goto quick_exit;}
-	/*	According to the MSDN spec, the dwFlags should contain
-		DDSD_LINEARSIZE if it's compressed, or DDSD_PITCH if
-		uncompressed.  Some DDS writers do not conform to the
-		spec, so I need to make my reader more tolerant	*/
-	/*	I need one of these	*/
-	flag = DDPF_FOURCC | DDPF_RGB;
-	if( (header.sPixelFormat.dwFlags & flag) == 0 ) {goto quick_exit;}
-	if( header.sPixelFormat.dwSize != 32 ) {goto quick_exit;}
-	if( (header.sCaps.dwCaps1 & DDSCAPS_TEXTURE) == 0 ) {goto quick_exit;}
-	/*	make sure it is a type we can upload	*/
-	if( (header.sPixelFormat.dwFlags & DDPF_FOURCC) &&
-		!(
-		(header.sPixelFormat.dwFourCC == (('D'<<0)|('X'<<8)|('T'<<16)|('1'<<24))) ||
-		(header.sPixelFormat.dwFourCC == (('D'<<0)|('X'<<8)|('T'<<16)|('3'<<24))) ||
-		(header.sPixelFormat.dwFourCC == (('D'<<0)|('X'<<8)|('T'<<16)|('5'<<24)))
-		) )
+	memset( texture, 0, sizeof( SOIL_internal_texture ) );
+	offset = sizeof( DDS_header );
+	texture->internal_texture_format = SOIL_internal_DDS_DX10_format(
+			buffer, buffer_length, &header, &offset, &block_size );
+	if( !SOIL_internal_DDS_format_supported( texture->internal_texture_format ) )
 	{
-		goto quick_exit;
+		return 0;
 	}
-	/*	OK, validated the header, let's load the image data	*/
-	result_string_pointer = "DDS header loaded and validated";
-	width = header.dwWidth;
-	height = header.dwHeight;
-	uncompressed = 1 - (header.sPixelFormat.dwFlags & DDPF_FOURCC) / DDPF_FOURCC;
-	cubemap = (header.sCaps.dwCaps2 & DDSCAPS2_CUBEMAP) / DDSCAPS2_CUBEMAP;
-	if( uncompressed )
+	texture->num_levels = header.dwMipMapCount;
+	if( texture->num_levels > SOIL_MAX_LEVELS )
 	{
-		S3TC_type = GL_RGB;
-		block_size = 3;
-		if( header.sPixelFormat.dwFlags & DDPF_ALPHAPIXELS )
+		texture->num_levels = SOIL_MAX_LEVELS;
+	}
+	/*	point every level into the file	*/
+	for( level = 0; level < texture->num_levels; ++level )
+	{
+		SOIL_internal_level *L = &texture->levels[level];
+		L->width = header.dwWidth >> level;
+		L->height = header.dwHeight >> level;
+		if( L->width < 1 )
 		{
-			S3TC_type = GL_RGBA;
-			block_size = 4;
+			L->width = 1;
 		}
-		DDS_main_size = width * height * block_size;
-	} else
-	{
-		/*	can we even handle direct uploading to OpenGL DXT compressed images?	*/
-		if( query_DXT_capability() != SOIL_CAPABILITY_PRESENT )
+		if( L->height < 1 )
+		{
+			L->height = 1;
+		}
+		L->size = ((L->width+3)/4)*((L->height+3)/4)*block_size;
+		if( offset + L->size > (unsigned int)buffer_length )
 		{
-			/*	we can't do it!	*/
-			result_string_pointer = "Direct upload of S3TC images not supported by the OpenGL driver";
 			return 0;
 		}
-		/*	well, we know it is DXT1/3/5, because we checked above	*/
-		switch( (header.sPixelFormat.dwFourCC >> 24) - '0' )
+		L->data = &buffer[offset];
+		L->compressed = 1;
+		L->borrowed = 1;
+		offset += L->size;
+	}
+	texture->opengl_texture_type = GL_TEXTURE_2D;
+	texture->opengl_texture_target = GL_TEXTURE_2D;
+	texture->base_borrowed = 1;
+	return 1;
+}
+
+unsigned int
+	SOIL_load_OGL_texture_progressive
+	(
+		const char *filename,
+		int force_channels,
+		unsigned int reuse_texture_ID,
+		unsigned int flags
+	)
+{
+	/*	variables	*/
+	SOIL_internal_progressive *progressive;
+	SOIL_internal_texture *texture;
+	size_t level_bytes[SOIL_MAX_LEVELS];
+	unsigned int tex_id;
+	int first_level, level;
+	/*	texture rectangles have no MIPmaps, nothing to stream	*/
+	if( flags & SOIL_FLAG_TEXTURE_RECTANGLE )
+	{
+		return SOIL_load_OGL_texture( filename, force_channels, reuse_texture_ID, flags );
+	}
+	/*	streaming is done one MIPmap level at a time	*/
+	flags |= SOIL_FLAG_MIPMAPS;
+	progressive = (SOIL_internal_progressive*)malloc( sizeof( SOIL_internal_progressive ) );
+	if( NULL == progressive )
+	{
+		result_string_pointer = "malloc failed";
+		return 0;
+	}
+	memset( progressive, 0, sizeof( SOIL_internal_progressive ) );
+	texture = &progressive->texture;
+	/*	a DDS file with MIPmaps already has all the levels	*/
+	if( flags & SOIL_FLAG_DDS_LOAD_DIRECT )
+	{
+		int buffer_length;
+		progressive->DDS_buffer = SOIL_internal_read_file( filename, &buffer_length );
+		if( progressive->DDS_buffer &&
+			!SOIL_internal_progressive_DDS( progressive->DDS_buffer, buffer_length, texture ) )
 		{
-		case 1:
-			S3TC_type = SOIL_RGBA_S3TC_DXT1;
-			block_size = 8;
-			break;
-		case 3:
-			S3TC_type = SOIL_RGBA_S3TC_DXT3;
-			block_size = 16;
-			break;
-		case 5:
-			S3TC_type = SOIL_RGBA_S3TC_DXT5;
-			block_size = 16;
-			break;
+			SOIL_free_image_data( progressive->DDS_buffer );
+			progressive->DDS_buffer = NULL;
 		}
-		DDS_main_size = ((width+3)>>2)*((height+3)>>2)*block_size;
+		texture->flags = flags;
 	}
-	if( cubemap )
+	if( NULL == progressive->DDS_buffer )
 	{
-		/* does the user want a cubemap?	*/
-		if( !loading_as_cubemap )
+		/*	decode it and process the base level, the MIPmaps are made as they are needed	*/
+		SOIL_internal_caps caps;
+		int width, height, channels, prepared;
+		unsigned char *img = SOIL_load_image( filename, &width, &height, &channels, force_channels );
+		if( (force_channels >= 1) && (force_channels <= 4) )
 		{
-			/*	we can't do it!	*/
-			result_string_pointer = "DDS image was a cubemap";
-			return 0;
+			channels = force_channels;
 		}
-		/*	can we even handle cubemaps with the OpenGL driver?	*/
-		if( query_cubemap_capability() != SOIL_CAPABILITY_PRESENT )
+		if( NULL == img )
 		{
-			/*	we can't do it!	*/
-			result_string_pointer = "Direct upload of cubemap images not supported by the OpenGL driver";
+			result_string_pointer = stbi_failure_reason();
+			free( progressive );
 			return 0;
 		}
-		ogl_target_start = SOIL_TEXTURE_CUBE_MAP_POSITIVE_X;
-		ogl_target_end =   SOIL_TEXTURE_CUBE_MAP_NEGATIVE_Z;
-		opengl_texture_type = SOIL_TEXTURE_CUBE_MAP;
-	} else
-	{
-		/* does the user want a non-cubemap?	*/
-		if( loading_as_cubemap )
+		SOIL_internal_query_caps( flags, GL_MAX_TEXTURE_SIZE, &caps );
+		prepared = SOIL_internal_prepare_base(
+				img, width, height, channels, 0, 0, flags,
+				GL_TEXTURE_2D, GL_TEXTURE_2D, &caps, texture );
+		SOIL_free_image_data( img );
+		if( !prepared )
 		{
-			/*	we can't do it!	*/
-			result_string_pointer = "DDS image was not a cubemap";
+			free( progressive );
 			return 0;
 		}
-		ogl_target_start = GL_TEXTURE_2D;
-		ogl_target_end =   GL_TEXTURE_2D;
-		opengl_texture_type = GL_TEXTURE_2D;
 	}
-	if( (header.sCaps.dwCaps1 & DDSCAPS_MIPMAP) && (header.dwMipMapCount > 1) )
+	/*	what each level costs to upload	*/
+	for( level = 0; level < texture->num_levels; ++level )
 	{
-		int shift_offset;
-		mipmaps = header.dwMipMapCount - 1;
-		DDS_full_size = DDS_main_size;
-		if( uncompressed )
+		const SOIL_internal_level *L = &texture->levels[level];
+		if( progressive->DDS_buffer )
 		{
-			/*	uncompressed DDS, simple MIPmap size calculation	*/
-			shift_offset = 0;
+			level_bytes[level] = L->size;
 		} else
 		{
-			/*	compressed DDS, MIPmap size calculation is block based	*/
-			shift_offset = 2;
+			level_bytes[level] = texture_residency_level_bytes(
+					L->width, L->height, texture->channels,
+					texture->compress_to_RGTC ? ((texture->channels == 1) ? 8 : 16) :
+					texture->compress_to_DXT ? ((texture->channels & 1) ? 8 : 16) : 0 );
 		}
-		for( i = 1; i <= mipmaps; ++ i )
+	}
+	/*	the placeholder: the largest level that is still tiny	*/
+	first_level = 0;
+	while( (first_level + 1 < texture->num_levels) &&
+		((texture->levels[first_level].width > SOIL_PROGRESSIVE_PLACEHOLDER_SIZE) ||
+		(texture->levels[first_level].height > SOIL_PROGRESSIVE_PLACEHOLDER_SIZE)) )
+	{
+		++first_level;
+	}
+	/*	start over if this texture ID was streaming already	*/
+	SOIL_internal_progressive_cancel( reuse_texture_ID );
+	tex_id = reuse_texture_ID;
+	if( tex_id == 0 )
+	{
+		glGenTextures( 1, &tex_id );
+	}
+	check_for_GL_errors( "glGenTextures" );
+	if( 0 == tex_id )
+	{
+		result_string_pointer = "Failed to generate an OpenGL texture name; missing OpenGL context?";
+		SOIL_internal_free_progressive( progressive );
+		return 0;
+	}
+	/*	old levels of a reused texture no longer count	*/
+	SOIL_internal_residency_free_source(
+			texture_residency_forget( &SOIL_residency, tex_id ) );
+	/*	upload the placeholder and everything smaller right now	*/
+	glBindTexture( GL_TEXTURE_2D, tex_id );
+	for( level = texture->num_levels - 1; level >= first_level; --level )
+	{
+		if( NULL == progressive->DDS_buffer )
 		{
-			int w, h;
-			w = width >> (shift_offset + i);
-			h = height >> (shift_offset + i);
-			if( w < 1 )
-			{
-				w = 1;
-			}
-			if( h < 1 )
-			{
-				h = 1;
-			}
-			DDS_full_size += w*h*block_size;
+			SOIL_internal_build_level( texture, level );
 		}
-	} else
+		SOIL_internal_upload_level( texture, tex_id, level );
+		if( NULL == progressive->DDS_buffer )
+		{
+			SOIL_internal_free_level( &texture->levels[level] );
+		}
+	}
+	SOIL_internal_set_parameters( texture );
+	/*	only sample from the levels that are there	*/
+	glTexParameteri( GL_TEXTURE_2D, SOIL_TEXTURE_BASE_LEVEL, first_level );
+	glTexParameteri( GL_TEXTURE_2D, SOIL_TEXTURE_MAX_LEVEL, texture->num_levels - 1 );
+	check_for_GL_errors( "GL_TEXTURE_BASE/MAX_LEVEL" );
+	/*	it can always be reloaded in one go from the file	*/
+	SOIL_internal_residency_set_source(
+			tex_id, filename, force_channels, flags,
+			NULL == progressive->DDS_buffer );
+	/*	the rest comes later	*/
+	if( (first_level == 0) ||
+		!texture_stream_add( &SOIL_stream, tex_id, first_level - 1, level_bytes, progressive ) )
+	{
+		if( first_level > 0 )
+		{
+			/*	out of RAM, no streaming then	*/
+			glTexParameteri( GL_TEXTURE_2D, SOIL_TEXTURE_MAX_LEVEL, first_level );
+		}
+		SOIL_internal_free_progressive( progressive );
+	}
+	SOIL_internal_residency_enforce( tex_id );
+	result_string_pointer = "Image loaded as a progressive OpenGL texture";
+	return tex_id;
+}
+
+/*	the streaming callbacks, on the GL thread	*/
+int SOIL_internal_progressive_upload(
+		void *user_data, unsigned int tex_id, int level, void *entry_user_data )
+{
+	SOIL_internal_progressive *progressive = (SOIL_internal_progressive*)entry_user_data;
+	SOIL_internal_texture *texture = &progressive->texture;
+	GLint previous_ID = 0;
+	if( NULL == progressive->DDS_buffer )
+	{
+		SOIL_internal_build_level( texture, level );
+	}
+	/*	don't disturb whatever the user has bound	*/
+	glGetIntegerv( GL_TEXTURE_BINDING_2D, &previous_ID );
+	glBindTexture( GL_TEXTURE_2D, tex_id );
+	SOIL_internal_upload_level( texture, tex_id, level );
+	/*	and start sampling from it	*/
+	glTexParameteri( GL_TEXTURE_2D, SOIL_TEXTURE_BASE_LEVEL, level );
+	glBindTexture( GL_TEXTURE_2D, previous_ID );
+	check_for_GL_errors( "progressive upload" );
+	if( NULL == progressive->DDS_buffer )
+	{
+		SOIL_internal_free_level( &texture->levels[level] );
+	}
+	SOIL_internal_residency_enforce( tex_id );
+	return 1;
+}
+
+void SOIL_internal_progressive_done(
+		void *user_data, unsigned int tex_id, void *entry_user_data )
+{
+	SOIL_internal_free_progressive( (SOIL_internal_progressive*)entry_user_data );
+}
+
+int SOIL_internal_progressive_cancel( unsigned int tex_id )
+{
+	SOIL_internal_progressive *progressive;
+	if( 0 == tex_id )
+	{
+		return 0;
+	}
+	progressive = (SOIL_internal_progressive*)texture_stream_remove( &SOIL_stream, tex_id );
+	SOIL_internal_free_progressive( progressive );
+	return (progressive != NULL);
+}
+
+int
+	SOIL_update_progressive_textures
+	(
+		size_t frame_budget_bytes
+	)
+{
+	texture_stream_actions actions;
+	actions.upload = SOIL_internal_progressive_upload;
+	actions.done = SOIL_internal_progressive_done;
+	actions.user_data = NULL;
+	texture_stream_update( &SOIL_stream, frame_budget_bytes, &actions );
+	return SOIL_stream.num_entries;
+}
+
+double SOIL_internal_time_ms( void )
+{
+#ifdef WIN32
+	LARGE_INTEGER frequency, counter;
+	QueryPerformanceFrequency( &frequency );
+	QueryPerformanceCounter( &counter );
+	return 1000.0 * (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+	struct timeval now;
+	gettimeofday( &now, NULL );
+	return 1000.0 * now.tv_sec + 0.001 * now.tv_usec;
+#endif
+}
+
+void SOIL_internal_residency_free_source( void *source )
+{
+	if( source )
+	{
+		free( ((SOIL_residency_source*)source)->filename );
+		free( source );
+	}
+}
+
+/*	how many bytes of video memory one MIP level of one face takes	*/
+size_t SOIL_internal_residency_level_bytes(
+		unsigned int internal_texture_format,
+		int width, int height )
+{
+	int texel_bytes = 4, block_bytes = 0;
+	switch( internal_texture_format )
+	{
+	case SOIL_RGB_S3TC_DXT1:
+	case SOIL_RGBA_S3TC_DXT1:
+	case SOIL_COMPRESSED_RED_RGTC1:
+		block_bytes = 8;
+		break;
+	case SOIL_RGBA_S3TC_DXT3:
+	case SOIL_RGBA_S3TC_DXT5:
+	case SOIL_COMPRESSED_RG_RGTC2:
+	case SOIL_COMPRESSED_RGBA_BPTC_UNORM:
+	case SOIL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM:
+		block_bytes = 16;
+		break;
+	case GL_LUMINANCE:
+		texel_bytes = 1;
+		break;
+	case GL_LUMINANCE_ALPHA:
+		texel_bytes = 2;
+		break;
+	default:
+		/*	GL_RGB is padded to 4 bytes per texel by most drivers	*/
+		texel_bytes = 4;
+		break;
+	}
+	return texture_residency_level_bytes( width, height, texel_bytes, block_bytes );
+}
+
+void SOIL_internal_residency_note_upload(
+		unsigned int tex_id,
+		unsigned int opengl_texture_target,
+		int level,
+		unsigned int internal_texture_format,
+		int width, int height )
+{
+	int face = 0;
+	if( (opengl_texture_target >= SOIL_TEXTURE_CUBE_MAP_POSITIVE_X) &&
+		(opengl_texture_target <= SOIL_TEXTURE_CUBE_MAP_NEGATIVE_Z) )
 	{
-		mipmaps = 0;
-		DDS_full_size = DDS_main_size;
+		face = opengl_texture_target - SOIL_TEXTURE_CUBE_MAP_POSITIVE_X;
 	}
-	DDS_data = (unsigned char*)malloc( DDS_full_size );
-	/*	got the image data RAM, create or use an existing OpenGL texture handle	*/
-	tex_ID = reuse_texture_ID;
-	if( tex_ID == 0 )
+	texture_residency_note_upload( &SOIL_residency, tex_id, face, level,
+			SOIL_internal_residency_level_bytes( internal_texture_format, width, height ) );
+}
+
+/*	the layers of a texture array level (or the slices of a volume texture
+	level) are counted as one face, depth times as large	*/
+void SOIL_internal_residency_note_upload_layers(
+		unsigned int tex_id,
+		int level,
+		unsigned int internal_texture_format,
+		int width, int height, int depth )
+{
+	texture_residency_note_upload( &SOIL_residency, tex_id, 0, level,
+			depth * SOIL_internal_residency_level_bytes( internal_texture_format, width, height ) );
+}
+
+void SOIL_internal_residency_set_source(
+		unsigned int tex_id,
+		const char *filename,
+		int force_channels,
+		unsigned int flags,
+		int can_drop_levels )
+{
+	texture_residency_entry *entry;
+	SOIL_residency_source *source = NULL;
+	/*	a reload keeps the source it was reloaded from	*/
+	if( SOIL_residency_reloading )
 	{
-		glGenTextures( 1, &tex_ID );
+		return;
 	}
-	/*  bind an OpenGL texture ID	*/
-	glBindTexture( opengl_texture_type, tex_ID );
-	/*	do this for each face of the cubemap!	*/
-	for( cf_target = ogl_target_start; cf_target <= ogl_target_end; ++cf_target )
+	entry = texture_residency_find( &SOIL_residency, tex_id );
+	if( NULL == entry )
 	{
-		if( buffer_index + DDS_full_size <= buffer_length )
+		return;
+	}
+	if( filename )
+	{
+		source = (SOIL_residency_source*)malloc( sizeof( SOIL_residency_source ) );
+		if( source )
 		{
-			unsigned int byte_offset = DDS_main_size;
-			memcpy( (void*)DDS_data, (const void*)(&buffer[buffer_index]), DDS_full_size );
-			buffer_index += DDS_full_size;
-			/*	upload the main chunk	*/
-			if( uncompressed )
+			source->filename = (char*)malloc( strlen( filename ) + 1 );
+			if( source->filename )
 			{
-				/*	and remember, DXT uncompressed uses BGR(A),
-					so swap to RGB(A) for ALL MIPmap levels	*/
-				for( i = 0; i < DDS_full_size; i += block_size )
-				{
-					unsigned char temp = DDS_data[i];
-					DDS_data[i] = DDS_data[i+2];
-					DDS_data[i+2] = temp;
-				}
-				glTexImage2D(
-					cf_target, 0,
-					S3TC_type, width, height, 0,
-					S3TC_type, GL_UNSIGNED_BYTE, DDS_data );
+				strcpy( source->filename, filename );
+				source->force_channels = force_channels;
+				source->flags = flags;
 			} else
 			{
-				soilGlCompressedTexImage2D(
-					cf_target, 0,
-					S3TC_type, width, height, 0,
-					DDS_main_size, DDS_data );
-			}
-			/*	upload the mipmaps, if we have them	*/
-			for( i = 1; i <= mipmaps; ++i )
-			{
-				int w, h, mip_size;
-				w = width >> i;
-				h = height >> i;
-				if( w < 1 )
-				{
-					w = 1;
-				}
-				if( h < 1 )
-				{
-					h = 1;
-				}
-				/*	upload this mipmap	*/
-				if( uncompressed )
-				{
-					mip_size = w*h*block_size;
-					glTexImage2D(
-						cf_target, i,
-						S3TC_type, w, h, 0,
-						S3TC_type, GL_UNSIGNED_BYTE, &DDS_data[byte_offset] );
-				} else
-				{
-					mip_size = ((w+3)/4)*((h+3)/4)*block_size;
-					soilGlCompressedTexImage2D(
-						cf_target, i,
-						S3TC_type, w, h, 0,
-						mip_size, &DDS_data[byte_offset] );
-				}
-				/*	and move to the next mipmap	*/
-				byte_offset += mip_size;
+				free( source );
+				source = NULL;
 			}
-			/*	it worked!	*/
-			result_string_pointer = "DDS file loaded";
-		} else
-		{
-			glDeleteTextures( 1, & tex_ID );
-			tex_ID = 0;
-			cf_target = ogl_target_end + 1;
-			result_string_pointer = "DDS file was too small for expected image data";
-		}
-	}/* end reading each face */
-	SOIL_free_image_data( DDS_data );
-	if( tex_ID )
-	{
-		/*	did I have MIPmaps?	*/
-		if( mipmaps > 0 )
-		{
-			/*	instruct OpenGL to use the MIPmaps	*/
-			glTexParameteri( opengl_texture_type, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
-			glTexParameteri( opengl_texture_type, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR );
-		} else
-		{
-			/*	instruct OpenGL _NOT_ to use the MIPmaps	*/
-			glTexParameteri( opengl_texture_type, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
-			glTexParameteri( opengl_texture_type, GL_TEXTURE_MIN_FILTER, GL_LINEAR );
-		}
-		/*	does the user want clamping, or wrapping?	*/
-		if( flags & SOIL_FLAG_TEXTURE_REPEATS )
-		{
-			glTexParameteri( opengl_texture_type, GL_TEXTURE_WRAP_S, GL_REPEAT );
-			glTexParameteri( opengl_texture_type, GL_TEXTURE_WRAP_T, GL_REPEAT );
-			glTexParameteri( opengl_texture_type, SOIL_TEXTURE_WRAP_R, GL_REPEAT );
-		} else
-		{
-			/*	unsigned int clamp_mode = SOIL_CLAMP_TO_EDGE;	*/
-			unsigned int clamp_mode = GL_CLAMP;
-			glTexParameteri( opengl_texture_type, GL_TEXTURE_WRAP_S, clamp_mode );
-			glTexParameteri( opengl_texture_type, GL_TEXTURE_WRAP_T, clamp_mode );
-			glTexParameteri( opengl_texture_type, SOIL_TEXTURE_WRAP_R, clamp_mode );
 		}
 	}
+	SOIL_internal_residency_free_source( entry->user_data );
+	entry->user_data = source;
+	entry->reloadable = (source != NULL);
+	entry->can_drop_levels = (source != NULL) && can_drop_levels;
+	entry->dropped_levels = 0;
+}
 
-quick_exit:
-	/*	report success or failure	*/
-	return tex_ID;
+unsigned int SOIL_internal_residency_texture_type(
+		const SOIL_residency_source *source,
+		unsigned int *binding_enum )
+{
+	if( (source->flags & SOIL_FLAG_TEXTURE_RECTANGLE) &&
+		(query_tex_rectangle_capability() == SOIL_CAPABILITY_PRESENT) )
+	{
+		*binding_enum = SOIL_TEXTURE_BINDING_RECTANGLE_ARB;
+		return SOIL_TEXTURE_RECTANGLE_ARB;
+	}
+	*binding_enum = GL_TEXTURE_BINDING_2D;
+	return GL_TEXTURE_2D;
 }
 
-unsigned int SOIL_direct_load_DDS(
-		const char *filename,
-		unsigned int reuse_texture_ID,
-		int flags,
-		int loading_as_cubemap )
+int SOIL_internal_residency_reload( unsigned int tex_id, int dropped_levels )
 {
-	FILE *f;
-	unsigned char *buffer;
-	size_t buffer_length, bytes_read;
-	unsigned int tex_ID = 0;
-	/*	error checks	*/
-	if( NULL == filename )
+	texture_residency_entry *entry = texture_residency_find( &SOIL_residency, tex_id );
+	SOIL_residency_source *source;
+	unsigned int texture_type, binding_enum;
+	GLint previous_ID = 0;
+	unsigned int reloaded_ID;
+	if( (NULL == entry) || (NULL == entry->user_data) )
 	{
-		result_string_pointer = "NULL filename";
 		return 0;
 	}
-	f = fopen( filename, "rb" );
-	if( NULL == f )
+	source = (SOIL_residency_source*)entry->user_data;
+	/*	don't disturb whatever the user has bound	*/
+	texture_type = SOIL_internal_residency_texture_type( source, &binding_enum );
+	glGetIntegerv( binding_enum, &previous_ID );
+	/*	it all comes back in one go, no need to keep streaming it	*/
+	SOIL_internal_progressive_cancel( tex_id );
+	SOIL_residency_reloading = 1;
+	SOIL_residency_reload_drop_levels = dropped_levels;
+	reloaded_ID = SOIL_load_OGL_texture(
+			source->filename, source->force_channels,
+			tex_id, source->flags );
+	SOIL_residency_reload_drop_levels = 0;
+	SOIL_residency_reloading = 0;
+	if( reloaded_ID && (texture_type == GL_TEXTURE_2D) )
 	{
-		/*	the file doesn't seem to exist (or be open-able)	*/
-		result_string_pointer = "Can not find DDS file";
-		return 0;
+		/*	it may have been streamed in or evicted before, sample from
+			all its levels again (1000 is the OpenGL default)	*/
+		glTexParameteri( GL_TEXTURE_2D, SOIL_TEXTURE_BASE_LEVEL, 0 );
+		glTexParameteri( GL_TEXTURE_2D, SOIL_TEXTURE_MAX_LEVEL, 1000 );
 	}
-	fseek( f, 0, SEEK_END );
-	buffer_length = ftell( f );
-	fseek( f, 0, SEEK_SET );
-	buffer = (unsigned char *) malloc( buffer_length );
-	if( NULL == buffer )
+	glBindTexture( texture_type, previous_ID );
+	return (reloaded_ID != 0);
+}
+
+int SOIL_internal_residency_evict( void *user_data, unsigned int tex_id )
+{
+	static const unsigned char texel[4] = { 128, 128, 128, 255 };
+	texture_residency_entry *entry = texture_residency_find( &SOIL_residency, tex_id );
+	unsigned int texture_type, binding_enum;
+	GLint previous_ID = 0;
+	int level;
+	if( (NULL == entry) || (NULL == entry->user_data) )
 	{
-		result_string_pointer = "malloc failed";
-		fclose( f );
 		return 0;
 	}
-	bytes_read = fread( (void*)buffer, 1, buffer_length, f );
-	fclose( f );
-	if( bytes_read < buffer_length )
+	/*	replace the storage with a single texel, the ID stays valid	*/
+	texture_type = SOIL_internal_residency_texture_type(
+			(const SOIL_residency_source*)entry->user_data, &binding_enum );
+	glGetIntegerv( binding_enum, &previous_ID );
+	glBindTexture( texture_type, tex_id );
+	glTexImage2D(
+		texture_type, 0,
+		GL_RGBA, 1, 1, 0,
+		GL_RGBA, GL_UNSIGNED_BYTE, texel );
+	/*	and free every MIPmap level that was uploaded	*/
+	for( level = 1; level < entry->num_levels; ++level )
 	{
-		/*	huh?	*/
-		buffer_length = bytes_read;
+		if( entry->level_bytes[level] )
+		{
+			glTexImage2D(
+				texture_type, level,
+				GL_RGBA, 0, 0, 0,
+				GL_RGBA, GL_UNSIGNED_BYTE, NULL );
+		}
 	}
-	/*	now try to do the loading	*/
-	tex_ID = SOIL_direct_load_DDS_from_memory(
-		(const unsigned char *const)buffer, buffer_length,
-		reuse_texture_ID, flags, loading_as_cubemap );
-	SOIL_free_image_data( buffer );
-	return tex_ID;
+	/*	there are no MIPmaps any more	*/
+	glTexParameteri( texture_type, SOIL_TEXTURE_MAX_LEVEL, 0 );
+	glTexParameteri( texture_type, GL_TEXTURE_MIN_FILTER, GL_LINEAR );
+	if( SOIL_internal_progressive_cancel( tex_id ) )
+	{
+		/*	it was still streaming in, and sampling from a smaller level	*/
+		glTexParameteri( texture_type, SOIL_TEXTURE_BASE_LEVEL, 0 );
+	}
+	glBindTexture( texture_type, previous_ID );
+	check_for_GL_errors( "residency eviction" );
+	return 1;
 }
 
-int query_NPOT_capability( void )
+int SOIL_internal_residency_drop_levels( void *user_data, unsigned int tex_id, int dropped_levels )
 {
-	/*	check for the capability	*/
-	if( has_NPOT_capability == SOIL_CAPABILITY_UNKNOWN )
+	return SOIL_internal_residency_reload( tex_id, dropped_levels );
+}
+
+void SOIL_internal_residency_enforce( unsigned int tex_id )
+{
+	texture_residency_actions actions;
+	actions.evict = SOIL_internal_residency_evict;
+	actions.drop_levels = SOIL_internal_residency_drop_levels;
+	actions.user_data = NULL;
+	texture_residency_enforce( &SOIL_residency, tex_id, &actions );
+}
+
+void
+	SOIL_residency_set_budget
+	(
+		size_t budget_bytes,
+		int policy
+	)
+{
+	SOIL_residency.budget_bytes = budget_bytes;
+	if( policy == SOIL_RESIDENCY_DROP_MIPS_LRU )
 	{
-		/*	we haven't yet checked for the capability, do so	*/
-		if(
-			(NULL == strstr( (char const*)glGetString( GL_EXTENSIONS ),
-				"GL_ARB_texture_non_power_of_two" ) )
-			)
-		{
-			/*	not there, flag the failure	*/
-			has_NPOT_capability = SOIL_CAPABILITY_NONE;
-		} else
-		{
-			/*	it's there!	*/
-			has_NPOT_capability = SOIL_CAPABILITY_PRESENT;
-		}
+		SOIL_residency.policy = TEXTURE_RESIDENCY_DROP_MIPS;
+	} else
+	{
+		SOIL_residency.policy = TEXTURE_RESIDENCY_EVICT;
 	}
-	/*	let the user know if we can do non-power-of-two textures or not	*/
-	return has_NPOT_capability;
+	SOIL_internal_residency_enforce( 0 );
 }
 
-int query_tex_rectangle_capability( void )
+int
+	SOIL_residency_touch
+	(
+		unsigned int texture_ID
+	)
 {
-	/*	check for the capability	*/
-	if( has_tex_rectangle_capability == SOIL_CAPABILITY_UNKNOWN )
+	texture_residency_entry *entry = texture_residency_touch( &SOIL_residency, texture_ID );
+	double start_ms;
+	if( (NULL == entry) || !entry->reloadable ||
+		(!entry->evicted && (entry->dropped_levels == 0)) )
 	{
-		/*	we haven't yet checked for the capability, do so	*/
-		if(
-			(NULL == strstr( (char const*)glGetString( GL_EXTENSIONS ),
-				"GL_ARB_texture_rectangle" ) )
-		&&
-			(NULL == strstr( (char const*)glGetString( GL_EXTENSIONS ),
-				"GL_EXT_texture_rectangle" ) )
-		&&
-			(NULL == strstr( (char const*)glGetString( GL_EXTENSIONS ),
-				"GL_NV_texture_rectangle" ) )
-			)
-		{
-			/*	not there, flag the failure	*/
-			has_tex_rectangle_capability = SOIL_CAPABILITY_NONE;
-		} else
-		{
-			/*	it's there!	*/
-			has_tex_rectangle_capability = SOIL_CAPABILITY_PRESENT;
-		}
+		/*	nothing to bring back	*/
+		return 0;
 	}
-	/*	let the user know if we can do texture rectangles or not	*/
-	return has_tex_rectangle_capability;
+	start_ms = SOIL_internal_time_ms();
+	if( !SOIL_internal_residency_reload( texture_ID, 0 ) )
+	{
+		return 0;
+	}
+	texture_residency_note_reload( &SOIL_residency, SOIL_internal_time_ms() - start_ms );
+	entry = texture_residency_find( &SOIL_residency, texture_ID );
+	if( entry )
+	{
+		entry->dropped_levels = 0;
+	}
+	/*	this may push something else out	*/
+	SOIL_internal_residency_enforce( texture_ID );
+	return 1;
 }
 
-int query_cubemap_capability( void )
+void
+	SOIL_residency_forget
+	(
+		unsigned int texture_ID
+	)
 {
-	/*	check for the capability	*/
-	if( has_cubemap_capability == SOIL_CAPABILITY_UNKNOWN )
+	SOIL_internal_progressive_cancel( texture_ID );
+	SOIL_internal_residency_free_source(
+			texture_residency_forget( &SOIL_residency, texture_ID ) );
+}
+
+void
+	SOIL_residency_get_stats
+	(
+		SOIL_residency_stats *stats
+	)
+{
+	int i;
+	if( NULL == stats )
 	{
-		/*	we haven't yet checked for the capability, do so	*/
-		if(
-			(NULL == strstr( (char const*)glGetString( GL_EXTENSIONS ),
-				"GL_ARB_texture_cube_map" ) )
-		&&
-			(NULL == strstr( (char const*)glGetString( GL_EXTENSIONS ),
-				"GL_EXT_texture_cube_map" ) )
-			)
-		{
-			/*	not there, flag the failure	*/
-			has_cubemap_capability = SOIL_CAPABILITY_NONE;
-		} else
+		return;
+	}
+	stats->resident_bytes = SOIL_residency.resident_bytes;
+	stats->peak_resident_bytes = SOIL_residency.peak_resident_bytes;
+	stats->budget_bytes = SOIL_residency.budget_bytes;
+	stats->textures = SOIL_residency.num_entries;
+	stats->evicted_textures = 0;
+	for( i = 0; i < SOIL_residency.num_entries; ++i )
+	{
+		if( SOIL_residency.entries[i].evicted )
 		{
-			/*	it's there!	*/
-			has_cubemap_capability = SOIL_CAPABILITY_PRESENT;
+			++stats->evicted_textures;
 		}
 	}
-	/*	let the user know if we can do cubemaps or not	*/
-	return has_cubemap_capability;
+	stats->evictions = SOIL_residency.evictions;
+	stats->mip_drops = SOIL_residency.mip_drops;
+	stats->reloads = SOIL_residency.reloads;
+	stats->reload_ms_total = SOIL_residency.reload_ms_total;
+	stats->reload_ms_max = SOIL_residency.reload_ms_max;
 }
 
-int query_DXT_capability( void )
+size_t
+	SOIL_residency_texture_bytes
+	(
+		unsigned int texture_ID
+	)
 {
-	/*	check for the capability	*/
-	if( has_DXT_capability == SOIL_CAPABILITY_UNKNOWN )
+	texture_residency_entry *entry = texture_residency_find( &SOIL_residency, texture_ID );
+	if( NULL == entry )
 	{
-		/*	we haven't yet checked for the capability, do so	*/
-		if( NULL == strstr(
-				(char const*)glGetString( GL_EXTENSIONS ),
-				"GL_EXT_texture_compression_s3tc" ) )
-		{
-			/*	not there, flag the failure	*/
-			has_DXT_capability = SOIL_CAPABILITY_NONE;
-		} else
-		{
-			/*	and find the address of the extension function	*/
-			P_SOIL_GLCOMPRESSEDTEXIMAGE2DPROC ext_addr = NULL;
-			#ifdef WIN32
-				ext_addr = (P_SOIL_GLCOMPRESSEDTEXIMAGE2DPROC)
-						wglGetProcAddress
-						(
-							"glCompressedTexImage2DARB"
-						);
-			#elif defined(__APPLE__) || defined(__APPLE_CC__)
-				/*	I can't test this Apple stuff!	*/
-				CFBundleRef bundle;
-				CFURLRef bundleURL =
-					CFURLCreateWithFileSystemPath(
-						kCFAllocatorDefault,
-						CFSTR("/System/Library/Frameworks/OpenGL.framework"),
-						kCFURLPOSIXPathStyle,
-						true );
-				CFStringRef extensionName =
-					CFStringCreateWithCString(
-						kCFAllocatorDefault,
-						"glCompressedTexImage2DARB",
-						kCFStringEncodingASCII );
-				bundle = CFBundleCreate( kCFAllocatorDefault, bundleURL );
-				assert( bundle != NULL );
-				ext_addr = (P_SOIL_GLCOMPRESSEDTEXIMAGE2DPROC)
-						CFBundleGetFunctionPointerForName
-						(
-							bundle, extensionName
-						);
-				CFRelease( bundleURL );
-				CFRelease( extensionName );
-				CFRelease( bundle );
-			#else
-				ext_addr = (P_SOIL_GLCOMPRESSEDTEXIMAGE2DPROC)
-						glXGetProcAddressARB
-						(
-							(const GLubyte *)"glCompressedTexImage2DARB"
-						);
-			#endif
-			/*	Flag it so no checks needed later	*/
-			if( NULL == ext_addr )
-			{
-				/*	hmm, not good!!  This should not happen, but does on my
-					laptop's VIA chipset.  The GL_EXT_texture_compression_s3tc
-					spec requires that ARB_texture_compression be present too.
-					this means I can upload and have the OpenGL drive do the
-					conversion, but I can't use my own routines or load DDS files
-					from disk and upload them directly [8^(	*/
-				has_DXT_capability = SOIL_CAPABILITY_NONE;
-			} else
-			{
-				/*	all's well!	*/
-				soilGlCompressedTexImage2D = ext_addr;
-				has_DXT_capability = SOIL_CAPABILITY_PRESENT;
-			}
-		}
+		return 0;
 	}
-	/*	let the user know if we can do DXT or not	*/
-	return has_DXT_capability;
+	return entry->resident_bytes;
 }
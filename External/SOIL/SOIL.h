@@ -40,6 +40,8 @@
 #ifndef HEADER_SIMPLE_OPENGL_IMAGE_LIBRARY
 #define HEADER_SIMPLE_OPENGL_IMAGE_LIBRARY
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -86,11 +88,15 @@ enum
 	SOIL_FLAG_TEXTURE_REPEATS: otherwise will clamp
 	SOIL_FLAG_MULTIPLY_ALPHA: for using (GL_ONE,GL_ONE_MINUS_SRC_ALPHA) blending
 	SOIL_FLAG_INVERT_Y: flip the image vertically
-	SOIL_FLAG_COMPRESS_TO_DXT: if the card can display them, will convert RGB to DXT1, RGBA to DXT5
-	SOIL_FLAG_DDS_LOAD_DIRECT: will load DDS files directly without _ANY_ additional processing
+	SOIL_FLAG_COMPRESS_TO_DXT: if the card can display them, will convert RGB to DXT1, RGBA to DXT5 (a DXT1/3/5 DDS file keeps its own blocks, unless another flag needs the pixels)
+	SOIL_FLAG_DDS_LOAD_DIRECT: will load DDS (and KTX2) files directly without _ANY_ additional processing
 	SOIL_FLAG_NTSC_SAFE_RGB: clamps RGB components to the range [16,235]
 	SOIL_FLAG_CoCg_Y: Google YCoCg; RGB=>CoYCg, RGBA=>CoCgAY
 	SOIL_FLAG_TEXTURE_RECTANGE: uses ARB_texture_rectangle ; pixel indexed & no repeat or MIPmaps or cubemaps
+	SOIL_FLAG_COMPLETION_ORDER: SOIL_load_OGL_textures() uploads each texture as soon as it is decoded, instead of in the order given
+	SOIL_FLAG_COMPRESS_TO_RGTC: if the card can display them, will convert 1 channel to BC4 (red), the rest to BC5 (red & green, e.g. the X & Y of a normal map)
+	SOIL_FLAG_DXT_FAST: with SOIL_FLAG_COMPRESS_TO_DXT, trades quality for speed (bounding box end points)
+	SOIL_FLAG_DXT_HIGH_QUALITY: with SOIL_FLAG_COMPRESS_TO_DXT, trades speed for quality (cluster fit, for baking)
 **/
 enum
 {
@@ -103,7 +109,22 @@ enum
 	SOIL_FLAG_DDS_LOAD_DIRECT = 64,
 	SOIL_FLAG_NTSC_SAFE_RGB = 128,
 	SOIL_FLAG_CoCg_Y = 256,
-	SOIL_FLAG_TEXTURE_RECTANGLE = 512
+	SOIL_FLAG_TEXTURE_RECTANGLE = 512,
+	SOIL_FLAG_COMPLETION_ORDER = 1024,
+	SOIL_FLAG_COMPRESS_TO_RGTC = 2048,
+	SOIL_FLAG_DXT_FAST = 4096,
+	SOIL_FLAG_DXT_HIGH_QUALITY = 8192
+};
+
+/**
+	The DXT compression quality, for SOIL_save_image_quality.
+	(FAST is several times faster than DEFAULT, HIGH several times slower)
+**/
+enum
+{
+	SOIL_DXT_QUALITY_FAST = 0,
+	SOIL_DXT_QUALITY_DEFAULT = 1,
+	SOIL_DXT_QUALITY_HIGH = 2
 };
 
 /**
@@ -111,12 +132,21 @@ enum
 	(TGA supports uncompressed RGB / RGBA)
 	(BMP supports uncompressed RGB)
 	(DDS supports DXT1 and DXT5)
+	(DDS_RGTC supports BC4 for 1 channel, BC5 for the first 2 channels)
+	(DDS_BC7 supports RGBA, in a DDS with the DX10 header; with
+	SOIL_save_image_quality, SOIL_DXT_QUALITY_HIGH picks the slow preset)
+	(KTX2, KTX2_RGTC and KTX2_BC7 are the same in a KTX2 file)
 **/
 enum
 {
 	SOIL_SAVE_TYPE_TGA = 0,
 	SOIL_SAVE_TYPE_BMP = 1,
-	SOIL_SAVE_TYPE_DDS = 2
+	SOIL_SAVE_TYPE_DDS = 2,
+	SOIL_SAVE_TYPE_DDS_RGTC = 3,
+	SOIL_SAVE_TYPE_DDS_BC7 = 4,
+	SOIL_SAVE_TYPE_KTX2 = 5,
+	SOIL_SAVE_TYPE_KTX2_RGTC = 6,
+	SOIL_SAVE_TYPE_KTX2_BC7 = 7
 };
 
 /**
@@ -141,12 +171,59 @@ enum
 	SOIL_HDR_RGBdivA2 = 2
 };
 
+/**
+	Where the time went while loading one texture with
+	SOIL_load_OGL_textures(), in milliseconds.
+	read_ms: reading the file
+	decode_ms: decoding, plus any resampling, MIPmapping and DXT compression
+	upload_ms: creating the OpenGL texture (on the calling thread)
+**/
+typedef struct
+{
+	double read_ms;
+	double decode_ms;
+	double upload_ms;
+}
+SOIL_load_timing;
+
+/**
+	What the texture residency manager does once the texture
+	memory budget is exceeded (see SOIL_residency_set_budget).
+
+	SOIL_RESIDENCY_EVICT_LRU: evict the least recently used textures
+	SOIL_RESIDENCY_DROP_MIPS_LRU: first drop the top MIP level of the least
+		recently used MIPmapped textures, then evict if that is not enough
+**/
+enum
+{
+	SOIL_RESIDENCY_EVICT_LRU = 0,
+	SOIL_RESIDENCY_DROP_MIPS_LRU = 1
+};
+
+/**
+	Statistics of the texture residency manager.
+**/
+typedef struct
+{
+	size_t resident_bytes;
+	size_t peak_resident_bytes;
+	size_t budget_bytes;
+	int textures;
+	int evicted_textures;
+	unsigned long evictions;
+	unsigned long mip_drops;
+	unsigned long reloads;
+	double reload_ms_total;
+	double reload_ms_max;
+}
+SOIL_residency_stats;
+
 /**
 	Loads an image from disk into an OpenGL texture.
 	\param filename the name of the file to upload as a texture
 	\param force_channels 0-image format, 1-luminous, 2-luminous/alpha, 3-RGB, 4-RGBA
 	\param reuse_texture_ID 0-generate a new texture ID, otherwise reuse the texture ID (overwriting the old texture)
-	\param flags can be any of SOIL_FLAG_POWER_OF_TWO | SOIL_FLAG_MIPMAPS | SOIL_FLAG_TEXTURE_REPEATS | SOIL_FLAG_MULTIPLY_ALPHA | SOIL_FLAG_INVERT_Y | SOIL_FLAG_COMPRESS_TO_DXT | SOIL_FLAG_DDS_LOAD_DIRECT
+	\param flags can be any of SOIL_FLAG_POWER_OF_TWO | SOIL_FLAG_MIPMAPS | SOIL_FLAG_TEXTURE_REPEATS | SOIL_FLAG_MULTIPLY_ALPHA | SOIL_FLAG_INVERT_Y | SOIL_FLAG_COMPRESS_TO_DXT | SOIL_FLAG_COMPRESS_TO_RGTC | SOIL_FLAG_DDS_LOAD_DIRECT
 	\return 0-failed, otherwise returns the OpenGL texture handle
 **/
 unsigned int
@@ -158,6 +235,143 @@ unsigned int
 		unsigned int flags
 	);
 
+/**
+	Loads a batch of images from disk into new OpenGL textures.
+	The files are read and decoded (and resampled, MIPmapped and DXT
+	compressed, as the flags ask) on one thread per core, the textures are
+	uploaded on the calling thread, which must own the OpenGL context.
+	\param filenames the names of the files to upload as textures
+	\param count the number of files
+	\param force_channels 0-image format, 1-luminous, 2-luminous/alpha, 3-RGB, 4-RGBA
+	\param flags can be any of SOIL_FLAG_POWER_OF_TWO | SOIL_FLAG_MIPMAPS | SOIL_FLAG_TEXTURE_REPEATS | SOIL_FLAG_MULTIPLY_ALPHA | SOIL_FLAG_INVERT_Y | SOIL_FLAG_COMPRESS_TO_DXT | SOIL_FLAG_COMPRESS_TO_RGTC | SOIL_FLAG_DDS_LOAD_DIRECT | SOIL_FLAG_COMPLETION_ORDER
+	\param texture_IDs receives count OpenGL texture handles, 0 for each file that failed
+	\param timings NULL, or receives count timings, to find the slow files
+	\return the number of textures that were loaded
+**/
+int
+	SOIL_load_OGL_textures
+	(
+		const char *const *filenames,
+		int count,
+		int force_channels,
+		unsigned int flags,
+		unsigned int *texture_IDs,
+		SOIL_load_timing *timings
+	);
+
+/**
+	The largest MIP level (in texels, each way) that
+	SOIL_load_OGL_texture_progressive() uploads right away.
+**/
+#define SOIL_PROGRESSIVE_PLACEHOLDER_SIZE 64
+
+/**
+	Loads an image from disk into an OpenGL texture that streams in
+	over several frames: the MIPmaps up to SOIL_PROGRESSIVE_PLACEHOLDER_SIZE
+	are uploaded right away so the texture can be drawn with at once,
+	the larger levels follow one at a time from
+	SOIL_update_progressive_textures(), coarse to fine.
+	Needs GL_TEXTURE_BASE_LEVEL (OpenGL 1.2).  SOIL_FLAG_MIPMAPS is
+	implied; texture rectangles are loaded in one go.
+	\param filename the name of the file to upload as a texture
+	\param force_channels 0-image format, 1-luminous, 2-luminous/alpha, 3-RGB, 4-RGBA
+	\param reuse_texture_ID 0-generate a new texture ID, otherwise reuse the texture ID (overwriting the old texture)
+	\param flags can be any of SOIL_FLAG_POWER_OF_TWO | SOIL_FLAG_TEXTURE_REPEATS | SOIL_FLAG_MULTIPLY_ALPHA | SOIL_FLAG_INVERT_Y | SOIL_FLAG_COMPRESS_TO_DXT | SOIL_FLAG_COMPRESS_TO_RGTC | SOIL_FLAG_DDS_LOAD_DIRECT
+	\return 0-failed, otherwise returns the OpenGL texture handle
+**/
+unsigned int
+	SOIL_load_OGL_texture_progressive
+	(
+		const char *filename,
+		int force_channels,
+		unsigned int reuse_texture_ID,
+		unsigned int flags
+	);
+
+/**
+	Uploads the next MIP levels of the textures loaded with
+	SOIL_load_OGL_texture_progressive(); call once per frame.
+	Every texture gets one level per pass so they all sharpen
+	up together.  At least one level is uploaded per call.
+	\param frame_budget_bytes how many bytes to upload at most, 0 for no limit
+	\return the number of textures that are still streaming in
+**/
+int
+	SOIL_update_progressive_textures
+	(
+		size_t frame_budget_bytes
+	);
+
+/**
+	The page size SOIL_load_OGL_atlas() uses when given 0.
+**/
+#define SOIL_ATLAS_DEFAULT_PAGE_SIZE 1024
+
+/**
+	Where one image of an atlas went.  (u0,v0) is the texture
+	coordinate of the top left corner of the image (as it is stored
+	in the file), (u1,v1) the bottom right one; x, y, width and height
+	are the same in texels.  texture_ID is 0 (and page -1) if the image
+	could not be loaded or does not fit on a page.
+**/
+typedef struct
+{
+	unsigned int texture_ID;
+	int page;
+	float u0, v0, u1, v1;
+	int x, y, width, height;
+}
+SOIL_atlas_rect;
+
+/**
+	How well the atlas was packed, and where the time went.
+	efficiency is the part of the pages covered by images (0 to 1).
+**/
+typedef struct
+{
+	int num_pages;
+	int page_size;
+	double efficiency;
+	double decode_ms;
+	double pack_ms;
+	double compress_ms;
+	double upload_ms;
+}
+SOIL_atlas_stats;
+
+/**
+	Loads many small images from disk and packs them into as few
+	square OpenGL textures (pages) as possible, so they can all be
+	drawn without switching textures.  The images are decoded in
+	parallel, and the pages are put together (and DXT compressed) in
+	parallel.  Every image is surrounded by padding texels copied from
+	its edges, so filtering doesn't bleed in the neighbouring images;
+	with SOIL_FLAG_MIPMAPS use a padding of at least 2^levels for the
+	levels that should stay clean.  With SOIL_FLAG_COMPRESS_TO_DXT (or _RGTC) no
+	DXT block is shared by two images.
+	\param filenames the names of the image files
+	\param count the number of files
+	\param force_channels 0-RGBA, 1-luminous, 2-luminous/alpha, 3-RGB, 4-RGBA
+	\param page_size the width and height of the pages, 0 for SOIL_ATLAS_DEFAULT_PAGE_SIZE
+	\param padding the number of texels around every image
+	\param flags can be any of SOIL_FLAG_POWER_OF_TWO | SOIL_FLAG_MIPMAPS | SOIL_FLAG_TEXTURE_REPEATS | SOIL_FLAG_MULTIPLY_ALPHA | SOIL_FLAG_INVERT_Y | SOIL_FLAG_COMPRESS_TO_DXT | SOIL_FLAG_COMPRESS_TO_RGTC
+	\param rects receives count rectangles, one for every file
+	\param stats NULL, or receives the packing efficiency and timings
+	\return the number of images that were packed
+**/
+int
+	SOIL_load_OGL_atlas
+	(
+		const char *const *filenames,
+		int count,
+		int force_channels,
+		int page_size,
+		int padding,
+		unsigned int flags,
+		SOIL_atlas_rect *rects,
+		SOIL_atlas_stats *stats
+	);
+
 /**
 	Loads 6 images from disk into an OpenGL cubemap texture.
 	\param x_pos_file the name of the file to upload as the +x cube face
@@ -168,7 +382,7 @@ unsigned int
 	\param z_neg_file the name of the file to upload as the -z cube face
 	\param force_channels 0-image format, 1-luminous, 2-luminous/alpha, 3-RGB, 4-RGBA
 	\param reuse_texture_ID 0-generate a new texture ID, otherwise reuse the texture ID (overwriting the old texture)
-	\param flags can be any of SOIL_FLAG_POWER_OF_TWO | SOIL_FLAG_MIPMAPS | SOIL_FLAG_TEXTURE_REPEATS | SOIL_FLAG_MULTIPLY_ALPHA | SOIL_FLAG_INVERT_Y | SOIL_FLAG_COMPRESS_TO_DXT | SOIL_FLAG_DDS_LOAD_DIRECT
+	\param flags can be any of SOIL_FLAG_POWER_OF_TWO | SOIL_FLAG_MIPMAPS | SOIL_FLAG_TEXTURE_REPEATS | SOIL_FLAG_MULTIPLY_ALPHA | SOIL_FLAG_INVERT_Y | SOIL_FLAG_COMPRESS_TO_DXT | SOIL_FLAG_COMPRESS_TO_RGTC | SOIL_FLAG_DDS_LOAD_DIRECT
 	\return 0-failed, otherwise returns the OpenGL texture handle
 **/
 unsigned int
@@ -191,7 +405,7 @@ unsigned int
 	\param face_order the order of the faces in the file, any combination of NSWEUD, for North, South, Up, etc.
 	\param force_channels 0-image format, 1-luminous, 2-luminous/alpha, 3-RGB, 4-RGBA
 	\param reuse_texture_ID 0-generate a new texture ID, otherwise reuse the texture ID (overwriting the old texture)
-	\param flags can be any of SOIL_FLAG_POWER_OF_TWO | SOIL_FLAG_MIPMAPS | SOIL_FLAG_TEXTURE_REPEATS | SOIL_FLAG_MULTIPLY_ALPHA | SOIL_FLAG_INVERT_Y | SOIL_FLAG_COMPRESS_TO_DXT | SOIL_FLAG_DDS_LOAD_DIRECT
+	\param flags can be any of SOIL_FLAG_POWER_OF_TWO | SOIL_FLAG_MIPMAPS | SOIL_FLAG_TEXTURE_REPEATS | SOIL_FLAG_MULTIPLY_ALPHA | SOIL_FLAG_INVERT_Y | SOIL_FLAG_COMPRESS_TO_DXT | SOIL_FLAG_COMPRESS_TO_RGTC | SOIL_FLAG_DDS_LOAD_DIRECT
 	\return 0-failed, otherwise returns the OpenGL texture handle
 **/
 unsigned int
@@ -204,12 +418,55 @@ unsigned int
 		unsigned int flags
 	);
 
+/**
+	Loads images from disk into the layers of an OpenGL 2D texture array
+	(GL_TEXTURE_2D_ARRAY, OpenGL 3.0 or GL_EXT_texture_array), so they
+	can all be used with a single texture bind.  The images are decoded,
+	MIPmapped and compressed in parallel, then each level of the whole
+	array is uploaded with a single call.  Every layer has to end up the
+	same size and format (use force_channels if the files differ in
+	channels).  With SOIL_FLAG_DDS_LOAD_DIRECT a single KTX2 file holding
+	an array is uploaded just as it is.
+	\param filenames the names of the files to upload as the layers, in order
+	\param num_layers the number of files
+	\param force_channels 0-image format, 1-luminous, 2-luminous/alpha, 3-RGB, 4-RGBA
+	\param reuse_texture_ID 0-generate a new texture ID, otherwise reuse the texture ID (overwriting the old texture)
+	\param flags can be any of SOIL_FLAG_POWER_OF_TWO | SOIL_FLAG_MIPMAPS | SOIL_FLAG_TEXTURE_REPEATS | SOIL_FLAG_MULTIPLY_ALPHA | SOIL_FLAG_INVERT_Y | SOIL_FLAG_COMPRESS_TO_DXT | SOIL_FLAG_COMPRESS_TO_RGTC | SOIL_FLAG_DDS_LOAD_DIRECT
+	\return 0-failed, otherwise returns the OpenGL texture handle
+**/
+unsigned int
+	SOIL_load_OGL_texture_array
+	(
+		const char *const *filenames,
+		int num_layers,
+		int force_channels,
+		unsigned int reuse_texture_ID,
+		unsigned int flags
+	);
+
+/**
+	Loads a volume DDS file (or a 3D KTX2 file) from disk into an OpenGL
+	3D texture (GL_TEXTURE_3D), with all the MIPmaps in the file.  The
+	data is uploaded directly, as with SOIL_FLAG_DDS_LOAD_DIRECT.
+	\param filename the name of the file to upload as a texture
+	\param reuse_texture_ID 0-generate a new texture ID, otherwise reuse the texture ID (overwriting the old texture)
+	\param flags can be SOIL_FLAG_TEXTURE_REPEATS
+	\return 0-failed, otherwise returns the OpenGL texture handle
+**/
+unsigned int
+	SOIL_load_OGL_texture_volume
+	(
+		const char *filename,
+		unsigned int reuse_texture_ID,
+		unsigned int flags
+	);
+
 /**
 	Loads an HDR image from disk into an OpenGL texture.
 	\param filename the name of the file to upload as a texture
 	\param fake_HDR_format SOIL_HDR_RGBE, SOIL_HDR_RGBdivA, SOIL_HDR_RGBdivA2
 	\param reuse_texture_ID 0-generate a new texture ID, otherwise reuse the texture ID (overwriting the old texture)
-	\param flags can be any of SOIL_FLAG_POWER_OF_TWO | SOIL_FLAG_MIPMAPS | SOIL_FLAG_TEXTURE_REPEATS | SOIL_FLAG_MULTIPLY_ALPHA | SOIL_FLAG_INVERT_Y | SOIL_FLAG_COMPRESS_TO_DXT
+	\param flags can be any of SOIL_FLAG_POWER_OF_TWO | SOIL_FLAG_MIPMAPS | SOIL_FLAG_TEXTURE_REPEATS | SOIL_FLAG_MULTIPLY_ALPHA | SOIL_FLAG_INVERT_Y | SOIL_FLAG_COMPRESS_TO_DXT | SOIL_FLAG_COMPRESS_TO_RGTC
 	\return 0-failed, otherwise returns the OpenGL texture handle
 **/
 unsigned int
@@ -228,7 +485,7 @@ unsigned int
 	\param buffer_length the size of the buffer in bytes
 	\param force_channels 0-image format, 1-luminous, 2-luminous/alpha, 3-RGB, 4-RGBA
 	\param reuse_texture_ID 0-generate a new texture ID, otherwise reuse the texture ID (overwriting the old texture)
-	\param flags can be any of SOIL_FLAG_POWER_OF_TWO | SOIL_FLAG_MIPMAPS | SOIL_FLAG_TEXTURE_REPEATS | SOIL_FLAG_MULTIPLY_ALPHA | SOIL_FLAG_INVERT_Y | SOIL_FLAG_COMPRESS_TO_DXT | SOIL_FLAG_DDS_LOAD_DIRECT
+	\param flags can be any of SOIL_FLAG_POWER_OF_TWO | SOIL_FLAG_MIPMAPS | SOIL_FLAG_TEXTURE_REPEATS | SOIL_FLAG_MULTIPLY_ALPHA | SOIL_FLAG_INVERT_Y | SOIL_FLAG_COMPRESS_TO_DXT | SOIL_FLAG_COMPRESS_TO_RGTC | SOIL_FLAG_DDS_LOAD_DIRECT
 	\return 0-failed, otherwise returns the OpenGL texture handle
 **/
 unsigned int
@@ -257,7 +514,7 @@ unsigned int
 	\param z_neg_buffer_length the size of the above buffer
 	\param force_channels 0-image format, 1-luminous, 2-luminous/alpha, 3-RGB, 4-RGBA
 	\param reuse_texture_ID 0-generate a new texture ID, otherwise reuse the texture ID (overwriting the old texture)
-	\param flags can be any of SOIL_FLAG_POWER_OF_TWO | SOIL_FLAG_MIPMAPS | SOIL_FLAG_TEXTURE_REPEATS | SOIL_FLAG_MULTIPLY_ALPHA | SOIL_FLAG_INVERT_Y | SOIL_FLAG_COMPRESS_TO_DXT | SOIL_FLAG_DDS_LOAD_DIRECT
+	\param flags can be any of SOIL_FLAG_POWER_OF_TWO | SOIL_FLAG_MIPMAPS | SOIL_FLAG_TEXTURE_REPEATS | SOIL_FLAG_MULTIPLY_ALPHA | SOIL_FLAG_INVERT_Y | SOIL_FLAG_COMPRESS_TO_DXT | SOIL_FLAG_COMPRESS_TO_RGTC | SOIL_FLAG_DDS_LOAD_DIRECT
 	\return 0-failed, otherwise returns the OpenGL texture handle
 **/
 unsigned int
@@ -287,7 +544,7 @@ unsigned int
 	\param face_order the order of the faces in the file, any combination of NSWEUD, for North, South, Up, etc.
 	\param force_channels 0-image format, 1-luminous, 2-luminous/alpha, 3-RGB, 4-RGBA
 	\param reuse_texture_ID 0-generate a new texture ID, otherwise reuse the texture ID (overwriting the old texture)
-	\param flags can be any of SOIL_FLAG_POWER_OF_TWO | SOIL_FLAG_MIPMAPS | SOIL_FLAG_TEXTURE_REPEATS | SOIL_FLAG_MULTIPLY_ALPHA | SOIL_FLAG_INVERT_Y | SOIL_FLAG_COMPRESS_TO_DXT | SOIL_FLAG_DDS_LOAD_DIRECT
+	\param flags can be any of SOIL_FLAG_POWER_OF_TWO | SOIL_FLAG_MIPMAPS | SOIL_FLAG_TEXTURE_REPEATS | SOIL_FLAG_MULTIPLY_ALPHA | SOIL_FLAG_INVERT_Y | SOIL_FLAG_COMPRESS_TO_DXT | SOIL_FLAG_COMPRESS_TO_RGTC | SOIL_FLAG_DDS_LOAD_DIRECT
 	\return 0-failed, otherwise returns the OpenGL texture handle
 **/
 unsigned int
@@ -301,6 +558,128 @@ unsigned int
 		unsigned int flags
 	);
 
+/**
+	Opens a texture package (see texture_package.h, written by the
+	soil_pack tool): many textures in one memory mapped file.
+	\param filename the name of the package file
+	\return 0-failed, otherwise returns a package handle
+**/
+int
+	SOIL_open_package
+	(
+		const char *filename
+	);
+
+/**
+	Closes a package.  The textures already loaded from it stay.
+	\param package the handle from SOIL_open_package()
+**/
+void
+	SOIL_close_package
+	(
+		int package
+	);
+
+/**
+	Loads one texture of a package into an OpenGL texture, just like
+	SOIL_load_OGL_texture_from_memory() on the original file.  With
+	SOIL_FLAG_DDS_LOAD_DIRECT the baked DDS / KTX2 data goes to OpenGL
+	straight from the mapped file, nothing is copied or decoded.
+	\param package the handle from SOIL_open_package()
+	\param name the name of the texture in the package ('\' or '/' alike)
+	\param force_channels 0-image format, 1-luminous, 2-luminous/alpha, 3-RGB, 4-RGBA
+	\param reuse_texture_ID 0-generate a new texture ID, otherwise reuse the texture ID (overwriting the old texture)
+	\param flags can be any of SOIL_FLAG_POWER_OF_TWO | SOIL_FLAG_MIPMAPS | SOIL_FLAG_TEXTURE_REPEATS | SOIL_FLAG_MULTIPLY_ALPHA | SOIL_FLAG_INVERT_Y | SOIL_FLAG_COMPRESS_TO_DXT | SOIL_FLAG_COMPRESS_TO_RGTC | SOIL_FLAG_DDS_LOAD_DIRECT
+	\return 0-failed, otherwise returns the OpenGL texture handle
+**/
+unsigned int
+	SOIL_load_OGL_texture_from_package
+	(
+		int package,
+		const char *name,
+		int force_channels,
+		unsigned int reuse_texture_ID,
+		unsigned int flags
+	);
+
+/**
+	Opens an animated GIF or PNG (APNG) file for playback, see
+	image_anim.h.  A plain GIF or PNG file opens as one frame.
+	\param filename the name of the file to play
+	\param cache_bytes how many bytes of decoded frames to keep around
+		(each takes width * height * 4), 0 to decode every frame each time
+	\return 0-failed, otherwise returns an animation handle
+**/
+int
+	SOIL_open_animation
+	(
+		const char *filename,
+		size_t cache_bytes
+	);
+
+/**
+	Closes an animation.  The textures already made from it stay.
+	\param animation the handle from SOIL_open_animation()
+**/
+void
+	SOIL_close_animation
+	(
+		int animation
+	);
+
+/**
+	Tells how large an animation is.  Any of the pointers may be NULL.
+	\param animation the handle from SOIL_open_animation()
+	\param loop_count receives how many times it should play, 0 for forever
+	\return 0-failed, 1-it worked
+**/
+int
+	SOIL_animation_info
+	(
+		int animation,
+		int *width, int *height,
+		int *num_frames,
+		int *loop_count
+	);
+
+/**
+	Puts a frame of an animation in an OpenGL texture (RGBA, no MIPmaps).
+	Given the texture that showed the frame before (as returned by the
+	last call), only the part of the frame that changed is decoded and
+	uploaded (glTexSubImage2D), so playing frame after frame is cheap.
+	Anything else decodes from the nearest cached frame and uploads the
+	whole frame.
+	\param animation the handle from SOIL_open_animation()
+	\param frame which frame, 0 to num_frames-1
+	\param reuse_texture_ID 0-generate a new texture ID, otherwise reuse the texture ID (overwriting the old texture)
+	\param delay_ms receives how long the frame should be shown, may be NULL
+	\return 0-failed, otherwise returns the OpenGL texture handle
+**/
+unsigned int
+	SOIL_load_OGL_animation_frame
+	(
+		int animation,
+		int frame,
+		unsigned int reuse_texture_ID,
+		int *delay_ms
+	);
+
+/**
+	Loads every frame of an animation into an OpenGL texture array, one
+	layer a frame (GL_TEXTURE_2D_ARRAY, OpenGL 3.0 or GL_EXT_texture_array).
+	\param animation the handle from SOIL_open_animation()
+	\param reuse_texture_ID 0-generate a new texture ID, otherwise reuse the texture ID (overwriting the old texture)
+	\param flags can be any of SOIL_FLAG_POWER_OF_TWO | SOIL_FLAG_MIPMAPS | SOIL_FLAG_TEXTURE_REPEATS | SOIL_FLAG_MULTIPLY_ALPHA | SOIL_FLAG_INVERT_Y | SOIL_FLAG_COMPRESS_TO_DXT | SOIL_FLAG_COMPRESS_TO_RGTC
+	\return 0-failed, otherwise returns the OpenGL texture handle
+**/
+unsigned int
+	SOIL_load_OGL_animation_array
+	(
+		int animation,
+		unsigned int reuse_texture_ID,
+		unsigned int flags
+	);
+
 /**
 	Creates a 2D OpenGL texture from raw image data.  Note that the raw data is
 	_NOT_ freed after the upload (so the user can load various versions).
@@ -309,7 +688,7 @@ unsigned int
 	\param height the height of the image in pixels
 	\param channels the number of channels: 1-luminous, 2-luminous/alpha, 3-RGB, 4-RGBA
 	\param reuse_texture_ID 0-generate a new texture ID, otherwise reuse the texture ID (overwriting the old texture)
-	\param flags can be any of SOIL_FLAG_POWER_OF_TWO | SOIL_FLAG_MIPMAPS | SOIL_FLAG_TEXTURE_REPEATS | SOIL_FLAG_MULTIPLY_ALPHA | SOIL_FLAG_INVERT_Y | SOIL_FLAG_COMPRESS_TO_DXT
+	\param flags can be any of SOIL_FLAG_POWER_OF_TWO | SOIL_FLAG_MIPMAPS | SOIL_FLAG_TEXTURE_REPEATS | SOIL_FLAG_MULTIPLY_ALPHA | SOIL_FLAG_INVERT_Y | SOIL_FLAG_COMPRESS_TO_DXT | SOIL_FLAG_COMPRESS_TO_RGTC
 	\return 0-failed, otherwise returns the OpenGL texture handle
 **/
 unsigned int
@@ -329,7 +708,7 @@ unsigned int
 	\param channels the number of channels: 1-luminous, 2-luminous/alpha, 3-RGB, 4-RGBA
 	\param face_order the order of the faces in the file, and combination of NSWEUD, for North, South, Up, etc.
 	\param reuse_texture_ID 0-generate a new texture ID, otherwise reuse the texture ID (overwriting the old texture)
-	\param flags can be any of SOIL_FLAG_POWER_OF_TWO | SOIL_FLAG_MIPMAPS | SOIL_FLAG_TEXTURE_REPEATS | SOIL_FLAG_MULTIPLY_ALPHA | SOIL_FLAG_INVERT_Y | SOIL_FLAG_COMPRESS_TO_DXT | SOIL_FLAG_DDS_LOAD_DIRECT
+	\param flags can be any of SOIL_FLAG_POWER_OF_TWO | SOIL_FLAG_MIPMAPS | SOIL_FLAG_TEXTURE_REPEATS | SOIL_FLAG_MULTIPLY_ALPHA | SOIL_FLAG_INVERT_Y | SOIL_FLAG_COMPRESS_TO_DXT | SOIL_FLAG_COMPRESS_TO_RGTC | SOIL_FLAG_DDS_LOAD_DIRECT
 	\return 0-failed, otherwise returns the OpenGL texture handle
 **/
 unsigned int
@@ -403,6 +782,37 @@ int
 		const unsigned char *const data
 	);
 
+/**
+	The same, compressing DDS images at one of the SOIL_DXT_QUALITY_* levels
+	\return 0 if failed, otherwise returns 1
+**/
+int
+	SOIL_save_image_quality
+	(
+		const char *filename,
+		int image_type,
+		int width, int height, int channels,
+		const unsigned char *const data,
+		int quality
+	);
+
+/**
+	Saves a DDS or KTX2 image (any SOIL_SAVE_TYPE_DDS* or SOIL_SAVE_TYPE_KTX2*)
+	with its whole MIPmap chain, at one of the SOIL_DXT_QUALITY_* levels.  The levels
+	are compressed and written a few rows at a time, the whole compressed
+	image is never in RAM.
+	\return 0 if failed, otherwise returns 1
+**/
+int
+	SOIL_save_image_mipmapped
+	(
+		const char *filename,
+		int image_type,
+		int width, int height, int channels,
+		const unsigned char *const data,
+		int quality
+	);
+
 /**
 	Frees the image data (note, this is just C's "free()"...this function is
 	present mostly so C++ programmers don't forget to use "free()" and call
@@ -416,8 +826,8 @@ void
 
 /**
 	This function resturn a pointer to a string describing the last thing
-	that happened inside SOIL.  It can be used to determine why an image
-	failed to load.
+	that happened inside SOIL (on the calling thread).  It can be used to
+	determine why an image failed to load.
 **/
 const char*
 	SOIL_last_result
@@ -425,6 +835,96 @@ const char*
 		void
 	);
 
+/**
+	Saves what SOIL finds out about the OpenGL implementation (the
+	extensions it uses and the largest texture sizes) to a small file,
+	for SOIL_load_capabilities() to read back on the next run.  Asks the
+	driver about all of it first, so call it with the context current,
+	after loading is done or before exiting.
+	\return 0 if failed, otherwise returns 1
+**/
+int
+	SOIL_save_capabilities
+	(
+		const char *filename
+	);
+
+/**
+	Loads capabilities saved by SOIL_save_capabilities(), if they were
+	saved for the same vendor, renderer and version strings as the
+	current context, so that SOIL does not search the extension string
+	or query the limits again.  A capability that needs an OpenGL
+	function looks it up the first time it is used, and is turned off
+	if the function is missing.  Call it after the context is made,
+	before loading anything.
+	\return 0 if the file is missing or damaged or is for another
+		implementation (nothing is loaded then), otherwise returns 1
+**/
+int
+	SOIL_load_capabilities
+	(
+		const char *filename
+	);
+
+/**
+	Sets the texture memory budget.  SOIL keeps track of the bytes of
+	every texture it uploads (all MIP levels and cube faces, DXT
+	textures counted by their compressed size, RGB counted as RGBA since
+	that is what most drivers store).  Once the budget is exceeded the
+	least recently used textures loaded with SOIL_load_OGL_texture are
+	evicted (their storage is replaced by a single texel, the texture ID
+	stays valid) or lose their top MIP level, depending on policy.
+	Textures without a file to reload from (from memory, cubemaps, HDR)
+	are counted but never evicted.
+	\param budget_bytes the budget, 0 for unlimited (the default)
+	\param policy SOIL_RESIDENCY_EVICT_LRU or SOIL_RESIDENCY_DROP_MIPS_LRU
+**/
+void
+	SOIL_residency_set_budget
+	(
+		size_t budget_bytes,
+		int policy
+	);
+
+/**
+	Marks a texture as used (call it when binding the texture for
+	drawing).  If the texture was evicted or shrunk it is reloaded from
+	its file at full size first, which may in turn evict others.
+	\return 1 if the texture had to be reloaded, otherwise returns 0
+**/
+int
+	SOIL_residency_touch
+	(
+		unsigned int texture_ID
+	);
+
+/**
+	Stops tracking a texture, call it before glDeleteTextures().
+**/
+void
+	SOIL_residency_forget
+	(
+		unsigned int texture_ID
+	);
+
+/**
+	Fills in the statistics of the texture residency manager.
+**/
+void
+	SOIL_residency_get_stats
+	(
+		SOIL_residency_stats *stats
+	);
+
+/**
+	\return the bytes the texture currently occupies, 0 if unknown or evicted
+**/
+size_t
+	SOIL_residency_texture_bytes
+	(
+		unsigned int texture_ID
+	);
+
 
 #ifdef __cplusplus
 }
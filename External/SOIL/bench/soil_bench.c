@@ -0,0 +1,3040 @@
+/*
+	soil_bench
+
+	Measures the CPU side of SOIL, with no OpenGL context: decoding
+	every file format, resampling, MIPmap generation, DXT / RGTC / BC7
+	compression (speed and quality), the writers, the atlas packer and
+	playing animated GIF / APNG files.
+	The images are made up here (so they are the same everywhere) and
+	taken from the photographs in bench/corpus, plus any image files
+	given on the command line.
+
+	usage:	soil_bench [--json results.json] [--corpus directory]
+				[--filter text] [--quick] [image files...]
+
+	Every result has the megapixels and megabytes per second of its
+	best run, the peak RSS of the process so far and, for the
+	compressors, how close the decoded image is to the original (PSNR,
+	or the angle error of normal maps).  The calibration result times
+	a fixed integer loop, so runs on different machines can be compared.
+
+	It first checks that a streamed DDS has the bytes of converting
+	whole levels and, built with the stub OpenGL in bench/stub_gl.c
+	(SOIL_BENCH_STUB_GL, the default where there is GLX), what SOIL's
+	loaders and the residency manager leave on the "GPU", among them
+	every file of the KTX2 corpus in bench/corpus/ktx2.  With the stub
+	it also times uploading a whole KTX2 file against a DDS one.  Any
+	check that fails is printed, counted in the JSON "errors" and makes the
+	exit code 1.
+
+	Public Domain
+*/
+
+#include "SOIL.h"
+#include "image_helper.h"
+#include "image_DXT.h"
+#include "image_BC7.h"
+#include "image_KTX2.h"
+#include "image_anim.h"
+#include "image_atlas.h"
+#include "image_jobs.h"
+#include "texture_package.h"
+#ifdef SOIL_BENCH_STUB_GL
+	#include "stub_gl.h"
+	#include <GL/gl.h>
+#endif
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef WIN32
+	#define WIN32_LEAN_AND_MEAN
+	#include <windows.h>
+	#include <psapi.h>
+#else
+	#include <sys/time.h>
+	#include <sys/resource.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+	#if defined(POSIX_FADV_DONTNEED)
+		/*	the page cache can be emptied, for cold starts	*/
+		#define BENCH_CAN_EVICT
+	#endif
+#endif
+
+#ifndef SOIL_BENCH_CORPUS
+	#define SOIL_BENCH_CORPUS "bench/corpus"
+#endif
+
+/*	where the encoders and writers put their files	*/
+#define BENCH_TEMP_FILE		"soil_bench.tmp"
+#define BENCH_MAX_RESULTS	512
+#define BENCH_MAX_IMAGES	32
+
+/*	the photographs in the corpus directory	*/
+static const char *const corpus_files[] =
+{
+	"astronaut.jpg",
+	"rocket.jpg",
+	"chelsea.png"
+};
+
+typedef struct
+{
+	char name[128];
+	int width, height, channels;
+	unsigned char *data;
+}
+bench_image;
+
+typedef struct
+{
+	char group[32];
+	char name[160];
+	int iterations;
+	double best_ms;
+	double total_ms;
+	double megapixels;
+	double megabytes;
+	long peak_rss_kb;
+	/*	quality metrics, when there are any	*/
+	int num_metrics;
+	char metric_name[4][24];
+	double metric[4];
+}
+bench_result;
+
+static bench_result results[BENCH_MAX_RESULTS];
+static int num_results = 0;
+static double min_run_ms = 300.0;
+static int max_iterations = 1000;
+static const char *filter = NULL;
+static double calibration_ms = 0.0;
+/*	called before each timed run, e.g. to empty the page cache	*/
+static void (*bench_before_run)( void *user_data ) = NULL;
+
+/*	timing and memory	*/
+
+static double bench_time_ms( void )
+{
+#ifdef WIN32
+	LARGE_INTEGER frequency, counter;
+	QueryPerformanceFrequency( &frequency );
+	QueryPerformanceCounter( &counter );
+	return 1000.0 * (double)counter.QuadPart / (double)frequency.QuadPart;
+#else
+	struct timeval now;
+	gettimeofday( &now, NULL );
+	return 1000.0 * now.tv_sec + 0.001 * now.tv_usec;
+#endif
+}
+
+/*	the high water mark of the whole process so far, in KB	*/
+static long bench_peak_rss_kb( void )
+{
+#ifdef WIN32
+	PROCESS_MEMORY_COUNTERS counters;
+	if( GetProcessMemoryInfo( GetCurrentProcess(), &counters, sizeof( counters ) ) )
+	{
+		return (long)(counters.PeakWorkingSetSize / 1024);
+	}
+	return 0;
+#else
+	struct rusage usage;
+	if( getrusage( RUSAGE_SELF, &usage ) != 0 )
+	{
+		return 0;
+	}
+	#if defined(__APPLE__) || defined(__APPLE_CC__)
+		/*	in bytes here	*/
+		return (long)(usage.ru_maxrss / 1024);
+	#else
+		return (long)usage.ru_maxrss;
+	#endif
+#endif
+}
+
+/*	running the benchmarks	*/
+
+typedef void (*bench_function)( void *user_data );
+
+static int bench_wanted( const char *group, const char *name )
+{
+	char full_name[256];
+	if( NULL == filter )
+	{
+		return 1;
+	}
+	sprintf( full_name, "%.31s/%.200s", group, name );
+	return (NULL != strstr( full_name, filter ));
+}
+
+/*	runs the function until it has taken min_run_ms, and keeps the best run
+	\return the result, so quality metrics can be added to it	*/
+static bench_result* bench_run(
+		const char *group, const char *name,
+		bench_function function, void *user_data,
+		double megapixels, double megabytes )
+{
+	bench_result *result;
+	double start_ms, run_ms;
+	if( !bench_wanted( group, name ) || (num_results >= BENCH_MAX_RESULTS) )
+	{
+		return NULL;
+	}
+	result = &results[num_results++];
+	memset( result, 0, sizeof( bench_result ) );
+	strncpy( result->group, group, sizeof( result->group ) - 1 );
+	strncpy( result->name, name, sizeof( result->name ) - 1 );
+	result->megapixels = megapixels;
+	result->megabytes = megabytes;
+	result->best_ms = 1e30;
+	do
+	{
+		if( bench_before_run )
+		{
+			bench_before_run( user_data );
+		}
+		start_ms = bench_time_ms();
+		function( user_data );
+		run_ms = bench_time_ms() - start_ms;
+		if( run_ms < result->best_ms )
+		{
+			result->best_ms = run_ms;
+		}
+		result->total_ms += run_ms;
+		++result->iterations;
+	} while( (result->total_ms < min_run_ms) && (result->iterations < max_iterations) );
+	result->peak_rss_kb = bench_peak_rss_kb();
+	printf( "%-10s %-44s %8.3f ms", group, name, result->best_ms );
+	if( megapixels > 0.0 )
+	{
+		printf( " %9.2f MP/s", megapixels * 1000.0 / result->best_ms );
+	}
+	if( megabytes > 0.0 )
+	{
+		printf( " %9.2f MB/s", megabytes * 1000.0 / result->best_ms );
+	}
+	printf( "\n" );
+	return result;
+}
+
+static void bench_metric( bench_result *result, const char *name, double value )
+{
+	if( (NULL == result) || (result->num_metrics >= 4) )
+	{
+		return;
+	}
+	strncpy( result->metric_name[result->num_metrics], name, 23 );
+	result->metric[result->num_metrics] = value;
+	++result->num_metrics;
+	printf( "%-10s %-44s   %s %.3f\n", "", "", name, value );
+}
+
+/*	the images	*/
+
+static unsigned int hash_2D( int x, int y, int seed )
+{
+	unsigned int h = (unsigned int)x * 374761393u + (unsigned int)y * 668265263u + (unsigned int)seed * 2246822519u;
+	h = (h ^ (h >> 13)) * 1274126177u;
+	return h ^ (h >> 16);
+}
+
+/*	smooth value noise in [0,1], summed over a few octaves	*/
+static float fractal_noise( float x, float y, int seed )
+{
+	float sum = 0.0f, amplitude = 0.5f;
+	int octave;
+	for( octave = 0; octave < 5; ++octave )
+	{
+		int ix = (int)floor( x ), iy = (int)floor( y );
+		float fx = x - ix, fy = y - iy;
+		float v00 = (hash_2D( ix, iy, seed + octave ) & 0xFFFF) / 65535.0f;
+		float v10 = (hash_2D( ix + 1, iy, seed + octave ) & 0xFFFF) / 65535.0f;
+		float v01 = (hash_2D( ix, iy + 1, seed + octave ) & 0xFFFF) / 65535.0f;
+		float v11 = (hash_2D( ix + 1, iy + 1, seed + octave ) & 0xFFFF) / 65535.0f;
+		fx = fx * fx * (3.0f - 2.0f * fx);
+		fy = fy * fy * (3.0f - 2.0f * fy);
+		sum += amplitude * (	(v00 * (1.0f - fx) + v10 * fx) * (1.0f - fy) +
+								(v01 * (1.0f - fx) + v11 * fx) * fy );
+		amplitude *= 0.5f;
+		x *= 2.0f;
+		y *= 2.0f;
+	}
+	return sum / 0.96875f;
+}
+
+static unsigned char to_byte( float value )
+{
+	int v = (int)(value * 255.0f + 0.5f);
+	return (unsigned char)((v < 0) ? 0 : (v > 255) ? 255 : v);
+}
+
+static int bench_image_alloc( bench_image *image, const char *name, int width, int height, int channels )
+{
+	strncpy( image->name, name, sizeof( image->name ) - 1 );
+	image->width = width;
+	image->height = height;
+	image->channels = channels;
+	image->data = (unsigned char*)malloc( width * height * channels );
+	return (NULL != image->data);
+}
+
+/*	a smooth gradient, the hardest case for DXT banding	*/
+static int make_gradient( bench_image *image, int size )
+{
+	int x, y;
+	if( !bench_image_alloc( image, "gradient", size, size, 3 ) )
+	{
+		return 0;
+	}
+	for( y = 0; y < size; ++y )
+	{
+		for( x = 0; x < size; ++x )
+		{
+			unsigned char *p = &image->data[(y * size + x) * 3];
+			p[0] = to_byte( (float)x / size );
+			p[1] = to_byte( (float)y / size );
+			p[2] = to_byte( 0.5f + 0.5f * (float)sin( (x + y) * 0.01 ) );
+		}
+	}
+	return 1;
+}
+
+/*	photograph like detail at every scale, with soft edged alpha	*/
+static int make_noise( bench_image *image, int size )
+{
+	int x, y;
+	if( !bench_image_alloc( image, "noise_rgba", size, size, 4 ) )
+	{
+		return 0;
+	}
+	for( y = 0; y < size; ++y )
+	{
+		for( x = 0; x < size; ++x )
+		{
+			unsigned char *p = &image->data[(y * size + x) * 4];
+			float u = x * 16.0f / size, v = y * 16.0f / size;
+			float shape = fractal_noise( u * 0.25f, v * 0.25f, 7 );
+			p[0] = to_byte( fractal_noise( u, v, 1 ) );
+			p[1] = to_byte( fractal_noise( u, v, 2 ) * 0.8f + 0.1f );
+			p[2] = to_byte( fractal_noise( u, v, 3 ) * 0.6f );
+			p[3] = to_byte( (shape - 0.4f) * 8.0f );
+		}
+	}
+	return 1;
+}
+
+/*	a tangent space normal map of a bumpy height field	*/
+static int make_normal_map( bench_image *image, int size )
+{
+	int x, y;
+	if( !bench_image_alloc( image, "normal_map", size, size, 3 ) )
+	{
+		return 0;
+	}
+	for( y = 0; y < size; ++y )
+	{
+		for( x = 0; x < size; ++x )
+		{
+			unsigned char *p = &image->data[(y * size + x) * 3];
+			float u = x * 8.0f / size, v = y * 8.0f / size, d = 1.0f / size;
+			float dx = (fractal_noise( u + d, v, 11 ) - fractal_noise( u - d, v, 11 )) * size * 0.25f;
+			float dy = (fractal_noise( u, v + d, 11 ) - fractal_noise( u, v - d, 11 )) * size * 0.25f;
+			float length = (float)sqrt( dx * dx + dy * dy + 1.0f );
+			p[0] = to_byte( 0.5f - 0.5f * dx / length );
+			p[1] = to_byte( 0.5f - 0.5f * dy / length );
+			p[2] = to_byte( 0.5f + 0.5f / length );
+		}
+	}
+	return 1;
+}
+
+static int load_corpus_image( bench_image *image, const char *directory, const char *filename )
+{
+	char path[512];
+	const char *name = filename;
+	if( directory )
+	{
+		sprintf( path, "%.400s/%.100s", directory, filename );
+	} else
+	{
+		sprintf( path, "%.500s", filename );
+		if( strrchr( name, '/' ) )
+		{
+			name = strrchr( name, '/' ) + 1;
+		}
+	}
+	image->data = SOIL_load_image( path, &image->width, &image->height, &image->channels, SOIL_LOAD_AUTO );
+	if( NULL == image->data )
+	{
+		printf( "skipping %s: %s\n", path, SOIL_last_result() );
+		return 0;
+	}
+	strncpy( image->name, name, sizeof( image->name ) - 1 );
+	return 1;
+}
+
+/*	keeps just the middle of an image, for the slow compressors	*/
+static bench_image crop_image( const bench_image *image, int size )
+{
+	bench_image crop;
+	int y, x0, y0;
+	memset( &crop, 0, sizeof( crop ) );
+	if( size > image->width )
+	{
+		size = image->width;
+	}
+	if( size > image->height )
+	{
+		size = image->height;
+	}
+	size &= ~3;
+	x0 = ((image->width - size) / 2) & ~3;
+	y0 = ((image->height - size) / 2) & ~3;
+	if( !bench_image_alloc( &crop, image->name, size, size, image->channels ) )
+	{
+		return crop;
+	}
+	for( y = 0; y < size; ++y )
+	{
+		memcpy( &crop.data[y * size * image->channels],
+				&image->data[((y0 + y) * image->width + x0) * image->channels],
+				size * image->channels );
+	}
+	return crop;
+}
+
+static unsigned char* read_whole_file( const char *filename, int *length )
+{
+	FILE *f = fopen( filename, "rb" );
+	unsigned char *buffer;
+	long size;
+	if( NULL == f )
+	{
+		return NULL;
+	}
+	fseek( f, 0, SEEK_END );
+	size = ftell( f );
+	fseek( f, 0, SEEK_SET );
+	buffer = (unsigned char*)malloc( size > 0 ? size : 1 );
+	if( buffer && (fread( buffer, 1, size, f ) != (size_t)size) )
+	{
+		free( buffer );
+		buffer = NULL;
+	}
+	fclose( f );
+	*length = (int)size;
+	return buffer;
+}
+
+/*	the formats SOIL can't write	*/
+
+static void put_be16( FILE *f, int value )
+{
+	fputc( (value >> 8) & 255, f );
+	fputc( value & 255, f );
+}
+
+static void put_be32( FILE *f, unsigned int value )
+{
+	put_be16( f, (value >> 16) & 0xFFFF );
+	put_be16( f, value & 0xFFFF );
+}
+
+/*	PackBits, as in PSD files: runs of 3+ repeats, the rest as literals
+	\return the number of bytes written to out	*/
+static int pack_bits( const unsigned char *in, int count, int stride, unsigned char *out )
+{
+	int i = 0, n = 0;
+	while( i < count )
+	{
+		int run = 1;
+		while( (i + run < count) && (run < 128) && (in[(i + run) * stride] == in[i * stride]) )
+		{
+			++run;
+		}
+		if( run >= 3 )
+		{
+			out[n++] = (unsigned char)(257 - run);
+			out[n++] = in[i * stride];
+			i += run;
+		} else
+		{
+			int start = i, literal = 0;
+			while( (i < count) && (literal < 128) )
+			{
+				if( (i + 2 < count) && (in[i * stride] == in[(i + 1) * stride]) &&
+					(in[i * stride] == in[(i + 2) * stride]) )
+				{
+					break;
+				}
+				++i;
+				++literal;
+			}
+			out[n++] = (unsigned char)(literal - 1);
+			for( ; start < i; ++start )
+			{
+				out[n++] = in[start * stride];
+			}
+		}
+	}
+	return n;
+}
+
+/*	an RGB(A) Photoshop file, PackBits compressed like most of them are	*/
+static int write_PSD( const char *filename, const bench_image *image )
+{
+	const int channels = (image->channels == 4) ? 4 : 3;
+	unsigned char *rows, *row_data;
+	int *row_lengths, c, y, total = 0;
+	FILE *f;
+	if( image->channels < 3 )
+	{
+		return 0;
+	}
+	rows = (unsigned char*)malloc( channels * image->height * (image->width * 2 + 2) );
+	row_lengths = (int*)malloc( channels * image->height * sizeof( int ) );
+	f = fopen( filename, "wb" );
+	if( (NULL == rows) || (NULL == row_lengths) || (NULL == f) )
+	{
+		free( rows );
+		free( row_lengths );
+		if( f )
+		{
+			fclose( f );
+		}
+		return 0;
+	}
+	row_data = rows;
+	for( c = 0; c < channels; ++c )
+	{
+		for( y = 0; y < image->height; ++y )
+		{
+			int n = pack_bits( &image->data[y * image->width * image->channels + c],
+					image->width, image->channels, row_data );
+			row_lengths[c * image->height + y] = n;
+			row_data += n;
+			total += n;
+		}
+	}
+	fwrite( "8BPS", 1, 4, f );
+	put_be16( f, 1 );
+	put_be32( f, 0 );
+	put_be16( f, 0 );
+	put_be16( f, channels );
+	put_be32( f, image->height );
+	put_be32( f, image->width );
+	put_be16( f, 8 );
+	/*	RGB, then no color mode data, image resources, layers or masks	*/
+	put_be16( f, 3 );
+	put_be32( f, 0 );
+	put_be32( f, 0 );
+	put_be32( f, 0 );
+	/*	PackBits, the length of every row, then the rows	*/
+	put_be16( f, 1 );
+	for( y = 0; y < channels * image->height; ++y )
+	{
+		put_be16( f, row_lengths[y] );
+	}
+	fwrite( rows, 1, total, f );
+	free( rows );
+	free( row_lengths );
+	return (fclose( f ) == 0);
+}
+
+/*	a Radiance RGBE file, run length encoded scanlines	*/
+static int write_HDR( const char *filename, const bench_image *image )
+{
+	unsigned char *scanline, *packed;
+	int x, y, c;
+	FILE *f;
+	if( (image->width < 8) || (image->width > 0x7FFF) )
+	{
+		return 0;
+	}
+	scanline = (unsigned char*)malloc( image->width * 4 );
+	packed = (unsigned char*)malloc( image->width * 2 + 2 );
+	f = fopen( filename, "wb" );
+	if( (NULL == scanline) || (NULL == packed) || (NULL == f) )
+	{
+		free( scanline );
+		free( packed );
+		if( f )
+		{
+			fclose( f );
+		}
+		return 0;
+	}
+	fprintf( f, "#?RADIANCE\nFORMAT=32-bit_rle_rgbe\n\n-Y %d +X %d\n", image->height, image->width );
+	for( y = 0; y < image->height; ++y )
+	{
+		for( x = 0; x < image->width; ++x )
+		{
+			const unsigned char *p = &image->data[(y * image->width + x) * image->channels];
+			float rgb[3], largest;
+			int exponent;
+			for( c = 0; c < 3; ++c )
+			{
+				/*	a bit over 1, like light usually is	*/
+				rgb[c] = p[(image->channels < 3) ? 0 : c] * (4.0f / 255.0f);
+			}
+			largest = rgb[0] > rgb[1] ? rgb[0] : rgb[1];
+			largest = largest > rgb[2] ? largest : rgb[2];
+			if( largest < 1e-32f )
+			{
+				scanline[x] = scanline[x + image->width] = scanline[x + 2 * image->width] = 0;
+				scanline[x + 3 * image->width] = 0;
+			} else
+			{
+				float scale = (float)frexp( largest, &exponent ) * 256.0f / largest;
+				for( c = 0; c < 3; ++c )
+				{
+					scanline[x + c * image->width] = (unsigned char)(rgb[c] * scale);
+				}
+				scanline[x + 3 * image->width] = (unsigned char)(exponent + 128);
+			}
+		}
+		fputc( 2, f );
+		fputc( 2, f );
+		fputc( image->width >> 8, f );
+		fputc( image->width & 255, f );
+		/*	each component on its own (PackBits runs are 128+ here)	*/
+		for( c = 0; c < 4; ++c )
+		{
+			const unsigned char *in = &scanline[c * image->width];
+			int i = 0, n = 0;
+			while( i < image->width )
+			{
+				int run = 1;
+				while( (i + run < image->width) && (run < 127) && (in[i + run] == in[i]) )
+				{
+					++run;
+				}
+				if( run >= 4 )
+				{
+					packed[n++] = (unsigned char)(128 + run);
+					packed[n++] = in[i];
+					i += run;
+				} else
+				{
+					int start = i;
+					while( (i < image->width) && (i - start < 128) &&
+						!((i + 3 < image->width) && (in[i] == in[i + 1]) &&
+							(in[i] == in[i + 2]) && (in[i] == in[i + 3])) )
+					{
+						++i;
+					}
+					packed[n++] = (unsigned char)(i - start);
+					memcpy( &packed[n], &in[start], i - start );
+					n += i - start;
+				}
+			}
+			fwrite( packed, 1, n, f );
+		}
+	}
+	free( scanline );
+	free( packed );
+	return (fclose( f ) == 0);
+}
+
+/*	reference decoders, for the quality metrics	*/
+
+static void decode_color_block( const unsigned char *block, int four_colors_only, unsigned char texels[64] )
+{
+	int c0 = block[0] | (block[1] << 8), c1 = block[2] | (block[3] << 8);
+	int palette[4][4], i, c;
+	palette[0][0] = ((c0 >> 11) & 31) * 255 / 31;
+	palette[0][1] = ((c0 >> 5) & 63) * 255 / 63;
+	palette[0][2] = (c0 & 31) * 255 / 31;
+	palette[1][0] = ((c1 >> 11) & 31) * 255 / 31;
+	palette[1][1] = ((c1 >> 5) & 63) * 255 / 63;
+	palette[1][2] = (c1 & 31) * 255 / 31;
+	palette[0][3] = palette[1][3] = palette[2][3] = palette[3][3] = 255;
+	for( c = 0; c < 3; ++c )
+	{
+		if( (c0 > c1) || four_colors_only )
+		{
+			palette[2][c] = (2 * palette[0][c] + palette[1][c] + 1) / 3;
+			palette[3][c] = (palette[0][c] + 2 * palette[1][c] + 1) / 3;
+		} else
+		{
+			palette[2][c] = (palette[0][c] + palette[1][c] + 1) / 2;
+			palette[3][c] = 0;
+		}
+	}
+	if( (c0 <= c1) && !four_colors_only )
+	{
+		palette[3][3] = 0;
+	}
+	for( i = 0; i < 16; ++i )
+	{
+		int index = (block[4 + i / 4] >> (2 * (i & 3))) & 3;
+		for( c = 0; c < 4; ++c )
+		{
+			texels[i * 4 + c] = (unsigned char)palette[index][c];
+		}
+	}
+}
+
+/*	a BC4 block (or the alpha of DXT5) into one channel of 16 RGBA texels	*/
+static void decode_channel_block( const unsigned char *block, unsigned char texels[64], int channel )
+{
+	int a0 = block[0], a1 = block[1], values[8], i;
+	unsigned long long bits = 0;
+	values[0] = a0;
+	values[1] = a1;
+	for( i = 1; i < 7; ++i )
+	{
+		if( a0 > a1 )
+		{
+			values[i + 1] = ((7 - i) * a0 + i * a1 + 3) / 7;
+		} else
+		if( i < 5 )
+		{
+			values[i + 1] = ((5 - i) * a0 + i * a1 + 2) / 5;
+		}
+	}
+	if( a0 <= a1 )
+	{
+		values[6] = 0;
+		values[7] = 255;
+	}
+	for( i = 0; i < 6; ++i )
+	{
+		bits |= (unsigned long long)block[2 + i] << (8 * i);
+	}
+	for( i = 0; i < 16; ++i )
+	{
+		texels[i * 4 + channel] = (unsigned char)values[(bits >> (3 * i)) & 7];
+	}
+}
+
+/*	the BC7 modes SOIL writes: 1, 3, 5 and 6	*/
+static const unsigned short bench_BC7_partitions2[64] =
+{
+	0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80,
+	0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8, 0xFF00, 0xFFF0, 0xF000,
+	0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE,
+	0x088C, 0x3110, 0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C,
+	0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696, 0xA55A,
+	0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660,
+	0x0272, 0x04E4, 0x4E40, 0x2720, 0xC936, 0x936C, 0x39C6, 0x639C,
+	0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22
+};
+
+static const unsigned char bench_BC7_anchors2[64] =
+{
+	15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15,
+	15,  2,  8,  2,  2,  8,  8, 15,
+	 2,  8,  2,  2,  8,  8,  2,  2,
+	15, 15,  6,  8,  2,  8, 15, 15,
+	 2,  8,  2,  2,  2, 15, 15,  6,
+	 6,  2,  6,  8, 15, 15,  2,  2,
+	15, 15, 15, 15, 15,  2,  2, 15
+};
+
+static int bits_at( const unsigned char *block, int *position, int count )
+{
+	int value = 0, i;
+	for( i = 0; i < count; ++i, ++(*position) )
+	{
+		value |= ((block[*position >> 3] >> (*position & 7)) & 1) << i;
+	}
+	return value;
+}
+
+static int BC7_expand( int value, int bits )
+{
+	value <<= 8 - bits;
+	return value | (value >> bits);
+}
+
+static int BC7_interpolate( int e0, int e1, int index, int index_bits )
+{
+	static const int weights2[4] = { 0, 21, 43, 64 };
+	static const int weights3[8] = { 0, 9, 18, 27, 37, 46, 55, 64 };
+	static const int weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+	const int w = (index_bits == 2) ? weights2[index] :
+			(index_bits == 3) ? weights3[index] : weights4[index];
+	return ((64 - w) * e0 + w * e1 + 32) >> 6;
+}
+
+/*	\return 0 for the modes SOIL doesn't write	*/
+static int decode_BC7_block( const unsigned char *block, unsigned char texels[64] )
+{
+	int mode = 0, position = 0, i, c, e;
+	int endpoint[4][4];
+	while( (mode < 8) && !((block[0] >> mode) & 1) )
+	{
+		++mode;
+	}
+	position = mode + 1;
+	if( (mode == 1) || (mode == 3) )
+	{
+		const int bits = (mode == 1) ? 6 : 7;
+		const int index_bits = (mode == 1) ? 3 : 2;
+		const int partition = bits_at( block, &position, 6 );
+		int pbit[4];
+		for( c = 0; c < 3; ++c )
+		{
+			for( e = 0; e < 4; ++e )
+			{
+				endpoint[e][c] = bits_at( block, &position, bits );
+			}
+		}
+		if( mode == 1 )
+		{
+			/*	one p-bit per subset	*/
+			pbit[0] = pbit[1] = bits_at( block, &position, 1 );
+			pbit[2] = pbit[3] = bits_at( block, &position, 1 );
+		} else
+		{
+			for( e = 0; e < 4; ++e )
+			{
+				pbit[e] = bits_at( block, &position, 1 );
+			}
+		}
+		for( e = 0; e < 4; ++e )
+		{
+			for( c = 0; c < 3; ++c )
+			{
+				endpoint[e][c] = BC7_expand( (endpoint[e][c] << 1) | pbit[e], bits + 1 );
+			}
+			endpoint[e][3] = 255;
+		}
+		for( i = 0; i < 16; ++i )
+		{
+			const int subset = (bench_BC7_partitions2[partition] >> i) & 1;
+			const int anchor = (i == 0) || (subset && (i == bench_BC7_anchors2[partition]));
+			const int index = bits_at( block, &position, index_bits - anchor );
+			for( c = 0; c < 4; ++c )
+			{
+				texels[i * 4 + c] = (unsigned char)BC7_interpolate(
+						endpoint[subset * 2][c], endpoint[subset * 2 + 1][c], index, index_bits );
+			}
+		}
+		return 1;
+	}
+	if( mode == 5 )
+	{
+		const int rotation = bits_at( block, &position, 2 );
+		int color_index[16], alpha_index[16];
+		for( c = 0; c < 3; ++c )
+		{
+			for( e = 0; e < 2; ++e )
+			{
+				endpoint[e][c] = BC7_expand( bits_at( block, &position, 7 ), 7 );
+			}
+		}
+		for( e = 0; e < 2; ++e )
+		{
+			endpoint[e][3] = bits_at( block, &position, 8 );
+		}
+		for( i = 0; i < 16; ++i )
+		{
+			color_index[i] = bits_at( block, &position, (i == 0) ? 1 : 2 );
+		}
+		for( i = 0; i < 16; ++i )
+		{
+			alpha_index[i] = bits_at( block, &position, (i == 0) ? 1 : 2 );
+		}
+		for( i = 0; i < 16; ++i )
+		{
+			unsigned char *t = &texels[i * 4];
+			for( c = 0; c < 3; ++c )
+			{
+				t[c] = (unsigned char)BC7_interpolate( endpoint[0][c], endpoint[1][c], color_index[i], 2 );
+			}
+			t[3] = (unsigned char)BC7_interpolate( endpoint[0][3], endpoint[1][3], alpha_index[i], 2 );
+			if( rotation > 0 )
+			{
+				unsigned char swap = t[3];
+				t[3] = t[rotation - 1];
+				t[rotation - 1] = swap;
+			}
+		}
+		return 1;
+	}
+	if( mode == 6 )
+	{
+		int pbit[2];
+		for( c = 0; c < 4; ++c )
+		{
+			for( e = 0; e < 2; ++e )
+			{
+				endpoint[e][c] = bits_at( block, &position, 7 );
+			}
+		}
+		pbit[0] = bits_at( block, &position, 1 );
+		pbit[1] = bits_at( block, &position, 1 );
+		for( e = 0; e < 2; ++e )
+		{
+			for( c = 0; c < 4; ++c )
+			{
+				endpoint[e][c] = BC7_expand( (endpoint[e][c] << 1) | pbit[e], 8 );
+			}
+		}
+		for( i = 0; i < 16; ++i )
+		{
+			const int index = bits_at( block, &position, (i == 0) ? 3 : 4 );
+			for( c = 0; c < 4; ++c )
+			{
+				texels[i * 4 + c] = (unsigned char)BC7_interpolate(
+						endpoint[0][c], endpoint[1][c], index, 4 );
+			}
+		}
+		return 1;
+	}
+	memset( texels, 0, 64 );
+	return 0;
+}
+
+enum
+{
+	BENCH_DXT1 = 0,
+	BENCH_DXT5 = 1,
+	BENCH_BC4 = 2,
+	BENCH_BC5 = 3,
+	BENCH_BC7 = 4
+};
+
+/*	decodes a whole compressed image to RGBA	*/
+static unsigned char* decode_blocks( const unsigned char *blocks, int format, int width, int height )
+{
+	const int block_bytes = ((format == BENCH_DXT1) || (format == BENCH_BC4)) ? 8 : 16;
+	unsigned char *rgba = (unsigned char*)malloc( width * height * 4 );
+	unsigned char texels[64];
+	int bx, by, x, y;
+	if( NULL == rgba )
+	{
+		return NULL;
+	}
+	for( by = 0; by < (height + 3) / 4; ++by )
+	{
+		for( bx = 0; bx < (width + 3) / 4; ++bx )
+		{
+			memset( texels, 255, sizeof( texels ) );
+			switch( format )
+			{
+			case BENCH_DXT1:
+				decode_color_block( blocks, 0, texels );
+				break;
+			case BENCH_DXT5:
+				decode_color_block( blocks + 8, 1, texels );
+				decode_channel_block( blocks, texels, 3 );
+				break;
+			case BENCH_BC4:
+				decode_channel_block( blocks, texels, 0 );
+				break;
+			case BENCH_BC5:
+				decode_channel_block( blocks, texels, 0 );
+				decode_channel_block( blocks + 8, texels, 1 );
+				break;
+			default:
+				decode_BC7_block( blocks, texels );
+				break;
+			}
+			blocks += block_bytes;
+			for( y = 0; y < 4; ++y )
+			{
+				for( x = 0; x < 4; ++x )
+				{
+					if( (bx * 4 + x < width) && (by * 4 + y < height) )
+					{
+						memcpy( &rgba[((by * 4 + y) * width + bx * 4 + x) * 4], &texels[(y * 4 + x) * 4], 4 );
+					}
+				}
+			}
+		}
+	}
+	return rgba;
+}
+
+/*	the PSNR of some channels of an RGBA image against the original	*/
+static double PSNR( const bench_image *original, const unsigned char *rgba, int first, int count )
+{
+	double squared_error = 0.0;
+	int i, c;
+	for( i = 0; i < original->width * original->height; ++i )
+	{
+		for( c = first; c < first + count; ++c )
+		{
+			/*	1 and 2 channel images are luminance (alpha)	*/
+			int source = (original->channels >= 3) ? c :
+					(c == 3) ? original->channels - 1 : 0;
+			int difference;
+			if( (c == 3) && ((original->channels & 1) == 1) )
+			{
+				difference = rgba[i * 4 + 3] - 255;
+			} else
+			{
+				difference = rgba[i * 4 + c] - original->data[i * original->channels + source];
+			}
+			squared_error += difference * difference;
+		}
+	}
+	squared_error /= (double)original->width * original->height * count;
+	if( squared_error <= 0.0 )
+	{
+		return 99.0;
+	}
+	return 10.0 * log10( 255.0 * 255.0 / squared_error );
+}
+
+/*	the mean angle between the normals and the decoded ones, in degrees;
+	x_channel and y_channel say where the decoded X and Y are, Z is rebuilt	*/
+static double normal_angle_error( const bench_image *original, const unsigned char *rgba,
+		int x_channel, int y_channel )
+{
+	double total = 0.0;
+	int i;
+	for( i = 0; i < original->width * original->height; ++i )
+	{
+		const unsigned char *n = &original->data[i * 3];
+		double ax = n[0] / 127.5 - 1.0, ay = n[1] / 127.5 - 1.0, az = n[2] / 127.5 - 1.0;
+		double bx = rgba[i * 4 + x_channel] / 127.5 - 1.0, by = rgba[i * 4 + y_channel] / 127.5 - 1.0;
+		double bz = 1.0 - bx * bx - by * by;
+		double dot, la, lb;
+		bz = (bz > 0.0) ? sqrt( bz ) : 0.0;
+		la = sqrt( ax * ax + ay * ay + az * az );
+		lb = sqrt( bx * bx + by * by + bz * bz );
+		dot = (ax * bx + ay * by + az * bz) / ((la * lb > 0.0) ? la * lb : 1.0);
+		dot = (dot > 1.0) ? 1.0 : (dot < -1.0) ? -1.0 : dot;
+		total += acos( dot ) * (180.0 / 3.14159265358979);
+	}
+	return total / ((double)original->width * original->height);
+}
+
+/*	the benchmarks	*/
+
+typedef struct
+{
+	const bench_image *image;
+	const unsigned char *buffer;
+	int buffer_length;
+	int format;
+	int quality;
+	int save_type;
+	int mipmapped;
+	unsigned char *output;
+	int output_size;
+	int output_width, output_height;
+	/*	the texture reloaded into, for the uploads	*/
+	unsigned int texture_ID;
+}
+bench_job;
+
+static void run_calibration( void *user_data )
+{
+	volatile unsigned int sink;
+	unsigned int h = 1;
+	int i;
+	for( i = 0; i < 20000000; ++i )
+	{
+		h = (h ^ (unsigned int)i) * 16777619u;
+		h ^= h >> 15;
+	}
+	sink = h;
+	(void)sink;
+	(void)user_data;
+}
+
+static void run_decode( void *user_data )
+{
+	bench_job *job = (bench_job*)user_data;
+	int width, height, channels;
+	unsigned char *img = SOIL_load_image_from_memory(
+			job->buffer, job->buffer_length, &width, &height, &channels, SOIL_LOAD_AUTO );
+	SOIL_free_image_data( img );
+}
+
+static void run_up_scale( void *user_data )
+{
+	bench_job *job = (bench_job*)user_data;
+	up_scale_image( job->image->data, job->image->width, job->image->height, job->image->channels,
+			job->output, job->output_width, job->output_height );
+}
+
+static void run_mipmap( void *user_data )
+{
+	bench_job *job = (bench_job*)user_data;
+	mipmap_image( job->image->data, job->image->width, job->image->height, job->image->channels,
+			job->output, 2, 2 );
+}
+
+/*	every level from the base image, like SOIL_FLAG_MIPMAPS does	*/
+static void run_mip_chain( void *user_data )
+{
+	bench_job *job = (bench_job*)user_data;
+	const bench_image *image = job->image;
+	int level;
+	for( level = 1; (image->width >> level) || (image->height >> level); ++level )
+	{
+		mipmap_image_strided( image->data, image->width, image->height, image->channels,
+				image->width * image->channels, job->output, 1 << level, 1 << level );
+	}
+}
+
+static void run_compress( void *user_data )
+{
+	bench_job *job = (bench_job*)user_data;
+	const bench_image *image = job->image;
+	free( job->output );
+	switch( job->format )
+	{
+	case BENCH_DXT1:
+		job->output = convert_image_to_DXT1_quality( image->data, image->width, image->height,
+				image->channels, job->quality, &job->output_size );
+		break;
+	case BENCH_DXT5:
+		job->output = convert_image_to_DXT5_quality( image->data, image->width, image->height,
+				image->channels, job->quality, &job->output_size );
+		break;
+	case BENCH_BC4:
+		job->output = convert_image_to_BC4( image->data, image->width, image->height,
+				image->channels, &job->output_size );
+		break;
+	case BENCH_BC5:
+		job->output = convert_image_to_BC5( image->data, image->width, image->height,
+				image->channels, &job->output_size );
+		break;
+	default:
+		job->output = convert_image_to_BC7( image->data, image->width, image->height,
+				image->channels, job->quality, &job->output_size );
+		break;
+	}
+}
+
+static void run_write( void *user_data )
+{
+	bench_job *job = (bench_job*)user_data;
+	const bench_image *image = job->image;
+	if( job->mipmapped )
+	{
+		SOIL_save_image_mipmapped( BENCH_TEMP_FILE, job->save_type,
+				image->width, image->height, image->channels, image->data, job->quality );
+	} else
+	{
+		SOIL_save_image_quality( BENCH_TEMP_FILE, job->save_type,
+				image->width, image->height, image->channels, image->data, job->quality );
+	}
+}
+
+/*	reading a whole file and finding its levels, what a loader does
+	before it hands them to OpenGL	*/
+static void run_container_read( void *user_data )
+{
+	bench_job *job = (bench_job*)user_data;
+	int length = 0, levels = 0;
+	unsigned char *buffer = read_whole_file( BENCH_TEMP_FILE, &length );
+	if( NULL == buffer )
+	{
+		return;
+	}
+	if( job->format )
+	{
+		KTX2_header header;
+		if( read_KTX2_header( buffer, length, &header ) )
+		{
+			levels = header.levelCount;
+		}
+	} else
+	if( length >= (int)sizeof( DDS_header ) )
+	{
+		DDS_header header;
+		int offset = sizeof( DDS_header ), w, h, i;
+		memcpy( &header, buffer, sizeof( DDS_header ) );
+		w = header.dwWidth;
+		h = header.dwHeight;
+		for( i = 0; (i < (int)header.dwMipMapCount) && (offset <= length); ++i )
+		{
+			offset += ((w + 3) / 4) * ((h + 3) / 4) * 16;
+			w = (w > 1) ? w / 2 : 1;
+			h = (h > 1) ? h / 2 : 1;
+			++levels;
+		}
+	}
+	job->output_size = levels;
+	free( buffer );
+}
+
+static void run_atlas( void *user_data )
+{
+	bench_job *job = (bench_job*)user_data;
+	const int *sizes = (const int*)job->buffer;
+	job->output_size = image_atlas_pack( sizes, sizes + job->buffer_length, job->buffer_length,
+			2048, 2048, 2, 4, (image_atlas_rect*)job->output );
+}
+
+static double file_megabytes( const char *filename )
+{
+	double size = 0.0;
+	FILE *f = fopen( filename, "rb" );
+	if( f )
+	{
+		fseek( f, 0, SEEK_END );
+		size = ftell( f ) / (1024.0 * 1024.0);
+		fclose( f );
+	}
+	return size;
+}
+
+static double image_megapixels( const bench_image *image )
+{
+	return image->width * image->height / 1e6;
+}
+
+static double image_megabytes( const bench_image *image )
+{
+	return image->width * image->height * image->channels / (1024.0 * 1024.0);
+}
+
+/*	decoding: every format SOIL reads, from RAM	*/
+static void bench_decode( const bench_image *image, const char *source_filename )
+{
+	static const char *const extensions[] = { "tga", "bmp", "dds", "psd", "hdr" };
+	char name[200];
+	bench_job job;
+	int i;
+	memset( &job, 0, sizeof( job ) );
+	/*	the file as it is, for the JPEGs and PNGs of the corpus	*/
+	if( source_filename )
+	{
+		const char *extension = strrchr( source_filename, '.' );
+		job.buffer = read_whole_file( source_filename, &job.buffer_length );
+		if( job.buffer )
+		{
+			sprintf( name, "%s/%s", extension ? extension + 1 : "file", image->name );
+			bench_run( "decode", name, run_decode, &job,
+					image_megapixels( image ), job.buffer_length / (1024.0 * 1024.0) );
+			free( (void*)job.buffer );
+		}
+	}
+	for( i = 0; i < 5; ++i )
+	{
+		int written = 0;
+		sprintf( name, "%s/%s", extensions[i], image->name );
+		if( !bench_wanted( "decode", name ) )
+		{
+			continue;
+		}
+		switch( i )
+		{
+		case 0:
+			written = SOIL_save_image( BENCH_TEMP_FILE, SOIL_SAVE_TYPE_TGA,
+					image->width, image->height, image->channels, image->data );
+			break;
+		case 1:
+			written = SOIL_save_image( BENCH_TEMP_FILE, SOIL_SAVE_TYPE_BMP,
+					image->width, image->height, image->channels, image->data );
+			break;
+		case 2:
+			/*	decoding DDS is decoding DXT	*/
+			written = SOIL_save_image( BENCH_TEMP_FILE, SOIL_SAVE_TYPE_DDS,
+					image->width, image->height, image->channels, image->data );
+			break;
+		case 3:
+			written = write_PSD( BENCH_TEMP_FILE, image );
+			break;
+		default:
+			written = write_HDR( BENCH_TEMP_FILE, image );
+			break;
+		}
+		if( !written )
+		{
+			continue;
+		}
+		job.buffer = read_whole_file( BENCH_TEMP_FILE, &job.buffer_length );
+		if( job.buffer )
+		{
+			bench_run( "decode", name, run_decode, &job,
+					image_megapixels( image ), job.buffer_length / (1024.0 * 1024.0) );
+			free( (void*)job.buffer );
+		}
+	}
+}
+
+static void bench_resample( const bench_image *image )
+{
+	char name[200];
+	bench_job job;
+	memset( &job, 0, sizeof( job ) );
+	job.image = image;
+	/*	up to the next power of two (twice as large, if it already is one)	*/
+	job.output_width = 1;
+	while( job.output_width <= image->width )
+	{
+		job.output_width *= 2;
+	}
+	job.output_height = 1;
+	while( job.output_height <= image->height )
+	{
+		job.output_height *= 2;
+	}
+	job.output = (unsigned char*)malloc( job.output_width * job.output_height * image->channels );
+	if( NULL == job.output )
+	{
+		return;
+	}
+	sprintf( name, "up_scale/%s", image->name );
+	bench_run( "resample", name, run_up_scale, &job,
+			job.output_width * job.output_height / 1e6, 0.0 );
+	sprintf( name, "half/%s", image->name );
+	bench_run( "resample", name, run_mipmap, &job, image_megapixels( image ), image_megabytes( image ) );
+	sprintf( name, "mip_chain/%s", image->name );
+	bench_run( "mipmap", name, run_mip_chain, &job, image_megapixels( image ), image_megabytes( image ) );
+	free( job.output );
+}
+
+/*	compresses, then decodes to measure the quality	*/
+static bench_result* bench_compress_one( const bench_image *image, const char *name,
+		int format, int quality, bench_job *job )
+{
+	bench_result *result;
+	memset( job, 0, sizeof( bench_job ) );
+	job->image = image;
+	job->format = format;
+	job->quality = quality;
+	result = bench_run( "compress", name, run_compress, job,
+			image_megapixels( image ), image_megabytes( image ) );
+	if( result && job->output )
+	{
+		unsigned char *decoded = decode_blocks( job->output, format, image->width, image->height );
+		if( decoded )
+		{
+			switch( format )
+			{
+			case BENCH_BC4:
+				bench_metric( result, "psnr", PSNR( image, decoded, 0, 1 ) );
+				break;
+			case BENCH_BC5:
+				bench_metric( result, "psnr_rg", PSNR( image, decoded, 0, 2 ) );
+				break;
+			default:
+				bench_metric( result, "psnr_rgb", PSNR( image, decoded, 0, 3 ) );
+				if( (image->channels & 1) == 0 )
+				{
+					bench_metric( result, "psnr_alpha", PSNR( image, decoded, 3, 1 ) );
+				}
+				break;
+			}
+			free( decoded );
+		}
+	}
+	return result;
+}
+
+static void bench_compress( const bench_image *image, int slow_too )
+{
+	static const char *const quality_names[3] = { "fast", "default", "high" };
+	char name[200];
+	bench_job job;
+	int quality;
+	for( quality = DXT_QUALITY_FAST; quality <= DXT_QUALITY_HIGH; ++quality )
+	{
+		sprintf( name, "%s_%s/%s", ((image->channels & 1) == 1) ? "dxt1" : "dxt5",
+				quality_names[quality], image->name );
+		bench_compress_one( image, name,
+				((image->channels & 1) == 1) ? BENCH_DXT1 : BENCH_DXT5, quality, &job );
+		free( job.output );
+	}
+	sprintf( name, "bc7_fast/%s", image->name );
+	bench_compress_one( image, name, BENCH_BC7, BC7_PRESET_FAST, &job );
+	free( job.output );
+	if( slow_too )
+	{
+		sprintf( name, "bc7_slow/%s", image->name );
+		bench_compress_one( image, name, BENCH_BC7, BC7_PRESET_SLOW, &job );
+		free( job.output );
+	}
+}
+
+/*	the fast BC7 preset is meant for compressing at load time, at no more
+	than 3 times what convert_image_to_DXT5 takes on a photograph.  (BC7
+	uses every core, DXT5 one, so this is the wall clock time: see "cores")	*/
+static void bench_bc7_against_dxt5( const bench_image *image )
+{
+	char name[200];
+	bench_job dxt5_job, bc7_job;
+	bench_result *dxt5, *bc7;
+	memset( &dxt5_job, 0, sizeof( bench_job ) );
+	memset( &bc7_job, 0, sizeof( bench_job ) );
+	dxt5_job.image = bc7_job.image = image;
+	dxt5_job.format = BENCH_DXT5;
+	dxt5_job.quality = DXT_QUALITY_DEFAULT;
+	bc7_job.format = BENCH_BC7;
+	bc7_job.quality = BC7_PRESET_FAST;
+	sprintf( name, "dxt5/%s", image->name );
+	dxt5 = bench_run( "bc7_vs_dxt5", name, run_compress, &dxt5_job,
+			image_megapixels( image ), image_megabytes( image ) );
+	sprintf( name, "bc7_fast/%s", image->name );
+	bc7 = bench_run( "bc7_vs_dxt5", name, run_compress, &bc7_job,
+			image_megapixels( image ), image_megabytes( image ) );
+	if( dxt5 && bc7 )
+	{
+		bench_metric( bc7, "times_dxt5", bc7->best_ms / dxt5->best_ms );
+	}
+	free( dxt5_job.output );
+	free( bc7_job.output );
+}
+
+/*	BC5 against DXT5 with X in alpha and Y in green ("DXT5nm")	*/
+static void bench_normal_maps( const bench_image *normals )
+{
+	char name[200];
+	bench_image swizzled;
+	bench_result *result;
+	bench_job job;
+	unsigned char *decoded;
+	int i;
+	sprintf( name, "bc5/%s", normals->name );
+	result = bench_compress_one( normals, name, BENCH_BC5, 0, &job );
+	if( result && job.output &&
+		(NULL != (decoded = decode_blocks( job.output, BENCH_BC5, normals->width, normals->height ))) )
+	{
+		bench_metric( result, "angle_error_deg", normal_angle_error( normals, decoded, 0, 1 ) );
+		free( decoded );
+	}
+	free( job.output );
+	if( !bench_image_alloc( &swizzled, normals->name, normals->width, normals->height, 4 ) )
+	{
+		return;
+	}
+	for( i = 0; i < normals->width * normals->height; ++i )
+	{
+		swizzled.data[i * 4 + 0] = 255;
+		swizzled.data[i * 4 + 1] = normals->data[i * 3 + 1];
+		swizzled.data[i * 4 + 2] = 0;
+		swizzled.data[i * 4 + 3] = normals->data[i * 3 + 0];
+	}
+	sprintf( name, "dxt5nm/%s", normals->name );
+	memset( &job, 0, sizeof( job ) );
+	job.image = &swizzled;
+	job.format = BENCH_DXT5;
+	job.quality = DXT_QUALITY_DEFAULT;
+	result = bench_run( "compress", name, run_compress, &job,
+			image_megapixels( normals ), image_megabytes( normals ) );
+	if( result && job.output &&
+		(NULL != (decoded = decode_blocks( job.output, BENCH_DXT5, normals->width, normals->height ))) )
+	{
+		bench_metric( result, "angle_error_deg", normal_angle_error( normals, decoded, 3, 1 ) );
+		free( decoded );
+	}
+	free( job.output );
+	free( swizzled.data );
+}
+
+static void bench_writers( const bench_image *image )
+{
+	static const struct
+	{
+		const char *name;
+		int save_type;
+		int mipmapped;
+	}
+	writers[] =
+	{
+		{ "tga", SOIL_SAVE_TYPE_TGA, 0 },
+		{ "bmp", SOIL_SAVE_TYPE_BMP, 0 },
+		{ "dds_dxt", SOIL_SAVE_TYPE_DDS, 0 },
+		{ "dds_dxt_mipmapped", SOIL_SAVE_TYPE_DDS, 1 },
+		{ "dds_rgtc_mipmapped", SOIL_SAVE_TYPE_DDS_RGTC, 1 },
+		{ "dds_bc7_mipmapped", SOIL_SAVE_TYPE_DDS_BC7, 1 },
+		{ "ktx2_dxt_mipmapped", SOIL_SAVE_TYPE_KTX2, 1 }
+	};
+	char name[200];
+	bench_job job;
+	bench_result *result;
+	int i;
+	for( i = 0; i < (int)(sizeof( writers ) / sizeof( writers[0] )); ++i )
+	{
+		memset( &job, 0, sizeof( job ) );
+		job.image = image;
+		job.save_type = writers[i].save_type;
+		job.mipmapped = writers[i].mipmapped;
+		job.quality = SOIL_DXT_QUALITY_DEFAULT;
+		sprintf( name, "%s/%s", writers[i].name, image->name );
+		result = bench_run( "write", name, run_write, &job, image_megapixels( image ), 0.0 );
+		if( result )
+		{
+			/*	the bytes written	*/
+			result->megabytes = file_megabytes( BENCH_TEMP_FILE );
+		}
+	}
+}
+
+/*	the same MIPmapped image in both containers, read back	*/
+static void bench_containers( const bench_image *image )
+{
+	char name[200];
+	bench_job job;
+	int ktx2;
+	for( ktx2 = 0; ktx2 < 2; ++ktx2 )
+	{
+		sprintf( name, "%s_read/%s", ktx2 ? "ktx2" : "dds", image->name );
+		if( !bench_wanted( "container", name ) ||
+			!SOIL_save_image_mipmapped( BENCH_TEMP_FILE, ktx2 ? SOIL_SAVE_TYPE_KTX2 : SOIL_SAVE_TYPE_DDS,
+				image->width, image->height, image->channels, image->data, SOIL_DXT_QUALITY_FAST ) )
+		{
+			continue;
+		}
+		memset( &job, 0, sizeof( job ) );
+		job.format = ktx2;
+		bench_run( "container", name, run_container_read, &job,
+				image_megapixels( image ), file_megabytes( BENCH_TEMP_FILE ) );
+	}
+}
+
+#ifdef SOIL_BENCH_STUB_GL
+/*	reading a whole file and uploading every level of it, as it is	*/
+static void run_direct_upload( void *user_data )
+{
+	bench_job *job = (bench_job*)user_data;
+	job->texture_ID = SOIL_load_OGL_texture( BENCH_TEMP_FILE, SOIL_LOAD_AUTO,
+			job->texture_ID, SOIL_FLAG_DDS_LOAD_DIRECT );
+}
+
+/*	the same MIPmapped image in both containers, all the way to the
+	(stub) GPU: KTX2 against SOIL_direct_load_DDS.  The stub does not
+	hash the uploads, so this is all SOIL's time	*/
+static void bench_direct_uploads( const bench_image *image )
+{
+	char name[200];
+	bench_job job;
+	bench_result *result[2] = { NULL, NULL };
+	int ktx2;
+	memset( &job, 0, sizeof( job ) );
+	stub_gl_set_hashing( 0 );
+	for( ktx2 = 0; ktx2 < 2; ++ktx2 )
+	{
+		sprintf( name, "%s_direct/%s", ktx2 ? "ktx2" : "dds", image->name );
+		if( !bench_wanted( "upload", name ) ||
+			!SOIL_save_image_mipmapped( BENCH_TEMP_FILE, ktx2 ? SOIL_SAVE_TYPE_KTX2 : SOIL_SAVE_TYPE_DDS,
+				image->width, image->height, image->channels, image->data, SOIL_DXT_QUALITY_FAST ) )
+		{
+			continue;
+		}
+		job.texture_ID = 0;
+		result[ktx2] = bench_run( "upload", name, run_direct_upload, &job,
+				image_megapixels( image ), file_megabytes( BENCH_TEMP_FILE ) );
+		if( job.texture_ID )
+		{
+			SOIL_residency_forget( job.texture_ID );
+			glDeleteTextures( 1, &job.texture_ID );
+		} else
+		{
+			/*	a file that did not load has nothing to compare	*/
+			result[ktx2] = NULL;
+		}
+	}
+	if( result[0] && result[1] )
+	{
+		bench_metric( result[1], "times_dds", result[1]->best_ms / result[0]->best_ms );
+	}
+	stub_gl_set_hashing( 1 );
+}
+#endif
+
+/*	10000 sprites of 8 to 64 texels on 2048x2048 pages	*/
+static void bench_atlas( void )
+{
+	const int count = 10000;
+	int *sizes = (int*)malloc( 2 * count * sizeof( int ) );
+	image_atlas_rect *rects = (image_atlas_rect*)malloc( count * sizeof( image_atlas_rect ) );
+	bench_result *result;
+	bench_job job;
+	double area = 0.0;
+	int i;
+	if( (NULL == sizes) || (NULL == rects) )
+	{
+		free( sizes );
+		free( rects );
+		return;
+	}
+	for( i = 0; i < count; ++i )
+	{
+		sizes[i] = 8 + hash_2D( i, 0, 99 ) % 57;
+		sizes[count + i] = 8 + hash_2D( i, 1, 99 ) % 57;
+		area += (double)sizes[i] * sizes[count + i];
+	}
+	memset( &job, 0, sizeof( job ) );
+	job.buffer = (const unsigned char*)sizes;
+	job.buffer_length = count;
+	job.output = (unsigned char*)rects;
+	result = bench_run( "atlas", "pack_10000_sprites", run_atlas, &job, area / 1e6, 0.0 );
+	if( result && (job.output_size > 0) )
+	{
+		bench_metric( result, "pages", job.output_size );
+		bench_metric( result, "fill", area / (job.output_size * 2048.0 * 2048.0) );
+	}
+	free( sizes );
+	free( rects );
+}
+
+/*	starting up: many small DDS files, against one package of them	*/
+
+#define BENCH_PACKAGE_FILE	"soil_bench.pak"
+
+typedef struct
+{
+	int num_files;
+	char (*filenames)[32];
+	unsigned int checksum;
+}
+bench_startup;
+
+static void bench_file_name( char *name, int index )
+{
+	sprintf( name, "soil_bench_%04d.dds", index );
+}
+
+/*	reads every byte, as the upload to OpenGL would	*/
+static unsigned int bench_checksum( const unsigned char *data, size_t size )
+{
+	unsigned int sum = 0;
+	size_t i;
+	for( i = 0; i < size; ++i )
+	{
+		sum += data[i];
+	}
+	return sum;
+}
+
+/*	what SOIL_direct_load_DDS does before the upload	*/
+static void run_startup_files( void *user_data )
+{
+	bench_startup *startup = (bench_startup*)user_data;
+	int i, length;
+	for( i = 0; i < startup->num_files; ++i )
+	{
+		unsigned char *buffer = read_whole_file( startup->filenames[i], &length );
+		if( buffer && (length > 128) && (0 == memcmp( buffer, "DDS ", 4 )) )
+		{
+			startup->checksum += bench_checksum( buffer + 128, length - 128 );
+		}
+		free( buffer );
+	}
+}
+
+/*	what SOIL_open_package and SOIL_load_OGL_texture_from_package do	*/
+static void run_startup_package( void *user_data )
+{
+	bench_startup *startup = (bench_startup*)user_data;
+	texture_package package;
+	texture_package_entry entry;
+	int i;
+	if( !texture_package_open( &package, BENCH_PACKAGE_FILE ) )
+	{
+		return;
+	}
+	for( i = 0; i < startup->num_files; ++i )
+	{
+		if( texture_package_find( &package, startup->filenames[i], &entry ) && (entry.size > 128) )
+		{
+			startup->checksum += bench_checksum( entry.data + 128, entry.size - 128 );
+		}
+	}
+	texture_package_close( &package );
+}
+
+#ifdef BENCH_CAN_EVICT
+static void bench_evict_file( const char *filename )
+{
+	int fd = open( filename, O_RDONLY );
+	if( fd >= 0 )
+	{
+		posix_fadvise( fd, 0, 0, POSIX_FADV_DONTNEED );
+		close( fd );
+	}
+}
+
+static void evict_startup_files( void *user_data )
+{
+	bench_startup *startup = (bench_startup*)user_data;
+	int i;
+	for( i = 0; i < startup->num_files; ++i )
+	{
+		bench_evict_file( startup->filenames[i] );
+	}
+}
+
+static void evict_startup_package( void *user_data )
+{
+	(void)user_data;
+	bench_evict_file( BENCH_PACKAGE_FILE );
+}
+
+/*	the pages written have to reach the disk before they can be dropped	*/
+static void bench_sync_file( const char *filename )
+{
+	int fd = open( filename, O_RDONLY );
+	if( fd >= 0 )
+	{
+		fsync( fd );
+		close( fd );
+	}
+}
+#endif
+
+static void bench_startup_times( const bench_image *image, int num_files )
+{
+	bench_startup startup;
+	texture_package_writer writer;
+	bench_result *result;
+	unsigned char *dds;
+	char names[4][64];
+	int dds_length = 0, written = 1, i;
+	double megabytes;
+	sprintf( names[0], "%d_files_warm", num_files );
+	sprintf( names[1], "package_of_%d_warm", num_files );
+	sprintf( names[2], "%d_files_cold", num_files );
+	sprintf( names[3], "package_of_%d_cold", num_files );
+	if( !bench_wanted( "startup", names[0] ) && !bench_wanted( "startup", names[1] ) &&
+		!bench_wanted( "startup", names[2] ) && !bench_wanted( "startup", names[3] ) )
+	{
+		return;
+	}
+	/*	the same baked texture in every file	*/
+	if( !SOIL_save_image_mipmapped( BENCH_TEMP_FILE, SOIL_SAVE_TYPE_DDS,
+			image->width, image->height, image->channels, image->data, SOIL_DXT_QUALITY_FAST ) ||
+		(NULL == (dds = read_whole_file( BENCH_TEMP_FILE, &dds_length ))) )
+	{
+		return;
+	}
+	memset( &startup, 0, sizeof( startup ) );
+	startup.num_files = num_files;
+	startup.filenames = (char (*)[32])malloc( num_files * 32 );
+	if( NULL == startup.filenames )
+	{
+		free( dds );
+		return;
+	}
+	written = texture_package_writer_open( &writer, BENCH_PACKAGE_FILE );
+	for( i = 0; written && (i < num_files); ++i )
+	{
+		FILE *f;
+		bench_file_name( startup.filenames[i], i );
+		f = fopen( startup.filenames[i], "wb" );
+		written = f && (fwrite( dds, 1, dds_length, f ) == (size_t)dds_length);
+		if( f && (fclose( f ) != 0) )
+		{
+			written = 0;
+		}
+		written = written && texture_package_writer_add( &writer, startup.filenames[i], dds, dds_length );
+	}
+	written = texture_package_writer_close( &writer ) && written;
+	megabytes = num_files * (double)dds_length / (1024.0 * 1024.0);
+	if( written )
+	{
+		result = bench_run( "startup", names[0], run_startup_files, &startup, 0.0, megabytes );
+		bench_metric( result, "files", num_files );
+		result = bench_run( "startup", names[1], run_startup_package, &startup, 0.0, megabytes );
+		bench_metric( result, "files", 1 );
+#ifdef BENCH_CAN_EVICT
+		for( i = 0; i < num_files; ++i )
+		{
+			bench_sync_file( startup.filenames[i] );
+		}
+		bench_sync_file( BENCH_PACKAGE_FILE );
+		/*	a cold cache, as right after booting	*/
+		bench_before_run = evict_startup_files;
+		result = bench_run( "startup", names[2], run_startup_files, &startup, 0.0, megabytes );
+		bench_metric( result, "files", num_files );
+		bench_before_run = evict_startup_package;
+		result = bench_run( "startup", names[3], run_startup_package, &startup, 0.0, megabytes );
+		bench_metric( result, "files", 1 );
+		bench_before_run = NULL;
+#else
+		printf( "startup: the page cache can't be emptied here, no cold start times\n" );
+#endif
+	}
+	for( i = 0; i < num_files; ++i )
+	{
+		char filename[32];
+		bench_file_name( filename, i );
+		remove( filename );
+	}
+	remove( BENCH_PACKAGE_FILE );
+	free( startup.filenames );
+	free( dds );
+}
+
+/*	playing animations: the CPU cost of each frame, decoding only what
+	changed against whole frames, and from the frame cache	*/
+
+#define BENCH_ANIM_SIZE		256
+#define BENCH_ANIM_FRAMES	48
+#define BENCH_ANIM_SPRITE	20
+
+typedef struct
+{
+	const unsigned char *buffer;
+	int buffer_length;
+	size_t cache_bytes;
+	image_anim anim;
+	double dirty_pixels;
+	int frames_played;
+}
+bench_animation;
+
+/*	a disc going round over a still background	*/
+static void bench_sprite_center( int frame, int *x, int *y )
+{
+	double angle = frame * 2.0 * 3.14159265358979 / BENCH_ANIM_FRAMES;
+	*x = BENCH_ANIM_SIZE / 2 + (int)(80.0 * cos( angle ));
+	*y = BENCH_ANIM_SIZE / 2 + (int)(80.0 * sin( angle ));
+}
+
+static void bench_frame_pixel( const bench_image *background, int frame, int x, int y,
+		unsigned char rgba[4] )
+{
+	int cx, cy;
+	bench_sprite_center( frame, &cx, &cy );
+	if( (x - cx) * (x - cx) + (y - cy) * (y - cy) <= BENCH_ANIM_SPRITE * BENCH_ANIM_SPRITE )
+	{
+		rgba[0] = 255;
+		rgba[1] = 220;
+		rgba[2] = 40;
+	} else
+	{
+		const unsigned char *p = background->data +
+				(y * background->width + x) * background->channels;
+		rgba[0] = p[0];
+		rgba[1] = p[1];
+		rgba[2] = p[2];
+	}
+	rgba[3] = 255;
+}
+
+/*	what has to be redrawn for a frame: where the disc was and is now
+	(or everything)	*/
+static void bench_frame_rect( int frame, int whole, int rect[4] )
+{
+	int x0, y0, x1, y1, r = BENCH_ANIM_SPRITE + 1;
+	if( whole || (frame == 0) )
+	{
+		rect[0] = rect[1] = 0;
+		rect[2] = rect[3] = BENCH_ANIM_SIZE;
+		return;
+	}
+	bench_sprite_center( frame - 1, &x0, &y0 );
+	bench_sprite_center( frame, &x1, &y1 );
+	rect[0] = (x0 < x1 ? x0 : x1) - r;
+	rect[1] = (y0 < y1 ? y0 : y1) - r;
+	rect[2] = (x0 > x1 ? x0 : x1) + r - rect[0];
+	rect[3] = (y0 > y1 ? y0 : y1) + r - rect[1];
+}
+
+static void put_le16( FILE *f, int value )
+{
+	fputc( value & 255, f );
+	fputc( (value >> 8) & 255, f );
+}
+
+/*	the LZW codes of a GIF image, packed LSB first into sub-blocks	*/
+typedef struct
+{
+	FILE *f;
+	unsigned int bits;
+	int num_bits;
+	unsigned char block[255];
+	int block_size;
+}
+gif_code_writer;
+
+static void gif_put_code( gif_code_writer *w, int code, int code_size )
+{
+	w->bits |= (unsigned int)code << w->num_bits;
+	w->num_bits += code_size;
+	while( w->num_bits >= 8 )
+	{
+		w->block[w->block_size++] = (unsigned char)(w->bits & 255);
+		w->bits >>= 8;
+		w->num_bits -= 8;
+		if( w->block_size == 255 )
+		{
+			fputc( 255, w->f );
+			fwrite( w->block, 1, 255, w->f );
+			w->block_size = 0;
+		}
+	}
+}
+
+/*	8 bit LZW, with a hash table for the dictionary	*/
+static void write_gif_lzw( FILE *f, const unsigned char *indices, int count )
+{
+	enum { HASH_SIZE = 5003 };
+	int keys[HASH_SIZE], codes[HASH_SIZE];
+	gif_code_writer w;
+	int prefix, next_code = 258, code_size = 9, i, h;
+	memset( &w, 0, sizeof( w ) );
+	w.f = f;
+	memset( keys, -1, sizeof( keys ) );
+	fputc( 8, f );
+	gif_put_code( &w, 256, code_size );
+	prefix = indices[0];
+	for( i = 1; i < count; ++i )
+	{
+		int key = (prefix << 8) | indices[i];
+		for( h = key % HASH_SIZE; (keys[h] >= 0) && (keys[h] != key); h = (h + 1) % HASH_SIZE )
+		{
+		}
+		if( keys[h] == key )
+		{
+			prefix = codes[h];
+			continue;
+		}
+		gif_put_code( &w, prefix, code_size );
+		if( next_code < 4096 )
+		{
+			keys[h] = key;
+			codes[h] = next_code++;
+			if( next_code > (1 << code_size) )
+			{
+				++code_size;
+			}
+		} else
+		{
+			/*	the dictionary is full, start over	*/
+			gif_put_code( &w, 256, code_size );
+			memset( keys, -1, sizeof( keys ) );
+			next_code = 258;
+			code_size = 9;
+		}
+		prefix = indices[i];
+	}
+	gif_put_code( &w, prefix, code_size );
+	gif_put_code( &w, 257, code_size );
+	gif_put_code( &w, 0, 7 );
+	if( w.block_size > 0 )
+	{
+		fputc( w.block_size, f );
+		fwrite( w.block, 1, w.block_size, f );
+	}
+	fputc( 0, f );
+}
+
+/*	an animated GIF, 3-3-2 bit colours	*/
+static int write_animated_GIF( const char *filename, const bench_image *background, int whole_frames )
+{
+	FILE *f = fopen( filename, "wb" );
+	unsigned char *indices = (unsigned char*)malloc( BENCH_ANIM_SIZE * BENCH_ANIM_SIZE );
+	int frame, x, y, i, ok;
+	if( (NULL == f) || (NULL == indices) )
+	{
+		if( f )
+		{
+			fclose( f );
+		}
+		free( indices );
+		return 0;
+	}
+	fwrite( "GIF89a", 1, 6, f );
+	put_le16( f, BENCH_ANIM_SIZE );
+	put_le16( f, BENCH_ANIM_SIZE );
+	fputc( 0xF7, f );
+	fputc( 0, f );
+	fputc( 0, f );
+	for( i = 0; i < 256; ++i )
+	{
+		fputc( ((i >> 5) & 7) * 255 / 7, f );
+		fputc( ((i >> 2) & 7) * 255 / 7, f );
+		fputc( (i & 3) * 255 / 3, f );
+	}
+	/*	forever	*/
+	fputc( 0x21, f );
+	fputc( 0xFF, f );
+	fputc( 11, f );
+	fwrite( "NETSCAPE2.0", 1, 11, f );
+	fputc( 3, f );
+	fputc( 1, f );
+	put_le16( f, 0 );
+	fputc( 0, f );
+	for( frame = 0; frame < BENCH_ANIM_FRAMES; ++frame )
+	{
+		int rect[4], count = 0;
+		bench_frame_rect( frame, whole_frames, rect );
+		/*	graphic control: 30 ms, leave it in place	*/
+		fputc( 0x21, f );
+		fputc( 0xF9, f );
+		fputc( 4, f );
+		fputc( 1 << 2, f );
+		put_le16( f, 3 );
+		fputc( 0, f );
+		fputc( 0, f );
+		fputc( 0x2C, f );
+		for( i = 0; i < 4; ++i )
+		{
+			put_le16( f, rect[i] );
+		}
+		fputc( 0, f );
+		for( y = rect[1]; y < rect[1] + rect[3]; ++y )
+		{
+			for( x = rect[0]; x < rect[0] + rect[2]; ++x )
+			{
+				unsigned char rgba[4];
+				bench_frame_pixel( background, frame, x, y, rgba );
+				indices[count++] = (rgba[0] & 0xE0) | ((rgba[1] >> 3) & 0x1C) | (rgba[2] >> 6);
+			}
+		}
+		write_gif_lzw( f, indices, count );
+	}
+	fputc( 0x3B, f );
+	free( indices );
+	ok = !ferror( f );
+	return (fclose( f ) == 0) && ok;
+}
+
+static unsigned int bench_crc32( unsigned int crc, const unsigned char *data, int length )
+{
+	static unsigned int table[256];
+	int i, k;
+	if( table[1] == 0 )
+	{
+		for( i = 0; i < 256; ++i )
+		{
+			unsigned int c = (unsigned int)i;
+			for( k = 0; k < 8; ++k )
+			{
+				c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+			}
+			table[i] = c;
+		}
+	}
+	crc = ~crc;
+	for( i = 0; i < length; ++i )
+	{
+		crc = table[(crc ^ data[i]) & 255] ^ (crc >> 8);
+	}
+	return ~crc;
+}
+
+static void put_png_chunk( FILE *f, const char *type, const unsigned char *data, int length )
+{
+	put_be32( f, (unsigned int)length );
+	fwrite( type, 1, 4, f );
+	fwrite( data, 1, length, f );
+	put_be32( f, bench_crc32( bench_crc32( 0, (const unsigned char*)type, 4 ), data, length ) );
+}
+
+/*	zlib: stored deflate blocks, then the Adler-32
+	\return the bytes written	*/
+static int stored_zlib( unsigned char *out, const unsigned char *raw, int size )
+{
+	unsigned char *start = out;
+	int i, stored, adler_a = 1, adler_b = 0;
+	*out++ = 0x78;
+	*out++ = 0x01;
+	for( i = 0; i < size; i += stored )
+	{
+		stored = (size - i < 65535) ? size - i : 65535;
+		*out++ = (i + stored == size) ? 1 : 0;
+		*out++ = (unsigned char)(stored & 255);
+		*out++ = (unsigned char)(stored >> 8);
+		*out++ = (unsigned char)(~stored & 255);
+		*out++ = (unsigned char)((~stored >> 8) & 255);
+		memcpy( out, raw + i, stored );
+		out += stored;
+	}
+	for( i = 0; i < size; ++i )
+	{
+		adler_a = (adler_a + raw[i]) % 65521;
+		adler_b = (adler_b + adler_a) % 65521;
+	}
+	out[0] = (unsigned char)(adler_b >> 8);
+	out[1] = (unsigned char)adler_b;
+	out[2] = (unsigned char)(adler_a >> 8);
+	out[3] = (unsigned char)adler_a;
+	return (int)(out + 4 - start);
+}
+
+/*	an APNG, each frame deflated with stored blocks (the inflate of a
+	real encoder's output costs more, but what is measured here is the
+	work around it)	*/
+static int write_animated_PNG( const char *filename, const bench_image *background, int whole_frames )
+{
+	FILE *f = fopen( filename, "wb" );
+	int raw_size = (BENCH_ANIM_SIZE * 4 + 1) * BENCH_ANIM_SIZE;
+	unsigned char *chunk = (unsigned char*)malloc( 4 + 2 + raw_size + 5 * (raw_size / 65535 + 1) + 4 );
+	unsigned char *raw = (unsigned char*)malloc( raw_size );
+	unsigned char header[26];
+	int frame, sequence = 0, ok;
+	if( (NULL == f) || (NULL == chunk) || (NULL == raw) )
+	{
+		if( f )
+		{
+			fclose( f );
+		}
+		free( chunk );
+		free( raw );
+		return 0;
+	}
+	fwrite( "\x89PNG\r\n\x1A\n", 1, 8, f );
+	memset( header, 0, sizeof( header ) );
+	header[2] = header[6] = BENCH_ANIM_SIZE >> 8;
+	header[3] = header[7] = BENCH_ANIM_SIZE & 255;
+	header[8] = 8;
+	header[9] = 6;
+	put_png_chunk( f, "IHDR", header, 13 );
+	memset( header, 0, 8 );
+	header[3] = BENCH_ANIM_FRAMES;
+	put_png_chunk( f, "acTL", header, 8 );
+	for( frame = 0; frame < BENCH_ANIM_FRAMES; ++frame )
+	{
+		int rect[4], size = 0, x, y, i;
+		unsigned char *out = chunk + 4;
+		bench_frame_rect( frame, whole_frames, rect );
+		/*	fcTL: 30 ms, leave it in place, draw over it as it is	*/
+		memset( header, 0, sizeof( header ) );
+		header[3] = (unsigned char)sequence++;
+		for( i = 0; i < 4; ++i )
+		{
+			int value = rect[i < 2 ? i + 2 : i - 2];
+			header[4 + i * 4 + 2] = (unsigned char)(value >> 8);
+			header[4 + i * 4 + 3] = (unsigned char)value;
+		}
+		header[21] = 3;
+		header[23] = 100;
+		put_png_chunk( f, "fcTL", header, 26 );
+		for( y = rect[1]; y < rect[1] + rect[3]; ++y )
+		{
+			raw[size++] = 0;
+			for( x = rect[0]; x < rect[0] + rect[2]; ++x, size += 4 )
+			{
+				bench_frame_pixel( background, frame, x, y, raw + size );
+			}
+		}
+		out += stored_zlib( out, raw, size );
+		if( frame == 0 )
+		{
+			put_png_chunk( f, "IDAT", chunk + 4, (int)(out - chunk - 4) );
+		} else
+		{
+			chunk[0] = chunk[1] = chunk[2] = 0;
+			chunk[3] = (unsigned char)sequence++;
+			put_png_chunk( f, "fdAT", chunk, (int)(out - chunk) );
+		}
+	}
+	put_png_chunk( f, "IEND", header, 0 );
+	free( chunk );
+	free( raw );
+	ok = !ferror( f );
+	return (fclose( f ) == 0) && ok;
+}
+
+/*	opens the animation and plays it through once, as a player starting
+	it would	*/
+static void run_animation( void *user_data )
+{
+	bench_animation *playback = (bench_animation*)user_data;
+	image_anim_rect dirty;
+	int i;
+	if( !image_anim_open_memory( &playback->anim, playback->buffer, playback->buffer_length ) )
+	{
+		return;
+	}
+	playback->dirty_pixels = 0.0;
+	for( i = 0; i < playback->anim.num_frames; ++i )
+	{
+		if( image_anim_next( &playback->anim, &dirty ) < 0 )
+		{
+			break;
+		}
+		playback->dirty_pixels += (double)dirty.width * dirty.height;
+	}
+	playback->frames_played = i;
+	image_anim_free( &playback->anim );
+}
+
+/*	one more loop of an animation that is already playing, with every
+	frame in the cache	*/
+static void run_animation_loop( void *user_data )
+{
+	bench_animation *playback = (bench_animation*)user_data;
+	int i;
+	for( i = 0; i < playback->anim.num_frames; ++i )
+	{
+		image_anim_next( &playback->anim, NULL );
+	}
+	playback->frames_played = i;
+}
+
+static void bench_animations( const bench_image *background )
+{
+	static const char *const formats[2] = { "gif", "apng" };
+	int format, whole;
+	for( format = 0; format < 2; ++format )
+	{
+		for( whole = 0; whole < 2; ++whole )
+		{
+			bench_animation playback;
+			bench_result *result;
+			char name[64];
+			double megapixels = (double)BENCH_ANIM_SIZE * BENCH_ANIM_SIZE * BENCH_ANIM_FRAMES / 1e6;
+			unsigned char *buffer;
+			int length = 0;
+			sprintf( name, "%s_%d_frames_%s", formats[format], BENCH_ANIM_FRAMES,
+					whole ? "whole" : "changed_only" );
+			if( !bench_wanted( "animation", name ) )
+			{
+				continue;
+			}
+			if( format == 0 )
+			{
+				buffer = write_animated_GIF( BENCH_TEMP_FILE, background, whole ) ?
+						read_whole_file( BENCH_TEMP_FILE, &length ) : NULL;
+			} else
+			{
+				buffer = write_animated_PNG( BENCH_TEMP_FILE, background, whole ) ?
+						read_whole_file( BENCH_TEMP_FILE, &length ) : NULL;
+			}
+			if( NULL == buffer )
+			{
+				continue;
+			}
+			memset( &playback, 0, sizeof( playback ) );
+			playback.buffer = buffer;
+			playback.buffer_length = length;
+			result = bench_run( "animation", name, run_animation, &playback,
+					megapixels, length / (1024.0 * 1024.0) );
+			if( result && (playback.frames_played > 0) )
+			{
+				bench_metric( result, "ms_per_frame", result->best_ms / playback.frames_played );
+				bench_metric( result, "changed_fraction", playback.dirty_pixels /
+						((double)BENCH_ANIM_SIZE * BENCH_ANIM_SIZE * playback.frames_played) );
+			}
+			/*	the second time round, from the cache	*/
+			strcat( name, "_cached" );
+			if( !whole && image_anim_open_memory( &playback.anim, buffer, length ) )
+			{
+				int i;
+				image_anim_set_cache( &playback.anim,
+						(size_t)BENCH_ANIM_SIZE * BENCH_ANIM_SIZE * 4 * BENCH_ANIM_FRAMES );
+				for( i = 0; i < BENCH_ANIM_FRAMES; ++i )
+				{
+					image_anim_next( &playback.anim, NULL );
+				}
+				result = bench_run( "animation", name, run_animation_loop, &playback, megapixels, 0.0 );
+				if( result )
+				{
+					bench_metric( result, "ms_per_frame", result->best_ms / BENCH_ANIM_FRAMES );
+					bench_metric( result, "cache_hit_rate", playback.anim.cache_hits /
+							((double)result->iterations * BENCH_ANIM_FRAMES) );
+				}
+				image_anim_free( &playback.anim );
+			}
+			free( buffer );
+		}
+	}
+}
+
+/*	the checks, most of them run against the stub OpenGL (bench/stub_gl.c)	*/
+
+static int num_errors = 0;
+
+static void bench_check( int ok, const char *what )
+{
+	if( !ok )
+	{
+		printf( "error: %s\n", what );
+		++num_errors;
+	}
+}
+
+static unsigned char* compress_whole_level( const unsigned char *level,
+		int width, int height, int channels, int format, int *size )
+{
+	switch( format )
+	{
+	case DDS_STREAM_DXT:
+		return (channels & 1) ?
+				convert_image_to_DXT1_quality( level, width, height, channels, DXT_QUALITY_DEFAULT, size ) :
+				convert_image_to_DXT5_quality( level, width, height, channels, DXT_QUALITY_DEFAULT, size );
+	case DDS_STREAM_RGTC:
+		return (channels == 1) ?
+				convert_image_to_BC4( level, width, height, channels, size ) :
+				convert_image_to_BC5( level, width, height, channels, size );
+	default:
+		return convert_image_to_BC7( level, width, height, channels, BC7_PRESET_FAST, size );
+	}
+}
+
+/*	a streamed DDS has, level by level, the bytes of the whole levels
+	built with mipmap_image and converted, the partial blocks on the
+	edges too (this needs no OpenGL)	*/
+static void check_DDS_stream( const bench_image *image )
+{
+	static const int sizes[4][2] = { { 5, 3 }, { 37, 23 }, { 3, 70 }, { 129, 7 } };
+	static const char *const format_names[3] = { "DXT", "RGTC", "BC7" };
+	unsigned char *level, *next, *file;
+	int s, channels, format, i, x, y, c, length;
+	char what[128];
+	for( s = 0; s < 4; ++s )
+	for( channels = 1; channels <= 4; ++channels )
+	for( format = DDS_STREAM_DXT; format <= DDS_STREAM_BC7; ++format )
+	{
+		int width = sizes[s][0], height = sizes[s][1];
+		int num_levels = count_mipmap_levels( width, height );
+		int offset = (format == DDS_STREAM_BC7) ? 148 : 128;
+		int same = 1;
+		level = (unsigned char*)malloc( width * height * channels );
+		next = (unsigned char*)malloc( width * height * channels );
+		if( (NULL == level) || (NULL == next) ||
+			(width > image->width) || (height > image->height) )
+		{
+			free( level );
+			free( next );
+			return;
+		}
+		for( y = 0; y < height; ++y )
+		for( x = 0; x < width; ++x )
+		for( c = 0; c < channels; ++c )
+		{
+			level[(y*width + x)*channels + c] =
+					image->data[(y*image->width + x)*image->channels + c % image->channels];
+		}
+		file = save_image_as_DDS_mipmapped( BENCH_TEMP_FILE, width, height, channels,
+				level, format, DXT_QUALITY_DEFAULT ) ? read_whole_file( BENCH_TEMP_FILE, &length ) : NULL;
+		for( i = 0; same && (i < num_levels); ++i )
+		{
+			int size;
+			unsigned char *blocks = compress_whole_level( level, width, height, channels, format, &size );
+			unsigned char *swap = level;
+			same = (NULL != file) && (NULL != blocks) && (offset + size <= length) &&
+					(0 == memcmp( &file[offset], blocks, size ));
+			free( blocks );
+			offset += size;
+			mipmap_image( level, width, height, channels, next, 2, 2 );
+			level = next;
+			next = swap;
+			width = (width > 1) ? width / 2 : 1;
+			height = (height > 1) ? height / 2 : 1;
+		}
+		sprintf( what, "DDS stream: %dx%d, %d channels, %s is not what converting whole levels gives",
+				sizes[s][0], sizes[s][1], channels, format_names[format] );
+		bench_check( same, what );
+		free( file );
+		free( level );
+		free( next );
+	}
+	remove( BENCH_TEMP_FILE );
+}
+
+/*	a 4x4 APNG whose second frame (disposed to the previous canvas) has
+	the given x, y, width and height, its data left all 0	*/
+static int write_APNG_frame_rect( const char *filename, const unsigned int rect[4] )
+{
+	FILE *f = fopen( filename, "wb" );
+	unsigned char header[26], raw[(4 * 4 + 1) * 4], chunk[4 + sizeof( raw ) + 32];
+	int frame, i, ok;
+	if( NULL == f )
+	{
+		return 0;
+	}
+	memset( raw, 0, sizeof( raw ) );
+	fwrite( "\x89PNG\r\n\x1A\n", 1, 8, f );
+	memset( header, 0, sizeof( header ) );
+	header[3] = header[7] = 4;
+	header[8] = 8;
+	header[9] = 6;
+	put_png_chunk( f, "IHDR", header, 13 );
+	memset( header, 0, 8 );
+	header[3] = 2;
+	put_png_chunk( f, "acTL", header, 8 );
+	for( frame = 0; frame < 2; ++frame )
+	{
+		static const unsigned int whole[4] = { 0, 0, 4, 4 };
+		const unsigned int *r = frame ? rect : whole;
+		memset( header, 0, sizeof( header ) );
+		header[3] = (unsigned char)(frame * 2);
+		for( i = 0; i < 4; ++i )
+		{
+			unsigned int value = r[i < 2 ? i + 2 : i - 2];
+			header[4 + i * 4 + 0] = (unsigned char)(value >> 24);
+			header[4 + i * 4 + 1] = (unsigned char)(value >> 16);
+			header[4 + i * 4 + 2] = (unsigned char)(value >> 8);
+			header[4 + i * 4 + 3] = (unsigned char)value;
+		}
+		header[21] = 3;
+		header[23] = 100;
+		header[24] = frame ? 2 : 0;
+		put_png_chunk( f, "fcTL", header, 26 );
+		if( frame == 0 )
+		{
+			put_png_chunk( f, "IDAT", chunk + 4, stored_zlib( chunk + 4, raw, sizeof( raw ) ) );
+		} else
+		{
+			chunk[0] = chunk[1] = chunk[2] = 0;
+			chunk[3] = 3;
+			put_png_chunk( f, "fdAT", chunk, 4 + stored_zlib( chunk + 4, raw, (3 * 4 + 1) * 3 ) );
+		}
+	}
+	put_png_chunk( f, "IEND", header, 0 );
+	ok = !ferror( f );
+	return (fclose( f ) == 0) && ok;
+}
+
+/*	an APNG frame has to be on the canvas, all of it: one that is not
+	(or that only fits by overflowing x + width) is refused when the
+	file is opened, a good one plays	*/
+static void check_APNG_frame_bounds( void )
+{
+	static const struct
+	{
+		unsigned int rect[4];
+		int good;
+	}
+	cases[] =
+	{
+		{ { 1, 1, 3, 3 }, 1 },
+		{ { 1, 0, 4, 4 }, 0 },
+		{ { 0, 3, 4, 2 }, 0 },
+		{ { 1, 0, 0x7FFFFFFF, 4 }, 0 },
+		{ { 0, 1, 4, 0x7FFFFFFF }, 0 },
+		{ { 0x7FFFFFFF, 0, 2, 4 }, 0 }
+	};
+	char what[128];
+	int i;
+	for( i = 0; i < (int)(sizeof( cases ) / sizeof( cases[0] )); ++i )
+	{
+		image_anim anim;
+		unsigned char *file = NULL;
+		int length = 0, opened = 0, ok = 0;
+		if( write_APNG_frame_rect( BENCH_TEMP_FILE, cases[i].rect ) )
+		{
+			file = read_whole_file( BENCH_TEMP_FILE, &length );
+		}
+		if( file )
+		{
+			opened = image_anim_open_memory( &anim, file, length );
+			ok = (opened == cases[i].good);
+		}
+		if( opened )
+		{
+			ok = ok && (image_anim_next( &anim, NULL ) == 0) &&
+					(image_anim_next( &anim, NULL ) == 1) &&
+					(image_anim_next( &anim, NULL ) == 0);
+			image_anim_free( &anim );
+		}
+		sprintf( what, "APNG frames: a frame at %u,%u of %ux%u on a 4x4 canvas was %s",
+				cases[i].rect[0], cases[i].rect[1], cases[i].rect[2], cases[i].rect[3],
+				cases[i].good ? "not played" : "not refused" );
+		bench_check( ok, what );
+		free( file );
+	}
+	remove( BENCH_TEMP_FILE );
+}
+
+#ifdef SOIL_BENCH_STUB_GL
+
+/*	an evicted texture keeps nothing but its 1x1 placeholder, and
+	touching it brings every level back	*/
+static void check_residency( const bench_image *image )
+{
+	bench_image crop = crop_image( image, 256 );
+	unsigned int textures[2], i;
+	size_t bytes;
+	if( (NULL == crop.data) || !SOIL_save_image( BENCH_TEMP_FILE, SOIL_SAVE_TYPE_TGA,
+			crop.width, crop.height, crop.channels, crop.data ) )
+	{
+		bench_check( 0, "residency: could not write the texture" );
+		free( crop.data );
+		return;
+	}
+	free( crop.data );
+	stub_gl_reset();
+	SOIL_residency_set_budget( 0, SOIL_RESIDENCY_EVICT_LRU );
+	for( i = 0; i < 2; ++i )
+	{
+		textures[i] = SOIL_load_OGL_texture( BENCH_TEMP_FILE, SOIL_LOAD_AUTO,
+				SOIL_CREATE_NEW_ID, SOIL_FLAG_MIPMAPS );
+	}
+	bench_check( textures[0] && textures[1] &&
+			(stub_gl_levels_with_storage( textures[0] ) == 9),
+			"residency: the textures were not loaded with 9 levels" );
+	bytes = SOIL_residency_texture_bytes( textures[0] );
+	bench_check( bytes == stub_gl_texture_bytes( textures[0] ),
+			"residency: the manager and the GPU disagree on the bytes of a texture" );
+	/*	room for one and a half of them, the first one has to go	*/
+	SOIL_residency_touch( textures[1] );
+	SOIL_residency_set_budget( bytes + bytes / 2, SOIL_RESIDENCY_EVICT_LRU );
+	bench_check( SOIL_residency_texture_bytes( textures[0] ) == 0,
+			"residency: the least recently used texture was not evicted" );
+	bench_check( (stub_gl_levels_with_storage( textures[0] ) == 1) &&
+			(stub_gl_texture_bytes( textures[0] ) == 4) &&
+			(stub_gl_max_level( textures[0] ) == 0),
+			"residency: an evicted texture kept more than its 1x1 placeholder" );
+	bench_check( stub_gl_levels_with_storage( textures[1] ) == 9,
+			"residency: the texture in use was evicted" );
+	SOIL_residency_set_budget( 0, SOIL_RESIDENCY_EVICT_LRU );
+	bench_check( SOIL_residency_touch( textures[0] ) &&
+			(stub_gl_levels_with_storage( textures[0] ) == 9) &&
+			(stub_gl_texture_bytes( textures[0] ) == bytes) &&
+			(stub_gl_max_level( textures[0] ) >= 8),
+			"residency: touching an evicted texture did not bring back all its levels" );
+	for( i = 0; i < 2; ++i )
+	{
+		SOIL_residency_forget( textures[i] );
+		glDeleteTextures( 1, &textures[i] );
+	}
+	remove( BENCH_TEMP_FILE );
+}
+
+/*	a DXT DDS loaded with SOIL_FLAG_COMPRESS_TO_DXT keeps the blocks in
+	the file, only the levels the file is missing are compressed (and
+	counted by num_DXT_conversions).  The first block of every level in
+	the file is one the DXT encoder never writes (both end points the
+	same, every index 1), so decoding the file and compressing it again
+	can not give the same bytes.  In a DXT1 file with cut out texels
+	(every index 3, in the 3 color mode) the missing levels need the
+	alpha, which the DXT1 encoder does not have: unless the file has
+	every level, it is all decoded and compressed to DXT5 as before	*/
+static void check_DDS_keeps_blocks( const bench_image *image )
+{
+	enum { size = 64, num_levels = 7 };
+	static const struct
+	{
+		const char *name;
+		int channels, cut_out;
+	}
+	kinds[3] =
+	{
+		{ "DXT5", 4, 0 }, { "DXT1", 3, 0 }, { "DXT1 with cut out texels", 3, 1 }
+	};
+	static const int pass_levels[3] = { num_levels, 3, 1 };
+	unsigned char *pixels = (unsigned char*)malloc( size * size * 4 );
+	unsigned int level_hash[num_levels], texture;
+	int level_end[num_levels];
+	char what[160];
+	int kind, pass, i, x, y, c;
+	if( (NULL == pixels) || (size > image->width) || (size > image->height) )
+	{
+		bench_check( 0, "DDS blocks: could not make the image" );
+		free( pixels );
+		return;
+	}
+	for( kind = 0; kind < 3; ++kind )
+	{
+		const int channels = kinds[kind].channels;
+		/*	the color half of a DXT5 block comes after the alpha half	*/
+		const int color_offset = (channels == 4) ? 8 : 0;
+		unsigned char *file = NULL;
+		int offset = 128, length = 0;
+		for( y = 0; y < size; ++y )
+		for( x = 0; x < size; ++x )
+		for( c = 0; c < channels; ++c )
+		{
+			pixels[(y*size + x)*channels + c] =
+					image->data[(y*image->width + x)*image->channels + c % image->channels];
+		}
+		if( save_image_as_DDS_mipmapped( BENCH_TEMP_FILE, size, size, channels, pixels,
+				DDS_STREAM_DXT, DXT_QUALITY_DEFAULT ) )
+		{
+			file = read_whole_file( BENCH_TEMP_FILE, &length );
+		}
+		if( NULL == file )
+		{
+			bench_check( 0, "DDS blocks: could not write the DDS file" );
+			continue;
+		}
+		for( i = 0; i < num_levels; ++i )
+		{
+			const int level_size = compressed_level_size( DDS_STREAM_DXT, channels, size >> i, size >> i );
+			unsigned char *block = &file[offset + color_offset];
+			block[0] = block[2] = 0xEF;
+			block[1] = block[3] = 0x7B;
+			memset( &block[4], kinds[kind].cut_out ? 0xFF : 0x55, 4 );
+			level_hash[i] = stub_gl_hash( &file[offset], level_size );
+			offset += level_size;
+			level_end[i] = offset;
+		}
+		/*	the whole MIPmap chain, then the first 3 levels and the first
+			one only (dwMipMapCount says so, the rest of the file cut off)	*/
+		for( pass = 0; pass < 3; ++pass )
+		{
+			const int file_levels = pass_levels[pass];
+			/*	what the file should turn into	*/
+			const int decoded = kinds[kind].cut_out && (file_levels < num_levels);
+			const unsigned int format = decoded ? 0x83F3 : (channels == 4) ? 0x83F3 : 0x83F1;
+			const unsigned long conversions = decoded ? num_levels : num_levels - file_levels;
+			unsigned long conversions_before;
+			FILE *f = fopen( BENCH_TEMP_FILE, "wb" );
+			int ok = 0;
+			file[28] = (unsigned char)file_levels;
+			length = level_end[file_levels - 1];
+			if( f )
+			{
+				ok = (fwrite( file, 1, length, f ) == (size_t)length);
+				ok = (fclose( f ) == 0) && ok;
+			}
+			stub_gl_reset();
+			conversions_before = num_DXT_conversions();
+			texture = ok ? SOIL_load_OGL_texture( BENCH_TEMP_FILE, SOIL_LOAD_AUTO,
+					SOIL_CREATE_NEW_ID, SOIL_FLAG_MIPMAPS | SOIL_FLAG_COMPRESS_TO_DXT ) : 0;
+			ok = texture && (stub_gl_levels_with_storage( texture ) == num_levels);
+			for( i = 0; ok && (i < num_levels); ++i )
+			{
+				const stub_gl_level *L = stub_gl_get_level( texture, 0, i );
+				ok = (NULL != L) && L->compressed && (L->format == format) &&
+						(decoded || (i >= file_levels) || (L->hash == level_hash[i]));
+			}
+			sprintf( what, "DDS blocks: a %s DDS with %d of its %d levels did not come out as it should",
+					kinds[kind].name, file_levels, num_levels );
+			bench_check( ok, what );
+			sprintf( what, "DDS blocks: a %s DDS with %d of its %d levels took %lu level compressions, not %lu",
+					kinds[kind].name, file_levels, num_levels,
+					num_DXT_conversions() - conversions_before, conversions );
+			bench_check( num_DXT_conversions() - conversions_before == conversions, what );
+			if( texture )
+			{
+				SOIL_residency_forget( texture );
+				glDeleteTextures( 1, &texture );
+			}
+		}
+		free( file );
+	}
+	free( pixels );
+	remove( BENCH_TEMP_FILE );
+}
+
+/*	every file of a batch load fails on a worker thread, for one of two
+	reasons (not an image at all, a broken PNG): what SOIL_last_result
+	says afterwards is the reason of the last file, not of one that
+	failed at the same time on another thread	*/
+static void check_batch_failure_reasons( void )
+{
+	enum { num_files = 32 };
+	static const char *const names[2] = { "soil_bench_bad0.tmp", "soil_bench_bad1.tmp" };
+	static const unsigned char contents[2][16] =
+	{
+		"not an image...",
+		{ 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n', 0, 0, 0, 13, 'I', 'H', 'X', 'R' }
+	};
+	const char *filenames[num_files];
+	char reason[2][128];
+	unsigned int texture_IDs[num_files];
+	int i, ok = 1;
+	for( i = 0; i < 2; ++i )
+	{
+		FILE *f = fopen( names[i], "wb" );
+		int width, height, channels;
+		unsigned char *img;
+		ok = ok && f && (fwrite( contents[i], 1, 16, f ) == 16);
+		ok = f && (fclose( f ) == 0) && ok;
+		img = SOIL_load_image( names[i], &width, &height, &channels, SOIL_LOAD_AUTO );
+		ok = ok && (NULL == img);
+		SOIL_free_image_data( img );
+		strncpy( reason[i], SOIL_last_result(), sizeof( reason[i] ) - 1 );
+		reason[i][sizeof( reason[i] ) - 1] = 0;
+	}
+	ok = ok && (0 != strcmp( reason[0], reason[1] ));
+	for( i = 0; ok && (i < 2); ++i )
+	{
+		int k;
+		for( k = 0; k < num_files; ++k )
+		{
+			/*	the last one is names[i]	*/
+			filenames[k] = names[(k + 1 + i) & 1];
+		}
+		stub_gl_reset();
+		ok = (0 == SOIL_load_OGL_textures( filenames, num_files, SOIL_LOAD_AUTO, 0, texture_IDs, NULL )) &&
+				(0 == strcmp( SOIL_last_result(), reason[i] ));
+	}
+	bench_check( ok, "batch failures: SOIL_last_result did not give the last file's reason" );
+	remove( names[0] );
+	remove( names[1] );
+}
+
+/*	the KTX2 files in bench/corpus/ktx2, written by hand from the KTX 2.0
+	spec rather than by SOIL, and what each one has to upload	*/
+enum { KTX2_CORPUS_2D, KTX2_CORPUS_CUBEMAP, KTX2_CORPUS_ARRAY };
+
+static const struct
+{
+	const char *name;
+	int kind;
+	unsigned int format;
+	int width, height, layers, num_levels;
+}
+ktx2_corpus[] =
+{
+	{ "bc1_2d_16x16",			KTX2_CORPUS_2D,			0x83F0, 16, 16, 1, 1 },
+	{ "bc2_2d_8x8",				KTX2_CORPUS_2D,			0x83F2,  8,  8, 1, 1 },
+	{ "bc3_mipmapped_16x8",		KTX2_CORPUS_2D,			0x83F3, 16,  8, 1, 5 },
+	{ "bc4_mipmapped_8x8",		KTX2_CORPUS_2D,			0x8DBB,  8,  8, 1, 4 },
+	{ "bc7_mipmapped_12x20",	KTX2_CORPUS_2D,			0x8E8C, 12, 20, 1, 5 },
+	{ "rgb8_mipmapped_5x3",		KTX2_CORPUS_2D,			0x1907,  5,  3, 1, 3 },
+	{ "bc1a_cubemap_8x8",		KTX2_CORPUS_CUBEMAP,	0x83F1,  8,  8, 1, 4 },
+	{ "rgba8_cubemap_4x4",		KTX2_CORPUS_CUBEMAP,	0x1908,  4,  4, 1, 3 },
+	{ "bc5_array_8x8x3",		KTX2_CORPUS_ARRAY,		0x8DBD,  8,  8, 3, 4 },
+	{ "bc7_array_4x4x2",		KTX2_CORPUS_ARRAY,		0x8E8C,  4,  4, 2, 3 }
+};
+
+static int ktx2_level_size( int size, int level )
+{
+	return (size >> level) > 0 ? (size >> level) : 1;
+}
+
+/*	every level (and face) of each corpus file reaches the GPU in the
+	format and size the file says, with the bytes of its .payload, which
+	has them in the order they are uploaded	*/
+static void check_KTX2_corpus( const char *corpus )
+{
+	char path[512], what[256];
+	int i;
+	for( i = 0; i < (int)(sizeof( ktx2_corpus ) / sizeof( ktx2_corpus[0] )); ++i )
+	{
+		const int num_faces = (KTX2_CORPUS_CUBEMAP == ktx2_corpus[i].kind) ? 6 : 1;
+		const char *ktx2_path = path;
+		unsigned char *payload;
+		unsigned int texture = 0;
+		int length = 0, offset = 0, ok, level, face;
+		sprintf( path, "%.400s/ktx2/%.64s.payload", corpus, ktx2_corpus[i].name );
+		payload = read_whole_file( path, &length );
+		sprintf( path, "%.400s/ktx2/%.64s.ktx2", corpus, ktx2_corpus[i].name );
+		stub_gl_reset();
+		if( NULL == payload )
+		{
+			/*	a missing .payload fails the check below	*/
+		} else if( KTX2_CORPUS_CUBEMAP == ktx2_corpus[i].kind )
+		{
+			texture = SOIL_load_OGL_single_cubemap( path, "EWUDNS", SOIL_LOAD_AUTO,
+					SOIL_CREATE_NEW_ID, SOIL_FLAG_DDS_LOAD_DIRECT );
+		} else if( KTX2_CORPUS_ARRAY == ktx2_corpus[i].kind )
+		{
+			texture = SOIL_load_OGL_texture_array( &ktx2_path, 1, SOIL_LOAD_AUTO,
+					SOIL_CREATE_NEW_ID, SOIL_FLAG_DDS_LOAD_DIRECT );
+		} else
+		{
+			texture = SOIL_load_OGL_texture( path, SOIL_LOAD_AUTO,
+					SOIL_CREATE_NEW_ID, SOIL_FLAG_DDS_LOAD_DIRECT );
+		}
+		ok = texture && (stub_gl_levels_with_storage( texture ) == ktx2_corpus[i].num_levels * num_faces);
+		for( level = 0; ok && (level < ktx2_corpus[i].num_levels); ++level )
+		for( face = 0; ok && (face < num_faces); ++face )
+		{
+			const stub_gl_level *L = stub_gl_get_level( texture, face, level );
+			ok = (NULL != L) &&
+					(L->format == ktx2_corpus[i].format) &&
+					(L->width == ktx2_level_size( ktx2_corpus[i].width, level )) &&
+					(L->height == ktx2_level_size( ktx2_corpus[i].height, level )) &&
+					((KTX2_CORPUS_ARRAY != ktx2_corpus[i].kind) || (L->depth == ktx2_corpus[i].layers)) &&
+					(L->bytes <= (size_t)(length - offset)) &&
+					(L->hash == stub_gl_hash( &payload[offset], L->bytes ));
+			if( ok )
+			{
+				offset += (int)L->bytes;
+			}
+		}
+		sprintf( what, "KTX2 corpus: %.64s did not reach the GPU as its .payload", ktx2_corpus[i].name );
+		bench_check( ok && (offset == length), what );
+		if( texture )
+		{
+			SOIL_residency_forget( texture );
+			glDeleteTextures( 1, &texture );
+		}
+		free( payload );
+	}
+}
+
+/*	a KTX2 header whose sizes overflow an int (65536x65536 RGB8 is
+	exactly 3 * 2^32 bytes) can not pass off an empty level: the RGB8
+	corpus file, cut to its first level, is refused with each	*/
+static void check_KTX2_huge_sizes( const char *corpus )
+{
+	static const unsigned int sizes[][2] =
+	{
+		{ 65536, 65536 }, { 0x80000000u, 1 }, { 1, 0x80000000u }, { 0x7FFFFFFF, 0x7FFFFFFF }
+	};
+	char path[512], what[128];
+	unsigned char *file;
+	int length = 0, i, k;
+	sprintf( path, "%.400s/ktx2/rgb8_mipmapped_5x3.ktx2", corpus );
+	file = read_whole_file( path, &length );
+	if( (NULL == file) || (length < 104) )
+	{
+		bench_check( 0, "KTX2 sizes: could not read the RGB8 corpus file" );
+		free( file );
+		return;
+	}
+	/*	1 level, of 0 bytes	*/
+	file[40] = 1;
+	memset( &file[88], 0, 8 );
+	for( i = 0; i < (int)(sizeof( sizes ) / sizeof( sizes[0] )); ++i )
+	{
+		unsigned int texture;
+		for( k = 0; k < 4; ++k )
+		{
+			file[20 + k] = (unsigned char)(sizes[i][0] >> (k * 8));
+			file[24 + k] = (unsigned char)(sizes[i][1] >> (k * 8));
+		}
+		stub_gl_reset();
+		texture = SOIL_load_OGL_texture_from_memory( file, length, SOIL_LOAD_AUTO,
+				SOIL_CREATE_NEW_ID, SOIL_FLAG_DDS_LOAD_DIRECT );
+		sprintf( what, "KTX2 sizes: an empty %ux%u level was uploaded", sizes[i][0], sizes[i][1] );
+		bench_check( (0 == texture) && (0 == stub_gl_num_uploads()), what );
+		if( texture )
+		{
+			SOIL_residency_forget( texture );
+			glDeleteTextures( 1, &texture );
+		}
+	}
+	free( file );
+}
+#endif
+
+/*	the results	*/
+
+static void json_string( FILE *f, const char *text )
+{
+	fputc( '"', f );
+	for( ; *text; ++text )
+	{
+		if( (*text == '"') || (*text == '\\') )
+		{
+			fputc( '\\', f );
+		}
+		if( (unsigned char)*text >= 32 )
+		{
+			fputc( *text, f );
+		}
+	}
+	fputc( '"', f );
+}
+
+static int write_json( const char *filename, int quick )
+{
+	FILE *f = fopen( filename, "w" );
+	int i, m;
+	if( NULL == f )
+	{
+		return 0;
+	}
+	fprintf( f, "{\n\t\"benchmark\": \"soil_bench\",\n\t\"version\": 1,\n" );
+	fprintf( f, "\t\"quick\": %s,\n", quick ? "true" : "false" );
+	fprintf( f, "\t\"cores\": %d,\n", image_jobs_num_cores() );
+	fprintf( f, "\t\"calibration_ms\": %.4f,\n", calibration_ms );
+	fprintf( f, "\t\"errors\": %d,\n", num_errors );
+	fprintf( f, "\t\"results\":\n\t[\n" );
+	for( i = 0; i < num_results; ++i )
+	{
+		const bench_result *r = &results[i];
+		fprintf( f, "\t\t{ \"group\": " );
+		json_string( f, r->group );
+		fprintf( f, ", \"name\": " );
+		json_string( f, r->name );
+		fprintf( f, ", \"iterations\": %d, \"best_ms\": %.4f, \"mean_ms\": %.4f",
+				r->iterations, r->best_ms, r->total_ms / r->iterations );
+		if( r->megapixels > 0.0 )
+		{
+			fprintf( f, ", \"mp_per_s\": %.3f", r->megapixels * 1000.0 / r->best_ms );
+		}
+		if( r->megabytes > 0.0 )
+		{
+			fprintf( f, ", \"mb_per_s\": %.3f", r->megabytes * 1000.0 / r->best_ms );
+		}
+		if( calibration_ms > 0.0 )
+		{
+			fprintf( f, ", \"calibrated\": %.5f", r->best_ms / calibration_ms );
+		}
+		fprintf( f, ", \"peak_rss_kb\": %ld", r->peak_rss_kb );
+		for( m = 0; m < r->num_metrics; ++m )
+		{
+			fprintf( f, ", " );
+			json_string( f, r->metric_name[m] );
+			fprintf( f, ": %.4f", r->metric[m] );
+		}
+		fprintf( f, " }%s\n", (i + 1 < num_results) ? "," : "" );
+	}
+	fprintf( f, "\t]\n}\n" );
+	return (fclose( f ) == 0);
+}
+
+int main( int argc, char **argv )
+{
+	const char *json_filename = NULL;
+	const char *corpus = SOIL_BENCH_CORPUS;
+	const char *extra_files[BENCH_MAX_IMAGES];
+	bench_image synthetic[3], photos[BENCH_MAX_IMAGES];
+	char photo_paths[BENCH_MAX_IMAGES][512];
+	int num_extra = 0, num_photos = 0, quick = 0, size, i;
+	for( i = 1; i < argc; ++i )
+	{
+		if( (0 == strcmp( argv[i], "--json" )) && (i + 1 < argc) )
+		{
+			json_filename = argv[++i];
+		} else
+		if( (0 == strcmp( argv[i], "--corpus" )) && (i + 1 < argc) )
+		{
+			corpus = argv[++i];
+		} else
+		if( (0 == strcmp( argv[i], "--filter" )) && (i + 1 < argc) )
+		{
+			filter = argv[++i];
+		} else
+		if( 0 == strcmp( argv[i], "--quick" ) )
+		{
+			quick = 1;
+		} else
+		if( argv[i][0] == '-' )
+		{
+			printf( "usage: %s [--json results.json] [--corpus directory] [--filter text] [--quick] [image files...]\n", argv[0] );
+			return 1;
+		} else
+		if( num_extra < BENCH_MAX_IMAGES - 8 )
+		{
+			extra_files[num_extra++] = argv[i];
+		}
+	}
+	if( quick )
+	{
+		/*	just to see that everything still runs	*/
+		min_run_ms = 0.0;
+		max_iterations = 1;
+	}
+	size = quick ? 256 : 1024;
+	memset( synthetic, 0, sizeof( synthetic ) );
+	memset( photos, 0, sizeof( photos ) );
+	if( !make_gradient( &synthetic[0], size ) ||
+		!make_noise( &synthetic[1], size ) ||
+		!make_normal_map( &synthetic[2], size ) )
+	{
+		printf( "out of RAM\n" );
+		return 1;
+	}
+	for( i = 0; i < (int)(sizeof( corpus_files ) / sizeof( corpus_files[0] )); ++i )
+	{
+		sprintf( photo_paths[num_photos], "%.400s/%.100s", corpus, corpus_files[i] );
+		if( load_corpus_image( &photos[num_photos], corpus, corpus_files[i] ) )
+		{
+			++num_photos;
+		}
+	}
+	for( i = 0; i < num_extra; ++i )
+	{
+		sprintf( photo_paths[num_photos], "%.500s", extra_files[i] );
+		if( load_corpus_image( &photos[num_photos], NULL, extra_files[i] ) )
+		{
+			++num_photos;
+		}
+	}
+	printf( "soil_bench: %d cores, %d photographs\n", image_jobs_num_cores(), num_photos );
+	check_DDS_stream( &synthetic[1] );
+	check_APNG_frame_bounds();
+#ifdef SOIL_BENCH_STUB_GL
+	check_residency( &synthetic[1] );
+	check_DDS_keeps_blocks( &synthetic[1] );
+	check_batch_failure_reasons();
+	check_KTX2_corpus( corpus );
+	check_KTX2_huge_sizes( corpus );
+#endif
+	if( bench_wanted( "calibration", "integer_loop" ) )
+	{
+		bench_result *result = bench_run( "calibration", "integer_loop", run_calibration, NULL, 0.0, 0.0 );
+		calibration_ms = result ? result->best_ms : 0.0;
+	}
+	for( i = 0; i < 2; ++i )
+	{
+		bench_decode( &synthetic[i], NULL );
+	}
+	for( i = 0; i < num_photos; ++i )
+	{
+		bench_decode( &photos[i], photo_paths[i] );
+	}
+	for( i = 0; i < 2; ++i )
+	{
+		bench_resample( &synthetic[i] );
+	}
+	for( i = 0; i < num_photos; ++i )
+	{
+		bench_resample( &photos[i] );
+	}
+	for( i = 0; i < 2; ++i )
+	{
+		bench_compress( &synthetic[i], 0 );
+	}
+	for( i = 0; i < num_photos; ++i )
+	{
+		bench_compress( &photos[i], 0 );
+	}
+	for( i = 0; i < num_photos; ++i )
+	{
+		bench_bc7_against_dxt5( &photos[i] );
+	}
+	/*	the slow BC7 preset is for baking, 256x256 is plenty	*/
+	{
+		bench_image crop = crop_image( &synthetic[1], 256 );
+		if( crop.data )
+		{
+			strcat( crop.name, "_256" );
+			bench_compress( &crop, 1 );
+			free( crop.data );
+		}
+	}
+	{
+		bench_image crop = crop_image( &synthetic[2], 256 );
+		bench_job job;
+		if( crop.data )
+		{
+			bench_compress_one( &crop, "bc4/normal_map_256", BENCH_BC4, 0, &job );
+			free( job.output );
+		}
+		free( crop.data );
+	}
+	bench_normal_maps( &synthetic[2] );
+	bench_writers( &synthetic[1] );
+	if( num_photos > 0 )
+	{
+		bench_writers( &photos[0] );
+	}
+	bench_containers( &synthetic[1] );
+#ifdef SOIL_BENCH_STUB_GL
+	bench_direct_uploads( &synthetic[1] );
+	if( num_photos > 0 )
+	{
+		bench_direct_uploads( &photos[0] );
+	}
+#endif
+	bench_atlas();
+	{
+		/*	small textures, as for sprites and UI	*/
+		bench_image crop = crop_image( &synthetic[1], 128 );
+		if( crop.data )
+		{
+			bench_startup_times( &crop, quick ? 64 : 1000 );
+			free( crop.data );
+		}
+	}
+	{
+		bench_image crop = crop_image( &synthetic[1], BENCH_ANIM_SIZE );
+		if( crop.data )
+		{
+			bench_animations( &crop );
+			free( crop.data );
+		}
+	}
+	remove( BENCH_TEMP_FILE );
+	if( json_filename && !write_json( json_filename, quick ) )
+	{
+		printf( "could not write %s\n", json_filename );
+		return 1;
+	}
+	for( i = 0; i < 3; ++i )
+	{
+		free( synthetic[i].data );
+	}
+	for( i = 0; i < num_photos; ++i )
+	{
+		SOIL_free_image_data( photos[i].data );
+	}
+	if( num_errors )
+	{
+		printf( "%d checks failed\n", num_errors );
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,419 @@
+/*
+	stub_gl
+
+	See stub_gl.h.  Only what SOIL calls is here; anything else is
+	left to fail to link, so a new call gets noticed.
+
+	Public Domain
+*/
+
+#include "stub_gl.h"
+
+#include <GL/gl.h>
+#include <GL/glx.h>
+#include <string.h>
+
+#define STUB_GL_TEXTURE_RECTANGLE		0x84F5
+#define STUB_GL_TEXTURE_BINDING_RECTANGLE	0x84F6
+#define STUB_GL_TEXTURE_CUBE_MAP			0x8513
+#define STUB_GL_TEXTURE_BINDING_CUBE_MAP	0x8514
+#define STUB_GL_TEXTURE_CUBE_MAP_POSITIVE_X	0x8515
+#define STUB_GL_MAX_CUBE_MAP_TEXTURE_SIZE	0x851C
+#define STUB_GL_TEXTURE_3D				0x806F
+#define STUB_GL_TEXTURE_BINDING_3D		0x806A
+#define STUB_GL_MAX_3D_TEXTURE_SIZE		0x8073
+#define STUB_GL_TEXTURE_2D_ARRAY		0x8C1A
+#define STUB_GL_TEXTURE_BINDING_2D_ARRAY	0x8C1D
+#define STUB_GL_MAX_ARRAY_TEXTURE_LAYERS	0x88FF
+#define STUB_GL_TEXTURE_MAX_LEVEL		0x813D
+#define STUB_GL_UNPACK_ROW_LENGTH		0x0CF2
+#define STUB_GL_UNPACK_ALIGNMENT		0x0CF5
+
+typedef struct
+{
+	int exists;
+	int max_level;
+	stub_gl_level levels[6][STUB_GL_MAX_LEVELS];
+}
+stub_gl_texture;
+
+/*	what GL_TEXTURE_2D, _RECTANGLE, _CUBE_MAP, _3D and _2D_ARRAY have bound	*/
+enum { STUB_2D, STUB_RECTANGLE, STUB_CUBE_MAP, STUB_3D, STUB_2D_ARRAY, STUB_TARGETS };
+
+static stub_gl_texture stub_textures[STUB_GL_MAX_TEXTURES];
+static unsigned int stub_bound[STUB_TARGETS];
+static unsigned int stub_next_ID = 1;
+static unsigned long stub_uploads = 0;
+static int stub_hashing = 1;
+static GLint stub_row_length = 0;
+static GLint stub_alignment = 4;
+
+/*	FNV-1a, carried on from hash	*/
+static unsigned int stub_hash_more( unsigned int hash, const unsigned char *data, size_t size )
+{
+	while( size-- )
+	{
+		hash = (hash ^ *data++) * 16777619u;
+	}
+	return hash;
+}
+
+unsigned int stub_gl_hash( const void *data, size_t size )
+{
+	return stub_hash_more( 2166136261u, (const unsigned char*)data, size );
+}
+
+void stub_gl_reset( void )
+{
+	memset( stub_textures, 0, sizeof( stub_textures ) );
+	memset( stub_bound, 0, sizeof( stub_bound ) );
+	stub_next_ID = 1;
+	stub_uploads = 0;
+	stub_row_length = 0;
+	stub_alignment = 4;
+}
+
+void stub_gl_set_hashing( int hashing )
+{
+	stub_hashing = hashing;
+}
+
+static stub_gl_texture* stub_find( unsigned int texture_ID )
+{
+	if( (texture_ID == 0) || (texture_ID >= STUB_GL_MAX_TEXTURES) ||
+		!stub_textures[texture_ID].exists )
+	{
+		return NULL;
+	}
+	return &stub_textures[texture_ID];
+}
+
+const stub_gl_level* stub_gl_get_level( unsigned int texture_ID, int face, int level )
+{
+	stub_gl_texture *texture = stub_find( texture_ID );
+	if( (NULL == texture) || (face < 0) || (face > 5) ||
+		(level < 0) || (level >= STUB_GL_MAX_LEVELS) )
+	{
+		return NULL;
+	}
+	return &texture->levels[face][level];
+}
+
+int stub_gl_levels_with_storage( unsigned int texture_ID )
+{
+	stub_gl_texture *texture = stub_find( texture_ID );
+	int face, level, count = 0;
+	for( face = 0; texture && (face < 6); ++face )
+	{
+		for( level = 0; level < STUB_GL_MAX_LEVELS; ++level )
+		{
+			count += (texture->levels[face][level].format != 0);
+		}
+	}
+	return count;
+}
+
+size_t stub_gl_texture_bytes( unsigned int texture_ID )
+{
+	stub_gl_texture *texture = stub_find( texture_ID );
+	int face, level;
+	size_t bytes = 0;
+	for( face = 0; texture && (face < 6); ++face )
+	{
+		for( level = 0; level < STUB_GL_MAX_LEVELS; ++level )
+		{
+			bytes += texture->levels[face][level].bytes;
+		}
+	}
+	return bytes;
+}
+
+int stub_gl_max_level( unsigned int texture_ID )
+{
+	stub_gl_texture *texture = stub_find( texture_ID );
+	return texture ? texture->max_level : 0;
+}
+
+unsigned long stub_gl_num_uploads( void )
+{
+	return stub_uploads;
+}
+
+/*	the binding slot of a target, -1 for the ones SOIL doesn't use	*/
+static int stub_target_slot( GLenum target )
+{
+	switch( target )
+	{
+	case GL_TEXTURE_2D: return STUB_2D;
+	case STUB_GL_TEXTURE_RECTANGLE: return STUB_RECTANGLE;
+	case STUB_GL_TEXTURE_3D: return STUB_3D;
+	case STUB_GL_TEXTURE_2D_ARRAY: return STUB_2D_ARRAY;
+	default:
+		if( (target == STUB_GL_TEXTURE_CUBE_MAP) ||
+			((target >= STUB_GL_TEXTURE_CUBE_MAP_POSITIVE_X) &&
+			(target < STUB_GL_TEXTURE_CUBE_MAP_POSITIVE_X + 6)) )
+		{
+			return STUB_CUBE_MAP;
+		}
+	}
+	return -1;
+}
+
+/*	the level an upload to target goes to	*/
+static stub_gl_level* stub_upload_level( GLenum target, GLint level )
+{
+	int slot = stub_target_slot( target );
+	int face = 0;
+	stub_gl_texture *texture;
+	++stub_uploads;
+	if( (slot < 0) || (level < 0) || (level >= STUB_GL_MAX_LEVELS) ||
+		(NULL == (texture = stub_find( stub_bound[slot] ))) )
+	{
+		return NULL;
+	}
+	if( slot == STUB_CUBE_MAP )
+	{
+		face = (int)(target - STUB_GL_TEXTURE_CUBE_MAP_POSITIVE_X);
+	}
+	return &texture->levels[face][level];
+}
+
+static void stub_tex_image( GLenum target, GLint level, GLint internal_format,
+		GLsizei width, GLsizei height, GLsizei depth, GLenum format, const GLvoid *pixels )
+{
+	stub_gl_level *L = stub_upload_level( target, level );
+	size_t channels = 4, row_bytes, stride;
+	int row;
+	if( NULL == L )
+	{
+		return;
+	}
+	memset( L, 0, sizeof( stub_gl_level ) );
+	if( (width < 1) || (height < 1) || (depth < 1) )
+	{
+		/*	0x0 frees the level	*/
+		return;
+	}
+	switch( format )
+	{
+	case GL_LUMINANCE:
+	case GL_ALPHA:
+	case GL_RED: channels = 1; break;
+	case GL_LUMINANCE_ALPHA: channels = 2; break;
+	case GL_RGB: channels = 3; break;
+	}
+	row_bytes = channels * width;
+	stride = channels * (stub_row_length ? stub_row_length : width);
+	stride = (stride + stub_alignment - 1) / stub_alignment * stub_alignment;
+	L->format = internal_format;
+	L->width = width;
+	L->height = height;
+	L->depth = depth;
+	L->bytes = row_bytes * height * depth;
+	L->hash = 2166136261u;
+	for( row = 0; stub_hashing && pixels && (row < height * depth); ++row )
+	{
+		L->hash = stub_hash_more( L->hash, (const unsigned char*)pixels + row * stride, row_bytes );
+	}
+}
+
+static void stub_compressed_tex_image( GLenum target, GLint level, GLenum internal_format,
+		GLsizei width, GLsizei height, GLsizei depth, GLsizei size, const GLvoid *data )
+{
+	stub_gl_level *L = stub_upload_level( target, level );
+	if( NULL == L )
+	{
+		return;
+	}
+	memset( L, 0, sizeof( stub_gl_level ) );
+	if( (width < 1) || (height < 1) || (depth < 1) )
+	{
+		return;
+	}
+	L->format = internal_format;
+	L->width = width;
+	L->height = height;
+	L->depth = depth;
+	L->compressed = 1;
+	L->bytes = size;
+	L->hash = stub_hashing ? stub_gl_hash( data, size ) : 0;
+}
+
+/*	OpenGL 1.1	*/
+
+void APIENTRY glGenTextures( GLsizei n, GLuint *textures )
+{
+	GLsizei i;
+	for( i = 0; i < n; ++i )
+	{
+		textures[i] = 0;
+		if( stub_next_ID < STUB_GL_MAX_TEXTURES )
+		{
+			textures[i] = stub_next_ID++;
+			memset( &stub_textures[textures[i]], 0, sizeof( stub_gl_texture ) );
+			stub_textures[textures[i]].exists = 1;
+			stub_textures[textures[i]].max_level = 1000;
+		}
+	}
+}
+
+void APIENTRY glDeleteTextures( GLsizei n, const GLuint *textures )
+{
+	GLsizei i;
+	for( i = 0; i < n; ++i )
+	{
+		if( stub_find( textures[i] ) )
+		{
+			stub_textures[textures[i]].exists = 0;
+		}
+	}
+}
+
+void APIENTRY glBindTexture( GLenum target, GLuint texture )
+{
+	int slot = stub_target_slot( target );
+	if( slot >= 0 )
+	{
+		stub_bound[slot] = texture;
+	}
+}
+
+void APIENTRY glTexParameteri( GLenum target, GLenum pname, GLint param )
+{
+	int slot = stub_target_slot( target );
+	stub_gl_texture *texture = (slot >= 0) ? stub_find( stub_bound[slot] ) : NULL;
+	if( texture && (pname == STUB_GL_TEXTURE_MAX_LEVEL) )
+	{
+		texture->max_level = param;
+	}
+}
+
+void APIENTRY glPixelStorei( GLenum pname, GLint param )
+{
+	if( pname == STUB_GL_UNPACK_ROW_LENGTH )
+	{
+		stub_row_length = param;
+	} else
+	if( (pname == STUB_GL_UNPACK_ALIGNMENT) && (param > 0) )
+	{
+		stub_alignment = param;
+	}
+}
+
+void APIENTRY glGetIntegerv( GLenum pname, GLint *params )
+{
+	switch( pname )
+	{
+	case GL_MAX_TEXTURE_SIZE:
+	case STUB_GL_MAX_CUBE_MAP_TEXTURE_SIZE: *params = 16384; break;
+	case STUB_GL_MAX_3D_TEXTURE_SIZE:
+	case STUB_GL_MAX_ARRAY_TEXTURE_LAYERS: *params = 2048; break;
+	case STUB_GL_UNPACK_ROW_LENGTH: *params = stub_row_length; break;
+	case STUB_GL_UNPACK_ALIGNMENT: *params = stub_alignment; break;
+	case GL_TEXTURE_BINDING_2D: *params = stub_bound[STUB_2D]; break;
+	case STUB_GL_TEXTURE_BINDING_RECTANGLE: *params = stub_bound[STUB_RECTANGLE]; break;
+	case STUB_GL_TEXTURE_BINDING_CUBE_MAP: *params = stub_bound[STUB_CUBE_MAP]; break;
+	case STUB_GL_TEXTURE_BINDING_3D: *params = stub_bound[STUB_3D]; break;
+	case STUB_GL_TEXTURE_BINDING_2D_ARRAY: *params = stub_bound[STUB_2D_ARRAY]; break;
+	default: *params = 0;
+	}
+}
+
+const GLubyte* APIENTRY glGetString( GLenum name )
+{
+	switch( name )
+	{
+	case GL_VENDOR: return (const GLubyte*)"soil_bench";
+	case GL_RENDERER: return (const GLubyte*)"stub_gl";
+	case GL_VERSION: return (const GLubyte*)"4.5 stub_gl";
+	case GL_EXTENSIONS:
+		return (const GLubyte*)
+			"GL_ARB_texture_non_power_of_two GL_ARB_texture_rectangle "
+			"GL_ARB_texture_cube_map GL_ARB_texture_compression "
+			"GL_EXT_texture_compression_s3tc GL_ARB_texture_compression_rgtc "
+			"GL_ARB_texture_compression_bptc GL_EXT_texture_array GL_EXT_texture3D";
+	}
+	return NULL;
+}
+
+GLenum APIENTRY glGetError( void )
+{
+	return GL_NO_ERROR;
+}
+
+void APIENTRY glTexImage2D( GLenum target, GLint level, GLint internal_format,
+		GLsizei width, GLsizei height, GLint border,
+		GLenum format, GLenum type, const GLvoid *pixels )
+{
+	(void)border;
+	(void)type;
+	stub_tex_image( target, level, internal_format, width, height, 1, format, pixels );
+}
+
+void APIENTRY glTexSubImage2D( GLenum target, GLint level, GLint xoffset, GLint yoffset,
+		GLsizei width, GLsizei height, GLenum format, GLenum type, const GLvoid *pixels )
+{
+	/*	(only the screenshots' and the streamed bands' partial uploads)	*/
+	(void)target; (void)level; (void)xoffset; (void)yoffset;
+	(void)width; (void)height; (void)format; (void)type; (void)pixels;
+}
+
+void APIENTRY glReadPixels( GLint x, GLint y, GLsizei width, GLsizei height,
+		GLenum format, GLenum type, GLvoid *pixels )
+{
+	(void)x; (void)y; (void)format; (void)type;
+	memset( pixels, 0, (size_t)width * height * 4 );
+}
+
+/*	the rest SOIL finds with glXGetProcAddressARB	*/
+
+static void APIENTRY stub_glCompressedTexImage2D( GLenum target, GLint level, GLenum internal_format,
+		GLsizei width, GLsizei height, GLint border, GLsizei size, const GLvoid *data )
+{
+	(void)border;
+	stub_compressed_tex_image( target, level, internal_format, width, height, 1, size, data );
+}
+
+static void APIENTRY stub_glTexImage3D( GLenum target, GLint level, GLint internal_format,
+		GLsizei width, GLsizei height, GLsizei depth, GLint border,
+		GLenum format, GLenum type, const GLvoid *pixels )
+{
+	(void)border;
+	(void)type;
+	stub_tex_image( target, level, internal_format, width, height, depth, format, pixels );
+}
+
+static void APIENTRY stub_glCompressedTexImage3D( GLenum target, GLint level, GLenum internal_format,
+		GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei size, const GLvoid *data )
+{
+	(void)border;
+	stub_compressed_tex_image( target, level, internal_format, width, height, depth, size, data );
+}
+
+static const struct
+{
+	const char *name;
+	void (*proc)( void );
+}
+stub_procs[] =
+{
+	{ "glCompressedTexImage2D", (void (*)( void ))stub_glCompressedTexImage2D },
+	{ "glCompressedTexImage2DARB", (void (*)( void ))stub_glCompressedTexImage2D },
+	{ "glTexImage3D", (void (*)( void ))stub_glTexImage3D },
+	{ "glTexImage3DEXT", (void (*)( void ))stub_glTexImage3D },
+	{ "glCompressedTexImage3D", (void (*)( void ))stub_glCompressedTexImage3D },
+	{ "glCompressedTexImage3DARB", (void (*)( void ))stub_glCompressedTexImage3D }
+};
+
+void (*glXGetProcAddressARB( const GLubyte *name ))( void )
+{
+	size_t i;
+	for( i = 0; i < sizeof( stub_procs ) / sizeof( stub_procs[0] ); ++i )
+	{
+		if( 0 == strcmp( (const char*)name, stub_procs[i].name ) )
+		{
+			return stub_procs[i].proc;
+		}
+	}
+	return NULL;
+}
@@ -0,0 +1,120 @@
+/*
+	stub_gl
+
+	A stub OpenGL (the GLX entry points SOIL uses) for soil_bench, so
+	SOIL's loaders, the residency manager and the uploads can be run
+	and checked with no context and no driver.  Every texture keeps
+	the size and a hash of each level uploaded to it, which is what
+	the checks look at.
+
+	Public Domain
+*/
+
+#ifndef HEADER_STUB_GL
+#define HEADER_STUB_GL
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define STUB_GL_MAX_TEXTURES	4096
+#define STUB_GL_MAX_LEVELS		16
+
+/**
+	One MIP level of one face (or of all the layers of an array or
+	volume texture), as the stub has it.  format is 0 when the level
+	has no storage.
+**/
+typedef struct
+{
+	unsigned int format;
+	int width, height, depth;
+	int compressed;
+	size_t bytes;
+	unsigned int hash;
+}
+stub_gl_level;
+
+/**
+	Forgets every texture and resets the counts.
+**/
+void
+	stub_gl_reset
+	(
+		void
+	);
+
+/**
+	Turns hashing the uploaded data on (the default) or off, off
+	for timing SOIL's side of the uploads.
+**/
+void
+	stub_gl_set_hashing
+	(
+		int hashing
+	);
+
+/**
+	\return a level of a texture (face 0 for all but cube maps),
+	or NULL if the stub never heard of it
+**/
+const stub_gl_level*
+	stub_gl_get_level
+	(
+		unsigned int texture_ID,
+		int face, int level
+	);
+
+/**
+	\return how many levels of a texture have storage, over all faces
+**/
+int
+	stub_gl_levels_with_storage
+	(
+		unsigned int texture_ID
+	);
+
+/**
+	\return the bytes of all the levels of a texture that have storage
+**/
+size_t
+	stub_gl_texture_bytes
+	(
+		unsigned int texture_ID
+	);
+
+/**
+	\return the GL_TEXTURE_MAX_LEVEL of a texture (1000 if never set)
+**/
+int
+	stub_gl_max_level
+	(
+		unsigned int texture_ID
+	);
+
+/**
+	\return how many glTexImage / glCompressedTexImage calls were made
+**/
+unsigned long
+	stub_gl_num_uploads
+	(
+		void
+	);
+
+/**
+	The hash stub_gl_level has of data that was uploaded.
+**/
+unsigned int
+	stub_gl_hash
+	(
+		const void *data,
+		size_t size
+	);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HEADER_STUB_GL	*/
@@ -0,0 +1,972 @@
+/*
+	BC7 compression
+
+	Public Domain
+*/
+
+#include "image_BC7.h"
+#include "image_jobs.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*	the interpolation weights (out of 64) for 2, 3 and 4 bit indices	*/
+static const int BC7_weights2[4] = { 0, 21, 43, 64 };
+static const int BC7_weights3[8] = { 0, 9, 18, 27, 37, 46, 55, 64 };
+static const int BC7_weights4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+/*	the 2 subset partitions, bit i is the subset of texel i	*/
+static const unsigned short BC7_partitions2[64] =
+{
+	0xCCCC, 0x8888, 0xEEEE, 0xECC8, 0xC880, 0xFEEC, 0xFEC8, 0xEC80,
+	0xC800, 0xFFEC, 0xFE80, 0xE800, 0xFFE8, 0xFF00, 0xFFF0, 0xF000,
+	0xF710, 0x008E, 0x7100, 0x08CE, 0x008C, 0x7310, 0x3100, 0x8CCE,
+	0x088C, 0x3110, 0x6666, 0x366C, 0x17E8, 0x0FF0, 0x718E, 0x399C,
+	0xAAAA, 0xF0F0, 0x5A5A, 0x33CC, 0x3C3C, 0x55AA, 0x9696, 0xA55A,
+	0x73CE, 0x13C8, 0x324C, 0x3BDC, 0x6996, 0xC33C, 0x9966, 0x0660,
+	0x0272, 0x04E4, 0x4E40, 0x2720, 0xC936, 0x936C, 0x39C6, 0x639C,
+	0x9336, 0x9CC6, 0x817E, 0xE718, 0xCCF0, 0x0FCC, 0x7744, 0xEE22
+};
+
+/*	the texel of subset 1 whose index has its top bit left out	*/
+static const unsigned char BC7_anchors2[64] =
+{
+	15, 15, 15, 15, 15, 15, 15, 15,
+	15, 15, 15, 15, 15, 15, 15, 15,
+	15,  2,  8,  2,  2,  8,  8, 15,
+	 2,  8,  2,  2,  8,  8,  2,  2,
+	15, 15,  6,  8,  2,  8, 15, 15,
+	 2,  8,  2,  2,  2, 15, 15,  6,
+	 6,  2,  6,  8, 15, 15,  2,  2,
+	15, 15, 15, 15, 15,  2,  2, 15
+};
+
+static const unsigned char BC7_all_texels[16] =
+{
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15
+};
+
+/*	how the p-bits (the shared lowest bit of every channel) are stored	*/
+enum
+{
+	BC7_PBIT_NONE = 0,
+	/*	one per end point	*/
+	BC7_PBIT_UNIQUE = 1,
+	/*	one per subset	*/
+	BC7_PBIT_SHARED = 2
+};
+
+/*	the best number of partitions to try hard on with the slow preset	*/
+#define BC7_SLOW_PARTITIONS	8
+
+/*	the fast preset only tries more than mode 6 on blocks it got
+	this wrong (about 6 per channel, on average)	*/
+#define BC7_FAST_RETRY_ERROR	(16 * 3 * 6 * 6)
+
+/*	one subset's end points over a range of channels, and the indices
+	of its texels	*/
+typedef struct
+{
+	/*	quantized, without the p-bit	*/
+	int endpoint[2][4];
+	int pbit[2];
+	/*	indexed by texel, only the texels of this subset are set
+		(while fitting they follow the subset)	*/
+	unsigned char index[16];
+	int error;
+}
+BC7_fit;
+
+/*	what a subset gets fit with	*/
+typedef struct
+{
+	/*	the number of channels (moved to the front, see gather_subset)	*/
+	int num;
+	/*	bits per channel, without the p-bit	*/
+	int bits;
+	int pbit_mode;
+	/*	0 or 1 to only allow that p-bit, -1 for any	*/
+	int pbit_forced;
+	int index_bits;
+	/*	search every index (else project onto the line) and refine	*/
+	int exhaustive;
+}
+BC7_fit_params;
+
+/*	the texels of one subset (see gather_subset)	*/
+typedef struct
+{
+	int texel[16][4];
+	/*	which texel of the block each one is	*/
+	unsigned char members[16];
+	int count;
+}
+BC7_subset;
+
+typedef struct
+{
+	unsigned char *data;
+	int position;
+}
+BC7_bit_writer;
+
+static void put_bits( BC7_bit_writer *writer, int value, int count )
+{
+	/*	as many bits at a time as fit in the current byte	*/
+	while( count > 0 )
+	{
+		const int shift = writer->position & 7;
+		const int n = (count < 8 - shift) ? count : 8 - shift;
+		writer->data[writer->position >> 3] |= (value & ((1 << n) - 1)) << shift;
+		value >>= n;
+		writer->position += n;
+		count -= n;
+	}
+}
+
+static const int* index_weights( int index_bits )
+{
+	return (index_bits == 2) ? BC7_weights2 :
+			((index_bits == 3) ? BC7_weights3 : BC7_weights4);
+}
+
+/*	stretches a value of some bits to 8 bits, by repeating its top bits	*/
+static int expand_bits( int value, int bits )
+{
+	value <<= 8 - bits;
+	return value | (value >> bits);
+}
+
+/*	the closest value of bits bits (with the p-bit p, or none if p < 0)	*/
+static int quantize( float value, int bits, int p )
+{
+	const int top = (1 << bits) - 1;
+	int q;
+	if( p < 0 )
+	{
+		q = (int)(value * top * (1.0f / 255.0f) + 0.5f);
+	} else
+	{
+		q = (int)((value * ((2 << bits) - 1) * (1.0f / 255.0f) - p) * 0.5f + 0.5f);
+	}
+	return (q < 0) ? 0 : ((q > top) ? top : q);
+}
+
+/*	copies the texels of a subset, with the channels being fit moved to
+	the front and the rest zeroed, so every loop can run over 4 channels
+	(which the compiler can turn into SIMD code)	*/
+static void gather_subset(
+		const unsigned char texels[16][4],
+		const unsigned char *members, int count,
+		int first, int num,
+		BC7_subset *subset )
+{
+	int i, j;
+	subset->count = count;
+	for( i = 0; i < count; ++i )
+	{
+		subset->members[i] = members[i];
+		for( j = 0; j < 4; ++j )
+		{
+			subset->texel[i][j] = (j < num) ? texels[members[i]][first + j] : 0;
+		}
+	}
+}
+
+/*	the mean and the main axis of a subset's colors	*/
+static void principal_axis(
+		const BC7_subset *subset,
+		float mean[4], float axis[4] )
+{
+	/*	the 10 different entries of the covariance matrix	*/
+	static const int row[10] = { 0, 0, 0, 0, 1, 1, 1, 2, 2, 3 };
+	static const int column[10] = { 0, 1, 2, 3, 1, 2, 3, 2, 3, 3 };
+	float cov[4][4], length;
+	int sum[4] = { 0, 0, 0, 0 }, products[10] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+	int i, j, k, iteration;
+	/*	all in integers first, which is exact (written out, as every
+		fit starts here)	*/
+	for( i = 0; i < subset->count; ++i )
+	{
+		const int *texel = subset->texel[i];
+		const int r = texel[0], g = texel[1], b = texel[2], a = texel[3];
+		sum[0] += r;
+		sum[1] += g;
+		sum[2] += b;
+		sum[3] += a;
+		products[0] += r * r;
+		products[1] += r * g;
+		products[2] += r * b;
+		products[3] += r * a;
+		products[4] += g * g;
+		products[5] += g * b;
+		products[6] += g * a;
+		products[7] += b * b;
+		products[8] += b * a;
+		products[9] += a * a;
+	}
+	for( j = 0; j < 4; ++j )
+	{
+		mean[j] = (float)sum[j] / subset->count;
+	}
+	for( j = 0; j < 10; ++j )
+	{
+		cov[row[j]][column[j]] = cov[column[j]][row[j]] =
+				products[j] - mean[row[j]] * sum[column[j]];
+	}
+	/*	power iteration, starting from the channel that varies the most
+		(scaled by the largest component, only the direction matters)	*/
+	k = 0;
+	for( j = 1; j < 4; ++j )
+	{
+		if( cov[j][j] > cov[k][k] )
+		{
+			k = j;
+		}
+	}
+	for( j = 0; j < 4; ++j )
+	{
+		axis[j] = cov[k][j];
+	}
+	for( iteration = 0; iteration < 3; ++iteration )
+	{
+		float next[4], largest = 0.0f;
+		for( j = 0; j < 4; ++j )
+		{
+			next[j] = cov[j][0] * axis[0] + cov[j][1] * axis[1] +
+					cov[j][2] * axis[2] + cov[j][3] * axis[3];
+			largest = (next[j] > largest) ? next[j] : ((-next[j] > largest) ? -next[j] : largest);
+		}
+		if( largest <= 0.0f )
+		{
+			break;
+		}
+		largest = 1.0f / largest;
+		for( j = 0; j < 4; ++j )
+		{
+			axis[j] = next[j] * largest;
+		}
+	}
+	length = axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2] + axis[3] * axis[3];
+	length = (length > 0.0f) ? 1.0f / (float)sqrt( length ) : 0.0f;
+	for( j = 0; j < 4; ++j )
+	{
+		axis[j] *= length;
+	}
+}
+
+/*	picks the indices for a subset with these (8 bit) end points
+	\return the squared error	*/
+static int choose_indices(
+		const BC7_subset *subset,
+		const BC7_fit_params *params,
+		const int color[2][4],
+		unsigned char index[16] )
+{
+	const int *weights = index_weights( params->index_bits );
+	const int num_indices = 1 << params->index_bits;
+	int palette[16][4];
+	int dir[4], len2 = 0, error = 0;
+	float scale;
+	int i, j, k;
+	for( k = 0; params->exhaustive && (k < num_indices); ++k )
+	{
+		for( j = 0; j < 4; ++j )
+		{
+			palette[k][j] = ((64 - weights[k]) * color[0][j] + weights[k] * color[1][j] + 32) >> 6;
+		}
+	}
+	for( j = 0; j < 4; ++j )
+	{
+		dir[j] = color[1][j] - color[0][j];
+		len2 += dir[j] * dir[j];
+	}
+	scale = (len2 > 0) ? (float)(num_indices - 1) / len2 : 0.0f;
+	for( i = 0; i < subset->count; ++i )
+	{
+		const int *texel = subset->texel[i];
+		int best = 0, best_error = 0x7FFFFFFF;
+		if( params->exhaustive )
+		{
+			for( k = 0; k < num_indices; ++k )
+			{
+				int e = 0;
+				for( j = 0; j < 4; ++j )
+				{
+					const int d = texel[j] - palette[k][j];
+					e += d * d;
+				}
+				if( e < best_error )
+				{
+					best_error = e;
+					best = k;
+				}
+			}
+		} else
+		{
+			/*	place it on the line, the weights are close enough to even
+				(and only the color it gets is needed, not the palette)	*/
+			int t = 0, w;
+			for( j = 0; j < 4; ++j )
+			{
+				t += (texel[j] - color[0][j]) * dir[j];
+			}
+			best = (int)(t * scale + 0.5f);
+			best = (best < 0) ? 0 : ((best >= num_indices) ? num_indices - 1 : best);
+			w = weights[best];
+			best_error = 0;
+			for( j = 0; j < 4; ++j )
+			{
+				const int d = texel[j] - (((64 - w) * color[0][j] + w * color[1][j] + 32) >> 6);
+				best_error += d * d;
+			}
+		}
+		index[i] = best;
+		error += best_error;
+	}
+	return error;
+}
+
+/*	quantizes one end point with the p-bit p (or none if p < 0)
+	\return how far it moved, squared	*/
+static float quantize_end_point(
+		const float value[4],
+		const BC7_fit_params *params,
+		int p,
+		int endpoint[4], int color[4] )
+{
+	float error = 0.0f;
+	int j;
+	for( j = 0; j < 4; ++j )
+	{
+		float d;
+		if( j >= params->num )
+		{
+			endpoint[j] = color[j] = 0;
+			continue;
+		}
+		endpoint[j] = quantize( value[j], params->bits, p );
+		if( p < 0 )
+		{
+			color[j] = expand_bits( endpoint[j], params->bits );
+		} else
+		{
+			color[j] = expand_bits( (endpoint[j] << 1) | p, params->bits + 1 );
+		}
+		d = color[j] - value[j];
+		error += d * d;
+	}
+	return error;
+}
+
+/*	quantizes the end points lo & hi, keeping them if they beat fit.
+	Exhaustive tries every allowed p-bit choice, else the p-bits that
+	keep the end points closest are used	*/
+static void try_end_points(
+		const BC7_subset *subset,
+		const BC7_fit_params *params,
+		const float lo[4], const float hi[4],
+		BC7_fit *fit )
+{
+	BC7_fit trial;
+	int color[2][4];
+	int combo, num_combos = 1;
+	if( params->exhaustive && (params->pbit_forced < 0) )
+	{
+		num_combos = (params->pbit_mode == BC7_PBIT_UNIQUE) ? 4 :
+				((params->pbit_mode == BC7_PBIT_SHARED) ? 2 : 1);
+	}
+	for( combo = 0; combo < num_combos; ++combo )
+	{
+		if( (params->pbit_mode == BC7_PBIT_NONE) || (params->pbit_forced >= 0) )
+		{
+			trial.pbit[0] = trial.pbit[1] =
+					(params->pbit_mode == BC7_PBIT_NONE) ? -1 : params->pbit_forced;
+			quantize_end_point( lo, params, trial.pbit[0], trial.endpoint[0], color[0] );
+			quantize_end_point( hi, params, trial.pbit[1], trial.endpoint[1], color[1] );
+		} else if( params->exhaustive )
+		{
+			trial.pbit[0] = (params->pbit_mode == BC7_PBIT_UNIQUE) ? (combo & 1) : combo;
+			trial.pbit[1] = (params->pbit_mode == BC7_PBIT_UNIQUE) ? (combo >> 1) : combo;
+			quantize_end_point( lo, params, trial.pbit[0], trial.endpoint[0], color[0] );
+			quantize_end_point( hi, params, trial.pbit[1], trial.endpoint[1], color[1] );
+		} else
+		{
+			int endpoint[2][2][4], p_color[2][2][4], e;
+			float error[2][2];
+			for( e = 0; e < 2; ++e )
+			{
+				error[e][0] = quantize_end_point( e ? hi : lo, params, 0, endpoint[e][0], p_color[e][0] );
+				error[e][1] = quantize_end_point( e ? hi : lo, params, 1, endpoint[e][1], p_color[e][1] );
+				trial.pbit[e] = (error[e][1] < error[e][0]);
+			}
+			if( params->pbit_mode == BC7_PBIT_SHARED )
+			{
+				trial.pbit[0] = trial.pbit[1] =
+						(error[0][1] + error[1][1] < error[0][0] + error[1][0]);
+			}
+			for( e = 0; e < 2; ++e )
+			{
+				memcpy( trial.endpoint[e], endpoint[e][trial.pbit[e]], sizeof( trial.endpoint[e] ) );
+				memcpy( color[e], p_color[e][trial.pbit[e]], sizeof( color[e] ) );
+			}
+		}
+		trial.error = choose_indices( subset, params, color, trial.index );
+		if( trial.error < fit->error )
+		{
+			*fit = trial;
+		}
+	}
+}
+
+/*	fits one subset: end points from the main axis, then (if exhaustive)
+	refined by least squares against the indices they got	*/
+static void fit_subset(
+		const BC7_subset *subset,
+		const BC7_fit_params *params,
+		BC7_fit *fit )
+{
+	float mean[4], axis[4], lo[4], hi[4];
+	float t_min = 0.0f, t_max = 0.0f;
+	unsigned char index[16];
+	int i, j, iteration;
+	fit->error = 0x7FFFFFFF;
+	principal_axis( subset, mean, axis );
+	for( i = 0; i < subset->count; ++i )
+	{
+		float t = 0.0f;
+		for( j = 0; j < 4; ++j )
+		{
+			t += (subset->texel[i][j] - mean[j]) * axis[j];
+		}
+		t_min = (t < t_min) ? t : t_min;
+		t_max = (t > t_max) ? t : t_max;
+	}
+	for( j = 0; j < 4; ++j )
+	{
+		lo[j] = mean[j] + t_min * axis[j];
+		hi[j] = mean[j] + t_max * axis[j];
+		lo[j] = (lo[j] < 0.0f) ? 0.0f : ((lo[j] > 255.0f) ? 255.0f : lo[j]);
+		hi[j] = (hi[j] < 0.0f) ? 0.0f : ((hi[j] > 255.0f) ? 255.0f : hi[j]);
+	}
+	try_end_points( subset, params, lo, hi, fit );
+	for( iteration = 0; params->exhaustive && (iteration < 2) && (fit->error > 0); ++iteration )
+	{
+		/*	least squares: (1-w) lo + w hi ~ texel, for the chosen w	*/
+		const int *weights = index_weights( params->index_bits );
+		float A = 0.0f, B = 0.0f, C = 0.0f, det;
+		float X[4] = { 0.0f, 0.0f, 0.0f, 0.0f }, Y[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+		int previous_error = fit->error;
+		for( i = 0; i < subset->count; ++i )
+		{
+			const float w = weights[fit->index[i]] * (1.0f / 64.0f);
+			A += (1.0f - w) * (1.0f - w);
+			B += w * w;
+			C += (1.0f - w) * w;
+			for( j = 0; j < 4; ++j )
+			{
+				X[j] += (1.0f - w) * subset->texel[i][j];
+				Y[j] += w * subset->texel[i][j];
+			}
+		}
+		det = A * B - C * C;
+		if( det < 1e-6f )
+		{
+			break;
+		}
+		det = 1.0f / det;
+		for( j = 0; j < 4; ++j )
+		{
+			lo[j] = (B * X[j] - C * Y[j]) * det;
+			hi[j] = (A * Y[j] - C * X[j]) * det;
+			lo[j] = (lo[j] < 0.0f) ? 0.0f : ((lo[j] > 255.0f) ? 255.0f : lo[j]);
+			hi[j] = (hi[j] < 0.0f) ? 0.0f : ((hi[j] > 255.0f) ? 255.0f : hi[j]);
+		}
+		try_end_points( subset, params, lo, hi, fit );
+		if( fit->error >= previous_error )
+		{
+			break;
+		}
+	}
+	/*	the indices so far follow the subset, the block wants them by texel	*/
+	memcpy( index, fit->index, 16 );
+	for( i = 0; i < subset->count; ++i )
+	{
+		fit->index[subset->members[i]] = index[i];
+	}
+}
+
+/*	the anchor texel's index must have its top bit clear: if not, swap
+	the end points, which mirrors the indices	*/
+static void fix_anchor( BC7_fit *fit, int anchor, int index_bits,
+		int subset, unsigned int partition_mask )
+{
+	const int top = (1 << index_bits) - 1;
+	int i, j;
+	if( fit->index[anchor] <= (top >> 1) )
+	{
+		return;
+	}
+	for( j = 0; j < 4; ++j )
+	{
+		const int t = fit->endpoint[0][j];
+		fit->endpoint[0][j] = fit->endpoint[1][j];
+		fit->endpoint[1][j] = t;
+	}
+	j = fit->pbit[0];
+	fit->pbit[0] = fit->pbit[1];
+	fit->pbit[1] = j;
+	for( i = 0; i < 16; ++i )
+	{
+		if( (int)((partition_mask >> i) & 1) == subset )
+		{
+			fit->index[i] = top - fit->index[i];
+		}
+	}
+}
+
+/*	writes a block in mode 1, 3 or 6 (all the channels in fits)	*/
+static void pack_block(
+		int mode, int partition,
+		BC7_fit *fits, int num_subsets,
+		int num_channels, int bits, int pbit_mode, int index_bits,
+		unsigned char compressed[16] )
+{
+	BC7_bit_writer writer;
+	const unsigned int mask = (num_subsets > 1) ? BC7_partitions2[partition] : 0;
+	int s, e, j, i;
+	fix_anchor( &fits[0], 0, index_bits, 0, mask );
+	if( num_subsets > 1 )
+	{
+		fix_anchor( &fits[1], BC7_anchors2[partition], index_bits, 1, mask );
+	}
+	memset( compressed, 0, 16 );
+	writer.data = compressed;
+	writer.position = 0;
+	put_bits( &writer, 1 << mode, mode + 1 );
+	if( num_subsets > 1 )
+	{
+		put_bits( &writer, partition, 6 );
+	}
+	/*	R for every end point, then G, B (and A)	*/
+	for( j = 0; j < num_channels; ++j )
+	{
+		for( s = 0; s < num_subsets; ++s )
+		{
+			for( e = 0; e < 2; ++e )
+			{
+				put_bits( &writer, fits[s].endpoint[e][j], bits );
+			}
+		}
+	}
+	for( s = 0; s < num_subsets; ++s )
+	{
+		if( pbit_mode == BC7_PBIT_UNIQUE )
+		{
+			put_bits( &writer, fits[s].pbit[0], 1 );
+			put_bits( &writer, fits[s].pbit[1], 1 );
+		} else if( pbit_mode == BC7_PBIT_SHARED )
+		{
+			put_bits( &writer, fits[s].pbit[0], 1 );
+		}
+	}
+	for( i = 0; i < 16; ++i )
+	{
+		const int subset = (mask >> i) & 1;
+		const int anchor = (i == 0) || ((subset == 1) && (i == BC7_anchors2[partition]));
+		put_bits( &writer, fits[subset].index[i], index_bits - anchor );
+	}
+}
+
+/*	writes a block in mode 5	*/
+static void pack_block_mode5(
+		int rotation,
+		BC7_fit *color, BC7_fit *alpha,
+		unsigned char compressed[16] )
+{
+	BC7_bit_writer writer;
+	int e, j, i;
+	fix_anchor( color, 0, 2, 0, 0 );
+	fix_anchor( alpha, 0, 2, 0, 0 );
+	memset( compressed, 0, 16 );
+	writer.data = compressed;
+	writer.position = 0;
+	put_bits( &writer, 1 << 5, 6 );
+	put_bits( &writer, rotation, 2 );
+	for( j = 0; j < 3; ++j )
+	{
+		for( e = 0; e < 2; ++e )
+		{
+			put_bits( &writer, color->endpoint[e][j], 7 );
+		}
+	}
+	for( e = 0; e < 2; ++e )
+	{
+		put_bits( &writer, alpha->endpoint[e][0], 8 );
+	}
+	for( i = 0; i < 16; ++i )
+	{
+		put_bits( &writer, color->index[i], (i == 0) ? 1 : 2 );
+	}
+	for( i = 0; i < 16; ++i )
+	{
+		put_bits( &writer, alpha->index[i], (i == 0) ? 1 : 2 );
+	}
+}
+
+/*	the number of bits set in a 16 bit mask	*/
+static int count_bits( unsigned int x )
+{
+	x = x - ((x >> 1) & 0x5555);
+	x = (x & 0x3333) + ((x >> 2) & 0x3333);
+	x = (x + (x >> 4)) & 0x0F0F;
+	return (x + (x >> 8)) & 0x1F;
+}
+
+/*	the sum over both subsets of how far the texels are from their
+	subset's main axis, a cheap guess at how well a partition will do	*/
+static float partition_estimate(
+		const unsigned char texels[16][4], int partition )
+{
+	const unsigned int mask = BC7_partitions2[partition];
+	BC7_subset subset;
+	unsigned char members[16];
+	float estimate = 0.0f;
+	int s, i, j, count;
+	for( s = 0; s < 2; ++s )
+	{
+		float mean[4], axis[4];
+		count = 0;
+		for( i = 0; i < 16; ++i )
+		{
+			if( (int)((mask >> i) & 1) == s )
+			{
+				members[count++] = i;
+			}
+		}
+		gather_subset( texels, members, count, 0, 3, &subset );
+		principal_axis( &subset, mean, axis );
+		for( i = 0; i < count; ++i )
+		{
+			float d, dd = 0.0f, t = 0.0f;
+			for( j = 0; j < 4; ++j )
+			{
+				d = subset.texel[i][j] - mean[j];
+				dd += d * d;
+				t += d * axis[j];
+			}
+			estimate += dd - t*t;
+		}
+	}
+	return estimate;
+}
+
+/*	the 2 subset partition that best matches splitting the texels
+	across the middle of their main axis	*/
+static int matching_partition( const unsigned char texels[16][4] )
+{
+	BC7_subset subset;
+	float mean[4], axis[4];
+	unsigned int split = 0;
+	int i, p, best = 0, best_distance = 17;
+	gather_subset( texels, BC7_all_texels, 16, 0, 3, &subset );
+	principal_axis( &subset, mean, axis );
+	for( i = 0; i < 16; ++i )
+	{
+		float t = (subset.texel[i][0] - mean[0]) * axis[0] +
+				(subset.texel[i][1] - mean[1]) * axis[1] +
+				(subset.texel[i][2] - mean[2]) * axis[2];
+		split |= (t > 0.0f) << i;
+	}
+	for( p = 0; p < 64; ++p )
+	{
+		/*	the subsets can be either way round	*/
+		int distance = count_bits( split ^ BC7_partitions2[p] );
+		if( 16 - distance < distance )
+		{
+			distance = 16 - distance;
+		}
+		if( distance < best_distance )
+		{
+			best_distance = distance;
+			best = p;
+		}
+	}
+	return best;
+}
+
+/*	tries mode 1 or 3 with one partition	*/
+static void try_two_subsets(
+		const unsigned char texels[16][4],
+		int mode, int partition, int exhaustive,
+		int *best_error, unsigned char compressed[16] )
+{
+	const unsigned int mask = BC7_partitions2[partition];
+	BC7_fit_params params;
+	BC7_subset subset;
+	BC7_fit fits[2];
+	unsigned char members[2][16];
+	int count[2] = { 0, 0 };
+	int i;
+	for( i = 0; i < 16; ++i )
+	{
+		const int s = (mask >> i) & 1;
+		members[s][count[s]++] = i;
+	}
+	params.num = 3;
+	params.bits = (mode == 1) ? 6 : 7;
+	params.pbit_mode = (mode == 1) ? BC7_PBIT_SHARED : BC7_PBIT_UNIQUE;
+	params.pbit_forced = -1;
+	params.index_bits = (mode == 1) ? 3 : 2;
+	params.exhaustive = exhaustive;
+	gather_subset( texels, members[0], count[0], 0, 3, &subset );
+	fit_subset( &subset, &params, &fits[0] );
+	if( fits[0].error >= *best_error )
+	{
+		return;
+	}
+	gather_subset( texels, members[1], count[1], 0, 3, &subset );
+	fit_subset( &subset, &params, &fits[1] );
+	if( fits[0].error + fits[1].error < *best_error )
+	{
+		*best_error = fits[0].error + fits[1].error;
+		pack_block( mode, partition, fits, 2, 3,
+				params.bits, params.pbit_mode, params.index_bits, compressed );
+	}
+}
+
+/*	tries mode 5 with one rotation (alpha swapped with R, G or B)	*/
+static void try_mode5(
+		const unsigned char texels[16][4],
+		int rotation, int exhaustive,
+		int *best_error, unsigned char compressed[16] )
+{
+	unsigned char rotated[16][4];
+	BC7_fit_params params;
+	BC7_subset subset;
+	BC7_fit color, alpha;
+	int i;
+	memcpy( rotated, texels, sizeof( rotated ) );
+	if( rotation > 0 )
+	{
+		for( i = 0; i < 16; ++i )
+		{
+			rotated[i][rotation - 1] = texels[i][3];
+			rotated[i][3] = texels[i][rotation - 1];
+		}
+	}
+	params.num = 3;
+	params.bits = 7;
+	params.pbit_mode = BC7_PBIT_NONE;
+	params.pbit_forced = -1;
+	params.index_bits = 2;
+	params.exhaustive = exhaustive;
+	gather_subset( (const unsigned char (*)[4])rotated, BC7_all_texels, 16, 0, 3, &subset );
+	fit_subset( &subset, &params, &color );
+	if( color.error >= *best_error )
+	{
+		return;
+	}
+	params.num = 1;
+	params.bits = 8;
+	gather_subset( (const unsigned char (*)[4])rotated, BC7_all_texels, 16, 3, 1, &subset );
+	fit_subset( &subset, &params, &alpha );
+	if( color.error + alpha.error < *best_error )
+	{
+		*best_error = color.error + alpha.error;
+		pack_block_mode5( rotation, &color, &alpha, compressed );
+	}
+}
+
+void
+	compress_BC7_block
+	(
+		const unsigned char texels[64],
+		int preset,
+		unsigned char compressed[16]
+	)
+{
+	const unsigned char (*block)[4] = (const unsigned char (*)[4])texels;
+	const int slow = (preset == BC7_PRESET_SLOW);
+	BC7_fit_params params;
+	BC7_subset subset;
+	BC7_fit fit;
+	int best_error, opaque = 1, i;
+	for( i = 0; i < 16; ++i )
+	{
+		opaque &= (block[i][3] == 255);
+	}
+	/*	mode 6 does everything, if not always well	*/
+	params.num = 4;
+	params.bits = 7;
+	params.pbit_mode = BC7_PBIT_UNIQUE;
+	/*	alpha 255 needs p-bits of 1, opaque has to stay opaque	*/
+	params.pbit_forced = opaque ? 1 : -1;
+	params.index_bits = 4;
+	params.exhaustive = slow;
+	gather_subset( block, BC7_all_texels, 16, 0, 4, &subset );
+	fit_subset( &subset, &params, &fit );
+	best_error = fit.error;
+	pack_block( 6, 0, &fit, 1, 4, params.bits, params.pbit_mode, params.index_bits, compressed );
+	if( (best_error == 0) || (!slow && (best_error < BC7_FAST_RETRY_ERROR)) )
+	{
+		return;
+	}
+	if( opaque )
+	{
+		/*	modes 1 and 3 split the block in 2	*/
+		if( slow )
+		{
+			float estimate[64];
+			int order[BC7_SLOW_PARTITIONS], num_order = 0, p, k;
+			/*	keep the partitions that look best, best first	*/
+			for( p = 0; p < 64; ++p )
+			{
+				estimate[p] = partition_estimate( block, p );
+				for( k = num_order; (k > 0) && (estimate[order[k-1]] > estimate[p]); --k )
+				{
+					if( k < BC7_SLOW_PARTITIONS )
+					{
+						order[k] = order[k-1];
+					}
+				}
+				if( k < BC7_SLOW_PARTITIONS )
+				{
+					order[k] = p;
+					if( num_order < BC7_SLOW_PARTITIONS )
+					{
+						++num_order;
+					}
+				}
+			}
+			for( k = 0; k < num_order; ++k )
+			{
+				try_two_subsets( block, 1, order[k], 1, &best_error, compressed );
+				try_two_subsets( block, 3, order[k], 1, &best_error, compressed );
+			}
+		} else
+		{
+			try_two_subsets( block, 1, matching_partition( block ), 0, &best_error, compressed );
+		}
+	} else
+	{
+		/*	mode 5 fits alpha on its own	*/
+		int rotation;
+		for( rotation = 0; rotation < (slow ? 4 : 1); ++rotation )
+		{
+			try_mode5( block, rotation, slow, &best_error, compressed );
+		}
+	}
+}
+
+/*	the part of an image one job compresses	*/
+typedef struct
+{
+	const unsigned char *uncompressed;
+	int width, height, channels;
+	int preset;
+	unsigned char *compressed;
+	/*	the number of rows of blocks in each job	*/
+	int rows_per_job;
+}
+BC7_job;
+
+static void compress_BC7_rows( void *user_data, int job_index )
+{
+	const BC7_job *job = (const BC7_job*)user_data;
+	const int blocks_wide = (job->width + 3) >> 2;
+	const int blocks_high = (job->height + 3) >> 2;
+	unsigned char texels[64];
+	int bi, bj, x, y;
+	int first_row = job_index * job->rows_per_job;
+	int last_row = first_row + job->rows_per_job;
+	if( last_row > blocks_high )
+	{
+		last_row = blocks_high;
+	}
+	for( bj = first_row; bj < last_row; ++bj )
+	{
+		for( bi = 0; bi < blocks_wide; ++bi )
+		{
+			for( y = 0; y < 4; ++y )
+			{
+				/*	the blocks on the edge repeat the last row / column	*/
+				int sy = bj*4 + y;
+				if( sy >= job->height )
+				{
+					sy = job->height - 1;
+				}
+				for( x = 0; x < 4; ++x )
+				{
+					const unsigned char *src;
+					unsigned char *dst = &texels[(y*4 + x) * 4];
+					int sx = bi*4 + x;
+					if( sx >= job->width )
+					{
+						sx = job->width - 1;
+					}
+					src = &job->uncompressed[(sy * job->width + sx) * job->channels];
+					if( job->channels < 3 )
+					{
+						/*	luminance (alpha)	*/
+						dst[0] = dst[1] = dst[2] = src[0];
+						dst[3] = (job->channels == 2) ? src[1] : 255;
+					} else
+					{
+						dst[0] = src[0];
+						dst[1] = src[1];
+						dst[2] = src[2];
+						dst[3] = (job->channels == 4) ? src[3] : 255;
+					}
+				}
+			}
+			compress_BC7_block( texels, job->preset,
+					&job->compressed[(bj * blocks_wide + bi) * 16] );
+		}
+	}
+}
+
+unsigned char*
+	convert_image_to_BC7
+	(
+		const unsigned char *const uncompressed,
+		int width, int height, int channels,
+		int preset,
+		int *out_size
+	)
+{
+	BC7_job job;
+	int blocks_high, num_jobs;
+	*out_size = 0;
+	if( (width < 1) || (height < 1) ||
+		(NULL == uncompressed) ||
+		(channels < 1) || (channels > 4) )
+	{
+		return NULL;
+	}
+	job.uncompressed = uncompressed;
+	job.width = width;
+	job.height = height;
+	job.channels = channels;
+	job.preset = preset;
+	job.compressed = (unsigned char*)malloc( ((width+3) >> 2) * ((height+3) >> 2) * 16 );
+	if( NULL == job.compressed )
+	{
+		return NULL;
+	}
+	*out_size = ((width+3) >> 2) * ((height+3) >> 2) * 16;
+	/*	every block is a lot of work, so even small images are split
+		into bands of block rows, compressed in parallel	*/
+	blocks_high = (height + 3) >> 2;
+	if( blocks_high >= 8 )
+	{
+		job.rows_per_job = 4;
+		num_jobs = (blocks_high + job.rows_per_job - 1) / job.rows_per_job;
+		image_jobs_run( compress_BC7_rows, &job, num_jobs );
+	} else
+	{
+		job.rows_per_job = blocks_high;
+		compress_BC7_rows( &job, 0 );
+	}
+	return job.compressed;
+}
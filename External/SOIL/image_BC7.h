@@ -0,0 +1,71 @@
+/*
+	BC7 compression
+
+	Compresses RGBA images to BC7 (BPTC), which keeps 8 bit alpha and
+	smooth gradients far better than DXT5 does, at the same 16 bytes
+	per 4x4 block.  The encoder uses four of the eight BC7 modes:
+	modes 1 and 3 (2 subsets, opaque), mode 5 (color and alpha fit
+	separately, with a channel rotation) and mode 6 (1 subset RGBA).
+
+	There are no OpenGL calls in here.
+
+	Public Domain
+*/
+
+#ifndef HEADER_IMAGE_BC7
+#define HEADER_IMAGE_BC7
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+	How hard the BC7 encoder tries.
+	BC7_PRESET_FAST: mode 6; only the blocks it does badly on also try
+		mode 1 (opaque, on the partition that matches the colors best)
+		or mode 5 (with alpha, no rotation), for compressing at load time
+		(about 2 to 3 times as long as DXT5: soil_bench's bc7_vs_dxt5)
+	BC7_PRESET_SLOW: modes 1 and 3 on the 8 most promising partitions,
+		mode 5 in every rotation and mode 6, with every end point refined
+		by least squares, for offline baking
+**/
+enum
+{
+	BC7_PRESET_FAST = 0,
+	BC7_PRESET_SLOW = 1
+};
+
+/**
+	Compresses one 4x4 block.
+	\param texels 16 RGBA texels, row by row
+	\param preset one of the BC7_PRESET_*
+	\param compressed receives the 16 byte block
+**/
+void
+	compress_BC7_block
+	(
+		const unsigned char texels[64],
+		int preset,
+		unsigned char compressed[16]
+	);
+
+/**
+	take an image and convert it to BC7 (1 or 2 channel images are
+	used as luminance / luminance alpha), large images are compressed
+	on all the cores
+	\return the compressed image (free() it), or NULL if out of RAM
+**/
+unsigned char*
+	convert_image_to_BC7
+	(
+		const unsigned char *const uncompressed,
+		int width, int height, int channels,
+		int preset,
+		int *out_size
+	);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HEADER_IMAGE_BC7	*/
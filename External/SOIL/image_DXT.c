@@ -8,6 +8,9 @@
 */
 
 #include "image_DXT.h"
+#include "image_BC7.h"
+#include "image_helper.h"
+#include "image_jobs.h"
 #include <math.h>
 #include <stdlib.h>
 #include <string.h>
@@ -29,6 +32,23 @@ void compress_DDS_color_block(
 				int channels,
 				const unsigned char *const uncompressed,
 				unsigned char compressed[8] );
+/*
+	The same, at one of the DXT_QUALITY_* levels.
+*/
+void compress_DDS_color_block_quality(
+				int channels,
+				const unsigned char *const uncompressed,
+				int quality,
+				unsigned char compressed[8] );
+/*
+	Stores the end points and picks the index of every texel
+	by projecting it onto the line between them.
+*/
+void encode_DDS_color_block(
+				int channels,
+				const unsigned char *const uncompressed,
+				int enc_c0, int enc_c1,
+				unsigned char compressed[8] );
 /*
 	Takes a 4x4 block of pixels and compresses the alpha
 	component it into 8 bytes for use in DXT5 DDS files.
@@ -37,6 +57,39 @@ void compress_DDS_color_block(
 void compress_DDS_alpha_block(
 				const unsigned char *const uncompressed,
 				unsigned char compressed[8] );
+/*
+	Takes 16 samples of a single channel, stride bytes apart, and
+	compresses them into 8 bytes the same way as the DXT5 alpha.
+	That is also a whole BC4 block, or half of a BC5 block.
+	The DXT5 alpha truncates each sample into one of 8 equal bins,
+	round_to_nearest picks the closest of the 8 values instead.
+*/
+void compress_DDS_channel_block(
+				const unsigned char *const uncompressed,
+				int stride, int round_to_nearest,
+				unsigned char compressed[8] );
+/*
+	Writes the DDS header and the compressed data to a file.
+	A DXGI_format other than 0 is written in a DX10 header
+	(and fourCC is ignored).
+*/
+int write_DDS_file(
+				const char *filename,
+				int width, int height,
+				unsigned int fourCC,
+				unsigned int DXGI_format,
+				const unsigned char *const DDS_data,
+				int DDS_size );
+/*
+	Writes the DDS header (and the DX10 header if DXGI_format is
+	not 0) to an open file.  mipmaps counts the levels, 1 for none.
+*/
+int write_DDS_header(
+				FILE *fout,
+				int width, int height, int mipmaps,
+				unsigned int fourCC,
+				unsigned int DXGI_format,
+				int main_size );
 
 /********* Actual Exposed Functions *********/
 int
@@ -46,12 +99,24 @@ int
 		int width, int height, int channels,
 		const unsigned char *const data
 	)
+{
+	return save_image_as_DDS_quality(
+			filename, width, height, channels, data, DXT_QUALITY_DEFAULT );
+}
+
+int
+	save_image_as_DDS_quality
+	(
+		const char *filename,
+		int width, int height, int channels,
+		const unsigned char *const data,
+		int quality
+	)
 {
 	/*	variables	*/
-	FILE *fout;
 	unsigned char *DDS_data;
-	DDS_header header;
-	int DDS_size;
+	unsigned int fourCC;
+	int DDS_size, result;
 	/*	error check	*/
 	if( (NULL == filename) ||
 		(width < 1) || (height < 1) ||
@@ -64,44 +129,384 @@ int
 	if( (channels & 1) == 1 )
 	{
 		/*	no alpha, just use DXT1	*/
-		DDS_data = convert_image_to_DXT1( data, width, height, channels, &DDS_size );
+		DDS_data = convert_image_to_DXT1_quality( data, width, height, channels, quality, &DDS_size );
 	} else
 	{
 		/*	has alpha, so use DXT5	*/
-		DDS_data = convert_image_to_DXT5( data, width, height, channels, &DDS_size );
+		DDS_data = convert_image_to_DXT5_quality( data, width, height, channels, quality, &DDS_size );
 	}
 	/*	save it	*/
-	memset( &header, 0, sizeof( DDS_header ) );
-	header.dwMagic = ('D' << 0) | ('D' << 8) | ('S' << 16) | (' ' << 24);
-	header.dwSize = 124;
-	header.dwFlags = DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT | DDSD_LINEARSIZE;
-	header.dwWidth = width;
-	header.dwHeight = height;
-	header.dwPitchOrLinearSize = DDS_size;
-	header.sPixelFormat.dwSize = 32;
-	header.sPixelFormat.dwFlags = DDPF_FOURCC;
 	if( (channels & 1) == 1 )
 	{
-		header.sPixelFormat.dwFourCC = ('D' << 0) | ('X' << 8) | ('T' << 16) | ('1' << 24);
+		fourCC = ('D' << 0) | ('X' << 8) | ('T' << 16) | ('1' << 24);
 	} else
 	{
-		header.sPixelFormat.dwFourCC = ('D' << 0) | ('X' << 8) | ('T' << 16) | ('5' << 24);
+		fourCC = ('D' << 0) | ('X' << 8) | ('T' << 16) | ('5' << 24);
 	}
-	header.sCaps.dwCaps1 = DDSCAPS_TEXTURE;
-	/*	write it out	*/
-	fout = fopen( filename, "wb");
-	fwrite( &header, sizeof( DDS_header ), 1, fout );
-	fwrite( DDS_data, 1, DDS_size, fout );
-	fclose( fout );
+	result = write_DDS_file( filename, width, height, fourCC, 0, DDS_data, DDS_size );
 	/*	done	*/
 	free( DDS_data );
-	return 1;
+	return result;
+}
+
+int
+	save_image_as_DDS_RGTC
+	(
+		const char *filename,
+		int width, int height, int channels,
+		const unsigned char *const data
+	)
+{
+	/*	variables	*/
+	unsigned char *DDS_data;
+	unsigned int fourCC;
+	int DDS_size, result;
+	/*	error check	*/
+	if( (NULL == filename) ||
+		(width < 1) || (height < 1) ||
+		(channels < 1) || (channels > 4) ||
+		(data == NULL ) )
+	{
+		return 0;
+	}
+	/*	Convert the image	*/
+	if( channels == 1 )
+	{
+		/*	one channel, BC4	*/
+		DDS_data = convert_image_to_BC4( data, width, height, channels, &DDS_size );
+		fourCC = ('A' << 0) | ('T' << 8) | ('I' << 16) | ('1' << 24);
+	} else
+	{
+		/*	two channels (or the X and Y of a normal map), BC5	*/
+		DDS_data = convert_image_to_BC5( data, width, height, channels, &DDS_size );
+		fourCC = ('A' << 0) | ('T' << 8) | ('I' << 16) | ('2' << 24);
+	}
+	result = write_DDS_file( filename, width, height, fourCC, 0, DDS_data, DDS_size );
+	free( DDS_data );
+	return result;
+}
+
+int
+	save_image_as_DDS_BC7
+	(
+		const char *filename,
+		int width, int height, int channels,
+		const unsigned char *const data,
+		int preset
+	)
+{
+	/*	variables	*/
+	unsigned char *DDS_data;
+	int DDS_size, result;
+	/*	error check	*/
+	if( (NULL == filename) ||
+		(width < 1) || (height < 1) ||
+		(channels < 1) || (channels > 4) ||
+		(data == NULL ) )
+	{
+		return 0;
+	}
+	/*	BC7 has no four CC of its own, it needs the DX10 header	*/
+	DDS_data = convert_image_to_BC7( data, width, height, channels, preset, &DDS_size );
+	result = write_DDS_file( filename, width, height, 0,
+			DDS_DXGI_FORMAT_BC7_UNORM, DDS_data, DDS_size );
+	free( DDS_data );
+	return result;
+}
+
+/*	one level of the MIPmap chain being streamed out	*/
+typedef struct
+{
+	int width, height;
+	/*	a ring of the rows of its current rows of blocks
+		(level 0 is read straight from the image instead)	*/
+	unsigned char *rows;
+	int num_rows;
+	/*	the rows of blocks waiting to be compressed, and where they go	*/
+	int first_pending, num_pending;
+	unsigned char *compressed;
+	/*	where the level starts in the file, and the size of its rows of blocks	*/
+	long file_offset;
+	int row_bytes;
+}
+DDS_stream_level;
+
+/*	a run of blocks in one row for one job to compress	*/
+typedef struct
+{
+	int level, block_row, first_block, num_blocks;
+}
+DDS_stream_chunk;
+
+#define DDS_STREAM_MAX_LEVELS	32
+/*	the blocks per job, and about how many blocks of the image go
+	in one batch of jobs, large enough to be worth starting threads	*/
+#define DDS_STREAM_CHUNK_BLOCKS	64
+#define DDS_STREAM_BATCH_BLOCKS	4096
+
+typedef struct
+{
+	const unsigned char *image;
+	int channels, format, quality, block_bytes;
+	int num_levels;
+	DDS_stream_level levels[DDS_STREAM_MAX_LEVELS];
+	DDS_stream_chunk *chunks;
+	int num_chunks;
+}
+DDS_stream;
+
+void DDS_stream_row_done( DDS_stream *stream, int level, int row );
+void compress_DDS_stream_chunk( void *user_data, int job_index );
+int write_DDS_stream_pending( DDS_stream *stream, FILE *fout, long *file_position );
+
+int
+	save_image_as_DDS_mipmapped
+	(
+		const char *filename,
+		int width, int height, int channels,
+		const unsigned char *const data,
+		int format,
+		int quality
+	)
+{
+	FILE *fout;
+	unsigned int fourCC = 0, DXGI_format = 0;
+	long level_offsets[DDS_STREAM_MAX_LEVELS];
+	int i, num_levels, result;
+	/*	error check	*/
+	if( (NULL == filename) ||
+		(width < 1) || (height < 1) ||
+		(channels < 1) || (channels > 4) ||
+		(data == NULL ) )
+	{
+		return 0;
+	}
+	switch( format )
+	{
+	case DDS_STREAM_DXT:
+		fourCC = ('D' << 0) | ('X' << 8) | ('T' << 16) | ((channels & 1) ? '1' : '5') << 24;
+		break;
+	case DDS_STREAM_RGTC:
+		fourCC = ('A' << 0) | ('T' << 8) | ('I' << 16) | ((channels == 1) ? '1' : '2') << 24;
+		break;
+	case DDS_STREAM_BC7:
+		DXGI_format = DDS_DXGI_FORMAT_BC7_UNORM;
+		break;
+	default:
+		return 0;
+	}
+	/*	the levels follow the headers one after the other	*/
+	num_levels = count_mipmap_levels( width, height );
+	level_offsets[0] = sizeof( DDS_header ) + (DXGI_format ? sizeof( DDS_header_DX10 ) : 0);
+	for( i = 1; i < num_levels; ++i )
+	{
+		level_offsets[i] = level_offsets[i-1] + compressed_level_size(
+				format, channels, width >> (i-1), height >> (i-1) );
+	}
+	fout = fopen( filename, "wb" );
+	if( NULL == fout )
+	{
+		return 0;
+	}
+	result = write_DDS_header( fout, width, height, num_levels,
+			fourCC, DXGI_format, compressed_level_size( format, channels, width, height ) ) &&
+		write_compressed_mipmaps( fout, width, height, channels, data,
+			format, quality, num_levels, level_offsets );
+	if( fclose( fout ) != 0 )
+	{
+		result = 0;
+	}
+	return result;
+}
+
+int
+	count_mipmap_levels
+	(
+		int width, int height
+	)
+{
+	int num_levels = 1;
+	while( (width > 1) || (height > 1) )
+	{
+		width >>= 1;
+		height >>= 1;
+		++num_levels;
+	}
+	return num_levels;
+}
+
+int
+	compressed_block_size
+	(
+		int format, int channels
+	)
+{
+	switch( format )
+	{
+	case DDS_STREAM_DXT:
+		return (channels & 1) ? 8 : 16;
+	case DDS_STREAM_RGTC:
+		return (channels == 1) ? 8 : 16;
+	case DDS_STREAM_BC7:
+		return 16;
+	default:
+		return 0;
+	}
+}
+
+int
+	compressed_level_size
+	(
+		int format, int channels,
+		int width, int height
+	)
+{
+	if( width < 1 )
+	{
+		width = 1;
+	}
+	if( height < 1 )
+	{
+		height = 1;
+	}
+	return ((width + 3) >> 2) * ((height + 3) >> 2) * compressed_block_size( format, channels );
+}
+
+int
+	write_compressed_mipmaps
+	(
+		FILE *fout,
+		int width, int height, int channels,
+		const unsigned char *const data,
+		int format,
+		int quality,
+		int num_levels,
+		const long *level_offsets
+	)
+{
+	DDS_stream stream;
+	unsigned char *RAM;
+	long file_position;
+	int i, j, y, band_rows, max_chunks = 0;
+	int rows_bytes = 0, compressed_bytes = 0;
+	int result = 1;
+	/*	error check	*/
+	if( (NULL == fout) || (NULL == level_offsets) ||
+		(width < 1) || (height < 1) ||
+		(channels < 1) || (channels > 4) ||
+		(data == NULL ) ||
+		(compressed_block_size( format, channels ) == 0) ||
+		(num_levels < 1) || (num_levels > count_mipmap_levels( width, height )) )
+	{
+		return 0;
+	}
+	memset( &stream, 0, sizeof( DDS_stream ) );
+	stream.image = data;
+	stream.channels = channels;
+	stream.format = format;
+	stream.quality = quality;
+	stream.block_bytes = compressed_block_size( format, channels );
+	stream.num_levels = num_levels;
+	/*	the image goes in in bands of a power of 2 rows of blocks, so
+		every level gets a whole number of its rows of blocks per band
+		(or one row of blocks, for the levels that need several bands)	*/
+	for( band_rows = 4;
+		(band_rows < height) &&
+		(((width + 3) >> 2) * (band_rows >> 2) * 2 <= DDS_STREAM_BATCH_BLOCKS);
+		band_rows *= 2 )
+	{
+	}
+	/*	lay out the levels	*/
+	for( i = 0; i < num_levels; ++i )
+	{
+		DDS_stream_level *L = &stream.levels[i];
+		L->width = (i == 0) ? width : stream.levels[i-1].width >> 1;
+		L->height = (i == 0) ? height : stream.levels[i-1].height >> 1;
+		if( L->width < 1 )
+		{
+			L->width = 1;
+		}
+		if( L->height < 1 )
+		{
+			L->height = 1;
+		}
+		L->num_rows = band_rows >> i;
+		if( L->num_rows < 4 )
+		{
+			L->num_rows = 4;
+		}
+		L->row_bytes = ((L->width + 3) >> 2) * stream.block_bytes;
+		L->file_offset = level_offsets[i];
+		if( i > 0 )
+		{
+			rows_bytes += L->num_rows * L->width * channels;
+		}
+		compressed_bytes += (L->num_rows >> 2) * L->row_bytes;
+		max_chunks += (L->num_rows >> 2) *
+				(((L->width + 3) >> 2) + DDS_STREAM_CHUNK_BLOCKS - 1) / DDS_STREAM_CHUNK_BLOCKS;
+	}
+	/*	a band per level, that's all the RAM I need	*/
+	RAM = (unsigned char*)malloc( rows_bytes + compressed_bytes );
+	stream.chunks = (DDS_stream_chunk*)malloc( max_chunks * sizeof( DDS_stream_chunk ) );
+	if( (NULL == RAM) || (NULL == stream.chunks) )
+	{
+		free( RAM );
+		free( stream.chunks );
+		return 0;
+	}
+	rows_bytes = 0;
+	for( i = 1; i < num_levels; ++i )
+	{
+		DDS_stream_level *L = &stream.levels[i];
+		L->rows = &RAM[rows_bytes];
+		rows_bytes += L->num_rows * L->width * channels;
+	}
+	for( i = 0; i < num_levels; ++i )
+	{
+		DDS_stream_level *L = &stream.levels[i];
+		L->compressed = &RAM[rows_bytes];
+		rows_bytes += (L->num_rows >> 2) * L->row_bytes;
+	}
+	file_position = ftell( fout );
+	/*	feed the image in a band at a time, each of its rows trickles
+		down the chain, and whichever rows of blocks that completes are
+		compressed and written before their rows are reused	*/
+	for( j = 0; result && (j < height); j += band_rows )
+	{
+		for( y = j; (y < j + band_rows) && (y < height); ++y )
+		{
+			DDS_stream_row_done( &stream, 0, y );
+		}
+		result = write_DDS_stream_pending( &stream, fout, &file_position );
+	}
+	free( RAM );
+	free( stream.chunks );
+	return result;
+}
+
+/*	counted by convert_image_to_DXT1/5_quality	*/
+static unsigned long DXT_conversions = 0;
+
+unsigned long num_DXT_conversions( void )
+{
+	return DXT_conversions;
 }
 
 unsigned char* convert_image_to_DXT1(
 		const unsigned char *const uncompressed,
 		int width, int height, int channels,
 		int *out_size )
+{
+	return convert_image_to_DXT1_quality(
+			uncompressed, width, height, channels,
+			DXT_QUALITY_DEFAULT, out_size );
+}
+
+unsigned char* convert_image_to_DXT1_quality(
+		const unsigned char *const uncompressed,
+		int width, int height, int channels,
+		int quality,
+		int *out_size )
 {
 	unsigned char *compressed;
 	int i, j, x, y;
@@ -117,6 +522,7 @@ unsigned char* convert_image_to_DXT1(
 	{
 		return NULL;
 	}
+	++DXT_conversions;
 	/*	for channels == 1 or 2, I do not step forward for R,G,B values	*/
 	if( channels < 3 )
 	{
@@ -131,45 +537,124 @@ unsigned char* convert_image_to_DXT1(
 	{
 		for( i = 0; i < width; i += 4 )
 		{
-			/*	copy this block into a new one	*/
+			/*	copy this block into a new one,
+				the blocks on the edge repeat the last row / column	*/
 			int idx = 0;
-			int mx = 4, my = 4;
-			if( j+4 >= height )
+			for( y = 0; y < 4; ++y )
 			{
-				my = height - j;
+				int sy = j + y;
+				if( sy >= height )
+				{
+					sy = height - 1;
+				}
+				for( x = 0; x < 4; ++x )
+				{
+					int sx = i + x;
+					if( sx >= width )
+					{
+						sx = width - 1;
+					}
+					ublock[idx++] = uncompressed[sy*width*channels+sx*channels];
+					ublock[idx++] = uncompressed[sy*width*channels+sx*channels+chan_step];
+					ublock[idx++] = uncompressed[sy*width*channels+sx*channels+chan_step+chan_step];
+				}
 			}
-			if( i+4 >= width )
+			/*	compress the block	*/
+			++block_count;
+			compress_DDS_color_block_quality( 3, ublock, quality, cblock );
+			/*	copy the data from the block into the main block	*/
+			for( x = 0; x < 8; ++x )
 			{
-				mx = width - i;
+				compressed[index++] = cblock[x];
 			}
-			for( y = 0; y < my; ++y )
+		}
+	}
+	return compressed;
+}
+
+unsigned char* convert_image_to_DXT5(
+		const unsigned char *const uncompressed,
+		int width, int height, int channels,
+		int *out_size )
+{
+	return convert_image_to_DXT5_quality(
+			uncompressed, width, height, channels,
+			DXT_QUALITY_DEFAULT, out_size );
+}
+
+unsigned char* convert_image_to_DXT5_quality(
+		const unsigned char *const uncompressed,
+		int width, int height, int channels,
+		int quality,
+		int *out_size )
+{
+	unsigned char *compressed;
+	int i, j, x, y;
+	unsigned char ublock[16*4];
+	unsigned char cblock[8];
+	int index = 0, chan_step = 1;
+	int block_count = 0, has_alpha;
+	/*	error check	*/
+	*out_size = 0;
+	if( (width < 1) || (height < 1) ||
+		(NULL == uncompressed) ||
+		(channels < 1) || ( channels > 4) )
+	{
+		return NULL;
+	}
+	++DXT_conversions;
+	/*	for channels == 1 or 2, I do not step forward for R,G,B vales	*/
+	if( channels < 3 )
+	{
+		chan_step = 0;
+	}
+	/*	# channels = 1 or 3 have no alpha, 2 & 4 do have alpha	*/
+	has_alpha = 1 - (channels & 1);
+	/*	get the RAM for the compressed image
+		(16 bytes per 4x4 pixel block)	*/
+	*out_size = ((width+3) >> 2) * ((height+3) >> 2) * 16;
+	compressed = (unsigned char*)malloc( *out_size );
+	/*	go through each block	*/
+	for( j = 0; j < height; j += 4 )
+	{
+		for( i = 0; i < width; i += 4 )
+		{
+			/*	local variables, and my block counter,
+				the blocks on the edge repeat the last row / column	*/
+			int idx = 0;
+			for( y = 0; y < 4; ++y )
 			{
-				for( x = 0; x < mx; ++x )
+				int sy = j + y;
+				if( sy >= height )
 				{
-					ublock[idx++] = uncompressed[(j+y)*width*channels+(i+x)*channels];
-					ublock[idx++] = uncompressed[(j+y)*width*channels+(i+x)*channels+chan_step];
-					ublock[idx++] = uncompressed[(j+y)*width*channels+(i+x)*channels+chan_step+chan_step];
+					sy = height - 1;
 				}
-				for( x = mx; x < 4; ++x )
+				for( x = 0; x < 4; ++x )
 				{
-					ublock[idx++] = ublock[0];
-					ublock[idx++] = ublock[1];
-					ublock[idx++] = ublock[2];
+					int sx = i + x;
+					if( sx >= width )
+					{
+						sx = width - 1;
+					}
+					ublock[idx++] = uncompressed[sy*width*channels+sx*channels];
+					ublock[idx++] = uncompressed[sy*width*channels+sx*channels+chan_step];
+					ublock[idx++] = uncompressed[sy*width*channels+sx*channels+chan_step+chan_step];
+					ublock[idx++] =
+						has_alpha * uncompressed[sy*width*channels+sx*channels+channels-1]
+						+ (1-has_alpha)*255;
 				}
 			}
-			for( y = my; y < 4; ++y )
+			/*	now compress the alpha block	*/
+			compress_DDS_alpha_block( ublock, cblock );
+			/*	copy the data from the compressed alpha block into the main buffer	*/
+			for( x = 0; x < 8; ++x )
 			{
-				for( x = 0; x < 4; ++x )
-				{
-					ublock[idx++] = ublock[0];
-					ublock[idx++] = ublock[1];
-					ublock[idx++] = ublock[2];
-				}
+				compressed[index++] = cblock[x];
 			}
-			/*	compress the block	*/
+			/*	then compress the color block	*/
 			++block_count;
-			compress_DDS_color_block( 3, ublock, cblock );
-			/*	copy the data from the block into the main block	*/
+			compress_DDS_color_block_quality( 4, ublock, quality, cblock );
+			/*	copy the data from the compressed color block into the main buffer	*/
 			for( x = 0; x < 8; ++x )
 			{
 				compressed[index++] = cblock[x];
@@ -179,102 +664,390 @@ unsigned char* convert_image_to_DXT1(
 	return compressed;
 }
 
-unsigned char* convert_image_to_DXT5(
+/*	the part of a BC4 / BC5 image one job compresses	*/
+typedef struct
+{
+	const unsigned char *uncompressed;
+	int width, height, channels;
+	/*	1 for BC4, 2 for BC5	*/
+	int num_channels;
+	unsigned char *compressed;
+	/*	the number of rows of blocks in each job	*/
+	int rows_per_job;
+}
+RGTC_job;
+
+void compress_RGTC_rows( void *user_data, int job_index )
+{
+	const RGTC_job *job = (const RGTC_job*)user_data;
+	const int blocks_wide = (job->width + 3) >> 2;
+	const int blocks_high = (job->height + 3) >> 2;
+	const int block_bytes = 8 * job->num_channels;
+	unsigned char samples[16];
+	int bi, bj, c, x, y;
+	int first_row = job_index * job->rows_per_job;
+	int last_row = first_row + job->rows_per_job;
+	if( last_row > blocks_high )
+	{
+		last_row = blocks_high;
+	}
+	for( bj = first_row; bj < last_row; ++bj )
+	{
+		for( bi = 0; bi < blocks_wide; ++bi )
+		{
+			unsigned char *out = &job->compressed[(bj * blocks_wide + bi) * block_bytes];
+			for( c = 0; c < job->num_channels; ++c )
+			{
+				/*	a 1 channel image is used for both BC5 channels	*/
+				const int channel = (c < job->channels) ? c : 0;
+				/*	the blocks on the edge repeat the last row / column	*/
+				for( y = 0; y < 4; ++y )
+				{
+					int sy = bj*4 + y;
+					if( sy >= job->height )
+					{
+						sy = job->height - 1;
+					}
+					for( x = 0; x < 4; ++x )
+					{
+						int sx = bi*4 + x;
+						if( sx >= job->width )
+						{
+							sx = job->width - 1;
+						}
+						samples[y*4+x] = job->uncompressed[(sy*job->width + sx)*job->channels + channel];
+					}
+				}
+				compress_DDS_channel_block( samples, 1, 1, &out[c * 8] );
+			}
+		}
+	}
+}
+
+unsigned char* convert_image_to_RGTC(
+		const unsigned char *const uncompressed,
+		int width, int height, int channels,
+		int num_channels,
+		int *out_size )
+{
+	RGTC_job job;
+	int blocks_high, num_jobs;
+	/*	error check	*/
+	*out_size = 0;
+	if( (width < 1) || (height < 1) ||
+		(NULL == uncompressed) ||
+		(channels < 1) || (channels > 4) )
+	{
+		return NULL;
+	}
+	/*	get the RAM for the compressed image
+		(8 bytes per 4x4 pixel block per channel)	*/
+	job.uncompressed = uncompressed;
+	job.width = width;
+	job.height = height;
+	job.channels = channels;
+	job.num_channels = num_channels;
+	job.compressed = (unsigned char*)malloc(
+			((width+3) >> 2) * ((height+3) >> 2) * 8 * num_channels );
+	if( NULL == job.compressed )
+	{
+		return NULL;
+	}
+	*out_size = ((width+3) >> 2) * ((height+3) >> 2) * 8 * num_channels;
+	/*	large images are split into bands of block rows, compressed in parallel	*/
+	blocks_high = (height + 3) >> 2;
+	if( blocks_high >= 64 )
+	{
+		job.rows_per_job = 16;
+		num_jobs = (blocks_high + job.rows_per_job - 1) / job.rows_per_job;
+		image_jobs_run( compress_RGTC_rows, &job, num_jobs );
+	} else
+	{
+		job.rows_per_job = blocks_high;
+		compress_RGTC_rows( &job, 0 );
+	}
+	return job.compressed;
+}
+
+unsigned char* convert_image_to_BC4(
 		const unsigned char *const uncompressed,
 		int width, int height, int channels,
 		int *out_size )
 {
-	unsigned char *compressed;
-	int i, j, x, y;
-	unsigned char ublock[16*4];
-	unsigned char cblock[8];
-	int index = 0, chan_step = 1;
-	int block_count = 0, has_alpha;
-	/*	error check	*/
-	*out_size = 0;
-	if( (width < 1) || (height < 1) ||
-		(NULL == uncompressed) ||
-		(channels < 1) || ( channels > 4) )
+	return convert_image_to_RGTC( uncompressed, width, height, channels, 1, out_size );
+}
+
+unsigned char* convert_image_to_BC5(
+		const unsigned char *const uncompressed,
+		int width, int height, int channels,
+		int *out_size )
+{
+	return convert_image_to_RGTC( uncompressed, width, height, channels, 2, out_size );
+}
+
+/********* Helper Functions *********/
+/*	row of a level is done: it may finish a row of blocks,
+	and every second row makes a row of the next level	*/
+void DDS_stream_row_done( DDS_stream *stream, int level, int row )
+{
+	DDS_stream_level *L = &stream->levels[level];
+	const int row_bytes = L->width * stream->channels;
+	if( ((row & 3) == 3) || (row == L->height - 1) )
+	{
+		if( L->num_pending == 0 )
+		{
+			L->first_pending = row >> 2;
+		}
+		++L->num_pending;
+	}
+	if( (level + 1 < stream->num_levels) &&
+		((row & 1) || (row == L->height - 1)) &&
+		((row >> 1) < stream->levels[level+1].height) )
+	{
+		/*	the (one or two) rows to average	*/
+		const int first = row & ~1;
+		const unsigned char *source = (level == 0) ?
+				&stream->image[first * row_bytes] :
+				&L->rows[(first % L->num_rows) * row_bytes];
+		DDS_stream_level *next = &stream->levels[level+1];
+		mipmap_image_strided(
+				source, L->width, row - first + 1, stream->channels, row_bytes,
+				&next->rows[((row >> 1) % next->num_rows) * next->width * stream->channels],
+				2, 2 );
+		DDS_stream_row_done( stream, level + 1, row >> 1 );
+	}
+}
+
+void compress_DDS_stream_chunk( void *user_data, int job_index )
+{
+	const DDS_stream *stream = (const DDS_stream*)user_data;
+	const DDS_stream_chunk *chunk = &stream->chunks[job_index];
+	const DDS_stream_level *L = &stream->levels[chunk->level];
+	const int channels = stream->channels;
+	const int row_bytes = L->width * channels;
+	const int ring_row = (chunk->block_row * 4) % L->num_rows;
+	const unsigned char *rows = (chunk->level == 0) ?
+			&stream->image[chunk->block_row * 4 * row_bytes] :
+			&L->rows[ring_row * row_bytes];
+	unsigned char *compressed = &L->compressed[(ring_row >> 2) * L->row_bytes];
+	int rows_high = L->height - chunk->block_row * 4;
+	unsigned char texels[16*4];
+	int b, c, x, y;
+	if( rows_high > 4 )
+	{
+		rows_high = 4;
+	}
+	for( b = chunk->first_block; b < chunk->first_block + chunk->num_blocks; ++b )
+	{
+		unsigned char *out = &compressed[b * stream->block_bytes];
+		/*	the blocks on the edge repeat the last row / column	*/
+		for( y = 0; y < 4; ++y )
+		{
+			const unsigned char *row = &rows[((y < rows_high) ? y : rows_high - 1) * row_bytes];
+			for( x = 0; x < 4; ++x )
+			{
+				int sx = b*4 + x;
+				if( sx >= L->width )
+				{
+					sx = L->width - 1;
+				}
+				for( c = 0; c < channels; ++c )
+				{
+					texels[(y*4+x)*4+c] = row[sx*channels+c];
+				}
+			}
+		}
+		if( stream->format == DDS_STREAM_RGTC )
+		{
+			/*	a 1 channel image is used for both BC5 channels	*/
+			compress_DDS_channel_block( texels, 4, 1, out );
+			if( channels > 1 )
+			{
+				compress_DDS_channel_block( &texels[1], 4, 1, &out[8] );
+			}
+			continue;
+		}
+		/*	DXT and BC7 want RGBA, 1 or 2 channels are luminance (alpha)	*/
+		for( x = 0; x < 16*4; x += 4 )
+		{
+			texels[x+3] = (channels & 1) ? 255 : texels[x+channels-1];
+			if( channels < 3 )
+			{
+				texels[x+1] = texels[x+2] = texels[x];
+			}
+		}
+		if( stream->format == DDS_STREAM_BC7 )
+		{
+			compress_BC7_block( texels,
+					(stream->quality >= DXT_QUALITY_HIGH) ? BC7_PRESET_SLOW : BC7_PRESET_FAST,
+					out );
+		} else
+		if( channels & 1 )
+		{
+			compress_DDS_color_block_quality( 4, texels, stream->quality, out );
+		} else
+		{
+			compress_DDS_alpha_block( texels, out );
+			compress_DDS_color_block_quality( 4, texels, stream->quality, &out[8] );
+		}
+	}
+}
+
+/*	compresses the finished rows of blocks on all the cores, writing
+	each run of blocks as soon as it is done while the rest are still
+	being compressed	*/
+int write_DDS_stream_pending( DDS_stream *stream, FILE *fout, long *file_position )
+{
+	image_job_batch *batch;
+	int i, r, b, result = 1;
+	stream->num_chunks = 0;
+	for( i = 0; i < stream->num_levels; ++i )
+	{
+		const DDS_stream_level *L = &stream->levels[i];
+		const int blocks_wide = (L->width + 3) >> 2;
+		for( r = L->first_pending; r < L->first_pending + L->num_pending; ++r )
+		{
+			for( b = 0; b < blocks_wide; b += DDS_STREAM_CHUNK_BLOCKS )
+			{
+				DDS_stream_chunk *chunk = &stream->chunks[stream->num_chunks++];
+				chunk->level = i;
+				chunk->block_row = r;
+				chunk->first_block = b;
+				chunk->num_blocks = blocks_wide - b;
+				if( chunk->num_blocks > DDS_STREAM_CHUNK_BLOCKS )
+				{
+					chunk->num_blocks = DDS_STREAM_CHUNK_BLOCKS;
+				}
+			}
+		}
+	}
+	/*	with a single core there is nothing to overlap the writes with
+		(the OS writes its cache back on its own), so skip the threads	*/
+	batch = NULL;
+	if( image_jobs_num_cores() > 1 )
+	{
+		batch = image_jobs_start( compress_DDS_stream_chunk, stream, stream->num_chunks, 0 );
+	}
+	for( i = 0; i < stream->num_chunks; ++i )
+	{
+		const DDS_stream_chunk *chunk = &stream->chunks[i];
+		const DDS_stream_level *L = &stream->levels[chunk->level];
+		const int ring_row = (chunk->block_row * 4) % L->num_rows;
+		const long offset = L->file_offset + (long)chunk->block_row * L->row_bytes
+				+ chunk->first_block * stream->block_bytes;
+		const int size = chunk->num_blocks * stream->block_bytes;
+		if( NULL == batch )
+		{
+			/*	no threads, do it right here	*/
+			compress_DDS_stream_chunk( stream, i );
+		} else
+		{
+			image_jobs_wait( batch, i );
+		}
+		/*	the levels are interleaved in time, not in the file,
+			so the smaller ones need a seek	*/
+		if( result && (offset != *file_position) &&
+			(fseek( fout, offset, SEEK_SET ) != 0) )
+		{
+			result = 0;
+		}
+		if( result &&
+			(fwrite( &L->compressed[(ring_row >> 2) * L->row_bytes + chunk->first_block * stream->block_bytes],
+					1, size, fout ) != (size_t)size) )
+		{
+			result = 0;
+		}
+		*file_position = offset + size;
+	}
+	if( NULL != batch )
+	{
+		image_jobs_finish( batch );
+	}
+	for( i = 0; i < stream->num_levels; ++i )
+	{
+		stream->levels[i].num_pending = 0;
+	}
+	return result;
+}
+
+int write_DDS_file(
+		const char *filename,
+		int width, int height,
+		unsigned int fourCC,
+		unsigned int DXGI_format,
+		const unsigned char *const DDS_data,
+		int DDS_size )
+{
+	FILE *fout;
+	int result;
+	if( NULL == DDS_data )
+	{
+		return 0;
+	}
+	/*	write it out	*/
+	fout = fopen( filename, "wb");
+	if( NULL == fout )
+	{
+		return 0;
+	}
+	result = write_DDS_header( fout, width, height, 1, fourCC, DXGI_format, DDS_size );
+	if( result && (fwrite( DDS_data, 1, DDS_size, fout ) != (size_t)DDS_size) )
+	{
+		result = 0;
+	}
+	if( fclose( fout ) != 0 )
+	{
+		result = 0;
+	}
+	return result;
+}
+
+int write_DDS_header(
+		FILE *fout,
+		int width, int height, int mipmaps,
+		unsigned int fourCC,
+		unsigned int DXGI_format,
+		int main_size )
+{
+	DDS_header header;
+	DDS_header_DX10 header_DX10;
+	memset( &header, 0, sizeof( DDS_header ) );
+	header.dwMagic = ('D' << 0) | ('D' << 8) | ('S' << 16) | (' ' << 24);
+	header.dwSize = 124;
+	header.dwFlags = DDSD_CAPS | DDSD_HEIGHT | DDSD_WIDTH | DDSD_PIXELFORMAT | DDSD_LINEARSIZE;
+	header.dwWidth = width;
+	header.dwHeight = height;
+	header.dwPitchOrLinearSize = main_size;
+	header.sPixelFormat.dwSize = 32;
+	header.sPixelFormat.dwFlags = DDPF_FOURCC;
+	header.sPixelFormat.dwFourCC = fourCC;
+	header.sCaps.dwCaps1 = DDSCAPS_TEXTURE;
+	if( mipmaps > 1 )
 	{
-		return NULL;
+		header.dwFlags |= DDSD_MIPMAPCOUNT;
+		header.dwMipMapCount = mipmaps;
+		header.sCaps.dwCaps1 |= DDSCAPS_COMPLEX | DDSCAPS_MIPMAP;
 	}
-	/*	for channels == 1 or 2, I do not step forward for R,G,B vales	*/
-	if( channels < 3 )
+	memset( &header_DX10, 0, sizeof( DDS_header_DX10 ) );
+	if( DXGI_format )
 	{
-		chan_step = 0;
+		header.sPixelFormat.dwFourCC = ('D' << 0) | ('X' << 8) | ('1' << 16) | ('0' << 24);
+		header_DX10.dxgiFormat = DXGI_format;
+		header_DX10.resourceDimension = DDS_DIMENSION_TEXTURE2D;
+		header_DX10.arraySize = 1;
 	}
-	/*	# channels = 1 or 3 have no alpha, 2 & 4 do have alpha	*/
-	has_alpha = 1 - (channels & 1);
-	/*	get the RAM for the compressed image
-		(16 bytes per 4x4 pixel block)	*/
-	*out_size = ((width+3) >> 2) * ((height+3) >> 2) * 16;
-	compressed = (unsigned char*)malloc( *out_size );
-	/*	go through each block	*/
-	for( j = 0; j < height; j += 4 )
+	if( fwrite( &header, sizeof( DDS_header ), 1, fout ) != 1 )
 	{
-		for( i = 0; i < width; i += 4 )
-		{
-			/*	local variables, and my block counter	*/
-			int idx = 0;
-			int mx = 4, my = 4;
-			if( j+4 >= height )
-			{
-				my = height - j;
-			}
-			if( i+4 >= width )
-			{
-				mx = width - i;
-			}
-			for( y = 0; y < my; ++y )
-			{
-				for( x = 0; x < mx; ++x )
-				{
-					ublock[idx++] = uncompressed[(j+y)*width*channels+(i+x)*channels];
-					ublock[idx++] = uncompressed[(j+y)*width*channels+(i+x)*channels+chan_step];
-					ublock[idx++] = uncompressed[(j+y)*width*channels+(i+x)*channels+chan_step+chan_step];
-					ublock[idx++] =
-						has_alpha * uncompressed[(j+y)*width*channels+(i+x)*channels+channels-1]
-						+ (1-has_alpha)*255;
-				}
-				for( x = mx; x < 4; ++x )
-				{
-					ublock[idx++] = ublock[0];
-					ublock[idx++] = ublock[1];
-					ublock[idx++] = ublock[2];
-					ublock[idx++] = ublock[3];
-				}
-			}
-			for( y = my; y < 4; ++y )
-			{
-				for( x = 0; x < 4; ++x )
-				{
-					ublock[idx++] = ublock[0];
-					ublock[idx++] = ublock[1];
-					ublock[idx++] = ublock[2];
-					ublock[idx++] = ublock[3];
-				}
-			}
-			/*	now compress the alpha block	*/
-			compress_DDS_alpha_block( ublock, cblock );
-			/*	copy the data from the compressed alpha block into the main buffer	*/
-			for( x = 0; x < 8; ++x )
-			{
-				compressed[index++] = cblock[x];
-			}
-			/*	then compress the color block	*/
-			++block_count;
-			compress_DDS_color_block( 4, ublock, cblock );
-			/*	copy the data from the compressed color block into the main buffer	*/
-			for( x = 0; x < 8; ++x )
-			{
-				compressed[index++] = cblock[x];
-			}
-		}
+		return 0;
 	}
-	return compressed;
+	if( DXGI_format &&
+		(fwrite( &header_DX10, sizeof( DDS_header_DX10 ), 1, fout ) != 1) )
+	{
+		return 0;
+	}
+	return 1;
 }
 
-/********* Helper Functions *********/
 int convert_bit_range( int c, int from_bits, int to_bits )
 {
 	int b = (1 << (from_bits - 1)) + c * ((1 << to_bits) - 1);
@@ -504,18 +1277,30 @@ void
 		const unsigned char *const uncompressed,
 		unsigned char compressed[8]
 	)
+{
+	/*	get the master colors	*/
+	int enc_c0, enc_c1;
+	LSE_master_colors_max_min( &enc_c0, &enc_c1, channels, uncompressed );
+	encode_DDS_color_block( channels, uncompressed, enc_c0, enc_c1, compressed );
+}
+
+void
+	encode_DDS_color_block
+	(
+		int channels,
+		const unsigned char *const uncompressed,
+		int enc_c0, int enc_c1,
+		unsigned char compressed[8]
+	)
 {
 	/*	variables	*/
 	int i;
 	int next_bit;
-	int enc_c0, enc_c1;
 	int c0[4], c1[4];
 	float color_line[] = { 0.0f, 0.0f, 0.0f, 0.0f };
 	float vec_len2 = 0.0f, dot_offset = 0.0f;
 	/*	stupid order	*/
 	int swizzle4[] = { 0, 2, 3, 1 };
-	/*	get the master colors	*/
-	LSE_master_colors_max_min( &enc_c0, &enc_c1, channels, uncompressed );
 	/*	store the 565 color 0 and color 1	*/
 	compressed[0] = (enc_c0 >> 0) & 255;
 	compressed[1] = (enc_c0 >> 8) & 255;
@@ -574,12 +1359,389 @@ void
 	/*	done compressing to DXT1	*/
 }
 
+/*	the 4 colors a DXT block with these end points can show (c0 > c1)	*/
+void DXT_block_palette( int enc_c0, int enc_c1, int palette[4][3] )
+{
+	int i;
+	rgb_888_from_565( enc_c0, &palette[0][0], &palette[0][1], &palette[0][2] );
+	rgb_888_from_565( enc_c1, &palette[1][0], &palette[1][1], &palette[1][2] );
+	for( i = 0; i < 3; ++i )
+	{
+		palette[2][i] = (2*palette[0][i] + palette[1][i]) / 3;
+		palette[3][i] = (palette[0][i] + 2*palette[1][i]) / 3;
+	}
+}
+
+/*	encodes a block with the closest of the 4 colors for every texel
+	\return the squared error	*/
+int encode_DDS_color_block_nearest(
+		int channels,
+		const unsigned char *const uncompressed,
+		int enc_c0, int enc_c1,
+		unsigned char compressed[8],
+		unsigned char indices[16] )
+{
+	int palette[4][3];
+	int i, k, error = 0;
+	if( enc_c0 < enc_c1 )
+	{
+		/*	c0 > c1 picks the 4 color mode	*/
+		int t = enc_c0;
+		enc_c0 = enc_c1;
+		enc_c1 = t;
+	}
+	compressed[0] = (enc_c0 >> 0) & 255;
+	compressed[1] = (enc_c0 >> 8) & 255;
+	compressed[2] = (enc_c1 >> 0) & 255;
+	compressed[3] = (enc_c1 >> 8) & 255;
+	compressed[4] = 0;
+	compressed[5] = 0;
+	compressed[6] = 0;
+	compressed[7] = 0;
+	DXT_block_palette( enc_c0, enc_c1, palette );
+	for( i = 0; i < 16; ++i )
+	{
+		int best = 0, best_error = 0x7FFFFFFF;
+		/*	(with c0 == c1 it's the 3 color mode, only use c0 then)	*/
+		int num_colors = (enc_c0 == enc_c1) ? 1 : 4;
+		for( k = 0; k < num_colors; ++k )
+		{
+			int dr = uncompressed[i*channels+0] - palette[k][0];
+			int dg = uncompressed[i*channels+1] - palette[k][1];
+			int db = uncompressed[i*channels+2] - palette[k][2];
+			int e = dr*dr + dg*dg + db*db;
+			if( e < best_error )
+			{
+				best_error = e;
+				best = k;
+			}
+		}
+		error += best_error;
+		indices[i] = best;
+		compressed[4 + (i >> 2)] |= best << ((i & 3) * 2);
+	}
+	return error;
+}
+
+/*	the fastest: the end points are the corners of the bounding box,
+	everything in integers	*/
+void compress_DDS_color_block_range_fit(
+		int channels,
+		const unsigned char *const uncompressed,
+		unsigned char compressed[8] )
+{
+	/*	stupid order	*/
+	static const int swizzle4[] = { 0, 2, 3, 1 };
+	int cmin[3], cmax[3], sum[3] = { 0, 0, 0 }, c0[3], c1[3], dir[3];
+	int sum_rg = 0, sum_bg = 0;
+	int i, k, enc_c0, enc_c1, len2;
+	for( k = 0; k < 3; ++k )
+	{
+		cmin[k] = cmax[k] = uncompressed[k];
+	}
+	for( i = 0; i < 16; ++i )
+	{
+		/*	(no branches, they would be hard to predict)	*/
+		const int r = uncompressed[i*channels+0];
+		const int g = uncompressed[i*channels+1];
+		const int b = uncompressed[i*channels+2];
+		cmin[0] = (r < cmin[0]) ? r : cmin[0];
+		cmin[1] = (g < cmin[1]) ? g : cmin[1];
+		cmin[2] = (b < cmin[2]) ? b : cmin[2];
+		cmax[0] = (r > cmax[0]) ? r : cmax[0];
+		cmax[1] = (g > cmax[1]) ? g : cmax[1];
+		cmax[2] = (b > cmax[2]) ? b : cmax[2];
+		sum[0] += r;
+		sum[1] += g;
+		sum[2] += b;
+		sum_rg += r * g;
+		sum_bg += b * g;
+	}
+	/*	which diagonal of the box?  (green is the reference)	*/
+	if( 16*sum_rg < sum[0]*sum[1] )
+	{
+		int t = cmin[0];
+		cmin[0] = cmax[0];
+		cmax[0] = t;
+	}
+	if( 16*sum_bg < sum[2]*sum[1] )
+	{
+		int t = cmin[2];
+		cmin[2] = cmax[2];
+		cmax[2] = t;
+	}
+	/*	pull the corners in a bit, the ends are rarely hit exactly	*/
+	for( k = 0; k < 3; ++k )
+	{
+		int inset = (cmax[k] - cmin[k]) / 16;
+		cmax[k] -= inset;
+		cmin[k] += inset;
+	}
+	enc_c0 = rgb_to_565( cmax[0], cmax[1], cmax[2] );
+	enc_c1 = rgb_to_565( cmin[0], cmin[1], cmin[2] );
+	if( enc_c0 < enc_c1 )
+	{
+		int t = enc_c0;
+		enc_c0 = enc_c1;
+		enc_c1 = t;
+	}
+	compressed[0] = (enc_c0 >> 0) & 255;
+	compressed[1] = (enc_c0 >> 8) & 255;
+	compressed[2] = (enc_c1 >> 0) & 255;
+	compressed[3] = (enc_c1 >> 8) & 255;
+	compressed[4] = 0;
+	compressed[5] = 0;
+	compressed[6] = 0;
+	compressed[7] = 0;
+	/*	place each texel on the line, index = round( 3 * t / len2 )	*/
+	rgb_888_from_565( enc_c0, &c0[0], &c0[1], &c0[2] );
+	rgb_888_from_565( enc_c1, &c1[0], &c1[1], &c1[2] );
+	len2 = 0;
+	for( k = 0; k < 3; ++k )
+	{
+		dir[k] = c1[k] - c0[k];
+		len2 += dir[k] * dir[k];
+	}
+	for( i = 0; i < 16; ++i )
+	{
+		const unsigned char *c = &uncompressed[i*channels];
+		int t = 6 * ((c[0] - c0[0]) * dir[0] + (c[1] - c0[1]) * dir[1] + (c[2] - c0[2]) * dir[2]);
+		int index = (t > len2) + (t > 3*len2) + (t > 5*len2);
+		compressed[4 + (i >> 2)] |= swizzle4[index] << ((i & 3) * 2);
+	}
+}
+
+/*	quantizes a least squares end point to 565	*/
+int DXT_quantize_end_point( const float c[3] )
+{
+	int k, q[3];
+	for( k = 0; k < 3; ++k )
+	{
+		q[k] = (int)(c[k] + 0.5f);
+		if( q[k] < 0 )
+		{
+			q[k] = 0;
+		} else if( q[k] > 255 )
+		{
+			q[k] = 255;
+		}
+	}
+	return rgb_to_565( q[0], q[1], q[2] );
+}
+
+/*	the best end points for texels with the given weights (of c0)	*/
+int DXT_least_squares_end_points(
+		int channels,
+		const unsigned char *const uncompressed,
+		const float weights[16],
+		int *enc_c0, int *enc_c1 )
+{
+	float A = 0.0f, B = 0.0f, C = 0.0f;
+	float X[3] = { 0.0f, 0.0f, 0.0f }, Y[3] = { 0.0f, 0.0f, 0.0f };
+	float a[3], b[3], det;
+	int i, k;
+	for( i = 0; i < 16; ++i )
+	{
+		float alpha = weights[i], beta = 1.0f - weights[i];
+		A += alpha * alpha;
+		B += beta * beta;
+		C += alpha * beta;
+		for( k = 0; k < 3; ++k )
+		{
+			X[k] += alpha * uncompressed[i*channels+k];
+			Y[k] += beta * uncompressed[i*channels+k];
+		}
+	}
+	det = A*B - C*C;
+	if( fabs( det ) < 1e-6f )
+	{
+		return 0;
+	}
+	det = 1.0f / det;
+	for( k = 0; k < 3; ++k )
+	{
+		a[k] = (B*X[k] - C*Y[k]) * det;
+		b[k] = (A*Y[k] - C*X[k]) * det;
+	}
+	*enc_c0 = DXT_quantize_end_point( a );
+	*enc_c1 = DXT_quantize_end_point( b );
+	return 1;
+}
+
+/*	the best: try every ordered split of the texels into the 4 colors	*/
+void compress_DDS_color_block_cluster_fit(
+		int channels,
+		const unsigned char *const uncompressed,
+		unsigned char compressed[8] )
+{
+	/*	how much of c0 is in each of the 4 colors, in order along the line	*/
+	static const float cluster_weight[4] = { 1.0f, 2.0f / 3.0f, 1.0f / 3.0f, 0.0f };
+	/*	the same for the DXT indices	*/
+	static const float index_weight[4] = { 1.0f, 0.0f, 2.0f / 3.0f, 1.0f / 3.0f };
+	float point[3], direction[3], projection[16];
+	float third[17][3], T[3], TT;
+	unsigned char order[16], indices[16], trial[8];
+	int i, j, k, m, c, best_error, enc_c0, enc_c1;
+	int best_i = 0, best_j = 0, best_k = 0;
+	float best_fit = 0.0f, best_det = 0.0f;
+	/*	start with what the default quality does	*/
+	LSE_master_colors_max_min( &enc_c0, &enc_c1, channels, uncompressed );
+	best_error = encode_DDS_color_block_nearest(
+			channels, uncompressed, enc_c0, enc_c1, compressed, indices );
+	if( best_error == 0 )
+	{
+		return;
+	}
+	/*	sort the texels along the main axis	*/
+	compute_color_line_STDEV( uncompressed, channels, point, direction );
+	for( i = 0; i < 16; ++i )
+	{
+		order[i] = i;
+		projection[i] =
+			direction[0] * uncompressed[i*channels+0] +
+			direction[1] * uncompressed[i*channels+1] +
+			direction[2] * uncompressed[i*channels+2];
+	}
+	for( i = 1; i < 16; ++i )
+	{
+		unsigned char t = order[i];
+		for( j = i; (j > 0) && (projection[order[j-1]] < projection[t]); --j )
+		{
+			order[j] = order[j-1];
+		}
+		order[j] = t;
+	}
+	/*	a third of the running sums, and the total	*/
+	third[0][0] = third[0][1] = third[0][2] = 0.0f;
+	for( i = 0; i < 16; ++i )
+	{
+		for( c = 0; c < 3; ++c )
+		{
+			third[i+1][c] = third[i][c] + uncompressed[order[i]*channels+c] * (1.0f / 3.0f);
+		}
+	}
+	for( c = 0; c < 3; ++c )
+	{
+		T[c] = 3.0f * third[16][c];
+	}
+	TT = T[0]*T[0] + T[1]*T[1] + T[2]*T[2];
+	/*	clusters [0,i) [i,j) [j,k) [k,16), least squares error for each split:
+		the end points a, b minimize sum |alpha a + beta b - texel|^2, with
+		A = sum alpha^2, B = sum beta^2, C = sum alpha beta,
+		X = sum alpha texel and Y = sum beta texel, which leaves (the constant
+		sum of the squared texels) less (B X.X - 2 C X.Y + A Y.Y) / (A B - C^2).
+		For these weights X works out to (P_i + P_j + P_k) / 3 of the running
+		sums P, Y = T - X and A + B + 2 C = 16, so it's cheap to try them all	*/
+	for( i = 0; i <= 16; ++i )
+	{
+		for( j = i; j <= 16; ++j )
+		{
+			float Xij[3];
+			for( c = 0; c < 3; ++c )
+			{
+				Xij[c] = third[i][c] + third[j][c];
+			}
+			for( k = j; k <= 16; ++k )
+			{
+				const float n1 = (float)(j - i), n2 = (float)(k - j);
+				const float A = (float)i + (4.0f/9.0f) * n1 + (1.0f/9.0f) * n2;
+				const float B = (float)(16 - k) + (1.0f/9.0f) * n1 + (4.0f/9.0f) * n2;
+				const float C = (2.0f/9.0f) * (n1 + n2);
+				const float det = A*B - C*C;
+				const float X0 = Xij[0] + third[k][0];
+				const float X1 = Xij[1] + third[k][1];
+				const float X2 = Xij[2] + third[k][2];
+				const float XX = X0*X0 + X1*X1 + X2*X2;
+				const float XT = X0*T[0] + X1*T[1] + X2*T[2];
+				float fit;
+				if( det < 1e-6f )
+				{
+					continue;
+				}
+				/*	is fit / det better than best_fit / best_det? (no divide)	*/
+				fit = 16.0f*XX - 2.0f*(A + C)*XT + A*TT;
+				if( (best_det == 0.0f) || (fit * best_det > best_fit * det) )
+				{
+					best_fit = fit;
+					best_det = det;
+					best_i = i;
+					best_j = j;
+					best_k = k;
+				}
+			}
+		}
+	}
+	/*	quantize the best split, then refine: re-fit to the indices actually chosen	*/
+	if( best_det > 0.0f )
+	{
+		float weights[16];
+		for( m = 0; m < 16; ++m )
+		{
+			weights[order[m]] = cluster_weight[
+					(m < best_i) ? 0 : ((m < best_j) ? 1 : ((m < best_k) ? 2 : 3))];
+		}
+		for( m = 0; m < 3; ++m )
+		{
+			int error;
+			if( !DXT_least_squares_end_points( channels, uncompressed, weights, &enc_c0, &enc_c1 ) )
+			{
+				break;
+			}
+			error = encode_DDS_color_block_nearest(
+					channels, uncompressed, enc_c0, enc_c1, trial, indices );
+			if( error >= best_error )
+			{
+				break;
+			}
+			best_error = error;
+			memcpy( compressed, trial, 8 );
+			for( i = 0; i < 16; ++i )
+			{
+				weights[i] = index_weight[indices[i]];
+			}
+		}
+	}
+}
+
+void
+	compress_DDS_color_block_quality
+	(
+		int channels,
+		const unsigned char *const uncompressed,
+		int quality,
+		unsigned char compressed[8]
+	)
+{
+	if( quality <= DXT_QUALITY_FAST )
+	{
+		compress_DDS_color_block_range_fit( channels, uncompressed, compressed );
+	} else if( quality >= DXT_QUALITY_HIGH )
+	{
+		compress_DDS_color_block_cluster_fit( channels, uncompressed, compressed );
+	} else
+	{
+		compress_DDS_color_block( channels, uncompressed, compressed );
+	}
+}
+
 void
 	compress_DDS_alpha_block
 	(
 		const unsigned char *const uncompressed,
 		unsigned char compressed[8]
 	)
+{
+	/*	the alpha is every 4th byte	*/
+	compress_DDS_channel_block( uncompressed + 3, 4, 0, compressed );
+}
+
+void
+	compress_DDS_channel_block
+	(
+		const unsigned char *const uncompressed,
+		int stride, int round_to_nearest,
+		unsigned char compressed[8]
+	)
 {
 	/*	variables	*/
 	int i;
@@ -588,9 +1750,9 @@ void
 	float scale_me;
 	/*	stupid order	*/
 	int swizzle8[] = { 1, 7, 6, 5, 4, 3, 2, 0 };
-	/*	get the alpha limits (a0 > a1)	*/
-	a0 = a1 = uncompressed[3];
-	for( i = 4+3; i < 16*4; i += 4 )
+	/*	get the limits (a0 > a1)	*/
+	a0 = a1 = uncompressed[0];
+	for( i = stride; i < 16*stride; i += stride )
 	{
 		if( uncompressed[i] > a0 )
 		{
@@ -610,14 +1772,31 @@ void
 	compressed[5] = 0;
 	compressed[6] = 0;
 	compressed[7] = 0;
-	/*	store the all of the alpha values	*/
+	/*	store the all of the values	*/
 	next_bit = 8*2;
-	scale_me = 7.9999f / (a0 - a1);
-	for( i = 3; i < 16*4; i += 4 )
+	if( a0 == a1 )
+	{
+		/*	a flat block, every value is a1 (and no dividing by 0)	*/
+		scale_me = 0.0f;
+	} else if( round_to_nearest )
 	{
-		/*	convert this alpha value to a 3 bit number	*/
+		scale_me = 7.0f / (a0 - a1);
+	} else
+	{
+		scale_me = 7.9999f / (a0 - a1);
+	}
+	for( i = 0; i < 16*stride; i += stride )
+	{
+		/*	convert this value to a 3 bit number	*/
 		int svalue;
-		int value = (int)((uncompressed[i] - a1) * scale_me);
+		int value;
+		if( round_to_nearest )
+		{
+			value = (int)((uncompressed[i] - a1) * scale_me + 0.5f);
+		} else
+		{
+			value = (int)((uncompressed[i] - a1) * scale_me);
+		}
 		svalue = swizzle8[ value&7 ];
 		/*	OK, store this value, start with the 1st byte	*/
 		compressed[next_bit >> 3] |= svalue << (next_bit & 7);
@@ -628,5 +1807,5 @@ void
 		}
 		next_bit += 3;
 	}
-	/*	done compressing to DXT1	*/
+	/*	done compressing the channel	*/
 }
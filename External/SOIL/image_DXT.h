@@ -10,6 +10,24 @@
 #ifndef HEADER_IMAGE_DXT
 #define HEADER_IMAGE_DXT
 
+#include <stdio.h>
+
+/**
+	How hard the DXT color compression tries.
+	DXT_QUALITY_FAST: the bounding box of the colors gives the end
+		points, for compressing while loading
+	DXT_QUALITY_DEFAULT: the end points are fit along the main axis
+		of the colors
+	DXT_QUALITY_HIGH: the best ordered split of the colors into 4
+		clusters (cluster fit), then refined, for offline compression
+**/
+enum
+{
+	DXT_QUALITY_FAST = 0,
+	DXT_QUALITY_DEFAULT = 1,
+	DXT_QUALITY_HIGH = 2
+};
+
 /**
 	Converts an image from an array of unsigned chars (RGB or RGBA) to
 	DXT1 or DXT5, then saves the converted image to disk.
@@ -45,6 +63,188 @@ convert_image_to_DXT5
     int *out_size
 );
 
+/**
+	take an image and convert it to DXT1 (no alpha) at the given DXT_QUALITY_*
+**/
+unsigned char*
+convert_image_to_DXT1_quality
+(
+    const unsigned char *const uncompressed,
+    int width, int height, int channels,
+    int quality,
+    int *out_size
+);
+
+/**
+	take an image and convert it to DXT5 (with alpha) at the given DXT_QUALITY_*
+**/
+unsigned char*
+convert_image_to_DXT5_quality
+(
+    const unsigned char *const uncompressed,
+    int width, int height, int channels,
+    int quality,
+    int *out_size
+);
+
+/**
+	\return how many images convert_image_to_DXT1 / DXT5 (at any
+	quality) have compressed so far, for the tests.  Not synchronized:
+	only exact while one thread at a time compresses.
+**/
+unsigned long
+num_DXT_conversions
+(
+    void
+);
+
+/**
+	Same as save_image_as_DDS, at the given DXT_QUALITY_*.
+	\return 0 if failed, otherwise returns 1
+**/
+int
+save_image_as_DDS_quality
+(
+    const char *filename,
+    int width, int height, int channels,
+    const unsigned char *const data,
+    int quality
+);
+
+/**
+	Converts an image from an array of unsigned chars to BC4 (1
+	channel) or BC5 (2 or more channels, the first two are used),
+	then saves the converted image to disk.  BC5 keeps the X and Y
+	of tangent space normal maps far better than DXT5 does.
+	\return 0 if failed, otherwise returns 1
+**/
+int
+save_image_as_DDS_RGTC
+(
+    const char *filename,
+    int width, int height, int channels,
+    const unsigned char *const data
+);
+
+/**
+	take an image and convert its first channel to BC4 (ATI1, RGTC1)
+**/
+unsigned char*
+convert_image_to_BC4
+(
+    const unsigned char *const uncompressed,
+    int width, int height, int channels,
+    int *out_size
+);
+
+/**
+	take an image and convert its first two channels to BC5 (ATI2, RGTC2)
+	(a 1 channel image is used for both)
+**/
+unsigned char*
+convert_image_to_BC5
+(
+    const unsigned char *const uncompressed,
+    int width, int height, int channels,
+    int *out_size
+);
+
+/**
+	Converts an image from an array of unsigned chars to BC7 (see
+	image_BC7.h) with one of the BC7_PRESET_*, then saves it to disk
+	as a DDS with the DX10 header.  Far better than DXT5 for alpha.
+	\return 0 if failed, otherwise returns 1
+**/
+int
+save_image_as_DDS_BC7
+(
+    const char *filename,
+    int width, int height, int channels,
+    const unsigned char *const data,
+    int preset
+);
+
+/**
+	The compressed formats of save_image_as_DDS_mipmapped.
+	DDS_STREAM_DXT: DXT1 (1 or 3 channels) or DXT5 (2 or 4 channels)
+	DDS_STREAM_RGTC: BC4 (1 channel) or BC5 (the first 2 channels)
+	DDS_STREAM_BC7: BC7, in a DDS with the DX10 header
+**/
+enum
+{
+	DDS_STREAM_DXT = 0,
+	DDS_STREAM_RGTC = 1,
+	DDS_STREAM_BC7 = 2
+};
+
+/**
+	Compresses an image and its whole MIPmap chain (2x2 box filtered,
+	down to 1x1), then saves them to disk.  The levels are built and
+	compressed a row of blocks at a time and streamed into the file, so
+	only about one row of blocks per level is ever held in RAM, and each
+	run of blocks is written while the next ones are being compressed.
+	\param format one of the DDS_STREAM_*
+	\param quality one of the DXT_QUALITY_* (for BC7, DXT_QUALITY_HIGH
+		picks the slow preset, anything else the fast one)
+	\return 0 if failed (including if the file can't be written), otherwise returns 1
+**/
+int
+save_image_as_DDS_mipmapped
+(
+    const char *filename,
+    int width, int height, int channels,
+    const unsigned char *const data,
+    int format,
+    int quality
+);
+
+/**
+	\return the number of levels in a full MIPmap chain, down to 1x1
+**/
+int
+count_mipmap_levels
+(
+    int width, int height
+);
+
+/**
+	\return the bytes in one 4x4 block of a DDS_STREAM_* format
+	(DXT and RGTC depend on the channels), 0 if it is not one
+**/
+int
+compressed_block_size
+(
+    int format, int channels
+);
+
+/**
+	\return the bytes in one width x height level of a DDS_STREAM_* format
+**/
+int
+compressed_level_size
+(
+    int format, int channels,
+    int width, int height
+);
+
+/**
+	The heart of save_image_as_DDS_mipmapped, for other containers:
+	compresses the first num_levels levels of the MIPmap chain into an
+	open file, level i going to level_offsets[i] (in any order).
+	\return 0 if failed, otherwise returns 1
+**/
+int
+write_compressed_mipmaps
+(
+    FILE *fout,
+    int width, int height, int channels,
+    const unsigned char *const data,
+    int format,
+    int quality,
+    int num_levels,
+    const long *level_offsets
+);
+
 /**	A bunch of DirectDraw Surface structures and flags **/
 typedef struct
 {
@@ -85,6 +285,28 @@ typedef struct
 }
 DDS_header ;
 
+/**	follows the DDS header when the four CC is "DX10"	**/
+typedef struct
+{
+    unsigned int    dxgiFormat;
+    unsigned int    resourceDimension;
+    unsigned int    miscFlag;
+    unsigned int    arraySize;
+    unsigned int    miscFlags2;
+}
+DDS_header_DX10 ;
+
+/*	the DXGI formats and dimensions SOIL knows in a DX10 header	*/
+#define DDS_DXGI_FORMAT_BC1_UNORM	71
+#define DDS_DXGI_FORMAT_BC2_UNORM	74
+#define DDS_DXGI_FORMAT_BC3_UNORM	77
+#define DDS_DXGI_FORMAT_BC4_UNORM	80
+#define DDS_DXGI_FORMAT_BC5_UNORM	83
+#define DDS_DXGI_FORMAT_BC7_UNORM	98
+#define DDS_DXGI_FORMAT_BC7_UNORM_SRGB	99
+#define DDS_DIMENSION_TEXTURE2D	3
+#define DDS_DIMENSION_TEXTURE3D	4
+
 /*	the following constants were copied directly off the MSDN website	*/
 
 /*	The dwFlags member of the original DDSURFACEDESC2 structure
@@ -0,0 +1,256 @@
+/*
+	KTX2 container
+
+	The layout of a KTX2 file: the header and its index, the level
+	index, the data format descriptor (DFD), the key / value data,
+	then the levels themselves, smallest first.
+
+	Public Domain
+*/
+
+#include "image_KTX2.h"
+#include "image_DXT.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const unsigned char KTX2_identifier[12] =
+{
+	0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n'
+};
+
+/*	the fixed part of the header and its index, then the index of each level	*/
+#define KTX2_HEADER_SIZE	80
+#define KTX2_LEVEL_INDEX_SIZE	24
+
+/*	the Khronos data format descriptor values SOIL writes	*/
+#define KHR_DF_MODEL_BC1A	128
+#define KHR_DF_MODEL_BC3	130
+#define KHR_DF_MODEL_BC4	131
+#define KHR_DF_MODEL_BC5	132
+#define KHR_DF_MODEL_BC7	134
+#define KHR_DF_PRIMARIES_BT709	1
+#define KHR_DF_TRANSFER_LINEAR	1
+#define KHR_DF_CHANNEL_COLOR	0
+#define KHR_DF_CHANNEL_GREEN	1
+#define KHR_DF_CHANNEL_ALPHA	15
+/*	the largest DFD SOIL writes has 2 samples	*/
+#define KTX2_DFD_MAX_SIZE	(4 + 24 + 2*16)
+
+/*	the KTX2 files SOIL writes say who wrote them	*/
+static const char KTX2_writer[] = "KTXwriter\0SOIL";
+#define KTX2_WRITER_SIZE	(sizeof( KTX2_writer ))
+
+static unsigned int read_u32( const unsigned char *p )
+{
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned int)p[3] << 24);
+}
+
+static void put_u32( unsigned char *p, unsigned int value )
+{
+	p[0] = (unsigned char)(value);
+	p[1] = (unsigned char)(value >> 8);
+	p[2] = (unsigned char)(value >> 16);
+	p[3] = (unsigned char)(value >> 24);
+}
+
+int
+	read_KTX2_header
+	(
+		const unsigned char *const buffer,
+		int buffer_length,
+		KTX2_header *header
+	)
+{
+	unsigned int i;
+	if( (NULL == buffer) || (NULL == header) ||
+		(buffer_length < KTX2_HEADER_SIZE) ||
+		(0 != memcmp( buffer, KTX2_identifier, sizeof( KTX2_identifier ) )) )
+	{
+		return 0;
+	}
+	memset( header, 0, sizeof( KTX2_header ) );
+	header->vkFormat = read_u32( &buffer[12] );
+	header->typeSize = read_u32( &buffer[16] );
+	header->pixelWidth = read_u32( &buffer[20] );
+	header->pixelHeight = read_u32( &buffer[24] );
+	header->pixelDepth = read_u32( &buffer[28] );
+	header->layerCount = read_u32( &buffer[32] );
+	header->faceCount = read_u32( &buffer[36] );
+	header->levelCount = read_u32( &buffer[40] );
+	header->supercompressionScheme = read_u32( &buffer[44] );
+	if( header->levelCount == 0 )
+	{
+		header->levelCount = 1;
+	}
+	/*	OpenGL takes the sizes as a GLsizei	*/
+	if( (header->pixelWidth == 0) || (header->pixelWidth > 0x7FFFFFFF) ||
+		(header->pixelHeight > 0x7FFFFFFF) || (header->pixelDepth > 0x7FFFFFFF) ||
+		((header->faceCount != 1) && (header->faceCount != 6)) ||
+		(header->levelCount > KTX2_MAX_LEVELS) ||
+		(buffer_length < KTX2_HEADER_SIZE + (int)header->levelCount * KTX2_LEVEL_INDEX_SIZE) )
+	{
+		return 0;
+	}
+	for( i = 0; i < header->levelCount; ++i )
+	{
+		const unsigned char *index = &buffer[KTX2_HEADER_SIZE + i * KTX2_LEVEL_INDEX_SIZE];
+		const unsigned int offset = read_u32( &index[0] );
+		const unsigned int length = read_u32( &index[8] );
+		/*	the offsets and lengths are 64 bit, but the whole file is in RAM	*/
+		if( (read_u32( &index[4] ) != 0) || (read_u32( &index[12] ) != 0) ||
+			(offset > (unsigned int)buffer_length) ||
+			(length > (unsigned int)buffer_length - offset) )
+		{
+			return 0;
+		}
+		header->levelOffset[i] = offset;
+		header->levelLength[i] = length;
+	}
+	return 1;
+}
+
+/*	one sample of the DFD: which bits of the block hold which channel	*/
+static void put_KTX2_sample( unsigned char *p, int channel, int bit_offset, int bit_length )
+{
+	put_u32( &p[0], bit_offset | ((bit_length - 1) << 16) | (channel << 24) );
+	put_u32( &p[4], 0 );
+	put_u32( &p[8], 0 );
+	put_u32( &p[12], 0xFFFFFFFF );
+}
+
+/*	writes the DFD of a DDS_STREAM_* format, and its vkFormat
+	\return the size of the DFD	*/
+static int put_KTX2_DFD( unsigned char *p, int format, int channels, unsigned int *vkFormat )
+{
+	const int block_bytes = compressed_block_size( format, channels );
+	int model, num_samples = 1;
+	if( format == DDS_STREAM_DXT )
+	{
+		if( channels & 1 )
+		{
+			*vkFormat = KTX2_VK_FORMAT_BC1_RGB_UNORM;
+			model = KHR_DF_MODEL_BC1A;
+			put_KTX2_sample( &p[28], KHR_DF_CHANNEL_COLOR, 0, 64 );
+		} else
+		{
+			*vkFormat = KTX2_VK_FORMAT_BC3_UNORM;
+			model = KHR_DF_MODEL_BC3;
+			put_KTX2_sample( &p[28], KHR_DF_CHANNEL_ALPHA, 0, 64 );
+			put_KTX2_sample( &p[44], KHR_DF_CHANNEL_COLOR, 64, 64 );
+			num_samples = 2;
+		}
+	} else
+	if( format == DDS_STREAM_RGTC )
+	{
+		put_KTX2_sample( &p[28], KHR_DF_CHANNEL_COLOR, 0, 64 );
+		if( channels == 1 )
+		{
+			*vkFormat = KTX2_VK_FORMAT_BC4_UNORM;
+			model = KHR_DF_MODEL_BC4;
+		} else
+		{
+			*vkFormat = KTX2_VK_FORMAT_BC5_UNORM;
+			model = KHR_DF_MODEL_BC5;
+			put_KTX2_sample( &p[44], KHR_DF_CHANNEL_GREEN, 64, 64 );
+			num_samples = 2;
+		}
+	} else
+	{
+		*vkFormat = KTX2_VK_FORMAT_BC7_UNORM;
+		model = KHR_DF_MODEL_BC7;
+		put_KTX2_sample( &p[28], KHR_DF_CHANNEL_COLOR, 0, 128 );
+	}
+	/*	the total size, then one basic descriptor block	*/
+	put_u32( &p[0], 4 + 24 + 16 * num_samples );
+	put_u32( &p[4], 0 );
+	put_u32( &p[8], 2 | ((24 + 16 * num_samples) << 16) );
+	put_u32( &p[12], model | (KHR_DF_PRIMARIES_BT709 << 8) | (KHR_DF_TRANSFER_LINEAR << 16) );
+	/*	4x4 texel blocks	*/
+	put_u32( &p[16], 3 | (3 << 8) );
+	put_u32( &p[20], block_bytes );
+	put_u32( &p[24], 0 );
+	return 4 + 24 + 16 * num_samples;
+}
+
+int
+	save_image_as_KTX2
+	(
+		const char *filename,
+		int width, int height, int channels,
+		const unsigned char *const data,
+		int format,
+		int quality,
+		int mipmaps
+	)
+{
+	unsigned char head[KTX2_HEADER_SIZE + KTX2_MAX_LEVELS * KTX2_LEVEL_INDEX_SIZE
+			+ KTX2_DFD_MAX_SIZE + 4 + KTX2_WRITER_SIZE + 3 + 16];
+	long level_offsets[KTX2_MAX_LEVELS];
+	unsigned int vkFormat = 0;
+	FILE *fout;
+	int i, num_levels, block_bytes, DFD_offset, DFD_size, KVD_offset, KVD_size, offset;
+	int result;
+	/*	error check	*/
+	block_bytes = compressed_block_size( format, channels );
+	if( (NULL == filename) ||
+		(width < 1) || (height < 1) ||
+		(channels < 1) || (channels > 4) ||
+		(data == NULL ) || (block_bytes == 0) )
+	{
+		return 0;
+	}
+	num_levels = mipmaps ? count_mipmap_levels( width, height ) : 1;
+	memset( head, 0, sizeof( head ) );
+	/*	the DFD and the key / value data follow the level index	*/
+	DFD_offset = KTX2_HEADER_SIZE + num_levels * KTX2_LEVEL_INDEX_SIZE;
+	DFD_size = put_KTX2_DFD( &head[DFD_offset], format, channels, &vkFormat );
+	KVD_offset = DFD_offset + DFD_size;
+	put_u32( &head[KVD_offset], KTX2_WRITER_SIZE );
+	memcpy( &head[KVD_offset + 4], KTX2_writer, KTX2_WRITER_SIZE );
+	KVD_size = (4 + KTX2_WRITER_SIZE + 3) & ~3;
+	/*	then the levels, smallest first, each on a block boundary	*/
+	offset = KVD_offset + KVD_size;
+	offset = ((offset + block_bytes - 1) / block_bytes) * block_bytes;
+	for( i = num_levels - 1; i >= 0; --i )
+	{
+		const int size = compressed_level_size( format, channels, width >> i, height >> i );
+		unsigned char *index = &head[KTX2_HEADER_SIZE + i * KTX2_LEVEL_INDEX_SIZE];
+		level_offsets[i] = offset;
+		put_u32( &index[0], offset );
+		put_u32( &index[8], size );
+		put_u32( &index[16], size );
+		offset += size;
+	}
+	memcpy( head, KTX2_identifier, sizeof( KTX2_identifier ) );
+	put_u32( &head[12], vkFormat );
+	/*	typeSize is 1 for block compressed formats	*/
+	put_u32( &head[16], 1 );
+	put_u32( &head[20], width );
+	put_u32( &head[24], height );
+	put_u32( &head[28], 0 );
+	put_u32( &head[32], 0 );
+	put_u32( &head[36], 1 );
+	put_u32( &head[40], num_levels );
+	put_u32( &head[44], 0 );
+	put_u32( &head[48], DFD_offset );
+	put_u32( &head[52], DFD_size );
+	put_u32( &head[56], KVD_offset );
+	put_u32( &head[60], KVD_size );
+	/*	no supercompression global data	*/
+	fout = fopen( filename, "wb" );
+	if( NULL == fout )
+	{
+		return 0;
+	}
+	/*	(with the padding up to the smallest level)	*/
+	result = (fwrite( head, 1, (size_t)level_offsets[num_levels - 1], fout ) ==
+			(size_t)level_offsets[num_levels - 1]) &&
+		write_compressed_mipmaps( fout, width, height, channels, data,
+			format, quality, num_levels, level_offsets );
+	if( fclose( fout ) != 0 )
+	{
+		result = 0;
+	}
+	return result;
+}
@@ -0,0 +1,94 @@
+/*
+	KTX2 container
+
+	Reads the header and level index of KTX 2.0 files, so their
+	payloads can be handed to OpenGL just as they are, and writes
+	SOIL's DXT / RGTC / BC7 outputs (with their MIPmap chains) as
+	KTX2 files.  Little endian on disk, whatever this machine is.
+
+	There are no OpenGL calls in here.
+
+	Public Domain
+*/
+
+#ifndef HEADER_IMAGE_KTX2
+#define HEADER_IMAGE_KTX2
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*	the Vulkan formats SOIL knows in a KTX2 file	*/
+#define KTX2_VK_FORMAT_R8G8B8_UNORM	23
+#define KTX2_VK_FORMAT_R8G8B8A8_UNORM	37
+#define KTX2_VK_FORMAT_BC1_RGB_UNORM	131
+#define KTX2_VK_FORMAT_BC1_RGBA_UNORM	133
+#define KTX2_VK_FORMAT_BC2_UNORM	135
+#define KTX2_VK_FORMAT_BC3_UNORM	137
+#define KTX2_VK_FORMAT_BC4_UNORM	139
+#define KTX2_VK_FORMAT_BC5_UNORM	141
+#define KTX2_VK_FORMAT_BC7_UNORM	145
+#define KTX2_VK_FORMAT_BC7_SRGB	146
+
+#define KTX2_MAX_LEVELS	32
+
+/**
+	The header of a KTX2 file, with its level index.
+	A level holds layerCount (at least 1) x faceCount x pixelDepth
+	(at least 1) images, one after the other.
+**/
+typedef struct
+{
+	unsigned int vkFormat;
+	unsigned int typeSize;
+	unsigned int pixelWidth;
+	unsigned int pixelHeight;
+	unsigned int pixelDepth;
+	unsigned int layerCount;
+	unsigned int faceCount;
+	unsigned int levelCount;
+	unsigned int supercompressionScheme;
+	/*	where each level is in the file, and how many bytes it has	*/
+	unsigned int levelOffset[KTX2_MAX_LEVELS];
+	unsigned int levelLength[KTX2_MAX_LEVELS];
+}
+KTX2_header;
+
+/**
+	Reads and checks the header and level index of a KTX2 file in RAM.
+	Every level has to be inside the buffer; a levelCount of 0 (the
+	reader should build the MIPmaps) reads as 1.
+	\return 1 if it is a KTX2 file SOIL can read, otherwise returns 0
+**/
+int
+	read_KTX2_header
+	(
+		const unsigned char *const buffer,
+		int buffer_length,
+		KTX2_header *header
+	);
+
+/**
+	Converts an image to one of the DDS_STREAM_* formats (see
+	image_DXT.h) and saves it to disk as a KTX2 file, with its whole
+	MIPmap chain if mipmaps is not 0.  The levels are compressed and
+	written a few rows at a time, like save_image_as_DDS_mipmapped.
+	\param quality one of the DXT_QUALITY_*
+	\return 0 if failed, otherwise returns 1
+**/
+int
+	save_image_as_KTX2
+	(
+		const char *filename,
+		int width, int height, int channels,
+		const unsigned char *const data,
+		int format,
+		int quality,
+		int mipmaps
+	);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HEADER_IMAGE_KTX2	*/
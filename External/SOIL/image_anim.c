@@ -0,0 +1,1051 @@
+/*
+	Animated images
+
+	Plays animated GIF and APNG files one frame at a time,
+	see image_anim.h.
+
+	Public Domain
+*/
+
+#include "image_anim.h"
+#include "stb_image_aug.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/*	one decoded frame kept in the cache	*/
+typedef struct
+{
+	int frame;
+	unsigned char *canvas;
+	/*	what the frame covered up, if it is disposed of to the previous	*/
+	unsigned char *restore;
+	size_t bytes;
+	unsigned int last_used;
+}
+anim_cache_entry;
+
+static int read_le16( const unsigned char *p )
+{
+	return p[0] | (p[1] << 8);
+}
+
+static int read_be16( const unsigned char *p )
+{
+	return (p[0] << 8) | p[1];
+}
+
+static unsigned int read_be32( const unsigned char *p )
+{
+	return ((unsigned int)p[0] << 24) | ((unsigned int)p[1] << 16) |
+			((unsigned int)p[2] << 8) | (unsigned int)p[3];
+}
+
+static void write_be32( unsigned char *p, unsigned int value )
+{
+	p[0] = (unsigned char)(value >> 24);
+	p[1] = (unsigned char)(value >> 16);
+	p[2] = (unsigned char)(value >> 8);
+	p[3] = (unsigned char)value;
+}
+
+/*	the part of a frame that is on the canvas	*/
+static image_anim_rect clip_rect( const image_anim *anim, const image_anim_rect *rect )
+{
+	image_anim_rect clipped = *rect;
+	if( clipped.x >= anim->width )
+	{
+		clipped.width = 0;
+	} else if( clipped.width > anim->width - clipped.x )
+	{
+		clipped.width = anim->width - clipped.x;
+	}
+	if( clipped.y >= anim->height )
+	{
+		clipped.height = 0;
+	} else if( clipped.height > anim->height - clipped.y )
+	{
+		clipped.height = anim->height - clipped.y;
+	}
+	if( (clipped.width <= 0) || (clipped.height <= 0) )
+	{
+		clipped.width = clipped.height = 0;
+	}
+	return clipped;
+}
+
+static void union_rect( image_anim_rect *rect, const image_anim_rect *add )
+{
+	int right, bottom;
+	if( (add->width <= 0) || (add->height <= 0) )
+	{
+		return;
+	}
+	if( (rect->width <= 0) || (rect->height <= 0) )
+	{
+		*rect = *add;
+		return;
+	}
+	right = rect->x + rect->width;
+	bottom = rect->y + rect->height;
+	if( add->x + add->width > right )
+	{
+		right = add->x + add->width;
+	}
+	if( add->y + add->height > bottom )
+	{
+		bottom = add->y + add->height;
+	}
+	if( add->x < rect->x )
+	{
+		rect->x = add->x;
+	}
+	if( add->y < rect->y )
+	{
+		rect->y = add->y;
+	}
+	rect->width = right - rect->x;
+	rect->height = bottom - rect->y;
+}
+
+/*	copies a rectangle from one canvas to another	*/
+static void copy_rect( unsigned char *dst, const unsigned char *src,
+		int canvas_width, const image_anim_rect *rect )
+{
+	int y;
+	for( y = rect->y; y < rect->y + rect->height; ++y )
+	{
+		size_t start = ((size_t)y * canvas_width + rect->x) * 4;
+		memcpy( dst + start, src + start, rect->width * 4 );
+	}
+}
+
+/*	the restore buffer is packed: rect->width * 4 bytes a row	*/
+static void save_rect( image_anim *anim, const image_anim_rect *rect )
+{
+	int y;
+	for( y = 0; y < rect->height; ++y )
+	{
+		memcpy( anim->restore + (size_t)y * rect->width * 4,
+				anim->canvas + ((size_t)(rect->y + y) * anim->width + rect->x) * 4,
+				rect->width * 4 );
+	}
+}
+
+static void put_back_rect( image_anim *anim, const image_anim_rect *rect )
+{
+	int y;
+	for( y = 0; y < rect->height; ++y )
+	{
+		memcpy( anim->canvas + ((size_t)(rect->y + y) * anim->width + rect->x) * 4,
+				anim->restore + (size_t)y * rect->width * 4,
+				rect->width * 4 );
+	}
+}
+
+static void clear_rect( image_anim *anim, const image_anim_rect *rect )
+{
+	int y;
+	for( y = rect->y; y < rect->y + rect->height; ++y )
+	{
+		memset( anim->canvas + ((size_t)y * anim->width + rect->x) * 4, 0, rect->width * 4 );
+	}
+}
+
+static image_anim_frame* add_frame( image_anim *anim )
+{
+	/*	the frame list grows by doubling	*/
+	if( (anim->num_frames & (anim->num_frames - 1)) == 0 )
+	{
+		int max_frames = anim->num_frames ? anim->num_frames * 2 : 8;
+		image_anim_frame *frames = (image_anim_frame*)realloc(
+				anim->frames, max_frames * sizeof( image_anim_frame ) );
+		if( NULL == frames )
+		{
+			return NULL;
+		}
+		anim->frames = frames;
+	}
+	memset( &anim->frames[anim->num_frames], 0, sizeof( image_anim_frame ) );
+	anim->frames[anim->num_frames].transparent = -1;
+	return &anim->frames[anim->num_frames++];
+}
+
+/*	skips GIF data sub-blocks, returns where they end or -1 if truncated	*/
+static int skip_sub_blocks( const unsigned char *buffer, int length, int pos )
+{
+	while( pos < length )
+	{
+		int size = buffer[pos++];
+		if( size == 0 )
+		{
+			return pos;
+		}
+		pos += size;
+	}
+	return -1;
+}
+
+/*	finds every frame of a GIF file (a truncated frame ends it)	*/
+static int scan_gif( image_anim *anim )
+{
+	const unsigned char *buffer = anim->buffer;
+	int length = anim->buffer_length;
+	int pos = 13, delay = 0, dispose = 0, transparent = -1;
+	if( length < 13 )
+	{
+		anim->error = "Truncated GIF file";
+		return 0;
+	}
+	anim->width = read_le16( buffer + 6 );
+	anim->height = read_le16( buffer + 8 );
+	/*	without a NETSCAPE2.0 block it plays once	*/
+	anim->loop_count = 1;
+	if( buffer[10] & 0x80 )
+	{
+		pos += 3 << ((buffer[10] & 7) + 1);
+	}
+	while( pos < length )
+	{
+		if( buffer[pos] == 0x21 )
+		{
+			/*	an extension	*/
+			int label;
+			if( pos + 2 > length )
+			{
+				break;
+			}
+			label = buffer[pos + 1];
+			pos += 2;
+			if( (label == 0xF9) && (pos + 5 <= length) && (buffer[pos] >= 4) )
+			{
+				/*	graphic control: how the next frame is shown	*/
+				dispose = (buffer[pos + 1] >> 2) & 7;
+				delay = read_le16( buffer + pos + 2 );
+				transparent = (buffer[pos + 1] & 1) ? buffer[pos + 4] : -1;
+			} else if( (label == 0xFF) && (pos + 16 <= length) && (buffer[pos] == 11) &&
+				(0 == memcmp( buffer + pos + 1, "NETSCAPE2.0", 11 )) &&
+				(buffer[pos + 12] >= 3) && (buffer[pos + 13] == 1) )
+			{
+				/*	the number of times to repeat, 0 for forever	*/
+				int repeats = read_le16( buffer + pos + 14 );
+				anim->loop_count = repeats ? repeats + 1 : 0;
+			}
+			pos = skip_sub_blocks( buffer, length, pos );
+			if( pos < 0 )
+			{
+				break;
+			}
+		} else if( buffer[pos] == 0x2C )
+		{
+			/*	an image descriptor, then the LZW data	*/
+			image_anim_frame *frame;
+			int end = pos + 10;
+			if( end > length )
+			{
+				break;
+			}
+			if( buffer[pos + 9] & 0x80 )
+			{
+				end += 3 << ((buffer[pos + 9] & 7) + 1);
+			}
+			end = skip_sub_blocks( buffer, length, end + 1 );
+			if( end < 0 )
+			{
+				break;
+			}
+			frame = add_frame( anim );
+			if( NULL == frame )
+			{
+				anim->error = "malloc failed";
+				return 0;
+			}
+			frame->offset = pos;
+			frame->rect.x = read_le16( buffer + pos + 1 );
+			frame->rect.y = read_le16( buffer + pos + 3 );
+			frame->rect.width = read_le16( buffer + pos + 5 );
+			frame->rect.height = read_le16( buffer + pos + 7 );
+			frame->delay_ms = delay * 10;
+			frame->dispose = (dispose == 2) ? IMAGE_ANIM_DISPOSE_BACKGROUND :
+					(dispose == 3) ? IMAGE_ANIM_DISPOSE_PREVIOUS : IMAGE_ANIM_DISPOSE_NONE;
+			frame->blend = IMAGE_ANIM_BLEND_OVER;
+			frame->transparent = (short)transparent;
+			/*	a graphic control block is only good for one frame	*/
+			delay = 0;
+			dispose = 0;
+			transparent = -1;
+			pos = end;
+		} else
+		{
+			/*	the trailer, or garbage	*/
+			break;
+		}
+	}
+	return 1;
+}
+
+/*	finds every frame of a PNG file: the fcTL chunks of an APNG, or else
+	the image itself	*/
+static int scan_png( image_anim *anim )
+{
+	const unsigned char *buffer = anim->buffer;
+	int length = anim->buffer_length;
+	int pos = 8, animated = 0;
+	anim->loop_count = 1;
+	while( pos + 12 <= length )
+	{
+		const unsigned char *data = buffer + pos + 8;
+		unsigned int chunk_length = read_be32( buffer + pos );
+		image_anim_frame *frame = NULL;
+		if( chunk_length > (unsigned int)(length - pos - 12) )
+		{
+			break;
+		}
+		if( (0 == memcmp( buffer + pos + 4, "IHDR", 4 )) && (chunk_length >= 13) )
+		{
+			anim->width = (int)read_be32( data );
+			anim->height = (int)read_be32( data + 4 );
+		} else if( (0 == memcmp( buffer + pos + 4, "acTL", 4 )) && (chunk_length >= 8) )
+		{
+			animated = 1;
+			anim->loop_count = (int)read_be32( data + 4 );
+		} else if( (0 == memcmp( buffer + pos + 4, "fcTL", 4 )) && (chunk_length >= 26) && animated )
+		{
+			int delay_num = read_be16( data + 20 );
+			int delay_den = read_be16( data + 22 );
+			frame = add_frame( anim );
+			if( NULL == frame )
+			{
+				anim->error = "malloc failed";
+				return 0;
+			}
+			frame->rect.width = (int)read_be32( data + 4 );
+			frame->rect.height = (int)read_be32( data + 8 );
+			frame->rect.x = (int)read_be32( data + 12 );
+			frame->rect.y = (int)read_be32( data + 16 );
+			/*	a denominator of 0 means hundredths of a second	*/
+			frame->delay_ms = delay_num * 1000 / (delay_den ? delay_den : 100);
+			frame->dispose = (data[24] == 1) ? IMAGE_ANIM_DISPOSE_BACKGROUND :
+					(data[24] == 2) ? IMAGE_ANIM_DISPOSE_PREVIOUS : IMAGE_ANIM_DISPOSE_NONE;
+			frame->blend = (data[25] == 1) ? IMAGE_ANIM_BLEND_OVER : IMAGE_ANIM_BLEND_SOURCE;
+		} else if( (0 == memcmp( buffer + pos + 4, "IDAT", 4 )) && !animated && (anim->num_frames == 0) )
+		{
+			/*	not an APNG: the image is the only frame	*/
+			frame = add_frame( anim );
+			if( NULL == frame )
+			{
+				anim->error = "malloc failed";
+				return 0;
+			}
+			frame->rect.width = anim->width;
+			frame->rect.height = anim->height;
+			frame->blend = IMAGE_ANIM_BLEND_SOURCE;
+		} else if( 0 == memcmp( buffer + pos + 4, "IEND", 4 ) )
+		{
+			break;
+		}
+		if( frame )
+		{
+			frame->offset = pos;
+			/*	the spec has every frame inside the canvas (in unsigned,
+				so offset + size can not overflow)	*/
+			if( (frame->rect.x < 0) || (frame->rect.y < 0) ||
+				(frame->rect.width <= 0) || (frame->rect.height <= 0) ||
+				((unsigned int)frame->rect.x + (unsigned int)frame->rect.width > (unsigned int)anim->width) ||
+				((unsigned int)frame->rect.y + (unsigned int)frame->rect.height > (unsigned int)anim->height) )
+			{
+				anim->error = "Invalid APNG frame";
+				return 0;
+			}
+		}
+		pos += 12 + (int)chunk_length;
+	}
+	return 1;
+}
+
+/*	the GIF LZW decoder writes the pixels of a frame through this	*/
+typedef struct
+{
+	image_anim *anim;
+	const image_anim_frame *frame;
+	const unsigned char *palette;
+	int palette_size;
+	int interlaced, pass;
+	int x, y;
+	unsigned int count, total;
+}
+gif_output;
+
+static void gif_put( gif_output *out, int index )
+{
+	static const int pass_start[4] = { 0, 4, 2, 1 };
+	static const int pass_step[4] = { 8, 8, 4, 2 };
+	const image_anim_frame *frame = out->frame;
+	int canvas_x = frame->rect.x + out->x;
+	int canvas_y = frame->rect.y + out->y;
+	if( (index != frame->transparent) &&
+		(canvas_x < out->anim->width) && (canvas_y < out->anim->height) )
+	{
+		unsigned char *pixel = out->anim->canvas +
+				((size_t)canvas_y * out->anim->width + canvas_x) * 4;
+		if( index < out->palette_size )
+		{
+			pixel[0] = out->palette[index * 3 + 0];
+			pixel[1] = out->palette[index * 3 + 1];
+			pixel[2] = out->palette[index * 3 + 2];
+		} else
+		{
+			pixel[0] = pixel[1] = pixel[2] = 0;
+		}
+		pixel[3] = 255;
+	}
+	++out->count;
+	if( ++out->x == frame->rect.width )
+	{
+		out->x = 0;
+		if( out->interlaced )
+		{
+			out->y += pass_step[out->pass];
+			while( (out->y >= frame->rect.height) && (out->pass < 3) )
+			{
+				out->y = pass_start[++out->pass];
+			}
+		} else
+		{
+			++out->y;
+		}
+	}
+}
+
+static int decode_gif_frame( image_anim *anim, const image_anim_frame *frame )
+{
+	const unsigned char *buffer = anim->buffer;
+	int length = anim->buffer_length;
+	int pos = frame->offset + 10;
+	int flags = buffer[frame->offset + 9];
+	unsigned short prefix[4096];
+	unsigned char suffix[4096];
+	unsigned char stack[4097];
+	int min_code_size, code_size, clear_code, next_code, old_code = -1, first = 0;
+	int block_left = 0, bits_held = 0;
+	unsigned int bits = 0;
+	gif_output out;
+	memset( &out, 0, sizeof( gif_output ) );
+	out.anim = anim;
+	out.frame = frame;
+	out.interlaced = (flags & 0x40) != 0;
+	out.total = (unsigned int)frame->rect.width * (unsigned int)frame->rect.height;
+	/*	a local palette, or the global one	*/
+	if( flags & 0x80 )
+	{
+		out.palette = buffer + pos;
+		out.palette_size = 1 << ((flags & 7) + 1);
+		pos += out.palette_size * 3;
+	} else if( buffer[10] & 0x80 )
+	{
+		out.palette = buffer + 13;
+		out.palette_size = 1 << ((buffer[10] & 7) + 1);
+	}
+	min_code_size = buffer[pos++];
+	if( (min_code_size < 1) || (min_code_size > 8) )
+	{
+		anim->error = "Invalid GIF LZW code size";
+		return 0;
+	}
+	clear_code = 1 << min_code_size;
+	code_size = min_code_size + 1;
+	next_code = clear_code + 2;
+	for( old_code = 0; old_code < clear_code; ++old_code )
+	{
+		prefix[old_code] = 0;
+		suffix[old_code] = (unsigned char)old_code;
+	}
+	old_code = -1;
+	while( out.count < out.total )
+	{
+		int code, in_code, top = 0;
+		/*	the codes are packed LSB first into sub-blocks	*/
+		while( bits_held < code_size )
+		{
+			if( block_left == 0 )
+			{
+				if( (pos >= length) || (buffer[pos] == 0) )
+				{
+					/*	out of data: the rest of the frame stays as it was	*/
+					return 1;
+				}
+				block_left = buffer[pos++];
+			}
+			if( pos >= length )
+			{
+				return 1;
+			}
+			bits |= (unsigned int)buffer[pos++] << bits_held;
+			bits_held += 8;
+			--block_left;
+		}
+		code = (int)(bits & ((1u << code_size) - 1));
+		bits >>= code_size;
+		bits_held -= code_size;
+		if( code == clear_code )
+		{
+			code_size = min_code_size + 1;
+			next_code = clear_code + 2;
+			old_code = -1;
+			continue;
+		}
+		if( code == clear_code + 1 )
+		{
+			/*	the end of the data	*/
+			break;
+		}
+		if( old_code < 0 )
+		{
+			if( code >= clear_code )
+			{
+				anim->error = "Corrupt GIF LZW data";
+				return 0;
+			}
+			gif_put( &out, code );
+			old_code = first = code;
+			continue;
+		}
+		in_code = code;
+		if( code > next_code )
+		{
+			anim->error = "Corrupt GIF LZW data";
+			return 0;
+		}
+		if( code == next_code )
+		{
+			/*	the code being defined right now: the last string + its first	*/
+			stack[top++] = (unsigned char)first;
+			code = old_code;
+		}
+		while( code >= clear_code )
+		{
+			stack[top++] = suffix[code];
+			code = prefix[code];
+		}
+		first = code;
+		stack[top++] = (unsigned char)first;
+		while( (top > 0) && (out.count < out.total) )
+		{
+			gif_put( &out, stack[--top] );
+		}
+		if( next_code < 4096 )
+		{
+			prefix[next_code] = (unsigned short)old_code;
+			suffix[next_code] = (unsigned char)first;
+			++next_code;
+			if( (next_code == (1 << code_size)) && (code_size < 12) )
+			{
+				++code_size;
+			}
+		}
+		old_code = in_code;
+	}
+	return 1;
+}
+
+/*	finds a chunk that comes before the image data	*/
+static const unsigned char* find_png_chunk( const image_anim *anim, const char *type,
+		unsigned int *chunk_length )
+{
+	int pos = 8;
+	while( pos + 12 <= anim->buffer_length )
+	{
+		unsigned int size = read_be32( anim->buffer + pos );
+		if( (size > (unsigned int)(anim->buffer_length - pos - 12)) ||
+			(0 == memcmp( anim->buffer + pos + 4, "IDAT", 4 )) )
+		{
+			break;
+		}
+		if( 0 == memcmp( anim->buffer + pos + 4, type, 4 ) )
+		{
+			*chunk_length = size;
+			return anim->buffer + pos;
+		}
+		pos += 12 + (int)size;
+	}
+	return NULL;
+}
+
+static unsigned char* add_png_chunk( unsigned char *out, const char *type,
+		const unsigned char *data, unsigned int size )
+{
+	write_be32( out, size );
+	memcpy( out + 4, type, 4 );
+	if( size )
+	{
+		memcpy( out + 8, data, size );
+	}
+	/*	stb_image does not check the CRCs	*/
+	memset( out + 8 + size, 0, 4 );
+	return out + 12 + size;
+}
+
+/*	decodes a PNG frame by making it a PNG file of its own: the header
+	with the frame size, the palette, and its image data	*/
+static unsigned char* decode_png_frame( image_anim *anim, const image_anim_frame *frame )
+{
+	const unsigned char *buffer = anim->buffer;
+	const unsigned char *ihdr, *plte, *trns;
+	unsigned int ihdr_length = 0, plte_length = 0, trns_length = 0, data_length = 0;
+	unsigned char *png, *out, *img;
+	int pos, first_chunk, png_length, width, height, channels;
+	ihdr = find_png_chunk( anim, "IHDR", &ihdr_length );
+	plte = find_png_chunk( anim, "PLTE", &plte_length );
+	trns = find_png_chunk( anim, "tRNS", &trns_length );
+	if( (NULL == ihdr) || (ihdr_length != 13) )
+	{
+		anim->error = "Invalid PNG header";
+		return NULL;
+	}
+	/*	the frame's data: IDAT chunks for a plain PNG (or the first frame,
+		if the default image is part of the animation), otherwise fdAT
+		chunks, each starting with a sequence number	*/
+	first_chunk = frame->offset;
+	if( 0 != memcmp( buffer + first_chunk + 4, "IDAT", 4 ) )
+	{
+		first_chunk += 12 + (int)read_be32( buffer + first_chunk );
+	}
+	for( pos = first_chunk; pos + 12 <= anim->buffer_length; )
+	{
+		unsigned int size = read_be32( buffer + pos );
+		if( size > (unsigned int)(anim->buffer_length - pos - 12) )
+		{
+			break;
+		}
+		if( 0 == memcmp( buffer + pos + 4, "IDAT", 4 ) )
+		{
+			data_length += size;
+		} else if( (0 == memcmp( buffer + pos + 4, "fdAT", 4 )) && (size >= 4) )
+		{
+			data_length += size - 4;
+		} else
+		{
+			break;
+		}
+		pos += 12 + (int)size;
+	}
+	png_length = 8 + (12 + 13) + (plte ? 12 + plte_length : 0) +
+			(trns ? 12 + trns_length : 0) + (12 + data_length) + 12;
+	png = (unsigned char*)malloc( png_length );
+	if( NULL == png )
+	{
+		anim->error = "malloc failed";
+		return NULL;
+	}
+	memcpy( png, "\x89PNG\r\n\x1A\n", 8 );
+	out = add_png_chunk( png + 8, "IHDR", ihdr + 8, 13 );
+	write_be32( png + 16, (unsigned int)frame->rect.width );
+	write_be32( png + 20, (unsigned int)frame->rect.height );
+	if( plte )
+	{
+		out = add_png_chunk( out, "PLTE", plte + 8, plte_length );
+	}
+	if( trns )
+	{
+		out = add_png_chunk( out, "tRNS", trns + 8, trns_length );
+	}
+	write_be32( out, data_length );
+	memcpy( out + 4, "IDAT", 4 );
+	out += 8;
+	for( pos = first_chunk; pos + 12 <= anim->buffer_length; )
+	{
+		unsigned int size = read_be32( buffer + pos );
+		if( size > (unsigned int)(anim->buffer_length - pos - 12) )
+		{
+			break;
+		}
+		if( 0 == memcmp( buffer + pos + 4, "IDAT", 4 ) )
+		{
+			memcpy( out, buffer + pos + 8, size );
+			out += size;
+		} else if( (0 == memcmp( buffer + pos + 4, "fdAT", 4 )) && (size >= 4) )
+		{
+			memcpy( out, buffer + pos + 12, size - 4 );
+			out += size - 4;
+		} else
+		{
+			break;
+		}
+		pos += 12 + (int)size;
+	}
+	memset( out, 0, 4 );
+	out = add_png_chunk( out + 4, "IEND", NULL, 0 );
+	img = stbi_png_load_from_memory( png, png_length, &width, &height, &channels, 4 );
+	free( png );
+	if( NULL == img )
+	{
+		anim->error = stbi_failure_reason();
+		return NULL;
+	}
+	return img;
+}
+
+/*	draws a decoded frame onto the canvas	*/
+static void draw_frame( image_anim *anim, const image_anim_frame *frame,
+		const unsigned char *img, const image_anim_rect *area )
+{
+	int x, y;
+	for( y = 0; y < area->height; ++y )
+	{
+		const unsigned char *src = img + (size_t)y * frame->rect.width * 4;
+		unsigned char *dst = anim->canvas + ((size_t)(area->y + y) * anim->width + area->x) * 4;
+		if( frame->blend == IMAGE_ANIM_BLEND_SOURCE )
+		{
+			memcpy( dst, src, area->width * 4 );
+			continue;
+		}
+		for( x = 0; x < area->width; ++x, src += 4, dst += 4 )
+		{
+			int src_alpha = src[3];
+			if( src_alpha == 255 )
+			{
+				memcpy( dst, src, 4 );
+			} else if( src_alpha != 0 )
+			{
+				/*	straight (not premultiplied) alpha "over"	*/
+				int dst_weight = dst[3] * (255 - src_alpha);
+				int out_alpha = src_alpha * 255 + dst_weight;
+				int i;
+				for( i = 0; i < 3; ++i )
+				{
+					dst[i] = (unsigned char)((src[i] * src_alpha * 255 + dst[i] * dst_weight +
+							out_alpha / 2) / out_alpha);
+				}
+				dst[3] = (unsigned char)((out_alpha + 127) / 255);
+			}
+		}
+	}
+}
+
+static int cache_find( const image_anim *anim, int frame )
+{
+	const anim_cache_entry *entries = (const anim_cache_entry*)anim->cache;
+	int i;
+	for( i = 0; i < anim->cache_count; ++i )
+	{
+		if( entries[i].frame == frame )
+		{
+			return i;
+		}
+	}
+	return -1;
+}
+
+static void cache_drop( image_anim *anim, int index )
+{
+	anim_cache_entry *entries = (anim_cache_entry*)anim->cache;
+	free( entries[index].canvas );
+	free( entries[index].restore );
+	anim->cache_used -= entries[index].bytes;
+	entries[index] = entries[--anim->cache_count];
+}
+
+/*	keeps a copy of the canvas, dropping the least recently used frames
+	to stay within the budget	*/
+static void cache_store( image_anim *anim, int frame, const image_anim_rect *area )
+{
+	anim_cache_entry *entries;
+	anim_cache_entry entry;
+	size_t canvas_bytes = (size_t)anim->width * anim->height * 4;
+	size_t restore_bytes = 0;
+	if( anim->frames[frame].dispose == IMAGE_ANIM_DISPOSE_PREVIOUS )
+	{
+		restore_bytes = (size_t)area->width * area->height * 4;
+	}
+	if( canvas_bytes + restore_bytes > anim->cache_budget )
+	{
+		return;
+	}
+	while( anim->cache_used + canvas_bytes + restore_bytes > anim->cache_budget )
+	{
+		int i, oldest = 0;
+		entries = (anim_cache_entry*)anim->cache;
+		for( i = 1; i < anim->cache_count; ++i )
+		{
+			if( entries[i].last_used < entries[oldest].last_used )
+			{
+				oldest = i;
+			}
+		}
+		cache_drop( anim, oldest );
+	}
+	memset( &entry, 0, sizeof( anim_cache_entry ) );
+	entry.frame = frame;
+	entry.canvas = (unsigned char*)malloc( canvas_bytes );
+	entry.restore = restore_bytes ? (unsigned char*)malloc( restore_bytes ) : NULL;
+	entries = (anim_cache_entry*)realloc( anim->cache,
+			(anim->cache_count + 1) * sizeof( anim_cache_entry ) );
+	if( (NULL == entry.canvas) || (restore_bytes && (NULL == entry.restore)) || (NULL == entries) )
+	{
+		/*	no room for it, that is all	*/
+		free( entry.canvas );
+		free( entry.restore );
+		if( entries )
+		{
+			anim->cache = entries;
+		}
+		return;
+	}
+	memcpy( entry.canvas, anim->canvas, canvas_bytes );
+	if( restore_bytes )
+	{
+		memcpy( entry.restore, anim->restore, restore_bytes );
+	}
+	entry.bytes = canvas_bytes + restore_bytes;
+	entry.last_used = ++anim->cache_clock;
+	anim->cache = entries;
+	entries[anim->cache_count++] = entry;
+	anim->cache_used += entry.bytes;
+}
+
+/*	goes from frame current to frame current + 1	*/
+static int step( image_anim *anim, image_anim_rect *changed )
+{
+	int index = anim->current + 1;
+	const image_anim_frame *frame = &anim->frames[index];
+	image_anim_rect area = clip_rect( anim, &frame->rect );
+	int cached;
+	/*	first get rid of the previous frame	*/
+	if( anim->current >= 0 )
+	{
+		const image_anim_frame *previous = &anim->frames[anim->current];
+		image_anim_rect previous_area = clip_rect( anim, &previous->rect );
+		if( previous->dispose == IMAGE_ANIM_DISPOSE_BACKGROUND )
+		{
+			clear_rect( anim, &previous_area );
+			union_rect( changed, &previous_area );
+		} else if( previous->dispose == IMAGE_ANIM_DISPOSE_PREVIOUS )
+		{
+			put_back_rect( anim, &previous_area );
+			union_rect( changed, &previous_area );
+		}
+	}
+	if( frame->dispose == IMAGE_ANIM_DISPOSE_PREVIOUS )
+	{
+		save_rect( anim, &area );
+	}
+	/*	only the frame's own area differs from the cached canvas now	*/
+	cached = cache_find( anim, index );
+	if( cached >= 0 )
+	{
+		anim_cache_entry *entry = &((anim_cache_entry*)anim->cache)[cached];
+		copy_rect( anim->canvas, entry->canvas, anim->width, &area );
+		entry->last_used = ++anim->cache_clock;
+		++anim->cache_hits;
+	} else
+	{
+		if( anim->is_gif )
+		{
+			if( !decode_gif_frame( anim, frame ) )
+			{
+				return 0;
+			}
+		} else
+		{
+			unsigned char *img = decode_png_frame( anim, frame );
+			if( NULL == img )
+			{
+				return 0;
+			}
+			draw_frame( anim, frame, img, &area );
+			stbi_image_free( img );
+		}
+		++anim->frames_decoded;
+	}
+	union_rect( changed, &area );
+	anim->current = index;
+	if( (cached < 0) && (anim->cache_budget > 0) )
+	{
+		cache_store( anim, index, &area );
+	}
+	return 1;
+}
+
+int
+	image_anim_open_memory
+	(
+		image_anim *anim,
+		const unsigned char *buffer,
+		int buffer_length
+	)
+{
+	int ok, i;
+	memset( anim, 0, sizeof( image_anim ) );
+	anim->buffer = buffer;
+	anim->buffer_length = buffer_length;
+	anim->current = -1;
+	if( (NULL != buffer) && (buffer_length >= 6) &&
+		((0 == memcmp( buffer, "GIF87a", 6 )) || (0 == memcmp( buffer, "GIF89a", 6 ))) )
+	{
+		anim->is_gif = 1;
+		ok = scan_gif( anim );
+	} else if( (NULL != buffer) && (buffer_length >= 8) &&
+		(0 == memcmp( buffer, "\x89PNG\r\n\x1A\n", 8 )) )
+	{
+		ok = scan_png( anim );
+	} else
+	{
+		anim->error = "Not a GIF or PNG file";
+		ok = 0;
+	}
+	if( ok && ((anim->width <= 0) || (anim->height <= 0) ||
+		(anim->width > 0x4000) || (anim->height > 0x4000)) )
+	{
+		anim->error = "Invalid image size";
+		ok = 0;
+	}
+	if( ok && (anim->num_frames == 0) )
+	{
+		anim->error = "No frames in the file";
+		ok = 0;
+	}
+	if( ok )
+	{
+		anim->canvas = (unsigned char*)calloc( (size_t)anim->width * anim->height, 4 );
+		/*	the restore buffer holds up to a whole canvas	*/
+		for( i = 0; i < anim->num_frames; ++i )
+		{
+			if( anim->frames[i].dispose == IMAGE_ANIM_DISPOSE_PREVIOUS )
+			{
+				anim->restore = (unsigned char*)malloc( (size_t)anim->width * anim->height * 4 );
+				ok = (NULL != anim->restore);
+				break;
+			}
+		}
+		if( (NULL == anim->canvas) || !ok )
+		{
+			anim->error = "malloc failed";
+			ok = 0;
+		}
+	}
+	if( !ok )
+	{
+		const char *error = anim->error;
+		image_anim_free( anim );
+		anim->error = error;
+	}
+	return ok;
+}
+
+void
+	image_anim_free
+	(
+		image_anim *anim
+	)
+{
+	image_anim_set_cache( anim, 0 );
+	free( anim->cache );
+	free( anim->frames );
+	free( anim->canvas );
+	free( anim->restore );
+	memset( anim, 0, sizeof( image_anim ) );
+	anim->current = -1;
+}
+
+void
+	image_anim_set_cache
+	(
+		image_anim *anim,
+		size_t budget_bytes
+	)
+{
+	anim->cache_budget = budget_bytes;
+	while( anim->cache_used > budget_bytes )
+	{
+		int i, oldest = 0;
+		const anim_cache_entry *entries = (const anim_cache_entry*)anim->cache;
+		for( i = 1; i < anim->cache_count; ++i )
+		{
+			if( entries[i].last_used < entries[oldest].last_used )
+			{
+				oldest = i;
+			}
+		}
+		cache_drop( anim, oldest );
+	}
+}
+
+int
+	image_anim_seek
+	(
+		image_anim *anim,
+		int frame,
+		image_anim_rect *dirty
+	)
+{
+	image_anim_rect changed;
+	memset( &changed, 0, sizeof( image_anim_rect ) );
+	if( (frame < 0) || (frame >= anim->num_frames) )
+	{
+		anim->error = "No such frame";
+		return 0;
+	}
+	if( (frame != anim->current) && ((frame != anim->current + 1) || (anim->current < 0)) )
+	{
+		/*	a jump: start from the nearest cached frame before it	*/
+		const anim_cache_entry *entries = (const anim_cache_entry*)anim->cache;
+		int i, best = -1;
+		for( i = 0; i < anim->cache_count; ++i )
+		{
+			if( (entries[i].frame <= frame) &&
+				((best < 0) || (entries[i].frame > entries[best].frame)) )
+			{
+				best = i;
+			}
+		}
+		if( best >= 0 )
+		{
+			const anim_cache_entry *entry = &entries[best];
+			memcpy( anim->canvas, entry->canvas, (size_t)anim->width * anim->height * 4 );
+			if( entry->restore )
+			{
+				memcpy( anim->restore, entry->restore,
+						entry->bytes - (size_t)anim->width * anim->height * 4 );
+			}
+			anim->current = entry->frame;
+			((anim_cache_entry*)anim->cache)[best].last_used = ++anim->cache_clock;
+			++anim->cache_hits;
+		} else
+		{
+			memset( anim->canvas, 0, (size_t)anim->width * anim->height * 4 );
+			anim->current = -1;
+		}
+		changed.width = anim->width;
+		changed.height = anim->height;
+	}
+	while( anim->current < frame )
+	{
+		if( !step( anim, &changed ) )
+		{
+			/*	the canvas is in no known state now	*/
+			memset( anim->canvas, 0, (size_t)anim->width * anim->height * 4 );
+			anim->current = -1;
+			return 0;
+		}
+	}
+	if( dirty )
+	{
+		*dirty = changed;
+	}
+	return 1;
+}
+
+int
+	image_anim_next
+	(
+		image_anim *anim,
+		image_anim_rect *dirty
+	)
+{
+	int frame = anim->current + 1;
+	if( frame >= anim->num_frames )
+	{
+		frame = 0;
+	}
+	return image_anim_seek( anim, frame, dirty ) ? frame : -1;
+}
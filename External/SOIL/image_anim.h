@@ -0,0 +1,184 @@
+/*
+	Animated images
+
+	Plays animated GIF and APNG files one frame at a time.  Opening an
+	animation only reads through the file to find where each frame is;
+	a frame is decoded when it is asked for, drawn onto a canvas that
+	holds what the whole image looks like at that frame.  Each frame
+	only covers part of the canvas, so only that part is decoded, and
+	the area that changed since the previous frame is reported, so it
+	is all that has to go on to the texture.
+
+	The decoded canvases can be kept in a cache with a budget in
+	bytes, least recently used out first, so playing a short loop
+	again (or going back a few frames) costs a copy instead of a decode.
+
+	Plain (single image) GIF and PNG files open as one frame.  PNG
+	frames are decoded by stb_image, so they are 8 bits per channel,
+	not interlaced.  Disposing of a frame to the background clears it
+	to transparent, as browsers do (and so does disposing of the first
+	frame to the previous one).
+
+	There are no OpenGL calls in here.
+
+	Public Domain
+*/
+
+#ifndef HEADER_IMAGE_ANIM
+#define HEADER_IMAGE_ANIM
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+	What happens to the area of a frame before the next one is drawn.
+	IMAGE_ANIM_DISPOSE_NONE: it stays as it is
+	IMAGE_ANIM_DISPOSE_BACKGROUND: it is cleared to transparent
+	IMAGE_ANIM_DISPOSE_PREVIOUS: it goes back to what it was before
+**/
+enum
+{
+	IMAGE_ANIM_DISPOSE_NONE = 0,
+	IMAGE_ANIM_DISPOSE_BACKGROUND = 1,
+	IMAGE_ANIM_DISPOSE_PREVIOUS = 2
+};
+
+/**
+	How a frame is drawn on the canvas.
+	IMAGE_ANIM_BLEND_SOURCE: it replaces what is there
+	IMAGE_ANIM_BLEND_OVER: it is alpha blended over what is there
+**/
+enum
+{
+	IMAGE_ANIM_BLEND_SOURCE = 0,
+	IMAGE_ANIM_BLEND_OVER = 1
+};
+
+/**
+	A rectangle of the canvas, in pixels from the top left.
+**/
+typedef struct
+{
+	int x, y;
+	int width, height;
+}
+image_anim_rect;
+
+/**
+	Where a frame is in the file, and how it is drawn.
+**/
+typedef struct
+{
+	int offset;
+	image_anim_rect rect;
+	int delay_ms;
+	unsigned char dispose;
+	unsigned char blend;
+	/*	GIF: the palette index that is see-through, or -1	*/
+	short transparent;
+}
+image_anim_frame;
+
+/**
+	An open animation.  canvas is width x height RGBA, and shows
+	frame current (-1 before the first one is asked for).
+**/
+typedef struct
+{
+	const unsigned char *buffer;
+	int buffer_length;
+	int is_gif;
+	int width, height;
+	int num_frames;
+	/*	how many times to play it, 0 for forever	*/
+	int loop_count;
+	image_anim_frame *frames;
+	unsigned char *canvas;
+	int current;
+	/*	what a DISPOSE_PREVIOUS frame covered up	*/
+	unsigned char *restore;
+	/*	the decoded frame cache	*/
+	size_t cache_budget;
+	size_t cache_used;
+	void *cache;
+	int cache_count;
+	unsigned int cache_clock;
+	/*	statistics: frames decoded, and frames found in the cache	*/
+	int frames_decoded;
+	int cache_hits;
+	const char *error;
+}
+image_anim;
+
+/**
+	Opens an animated (or plain) GIF or PNG file in RAM.  The buffer is
+	not copied: it must stay there until the animation is freed.
+	\return 1 if it worked, otherwise returns 0 (and anim->error says why)
+**/
+int
+	image_anim_open_memory
+	(
+		image_anim *anim,
+		const unsigned char *buffer,
+		int buffer_length
+	);
+
+/**
+	Lets go of the canvas and the cache (not the buffer).
+**/
+void
+	image_anim_free
+	(
+		image_anim *anim
+	);
+
+/**
+	Sets how many bytes of decoded frames may be kept (0, the default,
+	for none).  Frames are dropped, least recently used first, to fit.
+	A frame takes width * height * 4 bytes.
+**/
+void
+	image_anim_set_cache
+	(
+		image_anim *anim,
+		size_t budget_bytes
+	);
+
+/**
+	Makes the canvas show a frame.  Going on to the next frame only
+	decodes that frame; any other jump starts from the nearest cached
+	frame before it (or from the first frame).
+	\param frame which frame, 0 to num_frames-1
+	\param dirty receives the area of the canvas that changed (the whole
+		canvas after a jump, nothing if it already showed that frame),
+		may be NULL
+	\return 1 if it worked, otherwise returns 0 (the file is damaged)
+**/
+int
+	image_anim_seek
+	(
+		image_anim *anim,
+		int frame,
+		image_anim_rect *dirty
+	);
+
+/**
+	Makes the canvas show the next frame, going back to the first one
+	after the last.
+	\return the frame now shown, or -1 if it failed
+**/
+int
+	image_anim_next
+	(
+		image_anim *anim,
+		image_anim_rect *dirty
+	);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HEADER_IMAGE_ANIM	*/
@@ -0,0 +1,285 @@
+/*
+	Texture atlas packing
+
+	Public Domain
+*/
+
+#include "image_atlas.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*	one horizontal segment of the top edge of what has been packed	*/
+typedef struct
+{
+	int x, y, width;
+}
+skyline_node;
+
+/*	a page: its skyline, left to right, covering the whole width	*/
+typedef struct
+{
+	skyline_node *nodes;
+	int num_nodes;
+}
+skyline_page;
+
+typedef struct
+{
+	int width, height;
+	int index;
+}
+pack_order;
+
+/*	the order to pack the images in: tallest first, then widest	*/
+static int compare_size( const void *a, const void *b )
+{
+	const pack_order *i = (const pack_order*)a, *j = (const pack_order*)b;
+	if( i->height != j->height )
+	{
+		return j->height - i->height;
+	}
+	if( i->width != j->width )
+	{
+		return j->width - i->width;
+	}
+	return i->index - j->index;
+}
+
+/*	how low a width x height slot can go, starting at node index
+	(-1 if it doesn't fit there)	*/
+static int fit( const skyline_page *page, int index,
+		int width, int height, int page_width, int page_height )
+{
+	int x = page->nodes[index].x, y = 0, left = width;
+	if( x + width > page_width )
+	{
+		return -1;
+	}
+	while( left > 0 )
+	{
+		if( page->nodes[index].y > y )
+		{
+			y = page->nodes[index].y;
+		}
+		if( y + height > page_height )
+		{
+			return -1;
+		}
+		left -= page->nodes[index].width;
+		++index;
+	}
+	return y;
+}
+
+/*	raise the skyline over a slot just placed at node index	*/
+static int place( skyline_page *page, int index,
+		int x, int y, int width )
+{
+	int i;
+	skyline_node *grown = (skyline_node*)realloc(
+			page->nodes, (page->num_nodes + 1) * sizeof( skyline_node ) );
+	if( NULL == grown )
+	{
+		return 0;
+	}
+	page->nodes = grown;
+	memmove( &page->nodes[index+1], &page->nodes[index],
+			(page->num_nodes - index) * sizeof( skyline_node ) );
+	++page->num_nodes;
+	page->nodes[index].x = x;
+	page->nodes[index].y = y;
+	page->nodes[index].width = width;
+	/*	the nodes underneath are now (partly) covered	*/
+	i = index + 1;
+	while( i < page->num_nodes )
+	{
+		int covered = x + width - page->nodes[i].x;
+		if( covered <= 0 )
+		{
+			break;
+		}
+		if( covered < page->nodes[i].width )
+		{
+			page->nodes[i].x += covered;
+			page->nodes[i].width -= covered;
+			break;
+		}
+		memmove( &page->nodes[i], &page->nodes[i+1],
+				(page->num_nodes - i - 1) * sizeof( skyline_node ) );
+		--page->num_nodes;
+	}
+	/*	merge neighbours at the same height	*/
+	for( i = 0; i + 1 < page->num_nodes; )
+	{
+		if( page->nodes[i].y == page->nodes[i+1].y )
+		{
+			page->nodes[i].width += page->nodes[i+1].width;
+			memmove( &page->nodes[i+1], &page->nodes[i+2],
+					(page->num_nodes - i - 2) * sizeof( skyline_node ) );
+			--page->num_nodes;
+		} else
+		{
+			++i;
+		}
+	}
+	return 1;
+}
+
+static int new_page( skyline_page **pages, int *num_pages, int page_width )
+{
+	skyline_page *grown = (skyline_page*)realloc(
+			*pages, (*num_pages + 1) * sizeof( skyline_page ) );
+	skyline_page *page;
+	if( NULL == grown )
+	{
+		return 0;
+	}
+	*pages = grown;
+	page = &grown[*num_pages];
+	page->nodes = (skyline_node*)malloc( sizeof( skyline_node ) );
+	if( NULL == page->nodes )
+	{
+		return 0;
+	}
+	page->nodes[0].x = 0;
+	page->nodes[0].y = 0;
+	page->nodes[0].width = page_width;
+	page->num_nodes = 1;
+	++*num_pages;
+	return 1;
+}
+
+int
+	image_atlas_pack
+	(
+		const int *widths, const int *heights,
+		int count,
+		int page_width, int page_height,
+		int padding, int alignment,
+		image_atlas_rect *rects
+	)
+{
+	skyline_page *pages = NULL;
+	int num_pages = 0, failed = 0;
+	pack_order *order;
+	int i, p;
+	if( count < 1 )
+	{
+		return 0;
+	}
+	if( alignment < 1 )
+	{
+		alignment = 1;
+	}
+	order = (pack_order*)malloc( count * sizeof( pack_order ) );
+	if( NULL == order )
+	{
+		return -1;
+	}
+	for( i = 0; i < count; ++i )
+	{
+		order[i].width = widths[i];
+		order[i].height = heights[i];
+		order[i].index = i;
+	}
+	qsort( order, count, sizeof( pack_order ), compare_size );
+	for( i = 0; (i < count) && !failed; ++i )
+	{
+		int index = order[i].index;
+		image_atlas_rect *rect = &rects[index];
+		/*	the slot this image takes up, padding and all	*/
+		int width = ((widths[index] + 2*padding + alignment - 1) / alignment) * alignment;
+		int height = ((heights[index] + 2*padding + alignment - 1) / alignment) * alignment;
+		int best_page = -1, best_node = 0, best_y = 0;
+		rect->page = -1;
+		rect->x = rect->y = 0;
+		rect->width = widths[index];
+		rect->height = heights[index];
+		if( (widths[index] < 1) || (heights[index] < 1) ||
+			(width > page_width) || (height > page_height) )
+		{
+			/*	this will never fit	*/
+			continue;
+		}
+		/*	the first page it fits on, as low as it will go	*/
+		for( p = 0; (p < num_pages) && (best_page < 0); ++p )
+		{
+			int n;
+			for( n = 0; n < pages[p].num_nodes; ++n )
+			{
+				int y = fit( &pages[p], n, width, height, page_width, page_height );
+				if( (y >= 0) &&
+					((best_page < 0) || (y < best_y) ||
+					((y == best_y) && (pages[p].nodes[n].x < pages[p].nodes[best_node].x))) )
+				{
+					best_page = p;
+					best_node = n;
+					best_y = y;
+				}
+			}
+		}
+		if( best_page < 0 )
+		{
+			/*	start a new page	*/
+			if( !new_page( &pages, &num_pages, page_width ) )
+			{
+				failed = 1;
+				break;
+			}
+			best_page = num_pages - 1;
+			best_node = 0;
+			best_y = 0;
+		}
+		rect->page = best_page;
+		rect->x = pages[best_page].nodes[best_node].x + padding;
+		rect->y = best_y + padding;
+		if( !place( &pages[best_page], best_node,
+				pages[best_page].nodes[best_node].x, best_y + height, width ) )
+		{
+			failed = 1;
+		}
+	}
+	for( p = 0; p < num_pages; ++p )
+	{
+		free( pages[p].nodes );
+	}
+	free( pages );
+	free( order );
+	return failed ? -1 : num_pages;
+}
+
+void
+	image_atlas_blit
+	(
+		unsigned char *page,
+		int page_width, int page_height, int channels,
+		const image_atlas_rect *rect,
+		int padding,
+		const unsigned char *img
+	)
+{
+	int y;
+	const int row_bytes = rect->width * channels;
+	if( (rect->page < 0) || (rect->x < padding) || (rect->y < padding) ||
+		(rect->x + rect->width + padding > page_width) ||
+		(rect->y + rect->height + padding > page_height) )
+	{
+		return;
+	}
+	for( y = -padding; y < rect->height + padding; ++y )
+	{
+		/*	the rows above and below repeat the top and bottom rows	*/
+		int src_y = (y < 0) ? 0 : ((y >= rect->height) ? rect->height - 1 : y);
+		const unsigned char *src = &img[src_y * row_bytes];
+		unsigned char *dst = &page[((rect->y + y) * page_width + rect->x) * channels];
+		int x;
+		memcpy( dst, src, row_bytes );
+		/*	and the columns to the left and right the edge texels	*/
+		for( x = 1; x <= padding; ++x )
+		{
+			memcpy( dst - x * channels, src, channels );
+			memcpy( dst + row_bytes + (x - 1) * channels,
+					src + row_bytes - channels, channels );
+		}
+	}
+}
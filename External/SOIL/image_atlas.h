@@ -0,0 +1,79 @@
+/*
+	Texture atlas packing
+
+	Packs many small images into a few large pages, so they can be
+	drawn from one texture instead of one texture each.  The packer is
+	a skyline bottom-left packer: the images are placed tallest first,
+	each one as low as it will go, on the first page it fits on.
+
+	Every image gets padding texels on all sides, filled by repeating
+	its edge texels (bleeding), so filtering and the smaller MIPmaps
+	do not pick up the neighbouring images.
+
+	There are no OpenGL calls in here.
+
+	Public Domain
+*/
+
+#ifndef HEADER_IMAGE_ATLAS
+#define HEADER_IMAGE_ATLAS
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+	Where one image went: the page, and the top left corner of the
+	image itself (not counting the padding), in texels.
+	page is -1 for images that are too large for a page.
+**/
+typedef struct
+{
+	int page;
+	int x, y;
+	int width, height;
+}
+image_atlas_rect;
+
+/**
+	Decides where every image goes.
+	\param widths, heights the size of each image
+	\param count the number of images
+	\param page_width, page_height the size of a page
+	\param padding the number of texels to leave around each image
+	\param alignment every image (with its padding) takes up a multiple of
+		this many texels each way, e.g. 4 so no DXT block is shared by two
+		images (use 1 for none)
+	\param rects receives count rectangles
+	\return the number of pages needed, or -1 if out of RAM
+**/
+int
+	image_atlas_pack
+	(
+		const int *widths, const int *heights,
+		int count,
+		int page_width, int page_height,
+		int padding, int alignment,
+		image_atlas_rect *rects
+	);
+
+/**
+	Copies one image into its place on a page, and fills in the
+	padding around it with its edge texels.
+	The image and the page have the same number of channels.
+**/
+void
+	image_atlas_blit
+	(
+		unsigned char *page,
+		int page_width, int page_height, int channels,
+		const image_atlas_rect *rect,
+		int padding,
+		const unsigned char *img
+	);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HEADER_IMAGE_ATLAS	*/
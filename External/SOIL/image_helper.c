@@ -89,6 +89,21 @@ int
 		unsigned char* resampled,
 		int block_size_x, int block_size_y
 	)
+{
+	return mipmap_image_strided(
+			orig, width, height, channels, width*channels,
+			resampled, block_size_x, block_size_y );
+}
+
+int
+	mipmap_image_strided
+	(
+		const unsigned char* const orig,
+		int width, int height, int channels,
+		int row_stride,
+		unsigned char* resampled,
+		int block_size_x, int block_size_y
+	)
 {
 	int mip_width, mip_height;
 	int i, j, c;
@@ -118,7 +133,7 @@ int
 		{
 			for( c = 0; c < channels; ++c )
 			{
-				const int index = (j*block_size_y)*width*channels + (i*block_size_x)*channels + c;
+				const int index = (j*block_size_y)*row_stride + (i*block_size_x)*channels + c;
 				int sum_value;
 				int u,v;
 				int u_block = block_size_x;
@@ -142,7 +157,7 @@ int
 				for( v = 0; v < v_block; ++v )
 				for( u = 0; u < u_block; ++u )
 				{
-					sum_value += orig[index + v*width*channels + u*channels];
+					sum_value += orig[index + v*row_stride + u*channels];
 				}
 				resampled[j*mip_width*channels + i*channels + c] = sum_value / block_area;
 			}
@@ -43,6 +43,21 @@ int
 		int block_size_x, int block_size_y
 	);
 
+/**
+	The same as mipmap_image, but the rows of the incoming
+	image are row_stride bytes apart (e.g. one face of a
+	cubemap strip, without copying it out first).
+**/
+int
+	mipmap_image_strided
+	(
+		const unsigned char* const orig,
+		int width, int height, int channels,
+		int row_stride,
+		unsigned char* resampled,
+		int block_size_x, int block_size_y
+	);
+
 /**
 	This function takes the RGB components of the image
 	and scales each channel from [0,255] to [16,235].
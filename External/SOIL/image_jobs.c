@@ -0,0 +1,296 @@
+/*
+	Image jobs
+
+	Public Domain
+*/
+
+#ifdef WIN32
+	#define WIN32_LEAN_AND_MEAN
+	#include <windows.h>
+	typedef HANDLE image_job_thread;
+	typedef CRITICAL_SECTION image_job_mutex;
+	typedef CONDITION_VARIABLE image_job_condition;
+	#define IMAGE_JOBS_THREAD_LOCAL __declspec(thread)
+#else
+	#include <pthread.h>
+	#include <unistd.h>
+	typedef pthread_t image_job_thread;
+	typedef pthread_mutex_t image_job_mutex;
+	typedef pthread_cond_t image_job_condition;
+	#define IMAGE_JOBS_THREAD_LOCAL __thread
+#endif
+
+#include "image_jobs.h"
+#include <stdlib.h>
+#include <string.h>
+
+struct image_job_batch
+{
+	image_job_function job;
+	void *user_data;
+	int count;
+	/*	the next job nobody has claimed yet	*/
+	int next_job;
+	/*	which jobs are done, and in what order they finished	*/
+	unsigned char *done;
+	int *completed;
+	int num_done;
+	int num_returned;
+	image_job_thread *threads;
+	int num_threads;
+	image_job_mutex mutex;
+	image_job_condition job_done;
+};
+
+/*	set on the worker threads, so nested batches run serially	*/
+static IMAGE_JOBS_THREAD_LOCAL int image_jobs_inside_job = 0;
+
+#ifdef WIN32
+static void lock( image_job_mutex *m )		{ EnterCriticalSection( m ); }
+static void unlock( image_job_mutex *m )	{ LeaveCriticalSection( m ); }
+static void wait_for( image_job_condition *c, image_job_mutex *m )
+{
+	SleepConditionVariableCS( c, m, INFINITE );
+}
+static void wake_all( image_job_condition *c )	{ WakeAllConditionVariable( c ); }
+#else
+static void lock( image_job_mutex *m )		{ pthread_mutex_lock( m ); }
+static void unlock( image_job_mutex *m )	{ pthread_mutex_unlock( m ); }
+static void wait_for( image_job_condition *c, image_job_mutex *m )
+{
+	pthread_cond_wait( c, m );
+}
+static void wake_all( image_job_condition *c )	{ pthread_cond_broadcast( c ); }
+#endif
+
+/*	claim jobs until there are none left	*/
+static void run_jobs( image_job_batch *batch )
+{
+	lock( &batch->mutex );
+	while( batch->next_job < batch->count )
+	{
+		int job_index = batch->next_job++;
+		unlock( &batch->mutex );
+		batch->job( batch->user_data, job_index );
+		lock( &batch->mutex );
+		batch->done[job_index] = 1;
+		batch->completed[batch->num_done++] = job_index;
+		wake_all( &batch->job_done );
+	}
+	unlock( &batch->mutex );
+}
+
+#ifdef WIN32
+static DWORD WINAPI worker( LPVOID parameter )
+{
+	image_jobs_inside_job = 1;
+	run_jobs( (image_job_batch*)parameter );
+	return 0;
+}
+#else
+static void* worker( void *parameter )
+{
+	image_jobs_inside_job = 1;
+	run_jobs( (image_job_batch*)parameter );
+	return NULL;
+}
+#endif
+
+int
+	image_jobs_num_cores
+	(
+		void
+	)
+{
+	int cores;
+#ifdef WIN32
+	SYSTEM_INFO info;
+	GetSystemInfo( &info );
+	cores = (int)info.dwNumberOfProcessors;
+#else
+	cores = (int)sysconf( _SC_NPROCESSORS_ONLN );
+#endif
+	if( cores < 1 )
+	{
+		cores = 1;
+	}
+	return cores;
+}
+
+image_job_batch*
+	image_jobs_start
+	(
+		image_job_function job,
+		void *user_data,
+		int count,
+		int num_threads
+	)
+{
+	image_job_batch *batch;
+	int i;
+	if( count < 0 )
+	{
+		count = 0;
+	}
+	batch = (image_job_batch*)malloc( sizeof( image_job_batch ) );
+	if( NULL == batch )
+	{
+		return NULL;
+	}
+	memset( batch, 0, sizeof( image_job_batch ) );
+	batch->job = job;
+	batch->user_data = user_data;
+	batch->count = count;
+	batch->done = (unsigned char*)malloc( count + 1 );
+	batch->completed = (int*)malloc( (count + 1) * sizeof( int ) );
+	if( num_threads < 1 )
+	{
+		num_threads = image_jobs_num_cores();
+	}
+	if( num_threads > count )
+	{
+		num_threads = count;
+	}
+	if( image_jobs_inside_job )
+	{
+		/*	no threads inside of threads	*/
+		num_threads = 0;
+	}
+	batch->threads = (image_job_thread*)malloc( (num_threads + 1) * sizeof( image_job_thread ) );
+	if( (NULL == batch->done) || (NULL == batch->completed) || (NULL == batch->threads) )
+	{
+		free( batch->done );
+		free( batch->completed );
+		free( batch->threads );
+		free( batch );
+		return NULL;
+	}
+	memset( batch->done, 0, count + 1 );
+#ifdef WIN32
+	InitializeCriticalSection( &batch->mutex );
+	InitializeConditionVariable( &batch->job_done );
+#else
+	pthread_mutex_init( &batch->mutex, NULL );
+	pthread_cond_init( &batch->job_done, NULL );
+#endif
+	/*	start the workers	*/
+	for( i = 0; i < num_threads; ++i )
+	{
+#ifdef WIN32
+		batch->threads[batch->num_threads] = CreateThread( NULL, 0, worker, batch, 0, NULL );
+		if( NULL == batch->threads[batch->num_threads] )
+		{
+			break;
+		}
+#else
+		if( 0 != pthread_create( &batch->threads[batch->num_threads], NULL, worker, batch ) )
+		{
+			break;
+		}
+#endif
+		++batch->num_threads;
+	}
+	if( batch->num_threads == 0 )
+	{
+		/*	no threads (or not allowed any), so do the work right now	*/
+		run_jobs( batch );
+	}
+	return batch;
+}
+
+void
+	image_jobs_wait
+	(
+		image_job_batch *batch,
+		int job_index
+	)
+{
+	if( (NULL == batch) || (job_index < 0) || (job_index >= batch->count) )
+	{
+		return;
+	}
+	lock( &batch->mutex );
+	while( !batch->done[job_index] )
+	{
+		wait_for( &batch->job_done, &batch->mutex );
+	}
+	unlock( &batch->mutex );
+}
+
+int
+	image_jobs_wait_any
+	(
+		image_job_batch *batch
+	)
+{
+	int job_index = -1;
+	if( NULL == batch )
+	{
+		return -1;
+	}
+	lock( &batch->mutex );
+	if( batch->num_returned < batch->count )
+	{
+		while( batch->num_returned >= batch->num_done )
+		{
+			wait_for( &batch->job_done, &batch->mutex );
+		}
+		job_index = batch->completed[batch->num_returned++];
+	}
+	unlock( &batch->mutex );
+	return job_index;
+}
+
+void
+	image_jobs_finish
+	(
+		image_job_batch *batch
+	)
+{
+	int i;
+	if( NULL == batch )
+	{
+		return;
+	}
+	for( i = 0; i < batch->num_threads; ++i )
+	{
+#ifdef WIN32
+		WaitForSingleObject( batch->threads[i], INFINITE );
+		CloseHandle( batch->threads[i] );
+#else
+		pthread_join( batch->threads[i], NULL );
+#endif
+	}
+#ifdef WIN32
+	DeleteCriticalSection( &batch->mutex );
+#else
+	pthread_mutex_destroy( &batch->mutex );
+	pthread_cond_destroy( &batch->job_done );
+#endif
+	free( batch->done );
+	free( batch->completed );
+	free( batch->threads );
+	free( batch );
+}
+
+void
+	image_jobs_run
+	(
+		image_job_function job,
+		void *user_data,
+		int count
+	)
+{
+	image_job_batch *batch = image_jobs_start( job, user_data, count, 0 );
+	if( NULL == batch )
+	{
+		/*	out of RAM, do it the slow way	*/
+		int i;
+		for( i = 0; i < count; ++i )
+		{
+			job( user_data, i );
+		}
+		return;
+	}
+	image_jobs_finish( batch );
+}
@@ -0,0 +1,99 @@
+/*
+	Image jobs
+
+	A small pool of worker threads for running independent image
+	jobs (file reads, decoding, resampling, compression) in parallel.
+	Each batch starts one worker per core; the workers take the next
+	unclaimed job index from a shared counter until all are taken, so
+	a slow job never holds up the others.  The caller can wait for the
+	jobs in submission order or in completion order.
+
+	Public Domain
+*/
+
+#ifndef HEADER_IMAGE_JOBS
+#define HEADER_IMAGE_JOBS
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+	The work to be done, called once for every job_index in [0,count).
+**/
+typedef void (*image_job_function)( void *user_data, int job_index );
+
+typedef struct image_job_batch image_job_batch;
+
+/**
+	\return the number of cores in this machine (at least 1)
+**/
+int
+	image_jobs_num_cores
+	(
+		void
+	);
+
+/**
+	Starts running count jobs on num_threads worker threads.
+	num_threads = 0 uses one thread per core (never more threads than jobs).
+	When called from inside a job, or if no threads can be created,
+	the jobs are run right here, before returning.
+	\return the batch, or NULL if out of RAM (nothing was run)
+**/
+image_job_batch*
+	image_jobs_start
+	(
+		image_job_function job,
+		void *user_data,
+		int count,
+		int num_threads
+	);
+
+/**
+	Waits until the job job_index is done (submission order).
+**/
+void
+	image_jobs_wait
+	(
+		image_job_batch *batch,
+		int job_index
+	);
+
+/**
+	Waits until some job is done that has not been returned yet
+	(completion order).
+	\return the index of that job, -1 once every job has been returned
+**/
+int
+	image_jobs_wait_any
+	(
+		image_job_batch *batch
+	);
+
+/**
+	Waits for all the jobs, stops the threads and frees the batch.
+**/
+void
+	image_jobs_finish
+	(
+		image_job_batch *batch
+	);
+
+/**
+	Runs count jobs in parallel and waits for all of them.
+	Nested calls (from inside a job) run serially.
+**/
+void
+	image_jobs_run
+	(
+		image_job_function job,
+		void *user_data,
+		int count
+	);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HEADER_IMAGE_JOBS	*/
@@ -114,8 +114,15 @@ typedef unsigned char validate_uint32[sizeof(uint32)==4];
 // Generic API that works on all image types
 //
 
-// this is not threadsafe
-static char *failure_reason;
+// one per thread, SOIL decodes on worker threads
+#ifndef STBI_THREAD_LOCAL
+   #ifdef WIN32
+      #define STBI_THREAD_LOCAL __declspec(thread)
+   #else
+      #define STBI_THREAD_LOCAL __thread
+   #endif
+#endif
+static STBI_THREAD_LOCAL char *failure_reason;
 
 char *stbi_failure_reason(void)
 {
@@ -0,0 +1,709 @@
+/*
+	Texture packages
+
+	Opening (mapping) and searching packages, and writing them.
+
+	Public Domain
+*/
+
+#include "texture_package.h"
+#include "image_DXT.h"
+#include "image_KTX2.h"
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef WIN32
+	#define WIN32_LEAN_AND_MEAN
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <unistd.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+#endif
+
+static const unsigned char package_identifier[8] =
+{
+	'S', 'O', 'I', 'L', 'P', 'A', 'K', '1'
+};
+
+#define PACKAGE_HEADER_SIZE	64
+#define PACKAGE_ENTRY_SIZE	48
+#define PACKAGE_LEVEL_SIZE	8
+#define PACKAGE_MAX_LEVELS	32
+
+/*	one entry of a package being written	*/
+typedef struct
+{
+	unsigned long long hash;
+	unsigned long long offset;
+	unsigned long long size;
+	int format;
+	int width, height;
+	int num_levels;
+	unsigned int level_offset[PACKAGE_MAX_LEVELS];
+	unsigned int level_size[PACKAGE_MAX_LEVELS];
+	char *name;
+}
+package_writer_entry;
+
+static unsigned int read_u32( const unsigned char *p )
+{
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned int)p[3] << 24);
+}
+
+static unsigned long long read_u64( const unsigned char *p )
+{
+	return read_u32( p ) | ((unsigned long long)read_u32( p + 4 ) << 32);
+}
+
+static void put_u32( unsigned char *p, unsigned int value )
+{
+	p[0] = (unsigned char)(value);
+	p[1] = (unsigned char)(value >> 8);
+	p[2] = (unsigned char)(value >> 16);
+	p[3] = (unsigned char)(value >> 24);
+}
+
+static void put_u64( unsigned char *p, unsigned long long value )
+{
+	put_u32( p, (unsigned int)value );
+	put_u32( p + 4, (unsigned int)(value >> 32) );
+}
+
+unsigned long long
+	texture_package_hash
+	(
+		const char *name
+	)
+{
+	unsigned long long hash = 14695981039346656037ULL;
+	for( ; *name; ++name )
+	{
+		hash ^= (unsigned char)((*name == '\\') ? '/' : *name);
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+/*	the same names as far as the index is concerned	*/
+static int package_name_compare( const char *a, const char *b )
+{
+	for( ; ; ++a, ++b )
+	{
+		const unsigned char ca = (unsigned char)((*a == '\\') ? '/' : *a);
+		const unsigned char cb = (unsigned char)((*b == '\\') ? '/' : *b);
+		if( (ca != cb) || (ca == 0) )
+		{
+			return (int)ca - (int)cb;
+		}
+	}
+}
+
+/*	reading	*/
+
+int
+	texture_package_open_memory
+	(
+		texture_package *package,
+		const unsigned char *buffer,
+		size_t buffer_length
+	)
+{
+	unsigned long long index_offset, index_size;
+	int i;
+	if( NULL == package )
+	{
+		return 0;
+	}
+	memset( package, 0, sizeof( texture_package ) );
+	if( (NULL == buffer) || (buffer_length < PACKAGE_HEADER_SIZE) ||
+		(0 != memcmp( buffer, package_identifier, sizeof( package_identifier ) )) ||
+		(read_u32( &buffer[8] ) != TEXTURE_PACKAGE_VERSION) )
+	{
+		return 0;
+	}
+	index_offset = read_u64( &buffer[24] );
+	index_size = read_u64( &buffer[32] );
+	if( (index_offset > buffer_length) || (index_size > buffer_length - index_offset) ||
+		(read_u32( &buffer[16] ) > index_size / PACKAGE_ENTRY_SIZE) )
+	{
+		return 0;
+	}
+	package->data = buffer;
+	package->size = buffer_length;
+	package->num_entries = (int)read_u32( &buffer[16] );
+	package->index = &buffer[index_offset];
+	package->index_size = (size_t)index_size;
+	/*	check every entry once, so finding them needs no checks	*/
+	for( i = 0; i < package->num_entries; ++i )
+	{
+		const unsigned char *e = &package->index[i * PACKAGE_ENTRY_SIZE];
+		const unsigned long long offset = read_u64( &e[8] );
+		const unsigned long long size = read_u64( &e[16] );
+		const unsigned int num_levels = read_u32( &e[36] );
+		const unsigned int mip_table = read_u32( &e[40] );
+		const unsigned int name = read_u32( &e[44] );
+		unsigned int level;
+		if( (offset > buffer_length) || (size > buffer_length - offset) ||
+			(num_levels > PACKAGE_MAX_LEVELS) ||
+			(mip_table > index_size) ||
+			(num_levels * PACKAGE_LEVEL_SIZE > index_size - mip_table) ||
+			(name >= index_size) ||
+			(NULL == memchr( &package->index[name], 0, (size_t)(index_size - name) )) ||
+			((i > 0) && (read_u64( e ) < read_u64( e - PACKAGE_ENTRY_SIZE ))) )
+		{
+			memset( package, 0, sizeof( texture_package ) );
+			return 0;
+		}
+		for( level = 0; level < num_levels; ++level )
+		{
+			const unsigned char *l = &package->index[mip_table + level * PACKAGE_LEVEL_SIZE];
+			if( (read_u32( &l[0] ) > size) || (read_u32( &l[4] ) > size - read_u32( &l[0] )) )
+			{
+				memset( package, 0, sizeof( texture_package ) );
+				return 0;
+			}
+		}
+	}
+	return 1;
+}
+
+int
+	texture_package_open
+	(
+		texture_package *package,
+		const char *filename
+	)
+{
+	unsigned char *buffer = NULL;
+	size_t length = 0;
+	int mapped = 0;
+	if( (NULL == package) || (NULL == filename) )
+	{
+		return 0;
+	}
+	memset( package, 0, sizeof( texture_package ) );
+	/*	map the file if we can	*/
+#ifdef WIN32
+	{
+		HANDLE file = CreateFileA( filename, GENERIC_READ, FILE_SHARE_READ, NULL,
+				OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL );
+		if( file != INVALID_HANDLE_VALUE )
+		{
+			LARGE_INTEGER file_size;
+			if( GetFileSizeEx( file, &file_size ) && (file_size.QuadPart > 0) &&
+				((unsigned long long)file_size.QuadPart <= (size_t)-1) )
+			{
+				/*	the view keeps the mapping alive	*/
+				HANDLE mapping = CreateFileMappingA( file, NULL, PAGE_READONLY, 0, 0, NULL );
+				if( mapping )
+				{
+					buffer = (unsigned char*)MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, 0 );
+					length = (size_t)file_size.QuadPart;
+					mapped = (NULL != buffer);
+					CloseHandle( mapping );
+				}
+			}
+			CloseHandle( file );
+		}
+	}
+#else
+	{
+		int fd = open( filename, O_RDONLY );
+		if( fd >= 0 )
+		{
+			struct stat file_stat;
+			if( (0 == fstat( fd, &file_stat )) && (file_stat.st_size > 0) )
+			{
+				void *view = mmap( NULL, (size_t)file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+				if( view != MAP_FAILED )
+				{
+					buffer = (unsigned char*)view;
+					length = (size_t)file_stat.st_size;
+					mapped = 1;
+				}
+			}
+			close( fd );
+		}
+	}
+#endif
+	/*	otherwise read it all	*/
+	if( !mapped )
+	{
+		FILE *f = fopen( filename, "rb" );
+		long file_length;
+		if( NULL == f )
+		{
+			return 0;
+		}
+		fseek( f, 0, SEEK_END );
+		file_length = ftell( f );
+		fseek( f, 0, SEEK_SET );
+		buffer = (file_length > 0) ? (unsigned char*)malloc( file_length ) : NULL;
+		if( buffer && (fread( buffer, 1, file_length, f ) != (size_t)file_length) )
+		{
+			free( buffer );
+			buffer = NULL;
+		}
+		fclose( f );
+		length = (size_t)file_length;
+	}
+	if( NULL == buffer )
+	{
+		return 0;
+	}
+	if( !texture_package_open_memory( package, buffer, length ) )
+	{
+		package->data = buffer;
+		package->size = length;
+		package->mapped = mapped;
+		texture_package_close( package );
+		return 0;
+	}
+	package->mapped = mapped;
+	return 1;
+}
+
+void
+	texture_package_close
+	(
+		texture_package *package
+	)
+{
+	if( (NULL == package) || (NULL == package->data) )
+	{
+		return;
+	}
+	if( package->mapped )
+	{
+#ifdef WIN32
+		UnmapViewOfFile( package->data );
+#else
+		munmap( (void*)package->data, package->size );
+#endif
+	} else
+	{
+		free( (void*)package->data );
+	}
+	memset( package, 0, sizeof( texture_package ) );
+}
+
+int
+	texture_package_entry_at
+	(
+		const texture_package *package,
+		int index,
+		texture_package_entry *entry
+	)
+{
+	const unsigned char *e;
+	if( (NULL == package) || (NULL == entry) ||
+		(index < 0) || (index >= package->num_entries) )
+	{
+		return 0;
+	}
+	e = &package->index[index * PACKAGE_ENTRY_SIZE];
+	entry->data = &package->data[read_u64( &e[8] )];
+	entry->size = (size_t)read_u64( &e[16] );
+	entry->format = (int)read_u32( &e[24] );
+	entry->width = (int)read_u32( &e[28] );
+	entry->height = (int)read_u32( &e[32] );
+	entry->num_levels = (int)read_u32( &e[36] );
+	entry->mip_table = &package->index[read_u32( &e[40] )];
+	entry->name = (const char*)&package->index[read_u32( &e[44] )];
+	return 1;
+}
+
+int
+	texture_package_find
+	(
+		const texture_package *package,
+		const char *name,
+		texture_package_entry *entry
+	)
+{
+	unsigned long long hash;
+	int low, high;
+	if( (NULL == package) || (NULL == name) || (NULL == entry) )
+	{
+		return 0;
+	}
+	hash = texture_package_hash( name );
+	/*	the first entry with this hash	*/
+	low = 0;
+	high = package->num_entries;
+	while( low < high )
+	{
+		const int middle = low + (high - low) / 2;
+		if( read_u64( &package->index[middle * PACKAGE_ENTRY_SIZE] ) < hash )
+		{
+			low = middle + 1;
+		} else
+		{
+			high = middle;
+		}
+	}
+	/*	then the one with this name	*/
+	for( ; (low < package->num_entries) &&
+			(read_u64( &package->index[low * PACKAGE_ENTRY_SIZE] ) == hash); ++low )
+	{
+		if( texture_package_entry_at( package, low, entry ) &&
+			(0 == package_name_compare( entry->name, name )) )
+		{
+			return 1;
+		}
+	}
+	return 0;
+}
+
+const unsigned char*
+	texture_package_level
+	(
+		const texture_package_entry *entry,
+		int level,
+		size_t *size
+	)
+{
+	const unsigned char *l;
+	if( (NULL == entry) || (level < 0) || (level >= entry->num_levels) )
+	{
+		return NULL;
+	}
+	l = &entry->mip_table[level * PACKAGE_LEVEL_SIZE];
+	if( size )
+	{
+		*size = read_u32( &l[4] );
+	}
+	return &entry->data[read_u32( &l[0] )];
+}
+
+/*	writing	*/
+
+/*	the bytes in one 4x4 block of a compressed DDS, 0 if it isn't one SOIL knows	*/
+static int DDS_block_size( const DDS_header *header, const unsigned char *DX10 )
+{
+	const unsigned int four_CC = header->sPixelFormat.dwFourCC;
+	if( four_CC == (('D' << 0) | ('X' << 8) | ('1' << 16) | ('0' << 24)) )
+	{
+		const unsigned int format = read_u32( &DX10[0] );
+		/*	plain 2D textures only	*/
+		if( (read_u32( &DX10[4] ) != DDS_DIMENSION_TEXTURE2D) ||
+			(read_u32( &DX10[8] ) & 4) || (read_u32( &DX10[12] ) > 1) )
+		{
+			return 0;
+		}
+		if( ((format >= 70) && (format <= 72)) || ((format >= 79) && (format <= 81)) )
+		{
+			return 8;
+		}
+		if( ((format >= 73) && (format <= 78)) || ((format >= 82) && (format <= 84)) ||
+			((format >= 94) && (format <= 99)) )
+		{
+			return 16;
+		}
+		return 0;
+	}
+	if( (four_CC == (('D' << 0) | ('X' << 8) | ('T' << 16) | ('1' << 24))) ||
+		(four_CC == (('A' << 0) | ('T' << 8) | ('I' << 16) | ('1' << 24))) ||
+		(four_CC == (('B' << 0) | ('C' << 8) | ('4' << 16) | ('U' << 24))) )
+	{
+		return 8;
+	}
+	if( (four_CC == (('D' << 0) | ('X' << 8) | ('T' << 16) | ('3' << 24))) ||
+		(four_CC == (('D' << 0) | ('X' << 8) | ('T' << 16) | ('5' << 24))) ||
+		(four_CC == (('A' << 0) | ('T' << 8) | ('I' << 16) | ('2' << 24))) ||
+		(four_CC == (('B' << 0) | ('C' << 8) | ('5' << 16) | ('U' << 24))) )
+	{
+		return 16;
+	}
+	return 0;
+}
+
+/*	fills in the size, format and MIP table of an entry	*/
+static void describe_entry( package_writer_entry *entry, const unsigned char *data, size_t size )
+{
+	KTX2_header KTX2;
+	entry->format = TEXTURE_PACKAGE_IMAGE;
+	entry->width = entry->height = 0;
+	entry->num_levels = 0;
+	if( (size >= sizeof( DDS_header )) && (0 == memcmp( data, "DDS ", 4 )) )
+	{
+		DDS_header header;
+		size_t offset = sizeof( DDS_header );
+		int block_size = 0, pixel_size = 0, levels, i;
+		memcpy( &header, data, sizeof( DDS_header ) );
+		entry->format = TEXTURE_PACKAGE_DDS;
+		entry->width = header.dwWidth;
+		entry->height = header.dwHeight;
+		if( header.sCaps.dwCaps2 & (DDSCAPS2_CUBEMAP | DDSCAPS2_VOLUME) )
+		{
+			return;
+		}
+		if( header.sPixelFormat.dwFlags & DDPF_FOURCC )
+		{
+			if( (0 == memcmp( &data[84], "DX10", 4 )) )
+			{
+				if( size < offset + sizeof( DDS_header_DX10 ) )
+				{
+					return;
+				}
+				block_size = DDS_block_size( &header, &data[offset] );
+				offset += sizeof( DDS_header_DX10 );
+			} else
+			{
+				block_size = DDS_block_size( &header, NULL );
+			}
+		} else
+		if( header.sPixelFormat.dwFlags & DDPF_RGB )
+		{
+			pixel_size = header.sPixelFormat.dwRGBBitCount / 8;
+		}
+		if( (block_size == 0) && (pixel_size == 0) )
+		{
+			return;
+		}
+		levels = ((header.dwFlags & DDSD_MIPMAPCOUNT) && (header.dwMipMapCount > 0)) ?
+				(int)header.dwMipMapCount : 1;
+		if( levels > PACKAGE_MAX_LEVELS )
+		{
+			return;
+		}
+		for( i = 0; i < levels; ++i )
+		{
+			size_t w = header.dwWidth >> i, h = header.dwHeight >> i, level_size;
+			w = (w < 1) ? 1 : w;
+			h = (h < 1) ? 1 : h;
+			level_size = block_size ? ((w + 3) / 4) * ((h + 3) / 4) * block_size : w * h * pixel_size;
+			if( (offset > size) || (level_size > size - offset) )
+			{
+				return;
+			}
+			entry->level_offset[i] = (unsigned int)offset;
+			entry->level_size[i] = (unsigned int)level_size;
+			offset += level_size;
+		}
+		entry->num_levels = levels;
+	} else
+	if( (size <= 0x7FFFFFFF) && read_KTX2_header( data, (int)size, &KTX2 ) )
+	{
+		unsigned int i;
+		entry->format = TEXTURE_PACKAGE_KTX2;
+		entry->width = KTX2.pixelWidth;
+		entry->height = KTX2.pixelHeight ? KTX2.pixelHeight : 1;
+		for( i = 0; i < KTX2.levelCount; ++i )
+		{
+			entry->level_offset[i] = KTX2.levelOffset[i];
+			entry->level_size[i] = KTX2.levelLength[i];
+		}
+		entry->num_levels = KTX2.levelCount;
+	}
+}
+
+static int write_zeros( texture_package_writer *writer, size_t count )
+{
+	static const unsigned char zeros[256] = { 0 };
+	while( count > 0 )
+	{
+		const size_t n = (count < sizeof( zeros )) ? count : sizeof( zeros );
+		if( fwrite( zeros, 1, n, writer->file ) != n )
+		{
+			return 0;
+		}
+		writer->offset += n;
+		count -= n;
+	}
+	return 1;
+}
+
+int
+	texture_package_writer_open
+	(
+		texture_package_writer *writer,
+		const char *filename
+	)
+{
+	if( (NULL == writer) || (NULL == filename) )
+	{
+		return 0;
+	}
+	memset( writer, 0, sizeof( texture_package_writer ) );
+	writer->file = fopen( filename, "wb" );
+	if( NULL == writer->file )
+	{
+		return 0;
+	}
+	/*	the header is written last, when the index is	*/
+	if( !write_zeros( writer, PACKAGE_HEADER_SIZE ) )
+	{
+		writer->failed = 1;
+	}
+	return 1;
+}
+
+int
+	texture_package_writer_add
+	(
+		texture_package_writer *writer,
+		const char *name,
+		const unsigned char *data,
+		size_t size
+	)
+{
+	package_writer_entry *entries, *entry;
+	unsigned long long hash;
+	size_t padding;
+	int i;
+	if( (NULL == writer) || (NULL == writer->file) || writer->failed ||
+		(NULL == name) || ((NULL == data) && (size > 0)) )
+	{
+		return 0;
+	}
+	hash = texture_package_hash( name );
+	entries = (package_writer_entry*)writer->entries;
+	for( i = 0; i < writer->num_entries; ++i )
+	{
+		if( (entries[i].hash == hash) && (0 == package_name_compare( entries[i].name, name )) )
+		{
+			return 0;
+		}
+	}
+	if( writer->num_entries == writer->max_entries )
+	{
+		const int max_entries = writer->max_entries ? writer->max_entries * 2 : 64;
+		entries = (package_writer_entry*)realloc( entries, max_entries * sizeof( package_writer_entry ) );
+		if( NULL == entries )
+		{
+			return 0;
+		}
+		writer->entries = entries;
+		writer->max_entries = max_entries;
+	}
+	entry = &entries[writer->num_entries];
+	memset( entry, 0, sizeof( package_writer_entry ) );
+	entry->name = (char*)malloc( strlen( name ) + 1 );
+	if( NULL == entry->name )
+	{
+		return 0;
+	}
+	strcpy( entry->name, name );
+	entry->hash = hash;
+	entry->size = size;
+	describe_entry( entry, data, size );
+	/*	every texture starts on a page	*/
+	padding = (size_t)((TEXTURE_PACKAGE_PAGE_SIZE - writer->offset % TEXTURE_PACKAGE_PAGE_SIZE) %
+			TEXTURE_PACKAGE_PAGE_SIZE);
+	entry->offset = writer->offset + padding;
+	if( !write_zeros( writer, padding ) ||
+		(fwrite( data, 1, size, writer->file ) != size) )
+	{
+		free( entry->name );
+		writer->failed = 1;
+		return 0;
+	}
+	writer->offset += size;
+	++writer->num_entries;
+	return 1;
+}
+
+static int package_entry_compare( const void *a, const void *b )
+{
+	const package_writer_entry *ea = (const package_writer_entry*)a;
+	const package_writer_entry *eb = (const package_writer_entry*)b;
+	if( ea->hash != eb->hash )
+	{
+		return (ea->hash < eb->hash) ? -1 : 1;
+	}
+	return package_name_compare( ea->name, eb->name );
+}
+
+int
+	texture_package_writer_close
+	(
+		texture_package_writer *writer
+	)
+{
+	package_writer_entry *entries;
+	unsigned char *index = NULL;
+	unsigned char header[PACKAGE_HEADER_SIZE];
+	size_t index_size, mip_tables, names;
+	int result, i, level;
+	if( (NULL == writer) || (NULL == writer->file) )
+	{
+		return 0;
+	}
+	entries = (package_writer_entry*)writer->entries;
+	result = !writer->failed;
+	/*	the entries, the MIP tables, then the names	*/
+	index_size = writer->num_entries * PACKAGE_ENTRY_SIZE;
+	mip_tables = index_size;
+	for( i = 0; i < writer->num_entries; ++i )
+	{
+		index_size += entries[i].num_levels * PACKAGE_LEVEL_SIZE;
+	}
+	names = index_size;
+	for( i = 0; i < writer->num_entries; ++i )
+	{
+		index_size += strlen( entries[i].name ) + 1;
+	}
+	if( result && (writer->num_entries > 0) )
+	{
+		qsort( entries, writer->num_entries, sizeof( package_writer_entry ), package_entry_compare );
+		index = (unsigned char*)malloc( index_size );
+		result = (NULL != index);
+	}
+	if( result )
+	{
+		/*	on an 8 byte boundary	*/
+		result = write_zeros( writer, (size_t)((8 - writer->offset % 8) % 8) );
+	}
+	if( result && index )
+	{
+		for( i = 0; i < writer->num_entries; ++i )
+		{
+			unsigned char *e = &index[i * PACKAGE_ENTRY_SIZE];
+			put_u64( &e[0], entries[i].hash );
+			put_u64( &e[8], entries[i].offset );
+			put_u64( &e[16], entries[i].size );
+			put_u32( &e[24], entries[i].format );
+			put_u32( &e[28], entries[i].width );
+			put_u32( &e[32], entries[i].height );
+			put_u32( &e[36], entries[i].num_levels );
+			put_u32( &e[40], (unsigned int)mip_tables );
+			put_u32( &e[44], (unsigned int)names );
+			for( level = 0; level < entries[i].num_levels; ++level )
+			{
+				put_u32( &index[mip_tables], entries[i].level_offset[level] );
+				put_u32( &index[mip_tables + 4], entries[i].level_size[level] );
+				mip_tables += PACKAGE_LEVEL_SIZE;
+			}
+			strcpy( (char*)&index[names], entries[i].name );
+			names += strlen( entries[i].name ) + 1;
+		}
+		result = (fwrite( index, 1, index_size, writer->file ) == index_size);
+	}
+	if( result )
+	{
+		memset( header, 0, sizeof( header ) );
+		memcpy( header, package_identifier, sizeof( package_identifier ) );
+		put_u32( &header[8], TEXTURE_PACKAGE_VERSION );
+		put_u32( &header[12], TEXTURE_PACKAGE_PAGE_SIZE );
+		put_u32( &header[16], writer->num_entries );
+		put_u64( &header[24], writer->offset );
+		put_u64( &header[32], index_size );
+		result = (0 == fseek( writer->file, 0, SEEK_SET )) &&
+				(fwrite( header, 1, sizeof( header ), writer->file ) == sizeof( header ));
+	}
+	if( fclose( writer->file ) != 0 )
+	{
+		result = 0;
+	}
+	for( i = 0; i < writer->num_entries; ++i )
+	{
+		free( entries[i].name );
+	}
+	free( entries );
+	free( index );
+	memset( writer, 0, sizeof( texture_package_writer ) );
+	return result;
+}
@@ -0,0 +1,216 @@
+/*
+	Texture packages
+
+	Many textures in one file, so a program opens one file instead of
+	thousands.  The file holds the textures (usually DDS or KTX2 files
+	baked ahead of time, each starting on a page boundary), then a
+	sorted index from the hash of each name to where its texture is,
+	its size and the offsets of its MIP levels.  Packages are memory
+	mapped, so a texture is read from the disk only when it is used,
+	and its bytes can go to OpenGL without being copied first.
+
+	The layout, all little endian:
+		header: "SOILPAK1", version, page size, entry count,
+			then the offset and size of the index
+		the textures, each on a page boundary
+		index: the entries, sorted by name hash (then name), then
+			the MIP tables, then the names
+
+	There are no OpenGL calls in here.
+
+	Public Domain
+*/
+
+#ifndef HEADER_TEXTURE_PACKAGE
+#define HEADER_TEXTURE_PACKAGE
+
+#include <stddef.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TEXTURE_PACKAGE_VERSION	1
+/*	where every texture starts	*/
+#define TEXTURE_PACKAGE_PAGE_SIZE	4096
+
+/**
+	What an entry holds.
+	TEXTURE_PACKAGE_DDS, TEXTURE_PACKAGE_KTX2: a whole DDS / KTX2 file
+	TEXTURE_PACKAGE_IMAGE: any other file (PNG, JPEG, TGA...) as it was
+**/
+enum
+{
+	TEXTURE_PACKAGE_IMAGE = 0,
+	TEXTURE_PACKAGE_DDS = 1,
+	TEXTURE_PACKAGE_KTX2 = 2
+};
+
+/**
+	An open package.  data is the whole file, either mapped or (if
+	mapping is not possible here) read into RAM.
+**/
+typedef struct
+{
+	const unsigned char *data;
+	size_t size;
+	int num_entries;
+	const unsigned char *index;
+	size_t index_size;
+	/*	how to let go of data: unmap it, or free() it	*/
+	int mapped;
+}
+texture_package;
+
+/**
+	One texture in a package.  The MIP table gives the offset (from
+	data) and size of each level of 2D DDS files and of KTX2 files
+	(a KTX2 level holds all its layers and faces), num_levels is 0
+	for anything else.  width and height are 0 for images that are
+	not DDS or KTX2.
+**/
+typedef struct
+{
+	const char *name;
+	const unsigned char *data;
+	size_t size;
+	int format;
+	int width, height;
+	int num_levels;
+	const unsigned char *mip_table;
+}
+texture_package_entry;
+
+/**
+	Opens a package and checks its index.
+	\return 1 if it worked, otherwise returns 0 (and package is cleared)
+**/
+int
+	texture_package_open
+	(
+		texture_package *package,
+		const char *filename
+	);
+
+/**
+	Uses a package already in RAM, which must stay there until the
+	package is closed.
+	\return 1 if it is a valid package, otherwise returns 0
+**/
+int
+	texture_package_open_memory
+	(
+		texture_package *package,
+		const unsigned char *buffer,
+		size_t buffer_length
+	);
+
+void
+	texture_package_close
+	(
+		texture_package *package
+	);
+
+/**
+	The hash of a name as it is stored in the index (FNV-1a, 64 bit).
+	'\' counts as '/', so Windows paths find the same entries.
+**/
+unsigned long long
+	texture_package_hash
+	(
+		const char *name
+	);
+
+/**
+	Finds a texture by name (a binary search of the index).
+	\return 1 if it is there, otherwise returns 0
+**/
+int
+	texture_package_find
+	(
+		const texture_package *package,
+		const char *name,
+		texture_package_entry *entry
+	);
+
+/**
+	The index-th texture, in index order.
+	\return 1 if it is there, otherwise returns 0
+**/
+int
+	texture_package_entry_at
+	(
+		const texture_package *package,
+		int index,
+		texture_package_entry *entry
+	);
+
+/**
+	Where a MIP level of a texture is.
+	\return the level's bytes (size receives how many), or NULL if
+		there is no such level in the MIP table
+**/
+const unsigned char*
+	texture_package_level
+	(
+		const texture_package_entry *entry,
+		int level,
+		size_t *size
+	);
+
+/**
+	A package being written.  The textures are written as they are
+	added, the index when the package is closed.
+**/
+typedef struct
+{
+	FILE *file;
+	unsigned long long offset;
+	void *entries;
+	int num_entries;
+	int max_entries;
+	int failed;
+}
+texture_package_writer;
+
+/**
+	\return 1 if the file could be created, otherwise returns 0
+**/
+int
+	texture_package_writer_open
+	(
+		texture_package_writer *writer,
+		const char *filename
+	);
+
+/**
+	Adds a texture; DDS and KTX2 files are recognized and get a MIP
+	table, anything else is stored as TEXTURE_PACKAGE_IMAGE.
+	\return 1 if it worked, otherwise returns 0 (a name that is
+		already in the package, a write error or out of RAM)
+**/
+int
+	texture_package_writer_add
+	(
+		texture_package_writer *writer,
+		const char *name,
+		const unsigned char *data,
+		size_t size
+	);
+
+/**
+	Writes the index and closes the file.
+	\return 1 if the whole package was written, otherwise returns 0
+**/
+int
+	texture_package_writer_close
+	(
+		texture_package_writer *writer
+	);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HEADER_TEXTURE_PACKAGE	*/
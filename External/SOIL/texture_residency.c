@@ -0,0 +1,337 @@
+/*
+	Texture residency bookkeeping
+
+	Public Domain
+*/
+
+#include "texture_residency.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*	used to sort the eviction candidates, oldest first	*/
+typedef struct
+{
+	unsigned long last_use;
+	unsigned int texture_ID;
+}
+residency_candidate;
+
+static int compare_candidates( const void *a, const void *b )
+{
+	const residency_candidate *ca = (const residency_candidate *)a;
+	const residency_candidate *cb = (const residency_candidate *)b;
+	if( ca->last_use < cb->last_use )
+	{
+		return -1;
+	}
+	if( ca->last_use > cb->last_use )
+	{
+		return 1;
+	}
+	return 0;
+}
+
+/*	the entries are kept sorted by texture ID, find where this one goes	*/
+static int find_index( const texture_residency *state, unsigned int texture_ID )
+{
+	int lo = 0, hi = state->num_entries;
+	while( lo < hi )
+	{
+		int mid = (lo + hi) / 2;
+		if( state->entries[mid].texture_ID < texture_ID )
+		{
+			lo = mid + 1;
+		} else
+		{
+			hi = mid;
+		}
+	}
+	return lo;
+}
+
+static void recompute_resident_bytes( texture_residency *state, texture_residency_entry *entry )
+{
+	size_t face_bytes = 0;
+	int faces = 0, i;
+	for( i = 0; i < entry->num_levels; ++i )
+	{
+		face_bytes += entry->level_bytes[i];
+	}
+	for( i = 0; i < 6; ++i )
+	{
+		if( entry->face_mask & (1u << i) )
+		{
+			++faces;
+		}
+	}
+	state->resident_bytes -= entry->resident_bytes;
+	entry->resident_bytes = face_bytes * faces;
+	state->resident_bytes += entry->resident_bytes;
+	if( state->resident_bytes > state->peak_resident_bytes )
+	{
+		state->peak_resident_bytes = state->resident_bytes;
+	}
+}
+
+size_t
+	texture_residency_level_bytes
+	(
+		int width, int height,
+		int texel_bytes, int block_bytes
+	)
+{
+	if( (width < 1) || (height < 1) )
+	{
+		return 0;
+	}
+	if( block_bytes > 0 )
+	{
+		/*	block compressed, 4x4 texels per block	*/
+		return (size_t)((width + 3) >> 2) * (size_t)((height + 3) >> 2) * block_bytes;
+	}
+	return (size_t)width * (size_t)height * texel_bytes;
+}
+
+void
+	texture_residency_init
+	(
+		texture_residency *state
+	)
+{
+	memset( state, 0, sizeof( texture_residency ) );
+	state->policy = TEXTURE_RESIDENCY_EVICT;
+}
+
+void
+	texture_residency_free
+	(
+		texture_residency *state
+	)
+{
+	size_t budget = state->budget_bytes;
+	int policy = state->policy;
+	free( state->entries );
+	texture_residency_init( state );
+	/*	the settings survive, only the textures are gone	*/
+	state->budget_bytes = budget;
+	state->policy = policy;
+}
+
+texture_residency_entry*
+	texture_residency_find
+	(
+		texture_residency *state,
+		unsigned int texture_ID
+	)
+{
+	int i = find_index( state, texture_ID );
+	if( (i < state->num_entries) && (state->entries[i].texture_ID == texture_ID) )
+	{
+		return &state->entries[i];
+	}
+	return NULL;
+}
+
+texture_residency_entry*
+	texture_residency_note_upload
+	(
+		texture_residency *state,
+		unsigned int texture_ID,
+		int face, int level,
+		size_t bytes
+	)
+{
+	texture_residency_entry *entry;
+	int i = find_index( state, texture_ID );
+	if( (i >= state->num_entries) || (state->entries[i].texture_ID != texture_ID) )
+	{
+		/*	a new texture, make room for it	*/
+		if( state->num_entries == state->max_entries )
+		{
+			int new_max = state->max_entries ? state->max_entries * 2 : 64;
+			texture_residency_entry *grown = (texture_residency_entry *)realloc(
+					state->entries, new_max * sizeof( texture_residency_entry ) );
+			if( NULL == grown )
+			{
+				return NULL;
+			}
+			state->entries = grown;
+			state->max_entries = new_max;
+		}
+		memmove( &state->entries[i+1], &state->entries[i],
+				(state->num_entries - i) * sizeof( texture_residency_entry ) );
+		++state->num_entries;
+		entry = &state->entries[i];
+		memset( entry, 0, sizeof( texture_residency_entry ) );
+		entry->texture_ID = texture_ID;
+		entry->last_use = ++state->tick;
+	}
+	entry = &state->entries[i];
+	if( (face < 0) || (face > 5) ||
+		(level < 0) || (level >= TEXTURE_RESIDENCY_MAX_LEVELS) )
+	{
+		return entry;
+	}
+	/*	re-uploading the base level of a face means a brand new texture
+		(unless the levels are coming in from the smallest one up)	*/
+	if( (level == 0) && (entry->face_mask & (1u << face)) &&
+		(entry->level_bytes[0] != 0) )
+	{
+		entry->face_mask = 0;
+		entry->num_levels = 0;
+		memset( entry->level_bytes, 0, sizeof( entry->level_bytes ) );
+	}
+	entry->face_mask |= 1u << face;
+	entry->level_bytes[level] = bytes;
+	if( level >= entry->num_levels )
+	{
+		entry->num_levels = level + 1;
+	}
+	entry->evicted = 0;
+	recompute_resident_bytes( state, entry );
+	return entry;
+}
+
+void*
+	texture_residency_forget
+	(
+		texture_residency *state,
+		unsigned int texture_ID
+	)
+{
+	void *user_data;
+	int i = find_index( state, texture_ID );
+	if( (i >= state->num_entries) || (state->entries[i].texture_ID != texture_ID) )
+	{
+		return NULL;
+	}
+	user_data = state->entries[i].user_data;
+	state->resident_bytes -= state->entries[i].resident_bytes;
+	--state->num_entries;
+	memmove( &state->entries[i], &state->entries[i+1],
+			(state->num_entries - i) * sizeof( texture_residency_entry ) );
+	return user_data;
+}
+
+texture_residency_entry*
+	texture_residency_touch
+	(
+		texture_residency *state,
+		unsigned int texture_ID
+	)
+{
+	texture_residency_entry *entry = texture_residency_find( state, texture_ID );
+	if( entry )
+	{
+		entry->last_use = ++state->tick;
+	}
+	return entry;
+}
+
+void
+	texture_residency_note_reload
+	(
+		texture_residency *state,
+		double milliseconds
+	)
+{
+	++state->reloads;
+	state->reload_ms_total += milliseconds;
+	if( milliseconds > state->reload_ms_max )
+	{
+		state->reload_ms_max = milliseconds;
+	}
+}
+
+int
+	texture_residency_enforce
+	(
+		texture_residency *state,
+		unsigned int protect_ID,
+		const texture_residency_actions *actions
+	)
+{
+	residency_candidate *candidates;
+	texture_residency_entry *entry;
+	int num_candidates = 0, num_actions = 0, i;
+	/*	anything to do?	*/
+	if( (state->budget_bytes == 0) ||
+		(state->resident_bytes <= state->budget_bytes) ||
+		(NULL == actions) || state->enforcing )
+	{
+		return 0;
+	}
+	/*	only the textures we could bring back are candidates	*/
+	candidates = (residency_candidate *)malloc(
+			(state->num_entries + 1) * sizeof( residency_candidate ) );
+	if( NULL == candidates )
+	{
+		return 0;
+	}
+	for( i = 0; i < state->num_entries; ++i )
+	{
+		entry = &state->entries[i];
+		if( entry->reloadable && !entry->evicted &&
+			(entry->texture_ID != protect_ID) )
+		{
+			candidates[num_candidates].last_use = entry->last_use;
+			candidates[num_candidates].texture_ID = entry->texture_ID;
+			++num_candidates;
+		}
+	}
+	qsort( candidates, num_candidates, sizeof( residency_candidate ), compare_candidates );
+	state->enforcing = 1;
+	/*	1st pass: drop the top MIP level of the oldest textures
+		(the callbacks may add or remove entries, so always look
+		the texture up again instead of keeping the pointer)	*/
+	if( (state->policy == TEXTURE_RESIDENCY_DROP_MIPS) && actions->drop_levels )
+	{
+		for( i = 0; (i < num_candidates) && (state->resident_bytes > state->budget_bytes); ++i )
+		{
+			int dropped;
+			entry = texture_residency_find( state, candidates[i].texture_ID );
+			if( (NULL == entry) || !entry->can_drop_levels || (entry->num_levels < 2) )
+			{
+				continue;
+			}
+			dropped = entry->dropped_levels + 1;
+			if( actions->drop_levels( actions->user_data, candidates[i].texture_ID, dropped ) )
+			{
+				entry = texture_residency_find( state, candidates[i].texture_ID );
+				if( entry )
+				{
+					entry->dropped_levels = dropped;
+				}
+				++state->mip_drops;
+				++num_actions;
+			}
+		}
+	}
+	/*	2nd pass: evict the oldest textures	*/
+	if( actions->evict )
+	{
+		for( i = 0; (i < num_candidates) && (state->resident_bytes > state->budget_bytes); ++i )
+		{
+			entry = texture_residency_find( state, candidates[i].texture_ID );
+			if( (NULL == entry) || entry->evicted )
+			{
+				continue;
+			}
+			if( actions->evict( actions->user_data, candidates[i].texture_ID ) )
+			{
+				entry = texture_residency_find( state, candidates[i].texture_ID );
+				if( entry )
+				{
+					state->resident_bytes -= entry->resident_bytes;
+					entry->resident_bytes = 0;
+					entry->evicted = 1;
+				}
+				++state->evictions;
+				++num_actions;
+			}
+		}
+	}
+	state->enforcing = 0;
+	free( candidates );
+	return num_actions;
+}
@@ -0,0 +1,209 @@
+/*
+	Texture residency bookkeeping
+
+	Tracks how many bytes each texture occupies (per MIP level and
+	cube face), keeps a least-recently-used ordering and decides
+	which textures to evict or shrink to stay within a byte budget.
+
+	There are no OpenGL calls in here: the actual eviction and
+	reloading is done through the callbacks in
+	texture_residency_actions, so the accounting and policy can be
+	driven without a GPU.
+
+	Public Domain
+*/
+
+#ifndef HEADER_TEXTURE_RESIDENCY
+#define HEADER_TEXTURE_RESIDENCY
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TEXTURE_RESIDENCY_MAX_LEVELS	32
+
+/**
+	What to do with the least recently used textures once
+	the budget is exceeded.
+	TEXTURE_RESIDENCY_EVICT: evict whole textures
+	TEXTURE_RESIDENCY_DROP_MIPS: first drop the top MIP level of
+		textures that have MIPmaps (one level per texture per pass),
+		then evict whole textures if that was not enough
+**/
+enum
+{
+	TEXTURE_RESIDENCY_EVICT = 0,
+	TEXTURE_RESIDENCY_DROP_MIPS = 1
+};
+
+/**
+	Everything known about one texture.
+**/
+typedef struct
+{
+	unsigned int texture_ID;
+	/*	one bit per cube face that has been uploaded (bit 0 for 2D)	*/
+	unsigned int face_mask;
+	/*	bytes of each MIP level of a single face	*/
+	size_t level_bytes[TEXTURE_RESIDENCY_MAX_LEVELS];
+	int num_levels;
+	/*	total bytes of all faces and levels currently on the GPU	*/
+	size_t resident_bytes;
+	/*	how many top MIP levels have been dropped	*/
+	int dropped_levels;
+	int evicted;
+	/*	can this texture be brought back (it has a source to reload from)?	*/
+	int reloadable;
+	/*	can this texture be re-created with fewer MIP levels?	*/
+	int can_drop_levels;
+	unsigned long last_use;
+	/*	owned by the caller, e.g. where to reload the texture from	*/
+	void *user_data;
+}
+texture_residency_entry;
+
+/**
+	The residency state: all tracked textures, the budget,
+	and the running statistics.
+**/
+typedef struct
+{
+	texture_residency_entry *entries;
+	int num_entries;
+	int max_entries;
+	size_t budget_bytes;
+	int policy;
+	unsigned long tick;
+	size_t resident_bytes;
+	size_t peak_resident_bytes;
+	unsigned long evictions;
+	unsigned long mip_drops;
+	unsigned long reloads;
+	double reload_ms_total;
+	double reload_ms_max;
+	/*	set while texture_residency_enforce is running	*/
+	int enforcing;
+}
+texture_residency;
+
+/**
+	The callbacks used to carry out the policy decisions.
+	evict should release the storage of the texture (keeping its ID
+	valid), drop_levels should re-create the texture without its top
+	dropped_levels MIP levels and report the new uploads through
+	texture_residency_note_upload.
+	Both return 0 if they failed, otherwise 1.
+**/
+typedef struct
+{
+	int (*evict)( void *user_data, unsigned int texture_ID );
+	int (*drop_levels)( void *user_data, unsigned int texture_ID, int dropped_levels );
+	void *user_data;
+}
+texture_residency_actions;
+
+/**
+	Computes the number of bytes a single MIP level occupies.
+	DXT1 (and other 8 byte block formats) use block_bytes = 8,
+	DXT3/5 use block_bytes = 16, uncompressed textures use
+	block_bytes = 0 and are counted as width*height*texel_bytes.
+**/
+size_t
+	texture_residency_level_bytes
+	(
+		int width, int height,
+		int texel_bytes, int block_bytes
+	);
+
+void
+	texture_residency_init
+	(
+		texture_residency *state
+	);
+
+/**
+	Forgets every texture and frees all the RAM (the user_data
+	pointers are not freed, use texture_residency_forget first).
+**/
+void
+	texture_residency_free
+	(
+		texture_residency *state
+	);
+
+texture_residency_entry*
+	texture_residency_find
+	(
+		texture_residency *state,
+		unsigned int texture_ID
+	);
+
+/**
+	Records that one MIP level of one face has been (re-)uploaded.
+	Uploading level 0 of a face that already has a level 0 means the
+	texture has been re-specified, so the old levels are discarded.
+	\return the entry of the texture, or NULL if out of RAM
+**/
+texture_residency_entry*
+	texture_residency_note_upload
+	(
+		texture_residency *state,
+		unsigned int texture_ID,
+		int face, int level,
+		size_t bytes
+	);
+
+/**
+	Stops tracking a texture.
+	\return the user_data of the texture, so the caller can free it
+**/
+void*
+	texture_residency_forget
+	(
+		texture_residency *state,
+		unsigned int texture_ID
+	);
+
+/**
+	Marks a texture as used right now.
+	\return the entry of the texture, or NULL if it is not tracked
+**/
+texture_residency_entry*
+	texture_residency_touch
+	(
+		texture_residency *state,
+		unsigned int texture_ID
+	);
+
+/**
+	Records how long it took to bring a texture back.
+**/
+void
+	texture_residency_note_reload
+	(
+		texture_residency *state,
+		double milliseconds
+	);
+
+/**
+	Evicts or shrinks the least recently used textures until the
+	resident bytes fit into the budget (a budget of 0 is unlimited).
+	The texture protect_ID is never touched (use 0 for none).
+	Calls made from inside the callbacks do nothing.
+	\return the number of actions taken
+**/
+int
+	texture_residency_enforce
+	(
+		texture_residency *state,
+		unsigned int protect_ID,
+		const texture_residency_actions *actions
+	);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HEADER_TEXTURE_RESIDENCY	*/
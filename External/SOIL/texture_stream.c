@@ -0,0 +1,197 @@
+/*
+	Texture streaming scheduler
+
+	Public Domain
+*/
+
+#include "texture_stream.h"
+#include <stdlib.h>
+#include <string.h>
+
+/*	the streaming textures are few, a linear search will do	*/
+static int find_index( const texture_stream *stream, unsigned int texture_ID )
+{
+	int i;
+	for( i = 0; i < stream->num_entries; ++i )
+	{
+		if( stream->entries[i].texture_ID == texture_ID )
+		{
+			return i;
+		}
+	}
+	return -1;
+}
+
+static void remove_index( texture_stream *stream, int index )
+{
+	--stream->num_entries;
+	memmove( &stream->entries[index], &stream->entries[index+1],
+			(stream->num_entries - index) * sizeof( texture_stream_entry ) );
+	/*	keep serving the same texture next	*/
+	if( index < stream->cursor )
+	{
+		--stream->cursor;
+	}
+}
+
+void
+	texture_stream_init
+	(
+		texture_stream *stream
+	)
+{
+	memset( stream, 0, sizeof( texture_stream ) );
+}
+
+void
+	texture_stream_free
+	(
+		texture_stream *stream
+	)
+{
+	free( stream->entries );
+	texture_stream_init( stream );
+}
+
+int
+	texture_stream_add
+	(
+		texture_stream *stream,
+		unsigned int texture_ID,
+		int first_level,
+		const size_t *level_bytes,
+		void *user_data
+	)
+{
+	texture_stream_entry *entry;
+	int index = find_index( stream, texture_ID );
+	if( (first_level < 0) || (first_level >= TEXTURE_STREAM_MAX_LEVELS) )
+	{
+		return 0;
+	}
+	if( index < 0 )
+	{
+		/*	a new texture goes to the back of the line	*/
+		if( stream->num_entries == stream->max_entries )
+		{
+			int new_max = stream->max_entries ? stream->max_entries * 2 : 16;
+			texture_stream_entry *grown = (texture_stream_entry *)realloc(
+					stream->entries, new_max * sizeof( texture_stream_entry ) );
+			if( NULL == grown )
+			{
+				return 0;
+			}
+			stream->entries = grown;
+			stream->max_entries = new_max;
+		}
+		index = stream->num_entries++;
+	}
+	entry = &stream->entries[index];
+	memset( entry, 0, sizeof( texture_stream_entry ) );
+	entry->texture_ID = texture_ID;
+	entry->next_level = first_level;
+	memcpy( entry->level_bytes, level_bytes, (first_level + 1) * sizeof( size_t ) );
+	entry->user_data = user_data;
+	return 1;
+}
+
+texture_stream_entry*
+	texture_stream_find
+	(
+		texture_stream *stream,
+		unsigned int texture_ID
+	)
+{
+	int index = find_index( stream, texture_ID );
+	return (index < 0) ? NULL : &stream->entries[index];
+}
+
+void*
+	texture_stream_remove
+	(
+		texture_stream *stream,
+		unsigned int texture_ID
+	)
+{
+	void *user_data;
+	int index = find_index( stream, texture_ID );
+	if( index < 0 )
+	{
+		return NULL;
+	}
+	user_data = stream->entries[index].user_data;
+	remove_index( stream, index );
+	return user_data;
+}
+
+size_t
+	texture_stream_update
+	(
+		texture_stream *stream,
+		size_t frame_budget,
+		const texture_stream_actions *actions
+	)
+{
+	size_t uploaded = 0;
+	/*	how many textures in a row could not fit their next level	*/
+	int skipped = 0;
+	++stream->frames;
+	if( (NULL == actions) || (NULL == actions->upload) )
+	{
+		return 0;
+	}
+	while( (stream->num_entries > 0) && (skipped < stream->num_entries) )
+	{
+		texture_stream_entry *entry;
+		unsigned int texture_ID;
+		int level, index, uploaded_ok;
+		size_t bytes;
+		if( stream->cursor >= stream->num_entries )
+		{
+			stream->cursor = 0;
+		}
+		entry = &stream->entries[stream->cursor];
+		level = entry->next_level;
+		bytes = entry->level_bytes[level];
+		if( frame_budget && (uploaded > 0) && (uploaded + bytes > frame_budget) )
+		{
+			/*	no room for this one, maybe the next texture's level is smaller	*/
+			++stream->cursor;
+			++skipped;
+			continue;
+		}
+		texture_ID = entry->texture_ID;
+		uploaded_ok = actions->upload( actions->user_data, texture_ID, level, entry->user_data );
+		uploaded += bytes;
+		++stream->uploads;
+		skipped = 0;
+		/*	the callback may have added or removed textures	*/
+		index = find_index( stream, texture_ID );
+		if( index < 0 )
+		{
+			continue;
+		}
+		entry = &stream->entries[index];
+		if( uploaded_ok && (entry->next_level == level) )
+		{
+			--entry->next_level;
+		}
+		if( !uploaded_ok || (entry->next_level < 0) )
+		{
+			/*	all done (or given up on)	*/
+			void *user_data = entry->user_data;
+			remove_index( stream, index );
+			stream->cursor = index;
+			if( actions->done )
+			{
+				actions->done( actions->user_data, texture_ID, user_data );
+			}
+		} else
+		{
+			/*	one level per texture, then it's the next one's turn	*/
+			stream->cursor = index + 1;
+		}
+	}
+	stream->bytes_uploaded += uploaded;
+	return uploaded;
+}
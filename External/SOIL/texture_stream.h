@@ -0,0 +1,142 @@
+/*
+	Texture streaming scheduler
+
+	Decides which MIP levels of which textures get uploaded each
+	frame.  Every streaming texture starts out with only its smallest
+	levels resident; the remaining levels are uploaded from coarse to
+	fine, at most frame_budget bytes per frame, one level per texture
+	per pass so all the textures sharpen up at the same pace.
+
+	There are no OpenGL calls in here: the uploads are done through
+	the callbacks in texture_stream_actions, so the scheduling can be
+	checked against a recorded upload log without a GPU.
+
+	Public Domain
+*/
+
+#ifndef HEADER_TEXTURE_STREAM
+#define HEADER_TEXTURE_STREAM
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TEXTURE_STREAM_MAX_LEVELS	32
+
+/**
+	One texture that still has levels to upload.
+**/
+typedef struct
+{
+	unsigned int texture_ID;
+	/*	the next level to upload, the levels below it are still missing	*/
+	int next_level;
+	size_t level_bytes[TEXTURE_STREAM_MAX_LEVELS];
+	/*	owned by the caller, e.g. where the level data comes from	*/
+	void *user_data;
+}
+texture_stream_entry;
+
+/**
+	The scheduler state: the streaming textures, in the order they
+	are served, and the running statistics.
+**/
+typedef struct
+{
+	texture_stream_entry *entries;
+	int num_entries;
+	int max_entries;
+	/*	the texture to serve first next time	*/
+	int cursor;
+	unsigned long frames;
+	unsigned long uploads;
+	size_t bytes_uploaded;
+}
+texture_stream;
+
+/**
+	The callbacks used to carry out the uploads.
+	upload should upload the given level and return 1, or 0 if it
+	failed (the texture then stops streaming).  done is called once a
+	texture has all its levels, or has stopped streaming, right before
+	it is forgotten.
+**/
+typedef struct
+{
+	int (*upload)( void *user_data, unsigned int texture_ID, int level, void *entry_user_data );
+	void (*done)( void *user_data, unsigned int texture_ID, void *entry_user_data );
+	void *user_data;
+}
+texture_stream_actions;
+
+void
+	texture_stream_init
+	(
+		texture_stream *stream
+	);
+
+/**
+	Forgets every texture and frees all the RAM (the user_data
+	pointers are not freed, use texture_stream_remove first).
+**/
+void
+	texture_stream_free
+	(
+		texture_stream *stream
+	);
+
+/**
+	Starts streaming a texture: levels first_level down to 0 are
+	missing, level_bytes[i] is the size of level i.
+	Adding a texture that is already streaming replaces it.
+	\return 1 if it worked, 0 if out of RAM
+**/
+int
+	texture_stream_add
+	(
+		texture_stream *stream,
+		unsigned int texture_ID,
+		int first_level,
+		const size_t *level_bytes,
+		void *user_data
+	);
+
+texture_stream_entry*
+	texture_stream_find
+	(
+		texture_stream *stream,
+		unsigned int texture_ID
+	);
+
+/**
+	Stops streaming a texture (done is not called).
+	\return the user_data of the texture, so the caller can free it
+**/
+void*
+	texture_stream_remove
+	(
+		texture_stream *stream,
+		unsigned int texture_ID
+	);
+
+/**
+	Uploads as many levels as fit into frame_budget bytes, but always
+	at least one so even huge levels get through (0 means no limit).
+	The callbacks may add or remove textures.
+	\return the number of bytes uploaded
+**/
+size_t
+	texture_stream_update
+	(
+		texture_stream *stream,
+		size_t frame_budget,
+		const texture_stream_actions *actions
+	);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HEADER_TEXTURE_STREAM	*/
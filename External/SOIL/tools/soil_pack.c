@@ -0,0 +1,207 @@
+/*
+	soil_pack
+
+	Packs texture files into one texture package (see texture_package.h)
+	for SOIL_open_package() / SOIL_load_OGL_texture_from_package().
+	DDS and KTX2 files go in as they are.  Any other image is baked
+	first: compressed with its whole MIPmap chain into a DDS (or KTX2)
+	file, so it can be loaded with SOIL_FLAG_DDS_LOAD_DIRECT.
+
+	usage:	soil_pack [options] package.pak files...
+		--bake dxt|rgtc|bc7|ktx2|none	what to make of the images
+			(dxt by default, none keeps them as they are)
+		--quality fast|default|high	the compression quality
+		--strip prefix	leaves prefix out of the texture names
+		--list	lists what is in package.pak instead
+
+	The texture names are the file names as given (less the prefix).
+
+	Public Domain
+*/
+
+#include "SOIL.h"
+#include "texture_package.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PACK_TEMP_FILE	"soil_pack.tmp"
+
+static unsigned char* read_whole_file( const char *filename, size_t *length )
+{
+	FILE *f = fopen( filename, "rb" );
+	unsigned char *buffer;
+	long size;
+	if( NULL == f )
+	{
+		return NULL;
+	}
+	fseek( f, 0, SEEK_END );
+	size = ftell( f );
+	fseek( f, 0, SEEK_SET );
+	buffer = (unsigned char*)malloc( size > 0 ? size : 1 );
+	if( buffer && (fread( buffer, 1, size, f ) != (size_t)size) )
+	{
+		free( buffer );
+		buffer = NULL;
+	}
+	fclose( f );
+	*length = (size_t)size;
+	return buffer;
+}
+
+static int is_baked( const unsigned char *data, size_t length )
+{
+	return ((length >= 4) && (0 == memcmp( data, "DDS ", 4 ))) ||
+		((length >= 12) && (0 == memcmp( data, "\xABKTX 20\xBB", 8 )));
+}
+
+static int list_package( const char *filename )
+{
+	static const char *const formats[3] = { "image", "DDS", "KTX2" };
+	texture_package package;
+	texture_package_entry entry;
+	size_t total = 0;
+	int i;
+	if( !texture_package_open( &package, filename ) )
+	{
+		printf( "%s is not a texture package\n", filename );
+		return 1;
+	}
+	for( i = 0; texture_package_entry_at( &package, i, &entry ); ++i )
+	{
+		printf( "%-6s %5dx%-5d %2d levels %10lu bytes  %s\n",
+				formats[(entry.format >= 0) && (entry.format <= 2) ? entry.format : 0],
+				entry.width, entry.height, entry.num_levels,
+				(unsigned long)entry.size, entry.name );
+		total += entry.size;
+	}
+	printf( "%d textures, %lu bytes of %lu\n", package.num_entries,
+			(unsigned long)total, (unsigned long)package.size );
+	texture_package_close( &package );
+	return 0;
+}
+
+int main( int argc, char **argv )
+{
+	const char *package_name = NULL;
+	const char *prefix = NULL;
+	int save_type = SOIL_SAVE_TYPE_DDS;
+	int quality = SOIL_DXT_QUALITY_DEFAULT;
+	int bake = 1, list = 0, first_file = 0, failed = 0, i;
+	texture_package_writer writer;
+	for( i = 1; i < argc; ++i )
+	{
+		if( (0 == strcmp( argv[i], "--bake" )) && (i + 1 < argc) )
+		{
+			const char *bake_as = argv[++i];
+			bake = 1;
+			if( 0 == strcmp( bake_as, "dxt" ) )
+			{
+				save_type = SOIL_SAVE_TYPE_DDS;
+			} else if( 0 == strcmp( bake_as, "rgtc" ) )
+			{
+				save_type = SOIL_SAVE_TYPE_DDS_RGTC;
+			} else if( 0 == strcmp( bake_as, "bc7" ) )
+			{
+				save_type = SOIL_SAVE_TYPE_DDS_BC7;
+			} else if( 0 == strcmp( bake_as, "ktx2" ) )
+			{
+				save_type = SOIL_SAVE_TYPE_KTX2;
+			} else if( 0 == strcmp( bake_as, "none" ) )
+			{
+				bake = 0;
+			} else
+			{
+				printf( "unknown --bake %s\n", bake_as );
+				return 1;
+			}
+		} else if( (0 == strcmp( argv[i], "--quality" )) && (i + 1 < argc) )
+		{
+			++i;
+			quality = (0 == strcmp( argv[i], "fast" )) ? SOIL_DXT_QUALITY_FAST :
+					(0 == strcmp( argv[i], "high" )) ? SOIL_DXT_QUALITY_HIGH :
+					SOIL_DXT_QUALITY_DEFAULT;
+		} else if( (0 == strcmp( argv[i], "--strip" )) && (i + 1 < argc) )
+		{
+			prefix = argv[++i];
+		} else if( 0 == strcmp( argv[i], "--list" ) )
+		{
+			list = 1;
+		} else if( argv[i][0] == '-' )
+		{
+			break;
+		} else
+		{
+			package_name = argv[i];
+			first_file = i + 1;
+			break;
+		}
+	}
+	if( (NULL == package_name) || (!list && (first_file >= argc)) )
+	{
+		printf( "usage: %s [--bake dxt|rgtc|bc7|ktx2|none] [--quality fast|default|high]\n"
+				"\t[--strip prefix] package.pak files...\n"
+				"       %s --list package.pak\n", argv[0], argv[0] );
+		return 1;
+	}
+	if( list )
+	{
+		return list_package( package_name );
+	}
+	if( !texture_package_writer_open( &writer, package_name ) )
+	{
+		printf( "can not create %s\n", package_name );
+		return 1;
+	}
+	for( i = first_file; i < argc; ++i )
+	{
+		const char *name = argv[i];
+		size_t length = 0;
+		unsigned char *data = read_whole_file( argv[i], &length );
+		if( prefix && (0 == strncmp( name, prefix, strlen( prefix ) )) )
+		{
+			name += strlen( prefix );
+		}
+		if( NULL == data )
+		{
+			printf( "can not read %s\n", argv[i] );
+			failed = 1;
+			continue;
+		}
+		if( bake && !is_baked( data, length ) )
+		{
+			int width, height, channels;
+			unsigned char *img = SOIL_load_image_from_memory(
+					data, (int)length, &width, &height, &channels, SOIL_LOAD_AUTO );
+			free( data );
+			data = NULL;
+			if( img && SOIL_save_image_mipmapped( PACK_TEMP_FILE, save_type,
+					width, height, channels, img, quality ) )
+			{
+				data = read_whole_file( PACK_TEMP_FILE, &length );
+			}
+			SOIL_free_image_data( img );
+			if( NULL == data )
+			{
+				printf( "can not bake %s: %s\n", argv[i], SOIL_last_result() );
+				failed = 1;
+				continue;
+			}
+		}
+		if( !texture_package_writer_add( &writer, name, data, length ) )
+		{
+			printf( "can not add %s (is it in there twice?)\n", argv[i] );
+			failed = 1;
+		}
+		free( data );
+	}
+	remove( PACK_TEMP_FILE );
+	if( !texture_package_writer_close( &writer ) )
+	{
+		printf( "can not write %s\n", package_name );
+		return 1;
+	}
+	return failed;
+}
@@ -0,0 +1,108 @@
+#!/usr/bin/perl
+##
+## This program is distributed under the terms and conditions of the GNU
+## General Public License Version 2 as published by the Free Software
+## Foundation or, at your option, any later version.
+
+use strict;
+use warnings;
+
+#-------------------------------------------------------------------------------
+
+# Lists the GL descriptors for "make custom".
+#
+# custom.txt names the newest OpenGL version wanted (GL_VERSION_3_3 say).
+# Every version up to it comes along, and so do the ARB extensions those
+# versions took into the core: GLEW keeps functions like glGenVertexArrays
+# in GL_ARB_vertex_array_object, not in GL_VERSION_3_0.  Without a version
+# in custom.txt, all of them are listed.
+#
+# usage: custom_gl.pl <core dir> <extension dir> <custom.txt> core|ext
+
+my ($core, $ext, $custom, $what) = @ARGV;
+
+my %promoted = (
+    "3.0" => [qw(ARB_depth_buffer_float ARB_framebuffer_object ARB_framebuffer_sRGB
+                 ARB_half_float_vertex ARB_map_buffer_range ARB_texture_compression_rgtc
+                 ARB_texture_rg ARB_vertex_array_object)],
+    "3.1" => [qw(ARB_copy_buffer ARB_draw_instanced ARB_texture_buffer_object
+                 ARB_texture_rectangle ARB_uniform_buffer_object)],
+    "3.2" => [qw(ARB_depth_clamp ARB_draw_elements_base_vertex ARB_fragment_coord_conventions
+                 ARB_geometry_shader4 ARB_provoking_vertex ARB_seamless_cube_map ARB_sync
+                 ARB_texture_multisample)],
+    "3.3" => [qw(ARB_blend_func_extended ARB_explicit_attrib_location ARB_instanced_arrays
+                 ARB_occlusion_query2 ARB_sampler_objects ARB_shader_bit_encoding
+                 ARB_texture_rgb10_a2ui ARB_texture_swizzle ARB_timer_query
+                 ARB_vertex_type_2_10_10_10_rev)],
+    "4.0" => [qw(ARB_draw_buffers_blend ARB_draw_indirect ARB_gpu_shader5 ARB_gpu_shader_fp64
+                 ARB_sample_shading ARB_shader_subroutine ARB_tessellation_shader
+                 ARB_texture_buffer_object_rgb32 ARB_texture_cube_map_array ARB_texture_gather
+                 ARB_texture_query_lod ARB_transform_feedback2 ARB_transform_feedback3)],
+    "4.1" => [qw(ARB_ES2_compatibility ARB_get_program_binary ARB_separate_shader_objects
+                 ARB_shader_precision ARB_vertex_attrib_64bit ARB_viewport_array)],
+    "4.2" => [qw(ARB_base_instance ARB_compressed_texture_pixel_storage ARB_conservative_depth
+                 ARB_internalformat_query ARB_map_buffer_alignment ARB_shader_atomic_counters
+                 ARB_shader_image_load_store ARB_shading_language_420pack
+                 ARB_shading_language_packing ARB_texture_storage
+                 ARB_transform_feedback_instanced)],
+    "4.3" => [qw(ARB_ES3_compatibility ARB_arrays_of_arrays ARB_clear_buffer_object
+                 ARB_compute_shader ARB_copy_image ARB_explicit_uniform_location
+                 ARB_fragment_layer_viewport ARB_framebuffer_no_attachments
+                 ARB_internalformat_query2 ARB_invalidate_subdata ARB_multi_draw_indirect
+                 ARB_program_interface_query ARB_robust_buffer_access_behavior
+                 ARB_shader_image_size ARB_shader_storage_buffer_object ARB_stencil_texturing
+                 ARB_texture_buffer_range ARB_texture_query_levels
+                 ARB_texture_storage_multisample ARB_texture_view ARB_vertex_attrib_binding
+                 KHR_debug)],
+    "4.4" => [qw(ARB_buffer_storage ARB_clear_texture ARB_enhanced_layouts ARB_multi_bind
+                 ARB_query_buffer_object ARB_texture_mirror_clamp_to_edge
+                 ARB_texture_stencil8 ARB_vertex_type_10f_11f_11f_rev)],
+    "4.5" => [qw(ARB_ES3_1_compatibility ARB_clip_control ARB_conditional_render_inverted
+                 ARB_cull_distance ARB_derivative_control ARB_direct_state_access
+                 ARB_get_texture_sub_image ARB_shader_texture_image_samples
+                 ARB_texture_barrier KHR_context_flush_control KHR_robustness)],
+);
+
+sub version_key($)
+{
+    my @v = ($_[0] =~ /(\d+)[._](\d+)(?:_(\d+))?$/);
+    return sprintf("%02d%02d%02d", $v[0], $v[1], defined $v[2] ? $v[2] : 0);
+}
+
+my $newest;
+my @listed = ();
+open CUSTOM, "<$custom" or die "can not open $custom";
+while (<CUSTOM>)
+{
+    s/^\s+|\s+$//g;
+    if (/^(GL_VERSION_\d+_\d+(?:_\d+)?)$/)
+    {
+        $newest = $1 if !defined $newest || version_key($1) gt version_key($newest);
+    }
+    elsif (/^GL_\w+$/)
+    {
+        push @listed, $_;
+    }
+}
+close CUSTOM;
+
+if ($what eq "core")
+{
+    foreach my $file (sort { version_key($a) cmp version_key($b) } glob("$core/GL_VERSION_*"))
+    {
+        print "$file\n" if !defined $newest || version_key($file) le version_key($newest);
+    }
+}
+else
+{
+    my %names = map { $_ => 1 } @listed;
+    foreach my $version (keys %promoted)
+    {
+        next if !defined $newest || version_key($version) gt version_key($newest);
+        $names{"GL_$_"} = 1 foreach @{$promoted{$version}};
+    }
+    foreach my $name (sort keys %names)
+    {
+        print "$ext/$name\n" if -e "$ext/$name";
+    }
+}
@@ -31,6 +31,34 @@ sub prefix_varname($)
     return $name;
 }
 
+# the parameters of a function and the names to pass them on by; a few
+# parameters have no name in the specs, those get one
+sub parse_parms($)
+{
+    my @parms = ();
+    my @args = ();
+    my $i = 0;
+    foreach my $parm (split /\s*,\s*/, $_[0])
+    {
+        $parm =~ s/^\s+|\s+$//g;
+        next if $parm =~ /^void$/i;
+        (my $decl = $parm) =~ s/\s*\[[^\]]*\]//g;
+        my @words = grep { $_ ne "const" && $_ ne "struct" && $_ ne "unsigned" } split /[\s\*]+/, $decl;
+        if (@words < 2)
+        {
+            $parm .= " a$i";
+            push @args, "a$i";
+        }
+        else
+        {
+            push @args, $words[-1];
+        }
+        push @parms, $parm;
+        $i++;
+    }
+    return (\@parms, \@args);
+}
+
 #---------------------------------------------------------------------------------------
 
 sub make_exact($)
@@ -0,0 +1,110 @@
+#!/usr/bin/perl
+##
+## This program is distributed under the terms and conditions of the GNU
+## General Public License Version 2 as published by the Free Software
+## Foundation or, at your option, any later version.
+
+use strict;
+use warnings;
+
+do 'bin/make.pl';
+
+#-------------------------------------------------------------------------------
+
+# GLEW_INSTRUMENT wrappers for the GL function pointers: a wrapper times
+# the call and hands its first four arguments to _glewInstrumentEnd, and
+# _glewInstrumentWrap points each loaded function at its wrapper.
+
+my $maxargs = 4;
+
+# how an argument is recorded: e(num), i(nt), u(nsigned), f(loat) or
+# p(ointer), the last for anything else too; a '.' after the fourth
+# stands for the ones not recorded
+sub arg_kind($)
+{
+    my $parm = $_[0];
+    return "p" if $parm =~ /[\*\[]/;
+    return "e" if $parm =~ /\bGLenum\b/;
+    return "f" if $parm =~ /\bGL(float|double|clampf|clampd)\b/;
+    return "i" if $parm =~ /\bGL(byte|short|int|sizei|fixed|clampx|int64EXT|int64|intptr|intptrARB|sizeiptr|sizeiptrARB|vdpauSurfaceNV)\b/;
+    return "u" if $parm =~ /\bGL(ubyte|ushort|uint|uint64|uint64EXT|boolean|bitfield|half)\b/;
+    return "p";
+}
+
+sub arg_value($$)
+{
+    my ($kind, $arg) = @_;
+    return "_glewInstrumentFloat($arg)" if $kind eq "f";
+    return "(GLuint64EXT)(size_t)($arg)" if $kind eq "p";
+    return "(GLuint64EXT)($arg)";
+}
+
+sub make_wrapper($$$)
+{
+    my ($name, $fun, $i) = @_;
+    my ($parms, $args) = parse_parms($fun->{parms});
+    my @values = ();
+    my $kinds = "";
+    for (my $j = 0; $j < $maxargs; $j++)
+    {
+        if ($j < @$args)
+        {
+            my $kind = arg_kind($parms->[$j]);
+            $kinds .= $kind;
+            push @values, arg_value($kind, $args->[$j]);
+        }
+        else
+        {
+            push @values, "0";
+        }
+    }
+    $kinds .= "." if @$args > $maxargs;
+    my $void = $fun->{rtype} =~ /^void$/i;
+    my $call = "((PFN" . (uc $name) . "PROC)_glewInstrumentReal[$i])(" . join(", ", @$args) . ")";
+    my $code = "static " . $fun->{rtype} . " GLAPIENTRY _glewInstrument_" . $name . " (" . (@$parms ? join(", ", @$parms) : "void") . ")\n{\n" .
+        "  GLuint64EXT _t = _glewInstrumentNow();\n" .
+        ($void ? "  $call;\n" : "  " . $fun->{rtype} . " _r = $call;\n") .
+        "  _glewInstrumentEnd($i, _t, " . join(", ", @values) . ");\n" .
+        ($void ? "" : "  return _r;\n") . "}\n";
+    return ($code, $kinds);
+}
+
+#-------------------------------------------------------------------------------
+
+our $type = shift;
+
+my @names = ();
+my @kinds = ();
+my @wrappers = ();
+my %seen = ();
+
+foreach my $ext (sort @ARGV)
+{
+    my ($extname, $exturl, $extstring, $types, $tokens, $functions, $exacts) = parse_ext($ext);
+    foreach my $name (sort keys %$functions)
+    {
+        next if $seen{$name}++;
+        my ($code, $kinds) = make_wrapper($name, $functions->{$name}, scalar @names);
+        push @names, $name;
+        push @kinds, $kinds;
+        push @wrappers, $code;
+    }
+}
+
+my $n = scalar @names;
+print "\n#define _GLEW_INSTRUMENT_FUNCTIONS " . ($n ? $n : 1) . "\n\n";
+print "static void (*_glewInstrumentReal[_GLEW_INSTRUMENT_FUNCTIONS])(void);\n\n";
+print "static const char* const _glewInstrumentName[_GLEW_INSTRUMENT_FUNCTIONS] =\n{\n";
+print map { "  \"$_\",\n" } ($n ? @names : (""));
+print "};\n\n";
+print "/* the arguments recorded: e(num), i(nt), u(nsigned), f(loat), p(ointer), .(more) */\n";
+print "static const char* const _glewInstrumentArgs[_GLEW_INSTRUMENT_FUNCTIONS] =\n{\n";
+print map { "  \"$_\",\n" } ($n ? @kinds : (""));
+print "};\n\n";
+print join("\n", @wrappers);
+print "\nstatic void _glewInstrumentWrap (void)\n{\n";
+for (my $i = 0; $i < $n; $i++)
+{
+    print "  _GLEW_INSTRUMENT_WRAP($names[$i], _glewInstrument_$names[$i], $i)\n";
+}
+print "}\n";
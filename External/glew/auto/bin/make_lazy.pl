@@ -0,0 +1,57 @@
+#!/usr/bin/perl
+##
+## This program is distributed under the terms and conditions of the GNU
+## General Public License Version 2 as published by the Free Software
+## Foundation or, at your option, any later version.
+
+use strict;
+use warnings;
+
+do 'bin/make.pl';
+
+# the calling convention of the function pointer types (see make_header.pl)
+my %apientry = (
+    GL  => "GLAPIENTRY",
+    WGL => "WINAPI",
+    GLX => "",
+);
+
+# GLEW_LAZY trampoline: resolves the function, patches the pointer and
+# forwards the call
+sub make_pfn_lazy($%)
+{
+    my ($name, $fun) = @_;
+    my ($parms, $args) = parse_parms($fun->{parms});
+    my $cc = $apientry{$main::type} ? " " . $apientry{$main::type} : "";
+    return "static " . $fun->{rtype} . $cc . " _glewLazy_" . $name . " (" . (@$parms ? join(", ", @$parms) : "void") . ")\n{\n" .
+        "  " . $name . " = (PFN" . (uc $name) . "PROC)glewGetProcAddress((const GLubyte*)\"" . $name . "\");\n" .
+        "  " . ($fun->{rtype} =~ /^void$/i ? "" : "return ") . $name . "(" . join(", ", @$args) . ");\n}\n";
+}
+
+# function pointer declaration, starting out at its trampoline
+sub make_pfn_decl($%)
+{
+    return "PFN" . (uc $_[0]) . "PROC " . prefixname($_[0]) . " = _glewLazy_" . $_[0] . ";";
+}
+
+my @extlist = ();
+my %extensions = ();
+
+our $type = shift;
+
+if (@ARGV)
+{
+    @extlist = @ARGV;
+
+	foreach my $ext (sort @extlist)
+	{
+		my ($extname, $exturl, $extstring, $types, $tokens, $functions, $exacts) = parse_ext($ext);
+		output_decls($functions, \&make_pfn_lazy);
+	}
+
+	foreach my $ext (sort @extlist)
+	{
+		my ($extname, $exturl, $extstring, $types, $tokens, $functions, $exacts) = parse_ext($ext);
+		output_decls($functions, \&make_pfn_decl);
+	}
+}
@@ -14,6 +14,17 @@ do 'bin/make.pl';
 
 #---------------------------------------------------------------------------------------
 
+# 32 bit FNV-1a, the same as _glewHashExtension in glew_head.c
+sub extension_hash($)
+{
+    my $h = 2166136261;
+    foreach my $c (unpack("C*", $_[0]))
+    {
+        $h = (($h ^ $c) * 16777619) & 0xFFFFFFFF;
+    }
+    return sprintf("0x%08xu", $h);
+}
+
 # function pointer definition
 sub make_init_call($%)
 {
@@ -46,18 +57,18 @@ if (@ARGV)
 
 		if (length($extstring))
 		{
-				print "  " . $extvar . " = _glewSearchExtension(\"$extstring\", extStart, extEnd);\n";
+				print "  " . $extvar . " = _glewSearchExtensionSet(\"$extstring\", " . extension_hash($extstring) . ", &extSet);\n";
 		}
 
 		if (keys %$functions)
 		{
 			if ($extname =~ /WGL_.*/)
 			{
-				print "  if (glewExperimental || " . $extvar . "|| crippled) " . $extvar . "= !_glewInit_$extname(GLEW_CONTEXT_ARG_VAR_INIT);\n";
+				print "  if (_glewLoadFunctions && (glewExperimental || " . $extvar . "|| crippled)) " . $extvar . "= !_glewInit_$extname(GLEW_CONTEXT_ARG_VAR_INIT);\n";
 			}
 			else
 			{
-				print "  if (glewExperimental || " . $extvar . ") " . $extvar . " = !_glewInit_$extname(GLEW_CONTEXT_ARG_VAR_INIT);\n";
+				print "  if (_glewLoadFunctions && (glewExperimental || " . $extvar . ")) " . $extvar . " = !_glewInit_$extname(GLEW_CONTEXT_ARG_VAR_INIT);\n";
 			}
 		}
 		print "#endif /* $extname */\n";
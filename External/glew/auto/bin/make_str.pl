@@ -12,42 +12,167 @@ use warnings;
 
 do 'bin/make.pl';
 
+#---------------------------------------------------------------------------------------
+
+# 32 bit FNV-1a, the same as _glewHashExtension in glew_head.c
+sub str_hash($)
+{
+	my $h = 2166136261;
+	foreach my $c (unpack("C*", $_[0]))
+	{
+		$h = (($h ^ $c) * 16777619) & 0xFFFFFFFF;
+	}
+	return $h;
+}
+
+# 32 bit multiply, without going through floating point
+sub mul32($$)
+{
+	my ($a, $b) = @_;
+	return ($a * ($b & 0xFFFF) + ((($a * ($b >> 16)) & 0xFFFF) << 16)) & 0xFFFFFFFF;
+}
+
+# the same as _glewStrTableSlot in glew_str_head.c
+sub str_slot($$$)
+{
+	my ($h, $d, $slots) = @_;
+	$h ^= $d;
+	$h ^= $h >> 16;
+	$h = mul32($h, 0x85ebca6b);
+	$h ^= $h >> 13;
+	$h = mul32($h, 0xc2b2ae35);
+	$h ^= $h >> 16;
+	return $h % $slots;
+}
+
+# Hash and displace: the names are put in buckets by hash, and each
+# bucket, fullest first, gets the first displacement that puts all of
+# its names in empty slots.  If one does not fit, try with more slots.
+sub perfect_hash(@)
+{
+	my @hashes = @_;
+	my $n = scalar @hashes;
+	my $buckets = $n > 1 ? int($n / 2) : 1;
+	for (my $slots = $n + int($n / 4) + 1; ; $slots += int($n / 16) + 1)
+	{
+		my @bucket = map { [] } 1..$buckets;
+		push @{$bucket[$hashes[$_] % $buckets]}, $_ foreach 0..$n-1;
+		my @slot = (0xFFFF) x $slots;
+		my @disp = (0) x $buckets;
+		my $ok = 1;
+		foreach my $b (sort { scalar @{$bucket[$b]} <=> scalar @{$bucket[$a]} || $a <=> $b } 0..$buckets-1)
+		{
+			next if !@{$bucket[$b]};
+			my $found = 0;
+			for (my $d = 0; $d < 65536 && !$found; $d++)
+			{
+				my %used = ();
+				$found = 1;
+				foreach my $e (@{$bucket[$b]})
+				{
+					my $s = str_slot($hashes[$e], $d, $slots);
+					if ($slot[$s] != 0xFFFF || $used{$s}) { $found = 0; last; }
+					$used{$s} = $e;
+				}
+				if ($found)
+				{
+					$slot[$_] = $used{$_} foreach keys %used;
+					$disp[$b] = $d;
+				}
+			}
+			if (!$found) { $ok = 0; last; }
+		}
+		return ($buckets, \@disp, $slots, \@slot) if $ok;
+	}
+}
+
+sub print_list($@)
+{
+	my ($indent, @items) = @_;
+	my $line = $indent;
+	my @lines = ();
+	foreach my $item (@items)
+	{
+		if (length($line) + length($item) + 2 > 78 && $line ne $indent)
+		{
+			push @lines, $line;
+			$line = $indent;
+		}
+		$line .= ($line eq $indent ? "" : " ") . $item . ",";
+	}
+	push @lines, $line if $line ne $indent;
+	$lines[-1] =~ s/,$// if @lines;
+	print join("\n", @lines) . "\n";
+}
+
+#---------------------------------------------------------------------------------------
+
+# The table glewIsSupported (or wglewIsSupported, glxewIsSupported) looks
+# names up in: each name, where its flag is, and a perfect hash over them.
+
 my @extlist = ();
 my %extensions = ();
 
-if (@ARGV)
+our $type = shift;
+
 {
     @extlist = @ARGV;
 
-	my $curexttype = "";
+	my @names = ();
+	my @vars = ();
 	foreach my $ext (sort @extlist)
 	{
 		my ($extname, $exturl, $extstring, $types, $tokens, $functions, $exacts) = parse_ext($ext);
-		my $exttype = $extname;
-		$exttype =~ s/(W*?)GL(X*?)_(.*?_)(.*)/$3/;
-		my $extrem = $extname;
-		$extrem =~ s/(W*?)GL(X*?)_(.*?_)(.*)/$4/;
+		next if $extensions{$extname}++;
 		my $extvar = $extname;
 		$extvar =~ s/(W*)GL(X*)_/$1GL$2EW_/;
-		if(!($exttype =~ $curexttype))
-		{
-			if(length($curexttype) > 0)
-			{
-				print "      }\n";
-			}
-			print "      if (_glewStrSame2(&pos, &len, (const GLubyte*)\"$exttype\", " . length($exttype) . "))\n";
-			print "      {\n";
-			$curexttype = $exttype;
-		}
-		print "#ifdef $extname\n";
-		print "        if (_glewStrSame3(&pos, &len, (const GLubyte*)\"$extrem\", ". length($extrem) . "))\n";
-		#print "        return $extvar;\n";
-		print "        {\n";
-		print "          ret = $extvar;\n";
-		print "          continue;\n";
-		print "        }\n";
-		print "#endif\n";
+		push @names, $extname;
+		push @vars, "__" . $extvar;
+	}
+
+	my $prefix = lc($type) . "ew";
+	my $context = $type . "EWContext";
+
+	my @hashes = map { str_hash($_) } @names;
+	my ($buckets, $disp, $slots, $slot) = perfect_hash(@hashes);
+
+	my $offset = 0;
+	my @offsets = ();
+	foreach my $name (@names)
+	{
+		push @offsets, $offset;
+		$offset += length($name) + 1;
+	}
+	die "make_str.pl: names too long for GLushort offsets\n" if $offset > 0xFFFF;
+
+	if (!@names)
+	{
+		print "#ifndef GLEW_MX\nstatic GLboolean _${prefix}StrListed[1];\n#endif\n\n" if $type eq "GL";
+		print "static const _GLEWStrTable _${prefix}StrTable = { NULL, NULL, NULL, 0, NULL, NULL, 0, NULL, 0 };\n";
+		exit 0;
 	}
 
-	print "      }\n";
+	print "static const char _${prefix}StrNames[] =\n";
+	print join("\n", map { "  \"$_\\0\"" } @names) . ";\n\n";
+	print "static const GLushort _${prefix}StrName[] =\n{\n";
+	print_list("  ", @offsets);
+	print "};\n\n";
+	print "static const GLuint _${prefix}StrHash[] =\n{\n";
+	print_list("  ", map { sprintf("0x%08xu", $_) } @hashes);
+	print "};\n\n";
+	# glewGetExtension's answers, see glew_str_wgl.c
+	print "#ifndef GLEW_MX\nstatic GLboolean _${prefix}StrListed[" . scalar(@names) . "];\n#endif\n\n" if $type eq "GL";
+	print "static const _GLEWStrFlag _${prefix}StrFlag[] =\n{\n";
+	print join(",\n", map { "  _GLEW_STR_FLAG($context, $_)" } @vars) . "\n";
+	print "};\n\n";
+	print "static const GLushort _${prefix}StrDisp[] =\n{\n";
+	print_list("  ", @$disp);
+	print "};\n\n";
+	print "static const GLushort _${prefix}StrSlot[] =\n{\n";
+	print_list("  ", map { sprintf("0x%04x", $_) } @$slot);
+	print "};\n\n";
+	print "static const _GLEWStrTable _${prefix}StrTable =\n{\n";
+	print "  _${prefix}StrNames, _${prefix}StrName, _${prefix}StrHash, " . scalar(@names) . ", _${prefix}StrFlag,\n";
+	print "  _${prefix}StrDisp, $buckets, _${prefix}StrSlot, $slots\n";
+	print "};\n";
 }
@@ -0,0 +1,455 @@
+
+/* ------------------------------------------------------------------------ */
+
+/*
+ * GLEW_COMMAND_BUFFER: a command is a 4 byte head, its number in the low
+ * 8 bits and its size in the rest, then its arguments, rounded up to 8
+ * bytes.  Commands go one after the other into chunks that are kept
+ * when the buffer is reset, so a buffer recorded frame after frame stops
+ * allocating.  Nothing takes a lock: a buffer is used by one thread at a
+ * time.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#ifndef GLEW_COMMAND_CHUNK
+#  define GLEW_COMMAND_CHUNK 65536
+#endif
+
+#define _GLEW_CMD_HEAD(op, size) ((GLuint)(op) | ((GLuint)(size) << 8))
+#define _GLEW_CMD_OP(head) ((head) & 0xff)
+#define _GLEW_CMD_SIZE(head) ((head) >> 8)
+#define _GLEW_CMD_MAX_SIZE 0xffffff
+
+enum
+{
+  _GLEW_CMD_CALLBACK,
+  _GLEW_CMD_BIND_TEXTURE,
+  _GLEW_CMD_ENABLE,
+  _GLEW_CMD_DISABLE,
+  _GLEW_CMD_BLEND_FUNC,
+  _GLEW_CMD_DEPTH_MASK,
+  _GLEW_CMD_VIEWPORT,
+  _GLEW_CMD_SCISSOR,
+  _GLEW_CMD_CLEAR_COLOR,
+  _GLEW_CMD_CLEAR,
+  _GLEW_CMD_DRAW_ARRAYS,
+  _GLEW_CMD_DRAW_ELEMENTS,
+  _GLEW_CMD_ACTIVE_TEXTURE,
+  _GLEW_CMD_BIND_BUFFER,
+  _GLEW_CMD_USE_PROGRAM,
+  _GLEW_CMD_UNIFORM_1I,
+  _GLEW_CMD_UNIFORM_1F,
+  _GLEW_CMD_UNIFORM_4F,
+  _GLEW_CMD_UNIFORM_MATRIX_4FV,
+  _GLEW_CMD_DRAW_ARRAYS_INSTANCED,
+  _GLEW_CMD_DRAW_ELEMENTS_INSTANCED,
+  _GLEW_CMD_BIND_BUFFER_RANGE,
+  _GLEW_CMD_BIND_VERTEX_ARRAY
+};
+
+/* the shapes of the arguments */
+typedef struct
+{
+  GLuint head;
+  GLuint u[4];
+} _GLEWCmdUint;
+
+typedef struct
+{
+  GLuint head;
+  GLint location;
+  GLfloat f[4];
+} _GLEWCmdFloat;
+
+typedef struct
+{
+  GLuint head;
+  GLenum mode;
+  GLsizei count;
+  GLenum type;
+  GLsizei instances;
+  const void* indices;
+} _GLEWCmdDraw;
+
+typedef struct
+{
+  GLuint head;
+  GLenum target;
+  GLuint index;
+  GLuint buffer;
+  GLintptr offset;
+  GLsizeiptr size;
+} _GLEWCmdBufferRange;
+
+typedef struct
+{
+  GLuint head;
+  GLint location;
+  GLsizei count;
+  GLboolean transpose;
+  GLfloat value[16]; /* count matrices, however many */
+} _GLEWCmdMatrix;
+
+typedef struct
+{
+  GLuint head;
+  void (*callback) (void* data);
+  void* data;
+} _GLEWCmdCallback;
+
+typedef struct _GLEWCommandChunk
+{
+  struct _GLEWCommandChunk* next;
+  size_t size;
+  size_t used;
+  double align; /* so that the commands after it start 8 byte aligned */
+} _GLEWCommandChunk;
+
+#define _GLEW_CMD_DATA(chunk) ((unsigned char*)((chunk) + 1))
+
+struct GLEWCommandBufferStruct
+{
+  _GLEWCommandChunk* first;
+  _GLEWCommandChunk* last;
+  size_t chunkSize;
+  GLuint count;
+  GLboolean failed;
+};
+
+/* room for a command in the chunk in use, the next one kept or a new one */
+static void* _glewCmdAlloc (GLEWCommandBuffer* cb, GLuint op, size_t size)
+{
+  _GLEWCommandChunk* chunk = cb->last;
+  GLuint* head;
+  size = (size + 7) & ~(size_t)7;
+  if (cb->failed || size > _GLEW_CMD_MAX_SIZE)
+  {
+    cb->failed = GL_TRUE;
+    return NULL;
+  }
+  if (chunk == NULL || chunk->used + size > chunk->size)
+  {
+    if (chunk != NULL && chunk->next != NULL && size <= chunk->next->size)
+    {
+      chunk = chunk->next;
+      chunk->used = 0;
+    }
+    else
+    {
+      size_t chunkSize = size > cb->chunkSize ? size : cb->chunkSize;
+      _GLEWCommandChunk* added = (_GLEWCommandChunk*)malloc(sizeof(_GLEWCommandChunk) + chunkSize);
+      if (added == NULL)
+      {
+        cb->failed = GL_TRUE;
+        return NULL;
+      }
+      added->size = chunkSize;
+      added->used = 0;
+      if (chunk == NULL)
+      {
+        added->next = NULL;
+        cb->first = added;
+      }
+      else
+      {
+        added->next = chunk->next;
+        chunk->next = added;
+      }
+      chunk = added;
+    }
+    cb->last = chunk;
+  }
+  head = (GLuint*)(_GLEW_CMD_DATA(chunk) + chunk->used);
+  *head = _GLEW_CMD_HEAD(op, size);
+  chunk->used += size;
+  cb->count++;
+  return head;
+}
+
+static void _glewCmdUint (GLEWCommandBuffer* cb, GLuint op, GLuint n, GLuint u0, GLuint u1, GLuint u2, GLuint u3)
+{
+  _GLEWCmdUint* c = (_GLEWCmdUint*)_glewCmdAlloc(cb, op, sizeof(GLuint) * (1 + n));
+  if (c == NULL) return;
+  c->u[0] = u0;
+  if (n > 1) c->u[1] = u1;
+  if (n > 2) c->u[2] = u2;
+  if (n > 3) c->u[3] = u3;
+}
+
+static void _glewCmdFloat (GLEWCommandBuffer* cb, GLuint op, GLuint n, GLint location, GLfloat f0, GLfloat f1, GLfloat f2, GLfloat f3)
+{
+  _GLEWCmdFloat* c = (_GLEWCmdFloat*)_glewCmdAlloc(cb, op, sizeof(GLuint) + sizeof(GLint) + sizeof(GLfloat) * n);
+  if (c == NULL) return;
+  c->location = location;
+  c->f[0] = f0;
+  if (n > 1) c->f[1] = f1;
+  if (n > 2) c->f[2] = f2;
+  if (n > 3) c->f[3] = f3;
+}
+
+static void _glewCmdDraw (GLEWCommandBuffer* cb, GLuint op, GLenum mode, GLsizei count, GLenum type, GLsizei instances, const void* indices)
+{
+  _GLEWCmdDraw* c = (_GLEWCmdDraw*)_glewCmdAlloc(cb, op, sizeof(_GLEWCmdDraw));
+  if (c == NULL) return;
+  c->mode = mode;
+  c->count = count;
+  c->type = type;
+  c->instances = instances;
+  c->indices = indices;
+}
+
+GLEWCommandBuffer* GLEWAPIENTRY glewCommandBufferCreate (size_t chunkSize)
+{
+  GLEWCommandBuffer* cb = (GLEWCommandBuffer*)malloc(sizeof(GLEWCommandBuffer));
+  if (cb == NULL) return NULL;
+  cb->first = cb->last = NULL;
+  cb->chunkSize = chunkSize ? chunkSize : GLEW_COMMAND_CHUNK;
+  cb->count = 0;
+  cb->failed = GL_FALSE;
+  return cb;
+}
+
+void GLEWAPIENTRY glewCommandBufferDestroy (GLEWCommandBuffer* cb)
+{
+  _GLEWCommandChunk* chunk;
+  if (cb == NULL) return;
+  while ((chunk = cb->first) != NULL)
+  {
+    cb->first = chunk->next;
+    free(chunk);
+  }
+  free(cb);
+}
+
+void GLEWAPIENTRY glewCommandBufferReset (GLEWCommandBuffer* cb)
+{
+  cb->last = cb->first;
+  if (cb->first != NULL) cb->first->used = 0;
+  cb->count = 0;
+  cb->failed = GL_FALSE;
+}
+
+GLuint GLEWAPIENTRY glewCommandBufferCount (const GLEWCommandBuffer* cb)
+{
+  return cb->count;
+}
+
+GLboolean GLEWAPIENTRY glewCommandBufferReplay (const GLEWCommandBuffer* cb)
+{
+  const _GLEWCommandChunk* chunk;
+  for (chunk = cb->first; chunk != NULL; chunk = chunk == cb->last ? NULL : chunk->next)
+  {
+    const unsigned char* p = _GLEW_CMD_DATA(chunk);
+    const unsigned char* end = p + chunk->used;
+    while (p < end)
+    {
+      const GLuint head = *(const GLuint*)p;
+      const _GLEWCmdUint* u = (const _GLEWCmdUint*)p;
+      const _GLEWCmdFloat* f = (const _GLEWCmdFloat*)p;
+      const _GLEWCmdDraw* d = (const _GLEWCmdDraw*)p;
+      switch (_GLEW_CMD_OP(head))
+      {
+        case _GLEW_CMD_CALLBACK:
+        {
+          const _GLEWCmdCallback* c = (const _GLEWCmdCallback*)p;
+          c->callback(c->data);
+          break;
+        }
+        case _GLEW_CMD_BIND_TEXTURE: glBindTexture(u->u[0], u->u[1]); break;
+        case _GLEW_CMD_ENABLE: glEnable(u->u[0]); break;
+        case _GLEW_CMD_DISABLE: glDisable(u->u[0]); break;
+        case _GLEW_CMD_BLEND_FUNC: glBlendFunc(u->u[0], u->u[1]); break;
+        case _GLEW_CMD_DEPTH_MASK: glDepthMask((GLboolean)u->u[0]); break;
+        case _GLEW_CMD_VIEWPORT: glViewport((GLint)u->u[0], (GLint)u->u[1], (GLsizei)u->u[2], (GLsizei)u->u[3]); break;
+        case _GLEW_CMD_SCISSOR: glScissor((GLint)u->u[0], (GLint)u->u[1], (GLsizei)u->u[2], (GLsizei)u->u[3]); break;
+        case _GLEW_CMD_CLEAR_COLOR: glClearColor(f->f[0], f->f[1], f->f[2], f->f[3]); break;
+        case _GLEW_CMD_CLEAR: glClear(u->u[0]); break;
+        case _GLEW_CMD_DRAW_ARRAYS: glDrawArrays(u->u[0], (GLint)u->u[1], (GLsizei)u->u[2]); break;
+        case _GLEW_CMD_DRAW_ELEMENTS: glDrawElements(d->mode, d->count, d->type, d->indices); break;
+#ifdef GL_VERSION_1_3
+        case _GLEW_CMD_ACTIVE_TEXTURE: glActiveTexture(u->u[0]); break;
+#endif
+#ifdef GL_VERSION_1_5
+        case _GLEW_CMD_BIND_BUFFER: glBindBuffer(u->u[0], u->u[1]); break;
+#endif
+#ifdef GL_VERSION_2_0
+        case _GLEW_CMD_USE_PROGRAM: glUseProgram(u->u[0]); break;
+        case _GLEW_CMD_UNIFORM_1I: glUniform1i((GLint)u->u[0], (GLint)u->u[1]); break;
+        case _GLEW_CMD_UNIFORM_1F: glUniform1f(f->location, f->f[0]); break;
+        case _GLEW_CMD_UNIFORM_4F: glUniform4f(f->location, f->f[0], f->f[1], f->f[2], f->f[3]); break;
+        case _GLEW_CMD_UNIFORM_MATRIX_4FV:
+        {
+          const _GLEWCmdMatrix* m = (const _GLEWCmdMatrix*)p;
+          glUniformMatrix4fv(m->location, m->count, m->transpose, m->value);
+          break;
+        }
+#endif
+#ifdef GL_VERSION_3_1
+        case _GLEW_CMD_DRAW_ARRAYS_INSTANCED: glDrawArraysInstanced(u->u[0], (GLint)u->u[1], (GLsizei)u->u[2], (GLsizei)u->u[3]); break;
+        case _GLEW_CMD_DRAW_ELEMENTS_INSTANCED: glDrawElementsInstanced(d->mode, d->count, d->type, d->indices, d->instances); break;
+#endif
+#ifdef GL_ARB_uniform_buffer_object
+        case _GLEW_CMD_BIND_BUFFER_RANGE:
+        {
+          const _GLEWCmdBufferRange* r = (const _GLEWCmdBufferRange*)p;
+          glBindBufferRange(r->target, r->index, r->buffer, r->offset, r->size);
+          break;
+        }
+#endif
+#ifdef GL_ARB_vertex_array_object
+        case _GLEW_CMD_BIND_VERTEX_ARRAY: glBindVertexArray(u->u[0]); break;
+#endif
+      }
+      p += _GLEW_CMD_SIZE(head);
+    }
+  }
+  return !cb->failed;
+}
+
+/* ------------------------------------------------------------------------ */
+
+void GLEWAPIENTRY glewCmdCallback (GLEWCommandBuffer* cb, void (*callback) (void* data), void* data)
+{
+  _GLEWCmdCallback* c = (_GLEWCmdCallback*)_glewCmdAlloc(cb, _GLEW_CMD_CALLBACK, sizeof(_GLEWCmdCallback));
+  if (c == NULL) return;
+  c->callback = callback;
+  c->data = data;
+}
+
+void GLEWAPIENTRY glewCmdBindTexture (GLEWCommandBuffer* cb, GLenum target, GLuint texture)
+{
+  _glewCmdUint(cb, _GLEW_CMD_BIND_TEXTURE, 2, target, texture, 0, 0);
+}
+
+void GLEWAPIENTRY glewCmdEnable (GLEWCommandBuffer* cb, GLenum cap)
+{
+  _glewCmdUint(cb, _GLEW_CMD_ENABLE, 1, cap, 0, 0, 0);
+}
+
+void GLEWAPIENTRY glewCmdDisable (GLEWCommandBuffer* cb, GLenum cap)
+{
+  _glewCmdUint(cb, _GLEW_CMD_DISABLE, 1, cap, 0, 0, 0);
+}
+
+void GLEWAPIENTRY glewCmdBlendFunc (GLEWCommandBuffer* cb, GLenum sfactor, GLenum dfactor)
+{
+  _glewCmdUint(cb, _GLEW_CMD_BLEND_FUNC, 2, sfactor, dfactor, 0, 0);
+}
+
+void GLEWAPIENTRY glewCmdDepthMask (GLEWCommandBuffer* cb, GLboolean flag)
+{
+  _glewCmdUint(cb, _GLEW_CMD_DEPTH_MASK, 1, flag, 0, 0, 0);
+}
+
+void GLEWAPIENTRY glewCmdViewport (GLEWCommandBuffer* cb, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+  _glewCmdUint(cb, _GLEW_CMD_VIEWPORT, 4, (GLuint)x, (GLuint)y, (GLuint)width, (GLuint)height);
+}
+
+void GLEWAPIENTRY glewCmdScissor (GLEWCommandBuffer* cb, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+  _glewCmdUint(cb, _GLEW_CMD_SCISSOR, 4, (GLuint)x, (GLuint)y, (GLuint)width, (GLuint)height);
+}
+
+void GLEWAPIENTRY glewCmdClearColor (GLEWCommandBuffer* cb, GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha)
+{
+  _glewCmdFloat(cb, _GLEW_CMD_CLEAR_COLOR, 4, 0, red, green, blue, alpha);
+}
+
+void GLEWAPIENTRY glewCmdClear (GLEWCommandBuffer* cb, GLbitfield mask)
+{
+  _glewCmdUint(cb, _GLEW_CMD_CLEAR, 1, mask, 0, 0, 0);
+}
+
+void GLEWAPIENTRY glewCmdDrawArrays (GLEWCommandBuffer* cb, GLenum mode, GLint first, GLsizei count)
+{
+  _glewCmdUint(cb, _GLEW_CMD_DRAW_ARRAYS, 3, mode, (GLuint)first, (GLuint)count, 0);
+}
+
+void GLEWAPIENTRY glewCmdDrawElements (GLEWCommandBuffer* cb, GLenum mode, GLsizei count, GLenum type, const void* indices)
+{
+  _glewCmdDraw(cb, _GLEW_CMD_DRAW_ELEMENTS, mode, count, type, 1, indices);
+}
+
+#ifdef GL_VERSION_1_3
+void GLEWAPIENTRY glewCmdActiveTexture (GLEWCommandBuffer* cb, GLenum texture)
+{
+  _glewCmdUint(cb, _GLEW_CMD_ACTIVE_TEXTURE, 1, texture, 0, 0, 0);
+}
+#endif
+
+#ifdef GL_VERSION_1_5
+void GLEWAPIENTRY glewCmdBindBuffer (GLEWCommandBuffer* cb, GLenum target, GLuint buffer)
+{
+  _glewCmdUint(cb, _GLEW_CMD_BIND_BUFFER, 2, target, buffer, 0, 0);
+}
+#endif
+
+#ifdef GL_VERSION_2_0
+void GLEWAPIENTRY glewCmdUseProgram (GLEWCommandBuffer* cb, GLuint program)
+{
+  _glewCmdUint(cb, _GLEW_CMD_USE_PROGRAM, 1, program, 0, 0, 0);
+}
+
+void GLEWAPIENTRY glewCmdUniform1i (GLEWCommandBuffer* cb, GLint location, GLint v0)
+{
+  _glewCmdUint(cb, _GLEW_CMD_UNIFORM_1I, 2, (GLuint)location, (GLuint)v0, 0, 0);
+}
+
+void GLEWAPIENTRY glewCmdUniform1f (GLEWCommandBuffer* cb, GLint location, GLfloat v0)
+{
+  _glewCmdFloat(cb, _GLEW_CMD_UNIFORM_1F, 1, location, v0, 0, 0, 0);
+}
+
+void GLEWAPIENTRY glewCmdUniform4f (GLEWCommandBuffer* cb, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+  _glewCmdFloat(cb, _GLEW_CMD_UNIFORM_4F, 4, location, v0, v1, v2, v3);
+}
+
+/* the matrices are copied, value can go once this returns */
+void GLEWAPIENTRY glewCmdUniformMatrix4fv (GLEWCommandBuffer* cb, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+  _GLEWCmdMatrix* c;
+  if (count < 0) return;
+  c = (_GLEWCmdMatrix*)_glewCmdAlloc(cb, _GLEW_CMD_UNIFORM_MATRIX_4FV, offsetof(_GLEWCmdMatrix, value) + sizeof(GLfloat) * 16 * (size_t)count);
+  if (c == NULL) return;
+  c->location = location;
+  c->count = count;
+  c->transpose = transpose;
+  memcpy(c->value, value, sizeof(GLfloat) * 16 * (size_t)count);
+}
+#endif
+
+#ifdef GL_VERSION_3_1
+void GLEWAPIENTRY glewCmdDrawArraysInstanced (GLEWCommandBuffer* cb, GLenum mode, GLint first, GLsizei count, GLsizei primcount)
+{
+  _glewCmdUint(cb, _GLEW_CMD_DRAW_ARRAYS_INSTANCED, 4, mode, (GLuint)first, (GLuint)count, (GLuint)primcount);
+}
+
+void GLEWAPIENTRY glewCmdDrawElementsInstanced (GLEWCommandBuffer* cb, GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei primcount)
+{
+  _glewCmdDraw(cb, _GLEW_CMD_DRAW_ELEMENTS_INSTANCED, mode, count, type, primcount, indices);
+}
+#endif
+
+#ifdef GL_ARB_uniform_buffer_object
+void GLEWAPIENTRY glewCmdBindBufferRange (GLEWCommandBuffer* cb, GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+  _GLEWCmdBufferRange* c = (_GLEWCmdBufferRange*)_glewCmdAlloc(cb, _GLEW_CMD_BIND_BUFFER_RANGE, sizeof(_GLEWCmdBufferRange));
+  if (c == NULL) return;
+  c->target = target;
+  c->index = index;
+  c->buffer = buffer;
+  c->offset = offset;
+  c->size = size;
+}
+#endif
+
+#ifdef GL_ARB_vertex_array_object
+void GLEWAPIENTRY glewCmdBindVertexArray (GLEWCommandBuffer* cb, GLuint array)
+{
+  _glewCmdUint(cb, _GLEW_CMD_BIND_VERTEX_ARRAY, 1, array, 0, 0, 0);
+}
+#endif
@@ -1,3 +1,6 @@
+#if defined(GLEW_STATE_CACHE)
+#  define GLEW_STATE_CACHE_BUILD
+#endif
 #include <GL/glew.h>
 
 #if defined(_WIN32)
@@ -12,6 +15,9 @@
  * Define glewGetContext and related helper macros.
  */
 #ifdef GLEW_MX
+#  undef glewGetContext
+#  undef wglewGetContext
+#  undef glxewGetContext
 #  define glewGetContext() ctx
 #  ifdef _WIN32
 #    define GLEW_CONTEXT_ARG_DEF_INIT GLEWContext* ctx
@@ -153,6 +159,40 @@ void* NSGLGetProcAddress (const GLubyte *name)
 #  define glewGetProcAddress(name) (*glXGetProcAddressARB)(name)
 #endif
 
+/*
+ * GLEW_LAZY: the function pointers are defined in glew_lazy.c, each
+ * starting out at a trampoline that loads the function the first time
+ * it is called, and glewInit only works out which versions and
+ * extensions are there.  A function that is not there still crashes
+ * when called, as a NULL pointer would, and a later glewInit does not
+ * put the pointers back to the trampolines.  glewExperimental does
+ * nothing, there is nothing to try to load.
+ */
+#if defined(GLEW_LAZY)
+#  if defined(GLEW_MX)
+#    error "GLEW_LAZY does not work with GLEW_MX"
+#  endif
+#  define _glewLoadFunctions GL_FALSE
+void* _glewLazyGetProcAddress (const GLubyte* name)
+{
+  return (void*)glewGetProcAddress(name);
+}
+#else
+#  define _glewLoadFunctions GL_TRUE
+#endif
+
+/*
+ * GLEW_INSTRUMENT: glewInit points every GL function it loads at a
+ * wrapper that times the call and records it, then calls the function.
+ * The wrappers and the runtime behind them are in glew_instrument.c.
+ */
+#if defined(GLEW_INSTRUMENT)
+#  if defined(GLEW_MX) || defined(GLEW_LAZY)
+#    error "GLEW_INSTRUMENT does not work with GLEW_MX or GLEW_LAZY"
+#  endif
+extern void _glewInstrumentInit (void);
+#endif
+
 /*
  * Redefine GLEW_GET_VAR etc without const cast
  */
@@ -211,75 +251,171 @@ static GLboolean _glewStrSame (const GLubyte* a, const GLubyte* b, GLuint n)
   return i == n ? GL_TRUE : GL_FALSE;
 }
 
-static GLboolean _glewStrSame1 (const GLubyte** a, GLuint* na, const GLubyte* b, GLuint nb)
+/*
+ * Search for name in the extensions string. Use of strstr()
+ * is not sufficient because extension names can be prefixes of
+ * other extension names. Could use strtok() but the constant
+ * string returned by glGetString might be in read-only memory.
+ */
+static GLboolean _glewSearchExtension (const char* name, const GLubyte *start, const GLubyte *end)
 {
-  while (*na > 0 && (**a == ' ' || **a == '\n' || **a == '\r' || **a == '\t'))
+  const GLubyte* p;
+  GLuint len = _glewStrLen((const GLubyte*)name);
+  p = start;
+  while (p < end)
   {
-    (*a)++;
-    (*na)--;
+    GLuint n = _glewStrCLen(p, ' ');
+    if (len == n && _glewStrSame((const GLubyte*)name, p, n)) return GL_TRUE;
+    p += n+1;
   }
-  if(*na >= nb)
+  return GL_FALSE;
+}
+
+/*
+ * A "make custom" subset without OpenGL 3.0 still has to read the
+ * extensions of a core profile.
+ */
+#ifndef GL_VERSION_3_0
+#define GL_NUM_EXTENSIONS 0x821D
+typedef const GLubyte* (GLAPIENTRY * PFNGLGETSTRINGIPROC) (GLenum name, GLuint index);
+#endif
+
+/*
+ * Search for name in the extensions of a core profile, which only come
+ * one at a time from glGetStringi (glGetString(GL_EXTENSIONS) is an
+ * error there).
+ */
+static GLboolean _glewSearchExtensionStringi (const char* name, PFNGLGETSTRINGIPROC getStringi, GLuint num)
+{
+  GLuint i;
+  for (i = 0; i < num; i++)
   {
-    GLuint i=0;
-    while (i < nb && (*a)+i != NULL && b+i != NULL && (*a)[i] == b[i]) i++;
-    if(i == nb)
-    {
-      *a = *a + nb;
-      *na = *na - nb;
+    const GLubyte* e = getStringi(GL_EXTENSIONS, i);
+    GLuint n = _glewStrLen(e);
+    if (n > 0 && _glewStrSame((const GLubyte*)name, e, n) && name[n] == '\0')
       return GL_TRUE;
-    }
   }
   return GL_FALSE;
 }
 
-static GLboolean _glewStrSame2 (const GLubyte** a, GLuint* na, const GLubyte* b, GLuint nb)
+/*
+ * The names in an extensions string (or from glGetStringi), in a hash
+ * set, so that each of the extensions GLEW knows about is found in O(1)
+ * instead of by a walk through all of them.  The entries point into
+ * the strings, nothing is copied.  make_list.pl works out the hash of
+ * every name that is looked up when glew.c is generated (32 bit FNV-1a,
+ * as in _glewHashExtension).  With more names than the set holds they
+ * are searched the old way.
+ */
+#define GLEW_EXTENSION_SET_SIZE 1024 /* a power of 2, at most 3/4 full */
+
+typedef struct
+{
+  const GLubyte* name;
+  GLuint len;
+  GLuint hash;
+} _GLEWExtensionSetEntry;
+
+typedef struct
+{
+  _GLEWExtensionSetEntry entry[GLEW_EXTENSION_SET_SIZE];
+  GLuint count;
+  GLboolean full;
+  /* where the names came from: one string, or glGetStringi */
+  const GLubyte* start;
+  const GLubyte* end;
+  PFNGLGETSTRINGIPROC getStringi;
+  GLuint num;
+} _GLEWExtensionSet;
+
+static GLuint _glewHashExtension (const GLubyte* s, GLuint n)
 {
-  if(*na >= nb)
+  GLuint h = 2166136261u;
+  GLuint i;
+  for (i = 0; i < n; i++)
   {
-    GLuint i=0;
-    while (i < nb && (*a)+i != NULL && b+i != NULL && (*a)[i] == b[i]) i++;
-    if(i == nb)
-    {
-      *a = *a + nb;
-      *na = *na - nb;
-      return GL_TRUE;
-    }
+    h ^= s[i];
+    h *= 16777619u;
   }
-  return GL_FALSE;
+  return h;
 }
 
-static GLboolean _glewStrSame3 (const GLubyte** a, GLuint* na, const GLubyte* b, GLuint nb)
+static void _glewClearExtensionSet (_GLEWExtensionSet* set)
 {
-  if(*na >= nb)
+  GLuint i;
+  for (i = 0; i < GLEW_EXTENSION_SET_SIZE; i++)
+    set->entry[i].name = NULL;
+  set->count = 0;
+  set->full = GL_FALSE;
+  set->start = NULL;
+  set->end = NULL;
+  set->getStringi = NULL;
+  set->num = 0;
+}
+
+static void _glewAddExtension (_GLEWExtensionSet* set, const GLubyte* name, GLuint n)
+{
+  GLuint h, i;
+  if (n == 0 || set->full)
+    return;
+  if (++set->count > GLEW_EXTENSION_SET_SIZE/4*3)
   {
-    GLuint i=0;
-    while (i < nb && (*a)+i != NULL && b+i != NULL && (*a)[i] == b[i]) i++;
-    if (i == nb && (*na == nb || (*a)[i] == ' ' || (*a)[i] == '\n' || (*a)[i] == '\r' || (*a)[i] == '\t'))
-    {
-      *a = *a + nb;
-      *na = *na - nb;
-      return GL_TRUE;
-    }
+    set->full = GL_TRUE;
+    return;
   }
-  return GL_FALSE;
+  h = _glewHashExtension(name, n);
+  i = h & (GLEW_EXTENSION_SET_SIZE-1);
+  while (set->entry[i].name != NULL)
+    i = (i+1) & (GLEW_EXTENSION_SET_SIZE-1);
+  set->entry[i].name = name;
+  set->entry[i].len = n;
+  set->entry[i].hash = h;
 }
 
-/*
- * Search for name in the extensions string. Use of strstr()
- * is not sufficient because extension names can be prefixes of
- * other extension names. Could use strtok() but the constant
- * string returned by glGetString might be in read-only memory.
- */
-static GLboolean _glewSearchExtension (const char* name, const GLubyte *start, const GLubyte *end)
+static void _glewInitExtensionSet (_GLEWExtensionSet* set, const GLubyte* start, const GLubyte* end)
 {
   const GLubyte* p;
-  GLuint len = _glewStrLen((const GLubyte*)name);
+  _glewClearExtensionSet(set);
+  set->start = start;
+  set->end = end;
   p = start;
   while (p < end)
   {
     GLuint n = _glewStrCLen(p, ' ');
-    if (len == n && _glewStrSame((const GLubyte*)name, p, n)) return GL_TRUE;
+    _glewAddExtension(set, p, n);
     p += n+1;
   }
+}
+
+static void _glewInitExtensionSetStringi (_GLEWExtensionSet* set, PFNGLGETSTRINGIPROC getStringi, GLuint num)
+{
+  GLuint i;
+  _glewClearExtensionSet(set);
+  set->getStringi = getStringi;
+  set->num = num;
+  for (i = 0; i < num; i++)
+  {
+    const GLubyte* e = getStringi(GL_EXTENSIONS, i);
+    if (e != NULL)
+      _glewAddExtension(set, e, _glewStrLen(e));
+  }
+}
+
+static GLboolean _glewSearchExtensionSet (const char* name, GLuint hash, const _GLEWExtensionSet* set)
+{
+  GLuint i = hash & (GLEW_EXTENSION_SET_SIZE-1);
+  if (set->full)
+  {
+    if (set->getStringi != NULL)
+      return _glewSearchExtensionStringi(name, set->getStringi, set->num);
+    return _glewSearchExtension(name, set->start, set->end);
+  }
+  while (set->entry[i].name != NULL)
+  {
+    const _GLEWExtensionSetEntry* e = &set->entry[i];
+    if (e->hash == hash && _glewStrSame((const GLubyte*)name, e->name, e->len) && name[e->len] == '\0')
+      return GL_TRUE;
+    i = (i+1) & (GLEW_EXTENSION_SET_SIZE-1);
+  }
   return GL_FALSE;
 }
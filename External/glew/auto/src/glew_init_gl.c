@@ -1,12 +1,36 @@
 /* ------------------------------------------------------------------------- */
 
+#ifndef GLEW_MX
+/* the names glewIsSupported knows, with whether they are listed (after
+   the string tables, at the end) */
+static void _glewStrInitListed (const _GLEWExtensionSet* set);
+static int _glewStrGetListed (const char* name);
+#endif
+
+/* once glewContextInit has run, every name is looked up in what it
+   found listed; before that, or with GLEW_MX (where the answer is the
+   context's and there is none to keep it in), the driver's list is
+   searched */
 GLboolean GLEWAPIENTRY glewGetExtension (const char* name)
 {    
   const GLubyte* start;
   const GLubyte* end;
+#ifndef GLEW_MX
+  int listed = _glewStrGetListed(name);
+  if (listed >= 0)
+    return (GLboolean)listed;
+#endif
   start = (const GLubyte*)glGetString(GL_EXTENSIONS);
   if (start == 0)
-    return GL_FALSE;
+  {
+    /* a core profile, ask for them one at a time */
+    PFNGLGETSTRINGIPROC getStringi = (PFNGLGETSTRINGIPROC)glewGetProcAddress((const GLubyte*)"glGetStringi");
+    GLint num = 0;
+    if (getStringi == NULL)
+      return GL_FALSE;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &num);
+    return _glewSearchExtensionStringi(name, getStringi, num > 0 ? (GLuint)num : 0);
+  }
   end = start + _glewStrLen(start);
   return _glewSearchExtension(name, start, end);
 }
@@ -23,6 +47,11 @@ GLenum GLEWAPIENTRY glewContextInit (GLEW_CONTEXT_ARG_DEF_LIST)
   GLint major, minor;
   const GLubyte* extStart;
   const GLubyte* extEnd;
+  PFNGLGETSTRINGIPROC getStringi = NULL;
+  _GLEWExtensionSet extSet;
+#ifndef GLEW_MX
+  _glewStrInitListed(NULL);
+#endif
   /* query opengl version */
   s = glGetString(GL_VERSION);
   dot = _glewStrCLen(s, '.');
@@ -44,30 +73,81 @@ GLenum GLEWAPIENTRY glewContextInit (GLEW_CONTEXT_ARG_DEF_LIST)
   }
   else
   {
-    GLEW_VERSION_4_5   = ( major > 4 )                 || ( major == 4 && minor >= 5 ) ? GL_TRUE : GL_FALSE;
-    GLEW_VERSION_4_4   = GLEW_VERSION_4_5   == GL_TRUE || ( major == 4 && minor >= 4 ) ? GL_TRUE : GL_FALSE;
-    GLEW_VERSION_4_3   = GLEW_VERSION_4_4   == GL_TRUE || ( major == 4 && minor >= 3 ) ? GL_TRUE : GL_FALSE;
-    GLEW_VERSION_4_2   = GLEW_VERSION_4_3   == GL_TRUE || ( major == 4 && minor >= 2 ) ? GL_TRUE : GL_FALSE;
-    GLEW_VERSION_4_1   = GLEW_VERSION_4_2   == GL_TRUE || ( major == 4 && minor >= 1 ) ? GL_TRUE : GL_FALSE;
-    GLEW_VERSION_4_0   = GLEW_VERSION_4_1   == GL_TRUE || ( major == 4               ) ? GL_TRUE : GL_FALSE;
-    GLEW_VERSION_3_3   = GLEW_VERSION_4_0   == GL_TRUE || ( major == 3 && minor >= 3 ) ? GL_TRUE : GL_FALSE;
-    GLEW_VERSION_3_2   = GLEW_VERSION_3_3   == GL_TRUE || ( major == 3 && minor >= 2 ) ? GL_TRUE : GL_FALSE;
-    GLEW_VERSION_3_1   = GLEW_VERSION_3_2   == GL_TRUE || ( major == 3 && minor >= 1 ) ? GL_TRUE : GL_FALSE;
-    GLEW_VERSION_3_0   = GLEW_VERSION_3_1   == GL_TRUE || ( major == 3               ) ? GL_TRUE : GL_FALSE;
-    GLEW_VERSION_2_1   = GLEW_VERSION_3_0   == GL_TRUE || ( major == 2 && minor >= 1 ) ? GL_TRUE : GL_FALSE;    
-    GLEW_VERSION_2_0   = GLEW_VERSION_2_1   == GL_TRUE || ( major == 2               ) ? GL_TRUE : GL_FALSE;
-    GLEW_VERSION_1_5   = GLEW_VERSION_2_0   == GL_TRUE || ( major == 1 && minor >= 5 ) ? GL_TRUE : GL_FALSE;
-    GLEW_VERSION_1_4   = GLEW_VERSION_1_5   == GL_TRUE || ( major == 1 && minor >= 4 ) ? GL_TRUE : GL_FALSE;
-    GLEW_VERSION_1_3   = GLEW_VERSION_1_4   == GL_TRUE || ( major == 1 && minor >= 3 ) ? GL_TRUE : GL_FALSE;
-    GLEW_VERSION_1_2_1 = GLEW_VERSION_1_3   == GL_TRUE                                 ? GL_TRUE : GL_FALSE; 
-    GLEW_VERSION_1_2   = GLEW_VERSION_1_2_1 == GL_TRUE || ( major == 1 && minor >= 2 ) ? GL_TRUE : GL_FALSE;
-    GLEW_VERSION_1_1   = GLEW_VERSION_1_2   == GL_TRUE || ( major == 1 && minor >= 1 ) ? GL_TRUE : GL_FALSE;
+    /* each one on its own, "make custom" may have left the newer ones out */
+#ifdef GL_VERSION_4_5
+    GLEW_VERSION_4_5     = ( major > 4 ) || ( major == 4 && minor >= 5 ) ? GL_TRUE : GL_FALSE;
+#endif
+#ifdef GL_VERSION_4_4
+    GLEW_VERSION_4_4     = ( major > 4 ) || ( major == 4 && minor >= 4 ) ? GL_TRUE : GL_FALSE;
+#endif
+#ifdef GL_VERSION_4_3
+    GLEW_VERSION_4_3     = ( major > 4 ) || ( major == 4 && minor >= 3 ) ? GL_TRUE : GL_FALSE;
+#endif
+#ifdef GL_VERSION_4_2
+    GLEW_VERSION_4_2     = ( major > 4 ) || ( major == 4 && minor >= 2 ) ? GL_TRUE : GL_FALSE;
+#endif
+#ifdef GL_VERSION_4_1
+    GLEW_VERSION_4_1     = ( major > 4 ) || ( major == 4 && minor >= 1 ) ? GL_TRUE : GL_FALSE;
+#endif
+#ifdef GL_VERSION_4_0
+    GLEW_VERSION_4_0     = ( major > 4 ) || ( major == 4 && minor >= 0 ) ? GL_TRUE : GL_FALSE;
+#endif
+#ifdef GL_VERSION_3_3
+    GLEW_VERSION_3_3     = ( major > 3 ) || ( major == 3 && minor >= 3 ) ? GL_TRUE : GL_FALSE;
+#endif
+#ifdef GL_VERSION_3_2
+    GLEW_VERSION_3_2     = ( major > 3 ) || ( major == 3 && minor >= 2 ) ? GL_TRUE : GL_FALSE;
+#endif
+#ifdef GL_VERSION_3_1
+    GLEW_VERSION_3_1     = ( major > 3 ) || ( major == 3 && minor >= 1 ) ? GL_TRUE : GL_FALSE;
+#endif
+#ifdef GL_VERSION_3_0
+    GLEW_VERSION_3_0     = ( major > 3 ) || ( major == 3 && minor >= 0 ) ? GL_TRUE : GL_FALSE;
+#endif
+#ifdef GL_VERSION_2_1
+    GLEW_VERSION_2_1     = ( major > 2 ) || ( major == 2 && minor >= 1 ) ? GL_TRUE : GL_FALSE;
+#endif
+#ifdef GL_VERSION_2_0
+    GLEW_VERSION_2_0     = ( major > 2 ) || ( major == 2 && minor >= 0 ) ? GL_TRUE : GL_FALSE;
+#endif
+#ifdef GL_VERSION_1_5
+    GLEW_VERSION_1_5     = ( major > 1 ) || ( major == 1 && minor >= 5 ) ? GL_TRUE : GL_FALSE;
+#endif
+#ifdef GL_VERSION_1_4
+    GLEW_VERSION_1_4     = ( major > 1 ) || ( major == 1 && minor >= 4 ) ? GL_TRUE : GL_FALSE;
+#endif
+#ifdef GL_VERSION_1_3
+    GLEW_VERSION_1_3     = ( major > 1 ) || ( major == 1 && minor >= 3 ) ? GL_TRUE : GL_FALSE;
+#endif
+#ifdef GL_VERSION_1_2_1
+    GLEW_VERSION_1_2_1   = ( major > 1 ) || ( major == 1 && minor >= 3 ) ? GL_TRUE : GL_FALSE;
+#endif
+#ifdef GL_VERSION_1_2
+    GLEW_VERSION_1_2     = ( major > 1 ) || ( major == 1 && minor >= 2 ) ? GL_TRUE : GL_FALSE;
+#endif
+    GLEW_VERSION_1_1     = ( major > 1 ) || ( major == 1 && minor >= 1 ) ? GL_TRUE : GL_FALSE;
   }
 
-  /* query opengl extensions string */
-  extStart = glGetString(GL_EXTENSIONS);
-  if (extStart == 0)
-    extStart = (const GLubyte*)"";
-  extEnd = extStart + _glewStrLen(extStart);
+  /* query opengl extensions: one at a time from OpenGL 3.0 on (the only
+     way in a core profile), so only what is advertised gets loaded */
+  if (major >= 3)
+    getStringi = (PFNGLGETSTRINGIPROC)glewGetProcAddress((const GLubyte*)"glGetStringi");
+  if (getStringi != NULL)
+  {
+    GLint num = 0;
+    glGetIntegerv(GL_NUM_EXTENSIONS, &num);
+    _glewInitExtensionSetStringi(&extSet, getStringi, num > 0 ? (GLuint)num : 0);
+  }
+  else
+  {
+    extStart = glGetString(GL_EXTENSIONS);
+    if (extStart == 0)
+      extStart = (const GLubyte*)"";
+    extEnd = extStart + _glewStrLen(extStart);
+    _glewInitExtensionSet(&extSet, extStart, extEnd);
+  }
+#ifndef GLEW_MX
+  _glewStrInitListed(&extSet);
+#endif
 
   /* initialize extensions */
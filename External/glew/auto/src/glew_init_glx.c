@@ -17,6 +17,7 @@ GLenum glxewContextInit (GLXEW_CONTEXT_ARG_DEF_LIST)
   int major, minor;
   const GLubyte* extStart;
   const GLubyte* extEnd;
+  _GLEWExtensionSet extSet;
   /* initialize core GLX 1.2 */
   if (_glewInit_GLX_VERSION_1_2(GLEW_CONTEXT_ARG_VAR_INIT)) return GLEW_ERROR_GLX_VERSION_11_ONLY;
   /* initialize flags */
@@ -50,4 +51,5 @@ GLenum glxewContextInit (GLXEW_CONTEXT_ARG_DEF_LIST)
   if (extStart == 0)
     extStart = (const GLubyte *)"";
   extEnd = extStart + _glewStrLen(extStart);
+  _glewInitExtensionSet(&extSet, extStart, extEnd);
   /* initialize extensions */
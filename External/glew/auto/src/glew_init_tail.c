@@ -8,6 +8,7 @@ const GLubyte * GLEWAPIENTRY glewGetErrorString (GLenum error)
     (const GLubyte*)"Missing GL version",
     (const GLubyte*)"GL 1.1 and up are not supported",
     (const GLubyte*)"GLX 1.2 and up are not supported",
+    (const GLubyte*)"More different contexts than GLEW_MX_TLS_CONTEXTS",
     (const GLubyte*)"Unknown error"
   };
   const size_t max_error = sizeof(_glewErrorString)/sizeof(*_glewErrorString) - 1;
@@ -45,6 +46,12 @@ GLenum GLEWAPIENTRY glewInit (void)
   GLenum r;
   r = glewContextInit();
   if ( r != 0 ) return r;
+#if defined(GLEW_INSTRUMENT)
+  _glewInstrumentInit();
+#endif
+#if defined(GLEW_STATE_CACHE)
+  glewStateCacheInvalidate();
+#endif
 #if defined(_WIN32)
   return wglewContextInit();
 #elif !defined(__ANDROID__) && !defined(__native_client__) && !defined(__HAIKU__) && (!defined(__APPLE__) || defined(GLEW_APPLE_GLX)) /* _UNIX */
@@ -55,3 +62,186 @@ GLenum GLEWAPIENTRY glewInit (void)
 }
 
 #endif /* !GLEW_MX */
+
+#if defined(GLEW_MX)
+
+/* ------------------------------------------------------------------------ */
+
+/*
+ * The GLEWContexts behind glewCurrentContextInit, one for each display
+ * (on GLX), vendor, renderer, version, profile and glewExperimental seen.
+ * A new one is filled in with no lock held and copied in with the lock
+ * held; once counted in _glewNumSharedContexts it is only read, by any
+ * thread, with no lock, until the program exits.
+ */
+
+#ifndef GLEW_MX_TLS_CONTEXTS
+#  define GLEW_MX_TLS_CONTEXTS 8
+#endif
+
+#ifndef GL_CONTEXT_PROFILE_MASK
+#  define GL_CONTEXT_PROFILE_MASK 0x9126
+#endif
+
+#define _GLEW_KEY_SIZE 512
+
+typedef struct
+{
+  GLEWContext gl; /* first, glewMakeContextCurrent gets from it to the rest */
+#if defined(_WIN32)
+  WGLEWContext wgl;
+#elif !defined(__ANDROID__) && !defined(__native_client__) && !defined(__HAIKU__) && (!defined(__APPLE__) || defined(GLEW_APPLE_GLX))
+  GLXEWContext glx;
+#endif
+  const void* display;
+  GLubyte key[_GLEW_KEY_SIZE];
+  GLuint keyLen;
+  GLint profile;
+  GLboolean experimental;
+} _GLEWSharedContext;
+
+static _GLEWSharedContext _glewSharedContext[GLEW_MX_TLS_CONTEXTS];
+static volatile GLuint _glewNumSharedContexts = 0;
+static volatile long _glewSharedContextLock = 0;
+
+#if defined(_MSC_VER)
+#  include <intrin.h>
+#  define _glewLock(l) while (_InterlockedExchange(&l, 1)) {}
+#  define _glewUnlock(l) _InterlockedExchange(&l, 0)
+#  define _glewFence() MemoryBarrier()
+#else
+#  define _glewLock(l) while (__sync_lock_test_and_set(&l, 1)) {}
+#  define _glewUnlock(l) __sync_lock_release(&l)
+#  define _glewFence() __sync_synchronize()
+#endif
+
+GLEW_THREAD_LOCAL GLEWContext* __glewCurrentContext = NULL;
+#if defined(_WIN32)
+GLEW_THREAD_LOCAL WGLEWContext* __wglewCurrentContext = NULL;
+#elif !defined(__ANDROID__) && !defined(__native_client__) && !defined(__HAIKU__) && (!defined(__APPLE__) || defined(GLEW_APPLE_GLX))
+GLEW_THREAD_LOCAL GLXEWContext* __glxewCurrentContext = NULL;
+#endif
+
+/* the X server on GLX, where contexts alike on two are not the same */
+static const void* _glewContextDisplay (void)
+{
+#if !defined(_WIN32) && !defined(__ANDROID__) && !defined(__native_client__) && !defined(__HAIKU__) && (!defined(__APPLE__) || defined(GLEW_APPLE_GLX))
+  /* (glXGetCurrentDisplay is only loaded by glxewContextInit) */
+  PFNGLXGETCURRENTDISPLAYPROC getCurrentDisplay = (PFNGLXGETCURRENTDISPLAYPROC)glewGetProcAddress((const GLubyte*)"glXGetCurrentDisplay");
+  return getCurrentDisplay != NULL ? (const void*)getCurrentDisplay() : NULL;
+#else
+  return NULL;
+#endif
+}
+
+/* vendor, renderer and version, one after the other; and the profile */
+static GLuint _glewContextKey (GLubyte* key, GLint* profile)
+{
+  static const GLenum name[3] = { GL_VENDOR, GL_RENDERER, GL_VERSION };
+  const GLubyte* s;
+  GLuint i, n = 0, dot;
+  for (i = 0; i < 3; i++)
+  {
+    s = glGetString(name[i]);
+    while (s != NULL && *s != '\0' && n < _GLEW_KEY_SIZE - 1)
+      key[n++] = *s++;
+    if (n < _GLEW_KEY_SIZE - 1)
+      key[n++] = '\n';
+  }
+  /* only 3.2 and up know about profiles, asking older ones is an error */
+  *profile = 0;
+  s = glGetString(GL_VERSION);
+  dot = _glewStrCLen(s, '.');
+  if (dot != 0 && s[dot] == '.' && (s[dot-1] > '3' || (s[dot-1] == '3' && s[dot+1] >= '2')))
+    glGetIntegerv(GL_CONTEXT_PROFILE_MASK, profile);
+  return n;
+}
+
+/* the first n, the ones published */
+static _GLEWSharedContext* _glewFindSharedContext (const _GLEWSharedContext* c, GLuint n)
+{
+  GLuint i;
+  for (i = 0; i < n; i++)
+  {
+    if (_glewSharedContext[i].display == c->display && _glewSharedContext[i].keyLen == c->keyLen &&
+        _glewSharedContext[i].profile == c->profile && _glewSharedContext[i].experimental == c->experimental &&
+        _glewStrSame(_glewSharedContext[i].key, c->key, c->keyLen))
+      return &_glewSharedContext[i];
+  }
+  return NULL;
+}
+
+/* two threads seeing a new context at once both fill it in, and the
+   first to publish it is the one both use */
+GLenum GLEWAPIENTRY glewCurrentContextInit (void)
+{
+  _GLEWSharedContext filled;
+  _GLEWSharedContext* c;
+  GLuint n;
+  GLenum r = GLEW_OK;
+  filled.display = _glewContextDisplay();
+  filled.keyLen = _glewContextKey(filled.key, &filled.profile);
+  filled.experimental = glewExperimental;
+  n = _glewNumSharedContexts;
+  _glewFence();
+  c = _glewFindSharedContext(&filled, n);
+  if (c == NULL && n == GLEW_MX_TLS_CONTEXTS)
+    return GLEW_ERROR_TOO_MANY_CONTEXTS;
+  if (c == NULL)
+  {
+    r = glewContextInit(&filled.gl);
+#if defined(_WIN32)
+    if (r == GLEW_OK) r = wglewContextInit(&filled.wgl);
+#elif !defined(__ANDROID__) && !defined(__native_client__) && !defined(__HAIKU__) && (!defined(__APPLE__) || defined(GLEW_APPLE_GLX))
+    if (r == GLEW_OK) r = glxewContextInit(&filled.glx);
+#endif
+    if (r != GLEW_OK)
+      return r;
+    _glewLock(_glewSharedContextLock);
+    n = _glewNumSharedContexts;
+    c = _glewFindSharedContext(&filled, n);
+    if (c == NULL && n == GLEW_MX_TLS_CONTEXTS)
+      r = GLEW_ERROR_TOO_MANY_CONTEXTS;
+    else if (c == NULL)
+    {
+      c = &_glewSharedContext[n];
+      *c = filled;
+      /* the copy is seen before the count, by threads reading with no lock */
+      _glewFence();
+      _glewNumSharedContexts = n + 1;
+    }
+    _glewUnlock(_glewSharedContextLock);
+  }
+  if (c != NULL)
+    glewMakeContextCurrent(&c->gl);
+  return r;
+}
+
+GLEWContext* GLEWAPIENTRY glewGetCurrentContext (void)
+{
+  return __glewCurrentContext;
+}
+
+/* ctx is NULL, one glewGetCurrentContext returned or one of your own;
+   only the first two also switch the WGL or GLX context */
+void GLEWAPIENTRY glewMakeContextCurrent (GLEWContext* ctx)
+{
+  const char* p = (const char*)ctx;
+  __glewCurrentContext = ctx;
+  if (ctx != NULL && (p < (const char*)_glewSharedContext || p >= (const char*)(_glewSharedContext + GLEW_MX_TLS_CONTEXTS)))
+    return;
+#if defined(_WIN32)
+  __wglewCurrentContext = ctx != NULL ? &((_GLEWSharedContext*)ctx)->wgl : NULL;
+#elif !defined(__ANDROID__) && !defined(__native_client__) && !defined(__HAIKU__) && (!defined(__APPLE__) || defined(GLEW_APPLE_GLX))
+  __glxewCurrentContext = ctx != NULL ? &((_GLEWSharedContext*)ctx)->glx : NULL;
+#endif
+}
+
+#if defined(_WIN32)
+WGLEWContext* GLEWAPIENTRY wglewGetCurrentContext (void)
+{
+  return __wglewCurrentContext;
+}
+#endif /* _WIN32 */
+
+#endif /* GLEW_MX */
@@ -25,6 +25,7 @@ GLenum GLEWAPIENTRY wglewContextInit (WGLEW_CONTEXT_ARG_DEF_LIST)
   GLboolean crippled;
   const GLubyte* extStart;
   const GLubyte* extEnd;
+  _GLEWExtensionSet extSet;
   /* find wgl extension string query functions */
   _wglewGetExtensionsStringARB = (PFNWGLGETEXTENSIONSSTRINGARBPROC)glewGetProcAddress((const GLubyte*)"wglGetExtensionsStringARB");
   _wglewGetExtensionsStringEXT = (PFNWGLGETEXTENSIONSSTRINGEXTPROC)glewGetProcAddress((const GLubyte*)"wglGetExtensionsStringEXT");
@@ -37,5 +38,6 @@ GLenum GLEWAPIENTRY wglewContextInit (WGLEW_CONTEXT_ARG_DEF_LIST)
   else
     extStart = (const GLubyte*)_wglewGetExtensionsStringARB(wglGetCurrentDC());
   extEnd = extStart + _glewStrLen(extStart);
+  _glewInitExtensionSet(&extSet, extStart, extEnd);
   /* initialize extensions */
   crippled = _wglewGetExtensionsStringARB == NULL && _wglewGetExtensionsStringEXT == NULL;
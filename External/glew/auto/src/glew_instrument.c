@@ -0,0 +1,249 @@
+
+/* ------------------------------------------------------------------------ */
+
+/*
+ * GLEW_INSTRUMENT runtime.  Every call through a wrapper counts towards
+ * its function in the frame in progress and goes into a ring of the last
+ * GLEW_INSTRUMENT_CALLS calls.  Nothing takes a lock: the counters are
+ * added to atomically, a call claims its slot in the ring with an atomic
+ * add and marks it complete with its number, so a reader can skip the
+ * slots being written.  glewInstrumentFrame is for one thread at a time.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#if !defined(_WIN32)
+#  include <time.h>
+#endif
+
+#ifndef GLEW_INSTRUMENT_CALLS
+#  define GLEW_INSTRUMENT_CALLS 4096 /* a power of two */
+#endif
+
+#if defined(_WIN32)
+#  define _glewAtomicAdd(p, v) (GLuint64EXT)InterlockedExchangeAdd64((volatile LONGLONG*)(p), (LONGLONG)(v))
+#  define _glewAtomicTake(p) (GLuint64EXT)InterlockedAnd64((volatile LONGLONG*)(p), 0)
+#  define _glewWriteBarrier() MemoryBarrier()
+#  define _glewReadBarrier() MemoryBarrier()
+#else
+#  define _glewAtomicAdd(p, v) __sync_fetch_and_add((p), (GLuint64EXT)(v))
+#  define _glewAtomicTake(p) __sync_fetch_and_and((p), (GLuint64EXT)0)
+/* the ring slots are written and read as a sequence lock: the release
+   fences keep a slot's stores between the two stores of seq, the acquire
+   fences its loads between the two loads of seq.  On x86 they compile to
+   no instruction and only keep the compiler from moving the accesses;
+   on ARM and POWER they are barrier instructions */
+#  define _glewWriteBarrier() __atomic_thread_fence(__ATOMIC_RELEASE)
+#  define _glewReadBarrier() __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#endif
+
+typedef struct
+{
+  volatile GLuint64EXT calls; /* in the frame in progress */
+  volatile GLuint64EXT ns;
+  GLuint64EXT lastCalls;      /* in the last frame */
+  GLuint64EXT lastNs;
+  GLuint64EXT totalCalls;     /* in all the frames before */
+  GLuint64EXT totalNs;
+} _GLEWInstrumentCounter;
+
+typedef struct
+{
+  volatile GLuint64EXT seq;   /* number of the call + 1, 0 while it is written */
+  GLuint64EXT frame;
+  GLuint64EXT ns;
+  GLuint64EXT arg[4];
+  GLuint function;
+} _GLEWInstrumentSlot;
+
+static _GLEWInstrumentCounter _glewInstrumentCounter[_GLEW_INSTRUMENT_FUNCTIONS];
+static _GLEWInstrumentSlot _glewInstrumentRing[GLEW_INSTRUMENT_CALLS];
+static volatile GLuint64EXT _glewInstrumentNextCall = 0;
+static volatile GLuint64EXT _glewInstrumentFrameNumber = 0;
+#if defined(_WIN32)
+static GLuint64EXT _glewInstrumentTicksPerSecond = 1;
+#endif
+
+static GLuint64EXT _glewInstrumentNow (void)
+{
+#if defined(_WIN32)
+  LARGE_INTEGER t;
+  QueryPerformanceCounter(&t);
+  return (GLuint64EXT)t.QuadPart;
+#else
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (GLuint64EXT)t.tv_sec * 1000000000u + (GLuint64EXT)t.tv_nsec;
+#endif
+}
+
+static GLuint64EXT _glewInstrumentFloat (double f)
+{
+  union { double f; GLuint64EXT u; } v;
+  v.f = f;
+  return v.u;
+}
+
+static void _glewInstrumentEnd (GLuint function, GLuint64EXT start, GLuint64EXT a0, GLuint64EXT a1, GLuint64EXT a2, GLuint64EXT a3)
+{
+  GLuint64EXT ns = _glewInstrumentNow() - start;
+  GLuint64EXT n;
+  _GLEWInstrumentSlot* s;
+#if defined(_WIN32)
+  ns = ns * 1000000000u / _glewInstrumentTicksPerSecond;
+#endif
+  _glewAtomicAdd(&_glewInstrumentCounter[function].calls, 1);
+  _glewAtomicAdd(&_glewInstrumentCounter[function].ns, ns);
+  n = _glewAtomicAdd(&_glewInstrumentNextCall, 1);
+  s = &_glewInstrumentRing[n & (GLEW_INSTRUMENT_CALLS - 1)];
+  s->seq = 0;
+  _glewWriteBarrier();
+  s->frame = _glewInstrumentFrameNumber;
+  s->ns = ns;
+  s->arg[0] = a0;
+  s->arg[1] = a1;
+  s->arg[2] = a2;
+  s->arg[3] = a3;
+  s->function = function;
+  _glewWriteBarrier();
+  s->seq = n + 1;
+}
+
+void _glewInstrumentInit (void)
+{
+#if defined(_WIN32)
+  LARGE_INTEGER f;
+  QueryPerformanceFrequency(&f);
+  _glewInstrumentTicksPerSecond = (GLuint64EXT)f.QuadPart;
+#endif
+  _glewInstrumentWrap();
+}
+
+void GLEWAPIENTRY glewInstrumentFrame (void)
+{
+  GLuint i;
+  for (i = 0; i < _GLEW_INSTRUMENT_FUNCTIONS; i++)
+  {
+    _GLEWInstrumentCounter* c = &_glewInstrumentCounter[i];
+    /* a call that comes in after this counts towards the next frame */
+    if (c->calls == 0)
+    {
+      c->lastCalls = c->lastNs = 0;
+      continue;
+    }
+    c->lastCalls = _glewAtomicTake(&c->calls);
+    c->lastNs = _glewAtomicTake(&c->ns);
+    c->totalCalls += c->lastCalls;
+    c->totalNs += c->lastNs;
+  }
+  _glewInstrumentFrameNumber++;
+}
+
+GLuint GLEWAPIENTRY glewInstrumentStats (GLEWInstrumentStat* stats, GLuint max)
+{
+  GLuint i, n = 0;
+  for (i = 0; i < _GLEW_INSTRUMENT_FUNCTIONS && n < max; i++)
+  {
+    const _GLEWInstrumentCounter* c = &_glewInstrumentCounter[i];
+    if (c->totalCalls + c->calls == 0)
+      continue;
+    stats[n].name = _glewInstrumentName[i];
+    stats[n].calls = c->totalCalls + c->calls;
+    stats[n].ns = c->totalNs + c->ns;
+    stats[n].frameCalls = c->lastCalls;
+    stats[n].frameNs = c->lastNs;
+    n++;
+  }
+  return n;
+}
+
+GLuint GLEWAPIENTRY glewInstrumentCalls (GLEWInstrumentCall* calls, GLuint max)
+{
+  GLuint64EXT end = _glewInstrumentNextCall;
+  GLuint64EXT n = end > max ? end - max : 0;
+  GLuint count = 0, i;
+  if (end - n > GLEW_INSTRUMENT_CALLS)
+    n = end - GLEW_INSTRUMENT_CALLS;
+  for (; n < end; n++)
+  {
+    const _GLEWInstrumentSlot* s = &_glewInstrumentRing[n & (GLEW_INSTRUMENT_CALLS - 1)];
+    GLEWInstrumentCall* c = &calls[count];
+    if (s->seq != n + 1)
+      continue;
+    _glewReadBarrier();
+    c->name = _glewInstrumentName[s->function];
+    c->args = _glewInstrumentArgs[s->function];
+    c->frame = s->frame;
+    c->ns = s->ns;
+    for (i = 0; i < 4; i++)
+      c->arg[i] = s->arg[i];
+    _glewReadBarrier();
+    /* overwritten while it was read */
+    if (s->seq != n + 1)
+      continue;
+    count++;
+  }
+  return count;
+}
+
+static int _glewInstrumentCompare (const void* a, const void* b)
+{
+  GLuint64EXT x = _glewInstrumentCounter[*(const GLuint*)a].lastNs;
+  GLuint64EXT y = _glewInstrumentCounter[*(const GLuint*)b].lastNs;
+  return x < y ? 1 : x > y ? -1 : 0;
+}
+
+static void _glewInstrumentPrintCall (FILE* file, const GLEWInstrumentCall* c)
+{
+  GLuint i;
+  fprintf(file, "  %llu %s(", (unsigned long long)c->frame, c->name);
+  for (i = 0; c->args[i] != '\0' && c->args[i] != '.'; i++)
+  {
+    union { GLuint64EXT u; double f; } v;
+    v.u = c->arg[i];
+    if (i) fprintf(file, ", ");
+    switch (c->args[i])
+    {
+      case 'e': fprintf(file, "0x%04llx", (unsigned long long)c->arg[i]); break;
+      case 'i': fprintf(file, "%lld", (long long)c->arg[i]); break;
+      case 'u': fprintf(file, "%llu", (unsigned long long)c->arg[i]); break;
+      case 'f': fprintf(file, "%g", v.f); break;
+      default: fprintf(file, "0x%llx", (unsigned long long)c->arg[i]); break;
+    }
+  }
+  fprintf(file, "%s) %.3f us\n", c->args[i] == '.' ? ", ..." : "", c->ns / 1000.0);
+}
+
+/* the last frame, most time first, and the last calls */
+void GLEWAPIENTRY glewInstrumentReport (FILE* file)
+{
+  static const char bar[] = "########################################";
+  GLuint order[_GLEW_INSTRUMENT_FUNCTIONS];
+  GLEWInstrumentCall calls[16];
+  GLuint64EXT totalCalls = 0, totalNs = 0, maxNs;
+  GLuint i, n = 0;
+  for (i = 0; i < _GLEW_INSTRUMENT_FUNCTIONS; i++)
+  {
+    if (_glewInstrumentCounter[i].lastCalls == 0)
+      continue;
+    order[n++] = i;
+    totalCalls += _glewInstrumentCounter[i].lastCalls;
+    totalNs += _glewInstrumentCounter[i].lastNs;
+  }
+  qsort(order, n, sizeof(*order), _glewInstrumentCompare);
+  fprintf(file, "frame %llu: %llu calls, %.3f ms\n",
+          (unsigned long long)(_glewInstrumentFrameNumber ? _glewInstrumentFrameNumber - 1 : 0),
+          (unsigned long long)totalCalls, totalNs / 1000000.0);
+  maxNs = n ? _glewInstrumentCounter[order[0]].lastNs : 0;
+  for (i = 0; i < n; i++)
+  {
+    const _GLEWInstrumentCounter* c = &_glewInstrumentCounter[order[i]];
+    int len = maxNs ? (int)((sizeof(bar) - 1) * c->lastNs / maxNs) : 0;
+    fprintf(file, "  %-36s %8llu calls %10.3f us %.*s\n", _glewInstrumentName[order[i]],
+            (unsigned long long)c->lastCalls, c->lastNs / 1000.0, len > 0 ? len : 1, bar);
+  }
+  n = glewInstrumentCalls(calls, sizeof(calls)/sizeof(*calls));
+  fprintf(file, "last %u calls:\n", n);
+  for (i = 0; i < n; i++)
+    _glewInstrumentPrintCall(file, &calls[i]);
+}
@@ -0,0 +1,27 @@
+#if defined(GLEW_STATE_CACHE)
+#  define GLEW_STATE_CACHE_BUILD
+#endif
+#include <GL/glew.h>
+
+#if defined(_WIN32)
+#  include <GL/wglew.h>
+#endif
+
+#include <stddef.h>  /* For size_t */
+
+/*
+ * GLEW_INSTRUMENT wrappers and the runtime behind them.  glewInit calls
+ * _glewInstrumentInit, which points every GL function it loaded at its
+ * wrapper.  Only GLEW_INSTRUMENT builds need this file.
+ */
+#if defined(GLEW_INSTRUMENT)
+
+#if defined(GLEW_MX) || defined(GLEW_LAZY)
+#  error "GLEW_INSTRUMENT does not work with GLEW_MX or GLEW_LAZY"
+#endif
+
+static GLuint64EXT _glewInstrumentNow (void);
+static GLuint64EXT _glewInstrumentFloat (double f);
+static void _glewInstrumentEnd (GLuint function, GLuint64EXT start, GLuint64EXT a0, GLuint64EXT a1, GLuint64EXT a2, GLuint64EXT a3);
+#define _GLEW_INSTRUMENT_WRAP(fun, wrapper, i) \
+  if (fun != NULL && fun != wrapper) { _glewInstrumentReal[i] = (void (*)(void))fun; fun = wrapper; }
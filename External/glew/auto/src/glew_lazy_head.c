@@ -0,0 +1,25 @@
+#if defined(GLEW_STATE_CACHE)
+#  define GLEW_STATE_CACHE_BUILD
+#endif
+#include <GL/glew.h>
+
+#if defined(_WIN32)
+#  include <GL/wglew.h>
+#elif !defined(__ANDROID__) && !defined(__native_client__) && !defined(__HAIKU__) && (!defined(__APPLE__) || defined(GLEW_APPLE_GLX))
+#  include <GL/glxew.h>
+#endif
+
+/*
+ * GLEW_LAZY function pointers, each starting out at a trampoline that
+ * loads the function through glew.c, points the function pointer at it
+ * and calls it.  Only GLEW_LAZY builds need this file; glew.c leaves
+ * the function pointers out when GLEW_LAZY is defined.
+ */
+#if defined(GLEW_LAZY)
+
+#if defined(GLEW_MX)
+#  error "GLEW_LAZY does not work with GLEW_MX"
+#endif
+
+extern void* _glewLazyGetProcAddress (const GLubyte* name);
+#define glewGetProcAddress(name) _glewLazyGetProcAddress(name)
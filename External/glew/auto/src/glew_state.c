@@ -0,0 +1,558 @@
+
+/* ------------------------------------------------------------------------ */
+
+/*
+ * GLEW_STATE_CACHE: a shadow of the state the glewCache functions below
+ * set, so that a call setting what is already set does not go to the
+ * driver.  A value not known, after glewInit, glewStateCacheInvalidate
+ * or a call that changes it in a way not followed, is
+ * _GLEW_CACHE_UNKNOWN, and the next call setting it goes through.  A
+ * call that fails is taken to have worked: repeating it is dropped, and
+ * so is the error it would raise again.
+ */
+
+#define _GLEW_CACHE_UNKNOWN 0xffffffffu
+#define _GLEW_CACHE_UNITS 32
+#define _GLEW_CACHE_COUNT(a) (sizeof(a)/sizeof(*(a)))
+
+/* the binding points and state followed, anything else goes through */
+static const GLenum _glewCacheBufferTarget[] =
+{
+  0x8892, /* GL_ARRAY_BUFFER */
+  0x8893, /* GL_ELEMENT_ARRAY_BUFFER */
+  0x88EB, /* GL_PIXEL_PACK_BUFFER */
+  0x88EC, /* GL_PIXEL_UNPACK_BUFFER */
+  0x8A11, /* GL_UNIFORM_BUFFER */
+  0x8C2A, /* GL_TEXTURE_BUFFER */
+  0x8C8E, /* GL_TRANSFORM_FEEDBACK_BUFFER */
+  0x8F36, /* GL_COPY_READ_BUFFER */
+  0x8F37, /* GL_COPY_WRITE_BUFFER */
+  0x8F3F, /* GL_DRAW_INDIRECT_BUFFER */
+  0x90D2, /* GL_SHADER_STORAGE_BUFFER */
+  0x90EE, /* GL_DISPATCH_INDIRECT_BUFFER */
+  0x92C0, /* GL_ATOMIC_COUNTER_BUFFER */
+  0x9192  /* GL_QUERY_BUFFER */
+};
+
+/* part of the vertex array object, see glewCacheBindVertexArray */
+#define _GLEW_CACHE_ELEMENT_ARRAY_BUFFER 1
+
+static const GLenum _glewCacheTextureTarget[] =
+{
+  0x0DE0, /* GL_TEXTURE_1D */
+  0x0DE1, /* GL_TEXTURE_2D */
+  0x806F, /* GL_TEXTURE_3D */
+  0x84F5, /* GL_TEXTURE_RECTANGLE */
+  0x8513, /* GL_TEXTURE_CUBE_MAP */
+  0x8C18, /* GL_TEXTURE_1D_ARRAY */
+  0x8C1A, /* GL_TEXTURE_2D_ARRAY */
+  0x8C2A, /* GL_TEXTURE_BUFFER */
+  0x9009, /* GL_TEXTURE_CUBE_MAP_ARRAY */
+  0x9100, /* GL_TEXTURE_2D_MULTISAMPLE */
+  0x9102  /* GL_TEXTURE_2D_MULTISAMPLE_ARRAY */
+};
+
+static const GLenum _glewCacheCap[] =
+{
+  0x0B44, /* GL_CULL_FACE */
+  0x0B71, /* GL_DEPTH_TEST */
+  0x0B90, /* GL_STENCIL_TEST */
+  0x0BE2, /* GL_BLEND */
+  0x0C11, /* GL_SCISSOR_TEST */
+  0x8037, /* GL_POLYGON_OFFSET_FILL */
+  0x809D, /* GL_MULTISAMPLE */
+  0x884F, /* GL_TEXTURE_CUBE_MAP_SEAMLESS */
+  0x8DB9, /* GL_FRAMEBUFFER_SRGB */
+  0x8F9D  /* GL_PRIMITIVE_RESTART */
+};
+
+static const GLenum _glewCachePixelStore[] =
+{
+  0x0CF2, /* GL_UNPACK_ROW_LENGTH */
+  0x0CF3, /* GL_UNPACK_SKIP_ROWS */
+  0x0CF4, /* GL_UNPACK_SKIP_PIXELS */
+  0x0CF5, /* GL_UNPACK_ALIGNMENT */
+  0x0D02, /* GL_PACK_ROW_LENGTH */
+  0x0D03, /* GL_PACK_SKIP_ROWS */
+  0x0D04, /* GL_PACK_SKIP_PIXELS */
+  0x0D05, /* GL_PACK_ALIGNMENT */
+  0x806D, /* GL_UNPACK_SKIP_IMAGES */
+  0x806E  /* GL_UNPACK_IMAGE_HEIGHT */
+};
+
+static struct
+{
+  GLuint program;
+  GLuint vertexArray;
+  GLuint buffer[_GLEW_CACHE_COUNT(_glewCacheBufferTarget)];
+  GLuint activeTexture;
+  GLuint texture[_GLEW_CACHE_UNITS][_GLEW_CACHE_COUNT(_glewCacheTextureTarget)];
+  GLuint cap[_GLEW_CACHE_COUNT(_glewCacheCap)];
+  GLuint blendFunc[4]; /* as glBlendFuncSeparate takes them */
+  GLuint blendEquation[2];
+  GLuint depthFunc;
+  GLuint depthMask;
+  GLuint viewport[4];
+  GLuint pixelStore[_GLEW_CACHE_COUNT(_glewCachePixelStore)];
+} _glewCache;
+
+/* the calls that can be dropped, counted */
+enum
+{
+  _GLEW_CACHE_ACTIVE_TEXTURE,
+  _GLEW_CACHE_BIND_BUFFER,
+  _GLEW_CACHE_BIND_TEXTURE,
+  _GLEW_CACHE_BIND_VERTEX_ARRAY,
+  _GLEW_CACHE_BLEND_EQUATION,
+  _GLEW_CACHE_BLEND_EQUATION_SEPARATE,
+  _GLEW_CACHE_BLEND_FUNC,
+  _GLEW_CACHE_BLEND_FUNC_SEPARATE,
+  _GLEW_CACHE_DEPTH_FUNC,
+  _GLEW_CACHE_DEPTH_MASK,
+  _GLEW_CACHE_DISABLE,
+  _GLEW_CACHE_ENABLE,
+  _GLEW_CACHE_PIXEL_STORE_I,
+  _GLEW_CACHE_USE_PROGRAM,
+  _GLEW_CACHE_VIEWPORT,
+  _GLEW_CACHE_ENTRIES
+};
+
+static const char* const _glewCacheName[_GLEW_CACHE_ENTRIES] =
+{
+  "glActiveTexture",
+  "glBindBuffer",
+  "glBindTexture",
+  "glBindVertexArray",
+  "glBlendEquation",
+  "glBlendEquationSeparate",
+  "glBlendFunc",
+  "glBlendFuncSeparate",
+  "glDepthFunc",
+  "glDepthMask",
+  "glDisable",
+  "glEnable",
+  "glPixelStorei",
+  "glUseProgram",
+  "glViewport"
+};
+
+static GLuint64EXT _glewCacheCalls[_GLEW_CACHE_ENTRIES];
+static GLuint64EXT _glewCacheDropped[_GLEW_CACHE_ENTRIES];
+
+static GLuint _glewCacheIndex (const GLenum* list, GLuint n, GLenum e)
+{
+  GLuint i;
+  for (i = 0; i < n; i++)
+  {
+    if (list[i] == e) return i;
+  }
+  return n;
+}
+
+/* counts the call and tells if it has to go to the driver */
+static GLboolean _glewCacheSet (GLuint entry, GLuint* slot, const GLuint* value, GLuint n)
+{
+  GLuint i;
+  _glewCacheCalls[entry]++;
+  for (i = 0; i < n; i++)
+  {
+    if (slot[i] != value[i] || value[i] == _GLEW_CACHE_UNKNOWN)
+      break;
+  }
+  if (i == n)
+  {
+    _glewCacheDropped[entry]++;
+    return GL_FALSE;
+  }
+  for (i = 0; i < n; i++)
+    slot[i] = value[i];
+  return GL_TRUE;
+}
+
+static void _glewCacheForget (GLuint* slot, GLuint n)
+{
+  GLuint i;
+  for (i = 0; i < n; i++)
+    slot[i] = _GLEW_CACHE_UNKNOWN;
+}
+
+/* a deleted object is unbound from where it was bound */
+static void _glewCacheDeleted (GLuint* slot, GLuint n, GLsizei count, const GLuint* names)
+{
+  GLsizei i;
+  GLuint j;
+  for (i = 0; i < count; i++)
+  {
+    for (j = 0; j < n; j++)
+    {
+      if (names[i] != 0 && slot[j] == names[i])
+        slot[j] = 0;
+    }
+  }
+}
+
+void GLEWAPIENTRY glewStateCacheInvalidate (void)
+{
+  _glewCacheForget((GLuint*)&_glewCache, sizeof(_glewCache)/sizeof(GLuint));
+}
+
+GLuint GLEWAPIENTRY glewStateCacheStats (GLEWStateCacheStat* stats, GLuint max)
+{
+  GLuint i;
+  for (i = 0; i < _GLEW_CACHE_ENTRIES && i < max; i++)
+  {
+    stats[i].name = _glewCacheName[i];
+    stats[i].calls = _glewCacheCalls[i];
+    stats[i].dropped = _glewCacheDropped[i];
+  }
+  return i;
+}
+
+/* ------------------------------------------------------------------------ */
+
+void GLAPIENTRY glewCacheBindTexture (GLenum target, GLuint texture)
+{
+  GLuint t = _glewCacheIndex(_glewCacheTextureTarget, _GLEW_CACHE_COUNT(_glewCacheTextureTarget), target);
+  GLuint unit = _glewCache.activeTexture - 0x84C0; /* GL_TEXTURE0 */
+  GLuint u;
+  if (t < _GLEW_CACHE_COUNT(_glewCacheTextureTarget) && unit < _GLEW_CACHE_UNITS)
+  {
+    if (!_glewCacheSet(_GLEW_CACHE_BIND_TEXTURE, &_glewCache.texture[unit][t], &texture, 1))
+      return;
+  }
+  else
+  {
+    _glewCacheCalls[_GLEW_CACHE_BIND_TEXTURE]++;
+    /* the active unit is not known, so neither is what this binds to */
+    if (t < _GLEW_CACHE_COUNT(_glewCacheTextureTarget) && _glewCache.activeTexture == _GLEW_CACHE_UNKNOWN)
+    {
+      for (u = 0; u < _GLEW_CACHE_UNITS; u++)
+        _glewCache.texture[u][t] = _GLEW_CACHE_UNKNOWN;
+    }
+  }
+  glBindTexture(target, texture);
+}
+
+void GLAPIENTRY glewCacheDeleteTextures (GLsizei n, const GLuint* textures)
+{
+  _glewCacheDeleted(&_glewCache.texture[0][0], sizeof(_glewCache.texture)/sizeof(GLuint), n, textures);
+  glDeleteTextures(n, textures);
+}
+
+/* a texture bound to a unit without a target given goes to its own
+   target, which is not known here: the unit is forgotten, unless the
+   texture is 0, which unbinds every target */
+static void _glewCacheBoundToUnit (GLuint unit, GLuint texture)
+{
+  GLuint t;
+  if (unit >= _GLEW_CACHE_UNITS)
+    return;
+  for (t = 0; t < _GLEW_CACHE_COUNT(_glewCacheTextureTarget); t++)
+    _glewCache.texture[unit][t] = texture == 0 ? 0 : _GLEW_CACHE_UNKNOWN;
+}
+
+static void _glewCacheEnable (GLuint entry, GLenum cap, GLuint value)
+{
+  GLuint c = _glewCacheIndex(_glewCacheCap, _GLEW_CACHE_COUNT(_glewCacheCap), cap);
+  if (c < _GLEW_CACHE_COUNT(_glewCacheCap))
+  {
+    if (!_glewCacheSet(entry, &_glewCache.cap[c], &value, 1))
+      return;
+  }
+  else
+    _glewCacheCalls[entry]++;
+  if (value)
+    glEnable(cap);
+  else
+    glDisable(cap);
+}
+
+void GLAPIENTRY glewCacheEnable (GLenum cap)
+{
+  _glewCacheEnable(_GLEW_CACHE_ENABLE, cap, GL_TRUE);
+}
+
+void GLAPIENTRY glewCacheDisable (GLenum cap)
+{
+  _glewCacheEnable(_GLEW_CACHE_DISABLE, cap, GL_FALSE);
+}
+
+void GLAPIENTRY glewCacheBlendFunc (GLenum sfactor, GLenum dfactor)
+{
+  GLuint v[4];
+  v[0] = v[2] = sfactor;
+  v[1] = v[3] = dfactor;
+  if (_glewCacheSet(_GLEW_CACHE_BLEND_FUNC, _glewCache.blendFunc, v, 4))
+    glBlendFunc(sfactor, dfactor);
+}
+
+void GLAPIENTRY glewCacheDepthFunc (GLenum func)
+{
+  if (_glewCacheSet(_GLEW_CACHE_DEPTH_FUNC, &_glewCache.depthFunc, &func, 1))
+    glDepthFunc(func);
+}
+
+void GLAPIENTRY glewCacheDepthMask (GLboolean flag)
+{
+  GLuint v = flag;
+  if (_glewCacheSet(_GLEW_CACHE_DEPTH_MASK, &_glewCache.depthMask, &v, 1))
+    glDepthMask(flag);
+}
+
+void GLAPIENTRY glewCacheViewport (GLint x, GLint y, GLsizei width, GLsizei height)
+{
+  GLuint v[4];
+  v[0] = (GLuint)x;
+  v[1] = (GLuint)y;
+  v[2] = (GLuint)width;
+  v[3] = (GLuint)height;
+  if (_glewCacheSet(_GLEW_CACHE_VIEWPORT, _glewCache.viewport, v, 4))
+    glViewport(x, y, width, height);
+}
+
+void GLAPIENTRY glewCachePixelStorei (GLenum pname, GLint param)
+{
+  GLuint p = _glewCacheIndex(_glewCachePixelStore, _GLEW_CACHE_COUNT(_glewCachePixelStore), pname);
+  GLuint v = (GLuint)param;
+  if (p < _GLEW_CACHE_COUNT(_glewCachePixelStore))
+  {
+    if (!_glewCacheSet(_GLEW_CACHE_PIXEL_STORE_I, &_glewCache.pixelStore[p], &v, 1))
+      return;
+  }
+  else
+    _glewCacheCalls[_GLEW_CACHE_PIXEL_STORE_I]++;
+  glPixelStorei(pname, param);
+}
+
+void GLAPIENTRY glewCachePixelStoref (GLenum pname, GLfloat param)
+{
+  GLuint p = _glewCacheIndex(_glewCachePixelStore, _GLEW_CACHE_COUNT(_glewCachePixelStore), pname);
+  if (p < _GLEW_CACHE_COUNT(_glewCachePixelStore))
+    _glewCache.pixelStore[p] = _GLEW_CACHE_UNKNOWN;
+  glPixelStoref(pname, param);
+}
+
+#ifdef GL_VERSION_1_3
+void GLAPIENTRY glewCacheActiveTexture (GLenum texture)
+{
+  if (_glewCacheSet(_GLEW_CACHE_ACTIVE_TEXTURE, &_glewCache.activeTexture, &texture, 1))
+    glActiveTexture(texture);
+}
+#endif
+
+#ifdef GL_VERSION_1_4
+void GLAPIENTRY glewCacheBlendFuncSeparate (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+{
+  GLuint v[4];
+  v[0] = sfactorRGB;
+  v[1] = dfactorRGB;
+  v[2] = sfactorAlpha;
+  v[3] = dfactorAlpha;
+  if (_glewCacheSet(_GLEW_CACHE_BLEND_FUNC_SEPARATE, _glewCache.blendFunc, v, 4))
+    glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+
+void GLAPIENTRY glewCacheBlendEquation (GLenum mode)
+{
+  GLuint v[2];
+  v[0] = v[1] = mode;
+  if (_glewCacheSet(_GLEW_CACHE_BLEND_EQUATION, _glewCache.blendEquation, v, 2))
+    glBlendEquation(mode);
+}
+#endif
+
+#ifdef GL_VERSION_1_5
+void GLAPIENTRY glewCacheBindBuffer (GLenum target, GLuint buffer)
+{
+  GLuint b = _glewCacheIndex(_glewCacheBufferTarget, _GLEW_CACHE_COUNT(_glewCacheBufferTarget), target);
+  if (b < _GLEW_CACHE_COUNT(_glewCacheBufferTarget))
+  {
+    if (!_glewCacheSet(_GLEW_CACHE_BIND_BUFFER, &_glewCache.buffer[b], &buffer, 1))
+      return;
+  }
+  else
+    _glewCacheCalls[_GLEW_CACHE_BIND_BUFFER]++;
+  glBindBuffer(target, buffer);
+}
+
+void GLAPIENTRY glewCacheDeleteBuffers (GLsizei n, const GLuint* buffers)
+{
+  _glewCacheDeleted(_glewCache.buffer, _GLEW_CACHE_COUNT(_glewCache.buffer), n, buffers);
+  glDeleteBuffers(n, buffers);
+}
+#endif
+
+#ifdef GL_VERSION_2_0
+void GLAPIENTRY glewCacheUseProgram (GLuint program)
+{
+  if (_glewCacheSet(_GLEW_CACHE_USE_PROGRAM, &_glewCache.program, &program, 1))
+    glUseProgram(program);
+}
+
+/* the program stays in use until another one is, but its name may be
+   given out again */
+void GLAPIENTRY glewCacheDeleteProgram (GLuint program)
+{
+  if (program != 0 && _glewCache.program == program)
+    _glewCache.program = _GLEW_CACHE_UNKNOWN;
+  glDeleteProgram(program);
+}
+
+void GLAPIENTRY glewCacheBlendEquationSeparate (GLenum modeRGB, GLenum modeAlpha)
+{
+  GLuint v[2];
+  v[0] = modeRGB;
+  v[1] = modeAlpha;
+  if (_glewCacheSet(_GLEW_CACHE_BLEND_EQUATION_SEPARATE, _glewCache.blendEquation, v, 2))
+    glBlendEquationSeparate(modeRGB, modeAlpha);
+}
+#endif
+
+#ifdef GL_VERSION_3_0
+void GLAPIENTRY glewCacheEnablei (GLenum cap, GLuint index)
+{
+  GLuint c = _glewCacheIndex(_glewCacheCap, _GLEW_CACHE_COUNT(_glewCacheCap), cap);
+  if (c < _GLEW_CACHE_COUNT(_glewCacheCap))
+    _glewCache.cap[c] = _GLEW_CACHE_UNKNOWN;
+  glEnablei(cap, index);
+}
+
+void GLAPIENTRY glewCacheDisablei (GLenum cap, GLuint index)
+{
+  GLuint c = _glewCacheIndex(_glewCacheCap, _GLEW_CACHE_COUNT(_glewCacheCap), cap);
+  if (c < _GLEW_CACHE_COUNT(_glewCacheCap))
+    _glewCache.cap[c] = _GLEW_CACHE_UNKNOWN;
+  glDisablei(cap, index);
+}
+#endif
+
+#ifdef GL_VERSION_4_0
+void GLAPIENTRY glewCacheBlendFunci (GLuint buf, GLenum src, GLenum dst)
+{
+  _glewCacheForget(_glewCache.blendFunc, 4);
+  glBlendFunci(buf, src, dst);
+}
+
+void GLAPIENTRY glewCacheBlendFuncSeparatei (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+  _glewCacheForget(_glewCache.blendFunc, 4);
+  glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+
+void GLAPIENTRY glewCacheBlendEquationi (GLuint buf, GLenum mode)
+{
+  _glewCacheForget(_glewCache.blendEquation, 2);
+  glBlendEquationi(buf, mode);
+}
+
+void GLAPIENTRY glewCacheBlendEquationSeparatei (GLuint buf, GLenum modeRGB, GLenum modeAlpha)
+{
+  _glewCacheForget(_glewCache.blendEquation, 2);
+  glBlendEquationSeparatei(buf, modeRGB, modeAlpha);
+}
+#endif
+
+#ifdef GL_ARB_uniform_buffer_object
+/* these bind to the generic binding point as well */
+void GLAPIENTRY glewCacheBindBufferBase (GLenum target, GLuint index, GLuint buffer)
+{
+  GLuint b = _glewCacheIndex(_glewCacheBufferTarget, _GLEW_CACHE_COUNT(_glewCacheBufferTarget), target);
+  if (b < _GLEW_CACHE_COUNT(_glewCacheBufferTarget))
+    _glewCache.buffer[b] = buffer;
+  glBindBufferBase(target, index, buffer);
+}
+
+void GLAPIENTRY glewCacheBindBufferRange (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+  GLuint b = _glewCacheIndex(_glewCacheBufferTarget, _GLEW_CACHE_COUNT(_glewCacheBufferTarget), target);
+  if (b < _GLEW_CACHE_COUNT(_glewCacheBufferTarget))
+    _glewCache.buffer[b] = buffer;
+  glBindBufferRange(target, index, buffer, offset, size);
+}
+#endif
+
+#ifdef GL_ARB_vertex_array_object
+/* the element array buffer binding comes with the vertex array */
+void GLAPIENTRY glewCacheBindVertexArray (GLuint array)
+{
+  if (!_glewCacheSet(_GLEW_CACHE_BIND_VERTEX_ARRAY, &_glewCache.vertexArray, &array, 1))
+    return;
+  _glewCache.buffer[_GLEW_CACHE_ELEMENT_ARRAY_BUFFER] = _GLEW_CACHE_UNKNOWN;
+  glBindVertexArray(array);
+}
+
+void GLAPIENTRY glewCacheDeleteVertexArrays (GLsizei n, const GLuint* arrays)
+{
+  GLsizei i;
+  for (i = 0; i < n; i++)
+  {
+    if (arrays[i] != 0 && _glewCache.vertexArray == arrays[i])
+    {
+      _glewCache.vertexArray = 0;
+      _glewCache.buffer[_GLEW_CACHE_ELEMENT_ARRAY_BUFFER] = _GLEW_CACHE_UNKNOWN;
+    }
+  }
+  glDeleteVertexArrays(n, arrays);
+}
+#endif
+
+#ifdef GL_ARB_viewport_array
+void GLAPIENTRY glewCacheViewportArrayv (GLuint first, GLsizei count, const GLfloat* v)
+{
+  _glewCacheForget(_glewCache.viewport, 4);
+  glViewportArrayv(first, count, v);
+}
+
+void GLAPIENTRY glewCacheViewportIndexedf (GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h)
+{
+  _glewCacheForget(_glewCache.viewport, 4);
+  glViewportIndexedf(index, x, y, w, h);
+}
+
+void GLAPIENTRY glewCacheViewportIndexedfv (GLuint index, const GLfloat* v)
+{
+  _glewCacheForget(_glewCache.viewport, 4);
+  glViewportIndexedfv(index, v);
+}
+#endif
+
+#ifdef GL_ARB_multi_bind
+void GLAPIENTRY glewCacheBindTextures (GLuint first, GLsizei count, const GLuint* textures)
+{
+  GLsizei i;
+  for (i = 0; i < count; i++)
+    _glewCacheBoundToUnit(first + (GLuint)i, textures != NULL ? textures[i] : 0);
+  glBindTextures(first, count, textures);
+}
+#endif
+
+#ifdef GL_ARB_direct_state_access
+void GLAPIENTRY glewCacheBindTextureUnit (GLuint unit, GLuint texture)
+{
+  _glewCacheBoundToUnit(unit, texture);
+  glBindTextureUnit(unit, texture);
+}
+#endif
+
+#ifdef GL_EXT_direct_state_access
+/* binds as glBindTexture does, to the unit given rather than the active one */
+void GLAPIENTRY glewCacheBindMultiTextureEXT (GLenum texunit, GLenum target, GLuint texture)
+{
+  GLuint t = _glewCacheIndex(_glewCacheTextureTarget, _GLEW_CACHE_COUNT(_glewCacheTextureTarget), target);
+  GLuint unit = texunit - 0x84C0; /* GL_TEXTURE0 */
+  if (t < _GLEW_CACHE_COUNT(_glewCacheTextureTarget) && unit < _GLEW_CACHE_UNITS)
+    _glewCache.texture[unit][t] = texture;
+  glBindMultiTextureEXT(texunit, target, texture);
+}
+#endif
+
+#ifdef GL_ARB_shader_image_load_store
+/* image units are not texture units, but the texture unit of the same
+   number is forgotten all the same: at worst one bind is not dropped */
+void GLAPIENTRY glewCacheBindImageTexture (GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format)
+{
+  if (unit < _GLEW_CACHE_UNITS)
+    _glewCacheForget(_glewCache.texture[unit], _GLEW_CACHE_COUNT(_glewCacheTextureTarget));
+  glBindImageTexture(unit, texture, level, layered, layer, access, format);
+}
+#endif
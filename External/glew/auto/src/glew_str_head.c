@@ -1,13 +1,98 @@
+/* ------------------------------------------------------------------------ */
+
+/*
+ * glewIsSupported, wglewIsSupported and glxewIsSupported look names up in
+ * a table that make_str.pl generates from the extension list: the names,
+ * where the flag of each is, and a perfect hash over the names (hash and
+ * displace: the bucket a name hashes to says how to move it to its slot).
+ * A lookup is one hash of the name and one compare.  The names are
+ * offsets into one string and need no relocations, but the flags are
+ * pointers to the GLEW_ variables (one relocation each) unless GLEW_MX
+ * makes them offsets into the context.
+ */
 #ifdef GLEW_MX
-GLboolean GLEWAPIENTRY glewContextIsSupported (const GLEWContext* ctx, const char* name)
+typedef size_t _GLEWStrFlag; /* offset in the context */
+#  define _GLEW_STR_FLAG(context, flag) offsetof(context, flag)
+#  define _GLEW_STR_CONTEXT ctx
 #else
-GLboolean GLEWAPIENTRY glewIsSupported (const char* name)
+typedef GLboolean* _GLEWStrFlag;
+#  define _GLEW_STR_FLAG(context, flag) &flag
+#  define _GLEW_STR_CONTEXT NULL
 #endif
+
+typedef struct
+{
+  const char* names; /* each ends in a '\0' */
+  const GLushort* name; /* where each name starts in names */
+  const GLuint* hash; /* of each name, as _glewHashExtension makes it */
+  GLuint count;
+  const _GLEWStrFlag* flag;
+  const GLushort* disp; /* one per bucket */
+  GLuint buckets;
+  const GLushort* slot; /* the name in each slot, or 0xffff */
+  GLuint slots;
+} _GLEWStrTable;
+
+/* the same as str_slot in make_str.pl */
+static GLuint _glewStrTableSlot (GLuint h, GLuint d, GLuint slots)
+{
+  h ^= d;
+  h ^= h >> 16;
+  h *= 0x85ebca6bu;
+  h ^= h >> 13;
+  h *= 0xc2b2ae35u;
+  h ^= h >> 16;
+  return h % slots;
+}
+
+static GLboolean _glewStrIsSpace (GLubyte c)
+{
+  return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+/* the name of n characters at start, or 0xffff if it is not in the table */
+static GLuint _glewStrTableFind (const _GLEWStrTable* table, const GLubyte* start, GLuint n)
+{
+  const GLubyte* entry;
+  GLuint h, e;
+  if (table->slots == 0)
+    return 0xffff;
+  h = _glewHashExtension(start, n);
+  e = table->slot[_glewStrTableSlot(h, table->disp[h % table->buckets], table->slots)];
+  if (e == 0xffff)
+    return e;
+  entry = (const GLubyte*)table->names + table->name[e];
+  if (!_glewStrSame(start, entry, n) || entry[n] != '\0')
+    return 0xffff;
+  return e;
+}
+
+/* every one of the names in name, separated by white space, is supported */
+static GLboolean _glewStrTableIsSupported (const _GLEWStrTable* table, const void* ctx, const char* name)
 {
   const GLubyte* pos = (const GLubyte*)name;
-  GLuint len = _glewStrLen(pos);
-  GLboolean ret = GL_TRUE;
-  while (ret && len > 0)
+  if (pos == NULL)
+    return GL_TRUE;
+  for (;;)
   {
-    if (_glewStrSame1(&pos, &len, (const GLubyte*)"GL_", 3))
-    {
+    const GLubyte* start;
+    GLuint e;
+    while (_glewStrIsSpace(*pos)) pos++;
+    if (*pos == '\0')
+      return GL_TRUE;
+    start = pos;
+    while (*pos != '\0' && !_glewStrIsSpace(*pos)) pos++;
+    e = _glewStrTableFind(table, start, (GLuint)(pos - start));
+    if (e == 0xffff)
+      return GL_FALSE;
+#ifdef GLEW_MX
+    if (!*(const GLboolean*)((const char*)ctx + table->flag[e]))
+      return GL_FALSE;
+#else
+    (void)ctx;
+    if (!*table->flag[e])
+      return GL_FALSE;
+#endif
+  }
+}
+
@@ -1,7 +1,11 @@
-    }
-    ret = (len == 0);
-  }
-  return ret;
+
+#if defined(GLEW_MX)
+GLboolean glxewContextIsSupported (const GLXEWContext* ctx, const char* name)
+#else
+GLboolean glxewIsSupported (const char* name)
+#endif
+{
+  return _glewStrTableIsSupported(&_glxewStrTable, _GLEW_STR_CONTEXT, name);
 }
 
 #endif /* _WIN32 */
@@ -1,21 +1,44 @@
-    }
-    ret = (len == 0);
-  }
-  return ret;
-}
-
-#if defined(_WIN32)
 
-#if defined(GLEW_MX)
-GLboolean GLEWAPIENTRY wglewContextIsSupported (const WGLEWContext* ctx, const char* name)
+#ifdef GLEW_MX
+GLboolean GLEWAPIENTRY glewContextIsSupported (const GLEWContext* ctx, const char* name)
 #else
-GLboolean GLEWAPIENTRY wglewIsSupported (const char* name)
+GLboolean GLEWAPIENTRY glewIsSupported (const char* name)
 #endif
 {
-  const GLubyte* pos = (const GLubyte*)name;
-  GLuint len = _glewStrLen(pos);
-  GLboolean ret = GL_TRUE;
-  while (ret && len > 0)
-  {
-    if (_glewStrSame1(&pos, &len, (const GLubyte*)"WGL_", 4))
-    {
+  return _glewStrTableIsSupported(&_glewStrTable, _GLEW_STR_CONTEXT, name);
+}
+
+#ifndef GLEW_MX
+/* glewGetExtension answers from whether the last glewContextInit found
+   a name listed (the flags say whether it could also be loaded), with
+   no walk through the driver's list: from the table for the names GLEW
+   knows, from the set that init built (kept here) for any other */
+static GLboolean _glewStrListedValid = GL_FALSE;
+static _GLEWExtensionSet _glewStrListedSet;
+
+static void _glewStrInitListed (const _GLEWExtensionSet* set)
+{
+  GLuint e;
+  _glewStrListedValid = set != NULL ? GL_TRUE : GL_FALSE;
+  if (set != NULL)
+    _glewStrListedSet = *set;
+  for (e = 0; set != NULL && e < _glewStrTable.count; e++)
+    _glewStrListed[e] = _glewSearchExtensionSet(_glewStrTable.names + _glewStrTable.name[e], _glewStrTable.hash[e], set);
+}
+
+/* GL_TRUE or GL_FALSE, -1 before glewContextInit */
+static int _glewStrGetListed (const char* name)
+{
+  GLuint e, n;
+  if (!_glewStrListedValid || name == NULL)
+    return -1;
+  n = _glewStrLen((const GLubyte*)name);
+  e = _glewStrTableFind(&_glewStrTable, (const GLubyte*)name, n);
+  if (e != 0xffff)
+    return _glewStrListed[e];
+  return _glewSearchExtensionSet(name, _glewHashExtension((const GLubyte*)name, n), &_glewStrListedSet);
+}
+#endif
+
+#if defined(_WIN32)
+
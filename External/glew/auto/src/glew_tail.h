@@ -6,6 +6,7 @@
 #define GLEW_ERROR_NO_GL_VERSION 1  /* missing GL version */
 #define GLEW_ERROR_GL_VERSION_10_ONLY 2  /* Need at least OpenGL 1.1 */
 #define GLEW_ERROR_GLX_VERSION_11_ONLY 3  /* Need at least GLX 1.2 */
+#define GLEW_ERROR_TOO_MANY_CONTEXTS 4  /* More than GLEW_MX_TLS_CONTEXTS different contexts */
 
 /* string codes */
 #define GLEW_VERSION 1
@@ -20,7 +21,41 @@ typedef struct GLEWContextStruct GLEWContext;
 GLEWAPI GLenum GLEWAPIENTRY glewContextInit (GLEWContext *ctx);
 GLEWAPI GLboolean GLEWAPIENTRY glewContextIsSupported (const GLEWContext *ctx, const char *name);
 
-#define glewInit() glewContextInit(glewGetContext())
+/*
+ * GLEW keeps a current GLEWContext for each thread.  glewCurrentContextInit
+ * makes the one for the GL context current on the calling thread current,
+ * filling it in the first time; GL contexts with the same vendor, renderer,
+ * version and profile share one.  Define GLEW_MX_TLS to have glewInit and
+ * glewGetContext use them instead of supplying glewGetContext yourself.
+ */
+#ifndef GLEW_THREAD_LOCAL
+#  if defined(_MSC_VER)
+#    define GLEW_THREAD_LOCAL __declspec(thread)
+#  elif defined(__GNUC__) || defined(__clang__) || defined(__SUNPRO_C) || defined(__SUNPRO_CC)
+#    define GLEW_THREAD_LOCAL __thread
+#  elif defined(__cplusplus)
+#    define GLEW_THREAD_LOCAL thread_local
+#  else
+#    define GLEW_THREAD_LOCAL _Thread_local
+#  endif
+#endif
+
+GLEWAPI GLenum GLEWAPIENTRY glewCurrentContextInit (void);
+GLEWAPI GLEWContext* GLEWAPIENTRY glewGetCurrentContext (void);
+GLEWAPI void GLEWAPIENTRY glewMakeContextCurrent (GLEWContext *ctx);
+
+#ifdef GLEW_MX_TLS
+#  define glewInit() glewCurrentContextInit()
+#  if defined(_WIN32) && !defined(GLEW_STATIC)
+/* a DLL can not export thread local data */
+#    define glewGetContext() glewGetCurrentContext()
+#  else
+extern GLEW_THREAD_LOCAL GLEWContext* __glewCurrentContext;
+#    define glewGetContext() __glewCurrentContext
+#  endif
+#else
+#  define glewInit() glewContextInit(glewGetContext())
+#endif /* GLEW_MX_TLS */
 #define glewIsSupported(x) glewContextIsSupported(glewGetContext(), x)
 #define glewIsExtensionSupported(x) glewIsSupported(x)
 
@@ -47,6 +82,294 @@ GLEWAPI GLboolean GLEWAPIENTRY glewGetExtension (const char *name);
 GLEWAPI const GLubyte * GLEWAPIENTRY glewGetErrorString (GLenum error);
 GLEWAPI const GLubyte * GLEWAPIENTRY glewGetString (GLenum name);
 
+#ifdef GLEW_INSTRUMENT
+
+#include <stdio.h>
+
+/*
+ * GLEW_INSTRUMENT: glewInit wraps every GL function it loads, counting
+ * and timing the calls, per frame, and keeping the last few.  Call
+ * glewInstrumentFrame at the end of each frame.  Functions GLEW does not
+ * load (OpenGL 1.1) are not seen.  Build src/glew_instrument.c along
+ * with src/glew.c.
+ */
+typedef struct GLEWInstrumentStat
+{
+  const char* name;
+  GLuint64EXT calls;      /* since the first glewInit */
+  GLuint64EXT ns;
+  GLuint64EXT frameCalls; /* in the last frame */
+  GLuint64EXT frameNs;
+} GLEWInstrumentStat;
+
+typedef struct GLEWInstrumentCall
+{
+  const char* name;
+  const char* args;       /* per argument e(num), i(nt), u(nsigned), f(loat), p(ointer); . for more */
+  GLuint64EXT frame;
+  GLuint64EXT ns;
+  GLuint64EXT arg[4];     /* a float as the bits of a double */
+} GLEWInstrumentCall;
+
+GLEWAPI void GLEWAPIENTRY glewInstrumentFrame (void);
+GLEWAPI GLuint GLEWAPIENTRY glewInstrumentStats (GLEWInstrumentStat* stats, GLuint max);
+GLEWAPI GLuint GLEWAPIENTRY glewInstrumentCalls (GLEWInstrumentCall* calls, GLuint max);
+GLEWAPI void GLEWAPIENTRY glewInstrumentReport (FILE* file);
+
+#endif /* GLEW_INSTRUMENT */
+
+#ifdef GLEW_STATE_CACHE
+
+#ifdef GLEW_MX
+#  error "GLEW_STATE_CACHE keeps one GL state, it does not work with GLEW_MX"
+#endif
+
+/*
+ * GLEW_STATE_CACHE: the GL calls below go through glewCache functions
+ * that drop a call setting the program, vertex array, buffer or texture
+ * binding, capability, blend, depth, viewport or pixel store state to what
+ * it already is.  Call glewStateCacheInvalidate after anything changes
+ * that state without them: code not including glew.h with
+ * GLEW_STATE_CACHE (SOIL, for one), glPushAttrib/glPopAttrib or making
+ * another context current.
+ */
+typedef struct GLEWStateCacheStat
+{
+  const char* name;
+  GLuint64EXT calls;
+  GLuint64EXT dropped;
+} GLEWStateCacheStat;
+
+GLEWAPI void GLEWAPIENTRY glewStateCacheInvalidate (void);
+GLEWAPI GLuint GLEWAPIENTRY glewStateCacheStats (GLEWStateCacheStat* stats, GLuint max);
+
+GLEWAPI void GLAPIENTRY glewCacheBindTexture (GLenum target, GLuint texture);
+GLEWAPI void GLAPIENTRY glewCacheDeleteTextures (GLsizei n, const GLuint* textures);
+GLEWAPI void GLAPIENTRY glewCacheEnable (GLenum cap);
+GLEWAPI void GLAPIENTRY glewCacheDisable (GLenum cap);
+GLEWAPI void GLAPIENTRY glewCacheBlendFunc (GLenum sfactor, GLenum dfactor);
+GLEWAPI void GLAPIENTRY glewCacheDepthFunc (GLenum func);
+GLEWAPI void GLAPIENTRY glewCacheDepthMask (GLboolean flag);
+GLEWAPI void GLAPIENTRY glewCacheViewport (GLint x, GLint y, GLsizei width, GLsizei height);
+GLEWAPI void GLAPIENTRY glewCachePixelStorei (GLenum pname, GLint param);
+GLEWAPI void GLAPIENTRY glewCachePixelStoref (GLenum pname, GLfloat param);
+#ifdef GL_VERSION_1_3
+GLEWAPI void GLAPIENTRY glewCacheActiveTexture (GLenum texture);
+#endif
+#ifdef GL_VERSION_1_4
+GLEWAPI void GLAPIENTRY glewCacheBlendFuncSeparate (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha);
+GLEWAPI void GLAPIENTRY glewCacheBlendEquation (GLenum mode);
+#endif
+#ifdef GL_VERSION_1_5
+GLEWAPI void GLAPIENTRY glewCacheBindBuffer (GLenum target, GLuint buffer);
+GLEWAPI void GLAPIENTRY glewCacheDeleteBuffers (GLsizei n, const GLuint* buffers);
+#endif
+#ifdef GL_VERSION_2_0
+GLEWAPI void GLAPIENTRY glewCacheUseProgram (GLuint program);
+GLEWAPI void GLAPIENTRY glewCacheDeleteProgram (GLuint program);
+GLEWAPI void GLAPIENTRY glewCacheBlendEquationSeparate (GLenum modeRGB, GLenum modeAlpha);
+#endif
+#ifdef GL_VERSION_3_0
+GLEWAPI void GLAPIENTRY glewCacheEnablei (GLenum cap, GLuint index);
+GLEWAPI void GLAPIENTRY glewCacheDisablei (GLenum cap, GLuint index);
+#endif
+#ifdef GL_VERSION_4_0
+GLEWAPI void GLAPIENTRY glewCacheBlendFunci (GLuint buf, GLenum src, GLenum dst);
+GLEWAPI void GLAPIENTRY glewCacheBlendFuncSeparatei (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha);
+GLEWAPI void GLAPIENTRY glewCacheBlendEquationi (GLuint buf, GLenum mode);
+GLEWAPI void GLAPIENTRY glewCacheBlendEquationSeparatei (GLuint buf, GLenum modeRGB, GLenum modeAlpha);
+#endif
+#ifdef GL_ARB_uniform_buffer_object
+GLEWAPI void GLAPIENTRY glewCacheBindBufferBase (GLenum target, GLuint index, GLuint buffer);
+GLEWAPI void GLAPIENTRY glewCacheBindBufferRange (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+#endif
+#ifdef GL_ARB_vertex_array_object
+GLEWAPI void GLAPIENTRY glewCacheBindVertexArray (GLuint array);
+GLEWAPI void GLAPIENTRY glewCacheDeleteVertexArrays (GLsizei n, const GLuint* arrays);
+#endif
+#ifdef GL_ARB_viewport_array
+GLEWAPI void GLAPIENTRY glewCacheViewportArrayv (GLuint first, GLsizei count, const GLfloat* v);
+GLEWAPI void GLAPIENTRY glewCacheViewportIndexedf (GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h);
+GLEWAPI void GLAPIENTRY glewCacheViewportIndexedfv (GLuint index, const GLfloat* v);
+#endif
+#ifdef GL_ARB_multi_bind
+GLEWAPI void GLAPIENTRY glewCacheBindTextures (GLuint first, GLsizei count, const GLuint* textures);
+#endif
+#ifdef GL_ARB_direct_state_access
+GLEWAPI void GLAPIENTRY glewCacheBindTextureUnit (GLuint unit, GLuint texture);
+#endif
+#ifdef GL_EXT_direct_state_access
+GLEWAPI void GLAPIENTRY glewCacheBindMultiTextureEXT (GLenum texunit, GLenum target, GLuint texture);
+#endif
+#ifdef GL_ARB_shader_image_load_store
+GLEWAPI void GLAPIENTRY glewCacheBindImageTexture (GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format);
+#endif
+
+/* glew.c calls the driver */
+#ifndef GLEW_STATE_CACHE_BUILD
+#  undef glBindTexture
+#  define glBindTexture glewCacheBindTexture
+#  undef glDeleteTextures
+#  define glDeleteTextures glewCacheDeleteTextures
+#  undef glEnable
+#  define glEnable glewCacheEnable
+#  undef glDisable
+#  define glDisable glewCacheDisable
+#  undef glBlendFunc
+#  define glBlendFunc glewCacheBlendFunc
+#  undef glDepthFunc
+#  define glDepthFunc glewCacheDepthFunc
+#  undef glDepthMask
+#  define glDepthMask glewCacheDepthMask
+#  undef glViewport
+#  define glViewport glewCacheViewport
+#  undef glPixelStorei
+#  define glPixelStorei glewCachePixelStorei
+#  undef glPixelStoref
+#  define glPixelStoref glewCachePixelStoref
+#  ifdef GL_VERSION_1_3
+#    undef glActiveTexture
+#    define glActiveTexture glewCacheActiveTexture
+#  endif
+#  ifdef GL_VERSION_1_4
+#    undef glBlendFuncSeparate
+#    define glBlendFuncSeparate glewCacheBlendFuncSeparate
+#    undef glBlendEquation
+#    define glBlendEquation glewCacheBlendEquation
+#  endif
+#  ifdef GL_VERSION_1_5
+#    undef glBindBuffer
+#    define glBindBuffer glewCacheBindBuffer
+#    undef glDeleteBuffers
+#    define glDeleteBuffers glewCacheDeleteBuffers
+#  endif
+#  ifdef GL_VERSION_2_0
+#    undef glUseProgram
+#    define glUseProgram glewCacheUseProgram
+#    undef glDeleteProgram
+#    define glDeleteProgram glewCacheDeleteProgram
+#    undef glBlendEquationSeparate
+#    define glBlendEquationSeparate glewCacheBlendEquationSeparate
+#  endif
+#  ifdef GL_VERSION_3_0
+#    undef glEnablei
+#    define glEnablei glewCacheEnablei
+#    undef glDisablei
+#    define glDisablei glewCacheDisablei
+#  endif
+#  ifdef GL_VERSION_4_0
+#    undef glBlendFunci
+#    define glBlendFunci glewCacheBlendFunci
+#    undef glBlendFuncSeparatei
+#    define glBlendFuncSeparatei glewCacheBlendFuncSeparatei
+#    undef glBlendEquationi
+#    define glBlendEquationi glewCacheBlendEquationi
+#    undef glBlendEquationSeparatei
+#    define glBlendEquationSeparatei glewCacheBlendEquationSeparatei
+#  endif
+#  ifdef GL_ARB_uniform_buffer_object
+#    undef glBindBufferBase
+#    define glBindBufferBase glewCacheBindBufferBase
+#    undef glBindBufferRange
+#    define glBindBufferRange glewCacheBindBufferRange
+#  endif
+#  ifdef GL_ARB_vertex_array_object
+#    undef glBindVertexArray
+#    define glBindVertexArray glewCacheBindVertexArray
+#    undef glDeleteVertexArrays
+#    define glDeleteVertexArrays glewCacheDeleteVertexArrays
+#  endif
+#  ifdef GL_ARB_viewport_array
+#    undef glViewportArrayv
+#    define glViewportArrayv glewCacheViewportArrayv
+#    undef glViewportIndexedf
+#    define glViewportIndexedf glewCacheViewportIndexedf
+#    undef glViewportIndexedfv
+#    define glViewportIndexedfv glewCacheViewportIndexedfv
+#  endif
+#  ifdef GL_ARB_multi_bind
+#    undef glBindTextures
+#    define glBindTextures glewCacheBindTextures
+#  endif
+#  ifdef GL_ARB_direct_state_access
+#    undef glBindTextureUnit
+#    define glBindTextureUnit glewCacheBindTextureUnit
+#  endif
+#  ifdef GL_EXT_direct_state_access
+#    undef glBindMultiTextureEXT
+#    define glBindMultiTextureEXT glewCacheBindMultiTextureEXT
+#  endif
+#  ifdef GL_ARB_shader_image_load_store
+#    undef glBindImageTexture
+#    define glBindImageTexture glewCacheBindImageTexture
+#  endif
+#endif /* !GLEW_STATE_CACHE_BUILD */
+
+#endif /* GLEW_STATE_CACHE */
+
+#ifdef GLEW_COMMAND_BUFFER
+
+#ifdef GLEW_MX
+#  error "GLEW_COMMAND_BUFFER replays through the single context entry points, it does not work with GLEW_MX"
+#endif
+
+/*
+ * GLEW_COMMAND_BUFFER: any thread can record GL commands into a
+ * GLEWCommandBuffer of its own with the glewCmd functions, for the
+ * thread the context is current on to replay with
+ * glewCommandBufferReplay, in the order they were recorded.  Arguments
+ * are copied when recorded, except pointers into buffer objects
+ * (indices) and callback data.  glewCmdCallback records a call to any
+ * function, for the commands there is no glewCmd function for.
+ * Recording stops when memory runs out; replaying then returns
+ * GL_FALSE, after replaying what was recorded.
+ */
+typedef struct GLEWCommandBufferStruct GLEWCommandBuffer;
+
+GLEWAPI GLEWCommandBuffer* GLEWAPIENTRY glewCommandBufferCreate (size_t chunkSize);
+GLEWAPI void GLEWAPIENTRY glewCommandBufferDestroy (GLEWCommandBuffer* cb);
+GLEWAPI void GLEWAPIENTRY glewCommandBufferReset (GLEWCommandBuffer* cb);
+GLEWAPI GLuint GLEWAPIENTRY glewCommandBufferCount (const GLEWCommandBuffer* cb);
+GLEWAPI GLboolean GLEWAPIENTRY glewCommandBufferReplay (const GLEWCommandBuffer* cb);
+
+GLEWAPI void GLEWAPIENTRY glewCmdCallback (GLEWCommandBuffer* cb, void (*callback) (void* data), void* data);
+GLEWAPI void GLEWAPIENTRY glewCmdBindTexture (GLEWCommandBuffer* cb, GLenum target, GLuint texture);
+GLEWAPI void GLEWAPIENTRY glewCmdEnable (GLEWCommandBuffer* cb, GLenum cap);
+GLEWAPI void GLEWAPIENTRY glewCmdDisable (GLEWCommandBuffer* cb, GLenum cap);
+GLEWAPI void GLEWAPIENTRY glewCmdBlendFunc (GLEWCommandBuffer* cb, GLenum sfactor, GLenum dfactor);
+GLEWAPI void GLEWAPIENTRY glewCmdDepthMask (GLEWCommandBuffer* cb, GLboolean flag);
+GLEWAPI void GLEWAPIENTRY glewCmdViewport (GLEWCommandBuffer* cb, GLint x, GLint y, GLsizei width, GLsizei height);
+GLEWAPI void GLEWAPIENTRY glewCmdScissor (GLEWCommandBuffer* cb, GLint x, GLint y, GLsizei width, GLsizei height);
+GLEWAPI void GLEWAPIENTRY glewCmdClearColor (GLEWCommandBuffer* cb, GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha);
+GLEWAPI void GLEWAPIENTRY glewCmdClear (GLEWCommandBuffer* cb, GLbitfield mask);
+GLEWAPI void GLEWAPIENTRY glewCmdDrawArrays (GLEWCommandBuffer* cb, GLenum mode, GLint first, GLsizei count);
+GLEWAPI void GLEWAPIENTRY glewCmdDrawElements (GLEWCommandBuffer* cb, GLenum mode, GLsizei count, GLenum type, const void* indices);
+#ifdef GL_VERSION_1_3
+GLEWAPI void GLEWAPIENTRY glewCmdActiveTexture (GLEWCommandBuffer* cb, GLenum texture);
+#endif
+#ifdef GL_VERSION_1_5
+GLEWAPI void GLEWAPIENTRY glewCmdBindBuffer (GLEWCommandBuffer* cb, GLenum target, GLuint buffer);
+#endif
+#ifdef GL_VERSION_2_0
+GLEWAPI void GLEWAPIENTRY glewCmdUseProgram (GLEWCommandBuffer* cb, GLuint program);
+GLEWAPI void GLEWAPIENTRY glewCmdUniform1i (GLEWCommandBuffer* cb, GLint location, GLint v0);
+GLEWAPI void GLEWAPIENTRY glewCmdUniform1f (GLEWCommandBuffer* cb, GLint location, GLfloat v0);
+GLEWAPI void GLEWAPIENTRY glewCmdUniform4f (GLEWCommandBuffer* cb, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3);
+GLEWAPI void GLEWAPIENTRY glewCmdUniformMatrix4fv (GLEWCommandBuffer* cb, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value);
+#endif
+#ifdef GL_VERSION_3_1
+GLEWAPI void GLEWAPIENTRY glewCmdDrawArraysInstanced (GLEWCommandBuffer* cb, GLenum mode, GLint first, GLsizei count, GLsizei primcount);
+GLEWAPI void GLEWAPIENTRY glewCmdDrawElementsInstanced (GLEWCommandBuffer* cb, GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei primcount);
+#endif
+#ifdef GL_ARB_uniform_buffer_object
+GLEWAPI void GLEWAPIENTRY glewCmdBindBufferRange (GLEWCommandBuffer* cb, GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+#endif
+#ifdef GL_ARB_vertex_array_object
+GLEWAPI void GLEWAPIENTRY glewCmdBindVertexArray (GLEWCommandBuffer* cb, GLuint array);
+#endif
+
+#endif /* GLEW_COMMAND_BUFFER */
+
 #ifdef __cplusplus
 }
 #endif
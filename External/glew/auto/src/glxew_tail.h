@@ -6,6 +6,11 @@ typedef struct GLXEWContextStruct GLXEWContext;
 GLEWAPI GLenum GLEWAPIENTRY glxewContextInit (GLXEWContext *ctx);
 GLEWAPI GLboolean GLEWAPIENTRY glxewContextIsSupported (const GLXEWContext *ctx, const char *name);
 
+#ifdef GLEW_MX_TLS
+extern GLEW_THREAD_LOCAL GLXEWContext* __glxewCurrentContext;
+#  define glxewGetContext() __glxewCurrentContext
+#endif /* GLEW_MX_TLS */
+
 #define glxewInit() glxewContextInit(glxewGetContext())
 #define glxewIsSupported(x) glxewContextIsSupported(glxewGetContext(), x)
 
@@ -1426,6 +1426,17 @@ typedef struct WGLEWContextStruct WGLEWContext;
 GLEWAPI GLenum GLEWAPIENTRY wglewContextInit (WGLEWContext *ctx);
 GLEWAPI GLboolean GLEWAPIENTRY wglewContextIsSupported (const WGLEWContext *ctx, const char *name);
 
+GLEWAPI WGLEWContext* GLEWAPIENTRY wglewGetCurrentContext (void);
+
+#ifdef GLEW_MX_TLS
+#  ifdef GLEW_STATIC
+extern GLEW_THREAD_LOCAL WGLEWContext* __wglewCurrentContext;
+#    define wglewGetContext() __wglewCurrentContext
+#  else
+#    define wglewGetContext() wglewGetCurrentContext()
+#  endif
+#endif /* GLEW_MX_TLS */
+
 #define wglewInit() wglewContextInit(wglewGetContext())
 #define wglewIsSupported(x) wglewContextIsSupported(wglewGetContext(), x)
 
@@ -0,0 +1,18663 @@
+/*
+** The OpenGL Extension Wrangler Library
+** Copyright (C) 2008-2015, Nigel Stewart <nigels[]users sourceforge net>
+** Copyright (C) 2002-2008, Milan Ikits <milan ikits[]ieee org>
+** Copyright (C) 2002-2008, Marcelo E. Magallon <mmagallo[]debian org>
+** Copyright (C) 2002, Lev Povalahev
+** All rights reserved.
+** 
+** Redistribution and use in source and binary forms, with or without 
+** modification, are permitted provided that the following conditions are met:
+** 
+** * Redistributions of source code must retain the above copyright notice, 
+**   this list of conditions and the following disclaimer.
+** * Redistributions in binary form must reproduce the above copyright notice, 
+**   this list of conditions and the following disclaimer in the documentation 
+**   and/or other materials provided with the distribution.
+** * The name of the author may be used to endorse or promote products 
+**   derived from this software without specific prior written permission.
+**
+** THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" 
+** AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE 
+** IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+** ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE 
+** LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR 
+** CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF 
+** SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+** INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+** CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+** ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+** THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+#if defined(GLEW_STATE_CACHE)
+#  define GLEW_STATE_CACHE_BUILD
+#endif
+#include <GL/glew.h>
+
+#if defined(_WIN32)
+#  include <GL/wglew.h>
+#elif !defined(__ANDROID__) && !defined(__native_client__) && !defined(__HAIKU__) && (!defined(__APPLE__) || defined(GLEW_APPLE_GLX))
+#  include <GL/glxew.h>
+#endif
+
+/*
+ * GLEW_LAZY function pointers, each starting out at a trampoline that
+ * loads the function through glew.c, points the function pointer at it
+ * and calls it.  Only GLEW_LAZY builds need this file; glew.c leaves
+ * the function pointers out when GLEW_LAZY is defined.
+ */
+#if defined(GLEW_LAZY)
+
+#if defined(GLEW_MX)
+#  error "GLEW_LAZY does not work with GLEW_MX"
+#endif
+
+extern void* _glewLazyGetProcAddress (const GLubyte* name);
+#define glewGetProcAddress(name) _glewLazyGetProcAddress(name)
+
+static void GLAPIENTRY _glewLazy_glCopyTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+  glCopyTexSubImage3D = (PFNGLCOPYTEXSUBIMAGE3DPROC)glewGetProcAddress((const GLubyte*)"glCopyTexSubImage3D");
+  glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawRangeElements (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices)
+{
+  glDrawRangeElements = (PFNGLDRAWRANGEELEMENTSPROC)glewGetProcAddress((const GLubyte*)"glDrawRangeElements");
+  glDrawRangeElements(mode, start, end, count, type, indices);
+}
+
+static void GLAPIENTRY _glewLazy_glTexImage3D (GLenum target, GLint level, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+  glTexImage3D = (PFNGLTEXIMAGE3DPROC)glewGetProcAddress((const GLubyte*)"glTexImage3D");
+  glTexImage3D(target, level, internalFormat, width, height, depth, border, format, type, pixels);
+}
+
+static void GLAPIENTRY _glewLazy_glTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels)
+{
+  glTexSubImage3D = (PFNGLTEXSUBIMAGE3DPROC)glewGetProcAddress((const GLubyte*)"glTexSubImage3D");
+  glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+
+
+static void GLAPIENTRY _glewLazy_glActiveTexture (GLenum texture)
+{
+  glActiveTexture = (PFNGLACTIVETEXTUREPROC)glewGetProcAddress((const GLubyte*)"glActiveTexture");
+  glActiveTexture(texture);
+}
+
+static void GLAPIENTRY _glewLazy_glClientActiveTexture (GLenum texture)
+{
+  glClientActiveTexture = (PFNGLCLIENTACTIVETEXTUREPROC)glewGetProcAddress((const GLubyte*)"glClientActiveTexture");
+  glClientActiveTexture(texture);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTexImage1D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data)
+{
+  glCompressedTexImage1D = (PFNGLCOMPRESSEDTEXIMAGE1DPROC)glewGetProcAddress((const GLubyte*)"glCompressedTexImage1D");
+  glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTexImage2D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data)
+{
+  glCompressedTexImage2D = (PFNGLCOMPRESSEDTEXIMAGE2DPROC)glewGetProcAddress((const GLubyte*)"glCompressedTexImage2D");
+  glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTexImage3D (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data)
+{
+  glCompressedTexImage3D = (PFNGLCOMPRESSEDTEXIMAGE3DPROC)glewGetProcAddress((const GLubyte*)"glCompressedTexImage3D");
+  glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTexSubImage1D (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data)
+{
+  glCompressedTexSubImage1D = (PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC)glewGetProcAddress((const GLubyte*)"glCompressedTexSubImage1D");
+  glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTexSubImage2D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data)
+{
+  glCompressedTexSubImage2D = (PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC)glewGetProcAddress((const GLubyte*)"glCompressedTexSubImage2D");
+  glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTexSubImage3D (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data)
+{
+  glCompressedTexSubImage3D = (PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC)glewGetProcAddress((const GLubyte*)"glCompressedTexSubImage3D");
+  glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+
+static void GLAPIENTRY _glewLazy_glGetCompressedTexImage (GLenum target, GLint lod, void *img)
+{
+  glGetCompressedTexImage = (PFNGLGETCOMPRESSEDTEXIMAGEPROC)glewGetProcAddress((const GLubyte*)"glGetCompressedTexImage");
+  glGetCompressedTexImage(target, lod, img);
+}
+
+static void GLAPIENTRY _glewLazy_glLoadTransposeMatrixd (const GLdouble m[16])
+{
+  glLoadTransposeMatrixd = (PFNGLLOADTRANSPOSEMATRIXDPROC)glewGetProcAddress((const GLubyte*)"glLoadTransposeMatrixd");
+  glLoadTransposeMatrixd(m);
+}
+
+static void GLAPIENTRY _glewLazy_glLoadTransposeMatrixf (const GLfloat m[16])
+{
+  glLoadTransposeMatrixf = (PFNGLLOADTRANSPOSEMATRIXFPROC)glewGetProcAddress((const GLubyte*)"glLoadTransposeMatrixf");
+  glLoadTransposeMatrixf(m);
+}
+
+static void GLAPIENTRY _glewLazy_glMultTransposeMatrixd (const GLdouble m[16])
+{
+  glMultTransposeMatrixd = (PFNGLMULTTRANSPOSEMATRIXDPROC)glewGetProcAddress((const GLubyte*)"glMultTransposeMatrixd");
+  glMultTransposeMatrixd(m);
+}
+
+static void GLAPIENTRY _glewLazy_glMultTransposeMatrixf (const GLfloat m[16])
+{
+  glMultTransposeMatrixf = (PFNGLMULTTRANSPOSEMATRIXFPROC)glewGetProcAddress((const GLubyte*)"glMultTransposeMatrixf");
+  glMultTransposeMatrixf(m);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1d (GLenum target, GLdouble s)
+{
+  glMultiTexCoord1d = (PFNGLMULTITEXCOORD1DPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1d");
+  glMultiTexCoord1d(target, s);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1dv (GLenum target, const GLdouble *v)
+{
+  glMultiTexCoord1dv = (PFNGLMULTITEXCOORD1DVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1dv");
+  glMultiTexCoord1dv(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1f (GLenum target, GLfloat s)
+{
+  glMultiTexCoord1f = (PFNGLMULTITEXCOORD1FPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1f");
+  glMultiTexCoord1f(target, s);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1fv (GLenum target, const GLfloat *v)
+{
+  glMultiTexCoord1fv = (PFNGLMULTITEXCOORD1FVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1fv");
+  glMultiTexCoord1fv(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1i (GLenum target, GLint s)
+{
+  glMultiTexCoord1i = (PFNGLMULTITEXCOORD1IPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1i");
+  glMultiTexCoord1i(target, s);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1iv (GLenum target, const GLint *v)
+{
+  glMultiTexCoord1iv = (PFNGLMULTITEXCOORD1IVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1iv");
+  glMultiTexCoord1iv(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1s (GLenum target, GLshort s)
+{
+  glMultiTexCoord1s = (PFNGLMULTITEXCOORD1SPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1s");
+  glMultiTexCoord1s(target, s);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1sv (GLenum target, const GLshort *v)
+{
+  glMultiTexCoord1sv = (PFNGLMULTITEXCOORD1SVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1sv");
+  glMultiTexCoord1sv(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2d (GLenum target, GLdouble s, GLdouble t)
+{
+  glMultiTexCoord2d = (PFNGLMULTITEXCOORD2DPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2d");
+  glMultiTexCoord2d(target, s, t);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2dv (GLenum target, const GLdouble *v)
+{
+  glMultiTexCoord2dv = (PFNGLMULTITEXCOORD2DVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2dv");
+  glMultiTexCoord2dv(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2f (GLenum target, GLfloat s, GLfloat t)
+{
+  glMultiTexCoord2f = (PFNGLMULTITEXCOORD2FPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2f");
+  glMultiTexCoord2f(target, s, t);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2fv (GLenum target, const GLfloat *v)
+{
+  glMultiTexCoord2fv = (PFNGLMULTITEXCOORD2FVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2fv");
+  glMultiTexCoord2fv(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2i (GLenum target, GLint s, GLint t)
+{
+  glMultiTexCoord2i = (PFNGLMULTITEXCOORD2IPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2i");
+  glMultiTexCoord2i(target, s, t);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2iv (GLenum target, const GLint *v)
+{
+  glMultiTexCoord2iv = (PFNGLMULTITEXCOORD2IVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2iv");
+  glMultiTexCoord2iv(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2s (GLenum target, GLshort s, GLshort t)
+{
+  glMultiTexCoord2s = (PFNGLMULTITEXCOORD2SPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2s");
+  glMultiTexCoord2s(target, s, t);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2sv (GLenum target, const GLshort *v)
+{
+  glMultiTexCoord2sv = (PFNGLMULTITEXCOORD2SVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2sv");
+  glMultiTexCoord2sv(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3d (GLenum target, GLdouble s, GLdouble t, GLdouble r)
+{
+  glMultiTexCoord3d = (PFNGLMULTITEXCOORD3DPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3d");
+  glMultiTexCoord3d(target, s, t, r);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3dv (GLenum target, const GLdouble *v)
+{
+  glMultiTexCoord3dv = (PFNGLMULTITEXCOORD3DVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3dv");
+  glMultiTexCoord3dv(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3f (GLenum target, GLfloat s, GLfloat t, GLfloat r)
+{
+  glMultiTexCoord3f = (PFNGLMULTITEXCOORD3FPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3f");
+  glMultiTexCoord3f(target, s, t, r);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3fv (GLenum target, const GLfloat *v)
+{
+  glMultiTexCoord3fv = (PFNGLMULTITEXCOORD3FVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3fv");
+  glMultiTexCoord3fv(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3i (GLenum target, GLint s, GLint t, GLint r)
+{
+  glMultiTexCoord3i = (PFNGLMULTITEXCOORD3IPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3i");
+  glMultiTexCoord3i(target, s, t, r);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3iv (GLenum target, const GLint *v)
+{
+  glMultiTexCoord3iv = (PFNGLMULTITEXCOORD3IVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3iv");
+  glMultiTexCoord3iv(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3s (GLenum target, GLshort s, GLshort t, GLshort r)
+{
+  glMultiTexCoord3s = (PFNGLMULTITEXCOORD3SPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3s");
+  glMultiTexCoord3s(target, s, t, r);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3sv (GLenum target, const GLshort *v)
+{
+  glMultiTexCoord3sv = (PFNGLMULTITEXCOORD3SVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3sv");
+  glMultiTexCoord3sv(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4d (GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q)
+{
+  glMultiTexCoord4d = (PFNGLMULTITEXCOORD4DPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4d");
+  glMultiTexCoord4d(target, s, t, r, q);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4dv (GLenum target, const GLdouble *v)
+{
+  glMultiTexCoord4dv = (PFNGLMULTITEXCOORD4DVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4dv");
+  glMultiTexCoord4dv(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4f (GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q)
+{
+  glMultiTexCoord4f = (PFNGLMULTITEXCOORD4FPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4f");
+  glMultiTexCoord4f(target, s, t, r, q);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4fv (GLenum target, const GLfloat *v)
+{
+  glMultiTexCoord4fv = (PFNGLMULTITEXCOORD4FVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4fv");
+  glMultiTexCoord4fv(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4i (GLenum target, GLint s, GLint t, GLint r, GLint q)
+{
+  glMultiTexCoord4i = (PFNGLMULTITEXCOORD4IPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4i");
+  glMultiTexCoord4i(target, s, t, r, q);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4iv (GLenum target, const GLint *v)
+{
+  glMultiTexCoord4iv = (PFNGLMULTITEXCOORD4IVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4iv");
+  glMultiTexCoord4iv(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4s (GLenum target, GLshort s, GLshort t, GLshort r, GLshort q)
+{
+  glMultiTexCoord4s = (PFNGLMULTITEXCOORD4SPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4s");
+  glMultiTexCoord4s(target, s, t, r, q);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4sv (GLenum target, const GLshort *v)
+{
+  glMultiTexCoord4sv = (PFNGLMULTITEXCOORD4SVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4sv");
+  glMultiTexCoord4sv(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glSampleCoverage (GLclampf value, GLboolean invert)
+{
+  glSampleCoverage = (PFNGLSAMPLECOVERAGEPROC)glewGetProcAddress((const GLubyte*)"glSampleCoverage");
+  glSampleCoverage(value, invert);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBlendColor (GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha)
+{
+  glBlendColor = (PFNGLBLENDCOLORPROC)glewGetProcAddress((const GLubyte*)"glBlendColor");
+  glBlendColor(red, green, blue, alpha);
+}
+
+static void GLAPIENTRY _glewLazy_glBlendEquation (GLenum mode)
+{
+  glBlendEquation = (PFNGLBLENDEQUATIONPROC)glewGetProcAddress((const GLubyte*)"glBlendEquation");
+  glBlendEquation(mode);
+}
+
+static void GLAPIENTRY _glewLazy_glBlendFuncSeparate (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+{
+  glBlendFuncSeparate = (PFNGLBLENDFUNCSEPARATEPROC)glewGetProcAddress((const GLubyte*)"glBlendFuncSeparate");
+  glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+
+static void GLAPIENTRY _glewLazy_glFogCoordPointer (GLenum type, GLsizei stride, const void *pointer)
+{
+  glFogCoordPointer = (PFNGLFOGCOORDPOINTERPROC)glewGetProcAddress((const GLubyte*)"glFogCoordPointer");
+  glFogCoordPointer(type, stride, pointer);
+}
+
+static void GLAPIENTRY _glewLazy_glFogCoordd (GLdouble coord)
+{
+  glFogCoordd = (PFNGLFOGCOORDDPROC)glewGetProcAddress((const GLubyte*)"glFogCoordd");
+  glFogCoordd(coord);
+}
+
+static void GLAPIENTRY _glewLazy_glFogCoorddv (const GLdouble *coord)
+{
+  glFogCoorddv = (PFNGLFOGCOORDDVPROC)glewGetProcAddress((const GLubyte*)"glFogCoorddv");
+  glFogCoorddv(coord);
+}
+
+static void GLAPIENTRY _glewLazy_glFogCoordf (GLfloat coord)
+{
+  glFogCoordf = (PFNGLFOGCOORDFPROC)glewGetProcAddress((const GLubyte*)"glFogCoordf");
+  glFogCoordf(coord);
+}
+
+static void GLAPIENTRY _glewLazy_glFogCoordfv (const GLfloat *coord)
+{
+  glFogCoordfv = (PFNGLFOGCOORDFVPROC)glewGetProcAddress((const GLubyte*)"glFogCoordfv");
+  glFogCoordfv(coord);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiDrawArrays (GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount)
+{
+  glMultiDrawArrays = (PFNGLMULTIDRAWARRAYSPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawArrays");
+  glMultiDrawArrays(mode, first, count, drawcount);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiDrawElements (GLenum mode, const GLsizei *count, GLenum type, const void *const* indices, GLsizei drawcount)
+{
+  glMultiDrawElements = (PFNGLMULTIDRAWELEMENTSPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawElements");
+  glMultiDrawElements(mode, count, type, indices, drawcount);
+}
+
+static void GLAPIENTRY _glewLazy_glPointParameterf (GLenum pname, GLfloat param)
+{
+  glPointParameterf = (PFNGLPOINTPARAMETERFPROC)glewGetProcAddress((const GLubyte*)"glPointParameterf");
+  glPointParameterf(pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glPointParameterfv (GLenum pname, const GLfloat *params)
+{
+  glPointParameterfv = (PFNGLPOINTPARAMETERFVPROC)glewGetProcAddress((const GLubyte*)"glPointParameterfv");
+  glPointParameterfv(pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glPointParameteri (GLenum pname, GLint param)
+{
+  glPointParameteri = (PFNGLPOINTPARAMETERIPROC)glewGetProcAddress((const GLubyte*)"glPointParameteri");
+  glPointParameteri(pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glPointParameteriv (GLenum pname, const GLint *params)
+{
+  glPointParameteriv = (PFNGLPOINTPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glPointParameteriv");
+  glPointParameteriv(pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3b (GLbyte red, GLbyte green, GLbyte blue)
+{
+  glSecondaryColor3b = (PFNGLSECONDARYCOLOR3BPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3b");
+  glSecondaryColor3b(red, green, blue);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3bv (const GLbyte *v)
+{
+  glSecondaryColor3bv = (PFNGLSECONDARYCOLOR3BVPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3bv");
+  glSecondaryColor3bv(v);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3d (GLdouble red, GLdouble green, GLdouble blue)
+{
+  glSecondaryColor3d = (PFNGLSECONDARYCOLOR3DPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3d");
+  glSecondaryColor3d(red, green, blue);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3dv (const GLdouble *v)
+{
+  glSecondaryColor3dv = (PFNGLSECONDARYCOLOR3DVPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3dv");
+  glSecondaryColor3dv(v);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3f (GLfloat red, GLfloat green, GLfloat blue)
+{
+  glSecondaryColor3f = (PFNGLSECONDARYCOLOR3FPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3f");
+  glSecondaryColor3f(red, green, blue);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3fv (const GLfloat *v)
+{
+  glSecondaryColor3fv = (PFNGLSECONDARYCOLOR3FVPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3fv");
+  glSecondaryColor3fv(v);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3i (GLint red, GLint green, GLint blue)
+{
+  glSecondaryColor3i = (PFNGLSECONDARYCOLOR3IPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3i");
+  glSecondaryColor3i(red, green, blue);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3iv (const GLint *v)
+{
+  glSecondaryColor3iv = (PFNGLSECONDARYCOLOR3IVPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3iv");
+  glSecondaryColor3iv(v);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3s (GLshort red, GLshort green, GLshort blue)
+{
+  glSecondaryColor3s = (PFNGLSECONDARYCOLOR3SPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3s");
+  glSecondaryColor3s(red, green, blue);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3sv (const GLshort *v)
+{
+  glSecondaryColor3sv = (PFNGLSECONDARYCOLOR3SVPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3sv");
+  glSecondaryColor3sv(v);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3ub (GLubyte red, GLubyte green, GLubyte blue)
+{
+  glSecondaryColor3ub = (PFNGLSECONDARYCOLOR3UBPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3ub");
+  glSecondaryColor3ub(red, green, blue);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3ubv (const GLubyte *v)
+{
+  glSecondaryColor3ubv = (PFNGLSECONDARYCOLOR3UBVPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3ubv");
+  glSecondaryColor3ubv(v);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3ui (GLuint red, GLuint green, GLuint blue)
+{
+  glSecondaryColor3ui = (PFNGLSECONDARYCOLOR3UIPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3ui");
+  glSecondaryColor3ui(red, green, blue);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3uiv (const GLuint *v)
+{
+  glSecondaryColor3uiv = (PFNGLSECONDARYCOLOR3UIVPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3uiv");
+  glSecondaryColor3uiv(v);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3us (GLushort red, GLushort green, GLushort blue)
+{
+  glSecondaryColor3us = (PFNGLSECONDARYCOLOR3USPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3us");
+  glSecondaryColor3us(red, green, blue);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3usv (const GLushort *v)
+{
+  glSecondaryColor3usv = (PFNGLSECONDARYCOLOR3USVPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3usv");
+  glSecondaryColor3usv(v);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColorPointer (GLint size, GLenum type, GLsizei stride, const void *pointer)
+{
+  glSecondaryColorPointer = (PFNGLSECONDARYCOLORPOINTERPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColorPointer");
+  glSecondaryColorPointer(size, type, stride, pointer);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2d (GLdouble x, GLdouble y)
+{
+  glWindowPos2d = (PFNGLWINDOWPOS2DPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2d");
+  glWindowPos2d(x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2dv (const GLdouble *p)
+{
+  glWindowPos2dv = (PFNGLWINDOWPOS2DVPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2dv");
+  glWindowPos2dv(p);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2f (GLfloat x, GLfloat y)
+{
+  glWindowPos2f = (PFNGLWINDOWPOS2FPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2f");
+  glWindowPos2f(x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2fv (const GLfloat *p)
+{
+  glWindowPos2fv = (PFNGLWINDOWPOS2FVPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2fv");
+  glWindowPos2fv(p);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2i (GLint x, GLint y)
+{
+  glWindowPos2i = (PFNGLWINDOWPOS2IPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2i");
+  glWindowPos2i(x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2iv (const GLint *p)
+{
+  glWindowPos2iv = (PFNGLWINDOWPOS2IVPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2iv");
+  glWindowPos2iv(p);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2s (GLshort x, GLshort y)
+{
+  glWindowPos2s = (PFNGLWINDOWPOS2SPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2s");
+  glWindowPos2s(x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2sv (const GLshort *p)
+{
+  glWindowPos2sv = (PFNGLWINDOWPOS2SVPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2sv");
+  glWindowPos2sv(p);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3d (GLdouble x, GLdouble y, GLdouble z)
+{
+  glWindowPos3d = (PFNGLWINDOWPOS3DPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3d");
+  glWindowPos3d(x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3dv (const GLdouble *p)
+{
+  glWindowPos3dv = (PFNGLWINDOWPOS3DVPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3dv");
+  glWindowPos3dv(p);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3f (GLfloat x, GLfloat y, GLfloat z)
+{
+  glWindowPos3f = (PFNGLWINDOWPOS3FPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3f");
+  glWindowPos3f(x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3fv (const GLfloat *p)
+{
+  glWindowPos3fv = (PFNGLWINDOWPOS3FVPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3fv");
+  glWindowPos3fv(p);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3i (GLint x, GLint y, GLint z)
+{
+  glWindowPos3i = (PFNGLWINDOWPOS3IPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3i");
+  glWindowPos3i(x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3iv (const GLint *p)
+{
+  glWindowPos3iv = (PFNGLWINDOWPOS3IVPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3iv");
+  glWindowPos3iv(p);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3s (GLshort x, GLshort y, GLshort z)
+{
+  glWindowPos3s = (PFNGLWINDOWPOS3SPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3s");
+  glWindowPos3s(x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3sv (const GLshort *p)
+{
+  glWindowPos3sv = (PFNGLWINDOWPOS3SVPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3sv");
+  glWindowPos3sv(p);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBeginQuery (GLenum target, GLuint id)
+{
+  glBeginQuery = (PFNGLBEGINQUERYPROC)glewGetProcAddress((const GLubyte*)"glBeginQuery");
+  glBeginQuery(target, id);
+}
+
+static void GLAPIENTRY _glewLazy_glBindBuffer (GLenum target, GLuint buffer)
+{
+  glBindBuffer = (PFNGLBINDBUFFERPROC)glewGetProcAddress((const GLubyte*)"glBindBuffer");
+  glBindBuffer(target, buffer);
+}
+
+static void GLAPIENTRY _glewLazy_glBufferData (GLenum target, GLsizeiptr size, const void* data, GLenum usage)
+{
+  glBufferData = (PFNGLBUFFERDATAPROC)glewGetProcAddress((const GLubyte*)"glBufferData");
+  glBufferData(target, size, data, usage);
+}
+
+static void GLAPIENTRY _glewLazy_glBufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, const void* data)
+{
+  glBufferSubData = (PFNGLBUFFERSUBDATAPROC)glewGetProcAddress((const GLubyte*)"glBufferSubData");
+  glBufferSubData(target, offset, size, data);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteBuffers (GLsizei n, const GLuint* buffers)
+{
+  glDeleteBuffers = (PFNGLDELETEBUFFERSPROC)glewGetProcAddress((const GLubyte*)"glDeleteBuffers");
+  glDeleteBuffers(n, buffers);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteQueries (GLsizei n, const GLuint* ids)
+{
+  glDeleteQueries = (PFNGLDELETEQUERIESPROC)glewGetProcAddress((const GLubyte*)"glDeleteQueries");
+  glDeleteQueries(n, ids);
+}
+
+static void GLAPIENTRY _glewLazy_glEndQuery (GLenum target)
+{
+  glEndQuery = (PFNGLENDQUERYPROC)glewGetProcAddress((const GLubyte*)"glEndQuery");
+  glEndQuery(target);
+}
+
+static void GLAPIENTRY _glewLazy_glGenBuffers (GLsizei n, GLuint* buffers)
+{
+  glGenBuffers = (PFNGLGENBUFFERSPROC)glewGetProcAddress((const GLubyte*)"glGenBuffers");
+  glGenBuffers(n, buffers);
+}
+
+static void GLAPIENTRY _glewLazy_glGenQueries (GLsizei n, GLuint* ids)
+{
+  glGenQueries = (PFNGLGENQUERIESPROC)glewGetProcAddress((const GLubyte*)"glGenQueries");
+  glGenQueries(n, ids);
+}
+
+static void GLAPIENTRY _glewLazy_glGetBufferParameteriv (GLenum target, GLenum pname, GLint* params)
+{
+  glGetBufferParameteriv = (PFNGLGETBUFFERPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glGetBufferParameteriv");
+  glGetBufferParameteriv(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetBufferPointerv (GLenum target, GLenum pname, void** params)
+{
+  glGetBufferPointerv = (PFNGLGETBUFFERPOINTERVPROC)glewGetProcAddress((const GLubyte*)"glGetBufferPointerv");
+  glGetBufferPointerv(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetBufferSubData (GLenum target, GLintptr offset, GLsizeiptr size, void* data)
+{
+  glGetBufferSubData = (PFNGLGETBUFFERSUBDATAPROC)glewGetProcAddress((const GLubyte*)"glGetBufferSubData");
+  glGetBufferSubData(target, offset, size, data);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryObjectiv (GLuint id, GLenum pname, GLint* params)
+{
+  glGetQueryObjectiv = (PFNGLGETQUERYOBJECTIVPROC)glewGetProcAddress((const GLubyte*)"glGetQueryObjectiv");
+  glGetQueryObjectiv(id, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryObjectuiv (GLuint id, GLenum pname, GLuint* params)
+{
+  glGetQueryObjectuiv = (PFNGLGETQUERYOBJECTUIVPROC)glewGetProcAddress((const GLubyte*)"glGetQueryObjectuiv");
+  glGetQueryObjectuiv(id, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryiv (GLenum target, GLenum pname, GLint* params)
+{
+  glGetQueryiv = (PFNGLGETQUERYIVPROC)glewGetProcAddress((const GLubyte*)"glGetQueryiv");
+  glGetQueryiv(target, pname, params);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsBuffer (GLuint buffer)
+{
+  glIsBuffer = (PFNGLISBUFFERPROC)glewGetProcAddress((const GLubyte*)"glIsBuffer");
+  return glIsBuffer(buffer);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsQuery (GLuint id)
+{
+  glIsQuery = (PFNGLISQUERYPROC)glewGetProcAddress((const GLubyte*)"glIsQuery");
+  return glIsQuery(id);
+}
+
+static void* GLAPIENTRY _glewLazy_glMapBuffer (GLenum target, GLenum access)
+{
+  glMapBuffer = (PFNGLMAPBUFFERPROC)glewGetProcAddress((const GLubyte*)"glMapBuffer");
+  return glMapBuffer(target, access);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glUnmapBuffer (GLenum target)
+{
+  glUnmapBuffer = (PFNGLUNMAPBUFFERPROC)glewGetProcAddress((const GLubyte*)"glUnmapBuffer");
+  return glUnmapBuffer(target);
+}
+
+
+static void GLAPIENTRY _glewLazy_glAttachShader (GLuint program, GLuint shader)
+{
+  glAttachShader = (PFNGLATTACHSHADERPROC)glewGetProcAddress((const GLubyte*)"glAttachShader");
+  glAttachShader(program, shader);
+}
+
+static void GLAPIENTRY _glewLazy_glBindAttribLocation (GLuint program, GLuint index, const GLchar* name)
+{
+  glBindAttribLocation = (PFNGLBINDATTRIBLOCATIONPROC)glewGetProcAddress((const GLubyte*)"glBindAttribLocation");
+  glBindAttribLocation(program, index, name);
+}
+
+static void GLAPIENTRY _glewLazy_glBlendEquationSeparate (GLenum modeRGB, GLenum modeAlpha)
+{
+  glBlendEquationSeparate = (PFNGLBLENDEQUATIONSEPARATEPROC)glewGetProcAddress((const GLubyte*)"glBlendEquationSeparate");
+  glBlendEquationSeparate(modeRGB, modeAlpha);
+}
+
+static void GLAPIENTRY _glewLazy_glCompileShader (GLuint shader)
+{
+  glCompileShader = (PFNGLCOMPILESHADERPROC)glewGetProcAddress((const GLubyte*)"glCompileShader");
+  glCompileShader(shader);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glCreateProgram (void)
+{
+  glCreateProgram = (PFNGLCREATEPROGRAMPROC)glewGetProcAddress((const GLubyte*)"glCreateProgram");
+  return glCreateProgram();
+}
+
+static GLuint GLAPIENTRY _glewLazy_glCreateShader (GLenum type)
+{
+  glCreateShader = (PFNGLCREATESHADERPROC)glewGetProcAddress((const GLubyte*)"glCreateShader");
+  return glCreateShader(type);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteProgram (GLuint program)
+{
+  glDeleteProgram = (PFNGLDELETEPROGRAMPROC)glewGetProcAddress((const GLubyte*)"glDeleteProgram");
+  glDeleteProgram(program);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteShader (GLuint shader)
+{
+  glDeleteShader = (PFNGLDELETESHADERPROC)glewGetProcAddress((const GLubyte*)"glDeleteShader");
+  glDeleteShader(shader);
+}
+
+static void GLAPIENTRY _glewLazy_glDetachShader (GLuint program, GLuint shader)
+{
+  glDetachShader = (PFNGLDETACHSHADERPROC)glewGetProcAddress((const GLubyte*)"glDetachShader");
+  glDetachShader(program, shader);
+}
+
+static void GLAPIENTRY _glewLazy_glDisableVertexAttribArray (GLuint index)
+{
+  glDisableVertexAttribArray = (PFNGLDISABLEVERTEXATTRIBARRAYPROC)glewGetProcAddress((const GLubyte*)"glDisableVertexAttribArray");
+  glDisableVertexAttribArray(index);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawBuffers (GLsizei n, const GLenum* bufs)
+{
+  glDrawBuffers = (PFNGLDRAWBUFFERSPROC)glewGetProcAddress((const GLubyte*)"glDrawBuffers");
+  glDrawBuffers(n, bufs);
+}
+
+static void GLAPIENTRY _glewLazy_glEnableVertexAttribArray (GLuint index)
+{
+  glEnableVertexAttribArray = (PFNGLENABLEVERTEXATTRIBARRAYPROC)glewGetProcAddress((const GLubyte*)"glEnableVertexAttribArray");
+  glEnableVertexAttribArray(index);
+}
+
+static void GLAPIENTRY _glewLazy_glGetActiveAttrib (GLuint program, GLuint index, GLsizei maxLength, GLsizei* length, GLint* size, GLenum* type, GLchar* name)
+{
+  glGetActiveAttrib = (PFNGLGETACTIVEATTRIBPROC)glewGetProcAddress((const GLubyte*)"glGetActiveAttrib");
+  glGetActiveAttrib(program, index, maxLength, length, size, type, name);
+}
+
+static void GLAPIENTRY _glewLazy_glGetActiveUniform (GLuint program, GLuint index, GLsizei maxLength, GLsizei* length, GLint* size, GLenum* type, GLchar* name)
+{
+  glGetActiveUniform = (PFNGLGETACTIVEUNIFORMPROC)glewGetProcAddress((const GLubyte*)"glGetActiveUniform");
+  glGetActiveUniform(program, index, maxLength, length, size, type, name);
+}
+
+static void GLAPIENTRY _glewLazy_glGetAttachedShaders (GLuint program, GLsizei maxCount, GLsizei* count, GLuint* shaders)
+{
+  glGetAttachedShaders = (PFNGLGETATTACHEDSHADERSPROC)glewGetProcAddress((const GLubyte*)"glGetAttachedShaders");
+  glGetAttachedShaders(program, maxCount, count, shaders);
+}
+
+static GLint GLAPIENTRY _glewLazy_glGetAttribLocation (GLuint program, const GLchar* name)
+{
+  glGetAttribLocation = (PFNGLGETATTRIBLOCATIONPROC)glewGetProcAddress((const GLubyte*)"glGetAttribLocation");
+  return glGetAttribLocation(program, name);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramInfoLog (GLuint program, GLsizei bufSize, GLsizei* length, GLchar* infoLog)
+{
+  glGetProgramInfoLog = (PFNGLGETPROGRAMINFOLOGPROC)glewGetProcAddress((const GLubyte*)"glGetProgramInfoLog");
+  glGetProgramInfoLog(program, bufSize, length, infoLog);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramiv (GLuint program, GLenum pname, GLint* param)
+{
+  glGetProgramiv = (PFNGLGETPROGRAMIVPROC)glewGetProcAddress((const GLubyte*)"glGetProgramiv");
+  glGetProgramiv(program, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glGetShaderInfoLog (GLuint shader, GLsizei bufSize, GLsizei* length, GLchar* infoLog)
+{
+  glGetShaderInfoLog = (PFNGLGETSHADERINFOLOGPROC)glewGetProcAddress((const GLubyte*)"glGetShaderInfoLog");
+  glGetShaderInfoLog(shader, bufSize, length, infoLog);
+}
+
+static void GLAPIENTRY _glewLazy_glGetShaderSource (GLuint obj, GLsizei maxLength, GLsizei* length, GLchar* source)
+{
+  glGetShaderSource = (PFNGLGETSHADERSOURCEPROC)glewGetProcAddress((const GLubyte*)"glGetShaderSource");
+  glGetShaderSource(obj, maxLength, length, source);
+}
+
+static void GLAPIENTRY _glewLazy_glGetShaderiv (GLuint shader, GLenum pname, GLint* param)
+{
+  glGetShaderiv = (PFNGLGETSHADERIVPROC)glewGetProcAddress((const GLubyte*)"glGetShaderiv");
+  glGetShaderiv(shader, pname, param);
+}
+
+static GLint GLAPIENTRY _glewLazy_glGetUniformLocation (GLuint program, const GLchar* name)
+{
+  glGetUniformLocation = (PFNGLGETUNIFORMLOCATIONPROC)glewGetProcAddress((const GLubyte*)"glGetUniformLocation");
+  return glGetUniformLocation(program, name);
+}
+
+static void GLAPIENTRY _glewLazy_glGetUniformfv (GLuint program, GLint location, GLfloat* params)
+{
+  glGetUniformfv = (PFNGLGETUNIFORMFVPROC)glewGetProcAddress((const GLubyte*)"glGetUniformfv");
+  glGetUniformfv(program, location, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetUniformiv (GLuint program, GLint location, GLint* params)
+{
+  glGetUniformiv = (PFNGLGETUNIFORMIVPROC)glewGetProcAddress((const GLubyte*)"glGetUniformiv");
+  glGetUniformiv(program, location, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribPointerv (GLuint index, GLenum pname, void** pointer)
+{
+  glGetVertexAttribPointerv = (PFNGLGETVERTEXATTRIBPOINTERVPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribPointerv");
+  glGetVertexAttribPointerv(index, pname, pointer);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribdv (GLuint index, GLenum pname, GLdouble* params)
+{
+  glGetVertexAttribdv = (PFNGLGETVERTEXATTRIBDVPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribdv");
+  glGetVertexAttribdv(index, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribfv (GLuint index, GLenum pname, GLfloat* params)
+{
+  glGetVertexAttribfv = (PFNGLGETVERTEXATTRIBFVPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribfv");
+  glGetVertexAttribfv(index, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribiv (GLuint index, GLenum pname, GLint* params)
+{
+  glGetVertexAttribiv = (PFNGLGETVERTEXATTRIBIVPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribiv");
+  glGetVertexAttribiv(index, pname, params);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsProgram (GLuint program)
+{
+  glIsProgram = (PFNGLISPROGRAMPROC)glewGetProcAddress((const GLubyte*)"glIsProgram");
+  return glIsProgram(program);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsShader (GLuint shader)
+{
+  glIsShader = (PFNGLISSHADERPROC)glewGetProcAddress((const GLubyte*)"glIsShader");
+  return glIsShader(shader);
+}
+
+static void GLAPIENTRY _glewLazy_glLinkProgram (GLuint program)
+{
+  glLinkProgram = (PFNGLLINKPROGRAMPROC)glewGetProcAddress((const GLubyte*)"glLinkProgram");
+  glLinkProgram(program);
+}
+
+static void GLAPIENTRY _glewLazy_glShaderSource (GLuint shader, GLsizei count, const GLchar *const* string, const GLint* length)
+{
+  glShaderSource = (PFNGLSHADERSOURCEPROC)glewGetProcAddress((const GLubyte*)"glShaderSource");
+  glShaderSource(shader, count, string, length);
+}
+
+static void GLAPIENTRY _glewLazy_glStencilFuncSeparate (GLenum frontfunc, GLenum backfunc, GLint ref, GLuint mask)
+{
+  glStencilFuncSeparate = (PFNGLSTENCILFUNCSEPARATEPROC)glewGetProcAddress((const GLubyte*)"glStencilFuncSeparate");
+  glStencilFuncSeparate(frontfunc, backfunc, ref, mask);
+}
+
+static void GLAPIENTRY _glewLazy_glStencilMaskSeparate (GLenum face, GLuint mask)
+{
+  glStencilMaskSeparate = (PFNGLSTENCILMASKSEPARATEPROC)glewGetProcAddress((const GLubyte*)"glStencilMaskSeparate");
+  glStencilMaskSeparate(face, mask);
+}
+
+static void GLAPIENTRY _glewLazy_glStencilOpSeparate (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)
+{
+  glStencilOpSeparate = (PFNGLSTENCILOPSEPARATEPROC)glewGetProcAddress((const GLubyte*)"glStencilOpSeparate");
+  glStencilOpSeparate(face, sfail, dpfail, dppass);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1f (GLint location, GLfloat v0)
+{
+  glUniform1f = (PFNGLUNIFORM1FPROC)glewGetProcAddress((const GLubyte*)"glUniform1f");
+  glUniform1f(location, v0);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1fv (GLint location, GLsizei count, const GLfloat* value)
+{
+  glUniform1fv = (PFNGLUNIFORM1FVPROC)glewGetProcAddress((const GLubyte*)"glUniform1fv");
+  glUniform1fv(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1i (GLint location, GLint v0)
+{
+  glUniform1i = (PFNGLUNIFORM1IPROC)glewGetProcAddress((const GLubyte*)"glUniform1i");
+  glUniform1i(location, v0);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1iv (GLint location, GLsizei count, const GLint* value)
+{
+  glUniform1iv = (PFNGLUNIFORM1IVPROC)glewGetProcAddress((const GLubyte*)"glUniform1iv");
+  glUniform1iv(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2f (GLint location, GLfloat v0, GLfloat v1)
+{
+  glUniform2f = (PFNGLUNIFORM2FPROC)glewGetProcAddress((const GLubyte*)"glUniform2f");
+  glUniform2f(location, v0, v1);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2fv (GLint location, GLsizei count, const GLfloat* value)
+{
+  glUniform2fv = (PFNGLUNIFORM2FVPROC)glewGetProcAddress((const GLubyte*)"glUniform2fv");
+  glUniform2fv(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2i (GLint location, GLint v0, GLint v1)
+{
+  glUniform2i = (PFNGLUNIFORM2IPROC)glewGetProcAddress((const GLubyte*)"glUniform2i");
+  glUniform2i(location, v0, v1);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2iv (GLint location, GLsizei count, const GLint* value)
+{
+  glUniform2iv = (PFNGLUNIFORM2IVPROC)glewGetProcAddress((const GLubyte*)"glUniform2iv");
+  glUniform2iv(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3f (GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+  glUniform3f = (PFNGLUNIFORM3FPROC)glewGetProcAddress((const GLubyte*)"glUniform3f");
+  glUniform3f(location, v0, v1, v2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3fv (GLint location, GLsizei count, const GLfloat* value)
+{
+  glUniform3fv = (PFNGLUNIFORM3FVPROC)glewGetProcAddress((const GLubyte*)"glUniform3fv");
+  glUniform3fv(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3i (GLint location, GLint v0, GLint v1, GLint v2)
+{
+  glUniform3i = (PFNGLUNIFORM3IPROC)glewGetProcAddress((const GLubyte*)"glUniform3i");
+  glUniform3i(location, v0, v1, v2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3iv (GLint location, GLsizei count, const GLint* value)
+{
+  glUniform3iv = (PFNGLUNIFORM3IVPROC)glewGetProcAddress((const GLubyte*)"glUniform3iv");
+  glUniform3iv(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4f (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+  glUniform4f = (PFNGLUNIFORM4FPROC)glewGetProcAddress((const GLubyte*)"glUniform4f");
+  glUniform4f(location, v0, v1, v2, v3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4fv (GLint location, GLsizei count, const GLfloat* value)
+{
+  glUniform4fv = (PFNGLUNIFORM4FVPROC)glewGetProcAddress((const GLubyte*)"glUniform4fv");
+  glUniform4fv(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4i (GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+  glUniform4i = (PFNGLUNIFORM4IPROC)glewGetProcAddress((const GLubyte*)"glUniform4i");
+  glUniform4i(location, v0, v1, v2, v3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4iv (GLint location, GLsizei count, const GLint* value)
+{
+  glUniform4iv = (PFNGLUNIFORM4IVPROC)glewGetProcAddress((const GLubyte*)"glUniform4iv");
+  glUniform4iv(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+  glUniformMatrix2fv = (PFNGLUNIFORMMATRIX2FVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix2fv");
+  glUniformMatrix2fv(location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+  glUniformMatrix3fv = (PFNGLUNIFORMMATRIX3FVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix3fv");
+  glUniformMatrix3fv(location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+  glUniformMatrix4fv = (PFNGLUNIFORMMATRIX4FVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix4fv");
+  glUniformMatrix4fv(location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUseProgram (GLuint program)
+{
+  glUseProgram = (PFNGLUSEPROGRAMPROC)glewGetProcAddress((const GLubyte*)"glUseProgram");
+  glUseProgram(program);
+}
+
+static void GLAPIENTRY _glewLazy_glValidateProgram (GLuint program)
+{
+  glValidateProgram = (PFNGLVALIDATEPROGRAMPROC)glewGetProcAddress((const GLubyte*)"glValidateProgram");
+  glValidateProgram(program);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1d (GLuint index, GLdouble x)
+{
+  glVertexAttrib1d = (PFNGLVERTEXATTRIB1DPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1d");
+  glVertexAttrib1d(index, x);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1dv (GLuint index, const GLdouble* v)
+{
+  glVertexAttrib1dv = (PFNGLVERTEXATTRIB1DVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1dv");
+  glVertexAttrib1dv(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1f (GLuint index, GLfloat x)
+{
+  glVertexAttrib1f = (PFNGLVERTEXATTRIB1FPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1f");
+  glVertexAttrib1f(index, x);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1fv (GLuint index, const GLfloat* v)
+{
+  glVertexAttrib1fv = (PFNGLVERTEXATTRIB1FVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1fv");
+  glVertexAttrib1fv(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1s (GLuint index, GLshort x)
+{
+  glVertexAttrib1s = (PFNGLVERTEXATTRIB1SPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1s");
+  glVertexAttrib1s(index, x);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1sv (GLuint index, const GLshort* v)
+{
+  glVertexAttrib1sv = (PFNGLVERTEXATTRIB1SVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1sv");
+  glVertexAttrib1sv(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2d (GLuint index, GLdouble x, GLdouble y)
+{
+  glVertexAttrib2d = (PFNGLVERTEXATTRIB2DPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2d");
+  glVertexAttrib2d(index, x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2dv (GLuint index, const GLdouble* v)
+{
+  glVertexAttrib2dv = (PFNGLVERTEXATTRIB2DVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2dv");
+  glVertexAttrib2dv(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2f (GLuint index, GLfloat x, GLfloat y)
+{
+  glVertexAttrib2f = (PFNGLVERTEXATTRIB2FPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2f");
+  glVertexAttrib2f(index, x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2fv (GLuint index, const GLfloat* v)
+{
+  glVertexAttrib2fv = (PFNGLVERTEXATTRIB2FVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2fv");
+  glVertexAttrib2fv(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2s (GLuint index, GLshort x, GLshort y)
+{
+  glVertexAttrib2s = (PFNGLVERTEXATTRIB2SPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2s");
+  glVertexAttrib2s(index, x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2sv (GLuint index, const GLshort* v)
+{
+  glVertexAttrib2sv = (PFNGLVERTEXATTRIB2SVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2sv");
+  glVertexAttrib2sv(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3d (GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+  glVertexAttrib3d = (PFNGLVERTEXATTRIB3DPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3d");
+  glVertexAttrib3d(index, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3dv (GLuint index, const GLdouble* v)
+{
+  glVertexAttrib3dv = (PFNGLVERTEXATTRIB3DVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3dv");
+  glVertexAttrib3dv(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3f (GLuint index, GLfloat x, GLfloat y, GLfloat z)
+{
+  glVertexAttrib3f = (PFNGLVERTEXATTRIB3FPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3f");
+  glVertexAttrib3f(index, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3fv (GLuint index, const GLfloat* v)
+{
+  glVertexAttrib3fv = (PFNGLVERTEXATTRIB3FVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3fv");
+  glVertexAttrib3fv(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3s (GLuint index, GLshort x, GLshort y, GLshort z)
+{
+  glVertexAttrib3s = (PFNGLVERTEXATTRIB3SPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3s");
+  glVertexAttrib3s(index, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3sv (GLuint index, const GLshort* v)
+{
+  glVertexAttrib3sv = (PFNGLVERTEXATTRIB3SVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3sv");
+  glVertexAttrib3sv(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4Nbv (GLuint index, const GLbyte* v)
+{
+  glVertexAttrib4Nbv = (PFNGLVERTEXATTRIB4NBVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4Nbv");
+  glVertexAttrib4Nbv(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4Niv (GLuint index, const GLint* v)
+{
+  glVertexAttrib4Niv = (PFNGLVERTEXATTRIB4NIVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4Niv");
+  glVertexAttrib4Niv(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4Nsv (GLuint index, const GLshort* v)
+{
+  glVertexAttrib4Nsv = (PFNGLVERTEXATTRIB4NSVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4Nsv");
+  glVertexAttrib4Nsv(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4Nub (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
+{
+  glVertexAttrib4Nub = (PFNGLVERTEXATTRIB4NUBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4Nub");
+  glVertexAttrib4Nub(index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4Nubv (GLuint index, const GLubyte* v)
+{
+  glVertexAttrib4Nubv = (PFNGLVERTEXATTRIB4NUBVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4Nubv");
+  glVertexAttrib4Nubv(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4Nuiv (GLuint index, const GLuint* v)
+{
+  glVertexAttrib4Nuiv = (PFNGLVERTEXATTRIB4NUIVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4Nuiv");
+  glVertexAttrib4Nuiv(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4Nusv (GLuint index, const GLushort* v)
+{
+  glVertexAttrib4Nusv = (PFNGLVERTEXATTRIB4NUSVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4Nusv");
+  glVertexAttrib4Nusv(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4bv (GLuint index, const GLbyte* v)
+{
+  glVertexAttrib4bv = (PFNGLVERTEXATTRIB4BVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4bv");
+  glVertexAttrib4bv(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4d (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+  glVertexAttrib4d = (PFNGLVERTEXATTRIB4DPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4d");
+  glVertexAttrib4d(index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4dv (GLuint index, const GLdouble* v)
+{
+  glVertexAttrib4dv = (PFNGLVERTEXATTRIB4DVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4dv");
+  glVertexAttrib4dv(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4f (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+  glVertexAttrib4f = (PFNGLVERTEXATTRIB4FPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4f");
+  glVertexAttrib4f(index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4fv (GLuint index, const GLfloat* v)
+{
+  glVertexAttrib4fv = (PFNGLVERTEXATTRIB4FVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4fv");
+  glVertexAttrib4fv(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4iv (GLuint index, const GLint* v)
+{
+  glVertexAttrib4iv = (PFNGLVERTEXATTRIB4IVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4iv");
+  glVertexAttrib4iv(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4s (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
+{
+  glVertexAttrib4s = (PFNGLVERTEXATTRIB4SPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4s");
+  glVertexAttrib4s(index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4sv (GLuint index, const GLshort* v)
+{
+  glVertexAttrib4sv = (PFNGLVERTEXATTRIB4SVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4sv");
+  glVertexAttrib4sv(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4ubv (GLuint index, const GLubyte* v)
+{
+  glVertexAttrib4ubv = (PFNGLVERTEXATTRIB4UBVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4ubv");
+  glVertexAttrib4ubv(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4uiv (GLuint index, const GLuint* v)
+{
+  glVertexAttrib4uiv = (PFNGLVERTEXATTRIB4UIVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4uiv");
+  glVertexAttrib4uiv(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4usv (GLuint index, const GLushort* v)
+{
+  glVertexAttrib4usv = (PFNGLVERTEXATTRIB4USVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4usv");
+  glVertexAttrib4usv(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribPointer (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void* pointer)
+{
+  glVertexAttribPointer = (PFNGLVERTEXATTRIBPOINTERPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribPointer");
+  glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+}
+
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix2x3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+  glUniformMatrix2x3fv = (PFNGLUNIFORMMATRIX2X3FVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix2x3fv");
+  glUniformMatrix2x3fv(location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix2x4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+  glUniformMatrix2x4fv = (PFNGLUNIFORMMATRIX2X4FVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix2x4fv");
+  glUniformMatrix2x4fv(location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix3x2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+  glUniformMatrix3x2fv = (PFNGLUNIFORMMATRIX3X2FVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix3x2fv");
+  glUniformMatrix3x2fv(location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix3x4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+  glUniformMatrix3x4fv = (PFNGLUNIFORMMATRIX3X4FVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix3x4fv");
+  glUniformMatrix3x4fv(location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix4x2fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+  glUniformMatrix4x2fv = (PFNGLUNIFORMMATRIX4X2FVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix4x2fv");
+  glUniformMatrix4x2fv(location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix4x3fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+  glUniformMatrix4x3fv = (PFNGLUNIFORMMATRIX4X3FVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix4x3fv");
+  glUniformMatrix4x3fv(location, count, transpose, value);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBeginConditionalRender (GLuint id, GLenum mode)
+{
+  glBeginConditionalRender = (PFNGLBEGINCONDITIONALRENDERPROC)glewGetProcAddress((const GLubyte*)"glBeginConditionalRender");
+  glBeginConditionalRender(id, mode);
+}
+
+static void GLAPIENTRY _glewLazy_glBeginTransformFeedback (GLenum primitiveMode)
+{
+  glBeginTransformFeedback = (PFNGLBEGINTRANSFORMFEEDBACKPROC)glewGetProcAddress((const GLubyte*)"glBeginTransformFeedback");
+  glBeginTransformFeedback(primitiveMode);
+}
+
+static void GLAPIENTRY _glewLazy_glBindFragDataLocation (GLuint program, GLuint colorNumber, const GLchar* name)
+{
+  glBindFragDataLocation = (PFNGLBINDFRAGDATALOCATIONPROC)glewGetProcAddress((const GLubyte*)"glBindFragDataLocation");
+  glBindFragDataLocation(program, colorNumber, name);
+}
+
+static void GLAPIENTRY _glewLazy_glClampColor (GLenum target, GLenum clamp)
+{
+  glClampColor = (PFNGLCLAMPCOLORPROC)glewGetProcAddress((const GLubyte*)"glClampColor");
+  glClampColor(target, clamp);
+}
+
+static void GLAPIENTRY _glewLazy_glClearBufferfi (GLenum buffer, GLint drawBuffer, GLfloat depth, GLint stencil)
+{
+  glClearBufferfi = (PFNGLCLEARBUFFERFIPROC)glewGetProcAddress((const GLubyte*)"glClearBufferfi");
+  glClearBufferfi(buffer, drawBuffer, depth, stencil);
+}
+
+static void GLAPIENTRY _glewLazy_glClearBufferfv (GLenum buffer, GLint drawBuffer, const GLfloat* value)
+{
+  glClearBufferfv = (PFNGLCLEARBUFFERFVPROC)glewGetProcAddress((const GLubyte*)"glClearBufferfv");
+  glClearBufferfv(buffer, drawBuffer, value);
+}
+
+static void GLAPIENTRY _glewLazy_glClearBufferiv (GLenum buffer, GLint drawBuffer, const GLint* value)
+{
+  glClearBufferiv = (PFNGLCLEARBUFFERIVPROC)glewGetProcAddress((const GLubyte*)"glClearBufferiv");
+  glClearBufferiv(buffer, drawBuffer, value);
+}
+
+static void GLAPIENTRY _glewLazy_glClearBufferuiv (GLenum buffer, GLint drawBuffer, const GLuint* value)
+{
+  glClearBufferuiv = (PFNGLCLEARBUFFERUIVPROC)glewGetProcAddress((const GLubyte*)"glClearBufferuiv");
+  glClearBufferuiv(buffer, drawBuffer, value);
+}
+
+static void GLAPIENTRY _glewLazy_glColorMaski (GLuint buf, GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha)
+{
+  glColorMaski = (PFNGLCOLORMASKIPROC)glewGetProcAddress((const GLubyte*)"glColorMaski");
+  glColorMaski(buf, red, green, blue, alpha);
+}
+
+static void GLAPIENTRY _glewLazy_glDisablei (GLenum cap, GLuint index)
+{
+  glDisablei = (PFNGLDISABLEIPROC)glewGetProcAddress((const GLubyte*)"glDisablei");
+  glDisablei(cap, index);
+}
+
+static void GLAPIENTRY _glewLazy_glEnablei (GLenum cap, GLuint index)
+{
+  glEnablei = (PFNGLENABLEIPROC)glewGetProcAddress((const GLubyte*)"glEnablei");
+  glEnablei(cap, index);
+}
+
+static void GLAPIENTRY _glewLazy_glEndConditionalRender (void)
+{
+  glEndConditionalRender = (PFNGLENDCONDITIONALRENDERPROC)glewGetProcAddress((const GLubyte*)"glEndConditionalRender");
+  glEndConditionalRender();
+}
+
+static void GLAPIENTRY _glewLazy_glEndTransformFeedback (void)
+{
+  glEndTransformFeedback = (PFNGLENDTRANSFORMFEEDBACKPROC)glewGetProcAddress((const GLubyte*)"glEndTransformFeedback");
+  glEndTransformFeedback();
+}
+
+static void GLAPIENTRY _glewLazy_glGetBooleani_v (GLenum pname, GLuint index, GLboolean* data)
+{
+  glGetBooleani_v = (PFNGLGETBOOLEANI_VPROC)glewGetProcAddress((const GLubyte*)"glGetBooleani_v");
+  glGetBooleani_v(pname, index, data);
+}
+
+static GLint GLAPIENTRY _glewLazy_glGetFragDataLocation (GLuint program, const GLchar* name)
+{
+  glGetFragDataLocation = (PFNGLGETFRAGDATALOCATIONPROC)glewGetProcAddress((const GLubyte*)"glGetFragDataLocation");
+  return glGetFragDataLocation(program, name);
+}
+
+static const GLubyte* GLAPIENTRY _glewLazy_glGetStringi (GLenum name, GLuint index)
+{
+  glGetStringi = (PFNGLGETSTRINGIPROC)glewGetProcAddress((const GLubyte*)"glGetStringi");
+  return glGetStringi(name, index);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTexParameterIiv (GLenum target, GLenum pname, GLint* params)
+{
+  glGetTexParameterIiv = (PFNGLGETTEXPARAMETERIIVPROC)glewGetProcAddress((const GLubyte*)"glGetTexParameterIiv");
+  glGetTexParameterIiv(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTexParameterIuiv (GLenum target, GLenum pname, GLuint* params)
+{
+  glGetTexParameterIuiv = (PFNGLGETTEXPARAMETERIUIVPROC)glewGetProcAddress((const GLubyte*)"glGetTexParameterIuiv");
+  glGetTexParameterIuiv(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTransformFeedbackVarying (GLuint program, GLuint index, GLsizei bufSize, GLsizei * length, GLsizei * size, GLenum * type, GLchar * name)
+{
+  glGetTransformFeedbackVarying = (PFNGLGETTRANSFORMFEEDBACKVARYINGPROC)glewGetProcAddress((const GLubyte*)"glGetTransformFeedbackVarying");
+  glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+}
+
+static void GLAPIENTRY _glewLazy_glGetUniformuiv (GLuint program, GLint location, GLuint* params)
+{
+  glGetUniformuiv = (PFNGLGETUNIFORMUIVPROC)glewGetProcAddress((const GLubyte*)"glGetUniformuiv");
+  glGetUniformuiv(program, location, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribIiv (GLuint index, GLenum pname, GLint* params)
+{
+  glGetVertexAttribIiv = (PFNGLGETVERTEXATTRIBIIVPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribIiv");
+  glGetVertexAttribIiv(index, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribIuiv (GLuint index, GLenum pname, GLuint* params)
+{
+  glGetVertexAttribIuiv = (PFNGLGETVERTEXATTRIBIUIVPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribIuiv");
+  glGetVertexAttribIuiv(index, pname, params);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsEnabledi (GLenum cap, GLuint index)
+{
+  glIsEnabledi = (PFNGLISENABLEDIPROC)glewGetProcAddress((const GLubyte*)"glIsEnabledi");
+  return glIsEnabledi(cap, index);
+}
+
+static void GLAPIENTRY _glewLazy_glTexParameterIiv (GLenum target, GLenum pname, const GLint* params)
+{
+  glTexParameterIiv = (PFNGLTEXPARAMETERIIVPROC)glewGetProcAddress((const GLubyte*)"glTexParameterIiv");
+  glTexParameterIiv(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glTexParameterIuiv (GLenum target, GLenum pname, const GLuint* params)
+{
+  glTexParameterIuiv = (PFNGLTEXPARAMETERIUIVPROC)glewGetProcAddress((const GLubyte*)"glTexParameterIuiv");
+  glTexParameterIuiv(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glTransformFeedbackVaryings (GLuint program, GLsizei count, const GLchar *const* varyings, GLenum bufferMode)
+{
+  glTransformFeedbackVaryings = (PFNGLTRANSFORMFEEDBACKVARYINGSPROC)glewGetProcAddress((const GLubyte*)"glTransformFeedbackVaryings");
+  glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1ui (GLint location, GLuint v0)
+{
+  glUniform1ui = (PFNGLUNIFORM1UIPROC)glewGetProcAddress((const GLubyte*)"glUniform1ui");
+  glUniform1ui(location, v0);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1uiv (GLint location, GLsizei count, const GLuint* value)
+{
+  glUniform1uiv = (PFNGLUNIFORM1UIVPROC)glewGetProcAddress((const GLubyte*)"glUniform1uiv");
+  glUniform1uiv(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2ui (GLint location, GLuint v0, GLuint v1)
+{
+  glUniform2ui = (PFNGLUNIFORM2UIPROC)glewGetProcAddress((const GLubyte*)"glUniform2ui");
+  glUniform2ui(location, v0, v1);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2uiv (GLint location, GLsizei count, const GLuint* value)
+{
+  glUniform2uiv = (PFNGLUNIFORM2UIVPROC)glewGetProcAddress((const GLubyte*)"glUniform2uiv");
+  glUniform2uiv(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3ui (GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+  glUniform3ui = (PFNGLUNIFORM3UIPROC)glewGetProcAddress((const GLubyte*)"glUniform3ui");
+  glUniform3ui(location, v0, v1, v2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3uiv (GLint location, GLsizei count, const GLuint* value)
+{
+  glUniform3uiv = (PFNGLUNIFORM3UIVPROC)glewGetProcAddress((const GLubyte*)"glUniform3uiv");
+  glUniform3uiv(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4ui (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+  glUniform4ui = (PFNGLUNIFORM4UIPROC)glewGetProcAddress((const GLubyte*)"glUniform4ui");
+  glUniform4ui(location, v0, v1, v2, v3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4uiv (GLint location, GLsizei count, const GLuint* value)
+{
+  glUniform4uiv = (PFNGLUNIFORM4UIVPROC)glewGetProcAddress((const GLubyte*)"glUniform4uiv");
+  glUniform4uiv(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI1i (GLuint index, GLint v0)
+{
+  glVertexAttribI1i = (PFNGLVERTEXATTRIBI1IPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI1i");
+  glVertexAttribI1i(index, v0);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI1iv (GLuint index, const GLint* v0)
+{
+  glVertexAttribI1iv = (PFNGLVERTEXATTRIBI1IVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI1iv");
+  glVertexAttribI1iv(index, v0);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI1ui (GLuint index, GLuint v0)
+{
+  glVertexAttribI1ui = (PFNGLVERTEXATTRIBI1UIPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI1ui");
+  glVertexAttribI1ui(index, v0);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI1uiv (GLuint index, const GLuint* v0)
+{
+  glVertexAttribI1uiv = (PFNGLVERTEXATTRIBI1UIVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI1uiv");
+  glVertexAttribI1uiv(index, v0);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI2i (GLuint index, GLint v0, GLint v1)
+{
+  glVertexAttribI2i = (PFNGLVERTEXATTRIBI2IPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI2i");
+  glVertexAttribI2i(index, v0, v1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI2iv (GLuint index, const GLint* v0)
+{
+  glVertexAttribI2iv = (PFNGLVERTEXATTRIBI2IVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI2iv");
+  glVertexAttribI2iv(index, v0);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI2ui (GLuint index, GLuint v0, GLuint v1)
+{
+  glVertexAttribI2ui = (PFNGLVERTEXATTRIBI2UIPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI2ui");
+  glVertexAttribI2ui(index, v0, v1);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI2uiv (GLuint index, const GLuint* v0)
+{
+  glVertexAttribI2uiv = (PFNGLVERTEXATTRIBI2UIVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI2uiv");
+  glVertexAttribI2uiv(index, v0);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI3i (GLuint index, GLint v0, GLint v1, GLint v2)
+{
+  glVertexAttribI3i = (PFNGLVERTEXATTRIBI3IPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI3i");
+  glVertexAttribI3i(index, v0, v1, v2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI3iv (GLuint index, const GLint* v0)
+{
+  glVertexAttribI3iv = (PFNGLVERTEXATTRIBI3IVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI3iv");
+  glVertexAttribI3iv(index, v0);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI3ui (GLuint index, GLuint v0, GLuint v1, GLuint v2)
+{
+  glVertexAttribI3ui = (PFNGLVERTEXATTRIBI3UIPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI3ui");
+  glVertexAttribI3ui(index, v0, v1, v2);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI3uiv (GLuint index, const GLuint* v0)
+{
+  glVertexAttribI3uiv = (PFNGLVERTEXATTRIBI3UIVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI3uiv");
+  glVertexAttribI3uiv(index, v0);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI4bv (GLuint index, const GLbyte* v0)
+{
+  glVertexAttribI4bv = (PFNGLVERTEXATTRIBI4BVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI4bv");
+  glVertexAttribI4bv(index, v0);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI4i (GLuint index, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+  glVertexAttribI4i = (PFNGLVERTEXATTRIBI4IPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI4i");
+  glVertexAttribI4i(index, v0, v1, v2, v3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI4iv (GLuint index, const GLint* v0)
+{
+  glVertexAttribI4iv = (PFNGLVERTEXATTRIBI4IVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI4iv");
+  glVertexAttribI4iv(index, v0);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI4sv (GLuint index, const GLshort* v0)
+{
+  glVertexAttribI4sv = (PFNGLVERTEXATTRIBI4SVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI4sv");
+  glVertexAttribI4sv(index, v0);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI4ubv (GLuint index, const GLubyte* v0)
+{
+  glVertexAttribI4ubv = (PFNGLVERTEXATTRIBI4UBVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI4ubv");
+  glVertexAttribI4ubv(index, v0);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI4ui (GLuint index, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+  glVertexAttribI4ui = (PFNGLVERTEXATTRIBI4UIPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI4ui");
+  glVertexAttribI4ui(index, v0, v1, v2, v3);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI4uiv (GLuint index, const GLuint* v0)
+{
+  glVertexAttribI4uiv = (PFNGLVERTEXATTRIBI4UIVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI4uiv");
+  glVertexAttribI4uiv(index, v0);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI4usv (GLuint index, const GLushort* v0)
+{
+  glVertexAttribI4usv = (PFNGLVERTEXATTRIBI4USVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI4usv");
+  glVertexAttribI4usv(index, v0);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribIPointer (GLuint index, GLint size, GLenum type, GLsizei stride, const void*pointer)
+{
+  glVertexAttribIPointer = (PFNGLVERTEXATTRIBIPOINTERPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribIPointer");
+  glVertexAttribIPointer(index, size, type, stride, pointer);
+}
+
+
+static void GLAPIENTRY _glewLazy_glDrawArraysInstanced (GLenum mode, GLint first, GLsizei count, GLsizei primcount)
+{
+  glDrawArraysInstanced = (PFNGLDRAWARRAYSINSTANCEDPROC)glewGetProcAddress((const GLubyte*)"glDrawArraysInstanced");
+  glDrawArraysInstanced(mode, first, count, primcount);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawElementsInstanced (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei primcount)
+{
+  glDrawElementsInstanced = (PFNGLDRAWELEMENTSINSTANCEDPROC)glewGetProcAddress((const GLubyte*)"glDrawElementsInstanced");
+  glDrawElementsInstanced(mode, count, type, indices, primcount);
+}
+
+static void GLAPIENTRY _glewLazy_glPrimitiveRestartIndex (GLuint buffer)
+{
+  glPrimitiveRestartIndex = (PFNGLPRIMITIVERESTARTINDEXPROC)glewGetProcAddress((const GLubyte*)"glPrimitiveRestartIndex");
+  glPrimitiveRestartIndex(buffer);
+}
+
+static void GLAPIENTRY _glewLazy_glTexBuffer (GLenum target, GLenum internalFormat, GLuint buffer)
+{
+  glTexBuffer = (PFNGLTEXBUFFERPROC)glewGetProcAddress((const GLubyte*)"glTexBuffer");
+  glTexBuffer(target, internalFormat, buffer);
+}
+
+
+static void GLAPIENTRY _glewLazy_glFramebufferTexture (GLenum target, GLenum attachment, GLuint texture, GLint level)
+{
+  glFramebufferTexture = (PFNGLFRAMEBUFFERTEXTUREPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTexture");
+  glFramebufferTexture(target, attachment, texture, level);
+}
+
+static void GLAPIENTRY _glewLazy_glGetBufferParameteri64v (GLenum target, GLenum value, GLint64 * data)
+{
+  glGetBufferParameteri64v = (PFNGLGETBUFFERPARAMETERI64VPROC)glewGetProcAddress((const GLubyte*)"glGetBufferParameteri64v");
+  glGetBufferParameteri64v(target, value, data);
+}
+
+static void GLAPIENTRY _glewLazy_glGetInteger64i_v (GLenum pname, GLuint index, GLint64 * data)
+{
+  glGetInteger64i_v = (PFNGLGETINTEGER64I_VPROC)glewGetProcAddress((const GLubyte*)"glGetInteger64i_v");
+  glGetInteger64i_v(pname, index, data);
+}
+
+
+static void GLAPIENTRY _glewLazy_glVertexAttribDivisor (GLuint index, GLuint divisor)
+{
+  glVertexAttribDivisor = (PFNGLVERTEXATTRIBDIVISORPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribDivisor");
+  glVertexAttribDivisor(index, divisor);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBlendEquationSeparatei (GLuint buf, GLenum modeRGB, GLenum modeAlpha)
+{
+  glBlendEquationSeparatei = (PFNGLBLENDEQUATIONSEPARATEIPROC)glewGetProcAddress((const GLubyte*)"glBlendEquationSeparatei");
+  glBlendEquationSeparatei(buf, modeRGB, modeAlpha);
+}
+
+static void GLAPIENTRY _glewLazy_glBlendEquationi (GLuint buf, GLenum mode)
+{
+  glBlendEquationi = (PFNGLBLENDEQUATIONIPROC)glewGetProcAddress((const GLubyte*)"glBlendEquationi");
+  glBlendEquationi(buf, mode);
+}
+
+static void GLAPIENTRY _glewLazy_glBlendFuncSeparatei (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+  glBlendFuncSeparatei = (PFNGLBLENDFUNCSEPARATEIPROC)glewGetProcAddress((const GLubyte*)"glBlendFuncSeparatei");
+  glBlendFuncSeparatei(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+
+static void GLAPIENTRY _glewLazy_glBlendFunci (GLuint buf, GLenum src, GLenum dst)
+{
+  glBlendFunci = (PFNGLBLENDFUNCIPROC)glewGetProcAddress((const GLubyte*)"glBlendFunci");
+  glBlendFunci(buf, src, dst);
+}
+
+static void GLAPIENTRY _glewLazy_glMinSampleShading (GLclampf value)
+{
+  glMinSampleShading = (PFNGLMINSAMPLESHADINGPROC)glewGetProcAddress((const GLubyte*)"glMinSampleShading");
+  glMinSampleShading(value);
+}
+
+
+static GLenum GLAPIENTRY _glewLazy_glGetGraphicsResetStatus (void)
+{
+  glGetGraphicsResetStatus = (PFNGLGETGRAPHICSRESETSTATUSPROC)glewGetProcAddress((const GLubyte*)"glGetGraphicsResetStatus");
+  return glGetGraphicsResetStatus();
+}
+
+
+PFNGLCOPYTEXSUBIMAGE3DPROC __glewCopyTexSubImage3D = _glewLazy_glCopyTexSubImage3D;
+PFNGLDRAWRANGEELEMENTSPROC __glewDrawRangeElements = _glewLazy_glDrawRangeElements;
+PFNGLTEXIMAGE3DPROC __glewTexImage3D = _glewLazy_glTexImage3D;
+PFNGLTEXSUBIMAGE3DPROC __glewTexSubImage3D = _glewLazy_glTexSubImage3D;
+
+PFNGLACTIVETEXTUREPROC __glewActiveTexture = _glewLazy_glActiveTexture;
+PFNGLCLIENTACTIVETEXTUREPROC __glewClientActiveTexture = _glewLazy_glClientActiveTexture;
+PFNGLCOMPRESSEDTEXIMAGE1DPROC __glewCompressedTexImage1D = _glewLazy_glCompressedTexImage1D;
+PFNGLCOMPRESSEDTEXIMAGE2DPROC __glewCompressedTexImage2D = _glewLazy_glCompressedTexImage2D;
+PFNGLCOMPRESSEDTEXIMAGE3DPROC __glewCompressedTexImage3D = _glewLazy_glCompressedTexImage3D;
+PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC __glewCompressedTexSubImage1D = _glewLazy_glCompressedTexSubImage1D;
+PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC __glewCompressedTexSubImage2D = _glewLazy_glCompressedTexSubImage2D;
+PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC __glewCompressedTexSubImage3D = _glewLazy_glCompressedTexSubImage3D;
+PFNGLGETCOMPRESSEDTEXIMAGEPROC __glewGetCompressedTexImage = _glewLazy_glGetCompressedTexImage;
+PFNGLLOADTRANSPOSEMATRIXDPROC __glewLoadTransposeMatrixd = _glewLazy_glLoadTransposeMatrixd;
+PFNGLLOADTRANSPOSEMATRIXFPROC __glewLoadTransposeMatrixf = _glewLazy_glLoadTransposeMatrixf;
+PFNGLMULTTRANSPOSEMATRIXDPROC __glewMultTransposeMatrixd = _glewLazy_glMultTransposeMatrixd;
+PFNGLMULTTRANSPOSEMATRIXFPROC __glewMultTransposeMatrixf = _glewLazy_glMultTransposeMatrixf;
+PFNGLMULTITEXCOORD1DPROC __glewMultiTexCoord1d = _glewLazy_glMultiTexCoord1d;
+PFNGLMULTITEXCOORD1DVPROC __glewMultiTexCoord1dv = _glewLazy_glMultiTexCoord1dv;
+PFNGLMULTITEXCOORD1FPROC __glewMultiTexCoord1f = _glewLazy_glMultiTexCoord1f;
+PFNGLMULTITEXCOORD1FVPROC __glewMultiTexCoord1fv = _glewLazy_glMultiTexCoord1fv;
+PFNGLMULTITEXCOORD1IPROC __glewMultiTexCoord1i = _glewLazy_glMultiTexCoord1i;
+PFNGLMULTITEXCOORD1IVPROC __glewMultiTexCoord1iv = _glewLazy_glMultiTexCoord1iv;
+PFNGLMULTITEXCOORD1SPROC __glewMultiTexCoord1s = _glewLazy_glMultiTexCoord1s;
+PFNGLMULTITEXCOORD1SVPROC __glewMultiTexCoord1sv = _glewLazy_glMultiTexCoord1sv;
+PFNGLMULTITEXCOORD2DPROC __glewMultiTexCoord2d = _glewLazy_glMultiTexCoord2d;
+PFNGLMULTITEXCOORD2DVPROC __glewMultiTexCoord2dv = _glewLazy_glMultiTexCoord2dv;
+PFNGLMULTITEXCOORD2FPROC __glewMultiTexCoord2f = _glewLazy_glMultiTexCoord2f;
+PFNGLMULTITEXCOORD2FVPROC __glewMultiTexCoord2fv = _glewLazy_glMultiTexCoord2fv;
+PFNGLMULTITEXCOORD2IPROC __glewMultiTexCoord2i = _glewLazy_glMultiTexCoord2i;
+PFNGLMULTITEXCOORD2IVPROC __glewMultiTexCoord2iv = _glewLazy_glMultiTexCoord2iv;
+PFNGLMULTITEXCOORD2SPROC __glewMultiTexCoord2s = _glewLazy_glMultiTexCoord2s;
+PFNGLMULTITEXCOORD2SVPROC __glewMultiTexCoord2sv = _glewLazy_glMultiTexCoord2sv;
+PFNGLMULTITEXCOORD3DPROC __glewMultiTexCoord3d = _glewLazy_glMultiTexCoord3d;
+PFNGLMULTITEXCOORD3DVPROC __glewMultiTexCoord3dv = _glewLazy_glMultiTexCoord3dv;
+PFNGLMULTITEXCOORD3FPROC __glewMultiTexCoord3f = _glewLazy_glMultiTexCoord3f;
+PFNGLMULTITEXCOORD3FVPROC __glewMultiTexCoord3fv = _glewLazy_glMultiTexCoord3fv;
+PFNGLMULTITEXCOORD3IPROC __glewMultiTexCoord3i = _glewLazy_glMultiTexCoord3i;
+PFNGLMULTITEXCOORD3IVPROC __glewMultiTexCoord3iv = _glewLazy_glMultiTexCoord3iv;
+PFNGLMULTITEXCOORD3SPROC __glewMultiTexCoord3s = _glewLazy_glMultiTexCoord3s;
+PFNGLMULTITEXCOORD3SVPROC __glewMultiTexCoord3sv = _glewLazy_glMultiTexCoord3sv;
+PFNGLMULTITEXCOORD4DPROC __glewMultiTexCoord4d = _glewLazy_glMultiTexCoord4d;
+PFNGLMULTITEXCOORD4DVPROC __glewMultiTexCoord4dv = _glewLazy_glMultiTexCoord4dv;
+PFNGLMULTITEXCOORD4FPROC __glewMultiTexCoord4f = _glewLazy_glMultiTexCoord4f;
+PFNGLMULTITEXCOORD4FVPROC __glewMultiTexCoord4fv = _glewLazy_glMultiTexCoord4fv;
+PFNGLMULTITEXCOORD4IPROC __glewMultiTexCoord4i = _glewLazy_glMultiTexCoord4i;
+PFNGLMULTITEXCOORD4IVPROC __glewMultiTexCoord4iv = _glewLazy_glMultiTexCoord4iv;
+PFNGLMULTITEXCOORD4SPROC __glewMultiTexCoord4s = _glewLazy_glMultiTexCoord4s;
+PFNGLMULTITEXCOORD4SVPROC __glewMultiTexCoord4sv = _glewLazy_glMultiTexCoord4sv;
+PFNGLSAMPLECOVERAGEPROC __glewSampleCoverage = _glewLazy_glSampleCoverage;
+
+PFNGLBLENDCOLORPROC __glewBlendColor = _glewLazy_glBlendColor;
+PFNGLBLENDEQUATIONPROC __glewBlendEquation = _glewLazy_glBlendEquation;
+PFNGLBLENDFUNCSEPARATEPROC __glewBlendFuncSeparate = _glewLazy_glBlendFuncSeparate;
+PFNGLFOGCOORDPOINTERPROC __glewFogCoordPointer = _glewLazy_glFogCoordPointer;
+PFNGLFOGCOORDDPROC __glewFogCoordd = _glewLazy_glFogCoordd;
+PFNGLFOGCOORDDVPROC __glewFogCoorddv = _glewLazy_glFogCoorddv;
+PFNGLFOGCOORDFPROC __glewFogCoordf = _glewLazy_glFogCoordf;
+PFNGLFOGCOORDFVPROC __glewFogCoordfv = _glewLazy_glFogCoordfv;
+PFNGLMULTIDRAWARRAYSPROC __glewMultiDrawArrays = _glewLazy_glMultiDrawArrays;
+PFNGLMULTIDRAWELEMENTSPROC __glewMultiDrawElements = _glewLazy_glMultiDrawElements;
+PFNGLPOINTPARAMETERFPROC __glewPointParameterf = _glewLazy_glPointParameterf;
+PFNGLPOINTPARAMETERFVPROC __glewPointParameterfv = _glewLazy_glPointParameterfv;
+PFNGLPOINTPARAMETERIPROC __glewPointParameteri = _glewLazy_glPointParameteri;
+PFNGLPOINTPARAMETERIVPROC __glewPointParameteriv = _glewLazy_glPointParameteriv;
+PFNGLSECONDARYCOLOR3BPROC __glewSecondaryColor3b = _glewLazy_glSecondaryColor3b;
+PFNGLSECONDARYCOLOR3BVPROC __glewSecondaryColor3bv = _glewLazy_glSecondaryColor3bv;
+PFNGLSECONDARYCOLOR3DPROC __glewSecondaryColor3d = _glewLazy_glSecondaryColor3d;
+PFNGLSECONDARYCOLOR3DVPROC __glewSecondaryColor3dv = _glewLazy_glSecondaryColor3dv;
+PFNGLSECONDARYCOLOR3FPROC __glewSecondaryColor3f = _glewLazy_glSecondaryColor3f;
+PFNGLSECONDARYCOLOR3FVPROC __glewSecondaryColor3fv = _glewLazy_glSecondaryColor3fv;
+PFNGLSECONDARYCOLOR3IPROC __glewSecondaryColor3i = _glewLazy_glSecondaryColor3i;
+PFNGLSECONDARYCOLOR3IVPROC __glewSecondaryColor3iv = _glewLazy_glSecondaryColor3iv;
+PFNGLSECONDARYCOLOR3SPROC __glewSecondaryColor3s = _glewLazy_glSecondaryColor3s;
+PFNGLSECONDARYCOLOR3SVPROC __glewSecondaryColor3sv = _glewLazy_glSecondaryColor3sv;
+PFNGLSECONDARYCOLOR3UBPROC __glewSecondaryColor3ub = _glewLazy_glSecondaryColor3ub;
+PFNGLSECONDARYCOLOR3UBVPROC __glewSecondaryColor3ubv = _glewLazy_glSecondaryColor3ubv;
+PFNGLSECONDARYCOLOR3UIPROC __glewSecondaryColor3ui = _glewLazy_glSecondaryColor3ui;
+PFNGLSECONDARYCOLOR3UIVPROC __glewSecondaryColor3uiv = _glewLazy_glSecondaryColor3uiv;
+PFNGLSECONDARYCOLOR3USPROC __glewSecondaryColor3us = _glewLazy_glSecondaryColor3us;
+PFNGLSECONDARYCOLOR3USVPROC __glewSecondaryColor3usv = _glewLazy_glSecondaryColor3usv;
+PFNGLSECONDARYCOLORPOINTERPROC __glewSecondaryColorPointer = _glewLazy_glSecondaryColorPointer;
+PFNGLWINDOWPOS2DPROC __glewWindowPos2d = _glewLazy_glWindowPos2d;
+PFNGLWINDOWPOS2DVPROC __glewWindowPos2dv = _glewLazy_glWindowPos2dv;
+PFNGLWINDOWPOS2FPROC __glewWindowPos2f = _glewLazy_glWindowPos2f;
+PFNGLWINDOWPOS2FVPROC __glewWindowPos2fv = _glewLazy_glWindowPos2fv;
+PFNGLWINDOWPOS2IPROC __glewWindowPos2i = _glewLazy_glWindowPos2i;
+PFNGLWINDOWPOS2IVPROC __glewWindowPos2iv = _glewLazy_glWindowPos2iv;
+PFNGLWINDOWPOS2SPROC __glewWindowPos2s = _glewLazy_glWindowPos2s;
+PFNGLWINDOWPOS2SVPROC __glewWindowPos2sv = _glewLazy_glWindowPos2sv;
+PFNGLWINDOWPOS3DPROC __glewWindowPos3d = _glewLazy_glWindowPos3d;
+PFNGLWINDOWPOS3DVPROC __glewWindowPos3dv = _glewLazy_glWindowPos3dv;
+PFNGLWINDOWPOS3FPROC __glewWindowPos3f = _glewLazy_glWindowPos3f;
+PFNGLWINDOWPOS3FVPROC __glewWindowPos3fv = _glewLazy_glWindowPos3fv;
+PFNGLWINDOWPOS3IPROC __glewWindowPos3i = _glewLazy_glWindowPos3i;
+PFNGLWINDOWPOS3IVPROC __glewWindowPos3iv = _glewLazy_glWindowPos3iv;
+PFNGLWINDOWPOS3SPROC __glewWindowPos3s = _glewLazy_glWindowPos3s;
+PFNGLWINDOWPOS3SVPROC __glewWindowPos3sv = _glewLazy_glWindowPos3sv;
+
+PFNGLBEGINQUERYPROC __glewBeginQuery = _glewLazy_glBeginQuery;
+PFNGLBINDBUFFERPROC __glewBindBuffer = _glewLazy_glBindBuffer;
+PFNGLBUFFERDATAPROC __glewBufferData = _glewLazy_glBufferData;
+PFNGLBUFFERSUBDATAPROC __glewBufferSubData = _glewLazy_glBufferSubData;
+PFNGLDELETEBUFFERSPROC __glewDeleteBuffers = _glewLazy_glDeleteBuffers;
+PFNGLDELETEQUERIESPROC __glewDeleteQueries = _glewLazy_glDeleteQueries;
+PFNGLENDQUERYPROC __glewEndQuery = _glewLazy_glEndQuery;
+PFNGLGENBUFFERSPROC __glewGenBuffers = _glewLazy_glGenBuffers;
+PFNGLGENQUERIESPROC __glewGenQueries = _glewLazy_glGenQueries;
+PFNGLGETBUFFERPARAMETERIVPROC __glewGetBufferParameteriv = _glewLazy_glGetBufferParameteriv;
+PFNGLGETBUFFERPOINTERVPROC __glewGetBufferPointerv = _glewLazy_glGetBufferPointerv;
+PFNGLGETBUFFERSUBDATAPROC __glewGetBufferSubData = _glewLazy_glGetBufferSubData;
+PFNGLGETQUERYOBJECTIVPROC __glewGetQueryObjectiv = _glewLazy_glGetQueryObjectiv;
+PFNGLGETQUERYOBJECTUIVPROC __glewGetQueryObjectuiv = _glewLazy_glGetQueryObjectuiv;
+PFNGLGETQUERYIVPROC __glewGetQueryiv = _glewLazy_glGetQueryiv;
+PFNGLISBUFFERPROC __glewIsBuffer = _glewLazy_glIsBuffer;
+PFNGLISQUERYPROC __glewIsQuery = _glewLazy_glIsQuery;
+PFNGLMAPBUFFERPROC __glewMapBuffer = _glewLazy_glMapBuffer;
+PFNGLUNMAPBUFFERPROC __glewUnmapBuffer = _glewLazy_glUnmapBuffer;
+
+PFNGLATTACHSHADERPROC __glewAttachShader = _glewLazy_glAttachShader;
+PFNGLBINDATTRIBLOCATIONPROC __glewBindAttribLocation = _glewLazy_glBindAttribLocation;
+PFNGLBLENDEQUATIONSEPARATEPROC __glewBlendEquationSeparate = _glewLazy_glBlendEquationSeparate;
+PFNGLCOMPILESHADERPROC __glewCompileShader = _glewLazy_glCompileShader;
+PFNGLCREATEPROGRAMPROC __glewCreateProgram = _glewLazy_glCreateProgram;
+PFNGLCREATESHADERPROC __glewCreateShader = _glewLazy_glCreateShader;
+PFNGLDELETEPROGRAMPROC __glewDeleteProgram = _glewLazy_glDeleteProgram;
+PFNGLDELETESHADERPROC __glewDeleteShader = _glewLazy_glDeleteShader;
+PFNGLDETACHSHADERPROC __glewDetachShader = _glewLazy_glDetachShader;
+PFNGLDISABLEVERTEXATTRIBARRAYPROC __glewDisableVertexAttribArray = _glewLazy_glDisableVertexAttribArray;
+PFNGLDRAWBUFFERSPROC __glewDrawBuffers = _glewLazy_glDrawBuffers;
+PFNGLENABLEVERTEXATTRIBARRAYPROC __glewEnableVertexAttribArray = _glewLazy_glEnableVertexAttribArray;
+PFNGLGETACTIVEATTRIBPROC __glewGetActiveAttrib = _glewLazy_glGetActiveAttrib;
+PFNGLGETACTIVEUNIFORMPROC __glewGetActiveUniform = _glewLazy_glGetActiveUniform;
+PFNGLGETATTACHEDSHADERSPROC __glewGetAttachedShaders = _glewLazy_glGetAttachedShaders;
+PFNGLGETATTRIBLOCATIONPROC __glewGetAttribLocation = _glewLazy_glGetAttribLocation;
+PFNGLGETPROGRAMINFOLOGPROC __glewGetProgramInfoLog = _glewLazy_glGetProgramInfoLog;
+PFNGLGETPROGRAMIVPROC __glewGetProgramiv = _glewLazy_glGetProgramiv;
+PFNGLGETSHADERINFOLOGPROC __glewGetShaderInfoLog = _glewLazy_glGetShaderInfoLog;
+PFNGLGETSHADERSOURCEPROC __glewGetShaderSource = _glewLazy_glGetShaderSource;
+PFNGLGETSHADERIVPROC __glewGetShaderiv = _glewLazy_glGetShaderiv;
+PFNGLGETUNIFORMLOCATIONPROC __glewGetUniformLocation = _glewLazy_glGetUniformLocation;
+PFNGLGETUNIFORMFVPROC __glewGetUniformfv = _glewLazy_glGetUniformfv;
+PFNGLGETUNIFORMIVPROC __glewGetUniformiv = _glewLazy_glGetUniformiv;
+PFNGLGETVERTEXATTRIBPOINTERVPROC __glewGetVertexAttribPointerv = _glewLazy_glGetVertexAttribPointerv;
+PFNGLGETVERTEXATTRIBDVPROC __glewGetVertexAttribdv = _glewLazy_glGetVertexAttribdv;
+PFNGLGETVERTEXATTRIBFVPROC __glewGetVertexAttribfv = _glewLazy_glGetVertexAttribfv;
+PFNGLGETVERTEXATTRIBIVPROC __glewGetVertexAttribiv = _glewLazy_glGetVertexAttribiv;
+PFNGLISPROGRAMPROC __glewIsProgram = _glewLazy_glIsProgram;
+PFNGLISSHADERPROC __glewIsShader = _glewLazy_glIsShader;
+PFNGLLINKPROGRAMPROC __glewLinkProgram = _glewLazy_glLinkProgram;
+PFNGLSHADERSOURCEPROC __glewShaderSource = _glewLazy_glShaderSource;
+PFNGLSTENCILFUNCSEPARATEPROC __glewStencilFuncSeparate = _glewLazy_glStencilFuncSeparate;
+PFNGLSTENCILMASKSEPARATEPROC __glewStencilMaskSeparate = _glewLazy_glStencilMaskSeparate;
+PFNGLSTENCILOPSEPARATEPROC __glewStencilOpSeparate = _glewLazy_glStencilOpSeparate;
+PFNGLUNIFORM1FPROC __glewUniform1f = _glewLazy_glUniform1f;
+PFNGLUNIFORM1FVPROC __glewUniform1fv = _glewLazy_glUniform1fv;
+PFNGLUNIFORM1IPROC __glewUniform1i = _glewLazy_glUniform1i;
+PFNGLUNIFORM1IVPROC __glewUniform1iv = _glewLazy_glUniform1iv;
+PFNGLUNIFORM2FPROC __glewUniform2f = _glewLazy_glUniform2f;
+PFNGLUNIFORM2FVPROC __glewUniform2fv = _glewLazy_glUniform2fv;
+PFNGLUNIFORM2IPROC __glewUniform2i = _glewLazy_glUniform2i;
+PFNGLUNIFORM2IVPROC __glewUniform2iv = _glewLazy_glUniform2iv;
+PFNGLUNIFORM3FPROC __glewUniform3f = _glewLazy_glUniform3f;
+PFNGLUNIFORM3FVPROC __glewUniform3fv = _glewLazy_glUniform3fv;
+PFNGLUNIFORM3IPROC __glewUniform3i = _glewLazy_glUniform3i;
+PFNGLUNIFORM3IVPROC __glewUniform3iv = _glewLazy_glUniform3iv;
+PFNGLUNIFORM4FPROC __glewUniform4f = _glewLazy_glUniform4f;
+PFNGLUNIFORM4FVPROC __glewUniform4fv = _glewLazy_glUniform4fv;
+PFNGLUNIFORM4IPROC __glewUniform4i = _glewLazy_glUniform4i;
+PFNGLUNIFORM4IVPROC __glewUniform4iv = _glewLazy_glUniform4iv;
+PFNGLUNIFORMMATRIX2FVPROC __glewUniformMatrix2fv = _glewLazy_glUniformMatrix2fv;
+PFNGLUNIFORMMATRIX3FVPROC __glewUniformMatrix3fv = _glewLazy_glUniformMatrix3fv;
+PFNGLUNIFORMMATRIX4FVPROC __glewUniformMatrix4fv = _glewLazy_glUniformMatrix4fv;
+PFNGLUSEPROGRAMPROC __glewUseProgram = _glewLazy_glUseProgram;
+PFNGLVALIDATEPROGRAMPROC __glewValidateProgram = _glewLazy_glValidateProgram;
+PFNGLVERTEXATTRIB1DPROC __glewVertexAttrib1d = _glewLazy_glVertexAttrib1d;
+PFNGLVERTEXATTRIB1DVPROC __glewVertexAttrib1dv = _glewLazy_glVertexAttrib1dv;
+PFNGLVERTEXATTRIB1FPROC __glewVertexAttrib1f = _glewLazy_glVertexAttrib1f;
+PFNGLVERTEXATTRIB1FVPROC __glewVertexAttrib1fv = _glewLazy_glVertexAttrib1fv;
+PFNGLVERTEXATTRIB1SPROC __glewVertexAttrib1s = _glewLazy_glVertexAttrib1s;
+PFNGLVERTEXATTRIB1SVPROC __glewVertexAttrib1sv = _glewLazy_glVertexAttrib1sv;
+PFNGLVERTEXATTRIB2DPROC __glewVertexAttrib2d = _glewLazy_glVertexAttrib2d;
+PFNGLVERTEXATTRIB2DVPROC __glewVertexAttrib2dv = _glewLazy_glVertexAttrib2dv;
+PFNGLVERTEXATTRIB2FPROC __glewVertexAttrib2f = _glewLazy_glVertexAttrib2f;
+PFNGLVERTEXATTRIB2FVPROC __glewVertexAttrib2fv = _glewLazy_glVertexAttrib2fv;
+PFNGLVERTEXATTRIB2SPROC __glewVertexAttrib2s = _glewLazy_glVertexAttrib2s;
+PFNGLVERTEXATTRIB2SVPROC __glewVertexAttrib2sv = _glewLazy_glVertexAttrib2sv;
+PFNGLVERTEXATTRIB3DPROC __glewVertexAttrib3d = _glewLazy_glVertexAttrib3d;
+PFNGLVERTEXATTRIB3DVPROC __glewVertexAttrib3dv = _glewLazy_glVertexAttrib3dv;
+PFNGLVERTEXATTRIB3FPROC __glewVertexAttrib3f = _glewLazy_glVertexAttrib3f;
+PFNGLVERTEXATTRIB3FVPROC __glewVertexAttrib3fv = _glewLazy_glVertexAttrib3fv;
+PFNGLVERTEXATTRIB3SPROC __glewVertexAttrib3s = _glewLazy_glVertexAttrib3s;
+PFNGLVERTEXATTRIB3SVPROC __glewVertexAttrib3sv = _glewLazy_glVertexAttrib3sv;
+PFNGLVERTEXATTRIB4NBVPROC __glewVertexAttrib4Nbv = _glewLazy_glVertexAttrib4Nbv;
+PFNGLVERTEXATTRIB4NIVPROC __glewVertexAttrib4Niv = _glewLazy_glVertexAttrib4Niv;
+PFNGLVERTEXATTRIB4NSVPROC __glewVertexAttrib4Nsv = _glewLazy_glVertexAttrib4Nsv;
+PFNGLVERTEXATTRIB4NUBPROC __glewVertexAttrib4Nub = _glewLazy_glVertexAttrib4Nub;
+PFNGLVERTEXATTRIB4NUBVPROC __glewVertexAttrib4Nubv = _glewLazy_glVertexAttrib4Nubv;
+PFNGLVERTEXATTRIB4NUIVPROC __glewVertexAttrib4Nuiv = _glewLazy_glVertexAttrib4Nuiv;
+PFNGLVERTEXATTRIB4NUSVPROC __glewVertexAttrib4Nusv = _glewLazy_glVertexAttrib4Nusv;
+PFNGLVERTEXATTRIB4BVPROC __glewVertexAttrib4bv = _glewLazy_glVertexAttrib4bv;
+PFNGLVERTEXATTRIB4DPROC __glewVertexAttrib4d = _glewLazy_glVertexAttrib4d;
+PFNGLVERTEXATTRIB4DVPROC __glewVertexAttrib4dv = _glewLazy_glVertexAttrib4dv;
+PFNGLVERTEXATTRIB4FPROC __glewVertexAttrib4f = _glewLazy_glVertexAttrib4f;
+PFNGLVERTEXATTRIB4FVPROC __glewVertexAttrib4fv = _glewLazy_glVertexAttrib4fv;
+PFNGLVERTEXATTRIB4IVPROC __glewVertexAttrib4iv = _glewLazy_glVertexAttrib4iv;
+PFNGLVERTEXATTRIB4SPROC __glewVertexAttrib4s = _glewLazy_glVertexAttrib4s;
+PFNGLVERTEXATTRIB4SVPROC __glewVertexAttrib4sv = _glewLazy_glVertexAttrib4sv;
+PFNGLVERTEXATTRIB4UBVPROC __glewVertexAttrib4ubv = _glewLazy_glVertexAttrib4ubv;
+PFNGLVERTEXATTRIB4UIVPROC __glewVertexAttrib4uiv = _glewLazy_glVertexAttrib4uiv;
+PFNGLVERTEXATTRIB4USVPROC __glewVertexAttrib4usv = _glewLazy_glVertexAttrib4usv;
+PFNGLVERTEXATTRIBPOINTERPROC __glewVertexAttribPointer = _glewLazy_glVertexAttribPointer;
+
+PFNGLUNIFORMMATRIX2X3FVPROC __glewUniformMatrix2x3fv = _glewLazy_glUniformMatrix2x3fv;
+PFNGLUNIFORMMATRIX2X4FVPROC __glewUniformMatrix2x4fv = _glewLazy_glUniformMatrix2x4fv;
+PFNGLUNIFORMMATRIX3X2FVPROC __glewUniformMatrix3x2fv = _glewLazy_glUniformMatrix3x2fv;
+PFNGLUNIFORMMATRIX3X4FVPROC __glewUniformMatrix3x4fv = _glewLazy_glUniformMatrix3x4fv;
+PFNGLUNIFORMMATRIX4X2FVPROC __glewUniformMatrix4x2fv = _glewLazy_glUniformMatrix4x2fv;
+PFNGLUNIFORMMATRIX4X3FVPROC __glewUniformMatrix4x3fv = _glewLazy_glUniformMatrix4x3fv;
+
+PFNGLBEGINCONDITIONALRENDERPROC __glewBeginConditionalRender = _glewLazy_glBeginConditionalRender;
+PFNGLBEGINTRANSFORMFEEDBACKPROC __glewBeginTransformFeedback = _glewLazy_glBeginTransformFeedback;
+PFNGLBINDFRAGDATALOCATIONPROC __glewBindFragDataLocation = _glewLazy_glBindFragDataLocation;
+PFNGLCLAMPCOLORPROC __glewClampColor = _glewLazy_glClampColor;
+PFNGLCLEARBUFFERFIPROC __glewClearBufferfi = _glewLazy_glClearBufferfi;
+PFNGLCLEARBUFFERFVPROC __glewClearBufferfv = _glewLazy_glClearBufferfv;
+PFNGLCLEARBUFFERIVPROC __glewClearBufferiv = _glewLazy_glClearBufferiv;
+PFNGLCLEARBUFFERUIVPROC __glewClearBufferuiv = _glewLazy_glClearBufferuiv;
+PFNGLCOLORMASKIPROC __glewColorMaski = _glewLazy_glColorMaski;
+PFNGLDISABLEIPROC __glewDisablei = _glewLazy_glDisablei;
+PFNGLENABLEIPROC __glewEnablei = _glewLazy_glEnablei;
+PFNGLENDCONDITIONALRENDERPROC __glewEndConditionalRender = _glewLazy_glEndConditionalRender;
+PFNGLENDTRANSFORMFEEDBACKPROC __glewEndTransformFeedback = _glewLazy_glEndTransformFeedback;
+PFNGLGETBOOLEANI_VPROC __glewGetBooleani_v = _glewLazy_glGetBooleani_v;
+PFNGLGETFRAGDATALOCATIONPROC __glewGetFragDataLocation = _glewLazy_glGetFragDataLocation;
+PFNGLGETSTRINGIPROC __glewGetStringi = _glewLazy_glGetStringi;
+PFNGLGETTEXPARAMETERIIVPROC __glewGetTexParameterIiv = _glewLazy_glGetTexParameterIiv;
+PFNGLGETTEXPARAMETERIUIVPROC __glewGetTexParameterIuiv = _glewLazy_glGetTexParameterIuiv;
+PFNGLGETTRANSFORMFEEDBACKVARYINGPROC __glewGetTransformFeedbackVarying = _glewLazy_glGetTransformFeedbackVarying;
+PFNGLGETUNIFORMUIVPROC __glewGetUniformuiv = _glewLazy_glGetUniformuiv;
+PFNGLGETVERTEXATTRIBIIVPROC __glewGetVertexAttribIiv = _glewLazy_glGetVertexAttribIiv;
+PFNGLGETVERTEXATTRIBIUIVPROC __glewGetVertexAttribIuiv = _glewLazy_glGetVertexAttribIuiv;
+PFNGLISENABLEDIPROC __glewIsEnabledi = _glewLazy_glIsEnabledi;
+PFNGLTEXPARAMETERIIVPROC __glewTexParameterIiv = _glewLazy_glTexParameterIiv;
+PFNGLTEXPARAMETERIUIVPROC __glewTexParameterIuiv = _glewLazy_glTexParameterIuiv;
+PFNGLTRANSFORMFEEDBACKVARYINGSPROC __glewTransformFeedbackVaryings = _glewLazy_glTransformFeedbackVaryings;
+PFNGLUNIFORM1UIPROC __glewUniform1ui = _glewLazy_glUniform1ui;
+PFNGLUNIFORM1UIVPROC __glewUniform1uiv = _glewLazy_glUniform1uiv;
+PFNGLUNIFORM2UIPROC __glewUniform2ui = _glewLazy_glUniform2ui;
+PFNGLUNIFORM2UIVPROC __glewUniform2uiv = _glewLazy_glUniform2uiv;
+PFNGLUNIFORM3UIPROC __glewUniform3ui = _glewLazy_glUniform3ui;
+PFNGLUNIFORM3UIVPROC __glewUniform3uiv = _glewLazy_glUniform3uiv;
+PFNGLUNIFORM4UIPROC __glewUniform4ui = _glewLazy_glUniform4ui;
+PFNGLUNIFORM4UIVPROC __glewUniform4uiv = _glewLazy_glUniform4uiv;
+PFNGLVERTEXATTRIBI1IPROC __glewVertexAttribI1i = _glewLazy_glVertexAttribI1i;
+PFNGLVERTEXATTRIBI1IVPROC __glewVertexAttribI1iv = _glewLazy_glVertexAttribI1iv;
+PFNGLVERTEXATTRIBI1UIPROC __glewVertexAttribI1ui = _glewLazy_glVertexAttribI1ui;
+PFNGLVERTEXATTRIBI1UIVPROC __glewVertexAttribI1uiv = _glewLazy_glVertexAttribI1uiv;
+PFNGLVERTEXATTRIBI2IPROC __glewVertexAttribI2i = _glewLazy_glVertexAttribI2i;
+PFNGLVERTEXATTRIBI2IVPROC __glewVertexAttribI2iv = _glewLazy_glVertexAttribI2iv;
+PFNGLVERTEXATTRIBI2UIPROC __glewVertexAttribI2ui = _glewLazy_glVertexAttribI2ui;
+PFNGLVERTEXATTRIBI2UIVPROC __glewVertexAttribI2uiv = _glewLazy_glVertexAttribI2uiv;
+PFNGLVERTEXATTRIBI3IPROC __glewVertexAttribI3i = _glewLazy_glVertexAttribI3i;
+PFNGLVERTEXATTRIBI3IVPROC __glewVertexAttribI3iv = _glewLazy_glVertexAttribI3iv;
+PFNGLVERTEXATTRIBI3UIPROC __glewVertexAttribI3ui = _glewLazy_glVertexAttribI3ui;
+PFNGLVERTEXATTRIBI3UIVPROC __glewVertexAttribI3uiv = _glewLazy_glVertexAttribI3uiv;
+PFNGLVERTEXATTRIBI4BVPROC __glewVertexAttribI4bv = _glewLazy_glVertexAttribI4bv;
+PFNGLVERTEXATTRIBI4IPROC __glewVertexAttribI4i = _glewLazy_glVertexAttribI4i;
+PFNGLVERTEXATTRIBI4IVPROC __glewVertexAttribI4iv = _glewLazy_glVertexAttribI4iv;
+PFNGLVERTEXATTRIBI4SVPROC __glewVertexAttribI4sv = _glewLazy_glVertexAttribI4sv;
+PFNGLVERTEXATTRIBI4UBVPROC __glewVertexAttribI4ubv = _glewLazy_glVertexAttribI4ubv;
+PFNGLVERTEXATTRIBI4UIPROC __glewVertexAttribI4ui = _glewLazy_glVertexAttribI4ui;
+PFNGLVERTEXATTRIBI4UIVPROC __glewVertexAttribI4uiv = _glewLazy_glVertexAttribI4uiv;
+PFNGLVERTEXATTRIBI4USVPROC __glewVertexAttribI4usv = _glewLazy_glVertexAttribI4usv;
+PFNGLVERTEXATTRIBIPOINTERPROC __glewVertexAttribIPointer = _glewLazy_glVertexAttribIPointer;
+
+PFNGLDRAWARRAYSINSTANCEDPROC __glewDrawArraysInstanced = _glewLazy_glDrawArraysInstanced;
+PFNGLDRAWELEMENTSINSTANCEDPROC __glewDrawElementsInstanced = _glewLazy_glDrawElementsInstanced;
+PFNGLPRIMITIVERESTARTINDEXPROC __glewPrimitiveRestartIndex = _glewLazy_glPrimitiveRestartIndex;
+PFNGLTEXBUFFERPROC __glewTexBuffer = _glewLazy_glTexBuffer;
+
+PFNGLFRAMEBUFFERTEXTUREPROC __glewFramebufferTexture = _glewLazy_glFramebufferTexture;
+PFNGLGETBUFFERPARAMETERI64VPROC __glewGetBufferParameteri64v = _glewLazy_glGetBufferParameteri64v;
+PFNGLGETINTEGER64I_VPROC __glewGetInteger64i_v = _glewLazy_glGetInteger64i_v;
+
+PFNGLVERTEXATTRIBDIVISORPROC __glewVertexAttribDivisor = _glewLazy_glVertexAttribDivisor;
+
+PFNGLBLENDEQUATIONSEPARATEIPROC __glewBlendEquationSeparatei = _glewLazy_glBlendEquationSeparatei;
+PFNGLBLENDEQUATIONIPROC __glewBlendEquationi = _glewLazy_glBlendEquationi;
+PFNGLBLENDFUNCSEPARATEIPROC __glewBlendFuncSeparatei = _glewLazy_glBlendFuncSeparatei;
+PFNGLBLENDFUNCIPROC __glewBlendFunci = _glewLazy_glBlendFunci;
+PFNGLMINSAMPLESHADINGPROC __glewMinSampleShading = _glewLazy_glMinSampleShading;
+
+PFNGLGETGRAPHICSRESETSTATUSPROC __glewGetGraphicsResetStatus = _glewLazy_glGetGraphicsResetStatus;
+
+static void GLAPIENTRY _glewLazy_glTbufferMask3DFX (GLuint mask)
+{
+  glTbufferMask3DFX = (PFNGLTBUFFERMASK3DFXPROC)glewGetProcAddress((const GLubyte*)"glTbufferMask3DFX");
+  glTbufferMask3DFX(mask);
+}
+
+
+static void GLAPIENTRY _glewLazy_glDebugMessageCallbackAMD (GLDEBUGPROCAMD callback, void *userParam)
+{
+  glDebugMessageCallbackAMD = (PFNGLDEBUGMESSAGECALLBACKAMDPROC)glewGetProcAddress((const GLubyte*)"glDebugMessageCallbackAMD");
+  glDebugMessageCallbackAMD(callback, userParam);
+}
+
+static void GLAPIENTRY _glewLazy_glDebugMessageEnableAMD (GLenum category, GLenum severity, GLsizei count, const GLuint* ids, GLboolean enabled)
+{
+  glDebugMessageEnableAMD = (PFNGLDEBUGMESSAGEENABLEAMDPROC)glewGetProcAddress((const GLubyte*)"glDebugMessageEnableAMD");
+  glDebugMessageEnableAMD(category, severity, count, ids, enabled);
+}
+
+static void GLAPIENTRY _glewLazy_glDebugMessageInsertAMD (GLenum category, GLenum severity, GLuint id, GLsizei length, const GLchar* buf)
+{
+  glDebugMessageInsertAMD = (PFNGLDEBUGMESSAGEINSERTAMDPROC)glewGetProcAddress((const GLubyte*)"glDebugMessageInsertAMD");
+  glDebugMessageInsertAMD(category, severity, id, length, buf);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glGetDebugMessageLogAMD (GLuint count, GLsizei bufsize, GLenum* categories, GLuint* severities, GLuint* ids, GLsizei* lengths, GLchar* message)
+{
+  glGetDebugMessageLogAMD = (PFNGLGETDEBUGMESSAGELOGAMDPROC)glewGetProcAddress((const GLubyte*)"glGetDebugMessageLogAMD");
+  return glGetDebugMessageLogAMD(count, bufsize, categories, severities, ids, lengths, message);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBlendEquationIndexedAMD (GLuint buf, GLenum mode)
+{
+  glBlendEquationIndexedAMD = (PFNGLBLENDEQUATIONINDEXEDAMDPROC)glewGetProcAddress((const GLubyte*)"glBlendEquationIndexedAMD");
+  glBlendEquationIndexedAMD(buf, mode);
+}
+
+static void GLAPIENTRY _glewLazy_glBlendEquationSeparateIndexedAMD (GLuint buf, GLenum modeRGB, GLenum modeAlpha)
+{
+  glBlendEquationSeparateIndexedAMD = (PFNGLBLENDEQUATIONSEPARATEINDEXEDAMDPROC)glewGetProcAddress((const GLubyte*)"glBlendEquationSeparateIndexedAMD");
+  glBlendEquationSeparateIndexedAMD(buf, modeRGB, modeAlpha);
+}
+
+static void GLAPIENTRY _glewLazy_glBlendFuncIndexedAMD (GLuint buf, GLenum src, GLenum dst)
+{
+  glBlendFuncIndexedAMD = (PFNGLBLENDFUNCINDEXEDAMDPROC)glewGetProcAddress((const GLubyte*)"glBlendFuncIndexedAMD");
+  glBlendFuncIndexedAMD(buf, src, dst);
+}
+
+static void GLAPIENTRY _glewLazy_glBlendFuncSeparateIndexedAMD (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+  glBlendFuncSeparateIndexedAMD = (PFNGLBLENDFUNCSEPARATEINDEXEDAMDPROC)glewGetProcAddress((const GLubyte*)"glBlendFuncSeparateIndexedAMD");
+  glBlendFuncSeparateIndexedAMD(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+
+
+static void GLAPIENTRY _glewLazy_glVertexAttribParameteriAMD (GLuint index, GLenum pname, GLint param)
+{
+  glVertexAttribParameteriAMD = (PFNGLVERTEXATTRIBPARAMETERIAMDPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribParameteriAMD");
+  glVertexAttribParameteriAMD(index, pname, param);
+}
+
+
+static void GLAPIENTRY _glewLazy_glMultiDrawArraysIndirectAMD (GLenum mode, const void *indirect, GLsizei primcount, GLsizei stride)
+{
+  glMultiDrawArraysIndirectAMD = (PFNGLMULTIDRAWARRAYSINDIRECTAMDPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawArraysIndirectAMD");
+  glMultiDrawArraysIndirectAMD(mode, indirect, primcount, stride);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiDrawElementsIndirectAMD (GLenum mode, GLenum type, const void *indirect, GLsizei primcount, GLsizei stride)
+{
+  glMultiDrawElementsIndirectAMD = (PFNGLMULTIDRAWELEMENTSINDIRECTAMDPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawElementsIndirectAMD");
+  glMultiDrawElementsIndirectAMD(mode, type, indirect, primcount, stride);
+}
+
+
+static void GLAPIENTRY _glewLazy_glDeleteNamesAMD (GLenum identifier, GLuint num, const GLuint* names)
+{
+  glDeleteNamesAMD = (PFNGLDELETENAMESAMDPROC)glewGetProcAddress((const GLubyte*)"glDeleteNamesAMD");
+  glDeleteNamesAMD(identifier, num, names);
+}
+
+static void GLAPIENTRY _glewLazy_glGenNamesAMD (GLenum identifier, GLuint num, GLuint* names)
+{
+  glGenNamesAMD = (PFNGLGENNAMESAMDPROC)glewGetProcAddress((const GLubyte*)"glGenNamesAMD");
+  glGenNamesAMD(identifier, num, names);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsNameAMD (GLenum identifier, GLuint name)
+{
+  glIsNameAMD = (PFNGLISNAMEAMDPROC)glewGetProcAddress((const GLubyte*)"glIsNameAMD");
+  return glIsNameAMD(identifier, name);
+}
+
+
+static void GLAPIENTRY _glewLazy_glQueryObjectParameteruiAMD (GLenum target, GLuint id, GLenum pname, GLuint param)
+{
+  glQueryObjectParameteruiAMD = (PFNGLQUERYOBJECTPARAMETERUIAMDPROC)glewGetProcAddress((const GLubyte*)"glQueryObjectParameteruiAMD");
+  glQueryObjectParameteruiAMD(target, id, pname, param);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBeginPerfMonitorAMD (GLuint monitor)
+{
+  glBeginPerfMonitorAMD = (PFNGLBEGINPERFMONITORAMDPROC)glewGetProcAddress((const GLubyte*)"glBeginPerfMonitorAMD");
+  glBeginPerfMonitorAMD(monitor);
+}
+
+static void GLAPIENTRY _glewLazy_glDeletePerfMonitorsAMD (GLsizei n, GLuint* monitors)
+{
+  glDeletePerfMonitorsAMD = (PFNGLDELETEPERFMONITORSAMDPROC)glewGetProcAddress((const GLubyte*)"glDeletePerfMonitorsAMD");
+  glDeletePerfMonitorsAMD(n, monitors);
+}
+
+static void GLAPIENTRY _glewLazy_glEndPerfMonitorAMD (GLuint monitor)
+{
+  glEndPerfMonitorAMD = (PFNGLENDPERFMONITORAMDPROC)glewGetProcAddress((const GLubyte*)"glEndPerfMonitorAMD");
+  glEndPerfMonitorAMD(monitor);
+}
+
+static void GLAPIENTRY _glewLazy_glGenPerfMonitorsAMD (GLsizei n, GLuint* monitors)
+{
+  glGenPerfMonitorsAMD = (PFNGLGENPERFMONITORSAMDPROC)glewGetProcAddress((const GLubyte*)"glGenPerfMonitorsAMD");
+  glGenPerfMonitorsAMD(n, monitors);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPerfMonitorCounterDataAMD (GLuint monitor, GLenum pname, GLsizei dataSize, GLuint* data, GLint *bytesWritten)
+{
+  glGetPerfMonitorCounterDataAMD = (PFNGLGETPERFMONITORCOUNTERDATAAMDPROC)glewGetProcAddress((const GLubyte*)"glGetPerfMonitorCounterDataAMD");
+  glGetPerfMonitorCounterDataAMD(monitor, pname, dataSize, data, bytesWritten);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPerfMonitorCounterInfoAMD (GLuint group, GLuint counter, GLenum pname, void *data)
+{
+  glGetPerfMonitorCounterInfoAMD = (PFNGLGETPERFMONITORCOUNTERINFOAMDPROC)glewGetProcAddress((const GLubyte*)"glGetPerfMonitorCounterInfoAMD");
+  glGetPerfMonitorCounterInfoAMD(group, counter, pname, data);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPerfMonitorCounterStringAMD (GLuint group, GLuint counter, GLsizei bufSize, GLsizei* length, GLchar *counterString)
+{
+  glGetPerfMonitorCounterStringAMD = (PFNGLGETPERFMONITORCOUNTERSTRINGAMDPROC)glewGetProcAddress((const GLubyte*)"glGetPerfMonitorCounterStringAMD");
+  glGetPerfMonitorCounterStringAMD(group, counter, bufSize, length, counterString);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPerfMonitorCountersAMD (GLuint group, GLint* numCounters, GLint *maxActiveCounters, GLsizei countersSize, GLuint *counters)
+{
+  glGetPerfMonitorCountersAMD = (PFNGLGETPERFMONITORCOUNTERSAMDPROC)glewGetProcAddress((const GLubyte*)"glGetPerfMonitorCountersAMD");
+  glGetPerfMonitorCountersAMD(group, numCounters, maxActiveCounters, countersSize, counters);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPerfMonitorGroupStringAMD (GLuint group, GLsizei bufSize, GLsizei* length, GLchar *groupString)
+{
+  glGetPerfMonitorGroupStringAMD = (PFNGLGETPERFMONITORGROUPSTRINGAMDPROC)glewGetProcAddress((const GLubyte*)"glGetPerfMonitorGroupStringAMD");
+  glGetPerfMonitorGroupStringAMD(group, bufSize, length, groupString);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPerfMonitorGroupsAMD (GLint* numGroups, GLsizei groupsSize, GLuint *groups)
+{
+  glGetPerfMonitorGroupsAMD = (PFNGLGETPERFMONITORGROUPSAMDPROC)glewGetProcAddress((const GLubyte*)"glGetPerfMonitorGroupsAMD");
+  glGetPerfMonitorGroupsAMD(numGroups, groupsSize, groups);
+}
+
+static void GLAPIENTRY _glewLazy_glSelectPerfMonitorCountersAMD (GLuint monitor, GLboolean enable, GLuint group, GLint numCounters, GLuint* counterList)
+{
+  glSelectPerfMonitorCountersAMD = (PFNGLSELECTPERFMONITORCOUNTERSAMDPROC)glewGetProcAddress((const GLubyte*)"glSelectPerfMonitorCountersAMD");
+  glSelectPerfMonitorCountersAMD(monitor, enable, group, numCounters, counterList);
+}
+
+
+static void GLAPIENTRY _glewLazy_glSetMultisamplefvAMD (GLenum pname, GLuint index, const GLfloat* val)
+{
+  glSetMultisamplefvAMD = (PFNGLSETMULTISAMPLEFVAMDPROC)glewGetProcAddress((const GLubyte*)"glSetMultisamplefvAMD");
+  glSetMultisamplefvAMD(pname, index, val);
+}
+
+
+static void GLAPIENTRY _glewLazy_glTexStorageSparseAMD (GLenum target, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLsizei layers, GLbitfield flags)
+{
+  glTexStorageSparseAMD = (PFNGLTEXSTORAGESPARSEAMDPROC)glewGetProcAddress((const GLubyte*)"glTexStorageSparseAMD");
+  glTexStorageSparseAMD(target, internalFormat, width, height, depth, layers, flags);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureStorageSparseAMD (GLuint texture, GLenum target, GLenum internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLsizei layers, GLbitfield flags)
+{
+  glTextureStorageSparseAMD = (PFNGLTEXTURESTORAGESPARSEAMDPROC)glewGetProcAddress((const GLubyte*)"glTextureStorageSparseAMD");
+  glTextureStorageSparseAMD(texture, target, internalFormat, width, height, depth, layers, flags);
+}
+
+
+static void GLAPIENTRY _glewLazy_glStencilOpValueAMD (GLenum face, GLuint value)
+{
+  glStencilOpValueAMD = (PFNGLSTENCILOPVALUEAMDPROC)glewGetProcAddress((const GLubyte*)"glStencilOpValueAMD");
+  glStencilOpValueAMD(face, value);
+}
+
+
+static void GLAPIENTRY _glewLazy_glTessellationFactorAMD (GLfloat factor)
+{
+  glTessellationFactorAMD = (PFNGLTESSELLATIONFACTORAMDPROC)glewGetProcAddress((const GLubyte*)"glTessellationFactorAMD");
+  glTessellationFactorAMD(factor);
+}
+
+static void GLAPIENTRY _glewLazy_glTessellationModeAMD (GLenum mode)
+{
+  glTessellationModeAMD = (PFNGLTESSELLATIONMODEAMDPROC)glewGetProcAddress((const GLubyte*)"glTessellationModeAMD");
+  glTessellationModeAMD(mode);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBlitFramebufferANGLE (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+  glBlitFramebufferANGLE = (PFNGLBLITFRAMEBUFFERANGLEPROC)glewGetProcAddress((const GLubyte*)"glBlitFramebufferANGLE");
+  glBlitFramebufferANGLE(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+
+
+static void GLAPIENTRY _glewLazy_glRenderbufferStorageMultisampleANGLE (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+  glRenderbufferStorageMultisampleANGLE = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEANGLEPROC)glewGetProcAddress((const GLubyte*)"glRenderbufferStorageMultisampleANGLE");
+  glRenderbufferStorageMultisampleANGLE(target, samples, internalformat, width, height);
+}
+
+
+static void GLAPIENTRY _glewLazy_glDrawArraysInstancedANGLE (GLenum mode, GLint first, GLsizei count, GLsizei primcount)
+{
+  glDrawArraysInstancedANGLE = (PFNGLDRAWARRAYSINSTANCEDANGLEPROC)glewGetProcAddress((const GLubyte*)"glDrawArraysInstancedANGLE");
+  glDrawArraysInstancedANGLE(mode, first, count, primcount);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawElementsInstancedANGLE (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei primcount)
+{
+  glDrawElementsInstancedANGLE = (PFNGLDRAWELEMENTSINSTANCEDANGLEPROC)glewGetProcAddress((const GLubyte*)"glDrawElementsInstancedANGLE");
+  glDrawElementsInstancedANGLE(mode, count, type, indices, primcount);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribDivisorANGLE (GLuint index, GLuint divisor)
+{
+  glVertexAttribDivisorANGLE = (PFNGLVERTEXATTRIBDIVISORANGLEPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribDivisorANGLE");
+  glVertexAttribDivisorANGLE(index, divisor);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBeginQueryANGLE (GLenum target, GLuint id)
+{
+  glBeginQueryANGLE = (PFNGLBEGINQUERYANGLEPROC)glewGetProcAddress((const GLubyte*)"glBeginQueryANGLE");
+  glBeginQueryANGLE(target, id);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteQueriesANGLE (GLsizei n, const GLuint* ids)
+{
+  glDeleteQueriesANGLE = (PFNGLDELETEQUERIESANGLEPROC)glewGetProcAddress((const GLubyte*)"glDeleteQueriesANGLE");
+  glDeleteQueriesANGLE(n, ids);
+}
+
+static void GLAPIENTRY _glewLazy_glEndQueryANGLE (GLenum target)
+{
+  glEndQueryANGLE = (PFNGLENDQUERYANGLEPROC)glewGetProcAddress((const GLubyte*)"glEndQueryANGLE");
+  glEndQueryANGLE(target);
+}
+
+static void GLAPIENTRY _glewLazy_glGenQueriesANGLE (GLsizei n, GLuint* ids)
+{
+  glGenQueriesANGLE = (PFNGLGENQUERIESANGLEPROC)glewGetProcAddress((const GLubyte*)"glGenQueriesANGLE");
+  glGenQueriesANGLE(n, ids);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryObjecti64vANGLE (GLuint id, GLenum pname, GLint64* params)
+{
+  glGetQueryObjecti64vANGLE = (PFNGLGETQUERYOBJECTI64VANGLEPROC)glewGetProcAddress((const GLubyte*)"glGetQueryObjecti64vANGLE");
+  glGetQueryObjecti64vANGLE(id, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryObjectivANGLE (GLuint id, GLenum pname, GLint* params)
+{
+  glGetQueryObjectivANGLE = (PFNGLGETQUERYOBJECTIVANGLEPROC)glewGetProcAddress((const GLubyte*)"glGetQueryObjectivANGLE");
+  glGetQueryObjectivANGLE(id, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryObjectui64vANGLE (GLuint id, GLenum pname, GLuint64* params)
+{
+  glGetQueryObjectui64vANGLE = (PFNGLGETQUERYOBJECTUI64VANGLEPROC)glewGetProcAddress((const GLubyte*)"glGetQueryObjectui64vANGLE");
+  glGetQueryObjectui64vANGLE(id, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryObjectuivANGLE (GLuint id, GLenum pname, GLuint* params)
+{
+  glGetQueryObjectuivANGLE = (PFNGLGETQUERYOBJECTUIVANGLEPROC)glewGetProcAddress((const GLubyte*)"glGetQueryObjectuivANGLE");
+  glGetQueryObjectuivANGLE(id, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryivANGLE (GLenum target, GLenum pname, GLint* params)
+{
+  glGetQueryivANGLE = (PFNGLGETQUERYIVANGLEPROC)glewGetProcAddress((const GLubyte*)"glGetQueryivANGLE");
+  glGetQueryivANGLE(target, pname, params);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsQueryANGLE (GLuint id)
+{
+  glIsQueryANGLE = (PFNGLISQUERYANGLEPROC)glewGetProcAddress((const GLubyte*)"glIsQueryANGLE");
+  return glIsQueryANGLE(id);
+}
+
+static void GLAPIENTRY _glewLazy_glQueryCounterANGLE (GLuint id, GLenum target)
+{
+  glQueryCounterANGLE = (PFNGLQUERYCOUNTERANGLEPROC)glewGetProcAddress((const GLubyte*)"glQueryCounterANGLE");
+  glQueryCounterANGLE(id, target);
+}
+
+
+static void GLAPIENTRY _glewLazy_glGetTranslatedShaderSourceANGLE (GLuint shader, GLsizei bufsize, GLsizei* length, GLchar* source)
+{
+  glGetTranslatedShaderSourceANGLE = (PFNGLGETTRANSLATEDSHADERSOURCEANGLEPROC)glewGetProcAddress((const GLubyte*)"glGetTranslatedShaderSourceANGLE");
+  glGetTranslatedShaderSourceANGLE(shader, bufsize, length, source);
+}
+
+
+static void GLAPIENTRY _glewLazy_glDrawElementArrayAPPLE (GLenum mode, GLint first, GLsizei count)
+{
+  glDrawElementArrayAPPLE = (PFNGLDRAWELEMENTARRAYAPPLEPROC)glewGetProcAddress((const GLubyte*)"glDrawElementArrayAPPLE");
+  glDrawElementArrayAPPLE(mode, first, count);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawRangeElementArrayAPPLE (GLenum mode, GLuint start, GLuint end, GLint first, GLsizei count)
+{
+  glDrawRangeElementArrayAPPLE = (PFNGLDRAWRANGEELEMENTARRAYAPPLEPROC)glewGetProcAddress((const GLubyte*)"glDrawRangeElementArrayAPPLE");
+  glDrawRangeElementArrayAPPLE(mode, start, end, first, count);
+}
+
+static void GLAPIENTRY _glewLazy_glElementPointerAPPLE (GLenum type, const void *pointer)
+{
+  glElementPointerAPPLE = (PFNGLELEMENTPOINTERAPPLEPROC)glewGetProcAddress((const GLubyte*)"glElementPointerAPPLE");
+  glElementPointerAPPLE(type, pointer);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiDrawElementArrayAPPLE (GLenum mode, const GLint* first, const GLsizei *count, GLsizei primcount)
+{
+  glMultiDrawElementArrayAPPLE = (PFNGLMULTIDRAWELEMENTARRAYAPPLEPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawElementArrayAPPLE");
+  glMultiDrawElementArrayAPPLE(mode, first, count, primcount);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiDrawRangeElementArrayAPPLE (GLenum mode, GLuint start, GLuint end, const GLint* first, const GLsizei *count, GLsizei primcount)
+{
+  glMultiDrawRangeElementArrayAPPLE = (PFNGLMULTIDRAWRANGEELEMENTARRAYAPPLEPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawRangeElementArrayAPPLE");
+  glMultiDrawRangeElementArrayAPPLE(mode, start, end, first, count, primcount);
+}
+
+
+static void GLAPIENTRY _glewLazy_glDeleteFencesAPPLE (GLsizei n, const GLuint* fences)
+{
+  glDeleteFencesAPPLE = (PFNGLDELETEFENCESAPPLEPROC)glewGetProcAddress((const GLubyte*)"glDeleteFencesAPPLE");
+  glDeleteFencesAPPLE(n, fences);
+}
+
+static void GLAPIENTRY _glewLazy_glFinishFenceAPPLE (GLuint fence)
+{
+  glFinishFenceAPPLE = (PFNGLFINISHFENCEAPPLEPROC)glewGetProcAddress((const GLubyte*)"glFinishFenceAPPLE");
+  glFinishFenceAPPLE(fence);
+}
+
+static void GLAPIENTRY _glewLazy_glFinishObjectAPPLE (GLenum object, GLint name)
+{
+  glFinishObjectAPPLE = (PFNGLFINISHOBJECTAPPLEPROC)glewGetProcAddress((const GLubyte*)"glFinishObjectAPPLE");
+  glFinishObjectAPPLE(object, name);
+}
+
+static void GLAPIENTRY _glewLazy_glGenFencesAPPLE (GLsizei n, GLuint* fences)
+{
+  glGenFencesAPPLE = (PFNGLGENFENCESAPPLEPROC)glewGetProcAddress((const GLubyte*)"glGenFencesAPPLE");
+  glGenFencesAPPLE(n, fences);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsFenceAPPLE (GLuint fence)
+{
+  glIsFenceAPPLE = (PFNGLISFENCEAPPLEPROC)glewGetProcAddress((const GLubyte*)"glIsFenceAPPLE");
+  return glIsFenceAPPLE(fence);
+}
+
+static void GLAPIENTRY _glewLazy_glSetFenceAPPLE (GLuint fence)
+{
+  glSetFenceAPPLE = (PFNGLSETFENCEAPPLEPROC)glewGetProcAddress((const GLubyte*)"glSetFenceAPPLE");
+  glSetFenceAPPLE(fence);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glTestFenceAPPLE (GLuint fence)
+{
+  glTestFenceAPPLE = (PFNGLTESTFENCEAPPLEPROC)glewGetProcAddress((const GLubyte*)"glTestFenceAPPLE");
+  return glTestFenceAPPLE(fence);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glTestObjectAPPLE (GLenum object, GLuint name)
+{
+  glTestObjectAPPLE = (PFNGLTESTOBJECTAPPLEPROC)glewGetProcAddress((const GLubyte*)"glTestObjectAPPLE");
+  return glTestObjectAPPLE(object, name);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBufferParameteriAPPLE (GLenum target, GLenum pname, GLint param)
+{
+  glBufferParameteriAPPLE = (PFNGLBUFFERPARAMETERIAPPLEPROC)glewGetProcAddress((const GLubyte*)"glBufferParameteriAPPLE");
+  glBufferParameteriAPPLE(target, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glFlushMappedBufferRangeAPPLE (GLenum target, GLintptr offset, GLsizeiptr size)
+{
+  glFlushMappedBufferRangeAPPLE = (PFNGLFLUSHMAPPEDBUFFERRANGEAPPLEPROC)glewGetProcAddress((const GLubyte*)"glFlushMappedBufferRangeAPPLE");
+  glFlushMappedBufferRangeAPPLE(target, offset, size);
+}
+
+
+static void GLAPIENTRY _glewLazy_glGetObjectParameterivAPPLE (GLenum objectType, GLuint name, GLenum pname, GLint* params)
+{
+  glGetObjectParameterivAPPLE = (PFNGLGETOBJECTPARAMETERIVAPPLEPROC)glewGetProcAddress((const GLubyte*)"glGetObjectParameterivAPPLE");
+  glGetObjectParameterivAPPLE(objectType, name, pname, params);
+}
+
+static GLenum GLAPIENTRY _glewLazy_glObjectPurgeableAPPLE (GLenum objectType, GLuint name, GLenum option)
+{
+  glObjectPurgeableAPPLE = (PFNGLOBJECTPURGEABLEAPPLEPROC)glewGetProcAddress((const GLubyte*)"glObjectPurgeableAPPLE");
+  return glObjectPurgeableAPPLE(objectType, name, option);
+}
+
+static GLenum GLAPIENTRY _glewLazy_glObjectUnpurgeableAPPLE (GLenum objectType, GLuint name, GLenum option)
+{
+  glObjectUnpurgeableAPPLE = (PFNGLOBJECTUNPURGEABLEAPPLEPROC)glewGetProcAddress((const GLubyte*)"glObjectUnpurgeableAPPLE");
+  return glObjectUnpurgeableAPPLE(objectType, name, option);
+}
+
+
+static void GLAPIENTRY _glewLazy_glGetTexParameterPointervAPPLE (GLenum target, GLenum pname, void **params)
+{
+  glGetTexParameterPointervAPPLE = (PFNGLGETTEXPARAMETERPOINTERVAPPLEPROC)glewGetProcAddress((const GLubyte*)"glGetTexParameterPointervAPPLE");
+  glGetTexParameterPointervAPPLE(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureRangeAPPLE (GLenum target, GLsizei length, void *pointer)
+{
+  glTextureRangeAPPLE = (PFNGLTEXTURERANGEAPPLEPROC)glewGetProcAddress((const GLubyte*)"glTextureRangeAPPLE");
+  glTextureRangeAPPLE(target, length, pointer);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBindVertexArrayAPPLE (GLuint array)
+{
+  glBindVertexArrayAPPLE = (PFNGLBINDVERTEXARRAYAPPLEPROC)glewGetProcAddress((const GLubyte*)"glBindVertexArrayAPPLE");
+  glBindVertexArrayAPPLE(array);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteVertexArraysAPPLE (GLsizei n, const GLuint* arrays)
+{
+  glDeleteVertexArraysAPPLE = (PFNGLDELETEVERTEXARRAYSAPPLEPROC)glewGetProcAddress((const GLubyte*)"glDeleteVertexArraysAPPLE");
+  glDeleteVertexArraysAPPLE(n, arrays);
+}
+
+static void GLAPIENTRY _glewLazy_glGenVertexArraysAPPLE (GLsizei n, const GLuint* arrays)
+{
+  glGenVertexArraysAPPLE = (PFNGLGENVERTEXARRAYSAPPLEPROC)glewGetProcAddress((const GLubyte*)"glGenVertexArraysAPPLE");
+  glGenVertexArraysAPPLE(n, arrays);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsVertexArrayAPPLE (GLuint array)
+{
+  glIsVertexArrayAPPLE = (PFNGLISVERTEXARRAYAPPLEPROC)glewGetProcAddress((const GLubyte*)"glIsVertexArrayAPPLE");
+  return glIsVertexArrayAPPLE(array);
+}
+
+
+static void GLAPIENTRY _glewLazy_glFlushVertexArrayRangeAPPLE (GLsizei length, void *pointer)
+{
+  glFlushVertexArrayRangeAPPLE = (PFNGLFLUSHVERTEXARRAYRANGEAPPLEPROC)glewGetProcAddress((const GLubyte*)"glFlushVertexArrayRangeAPPLE");
+  glFlushVertexArrayRangeAPPLE(length, pointer);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayParameteriAPPLE (GLenum pname, GLint param)
+{
+  glVertexArrayParameteriAPPLE = (PFNGLVERTEXARRAYPARAMETERIAPPLEPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayParameteriAPPLE");
+  glVertexArrayParameteriAPPLE(pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayRangeAPPLE (GLsizei length, void *pointer)
+{
+  glVertexArrayRangeAPPLE = (PFNGLVERTEXARRAYRANGEAPPLEPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayRangeAPPLE");
+  glVertexArrayRangeAPPLE(length, pointer);
+}
+
+
+static void GLAPIENTRY _glewLazy_glDisableVertexAttribAPPLE (GLuint index, GLenum pname)
+{
+  glDisableVertexAttribAPPLE = (PFNGLDISABLEVERTEXATTRIBAPPLEPROC)glewGetProcAddress((const GLubyte*)"glDisableVertexAttribAPPLE");
+  glDisableVertexAttribAPPLE(index, pname);
+}
+
+static void GLAPIENTRY _glewLazy_glEnableVertexAttribAPPLE (GLuint index, GLenum pname)
+{
+  glEnableVertexAttribAPPLE = (PFNGLENABLEVERTEXATTRIBAPPLEPROC)glewGetProcAddress((const GLubyte*)"glEnableVertexAttribAPPLE");
+  glEnableVertexAttribAPPLE(index, pname);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsVertexAttribEnabledAPPLE (GLuint index, GLenum pname)
+{
+  glIsVertexAttribEnabledAPPLE = (PFNGLISVERTEXATTRIBENABLEDAPPLEPROC)glewGetProcAddress((const GLubyte*)"glIsVertexAttribEnabledAPPLE");
+  return glIsVertexAttribEnabledAPPLE(index, pname);
+}
+
+static void GLAPIENTRY _glewLazy_glMapVertexAttrib1dAPPLE (GLuint index, GLuint size, GLdouble u1, GLdouble u2, GLint stride, GLint order, const GLdouble* points)
+{
+  glMapVertexAttrib1dAPPLE = (PFNGLMAPVERTEXATTRIB1DAPPLEPROC)glewGetProcAddress((const GLubyte*)"glMapVertexAttrib1dAPPLE");
+  glMapVertexAttrib1dAPPLE(index, size, u1, u2, stride, order, points);
+}
+
+static void GLAPIENTRY _glewLazy_glMapVertexAttrib1fAPPLE (GLuint index, GLuint size, GLfloat u1, GLfloat u2, GLint stride, GLint order, const GLfloat* points)
+{
+  glMapVertexAttrib1fAPPLE = (PFNGLMAPVERTEXATTRIB1FAPPLEPROC)glewGetProcAddress((const GLubyte*)"glMapVertexAttrib1fAPPLE");
+  glMapVertexAttrib1fAPPLE(index, size, u1, u2, stride, order, points);
+}
+
+static void GLAPIENTRY _glewLazy_glMapVertexAttrib2dAPPLE (GLuint index, GLuint size, GLdouble u1, GLdouble u2, GLint ustride, GLint uorder, GLdouble v1, GLdouble v2, GLint vstride, GLint vorder, const GLdouble* points)
+{
+  glMapVertexAttrib2dAPPLE = (PFNGLMAPVERTEXATTRIB2DAPPLEPROC)glewGetProcAddress((const GLubyte*)"glMapVertexAttrib2dAPPLE");
+  glMapVertexAttrib2dAPPLE(index, size, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+}
+
+static void GLAPIENTRY _glewLazy_glMapVertexAttrib2fAPPLE (GLuint index, GLuint size, GLfloat u1, GLfloat u2, GLint ustride, GLint uorder, GLfloat v1, GLfloat v2, GLint vstride, GLint vorder, const GLfloat* points)
+{
+  glMapVertexAttrib2fAPPLE = (PFNGLMAPVERTEXATTRIB2FAPPLEPROC)glewGetProcAddress((const GLubyte*)"glMapVertexAttrib2fAPPLE");
+  glMapVertexAttrib2fAPPLE(index, size, u1, u2, ustride, uorder, v1, v2, vstride, vorder, points);
+}
+
+
+static void GLAPIENTRY _glewLazy_glClearDepthf (GLclampf d)
+{
+  glClearDepthf = (PFNGLCLEARDEPTHFPROC)glewGetProcAddress((const GLubyte*)"glClearDepthf");
+  glClearDepthf(d);
+}
+
+static void GLAPIENTRY _glewLazy_glDepthRangef (GLclampf n, GLclampf f)
+{
+  glDepthRangef = (PFNGLDEPTHRANGEFPROC)glewGetProcAddress((const GLubyte*)"glDepthRangef");
+  glDepthRangef(n, f);
+}
+
+static void GLAPIENTRY _glewLazy_glGetShaderPrecisionFormat (GLenum shadertype, GLenum precisiontype, GLint* range, GLint *precision)
+{
+  glGetShaderPrecisionFormat = (PFNGLGETSHADERPRECISIONFORMATPROC)glewGetProcAddress((const GLubyte*)"glGetShaderPrecisionFormat");
+  glGetShaderPrecisionFormat(shadertype, precisiontype, range, precision);
+}
+
+static void GLAPIENTRY _glewLazy_glReleaseShaderCompiler (void)
+{
+  glReleaseShaderCompiler = (PFNGLRELEASESHADERCOMPILERPROC)glewGetProcAddress((const GLubyte*)"glReleaseShaderCompiler");
+  glReleaseShaderCompiler();
+}
+
+static void GLAPIENTRY _glewLazy_glShaderBinary (GLsizei count, const GLuint* shaders, GLenum binaryformat, const void*binary, GLsizei length)
+{
+  glShaderBinary = (PFNGLSHADERBINARYPROC)glewGetProcAddress((const GLubyte*)"glShaderBinary");
+  glShaderBinary(count, shaders, binaryformat, binary, length);
+}
+
+
+static void GLAPIENTRY _glewLazy_glMemoryBarrierByRegion (GLbitfield barriers)
+{
+  glMemoryBarrierByRegion = (PFNGLMEMORYBARRIERBYREGIONPROC)glewGetProcAddress((const GLubyte*)"glMemoryBarrierByRegion");
+  glMemoryBarrierByRegion(barriers);
+}
+
+
+static void GLAPIENTRY _glewLazy_glDrawArraysInstancedBaseInstance (GLenum mode, GLint first, GLsizei count, GLsizei primcount, GLuint baseinstance)
+{
+  glDrawArraysInstancedBaseInstance = (PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC)glewGetProcAddress((const GLubyte*)"glDrawArraysInstancedBaseInstance");
+  glDrawArraysInstancedBaseInstance(mode, first, count, primcount, baseinstance);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawElementsInstancedBaseInstance (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei primcount, GLuint baseinstance)
+{
+  glDrawElementsInstancedBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC)glewGetProcAddress((const GLubyte*)"glDrawElementsInstancedBaseInstance");
+  glDrawElementsInstancedBaseInstance(mode, count, type, indices, primcount, baseinstance);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawElementsInstancedBaseVertexBaseInstance (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei primcount, GLint basevertex, GLuint baseinstance)
+{
+  glDrawElementsInstancedBaseVertexBaseInstance = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC)glewGetProcAddress((const GLubyte*)"glDrawElementsInstancedBaseVertexBaseInstance");
+  glDrawElementsInstancedBaseVertexBaseInstance(mode, count, type, indices, primcount, basevertex, baseinstance);
+}
+
+
+static GLuint64 GLAPIENTRY _glewLazy_glGetImageHandleARB (GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum format)
+{
+  glGetImageHandleARB = (PFNGLGETIMAGEHANDLEARBPROC)glewGetProcAddress((const GLubyte*)"glGetImageHandleARB");
+  return glGetImageHandleARB(texture, level, layered, layer, format);
+}
+
+static GLuint64 GLAPIENTRY _glewLazy_glGetTextureHandleARB (GLuint texture)
+{
+  glGetTextureHandleARB = (PFNGLGETTEXTUREHANDLEARBPROC)glewGetProcAddress((const GLubyte*)"glGetTextureHandleARB");
+  return glGetTextureHandleARB(texture);
+}
+
+static GLuint64 GLAPIENTRY _glewLazy_glGetTextureSamplerHandleARB (GLuint texture, GLuint sampler)
+{
+  glGetTextureSamplerHandleARB = (PFNGLGETTEXTURESAMPLERHANDLEARBPROC)glewGetProcAddress((const GLubyte*)"glGetTextureSamplerHandleARB");
+  return glGetTextureSamplerHandleARB(texture, sampler);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribLui64vARB (GLuint index, GLenum pname, GLuint64EXT* params)
+{
+  glGetVertexAttribLui64vARB = (PFNGLGETVERTEXATTRIBLUI64VARBPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribLui64vARB");
+  glGetVertexAttribLui64vARB(index, pname, params);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsImageHandleResidentARB (GLuint64 handle)
+{
+  glIsImageHandleResidentARB = (PFNGLISIMAGEHANDLERESIDENTARBPROC)glewGetProcAddress((const GLubyte*)"glIsImageHandleResidentARB");
+  return glIsImageHandleResidentARB(handle);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsTextureHandleResidentARB (GLuint64 handle)
+{
+  glIsTextureHandleResidentARB = (PFNGLISTEXTUREHANDLERESIDENTARBPROC)glewGetProcAddress((const GLubyte*)"glIsTextureHandleResidentARB");
+  return glIsTextureHandleResidentARB(handle);
+}
+
+static void GLAPIENTRY _glewLazy_glMakeImageHandleNonResidentARB (GLuint64 handle)
+{
+  glMakeImageHandleNonResidentARB = (PFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC)glewGetProcAddress((const GLubyte*)"glMakeImageHandleNonResidentARB");
+  glMakeImageHandleNonResidentARB(handle);
+}
+
+static void GLAPIENTRY _glewLazy_glMakeImageHandleResidentARB (GLuint64 handle, GLenum access)
+{
+  glMakeImageHandleResidentARB = (PFNGLMAKEIMAGEHANDLERESIDENTARBPROC)glewGetProcAddress((const GLubyte*)"glMakeImageHandleResidentARB");
+  glMakeImageHandleResidentARB(handle, access);
+}
+
+static void GLAPIENTRY _glewLazy_glMakeTextureHandleNonResidentARB (GLuint64 handle)
+{
+  glMakeTextureHandleNonResidentARB = (PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC)glewGetProcAddress((const GLubyte*)"glMakeTextureHandleNonResidentARB");
+  glMakeTextureHandleNonResidentARB(handle);
+}
+
+static void GLAPIENTRY _glewLazy_glMakeTextureHandleResidentARB (GLuint64 handle)
+{
+  glMakeTextureHandleResidentARB = (PFNGLMAKETEXTUREHANDLERESIDENTARBPROC)glewGetProcAddress((const GLubyte*)"glMakeTextureHandleResidentARB");
+  glMakeTextureHandleResidentARB(handle);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformHandleui64ARB (GLuint program, GLint location, GLuint64 value)
+{
+  glProgramUniformHandleui64ARB = (PFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformHandleui64ARB");
+  glProgramUniformHandleui64ARB(program, location, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformHandleui64vARB (GLuint program, GLint location, GLsizei count, const GLuint64* values)
+{
+  glProgramUniformHandleui64vARB = (PFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformHandleui64vARB");
+  glProgramUniformHandleui64vARB(program, location, count, values);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformHandleui64ARB (GLint location, GLuint64 value)
+{
+  glUniformHandleui64ARB = (PFNGLUNIFORMHANDLEUI64ARBPROC)glewGetProcAddress((const GLubyte*)"glUniformHandleui64ARB");
+  glUniformHandleui64ARB(location, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformHandleui64vARB (GLint location, GLsizei count, const GLuint64* value)
+{
+  glUniformHandleui64vARB = (PFNGLUNIFORMHANDLEUI64VARBPROC)glewGetProcAddress((const GLubyte*)"glUniformHandleui64vARB");
+  glUniformHandleui64vARB(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL1ui64ARB (GLuint index, GLuint64EXT x)
+{
+  glVertexAttribL1ui64ARB = (PFNGLVERTEXATTRIBL1UI64ARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL1ui64ARB");
+  glVertexAttribL1ui64ARB(index, x);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL1ui64vARB (GLuint index, const GLuint64EXT* v)
+{
+  glVertexAttribL1ui64vARB = (PFNGLVERTEXATTRIBL1UI64VARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL1ui64vARB");
+  glVertexAttribL1ui64vARB(index, v);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBindFragDataLocationIndexed (GLuint program, GLuint colorNumber, GLuint index, const GLchar * name)
+{
+  glBindFragDataLocationIndexed = (PFNGLBINDFRAGDATALOCATIONINDEXEDPROC)glewGetProcAddress((const GLubyte*)"glBindFragDataLocationIndexed");
+  glBindFragDataLocationIndexed(program, colorNumber, index, name);
+}
+
+static GLint GLAPIENTRY _glewLazy_glGetFragDataIndex (GLuint program, const GLchar * name)
+{
+  glGetFragDataIndex = (PFNGLGETFRAGDATAINDEXPROC)glewGetProcAddress((const GLubyte*)"glGetFragDataIndex");
+  return glGetFragDataIndex(program, name);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBufferStorage (GLenum target, GLsizeiptr size, const void *data, GLbitfield flags)
+{
+  glBufferStorage = (PFNGLBUFFERSTORAGEPROC)glewGetProcAddress((const GLubyte*)"glBufferStorage");
+  glBufferStorage(target, size, data, flags);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedBufferStorageEXT (GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags)
+{
+  glNamedBufferStorageEXT = (PFNGLNAMEDBUFFERSTORAGEEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedBufferStorageEXT");
+  glNamedBufferStorageEXT(buffer, size, data, flags);
+}
+
+
+static GLsync GLAPIENTRY _glewLazy_glCreateSyncFromCLeventARB (cl_context context, cl_event event, GLbitfield flags)
+{
+  glCreateSyncFromCLeventARB = (PFNGLCREATESYNCFROMCLEVENTARBPROC)glewGetProcAddress((const GLubyte*)"glCreateSyncFromCLeventARB");
+  return glCreateSyncFromCLeventARB(context, event, flags);
+}
+
+
+static void GLAPIENTRY _glewLazy_glClearBufferData (GLenum target, GLenum internalformat, GLenum format, GLenum type, const void *data)
+{
+  glClearBufferData = (PFNGLCLEARBUFFERDATAPROC)glewGetProcAddress((const GLubyte*)"glClearBufferData");
+  glClearBufferData(target, internalformat, format, type, data);
+}
+
+static void GLAPIENTRY _glewLazy_glClearBufferSubData (GLenum target, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data)
+{
+  glClearBufferSubData = (PFNGLCLEARBUFFERSUBDATAPROC)glewGetProcAddress((const GLubyte*)"glClearBufferSubData");
+  glClearBufferSubData(target, internalformat, offset, size, format, type, data);
+}
+
+static void GLAPIENTRY _glewLazy_glClearNamedBufferDataEXT (GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data)
+{
+  glClearNamedBufferDataEXT = (PFNGLCLEARNAMEDBUFFERDATAEXTPROC)glewGetProcAddress((const GLubyte*)"glClearNamedBufferDataEXT");
+  glClearNamedBufferDataEXT(buffer, internalformat, format, type, data);
+}
+
+static void GLAPIENTRY _glewLazy_glClearNamedBufferSubDataEXT (GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data)
+{
+  glClearNamedBufferSubDataEXT = (PFNGLCLEARNAMEDBUFFERSUBDATAEXTPROC)glewGetProcAddress((const GLubyte*)"glClearNamedBufferSubDataEXT");
+  glClearNamedBufferSubDataEXT(buffer, internalformat, offset, size, format, type, data);
+}
+
+
+static void GLAPIENTRY _glewLazy_glClearTexImage (GLuint texture, GLint level, GLenum format, GLenum type, const void *data)
+{
+  glClearTexImage = (PFNGLCLEARTEXIMAGEPROC)glewGetProcAddress((const GLubyte*)"glClearTexImage");
+  glClearTexImage(texture, level, format, type, data);
+}
+
+static void GLAPIENTRY _glewLazy_glClearTexSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *data)
+{
+  glClearTexSubImage = (PFNGLCLEARTEXSUBIMAGEPROC)glewGetProcAddress((const GLubyte*)"glClearTexSubImage");
+  glClearTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data);
+}
+
+
+static void GLAPIENTRY _glewLazy_glClipControl (GLenum origin, GLenum depth)
+{
+  glClipControl = (PFNGLCLIPCONTROLPROC)glewGetProcAddress((const GLubyte*)"glClipControl");
+  glClipControl(origin, depth);
+}
+
+
+static void GLAPIENTRY _glewLazy_glClampColorARB (GLenum target, GLenum clamp)
+{
+  glClampColorARB = (PFNGLCLAMPCOLORARBPROC)glewGetProcAddress((const GLubyte*)"glClampColorARB");
+  glClampColorARB(target, clamp);
+}
+
+
+static void GLAPIENTRY _glewLazy_glDispatchCompute (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z)
+{
+  glDispatchCompute = (PFNGLDISPATCHCOMPUTEPROC)glewGetProcAddress((const GLubyte*)"glDispatchCompute");
+  glDispatchCompute(num_groups_x, num_groups_y, num_groups_z);
+}
+
+static void GLAPIENTRY _glewLazy_glDispatchComputeIndirect (GLintptr indirect)
+{
+  glDispatchComputeIndirect = (PFNGLDISPATCHCOMPUTEINDIRECTPROC)glewGetProcAddress((const GLubyte*)"glDispatchComputeIndirect");
+  glDispatchComputeIndirect(indirect);
+}
+
+
+static void GLAPIENTRY _glewLazy_glDispatchComputeGroupSizeARB (GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z, GLuint group_size_x, GLuint group_size_y, GLuint group_size_z)
+{
+  glDispatchComputeGroupSizeARB = (PFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC)glewGetProcAddress((const GLubyte*)"glDispatchComputeGroupSizeARB");
+  glDispatchComputeGroupSizeARB(num_groups_x, num_groups_y, num_groups_z, group_size_x, group_size_y, group_size_z);
+}
+
+
+static void GLAPIENTRY _glewLazy_glCopyBufferSubData (GLenum readtarget, GLenum writetarget, GLintptr readoffset, GLintptr writeoffset, GLsizeiptr size)
+{
+  glCopyBufferSubData = (PFNGLCOPYBUFFERSUBDATAPROC)glewGetProcAddress((const GLubyte*)"glCopyBufferSubData");
+  glCopyBufferSubData(readtarget, writetarget, readoffset, writeoffset, size);
+}
+
+
+static void GLAPIENTRY _glewLazy_glCopyImageSubData (GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei srcWidth, GLsizei srcHeight, GLsizei srcDepth)
+{
+  glCopyImageSubData = (PFNGLCOPYIMAGESUBDATAPROC)glewGetProcAddress((const GLubyte*)"glCopyImageSubData");
+  glCopyImageSubData(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, srcWidth, srcHeight, srcDepth);
+}
+
+
+static void GLAPIENTRY _glewLazy_glDebugMessageCallbackARB (GLDEBUGPROCARB callback, const void *userParam)
+{
+  glDebugMessageCallbackARB = (PFNGLDEBUGMESSAGECALLBACKARBPROC)glewGetProcAddress((const GLubyte*)"glDebugMessageCallbackARB");
+  glDebugMessageCallbackARB(callback, userParam);
+}
+
+static void GLAPIENTRY _glewLazy_glDebugMessageControlARB (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint* ids, GLboolean enabled)
+{
+  glDebugMessageControlARB = (PFNGLDEBUGMESSAGECONTROLARBPROC)glewGetProcAddress((const GLubyte*)"glDebugMessageControlARB");
+  glDebugMessageControlARB(source, type, severity, count, ids, enabled);
+}
+
+static void GLAPIENTRY _glewLazy_glDebugMessageInsertARB (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* buf)
+{
+  glDebugMessageInsertARB = (PFNGLDEBUGMESSAGEINSERTARBPROC)glewGetProcAddress((const GLubyte*)"glDebugMessageInsertARB");
+  glDebugMessageInsertARB(source, type, id, severity, length, buf);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glGetDebugMessageLogARB (GLuint count, GLsizei bufSize, GLenum* sources, GLenum* types, GLuint* ids, GLenum* severities, GLsizei* lengths, GLchar* messageLog)
+{
+  glGetDebugMessageLogARB = (PFNGLGETDEBUGMESSAGELOGARBPROC)glewGetProcAddress((const GLubyte*)"glGetDebugMessageLogARB");
+  return glGetDebugMessageLogARB(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBindTextureUnit (GLuint unit, GLuint texture)
+{
+  glBindTextureUnit = (PFNGLBINDTEXTUREUNITPROC)glewGetProcAddress((const GLubyte*)"glBindTextureUnit");
+  glBindTextureUnit(unit, texture);
+}
+
+static void GLAPIENTRY _glewLazy_glBlitNamedFramebuffer (GLuint readFramebuffer, GLuint drawFramebuffer, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+  glBlitNamedFramebuffer = (PFNGLBLITNAMEDFRAMEBUFFERPROC)glewGetProcAddress((const GLubyte*)"glBlitNamedFramebuffer");
+  glBlitNamedFramebuffer(readFramebuffer, drawFramebuffer, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+
+static GLenum GLAPIENTRY _glewLazy_glCheckNamedFramebufferStatus (GLuint framebuffer, GLenum target)
+{
+  glCheckNamedFramebufferStatus = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC)glewGetProcAddress((const GLubyte*)"glCheckNamedFramebufferStatus");
+  return glCheckNamedFramebufferStatus(framebuffer, target);
+}
+
+static void GLAPIENTRY _glewLazy_glClearNamedBufferData (GLuint buffer, GLenum internalformat, GLenum format, GLenum type, const void *data)
+{
+  glClearNamedBufferData = (PFNGLCLEARNAMEDBUFFERDATAPROC)glewGetProcAddress((const GLubyte*)"glClearNamedBufferData");
+  glClearNamedBufferData(buffer, internalformat, format, type, data);
+}
+
+static void GLAPIENTRY _glewLazy_glClearNamedBufferSubData (GLuint buffer, GLenum internalformat, GLintptr offset, GLsizeiptr size, GLenum format, GLenum type, const void *data)
+{
+  glClearNamedBufferSubData = (PFNGLCLEARNAMEDBUFFERSUBDATAPROC)glewGetProcAddress((const GLubyte*)"glClearNamedBufferSubData");
+  glClearNamedBufferSubData(buffer, internalformat, offset, size, format, type, data);
+}
+
+static void GLAPIENTRY _glewLazy_glClearNamedFramebufferfi (GLuint framebuffer, GLenum buffer, GLfloat depth, GLint stencil)
+{
+  glClearNamedFramebufferfi = (PFNGLCLEARNAMEDFRAMEBUFFERFIPROC)glewGetProcAddress((const GLubyte*)"glClearNamedFramebufferfi");
+  glClearNamedFramebufferfi(framebuffer, buffer, depth, stencil);
+}
+
+static void GLAPIENTRY _glewLazy_glClearNamedFramebufferfv (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLfloat* value)
+{
+  glClearNamedFramebufferfv = (PFNGLCLEARNAMEDFRAMEBUFFERFVPROC)glewGetProcAddress((const GLubyte*)"glClearNamedFramebufferfv");
+  glClearNamedFramebufferfv(framebuffer, buffer, drawbuffer, value);
+}
+
+static void GLAPIENTRY _glewLazy_glClearNamedFramebufferiv (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLint* value)
+{
+  glClearNamedFramebufferiv = (PFNGLCLEARNAMEDFRAMEBUFFERIVPROC)glewGetProcAddress((const GLubyte*)"glClearNamedFramebufferiv");
+  glClearNamedFramebufferiv(framebuffer, buffer, drawbuffer, value);
+}
+
+static void GLAPIENTRY _glewLazy_glClearNamedFramebufferuiv (GLuint framebuffer, GLenum buffer, GLint drawbuffer, const GLuint* value)
+{
+  glClearNamedFramebufferuiv = (PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC)glewGetProcAddress((const GLubyte*)"glClearNamedFramebufferuiv");
+  glClearNamedFramebufferuiv(framebuffer, buffer, drawbuffer, value);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTextureSubImage1D (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data)
+{
+  glCompressedTextureSubImage1D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC)glewGetProcAddress((const GLubyte*)"glCompressedTextureSubImage1D");
+  glCompressedTextureSubImage1D(texture, level, xoffset, width, format, imageSize, data);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTextureSubImage2D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data)
+{
+  glCompressedTextureSubImage2D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC)glewGetProcAddress((const GLubyte*)"glCompressedTextureSubImage2D");
+  glCompressedTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTextureSubImage3D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data)
+{
+  glCompressedTextureSubImage3D = (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC)glewGetProcAddress((const GLubyte*)"glCompressedTextureSubImage3D");
+  glCompressedTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyNamedBufferSubData (GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+  glCopyNamedBufferSubData = (PFNGLCOPYNAMEDBUFFERSUBDATAPROC)glewGetProcAddress((const GLubyte*)"glCopyNamedBufferSubData");
+  glCopyNamedBufferSubData(readBuffer, writeBuffer, readOffset, writeOffset, size);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyTextureSubImage1D (GLuint texture, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+  glCopyTextureSubImage1D = (PFNGLCOPYTEXTURESUBIMAGE1DPROC)glewGetProcAddress((const GLubyte*)"glCopyTextureSubImage1D");
+  glCopyTextureSubImage1D(texture, level, xoffset, x, y, width);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyTextureSubImage2D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+  glCopyTextureSubImage2D = (PFNGLCOPYTEXTURESUBIMAGE2DPROC)glewGetProcAddress((const GLubyte*)"glCopyTextureSubImage2D");
+  glCopyTextureSubImage2D(texture, level, xoffset, yoffset, x, y, width, height);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyTextureSubImage3D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+  glCopyTextureSubImage3D = (PFNGLCOPYTEXTURESUBIMAGE3DPROC)glewGetProcAddress((const GLubyte*)"glCopyTextureSubImage3D");
+  glCopyTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+
+static void GLAPIENTRY _glewLazy_glCreateBuffers (GLsizei n, GLuint* buffers)
+{
+  glCreateBuffers = (PFNGLCREATEBUFFERSPROC)glewGetProcAddress((const GLubyte*)"glCreateBuffers");
+  glCreateBuffers(n, buffers);
+}
+
+static void GLAPIENTRY _glewLazy_glCreateFramebuffers (GLsizei n, GLuint* framebuffers)
+{
+  glCreateFramebuffers = (PFNGLCREATEFRAMEBUFFERSPROC)glewGetProcAddress((const GLubyte*)"glCreateFramebuffers");
+  glCreateFramebuffers(n, framebuffers);
+}
+
+static void GLAPIENTRY _glewLazy_glCreateProgramPipelines (GLsizei n, GLuint* pipelines)
+{
+  glCreateProgramPipelines = (PFNGLCREATEPROGRAMPIPELINESPROC)glewGetProcAddress((const GLubyte*)"glCreateProgramPipelines");
+  glCreateProgramPipelines(n, pipelines);
+}
+
+static void GLAPIENTRY _glewLazy_glCreateQueries (GLenum target, GLsizei n, GLuint* ids)
+{
+  glCreateQueries = (PFNGLCREATEQUERIESPROC)glewGetProcAddress((const GLubyte*)"glCreateQueries");
+  glCreateQueries(target, n, ids);
+}
+
+static void GLAPIENTRY _glewLazy_glCreateRenderbuffers (GLsizei n, GLuint* renderbuffers)
+{
+  glCreateRenderbuffers = (PFNGLCREATERENDERBUFFERSPROC)glewGetProcAddress((const GLubyte*)"glCreateRenderbuffers");
+  glCreateRenderbuffers(n, renderbuffers);
+}
+
+static void GLAPIENTRY _glewLazy_glCreateSamplers (GLsizei n, GLuint* samplers)
+{
+  glCreateSamplers = (PFNGLCREATESAMPLERSPROC)glewGetProcAddress((const GLubyte*)"glCreateSamplers");
+  glCreateSamplers(n, samplers);
+}
+
+static void GLAPIENTRY _glewLazy_glCreateTextures (GLenum target, GLsizei n, GLuint* textures)
+{
+  glCreateTextures = (PFNGLCREATETEXTURESPROC)glewGetProcAddress((const GLubyte*)"glCreateTextures");
+  glCreateTextures(target, n, textures);
+}
+
+static void GLAPIENTRY _glewLazy_glCreateTransformFeedbacks (GLsizei n, GLuint* ids)
+{
+  glCreateTransformFeedbacks = (PFNGLCREATETRANSFORMFEEDBACKSPROC)glewGetProcAddress((const GLubyte*)"glCreateTransformFeedbacks");
+  glCreateTransformFeedbacks(n, ids);
+}
+
+static void GLAPIENTRY _glewLazy_glCreateVertexArrays (GLsizei n, GLuint* arrays)
+{
+  glCreateVertexArrays = (PFNGLCREATEVERTEXARRAYSPROC)glewGetProcAddress((const GLubyte*)"glCreateVertexArrays");
+  glCreateVertexArrays(n, arrays);
+}
+
+static void GLAPIENTRY _glewLazy_glDisableVertexArrayAttrib (GLuint vaobj, GLuint index)
+{
+  glDisableVertexArrayAttrib = (PFNGLDISABLEVERTEXARRAYATTRIBPROC)glewGetProcAddress((const GLubyte*)"glDisableVertexArrayAttrib");
+  glDisableVertexArrayAttrib(vaobj, index);
+}
+
+static void GLAPIENTRY _glewLazy_glEnableVertexArrayAttrib (GLuint vaobj, GLuint index)
+{
+  glEnableVertexArrayAttrib = (PFNGLENABLEVERTEXARRAYATTRIBPROC)glewGetProcAddress((const GLubyte*)"glEnableVertexArrayAttrib");
+  glEnableVertexArrayAttrib(vaobj, index);
+}
+
+static void GLAPIENTRY _glewLazy_glFlushMappedNamedBufferRange (GLuint buffer, GLintptr offset, GLsizeiptr length)
+{
+  glFlushMappedNamedBufferRange = (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC)glewGetProcAddress((const GLubyte*)"glFlushMappedNamedBufferRange");
+  glFlushMappedNamedBufferRange(buffer, offset, length);
+}
+
+static void GLAPIENTRY _glewLazy_glGenerateTextureMipmap (GLuint texture)
+{
+  glGenerateTextureMipmap = (PFNGLGENERATETEXTUREMIPMAPPROC)glewGetProcAddress((const GLubyte*)"glGenerateTextureMipmap");
+  glGenerateTextureMipmap(texture);
+}
+
+static void GLAPIENTRY _glewLazy_glGetCompressedTextureImage (GLuint texture, GLint level, GLsizei bufSize, void *pixels)
+{
+  glGetCompressedTextureImage = (PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC)glewGetProcAddress((const GLubyte*)"glGetCompressedTextureImage");
+  glGetCompressedTextureImage(texture, level, bufSize, pixels);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedBufferParameteri64v (GLuint buffer, GLenum pname, GLint64* params)
+{
+  glGetNamedBufferParameteri64v = (PFNGLGETNAMEDBUFFERPARAMETERI64VPROC)glewGetProcAddress((const GLubyte*)"glGetNamedBufferParameteri64v");
+  glGetNamedBufferParameteri64v(buffer, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedBufferParameteriv (GLuint buffer, GLenum pname, GLint* params)
+{
+  glGetNamedBufferParameteriv = (PFNGLGETNAMEDBUFFERPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glGetNamedBufferParameteriv");
+  glGetNamedBufferParameteriv(buffer, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedBufferPointerv (GLuint buffer, GLenum pname, void** params)
+{
+  glGetNamedBufferPointerv = (PFNGLGETNAMEDBUFFERPOINTERVPROC)glewGetProcAddress((const GLubyte*)"glGetNamedBufferPointerv");
+  glGetNamedBufferPointerv(buffer, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedBufferSubData (GLuint buffer, GLintptr offset, GLsizeiptr size, void *data)
+{
+  glGetNamedBufferSubData = (PFNGLGETNAMEDBUFFERSUBDATAPROC)glewGetProcAddress((const GLubyte*)"glGetNamedBufferSubData");
+  glGetNamedBufferSubData(buffer, offset, size, data);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedFramebufferAttachmentParameteriv (GLuint framebuffer, GLenum attachment, GLenum pname, GLint* params)
+{
+  glGetNamedFramebufferAttachmentParameteriv = (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glGetNamedFramebufferAttachmentParameteriv");
+  glGetNamedFramebufferAttachmentParameteriv(framebuffer, attachment, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedFramebufferParameteriv (GLuint framebuffer, GLenum pname, GLint* param)
+{
+  glGetNamedFramebufferParameteriv = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glGetNamedFramebufferParameteriv");
+  glGetNamedFramebufferParameteriv(framebuffer, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedRenderbufferParameteriv (GLuint renderbuffer, GLenum pname, GLint* params)
+{
+  glGetNamedRenderbufferParameteriv = (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glGetNamedRenderbufferParameteriv");
+  glGetNamedRenderbufferParameteriv(renderbuffer, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryBufferObjecti64v (GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+  glGetQueryBufferObjecti64v = (PFNGLGETQUERYBUFFEROBJECTI64VPROC)glewGetProcAddress((const GLubyte*)"glGetQueryBufferObjecti64v");
+  glGetQueryBufferObjecti64v(id, buffer, pname, offset);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryBufferObjectiv (GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+  glGetQueryBufferObjectiv = (PFNGLGETQUERYBUFFEROBJECTIVPROC)glewGetProcAddress((const GLubyte*)"glGetQueryBufferObjectiv");
+  glGetQueryBufferObjectiv(id, buffer, pname, offset);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryBufferObjectui64v (GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+  glGetQueryBufferObjectui64v = (PFNGLGETQUERYBUFFEROBJECTUI64VPROC)glewGetProcAddress((const GLubyte*)"glGetQueryBufferObjectui64v");
+  glGetQueryBufferObjectui64v(id, buffer, pname, offset);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryBufferObjectuiv (GLuint id, GLuint buffer, GLenum pname, GLintptr offset)
+{
+  glGetQueryBufferObjectuiv = (PFNGLGETQUERYBUFFEROBJECTUIVPROC)glewGetProcAddress((const GLubyte*)"glGetQueryBufferObjectuiv");
+  glGetQueryBufferObjectuiv(id, buffer, pname, offset);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTextureImage (GLuint texture, GLint level, GLenum format, GLenum type, GLsizei bufSize, void *pixels)
+{
+  glGetTextureImage = (PFNGLGETTEXTUREIMAGEPROC)glewGetProcAddress((const GLubyte*)"glGetTextureImage");
+  glGetTextureImage(texture, level, format, type, bufSize, pixels);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTextureLevelParameterfv (GLuint texture, GLint level, GLenum pname, GLfloat* params)
+{
+  glGetTextureLevelParameterfv = (PFNGLGETTEXTURELEVELPARAMETERFVPROC)glewGetProcAddress((const GLubyte*)"glGetTextureLevelParameterfv");
+  glGetTextureLevelParameterfv(texture, level, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTextureLevelParameteriv (GLuint texture, GLint level, GLenum pname, GLint* params)
+{
+  glGetTextureLevelParameteriv = (PFNGLGETTEXTURELEVELPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glGetTextureLevelParameteriv");
+  glGetTextureLevelParameteriv(texture, level, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTextureParameterIiv (GLuint texture, GLenum pname, GLint* params)
+{
+  glGetTextureParameterIiv = (PFNGLGETTEXTUREPARAMETERIIVPROC)glewGetProcAddress((const GLubyte*)"glGetTextureParameterIiv");
+  glGetTextureParameterIiv(texture, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTextureParameterIuiv (GLuint texture, GLenum pname, GLuint* params)
+{
+  glGetTextureParameterIuiv = (PFNGLGETTEXTUREPARAMETERIUIVPROC)glewGetProcAddress((const GLubyte*)"glGetTextureParameterIuiv");
+  glGetTextureParameterIuiv(texture, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTextureParameterfv (GLuint texture, GLenum pname, GLfloat* params)
+{
+  glGetTextureParameterfv = (PFNGLGETTEXTUREPARAMETERFVPROC)glewGetProcAddress((const GLubyte*)"glGetTextureParameterfv");
+  glGetTextureParameterfv(texture, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTextureParameteriv (GLuint texture, GLenum pname, GLint* params)
+{
+  glGetTextureParameteriv = (PFNGLGETTEXTUREPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glGetTextureParameteriv");
+  glGetTextureParameteriv(texture, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTransformFeedbacki64_v (GLuint xfb, GLenum pname, GLuint index, GLint64* param)
+{
+  glGetTransformFeedbacki64_v = (PFNGLGETTRANSFORMFEEDBACKI64_VPROC)glewGetProcAddress((const GLubyte*)"glGetTransformFeedbacki64_v");
+  glGetTransformFeedbacki64_v(xfb, pname, index, param);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTransformFeedbacki_v (GLuint xfb, GLenum pname, GLuint index, GLint* param)
+{
+  glGetTransformFeedbacki_v = (PFNGLGETTRANSFORMFEEDBACKI_VPROC)glewGetProcAddress((const GLubyte*)"glGetTransformFeedbacki_v");
+  glGetTransformFeedbacki_v(xfb, pname, index, param);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTransformFeedbackiv (GLuint xfb, GLenum pname, GLint* param)
+{
+  glGetTransformFeedbackiv = (PFNGLGETTRANSFORMFEEDBACKIVPROC)glewGetProcAddress((const GLubyte*)"glGetTransformFeedbackiv");
+  glGetTransformFeedbackiv(xfb, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexArrayIndexed64iv (GLuint vaobj, GLuint index, GLenum pname, GLint64* param)
+{
+  glGetVertexArrayIndexed64iv = (PFNGLGETVERTEXARRAYINDEXED64IVPROC)glewGetProcAddress((const GLubyte*)"glGetVertexArrayIndexed64iv");
+  glGetVertexArrayIndexed64iv(vaobj, index, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexArrayIndexediv (GLuint vaobj, GLuint index, GLenum pname, GLint* param)
+{
+  glGetVertexArrayIndexediv = (PFNGLGETVERTEXARRAYINDEXEDIVPROC)glewGetProcAddress((const GLubyte*)"glGetVertexArrayIndexediv");
+  glGetVertexArrayIndexediv(vaobj, index, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexArrayiv (GLuint vaobj, GLenum pname, GLint* param)
+{
+  glGetVertexArrayiv = (PFNGLGETVERTEXARRAYIVPROC)glewGetProcAddress((const GLubyte*)"glGetVertexArrayiv");
+  glGetVertexArrayiv(vaobj, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glInvalidateNamedFramebufferData (GLuint framebuffer, GLsizei numAttachments, const GLenum* attachments)
+{
+  glInvalidateNamedFramebufferData = (PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC)glewGetProcAddress((const GLubyte*)"glInvalidateNamedFramebufferData");
+  glInvalidateNamedFramebufferData(framebuffer, numAttachments, attachments);
+}
+
+static void GLAPIENTRY _glewLazy_glInvalidateNamedFramebufferSubData (GLuint framebuffer, GLsizei numAttachments, const GLenum* attachments, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+  glInvalidateNamedFramebufferSubData = (PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC)glewGetProcAddress((const GLubyte*)"glInvalidateNamedFramebufferSubData");
+  glInvalidateNamedFramebufferSubData(framebuffer, numAttachments, attachments, x, y, width, height);
+}
+
+static void * GLAPIENTRY _glewLazy_glMapNamedBuffer (GLuint buffer, GLenum access)
+{
+  glMapNamedBuffer = (PFNGLMAPNAMEDBUFFERPROC)glewGetProcAddress((const GLubyte*)"glMapNamedBuffer");
+  return glMapNamedBuffer(buffer, access);
+}
+
+static void * GLAPIENTRY _glewLazy_glMapNamedBufferRange (GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+  glMapNamedBufferRange = (PFNGLMAPNAMEDBUFFERRANGEPROC)glewGetProcAddress((const GLubyte*)"glMapNamedBufferRange");
+  return glMapNamedBufferRange(buffer, offset, length, access);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedBufferData (GLuint buffer, GLsizeiptr size, const void *data, GLenum usage)
+{
+  glNamedBufferData = (PFNGLNAMEDBUFFERDATAPROC)glewGetProcAddress((const GLubyte*)"glNamedBufferData");
+  glNamedBufferData(buffer, size, data, usage);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedBufferStorage (GLuint buffer, GLsizeiptr size, const void *data, GLbitfield flags)
+{
+  glNamedBufferStorage = (PFNGLNAMEDBUFFERSTORAGEPROC)glewGetProcAddress((const GLubyte*)"glNamedBufferStorage");
+  glNamedBufferStorage(buffer, size, data, flags);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedBufferSubData (GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data)
+{
+  glNamedBufferSubData = (PFNGLNAMEDBUFFERSUBDATAPROC)glewGetProcAddress((const GLubyte*)"glNamedBufferSubData");
+  glNamedBufferSubData(buffer, offset, size, data);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferDrawBuffer (GLuint framebuffer, GLenum mode)
+{
+  glNamedFramebufferDrawBuffer = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferDrawBuffer");
+  glNamedFramebufferDrawBuffer(framebuffer, mode);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferDrawBuffers (GLuint framebuffer, GLsizei n, const GLenum* bufs)
+{
+  glNamedFramebufferDrawBuffers = (PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferDrawBuffers");
+  glNamedFramebufferDrawBuffers(framebuffer, n, bufs);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferParameteri (GLuint framebuffer, GLenum pname, GLint param)
+{
+  glNamedFramebufferParameteri = (PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferParameteri");
+  glNamedFramebufferParameteri(framebuffer, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferReadBuffer (GLuint framebuffer, GLenum mode)
+{
+  glNamedFramebufferReadBuffer = (PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferReadBuffer");
+  glNamedFramebufferReadBuffer(framebuffer, mode);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferRenderbuffer (GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+  glNamedFramebufferRenderbuffer = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferRenderbuffer");
+  glNamedFramebufferRenderbuffer(framebuffer, attachment, renderbuffertarget, renderbuffer);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferTexture (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level)
+{
+  glNamedFramebufferTexture = (PFNGLNAMEDFRAMEBUFFERTEXTUREPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferTexture");
+  glNamedFramebufferTexture(framebuffer, attachment, texture, level);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferTextureLayer (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+  glNamedFramebufferTextureLayer = (PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferTextureLayer");
+  glNamedFramebufferTextureLayer(framebuffer, attachment, texture, level, layer);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedRenderbufferStorage (GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height)
+{
+  glNamedRenderbufferStorage = (PFNGLNAMEDRENDERBUFFERSTORAGEPROC)glewGetProcAddress((const GLubyte*)"glNamedRenderbufferStorage");
+  glNamedRenderbufferStorage(renderbuffer, internalformat, width, height);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedRenderbufferStorageMultisample (GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+  glNamedRenderbufferStorageMultisample = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC)glewGetProcAddress((const GLubyte*)"glNamedRenderbufferStorageMultisample");
+  glNamedRenderbufferStorageMultisample(renderbuffer, samples, internalformat, width, height);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureBuffer (GLuint texture, GLenum internalformat, GLuint buffer)
+{
+  glTextureBuffer = (PFNGLTEXTUREBUFFERPROC)glewGetProcAddress((const GLubyte*)"glTextureBuffer");
+  glTextureBuffer(texture, internalformat, buffer);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureBufferRange (GLuint texture, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+  glTextureBufferRange = (PFNGLTEXTUREBUFFERRANGEPROC)glewGetProcAddress((const GLubyte*)"glTextureBufferRange");
+  glTextureBufferRange(texture, internalformat, buffer, offset, size);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureParameterIiv (GLuint texture, GLenum pname, const GLint* params)
+{
+  glTextureParameterIiv = (PFNGLTEXTUREPARAMETERIIVPROC)glewGetProcAddress((const GLubyte*)"glTextureParameterIiv");
+  glTextureParameterIiv(texture, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureParameterIuiv (GLuint texture, GLenum pname, const GLuint* params)
+{
+  glTextureParameterIuiv = (PFNGLTEXTUREPARAMETERIUIVPROC)glewGetProcAddress((const GLubyte*)"glTextureParameterIuiv");
+  glTextureParameterIuiv(texture, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureParameterf (GLuint texture, GLenum pname, GLfloat param)
+{
+  glTextureParameterf = (PFNGLTEXTUREPARAMETERFPROC)glewGetProcAddress((const GLubyte*)"glTextureParameterf");
+  glTextureParameterf(texture, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureParameterfv (GLuint texture, GLenum pname, const GLfloat* param)
+{
+  glTextureParameterfv = (PFNGLTEXTUREPARAMETERFVPROC)glewGetProcAddress((const GLubyte*)"glTextureParameterfv");
+  glTextureParameterfv(texture, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureParameteri (GLuint texture, GLenum pname, GLint param)
+{
+  glTextureParameteri = (PFNGLTEXTUREPARAMETERIPROC)glewGetProcAddress((const GLubyte*)"glTextureParameteri");
+  glTextureParameteri(texture, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureParameteriv (GLuint texture, GLenum pname, const GLint* param)
+{
+  glTextureParameteriv = (PFNGLTEXTUREPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glTextureParameteriv");
+  glTextureParameteriv(texture, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureStorage1D (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width)
+{
+  glTextureStorage1D = (PFNGLTEXTURESTORAGE1DPROC)glewGetProcAddress((const GLubyte*)"glTextureStorage1D");
+  glTextureStorage1D(texture, levels, internalformat, width);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureStorage2D (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+{
+  glTextureStorage2D = (PFNGLTEXTURESTORAGE2DPROC)glewGetProcAddress((const GLubyte*)"glTextureStorage2D");
+  glTextureStorage2D(texture, levels, internalformat, width, height);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureStorage2DMultisample (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+  glTextureStorage2DMultisample = (PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC)glewGetProcAddress((const GLubyte*)"glTextureStorage2DMultisample");
+  glTextureStorage2DMultisample(texture, samples, internalformat, width, height, fixedsamplelocations);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureStorage3D (GLuint texture, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+{
+  glTextureStorage3D = (PFNGLTEXTURESTORAGE3DPROC)glewGetProcAddress((const GLubyte*)"glTextureStorage3D");
+  glTextureStorage3D(texture, levels, internalformat, width, height, depth);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureStorage3DMultisample (GLuint texture, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+  glTextureStorage3DMultisample = (PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC)glewGetProcAddress((const GLubyte*)"glTextureStorage3DMultisample");
+  glTextureStorage3DMultisample(texture, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureSubImage1D (GLuint texture, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels)
+{
+  glTextureSubImage1D = (PFNGLTEXTURESUBIMAGE1DPROC)glewGetProcAddress((const GLubyte*)"glTextureSubImage1D");
+  glTextureSubImage1D(texture, level, xoffset, width, format, type, pixels);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureSubImage2D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+{
+  glTextureSubImage2D = (PFNGLTEXTURESUBIMAGE2DPROC)glewGetProcAddress((const GLubyte*)"glTextureSubImage2D");
+  glTextureSubImage2D(texture, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureSubImage3D (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels)
+{
+  glTextureSubImage3D = (PFNGLTEXTURESUBIMAGE3DPROC)glewGetProcAddress((const GLubyte*)"glTextureSubImage3D");
+  glTextureSubImage3D(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+
+static void GLAPIENTRY _glewLazy_glTransformFeedbackBufferBase (GLuint xfb, GLuint index, GLuint buffer)
+{
+  glTransformFeedbackBufferBase = (PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC)glewGetProcAddress((const GLubyte*)"glTransformFeedbackBufferBase");
+  glTransformFeedbackBufferBase(xfb, index, buffer);
+}
+
+static void GLAPIENTRY _glewLazy_glTransformFeedbackBufferRange (GLuint xfb, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+  glTransformFeedbackBufferRange = (PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC)glewGetProcAddress((const GLubyte*)"glTransformFeedbackBufferRange");
+  glTransformFeedbackBufferRange(xfb, index, buffer, offset, size);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glUnmapNamedBuffer (GLuint buffer)
+{
+  glUnmapNamedBuffer = (PFNGLUNMAPNAMEDBUFFERPROC)glewGetProcAddress((const GLubyte*)"glUnmapNamedBuffer");
+  return glUnmapNamedBuffer(buffer);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayAttribBinding (GLuint vaobj, GLuint attribindex, GLuint bindingindex)
+{
+  glVertexArrayAttribBinding = (PFNGLVERTEXARRAYATTRIBBINDINGPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayAttribBinding");
+  glVertexArrayAttribBinding(vaobj, attribindex, bindingindex);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayAttribFormat (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset)
+{
+  glVertexArrayAttribFormat = (PFNGLVERTEXARRAYATTRIBFORMATPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayAttribFormat");
+  glVertexArrayAttribFormat(vaobj, attribindex, size, type, normalized, relativeoffset);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayAttribIFormat (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+  glVertexArrayAttribIFormat = (PFNGLVERTEXARRAYATTRIBIFORMATPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayAttribIFormat");
+  glVertexArrayAttribIFormat(vaobj, attribindex, size, type, relativeoffset);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayAttribLFormat (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+  glVertexArrayAttribLFormat = (PFNGLVERTEXARRAYATTRIBLFORMATPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayAttribLFormat");
+  glVertexArrayAttribLFormat(vaobj, attribindex, size, type, relativeoffset);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayBindingDivisor (GLuint vaobj, GLuint bindingindex, GLuint divisor)
+{
+  glVertexArrayBindingDivisor = (PFNGLVERTEXARRAYBINDINGDIVISORPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayBindingDivisor");
+  glVertexArrayBindingDivisor(vaobj, bindingindex, divisor);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayElementBuffer (GLuint vaobj, GLuint buffer)
+{
+  glVertexArrayElementBuffer = (PFNGLVERTEXARRAYELEMENTBUFFERPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayElementBuffer");
+  glVertexArrayElementBuffer(vaobj, buffer);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayVertexBuffer (GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride)
+{
+  glVertexArrayVertexBuffer = (PFNGLVERTEXARRAYVERTEXBUFFERPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayVertexBuffer");
+  glVertexArrayVertexBuffer(vaobj, bindingindex, buffer, offset, stride);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayVertexBuffers (GLuint vaobj, GLuint first, GLsizei count, const GLuint* buffers, const GLintptr *offsets, const GLsizei *strides)
+{
+  glVertexArrayVertexBuffers = (PFNGLVERTEXARRAYVERTEXBUFFERSPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayVertexBuffers");
+  glVertexArrayVertexBuffers(vaobj, first, count, buffers, offsets, strides);
+}
+
+
+static void GLAPIENTRY _glewLazy_glDrawBuffersARB (GLsizei n, const GLenum* bufs)
+{
+  glDrawBuffersARB = (PFNGLDRAWBUFFERSARBPROC)glewGetProcAddress((const GLubyte*)"glDrawBuffersARB");
+  glDrawBuffersARB(n, bufs);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBlendEquationSeparateiARB (GLuint buf, GLenum modeRGB, GLenum modeAlpha)
+{
+  glBlendEquationSeparateiARB = (PFNGLBLENDEQUATIONSEPARATEIARBPROC)glewGetProcAddress((const GLubyte*)"glBlendEquationSeparateiARB");
+  glBlendEquationSeparateiARB(buf, modeRGB, modeAlpha);
+}
+
+static void GLAPIENTRY _glewLazy_glBlendEquationiARB (GLuint buf, GLenum mode)
+{
+  glBlendEquationiARB = (PFNGLBLENDEQUATIONIARBPROC)glewGetProcAddress((const GLubyte*)"glBlendEquationiARB");
+  glBlendEquationiARB(buf, mode);
+}
+
+static void GLAPIENTRY _glewLazy_glBlendFuncSeparateiARB (GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+  glBlendFuncSeparateiARB = (PFNGLBLENDFUNCSEPARATEIARBPROC)glewGetProcAddress((const GLubyte*)"glBlendFuncSeparateiARB");
+  glBlendFuncSeparateiARB(buf, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+
+static void GLAPIENTRY _glewLazy_glBlendFunciARB (GLuint buf, GLenum src, GLenum dst)
+{
+  glBlendFunciARB = (PFNGLBLENDFUNCIARBPROC)glewGetProcAddress((const GLubyte*)"glBlendFunciARB");
+  glBlendFunciARB(buf, src, dst);
+}
+
+
+static void GLAPIENTRY _glewLazy_glDrawElementsBaseVertex (GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex)
+{
+  glDrawElementsBaseVertex = (PFNGLDRAWELEMENTSBASEVERTEXPROC)glewGetProcAddress((const GLubyte*)"glDrawElementsBaseVertex");
+  glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawElementsInstancedBaseVertex (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei primcount, GLint basevertex)
+{
+  glDrawElementsInstancedBaseVertex = (PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC)glewGetProcAddress((const GLubyte*)"glDrawElementsInstancedBaseVertex");
+  glDrawElementsInstancedBaseVertex(mode, count, type, indices, primcount, basevertex);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawRangeElementsBaseVertex (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex)
+{
+  glDrawRangeElementsBaseVertex = (PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC)glewGetProcAddress((const GLubyte*)"glDrawRangeElementsBaseVertex");
+  glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiDrawElementsBaseVertex (GLenum mode, const GLsizei* count, GLenum type, const void *const *indices, GLsizei primcount, const GLint *basevertex)
+{
+  glMultiDrawElementsBaseVertex = (PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawElementsBaseVertex");
+  glMultiDrawElementsBaseVertex(mode, count, type, indices, primcount, basevertex);
+}
+
+
+static void GLAPIENTRY _glewLazy_glDrawArraysIndirect (GLenum mode, const void *indirect)
+{
+  glDrawArraysIndirect = (PFNGLDRAWARRAYSINDIRECTPROC)glewGetProcAddress((const GLubyte*)"glDrawArraysIndirect");
+  glDrawArraysIndirect(mode, indirect);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawElementsIndirect (GLenum mode, GLenum type, const void *indirect)
+{
+  glDrawElementsIndirect = (PFNGLDRAWELEMENTSINDIRECTPROC)glewGetProcAddress((const GLubyte*)"glDrawElementsIndirect");
+  glDrawElementsIndirect(mode, type, indirect);
+}
+
+
+static void GLAPIENTRY _glewLazy_glFramebufferParameteri (GLenum target, GLenum pname, GLint param)
+{
+  glFramebufferParameteri = (PFNGLFRAMEBUFFERPARAMETERIPROC)glewGetProcAddress((const GLubyte*)"glFramebufferParameteri");
+  glFramebufferParameteri(target, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFramebufferParameteriv (GLenum target, GLenum pname, GLint* params)
+{
+  glGetFramebufferParameteriv = (PFNGLGETFRAMEBUFFERPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glGetFramebufferParameteriv");
+  glGetFramebufferParameteriv(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedFramebufferParameterivEXT (GLuint framebuffer, GLenum pname, GLint* params)
+{
+  glGetNamedFramebufferParameterivEXT = (PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetNamedFramebufferParameterivEXT");
+  glGetNamedFramebufferParameterivEXT(framebuffer, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferParameteriEXT (GLuint framebuffer, GLenum pname, GLint param)
+{
+  glNamedFramebufferParameteriEXT = (PFNGLNAMEDFRAMEBUFFERPARAMETERIEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferParameteriEXT");
+  glNamedFramebufferParameteriEXT(framebuffer, pname, param);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBindFramebuffer (GLenum target, GLuint framebuffer)
+{
+  glBindFramebuffer = (PFNGLBINDFRAMEBUFFERPROC)glewGetProcAddress((const GLubyte*)"glBindFramebuffer");
+  glBindFramebuffer(target, framebuffer);
+}
+
+static void GLAPIENTRY _glewLazy_glBindRenderbuffer (GLenum target, GLuint renderbuffer)
+{
+  glBindRenderbuffer = (PFNGLBINDRENDERBUFFERPROC)glewGetProcAddress((const GLubyte*)"glBindRenderbuffer");
+  glBindRenderbuffer(target, renderbuffer);
+}
+
+static void GLAPIENTRY _glewLazy_glBlitFramebuffer (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+  glBlitFramebuffer = (PFNGLBLITFRAMEBUFFERPROC)glewGetProcAddress((const GLubyte*)"glBlitFramebuffer");
+  glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+
+static GLenum GLAPIENTRY _glewLazy_glCheckFramebufferStatus (GLenum target)
+{
+  glCheckFramebufferStatus = (PFNGLCHECKFRAMEBUFFERSTATUSPROC)glewGetProcAddress((const GLubyte*)"glCheckFramebufferStatus");
+  return glCheckFramebufferStatus(target);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteFramebuffers (GLsizei n, const GLuint* framebuffers)
+{
+  glDeleteFramebuffers = (PFNGLDELETEFRAMEBUFFERSPROC)glewGetProcAddress((const GLubyte*)"glDeleteFramebuffers");
+  glDeleteFramebuffers(n, framebuffers);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteRenderbuffers (GLsizei n, const GLuint* renderbuffers)
+{
+  glDeleteRenderbuffers = (PFNGLDELETERENDERBUFFERSPROC)glewGetProcAddress((const GLubyte*)"glDeleteRenderbuffers");
+  glDeleteRenderbuffers(n, renderbuffers);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferRenderbuffer (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+  glFramebufferRenderbuffer = (PFNGLFRAMEBUFFERRENDERBUFFERPROC)glewGetProcAddress((const GLubyte*)"glFramebufferRenderbuffer");
+  glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferTexture1D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+  glFramebufferTexture1D = (PFNGLFRAMEBUFFERTEXTURE1DPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTexture1D");
+  glFramebufferTexture1D(target, attachment, textarget, texture, level);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferTexture2D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+  glFramebufferTexture2D = (PFNGLFRAMEBUFFERTEXTURE2DPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTexture2D");
+  glFramebufferTexture2D(target, attachment, textarget, texture, level);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferTexture3D (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint layer)
+{
+  glFramebufferTexture3D = (PFNGLFRAMEBUFFERTEXTURE3DPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTexture3D");
+  glFramebufferTexture3D(target, attachment, textarget, texture, level, layer);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferTextureLayer (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+  glFramebufferTextureLayer = (PFNGLFRAMEBUFFERTEXTURELAYERPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTextureLayer");
+  glFramebufferTextureLayer(target, attachment, texture, level, layer);
+}
+
+static void GLAPIENTRY _glewLazy_glGenFramebuffers (GLsizei n, GLuint* framebuffers)
+{
+  glGenFramebuffers = (PFNGLGENFRAMEBUFFERSPROC)glewGetProcAddress((const GLubyte*)"glGenFramebuffers");
+  glGenFramebuffers(n, framebuffers);
+}
+
+static void GLAPIENTRY _glewLazy_glGenRenderbuffers (GLsizei n, GLuint* renderbuffers)
+{
+  glGenRenderbuffers = (PFNGLGENRENDERBUFFERSPROC)glewGetProcAddress((const GLubyte*)"glGenRenderbuffers");
+  glGenRenderbuffers(n, renderbuffers);
+}
+
+static void GLAPIENTRY _glewLazy_glGenerateMipmap (GLenum target)
+{
+  glGenerateMipmap = (PFNGLGENERATEMIPMAPPROC)glewGetProcAddress((const GLubyte*)"glGenerateMipmap");
+  glGenerateMipmap(target);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFramebufferAttachmentParameteriv (GLenum target, GLenum attachment, GLenum pname, GLint* params)
+{
+  glGetFramebufferAttachmentParameteriv = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glGetFramebufferAttachmentParameteriv");
+  glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetRenderbufferParameteriv (GLenum target, GLenum pname, GLint* params)
+{
+  glGetRenderbufferParameteriv = (PFNGLGETRENDERBUFFERPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glGetRenderbufferParameteriv");
+  glGetRenderbufferParameteriv(target, pname, params);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsFramebuffer (GLuint framebuffer)
+{
+  glIsFramebuffer = (PFNGLISFRAMEBUFFERPROC)glewGetProcAddress((const GLubyte*)"glIsFramebuffer");
+  return glIsFramebuffer(framebuffer);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsRenderbuffer (GLuint renderbuffer)
+{
+  glIsRenderbuffer = (PFNGLISRENDERBUFFERPROC)glewGetProcAddress((const GLubyte*)"glIsRenderbuffer");
+  return glIsRenderbuffer(renderbuffer);
+}
+
+static void GLAPIENTRY _glewLazy_glRenderbufferStorage (GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
+{
+  glRenderbufferStorage = (PFNGLRENDERBUFFERSTORAGEPROC)glewGetProcAddress((const GLubyte*)"glRenderbufferStorage");
+  glRenderbufferStorage(target, internalformat, width, height);
+}
+
+static void GLAPIENTRY _glewLazy_glRenderbufferStorageMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+  glRenderbufferStorageMultisample = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC)glewGetProcAddress((const GLubyte*)"glRenderbufferStorageMultisample");
+  glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+}
+
+
+static void GLAPIENTRY _glewLazy_glFramebufferTextureARB (GLenum target, GLenum attachment, GLuint texture, GLint level)
+{
+  glFramebufferTextureARB = (PFNGLFRAMEBUFFERTEXTUREARBPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTextureARB");
+  glFramebufferTextureARB(target, attachment, texture, level);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferTextureFaceARB (GLenum target, GLenum attachment, GLuint texture, GLint level, GLenum face)
+{
+  glFramebufferTextureFaceARB = (PFNGLFRAMEBUFFERTEXTUREFACEARBPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTextureFaceARB");
+  glFramebufferTextureFaceARB(target, attachment, texture, level, face);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferTextureLayerARB (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+  glFramebufferTextureLayerARB = (PFNGLFRAMEBUFFERTEXTURELAYERARBPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTextureLayerARB");
+  glFramebufferTextureLayerARB(target, attachment, texture, level, layer);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramParameteriARB (GLuint program, GLenum pname, GLint value)
+{
+  glProgramParameteriARB = (PFNGLPROGRAMPARAMETERIARBPROC)glewGetProcAddress((const GLubyte*)"glProgramParameteriARB");
+  glProgramParameteriARB(program, pname, value);
+}
+
+
+static void GLAPIENTRY _glewLazy_glGetProgramBinary (GLuint program, GLsizei bufSize, GLsizei* length, GLenum *binaryFormat, void*binary)
+{
+  glGetProgramBinary = (PFNGLGETPROGRAMBINARYPROC)glewGetProcAddress((const GLubyte*)"glGetProgramBinary");
+  glGetProgramBinary(program, bufSize, length, binaryFormat, binary);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramBinary (GLuint program, GLenum binaryFormat, const void *binary, GLsizei length)
+{
+  glProgramBinary = (PFNGLPROGRAMBINARYPROC)glewGetProcAddress((const GLubyte*)"glProgramBinary");
+  glProgramBinary(program, binaryFormat, binary, length);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramParameteri (GLuint program, GLenum pname, GLint value)
+{
+  glProgramParameteri = (PFNGLPROGRAMPARAMETERIPROC)glewGetProcAddress((const GLubyte*)"glProgramParameteri");
+  glProgramParameteri(program, pname, value);
+}
+
+
+static void GLAPIENTRY _glewLazy_glGetCompressedTextureSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei bufSize, void *pixels)
+{
+  glGetCompressedTextureSubImage = (PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC)glewGetProcAddress((const GLubyte*)"glGetCompressedTextureSubImage");
+  glGetCompressedTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, bufSize, pixels);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTextureSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, GLsizei bufSize, void *pixels)
+{
+  glGetTextureSubImage = (PFNGLGETTEXTURESUBIMAGEPROC)glewGetProcAddress((const GLubyte*)"glGetTextureSubImage");
+  glGetTextureSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth, format, type, bufSize, pixels);
+}
+
+
+static void GLAPIENTRY _glewLazy_glGetUniformdv (GLuint program, GLint location, GLdouble* params)
+{
+  glGetUniformdv = (PFNGLGETUNIFORMDVPROC)glewGetProcAddress((const GLubyte*)"glGetUniformdv");
+  glGetUniformdv(program, location, params);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1d (GLint location, GLdouble x)
+{
+  glUniform1d = (PFNGLUNIFORM1DPROC)glewGetProcAddress((const GLubyte*)"glUniform1d");
+  glUniform1d(location, x);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1dv (GLint location, GLsizei count, const GLdouble* value)
+{
+  glUniform1dv = (PFNGLUNIFORM1DVPROC)glewGetProcAddress((const GLubyte*)"glUniform1dv");
+  glUniform1dv(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2d (GLint location, GLdouble x, GLdouble y)
+{
+  glUniform2d = (PFNGLUNIFORM2DPROC)glewGetProcAddress((const GLubyte*)"glUniform2d");
+  glUniform2d(location, x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2dv (GLint location, GLsizei count, const GLdouble* value)
+{
+  glUniform2dv = (PFNGLUNIFORM2DVPROC)glewGetProcAddress((const GLubyte*)"glUniform2dv");
+  glUniform2dv(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3d (GLint location, GLdouble x, GLdouble y, GLdouble z)
+{
+  glUniform3d = (PFNGLUNIFORM3DPROC)glewGetProcAddress((const GLubyte*)"glUniform3d");
+  glUniform3d(location, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3dv (GLint location, GLsizei count, const GLdouble* value)
+{
+  glUniform3dv = (PFNGLUNIFORM3DVPROC)glewGetProcAddress((const GLubyte*)"glUniform3dv");
+  glUniform3dv(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4d (GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+  glUniform4d = (PFNGLUNIFORM4DPROC)glewGetProcAddress((const GLubyte*)"glUniform4d");
+  glUniform4d(location, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4dv (GLint location, GLsizei count, const GLdouble* value)
+{
+  glUniform4dv = (PFNGLUNIFORM4DVPROC)glewGetProcAddress((const GLubyte*)"glUniform4dv");
+  glUniform4dv(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix2dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value)
+{
+  glUniformMatrix2dv = (PFNGLUNIFORMMATRIX2DVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix2dv");
+  glUniformMatrix2dv(location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix2x3dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value)
+{
+  glUniformMatrix2x3dv = (PFNGLUNIFORMMATRIX2X3DVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix2x3dv");
+  glUniformMatrix2x3dv(location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix2x4dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value)
+{
+  glUniformMatrix2x4dv = (PFNGLUNIFORMMATRIX2X4DVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix2x4dv");
+  glUniformMatrix2x4dv(location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix3dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value)
+{
+  glUniformMatrix3dv = (PFNGLUNIFORMMATRIX3DVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix3dv");
+  glUniformMatrix3dv(location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix3x2dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value)
+{
+  glUniformMatrix3x2dv = (PFNGLUNIFORMMATRIX3X2DVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix3x2dv");
+  glUniformMatrix3x2dv(location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix3x4dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value)
+{
+  glUniformMatrix3x4dv = (PFNGLUNIFORMMATRIX3X4DVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix3x4dv");
+  glUniformMatrix3x4dv(location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix4dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value)
+{
+  glUniformMatrix4dv = (PFNGLUNIFORMMATRIX4DVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix4dv");
+  glUniformMatrix4dv(location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix4x2dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value)
+{
+  glUniformMatrix4x2dv = (PFNGLUNIFORMMATRIX4X2DVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix4x2dv");
+  glUniformMatrix4x2dv(location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix4x3dv (GLint location, GLsizei count, GLboolean transpose, const GLdouble* value)
+{
+  glUniformMatrix4x3dv = (PFNGLUNIFORMMATRIX4X3DVPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix4x3dv");
+  glUniformMatrix4x3dv(location, count, transpose, value);
+}
+
+
+static void GLAPIENTRY _glewLazy_glColorSubTable (GLenum target, GLsizei start, GLsizei count, GLenum format, GLenum type, const void *data)
+{
+  glColorSubTable = (PFNGLCOLORSUBTABLEPROC)glewGetProcAddress((const GLubyte*)"glColorSubTable");
+  glColorSubTable(target, start, count, format, type, data);
+}
+
+static void GLAPIENTRY _glewLazy_glColorTable (GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const void *table)
+{
+  glColorTable = (PFNGLCOLORTABLEPROC)glewGetProcAddress((const GLubyte*)"glColorTable");
+  glColorTable(target, internalformat, width, format, type, table);
+}
+
+static void GLAPIENTRY _glewLazy_glColorTableParameterfv (GLenum target, GLenum pname, const GLfloat *params)
+{
+  glColorTableParameterfv = (PFNGLCOLORTABLEPARAMETERFVPROC)glewGetProcAddress((const GLubyte*)"glColorTableParameterfv");
+  glColorTableParameterfv(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glColorTableParameteriv (GLenum target, GLenum pname, const GLint *params)
+{
+  glColorTableParameteriv = (PFNGLCOLORTABLEPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glColorTableParameteriv");
+  glColorTableParameteriv(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glConvolutionFilter1D (GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const void *image)
+{
+  glConvolutionFilter1D = (PFNGLCONVOLUTIONFILTER1DPROC)glewGetProcAddress((const GLubyte*)"glConvolutionFilter1D");
+  glConvolutionFilter1D(target, internalformat, width, format, type, image);
+}
+
+static void GLAPIENTRY _glewLazy_glConvolutionFilter2D (GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *image)
+{
+  glConvolutionFilter2D = (PFNGLCONVOLUTIONFILTER2DPROC)glewGetProcAddress((const GLubyte*)"glConvolutionFilter2D");
+  glConvolutionFilter2D(target, internalformat, width, height, format, type, image);
+}
+
+static void GLAPIENTRY _glewLazy_glConvolutionParameterf (GLenum target, GLenum pname, GLfloat params)
+{
+  glConvolutionParameterf = (PFNGLCONVOLUTIONPARAMETERFPROC)glewGetProcAddress((const GLubyte*)"glConvolutionParameterf");
+  glConvolutionParameterf(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glConvolutionParameterfv (GLenum target, GLenum pname, const GLfloat *params)
+{
+  glConvolutionParameterfv = (PFNGLCONVOLUTIONPARAMETERFVPROC)glewGetProcAddress((const GLubyte*)"glConvolutionParameterfv");
+  glConvolutionParameterfv(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glConvolutionParameteri (GLenum target, GLenum pname, GLint params)
+{
+  glConvolutionParameteri = (PFNGLCONVOLUTIONPARAMETERIPROC)glewGetProcAddress((const GLubyte*)"glConvolutionParameteri");
+  glConvolutionParameteri(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glConvolutionParameteriv (GLenum target, GLenum pname, const GLint *params)
+{
+  glConvolutionParameteriv = (PFNGLCONVOLUTIONPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glConvolutionParameteriv");
+  glConvolutionParameteriv(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyColorSubTable (GLenum target, GLsizei start, GLint x, GLint y, GLsizei width)
+{
+  glCopyColorSubTable = (PFNGLCOPYCOLORSUBTABLEPROC)glewGetProcAddress((const GLubyte*)"glCopyColorSubTable");
+  glCopyColorSubTable(target, start, x, y, width);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyColorTable (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width)
+{
+  glCopyColorTable = (PFNGLCOPYCOLORTABLEPROC)glewGetProcAddress((const GLubyte*)"glCopyColorTable");
+  glCopyColorTable(target, internalformat, x, y, width);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyConvolutionFilter1D (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width)
+{
+  glCopyConvolutionFilter1D = (PFNGLCOPYCONVOLUTIONFILTER1DPROC)glewGetProcAddress((const GLubyte*)"glCopyConvolutionFilter1D");
+  glCopyConvolutionFilter1D(target, internalformat, x, y, width);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyConvolutionFilter2D (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+  glCopyConvolutionFilter2D = (PFNGLCOPYCONVOLUTIONFILTER2DPROC)glewGetProcAddress((const GLubyte*)"glCopyConvolutionFilter2D");
+  glCopyConvolutionFilter2D(target, internalformat, x, y, width, height);
+}
+
+static void GLAPIENTRY _glewLazy_glGetColorTable (GLenum target, GLenum format, GLenum type, void *table)
+{
+  glGetColorTable = (PFNGLGETCOLORTABLEPROC)glewGetProcAddress((const GLubyte*)"glGetColorTable");
+  glGetColorTable(target, format, type, table);
+}
+
+static void GLAPIENTRY _glewLazy_glGetColorTableParameterfv (GLenum target, GLenum pname, GLfloat *params)
+{
+  glGetColorTableParameterfv = (PFNGLGETCOLORTABLEPARAMETERFVPROC)glewGetProcAddress((const GLubyte*)"glGetColorTableParameterfv");
+  glGetColorTableParameterfv(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetColorTableParameteriv (GLenum target, GLenum pname, GLint *params)
+{
+  glGetColorTableParameteriv = (PFNGLGETCOLORTABLEPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glGetColorTableParameteriv");
+  glGetColorTableParameteriv(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetConvolutionFilter (GLenum target, GLenum format, GLenum type, void *image)
+{
+  glGetConvolutionFilter = (PFNGLGETCONVOLUTIONFILTERPROC)glewGetProcAddress((const GLubyte*)"glGetConvolutionFilter");
+  glGetConvolutionFilter(target, format, type, image);
+}
+
+static void GLAPIENTRY _glewLazy_glGetConvolutionParameterfv (GLenum target, GLenum pname, GLfloat *params)
+{
+  glGetConvolutionParameterfv = (PFNGLGETCONVOLUTIONPARAMETERFVPROC)glewGetProcAddress((const GLubyte*)"glGetConvolutionParameterfv");
+  glGetConvolutionParameterfv(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetConvolutionParameteriv (GLenum target, GLenum pname, GLint *params)
+{
+  glGetConvolutionParameteriv = (PFNGLGETCONVOLUTIONPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glGetConvolutionParameteriv");
+  glGetConvolutionParameteriv(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetHistogram (GLenum target, GLboolean reset, GLenum format, GLenum type, void *values)
+{
+  glGetHistogram = (PFNGLGETHISTOGRAMPROC)glewGetProcAddress((const GLubyte*)"glGetHistogram");
+  glGetHistogram(target, reset, format, type, values);
+}
+
+static void GLAPIENTRY _glewLazy_glGetHistogramParameterfv (GLenum target, GLenum pname, GLfloat *params)
+{
+  glGetHistogramParameterfv = (PFNGLGETHISTOGRAMPARAMETERFVPROC)glewGetProcAddress((const GLubyte*)"glGetHistogramParameterfv");
+  glGetHistogramParameterfv(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetHistogramParameteriv (GLenum target, GLenum pname, GLint *params)
+{
+  glGetHistogramParameteriv = (PFNGLGETHISTOGRAMPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glGetHistogramParameteriv");
+  glGetHistogramParameteriv(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMinmax (GLenum target, GLboolean reset, GLenum format, GLenum types, void *values)
+{
+  glGetMinmax = (PFNGLGETMINMAXPROC)glewGetProcAddress((const GLubyte*)"glGetMinmax");
+  glGetMinmax(target, reset, format, types, values);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMinmaxParameterfv (GLenum target, GLenum pname, GLfloat *params)
+{
+  glGetMinmaxParameterfv = (PFNGLGETMINMAXPARAMETERFVPROC)glewGetProcAddress((const GLubyte*)"glGetMinmaxParameterfv");
+  glGetMinmaxParameterfv(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMinmaxParameteriv (GLenum target, GLenum pname, GLint *params)
+{
+  glGetMinmaxParameteriv = (PFNGLGETMINMAXPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glGetMinmaxParameteriv");
+  glGetMinmaxParameteriv(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetSeparableFilter (GLenum target, GLenum format, GLenum type, void *row, void *column, void *span)
+{
+  glGetSeparableFilter = (PFNGLGETSEPARABLEFILTERPROC)glewGetProcAddress((const GLubyte*)"glGetSeparableFilter");
+  glGetSeparableFilter(target, format, type, row, column, span);
+}
+
+static void GLAPIENTRY _glewLazy_glHistogram (GLenum target, GLsizei width, GLenum internalformat, GLboolean sink)
+{
+  glHistogram = (PFNGLHISTOGRAMPROC)glewGetProcAddress((const GLubyte*)"glHistogram");
+  glHistogram(target, width, internalformat, sink);
+}
+
+static void GLAPIENTRY _glewLazy_glMinmax (GLenum target, GLenum internalformat, GLboolean sink)
+{
+  glMinmax = (PFNGLMINMAXPROC)glewGetProcAddress((const GLubyte*)"glMinmax");
+  glMinmax(target, internalformat, sink);
+}
+
+static void GLAPIENTRY _glewLazy_glResetHistogram (GLenum target)
+{
+  glResetHistogram = (PFNGLRESETHISTOGRAMPROC)glewGetProcAddress((const GLubyte*)"glResetHistogram");
+  glResetHistogram(target);
+}
+
+static void GLAPIENTRY _glewLazy_glResetMinmax (GLenum target)
+{
+  glResetMinmax = (PFNGLRESETMINMAXPROC)glewGetProcAddress((const GLubyte*)"glResetMinmax");
+  glResetMinmax(target);
+}
+
+static void GLAPIENTRY _glewLazy_glSeparableFilter2D (GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *row, const void *column)
+{
+  glSeparableFilter2D = (PFNGLSEPARABLEFILTER2DPROC)glewGetProcAddress((const GLubyte*)"glSeparableFilter2D");
+  glSeparableFilter2D(target, internalformat, width, height, format, type, row, column);
+}
+
+
+static void GLAPIENTRY _glewLazy_glMultiDrawArraysIndirectCountARB (GLenum mode, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride)
+{
+  glMultiDrawArraysIndirectCountARB = (PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawArraysIndirectCountARB");
+  glMultiDrawArraysIndirectCountARB(mode, indirect, drawcount, maxdrawcount, stride);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiDrawElementsIndirectCountARB (GLenum mode, GLenum type, const void *indirect, GLintptr drawcount, GLsizei maxdrawcount, GLsizei stride)
+{
+  glMultiDrawElementsIndirectCountARB = (PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawElementsIndirectCountARB");
+  glMultiDrawElementsIndirectCountARB(mode, type, indirect, drawcount, maxdrawcount, stride);
+}
+
+
+static void GLAPIENTRY _glewLazy_glDrawArraysInstancedARB (GLenum mode, GLint first, GLsizei count, GLsizei primcount)
+{
+  glDrawArraysInstancedARB = (PFNGLDRAWARRAYSINSTANCEDARBPROC)glewGetProcAddress((const GLubyte*)"glDrawArraysInstancedARB");
+  glDrawArraysInstancedARB(mode, first, count, primcount);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawElementsInstancedARB (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei primcount)
+{
+  glDrawElementsInstancedARB = (PFNGLDRAWELEMENTSINSTANCEDARBPROC)glewGetProcAddress((const GLubyte*)"glDrawElementsInstancedARB");
+  glDrawElementsInstancedARB(mode, count, type, indices, primcount);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribDivisorARB (GLuint index, GLuint divisor)
+{
+  glVertexAttribDivisorARB = (PFNGLVERTEXATTRIBDIVISORARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribDivisorARB");
+  glVertexAttribDivisorARB(index, divisor);
+}
+
+
+static void GLAPIENTRY _glewLazy_glGetInternalformativ (GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint* params)
+{
+  glGetInternalformativ = (PFNGLGETINTERNALFORMATIVPROC)glewGetProcAddress((const GLubyte*)"glGetInternalformativ");
+  glGetInternalformativ(target, internalformat, pname, bufSize, params);
+}
+
+
+static void GLAPIENTRY _glewLazy_glGetInternalformati64v (GLenum target, GLenum internalformat, GLenum pname, GLsizei bufSize, GLint64* params)
+{
+  glGetInternalformati64v = (PFNGLGETINTERNALFORMATI64VPROC)glewGetProcAddress((const GLubyte*)"glGetInternalformati64v");
+  glGetInternalformati64v(target, internalformat, pname, bufSize, params);
+}
+
+
+static void GLAPIENTRY _glewLazy_glInvalidateBufferData (GLuint buffer)
+{
+  glInvalidateBufferData = (PFNGLINVALIDATEBUFFERDATAPROC)glewGetProcAddress((const GLubyte*)"glInvalidateBufferData");
+  glInvalidateBufferData(buffer);
+}
+
+static void GLAPIENTRY _glewLazy_glInvalidateBufferSubData (GLuint buffer, GLintptr offset, GLsizeiptr length)
+{
+  glInvalidateBufferSubData = (PFNGLINVALIDATEBUFFERSUBDATAPROC)glewGetProcAddress((const GLubyte*)"glInvalidateBufferSubData");
+  glInvalidateBufferSubData(buffer, offset, length);
+}
+
+static void GLAPIENTRY _glewLazy_glInvalidateFramebuffer (GLenum target, GLsizei numAttachments, const GLenum* attachments)
+{
+  glInvalidateFramebuffer = (PFNGLINVALIDATEFRAMEBUFFERPROC)glewGetProcAddress((const GLubyte*)"glInvalidateFramebuffer");
+  glInvalidateFramebuffer(target, numAttachments, attachments);
+}
+
+static void GLAPIENTRY _glewLazy_glInvalidateSubFramebuffer (GLenum target, GLsizei numAttachments, const GLenum* attachments, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+  glInvalidateSubFramebuffer = (PFNGLINVALIDATESUBFRAMEBUFFERPROC)glewGetProcAddress((const GLubyte*)"glInvalidateSubFramebuffer");
+  glInvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
+}
+
+static void GLAPIENTRY _glewLazy_glInvalidateTexImage (GLuint texture, GLint level)
+{
+  glInvalidateTexImage = (PFNGLINVALIDATETEXIMAGEPROC)glewGetProcAddress((const GLubyte*)"glInvalidateTexImage");
+  glInvalidateTexImage(texture, level);
+}
+
+static void GLAPIENTRY _glewLazy_glInvalidateTexSubImage (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth)
+{
+  glInvalidateTexSubImage = (PFNGLINVALIDATETEXSUBIMAGEPROC)glewGetProcAddress((const GLubyte*)"glInvalidateTexSubImage");
+  glInvalidateTexSubImage(texture, level, xoffset, yoffset, zoffset, width, height, depth);
+}
+
+
+static void GLAPIENTRY _glewLazy_glFlushMappedBufferRange (GLenum target, GLintptr offset, GLsizeiptr length)
+{
+  glFlushMappedBufferRange = (PFNGLFLUSHMAPPEDBUFFERRANGEPROC)glewGetProcAddress((const GLubyte*)"glFlushMappedBufferRange");
+  glFlushMappedBufferRange(target, offset, length);
+}
+
+static void * GLAPIENTRY _glewLazy_glMapBufferRange (GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+  glMapBufferRange = (PFNGLMAPBUFFERRANGEPROC)glewGetProcAddress((const GLubyte*)"glMapBufferRange");
+  return glMapBufferRange(target, offset, length, access);
+}
+
+
+static void GLAPIENTRY _glewLazy_glCurrentPaletteMatrixARB (GLint index)
+{
+  glCurrentPaletteMatrixARB = (PFNGLCURRENTPALETTEMATRIXARBPROC)glewGetProcAddress((const GLubyte*)"glCurrentPaletteMatrixARB");
+  glCurrentPaletteMatrixARB(index);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixIndexPointerARB (GLint size, GLenum type, GLsizei stride, void *pointer)
+{
+  glMatrixIndexPointerARB = (PFNGLMATRIXINDEXPOINTERARBPROC)glewGetProcAddress((const GLubyte*)"glMatrixIndexPointerARB");
+  glMatrixIndexPointerARB(size, type, stride, pointer);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixIndexubvARB (GLint size, GLubyte *indices)
+{
+  glMatrixIndexubvARB = (PFNGLMATRIXINDEXUBVARBPROC)glewGetProcAddress((const GLubyte*)"glMatrixIndexubvARB");
+  glMatrixIndexubvARB(size, indices);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixIndexuivARB (GLint size, GLuint *indices)
+{
+  glMatrixIndexuivARB = (PFNGLMATRIXINDEXUIVARBPROC)glewGetProcAddress((const GLubyte*)"glMatrixIndexuivARB");
+  glMatrixIndexuivARB(size, indices);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixIndexusvARB (GLint size, GLushort *indices)
+{
+  glMatrixIndexusvARB = (PFNGLMATRIXINDEXUSVARBPROC)glewGetProcAddress((const GLubyte*)"glMatrixIndexusvARB");
+  glMatrixIndexusvARB(size, indices);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBindBuffersBase (GLenum target, GLuint first, GLsizei count, const GLuint* buffers)
+{
+  glBindBuffersBase = (PFNGLBINDBUFFERSBASEPROC)glewGetProcAddress((const GLubyte*)"glBindBuffersBase");
+  glBindBuffersBase(target, first, count, buffers);
+}
+
+static void GLAPIENTRY _glewLazy_glBindBuffersRange (GLenum target, GLuint first, GLsizei count, const GLuint* buffers, const GLintptr *offsets, const GLsizeiptr *sizes)
+{
+  glBindBuffersRange = (PFNGLBINDBUFFERSRANGEPROC)glewGetProcAddress((const GLubyte*)"glBindBuffersRange");
+  glBindBuffersRange(target, first, count, buffers, offsets, sizes);
+}
+
+static void GLAPIENTRY _glewLazy_glBindImageTextures (GLuint first, GLsizei count, const GLuint* textures)
+{
+  glBindImageTextures = (PFNGLBINDIMAGETEXTURESPROC)glewGetProcAddress((const GLubyte*)"glBindImageTextures");
+  glBindImageTextures(first, count, textures);
+}
+
+static void GLAPIENTRY _glewLazy_glBindSamplers (GLuint first, GLsizei count, const GLuint* samplers)
+{
+  glBindSamplers = (PFNGLBINDSAMPLERSPROC)glewGetProcAddress((const GLubyte*)"glBindSamplers");
+  glBindSamplers(first, count, samplers);
+}
+
+static void GLAPIENTRY _glewLazy_glBindTextures (GLuint first, GLsizei count, const GLuint* textures)
+{
+  glBindTextures = (PFNGLBINDTEXTURESPROC)glewGetProcAddress((const GLubyte*)"glBindTextures");
+  glBindTextures(first, count, textures);
+}
+
+static void GLAPIENTRY _glewLazy_glBindVertexBuffers (GLuint first, GLsizei count, const GLuint* buffers, const GLintptr *offsets, const GLsizei *strides)
+{
+  glBindVertexBuffers = (PFNGLBINDVERTEXBUFFERSPROC)glewGetProcAddress((const GLubyte*)"glBindVertexBuffers");
+  glBindVertexBuffers(first, count, buffers, offsets, strides);
+}
+
+
+static void GLAPIENTRY _glewLazy_glMultiDrawArraysIndirect (GLenum mode, const void *indirect, GLsizei primcount, GLsizei stride)
+{
+  glMultiDrawArraysIndirect = (PFNGLMULTIDRAWARRAYSINDIRECTPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawArraysIndirect");
+  glMultiDrawArraysIndirect(mode, indirect, primcount, stride);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiDrawElementsIndirect (GLenum mode, GLenum type, const void *indirect, GLsizei primcount, GLsizei stride)
+{
+  glMultiDrawElementsIndirect = (PFNGLMULTIDRAWELEMENTSINDIRECTPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawElementsIndirect");
+  glMultiDrawElementsIndirect(mode, type, indirect, primcount, stride);
+}
+
+
+static void GLAPIENTRY _glewLazy_glSampleCoverageARB (GLclampf value, GLboolean invert)
+{
+  glSampleCoverageARB = (PFNGLSAMPLECOVERAGEARBPROC)glewGetProcAddress((const GLubyte*)"glSampleCoverageARB");
+  glSampleCoverageARB(value, invert);
+}
+
+
+static void GLAPIENTRY _glewLazy_glActiveTextureARB (GLenum texture)
+{
+  glActiveTextureARB = (PFNGLACTIVETEXTUREARBPROC)glewGetProcAddress((const GLubyte*)"glActiveTextureARB");
+  glActiveTextureARB(texture);
+}
+
+static void GLAPIENTRY _glewLazy_glClientActiveTextureARB (GLenum texture)
+{
+  glClientActiveTextureARB = (PFNGLCLIENTACTIVETEXTUREARBPROC)glewGetProcAddress((const GLubyte*)"glClientActiveTextureARB");
+  glClientActiveTextureARB(texture);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1dARB (GLenum target, GLdouble s)
+{
+  glMultiTexCoord1dARB = (PFNGLMULTITEXCOORD1DARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1dARB");
+  glMultiTexCoord1dARB(target, s);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1dvARB (GLenum target, const GLdouble *v)
+{
+  glMultiTexCoord1dvARB = (PFNGLMULTITEXCOORD1DVARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1dvARB");
+  glMultiTexCoord1dvARB(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1fARB (GLenum target, GLfloat s)
+{
+  glMultiTexCoord1fARB = (PFNGLMULTITEXCOORD1FARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1fARB");
+  glMultiTexCoord1fARB(target, s);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1fvARB (GLenum target, const GLfloat *v)
+{
+  glMultiTexCoord1fvARB = (PFNGLMULTITEXCOORD1FVARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1fvARB");
+  glMultiTexCoord1fvARB(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1iARB (GLenum target, GLint s)
+{
+  glMultiTexCoord1iARB = (PFNGLMULTITEXCOORD1IARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1iARB");
+  glMultiTexCoord1iARB(target, s);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1ivARB (GLenum target, const GLint *v)
+{
+  glMultiTexCoord1ivARB = (PFNGLMULTITEXCOORD1IVARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1ivARB");
+  glMultiTexCoord1ivARB(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1sARB (GLenum target, GLshort s)
+{
+  glMultiTexCoord1sARB = (PFNGLMULTITEXCOORD1SARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1sARB");
+  glMultiTexCoord1sARB(target, s);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1svARB (GLenum target, const GLshort *v)
+{
+  glMultiTexCoord1svARB = (PFNGLMULTITEXCOORD1SVARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1svARB");
+  glMultiTexCoord1svARB(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2dARB (GLenum target, GLdouble s, GLdouble t)
+{
+  glMultiTexCoord2dARB = (PFNGLMULTITEXCOORD2DARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2dARB");
+  glMultiTexCoord2dARB(target, s, t);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2dvARB (GLenum target, const GLdouble *v)
+{
+  glMultiTexCoord2dvARB = (PFNGLMULTITEXCOORD2DVARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2dvARB");
+  glMultiTexCoord2dvARB(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2fARB (GLenum target, GLfloat s, GLfloat t)
+{
+  glMultiTexCoord2fARB = (PFNGLMULTITEXCOORD2FARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2fARB");
+  glMultiTexCoord2fARB(target, s, t);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2fvARB (GLenum target, const GLfloat *v)
+{
+  glMultiTexCoord2fvARB = (PFNGLMULTITEXCOORD2FVARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2fvARB");
+  glMultiTexCoord2fvARB(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2iARB (GLenum target, GLint s, GLint t)
+{
+  glMultiTexCoord2iARB = (PFNGLMULTITEXCOORD2IARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2iARB");
+  glMultiTexCoord2iARB(target, s, t);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2ivARB (GLenum target, const GLint *v)
+{
+  glMultiTexCoord2ivARB = (PFNGLMULTITEXCOORD2IVARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2ivARB");
+  glMultiTexCoord2ivARB(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2sARB (GLenum target, GLshort s, GLshort t)
+{
+  glMultiTexCoord2sARB = (PFNGLMULTITEXCOORD2SARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2sARB");
+  glMultiTexCoord2sARB(target, s, t);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2svARB (GLenum target, const GLshort *v)
+{
+  glMultiTexCoord2svARB = (PFNGLMULTITEXCOORD2SVARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2svARB");
+  glMultiTexCoord2svARB(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3dARB (GLenum target, GLdouble s, GLdouble t, GLdouble r)
+{
+  glMultiTexCoord3dARB = (PFNGLMULTITEXCOORD3DARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3dARB");
+  glMultiTexCoord3dARB(target, s, t, r);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3dvARB (GLenum target, const GLdouble *v)
+{
+  glMultiTexCoord3dvARB = (PFNGLMULTITEXCOORD3DVARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3dvARB");
+  glMultiTexCoord3dvARB(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3fARB (GLenum target, GLfloat s, GLfloat t, GLfloat r)
+{
+  glMultiTexCoord3fARB = (PFNGLMULTITEXCOORD3FARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3fARB");
+  glMultiTexCoord3fARB(target, s, t, r);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3fvARB (GLenum target, const GLfloat *v)
+{
+  glMultiTexCoord3fvARB = (PFNGLMULTITEXCOORD3FVARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3fvARB");
+  glMultiTexCoord3fvARB(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3iARB (GLenum target, GLint s, GLint t, GLint r)
+{
+  glMultiTexCoord3iARB = (PFNGLMULTITEXCOORD3IARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3iARB");
+  glMultiTexCoord3iARB(target, s, t, r);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3ivARB (GLenum target, const GLint *v)
+{
+  glMultiTexCoord3ivARB = (PFNGLMULTITEXCOORD3IVARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3ivARB");
+  glMultiTexCoord3ivARB(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3sARB (GLenum target, GLshort s, GLshort t, GLshort r)
+{
+  glMultiTexCoord3sARB = (PFNGLMULTITEXCOORD3SARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3sARB");
+  glMultiTexCoord3sARB(target, s, t, r);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3svARB (GLenum target, const GLshort *v)
+{
+  glMultiTexCoord3svARB = (PFNGLMULTITEXCOORD3SVARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3svARB");
+  glMultiTexCoord3svARB(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4dARB (GLenum target, GLdouble s, GLdouble t, GLdouble r, GLdouble q)
+{
+  glMultiTexCoord4dARB = (PFNGLMULTITEXCOORD4DARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4dARB");
+  glMultiTexCoord4dARB(target, s, t, r, q);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4dvARB (GLenum target, const GLdouble *v)
+{
+  glMultiTexCoord4dvARB = (PFNGLMULTITEXCOORD4DVARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4dvARB");
+  glMultiTexCoord4dvARB(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4fARB (GLenum target, GLfloat s, GLfloat t, GLfloat r, GLfloat q)
+{
+  glMultiTexCoord4fARB = (PFNGLMULTITEXCOORD4FARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4fARB");
+  glMultiTexCoord4fARB(target, s, t, r, q);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4fvARB (GLenum target, const GLfloat *v)
+{
+  glMultiTexCoord4fvARB = (PFNGLMULTITEXCOORD4FVARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4fvARB");
+  glMultiTexCoord4fvARB(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4iARB (GLenum target, GLint s, GLint t, GLint r, GLint q)
+{
+  glMultiTexCoord4iARB = (PFNGLMULTITEXCOORD4IARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4iARB");
+  glMultiTexCoord4iARB(target, s, t, r, q);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4ivARB (GLenum target, const GLint *v)
+{
+  glMultiTexCoord4ivARB = (PFNGLMULTITEXCOORD4IVARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4ivARB");
+  glMultiTexCoord4ivARB(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4sARB (GLenum target, GLshort s, GLshort t, GLshort r, GLshort q)
+{
+  glMultiTexCoord4sARB = (PFNGLMULTITEXCOORD4SARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4sARB");
+  glMultiTexCoord4sARB(target, s, t, r, q);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4svARB (GLenum target, const GLshort *v)
+{
+  glMultiTexCoord4svARB = (PFNGLMULTITEXCOORD4SVARBPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4svARB");
+  glMultiTexCoord4svARB(target, v);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBeginQueryARB (GLenum target, GLuint id)
+{
+  glBeginQueryARB = (PFNGLBEGINQUERYARBPROC)glewGetProcAddress((const GLubyte*)"glBeginQueryARB");
+  glBeginQueryARB(target, id);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteQueriesARB (GLsizei n, const GLuint* ids)
+{
+  glDeleteQueriesARB = (PFNGLDELETEQUERIESARBPROC)glewGetProcAddress((const GLubyte*)"glDeleteQueriesARB");
+  glDeleteQueriesARB(n, ids);
+}
+
+static void GLAPIENTRY _glewLazy_glEndQueryARB (GLenum target)
+{
+  glEndQueryARB = (PFNGLENDQUERYARBPROC)glewGetProcAddress((const GLubyte*)"glEndQueryARB");
+  glEndQueryARB(target);
+}
+
+static void GLAPIENTRY _glewLazy_glGenQueriesARB (GLsizei n, GLuint* ids)
+{
+  glGenQueriesARB = (PFNGLGENQUERIESARBPROC)glewGetProcAddress((const GLubyte*)"glGenQueriesARB");
+  glGenQueriesARB(n, ids);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryObjectivARB (GLuint id, GLenum pname, GLint* params)
+{
+  glGetQueryObjectivARB = (PFNGLGETQUERYOBJECTIVARBPROC)glewGetProcAddress((const GLubyte*)"glGetQueryObjectivARB");
+  glGetQueryObjectivARB(id, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryObjectuivARB (GLuint id, GLenum pname, GLuint* params)
+{
+  glGetQueryObjectuivARB = (PFNGLGETQUERYOBJECTUIVARBPROC)glewGetProcAddress((const GLubyte*)"glGetQueryObjectuivARB");
+  glGetQueryObjectuivARB(id, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryivARB (GLenum target, GLenum pname, GLint* params)
+{
+  glGetQueryivARB = (PFNGLGETQUERYIVARBPROC)glewGetProcAddress((const GLubyte*)"glGetQueryivARB");
+  glGetQueryivARB(target, pname, params);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsQueryARB (GLuint id)
+{
+  glIsQueryARB = (PFNGLISQUERYARBPROC)glewGetProcAddress((const GLubyte*)"glIsQueryARB");
+  return glIsQueryARB(id);
+}
+
+
+static void GLAPIENTRY _glewLazy_glPointParameterfARB (GLenum pname, GLfloat param)
+{
+  glPointParameterfARB = (PFNGLPOINTPARAMETERFARBPROC)glewGetProcAddress((const GLubyte*)"glPointParameterfARB");
+  glPointParameterfARB(pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glPointParameterfvARB (GLenum pname, const GLfloat* params)
+{
+  glPointParameterfvARB = (PFNGLPOINTPARAMETERFVARBPROC)glewGetProcAddress((const GLubyte*)"glPointParameterfvARB");
+  glPointParameterfvARB(pname, params);
+}
+
+
+static void GLAPIENTRY _glewLazy_glGetProgramInterfaceiv (GLuint program, GLenum programInterface, GLenum pname, GLint* params)
+{
+  glGetProgramInterfaceiv = (PFNGLGETPROGRAMINTERFACEIVPROC)glewGetProcAddress((const GLubyte*)"glGetProgramInterfaceiv");
+  glGetProgramInterfaceiv(program, programInterface, pname, params);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glGetProgramResourceIndex (GLuint program, GLenum programInterface, const GLchar* name)
+{
+  glGetProgramResourceIndex = (PFNGLGETPROGRAMRESOURCEINDEXPROC)glewGetProcAddress((const GLubyte*)"glGetProgramResourceIndex");
+  return glGetProgramResourceIndex(program, programInterface, name);
+}
+
+static GLint GLAPIENTRY _glewLazy_glGetProgramResourceLocation (GLuint program, GLenum programInterface, const GLchar* name)
+{
+  glGetProgramResourceLocation = (PFNGLGETPROGRAMRESOURCELOCATIONPROC)glewGetProcAddress((const GLubyte*)"glGetProgramResourceLocation");
+  return glGetProgramResourceLocation(program, programInterface, name);
+}
+
+static GLint GLAPIENTRY _glewLazy_glGetProgramResourceLocationIndex (GLuint program, GLenum programInterface, const GLchar* name)
+{
+  glGetProgramResourceLocationIndex = (PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC)glewGetProcAddress((const GLubyte*)"glGetProgramResourceLocationIndex");
+  return glGetProgramResourceLocationIndex(program, programInterface, name);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramResourceName (GLuint program, GLenum programInterface, GLuint index, GLsizei bufSize, GLsizei* length, GLchar *name)
+{
+  glGetProgramResourceName = (PFNGLGETPROGRAMRESOURCENAMEPROC)glewGetProcAddress((const GLubyte*)"glGetProgramResourceName");
+  glGetProgramResourceName(program, programInterface, index, bufSize, length, name);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramResourceiv (GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum* props, GLsizei bufSize, GLsizei *length, GLint *params)
+{
+  glGetProgramResourceiv = (PFNGLGETPROGRAMRESOURCEIVPROC)glewGetProcAddress((const GLubyte*)"glGetProgramResourceiv");
+  glGetProgramResourceiv(program, programInterface, index, propCount, props, bufSize, length, params);
+}
+
+
+static void GLAPIENTRY _glewLazy_glProvokingVertex (GLenum mode)
+{
+  glProvokingVertex = (PFNGLPROVOKINGVERTEXPROC)glewGetProcAddress((const GLubyte*)"glProvokingVertex");
+  glProvokingVertex(mode);
+}
+
+
+static GLenum GLAPIENTRY _glewLazy_glGetGraphicsResetStatusARB (void)
+{
+  glGetGraphicsResetStatusARB = (PFNGLGETGRAPHICSRESETSTATUSARBPROC)glewGetProcAddress((const GLubyte*)"glGetGraphicsResetStatusARB");
+  return glGetGraphicsResetStatusARB();
+}
+
+static void GLAPIENTRY _glewLazy_glGetnColorTableARB (GLenum target, GLenum format, GLenum type, GLsizei bufSize, void* table)
+{
+  glGetnColorTableARB = (PFNGLGETNCOLORTABLEARBPROC)glewGetProcAddress((const GLubyte*)"glGetnColorTableARB");
+  glGetnColorTableARB(target, format, type, bufSize, table);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnCompressedTexImageARB (GLenum target, GLint lod, GLsizei bufSize, void* img)
+{
+  glGetnCompressedTexImageARB = (PFNGLGETNCOMPRESSEDTEXIMAGEARBPROC)glewGetProcAddress((const GLubyte*)"glGetnCompressedTexImageARB");
+  glGetnCompressedTexImageARB(target, lod, bufSize, img);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnConvolutionFilterARB (GLenum target, GLenum format, GLenum type, GLsizei bufSize, void* image)
+{
+  glGetnConvolutionFilterARB = (PFNGLGETNCONVOLUTIONFILTERARBPROC)glewGetProcAddress((const GLubyte*)"glGetnConvolutionFilterARB");
+  glGetnConvolutionFilterARB(target, format, type, bufSize, image);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnHistogramARB (GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void* values)
+{
+  glGetnHistogramARB = (PFNGLGETNHISTOGRAMARBPROC)glewGetProcAddress((const GLubyte*)"glGetnHistogramARB");
+  glGetnHistogramARB(target, reset, format, type, bufSize, values);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnMapdvARB (GLenum target, GLenum query, GLsizei bufSize, GLdouble* v)
+{
+  glGetnMapdvARB = (PFNGLGETNMAPDVARBPROC)glewGetProcAddress((const GLubyte*)"glGetnMapdvARB");
+  glGetnMapdvARB(target, query, bufSize, v);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnMapfvARB (GLenum target, GLenum query, GLsizei bufSize, GLfloat* v)
+{
+  glGetnMapfvARB = (PFNGLGETNMAPFVARBPROC)glewGetProcAddress((const GLubyte*)"glGetnMapfvARB");
+  glGetnMapfvARB(target, query, bufSize, v);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnMapivARB (GLenum target, GLenum query, GLsizei bufSize, GLint* v)
+{
+  glGetnMapivARB = (PFNGLGETNMAPIVARBPROC)glewGetProcAddress((const GLubyte*)"glGetnMapivARB");
+  glGetnMapivARB(target, query, bufSize, v);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnMinmaxARB (GLenum target, GLboolean reset, GLenum format, GLenum type, GLsizei bufSize, void* values)
+{
+  glGetnMinmaxARB = (PFNGLGETNMINMAXARBPROC)glewGetProcAddress((const GLubyte*)"glGetnMinmaxARB");
+  glGetnMinmaxARB(target, reset, format, type, bufSize, values);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnPixelMapfvARB (GLenum map, GLsizei bufSize, GLfloat* values)
+{
+  glGetnPixelMapfvARB = (PFNGLGETNPIXELMAPFVARBPROC)glewGetProcAddress((const GLubyte*)"glGetnPixelMapfvARB");
+  glGetnPixelMapfvARB(map, bufSize, values);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnPixelMapuivARB (GLenum map, GLsizei bufSize, GLuint* values)
+{
+  glGetnPixelMapuivARB = (PFNGLGETNPIXELMAPUIVARBPROC)glewGetProcAddress((const GLubyte*)"glGetnPixelMapuivARB");
+  glGetnPixelMapuivARB(map, bufSize, values);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnPixelMapusvARB (GLenum map, GLsizei bufSize, GLushort* values)
+{
+  glGetnPixelMapusvARB = (PFNGLGETNPIXELMAPUSVARBPROC)glewGetProcAddress((const GLubyte*)"glGetnPixelMapusvARB");
+  glGetnPixelMapusvARB(map, bufSize, values);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnPolygonStippleARB (GLsizei bufSize, GLubyte* pattern)
+{
+  glGetnPolygonStippleARB = (PFNGLGETNPOLYGONSTIPPLEARBPROC)glewGetProcAddress((const GLubyte*)"glGetnPolygonStippleARB");
+  glGetnPolygonStippleARB(bufSize, pattern);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnSeparableFilterARB (GLenum target, GLenum format, GLenum type, GLsizei rowBufSize, void* row, GLsizei columnBufSize, void*column, void*span)
+{
+  glGetnSeparableFilterARB = (PFNGLGETNSEPARABLEFILTERARBPROC)glewGetProcAddress((const GLubyte*)"glGetnSeparableFilterARB");
+  glGetnSeparableFilterARB(target, format, type, rowBufSize, row, columnBufSize, column, span);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnTexImageARB (GLenum target, GLint level, GLenum format, GLenum type, GLsizei bufSize, void* img)
+{
+  glGetnTexImageARB = (PFNGLGETNTEXIMAGEARBPROC)glewGetProcAddress((const GLubyte*)"glGetnTexImageARB");
+  glGetnTexImageARB(target, level, format, type, bufSize, img);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnUniformdvARB (GLuint program, GLint location, GLsizei bufSize, GLdouble* params)
+{
+  glGetnUniformdvARB = (PFNGLGETNUNIFORMDVARBPROC)glewGetProcAddress((const GLubyte*)"glGetnUniformdvARB");
+  glGetnUniformdvARB(program, location, bufSize, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnUniformfvARB (GLuint program, GLint location, GLsizei bufSize, GLfloat* params)
+{
+  glGetnUniformfvARB = (PFNGLGETNUNIFORMFVARBPROC)glewGetProcAddress((const GLubyte*)"glGetnUniformfvARB");
+  glGetnUniformfvARB(program, location, bufSize, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnUniformivARB (GLuint program, GLint location, GLsizei bufSize, GLint* params)
+{
+  glGetnUniformivARB = (PFNGLGETNUNIFORMIVARBPROC)glewGetProcAddress((const GLubyte*)"glGetnUniformivARB");
+  glGetnUniformivARB(program, location, bufSize, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnUniformuivARB (GLuint program, GLint location, GLsizei bufSize, GLuint* params)
+{
+  glGetnUniformuivARB = (PFNGLGETNUNIFORMUIVARBPROC)glewGetProcAddress((const GLubyte*)"glGetnUniformuivARB");
+  glGetnUniformuivARB(program, location, bufSize, params);
+}
+
+static void GLAPIENTRY _glewLazy_glReadnPixelsARB (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void* data)
+{
+  glReadnPixelsARB = (PFNGLREADNPIXELSARBPROC)glewGetProcAddress((const GLubyte*)"glReadnPixelsARB");
+  glReadnPixelsARB(x, y, width, height, format, type, bufSize, data);
+}
+
+
+static void GLAPIENTRY _glewLazy_glMinSampleShadingARB (GLclampf value)
+{
+  glMinSampleShadingARB = (PFNGLMINSAMPLESHADINGARBPROC)glewGetProcAddress((const GLubyte*)"glMinSampleShadingARB");
+  glMinSampleShadingARB(value);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBindSampler (GLuint unit, GLuint sampler)
+{
+  glBindSampler = (PFNGLBINDSAMPLERPROC)glewGetProcAddress((const GLubyte*)"glBindSampler");
+  glBindSampler(unit, sampler);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteSamplers (GLsizei count, const GLuint * samplers)
+{
+  glDeleteSamplers = (PFNGLDELETESAMPLERSPROC)glewGetProcAddress((const GLubyte*)"glDeleteSamplers");
+  glDeleteSamplers(count, samplers);
+}
+
+static void GLAPIENTRY _glewLazy_glGenSamplers (GLsizei count, GLuint* samplers)
+{
+  glGenSamplers = (PFNGLGENSAMPLERSPROC)glewGetProcAddress((const GLubyte*)"glGenSamplers");
+  glGenSamplers(count, samplers);
+}
+
+static void GLAPIENTRY _glewLazy_glGetSamplerParameterIiv (GLuint sampler, GLenum pname, GLint* params)
+{
+  glGetSamplerParameterIiv = (PFNGLGETSAMPLERPARAMETERIIVPROC)glewGetProcAddress((const GLubyte*)"glGetSamplerParameterIiv");
+  glGetSamplerParameterIiv(sampler, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetSamplerParameterIuiv (GLuint sampler, GLenum pname, GLuint* params)
+{
+  glGetSamplerParameterIuiv = (PFNGLGETSAMPLERPARAMETERIUIVPROC)glewGetProcAddress((const GLubyte*)"glGetSamplerParameterIuiv");
+  glGetSamplerParameterIuiv(sampler, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetSamplerParameterfv (GLuint sampler, GLenum pname, GLfloat* params)
+{
+  glGetSamplerParameterfv = (PFNGLGETSAMPLERPARAMETERFVPROC)glewGetProcAddress((const GLubyte*)"glGetSamplerParameterfv");
+  glGetSamplerParameterfv(sampler, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetSamplerParameteriv (GLuint sampler, GLenum pname, GLint* params)
+{
+  glGetSamplerParameteriv = (PFNGLGETSAMPLERPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glGetSamplerParameteriv");
+  glGetSamplerParameteriv(sampler, pname, params);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsSampler (GLuint sampler)
+{
+  glIsSampler = (PFNGLISSAMPLERPROC)glewGetProcAddress((const GLubyte*)"glIsSampler");
+  return glIsSampler(sampler);
+}
+
+static void GLAPIENTRY _glewLazy_glSamplerParameterIiv (GLuint sampler, GLenum pname, const GLint* params)
+{
+  glSamplerParameterIiv = (PFNGLSAMPLERPARAMETERIIVPROC)glewGetProcAddress((const GLubyte*)"glSamplerParameterIiv");
+  glSamplerParameterIiv(sampler, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glSamplerParameterIuiv (GLuint sampler, GLenum pname, const GLuint* params)
+{
+  glSamplerParameterIuiv = (PFNGLSAMPLERPARAMETERIUIVPROC)glewGetProcAddress((const GLubyte*)"glSamplerParameterIuiv");
+  glSamplerParameterIuiv(sampler, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glSamplerParameterf (GLuint sampler, GLenum pname, GLfloat param)
+{
+  glSamplerParameterf = (PFNGLSAMPLERPARAMETERFPROC)glewGetProcAddress((const GLubyte*)"glSamplerParameterf");
+  glSamplerParameterf(sampler, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glSamplerParameterfv (GLuint sampler, GLenum pname, const GLfloat* params)
+{
+  glSamplerParameterfv = (PFNGLSAMPLERPARAMETERFVPROC)glewGetProcAddress((const GLubyte*)"glSamplerParameterfv");
+  glSamplerParameterfv(sampler, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glSamplerParameteri (GLuint sampler, GLenum pname, GLint param)
+{
+  glSamplerParameteri = (PFNGLSAMPLERPARAMETERIPROC)glewGetProcAddress((const GLubyte*)"glSamplerParameteri");
+  glSamplerParameteri(sampler, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glSamplerParameteriv (GLuint sampler, GLenum pname, const GLint* params)
+{
+  glSamplerParameteriv = (PFNGLSAMPLERPARAMETERIVPROC)glewGetProcAddress((const GLubyte*)"glSamplerParameteriv");
+  glSamplerParameteriv(sampler, pname, params);
+}
+
+
+static void GLAPIENTRY _glewLazy_glActiveShaderProgram (GLuint pipeline, GLuint program)
+{
+  glActiveShaderProgram = (PFNGLACTIVESHADERPROGRAMPROC)glewGetProcAddress((const GLubyte*)"glActiveShaderProgram");
+  glActiveShaderProgram(pipeline, program);
+}
+
+static void GLAPIENTRY _glewLazy_glBindProgramPipeline (GLuint pipeline)
+{
+  glBindProgramPipeline = (PFNGLBINDPROGRAMPIPELINEPROC)glewGetProcAddress((const GLubyte*)"glBindProgramPipeline");
+  glBindProgramPipeline(pipeline);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glCreateShaderProgramv (GLenum type, GLsizei count, const GLchar * const * strings)
+{
+  glCreateShaderProgramv = (PFNGLCREATESHADERPROGRAMVPROC)glewGetProcAddress((const GLubyte*)"glCreateShaderProgramv");
+  return glCreateShaderProgramv(type, count, strings);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteProgramPipelines (GLsizei n, const GLuint* pipelines)
+{
+  glDeleteProgramPipelines = (PFNGLDELETEPROGRAMPIPELINESPROC)glewGetProcAddress((const GLubyte*)"glDeleteProgramPipelines");
+  glDeleteProgramPipelines(n, pipelines);
+}
+
+static void GLAPIENTRY _glewLazy_glGenProgramPipelines (GLsizei n, GLuint* pipelines)
+{
+  glGenProgramPipelines = (PFNGLGENPROGRAMPIPELINESPROC)glewGetProcAddress((const GLubyte*)"glGenProgramPipelines");
+  glGenProgramPipelines(n, pipelines);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramPipelineInfoLog (GLuint pipeline, GLsizei bufSize, GLsizei* length, GLchar *infoLog)
+{
+  glGetProgramPipelineInfoLog = (PFNGLGETPROGRAMPIPELINEINFOLOGPROC)glewGetProcAddress((const GLubyte*)"glGetProgramPipelineInfoLog");
+  glGetProgramPipelineInfoLog(pipeline, bufSize, length, infoLog);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramPipelineiv (GLuint pipeline, GLenum pname, GLint* params)
+{
+  glGetProgramPipelineiv = (PFNGLGETPROGRAMPIPELINEIVPROC)glewGetProcAddress((const GLubyte*)"glGetProgramPipelineiv");
+  glGetProgramPipelineiv(pipeline, pname, params);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsProgramPipeline (GLuint pipeline)
+{
+  glIsProgramPipeline = (PFNGLISPROGRAMPIPELINEPROC)glewGetProcAddress((const GLubyte*)"glIsProgramPipeline");
+  return glIsProgramPipeline(pipeline);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1d (GLuint program, GLint location, GLdouble x)
+{
+  glProgramUniform1d = (PFNGLPROGRAMUNIFORM1DPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1d");
+  glProgramUniform1d(program, location, x);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1dv (GLuint program, GLint location, GLsizei count, const GLdouble* value)
+{
+  glProgramUniform1dv = (PFNGLPROGRAMUNIFORM1DVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1dv");
+  glProgramUniform1dv(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1f (GLuint program, GLint location, GLfloat x)
+{
+  glProgramUniform1f = (PFNGLPROGRAMUNIFORM1FPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1f");
+  glProgramUniform1f(program, location, x);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1fv (GLuint program, GLint location, GLsizei count, const GLfloat* value)
+{
+  glProgramUniform1fv = (PFNGLPROGRAMUNIFORM1FVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1fv");
+  glProgramUniform1fv(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1i (GLuint program, GLint location, GLint x)
+{
+  glProgramUniform1i = (PFNGLPROGRAMUNIFORM1IPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1i");
+  glProgramUniform1i(program, location, x);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1iv (GLuint program, GLint location, GLsizei count, const GLint* value)
+{
+  glProgramUniform1iv = (PFNGLPROGRAMUNIFORM1IVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1iv");
+  glProgramUniform1iv(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1ui (GLuint program, GLint location, GLuint x)
+{
+  glProgramUniform1ui = (PFNGLPROGRAMUNIFORM1UIPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1ui");
+  glProgramUniform1ui(program, location, x);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1uiv (GLuint program, GLint location, GLsizei count, const GLuint* value)
+{
+  glProgramUniform1uiv = (PFNGLPROGRAMUNIFORM1UIVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1uiv");
+  glProgramUniform1uiv(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2d (GLuint program, GLint location, GLdouble x, GLdouble y)
+{
+  glProgramUniform2d = (PFNGLPROGRAMUNIFORM2DPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2d");
+  glProgramUniform2d(program, location, x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2dv (GLuint program, GLint location, GLsizei count, const GLdouble* value)
+{
+  glProgramUniform2dv = (PFNGLPROGRAMUNIFORM2DVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2dv");
+  glProgramUniform2dv(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2f (GLuint program, GLint location, GLfloat x, GLfloat y)
+{
+  glProgramUniform2f = (PFNGLPROGRAMUNIFORM2FPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2f");
+  glProgramUniform2f(program, location, x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2fv (GLuint program, GLint location, GLsizei count, const GLfloat* value)
+{
+  glProgramUniform2fv = (PFNGLPROGRAMUNIFORM2FVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2fv");
+  glProgramUniform2fv(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2i (GLuint program, GLint location, GLint x, GLint y)
+{
+  glProgramUniform2i = (PFNGLPROGRAMUNIFORM2IPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2i");
+  glProgramUniform2i(program, location, x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2iv (GLuint program, GLint location, GLsizei count, const GLint* value)
+{
+  glProgramUniform2iv = (PFNGLPROGRAMUNIFORM2IVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2iv");
+  glProgramUniform2iv(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2ui (GLuint program, GLint location, GLuint x, GLuint y)
+{
+  glProgramUniform2ui = (PFNGLPROGRAMUNIFORM2UIPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2ui");
+  glProgramUniform2ui(program, location, x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2uiv (GLuint program, GLint location, GLsizei count, const GLuint* value)
+{
+  glProgramUniform2uiv = (PFNGLPROGRAMUNIFORM2UIVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2uiv");
+  glProgramUniform2uiv(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3d (GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z)
+{
+  glProgramUniform3d = (PFNGLPROGRAMUNIFORM3DPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3d");
+  glProgramUniform3d(program, location, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3dv (GLuint program, GLint location, GLsizei count, const GLdouble* value)
+{
+  glProgramUniform3dv = (PFNGLPROGRAMUNIFORM3DVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3dv");
+  glProgramUniform3dv(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3f (GLuint program, GLint location, GLfloat x, GLfloat y, GLfloat z)
+{
+  glProgramUniform3f = (PFNGLPROGRAMUNIFORM3FPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3f");
+  glProgramUniform3f(program, location, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3fv (GLuint program, GLint location, GLsizei count, const GLfloat* value)
+{
+  glProgramUniform3fv = (PFNGLPROGRAMUNIFORM3FVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3fv");
+  glProgramUniform3fv(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3i (GLuint program, GLint location, GLint x, GLint y, GLint z)
+{
+  glProgramUniform3i = (PFNGLPROGRAMUNIFORM3IPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3i");
+  glProgramUniform3i(program, location, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3iv (GLuint program, GLint location, GLsizei count, const GLint* value)
+{
+  glProgramUniform3iv = (PFNGLPROGRAMUNIFORM3IVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3iv");
+  glProgramUniform3iv(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3ui (GLuint program, GLint location, GLuint x, GLuint y, GLuint z)
+{
+  glProgramUniform3ui = (PFNGLPROGRAMUNIFORM3UIPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3ui");
+  glProgramUniform3ui(program, location, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3uiv (GLuint program, GLint location, GLsizei count, const GLuint* value)
+{
+  glProgramUniform3uiv = (PFNGLPROGRAMUNIFORM3UIVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3uiv");
+  glProgramUniform3uiv(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4d (GLuint program, GLint location, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+  glProgramUniform4d = (PFNGLPROGRAMUNIFORM4DPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4d");
+  glProgramUniform4d(program, location, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4dv (GLuint program, GLint location, GLsizei count, const GLdouble* value)
+{
+  glProgramUniform4dv = (PFNGLPROGRAMUNIFORM4DVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4dv");
+  glProgramUniform4dv(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4f (GLuint program, GLint location, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+  glProgramUniform4f = (PFNGLPROGRAMUNIFORM4FPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4f");
+  glProgramUniform4f(program, location, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4fv (GLuint program, GLint location, GLsizei count, const GLfloat* value)
+{
+  glProgramUniform4fv = (PFNGLPROGRAMUNIFORM4FVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4fv");
+  glProgramUniform4fv(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4i (GLuint program, GLint location, GLint x, GLint y, GLint z, GLint w)
+{
+  glProgramUniform4i = (PFNGLPROGRAMUNIFORM4IPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4i");
+  glProgramUniform4i(program, location, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4iv (GLuint program, GLint location, GLsizei count, const GLint* value)
+{
+  glProgramUniform4iv = (PFNGLPROGRAMUNIFORM4IVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4iv");
+  glProgramUniform4iv(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4ui (GLuint program, GLint location, GLuint x, GLuint y, GLuint z, GLuint w)
+{
+  glProgramUniform4ui = (PFNGLPROGRAMUNIFORM4UIPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4ui");
+  glProgramUniform4ui(program, location, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4uiv (GLuint program, GLint location, GLsizei count, const GLuint* value)
+{
+  glProgramUniform4uiv = (PFNGLPROGRAMUNIFORM4UIVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4uiv");
+  glProgramUniform4uiv(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix2dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value)
+{
+  glProgramUniformMatrix2dv = (PFNGLPROGRAMUNIFORMMATRIX2DVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix2dv");
+  glProgramUniformMatrix2dv(program, location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix2fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+  glProgramUniformMatrix2fv = (PFNGLPROGRAMUNIFORMMATRIX2FVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix2fv");
+  glProgramUniformMatrix2fv(program, location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix2x3dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value)
+{
+  glProgramUniformMatrix2x3dv = (PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix2x3dv");
+  glProgramUniformMatrix2x3dv(program, location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix2x3fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+  glProgramUniformMatrix2x3fv = (PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix2x3fv");
+  glProgramUniformMatrix2x3fv(program, location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix2x4dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value)
+{
+  glProgramUniformMatrix2x4dv = (PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix2x4dv");
+  glProgramUniformMatrix2x4dv(program, location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix2x4fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+  glProgramUniformMatrix2x4fv = (PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix2x4fv");
+  glProgramUniformMatrix2x4fv(program, location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix3dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value)
+{
+  glProgramUniformMatrix3dv = (PFNGLPROGRAMUNIFORMMATRIX3DVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix3dv");
+  glProgramUniformMatrix3dv(program, location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix3fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+  glProgramUniformMatrix3fv = (PFNGLPROGRAMUNIFORMMATRIX3FVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix3fv");
+  glProgramUniformMatrix3fv(program, location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix3x2dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value)
+{
+  glProgramUniformMatrix3x2dv = (PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix3x2dv");
+  glProgramUniformMatrix3x2dv(program, location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix3x2fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+  glProgramUniformMatrix3x2fv = (PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix3x2fv");
+  glProgramUniformMatrix3x2fv(program, location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix3x4dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value)
+{
+  glProgramUniformMatrix3x4dv = (PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix3x4dv");
+  glProgramUniformMatrix3x4dv(program, location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix3x4fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+  glProgramUniformMatrix3x4fv = (PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix3x4fv");
+  glProgramUniformMatrix3x4fv(program, location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix4dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value)
+{
+  glProgramUniformMatrix4dv = (PFNGLPROGRAMUNIFORMMATRIX4DVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix4dv");
+  glProgramUniformMatrix4dv(program, location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix4fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+  glProgramUniformMatrix4fv = (PFNGLPROGRAMUNIFORMMATRIX4FVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix4fv");
+  glProgramUniformMatrix4fv(program, location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix4x2dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value)
+{
+  glProgramUniformMatrix4x2dv = (PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix4x2dv");
+  glProgramUniformMatrix4x2dv(program, location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix4x2fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+  glProgramUniformMatrix4x2fv = (PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix4x2fv");
+  glProgramUniformMatrix4x2fv(program, location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix4x3dv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLdouble* value)
+{
+  glProgramUniformMatrix4x3dv = (PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix4x3dv");
+  glProgramUniformMatrix4x3dv(program, location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix4x3fv (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+  glProgramUniformMatrix4x3fv = (PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix4x3fv");
+  glProgramUniformMatrix4x3fv(program, location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUseProgramStages (GLuint pipeline, GLbitfield stages, GLuint program)
+{
+  glUseProgramStages = (PFNGLUSEPROGRAMSTAGESPROC)glewGetProcAddress((const GLubyte*)"glUseProgramStages");
+  glUseProgramStages(pipeline, stages, program);
+}
+
+static void GLAPIENTRY _glewLazy_glValidateProgramPipeline (GLuint pipeline)
+{
+  glValidateProgramPipeline = (PFNGLVALIDATEPROGRAMPIPELINEPROC)glewGetProcAddress((const GLubyte*)"glValidateProgramPipeline");
+  glValidateProgramPipeline(pipeline);
+}
+
+
+static void GLAPIENTRY _glewLazy_glGetActiveAtomicCounterBufferiv (GLuint program, GLuint bufferIndex, GLenum pname, GLint* params)
+{
+  glGetActiveAtomicCounterBufferiv = (PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC)glewGetProcAddress((const GLubyte*)"glGetActiveAtomicCounterBufferiv");
+  glGetActiveAtomicCounterBufferiv(program, bufferIndex, pname, params);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBindImageTexture (GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format)
+{
+  glBindImageTexture = (PFNGLBINDIMAGETEXTUREPROC)glewGetProcAddress((const GLubyte*)"glBindImageTexture");
+  glBindImageTexture(unit, texture, level, layered, layer, access, format);
+}
+
+static void GLAPIENTRY _glewLazy_glMemoryBarrier (GLbitfield barriers)
+{
+  glMemoryBarrier = (PFNGLMEMORYBARRIERPROC)glewGetProcAddress((const GLubyte*)"glMemoryBarrier");
+  glMemoryBarrier(barriers);
+}
+
+
+static void GLAPIENTRY _glewLazy_glAttachObjectARB (GLhandleARB containerObj, GLhandleARB obj)
+{
+  glAttachObjectARB = (PFNGLATTACHOBJECTARBPROC)glewGetProcAddress((const GLubyte*)"glAttachObjectARB");
+  glAttachObjectARB(containerObj, obj);
+}
+
+static void GLAPIENTRY _glewLazy_glCompileShaderARB (GLhandleARB shaderObj)
+{
+  glCompileShaderARB = (PFNGLCOMPILESHADERARBPROC)glewGetProcAddress((const GLubyte*)"glCompileShaderARB");
+  glCompileShaderARB(shaderObj);
+}
+
+static GLhandleARB GLAPIENTRY _glewLazy_glCreateProgramObjectARB (void)
+{
+  glCreateProgramObjectARB = (PFNGLCREATEPROGRAMOBJECTARBPROC)glewGetProcAddress((const GLubyte*)"glCreateProgramObjectARB");
+  return glCreateProgramObjectARB();
+}
+
+static GLhandleARB GLAPIENTRY _glewLazy_glCreateShaderObjectARB (GLenum shaderType)
+{
+  glCreateShaderObjectARB = (PFNGLCREATESHADEROBJECTARBPROC)glewGetProcAddress((const GLubyte*)"glCreateShaderObjectARB");
+  return glCreateShaderObjectARB(shaderType);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteObjectARB (GLhandleARB obj)
+{
+  glDeleteObjectARB = (PFNGLDELETEOBJECTARBPROC)glewGetProcAddress((const GLubyte*)"glDeleteObjectARB");
+  glDeleteObjectARB(obj);
+}
+
+static void GLAPIENTRY _glewLazy_glDetachObjectARB (GLhandleARB containerObj, GLhandleARB attachedObj)
+{
+  glDetachObjectARB = (PFNGLDETACHOBJECTARBPROC)glewGetProcAddress((const GLubyte*)"glDetachObjectARB");
+  glDetachObjectARB(containerObj, attachedObj);
+}
+
+static void GLAPIENTRY _glewLazy_glGetActiveUniformARB (GLhandleARB programObj, GLuint index, GLsizei maxLength, GLsizei* length, GLint *size, GLenum *type, GLcharARB *name)
+{
+  glGetActiveUniformARB = (PFNGLGETACTIVEUNIFORMARBPROC)glewGetProcAddress((const GLubyte*)"glGetActiveUniformARB");
+  glGetActiveUniformARB(programObj, index, maxLength, length, size, type, name);
+}
+
+static void GLAPIENTRY _glewLazy_glGetAttachedObjectsARB (GLhandleARB containerObj, GLsizei maxCount, GLsizei* count, GLhandleARB *obj)
+{
+  glGetAttachedObjectsARB = (PFNGLGETATTACHEDOBJECTSARBPROC)glewGetProcAddress((const GLubyte*)"glGetAttachedObjectsARB");
+  glGetAttachedObjectsARB(containerObj, maxCount, count, obj);
+}
+
+static GLhandleARB GLAPIENTRY _glewLazy_glGetHandleARB (GLenum pname)
+{
+  glGetHandleARB = (PFNGLGETHANDLEARBPROC)glewGetProcAddress((const GLubyte*)"glGetHandleARB");
+  return glGetHandleARB(pname);
+}
+
+static void GLAPIENTRY _glewLazy_glGetInfoLogARB (GLhandleARB obj, GLsizei maxLength, GLsizei* length, GLcharARB *infoLog)
+{
+  glGetInfoLogARB = (PFNGLGETINFOLOGARBPROC)glewGetProcAddress((const GLubyte*)"glGetInfoLogARB");
+  glGetInfoLogARB(obj, maxLength, length, infoLog);
+}
+
+static void GLAPIENTRY _glewLazy_glGetObjectParameterfvARB (GLhandleARB obj, GLenum pname, GLfloat* params)
+{
+  glGetObjectParameterfvARB = (PFNGLGETOBJECTPARAMETERFVARBPROC)glewGetProcAddress((const GLubyte*)"glGetObjectParameterfvARB");
+  glGetObjectParameterfvARB(obj, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetObjectParameterivARB (GLhandleARB obj, GLenum pname, GLint* params)
+{
+  glGetObjectParameterivARB = (PFNGLGETOBJECTPARAMETERIVARBPROC)glewGetProcAddress((const GLubyte*)"glGetObjectParameterivARB");
+  glGetObjectParameterivARB(obj, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetShaderSourceARB (GLhandleARB obj, GLsizei maxLength, GLsizei* length, GLcharARB *source)
+{
+  glGetShaderSourceARB = (PFNGLGETSHADERSOURCEARBPROC)glewGetProcAddress((const GLubyte*)"glGetShaderSourceARB");
+  glGetShaderSourceARB(obj, maxLength, length, source);
+}
+
+static GLint GLAPIENTRY _glewLazy_glGetUniformLocationARB (GLhandleARB programObj, const GLcharARB* name)
+{
+  glGetUniformLocationARB = (PFNGLGETUNIFORMLOCATIONARBPROC)glewGetProcAddress((const GLubyte*)"glGetUniformLocationARB");
+  return glGetUniformLocationARB(programObj, name);
+}
+
+static void GLAPIENTRY _glewLazy_glGetUniformfvARB (GLhandleARB programObj, GLint location, GLfloat* params)
+{
+  glGetUniformfvARB = (PFNGLGETUNIFORMFVARBPROC)glewGetProcAddress((const GLubyte*)"glGetUniformfvARB");
+  glGetUniformfvARB(programObj, location, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetUniformivARB (GLhandleARB programObj, GLint location, GLint* params)
+{
+  glGetUniformivARB = (PFNGLGETUNIFORMIVARBPROC)glewGetProcAddress((const GLubyte*)"glGetUniformivARB");
+  glGetUniformivARB(programObj, location, params);
+}
+
+static void GLAPIENTRY _glewLazy_glLinkProgramARB (GLhandleARB programObj)
+{
+  glLinkProgramARB = (PFNGLLINKPROGRAMARBPROC)glewGetProcAddress((const GLubyte*)"glLinkProgramARB");
+  glLinkProgramARB(programObj);
+}
+
+static void GLAPIENTRY _glewLazy_glShaderSourceARB (GLhandleARB shaderObj, GLsizei count, const GLcharARB ** string, const GLint *length)
+{
+  glShaderSourceARB = (PFNGLSHADERSOURCEARBPROC)glewGetProcAddress((const GLubyte*)"glShaderSourceARB");
+  glShaderSourceARB(shaderObj, count, string, length);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1fARB (GLint location, GLfloat v0)
+{
+  glUniform1fARB = (PFNGLUNIFORM1FARBPROC)glewGetProcAddress((const GLubyte*)"glUniform1fARB");
+  glUniform1fARB(location, v0);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1fvARB (GLint location, GLsizei count, const GLfloat* value)
+{
+  glUniform1fvARB = (PFNGLUNIFORM1FVARBPROC)glewGetProcAddress((const GLubyte*)"glUniform1fvARB");
+  glUniform1fvARB(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1iARB (GLint location, GLint v0)
+{
+  glUniform1iARB = (PFNGLUNIFORM1IARBPROC)glewGetProcAddress((const GLubyte*)"glUniform1iARB");
+  glUniform1iARB(location, v0);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1ivARB (GLint location, GLsizei count, const GLint* value)
+{
+  glUniform1ivARB = (PFNGLUNIFORM1IVARBPROC)glewGetProcAddress((const GLubyte*)"glUniform1ivARB");
+  glUniform1ivARB(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2fARB (GLint location, GLfloat v0, GLfloat v1)
+{
+  glUniform2fARB = (PFNGLUNIFORM2FARBPROC)glewGetProcAddress((const GLubyte*)"glUniform2fARB");
+  glUniform2fARB(location, v0, v1);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2fvARB (GLint location, GLsizei count, const GLfloat* value)
+{
+  glUniform2fvARB = (PFNGLUNIFORM2FVARBPROC)glewGetProcAddress((const GLubyte*)"glUniform2fvARB");
+  glUniform2fvARB(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2iARB (GLint location, GLint v0, GLint v1)
+{
+  glUniform2iARB = (PFNGLUNIFORM2IARBPROC)glewGetProcAddress((const GLubyte*)"glUniform2iARB");
+  glUniform2iARB(location, v0, v1);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2ivARB (GLint location, GLsizei count, const GLint* value)
+{
+  glUniform2ivARB = (PFNGLUNIFORM2IVARBPROC)glewGetProcAddress((const GLubyte*)"glUniform2ivARB");
+  glUniform2ivARB(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3fARB (GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+  glUniform3fARB = (PFNGLUNIFORM3FARBPROC)glewGetProcAddress((const GLubyte*)"glUniform3fARB");
+  glUniform3fARB(location, v0, v1, v2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3fvARB (GLint location, GLsizei count, const GLfloat* value)
+{
+  glUniform3fvARB = (PFNGLUNIFORM3FVARBPROC)glewGetProcAddress((const GLubyte*)"glUniform3fvARB");
+  glUniform3fvARB(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3iARB (GLint location, GLint v0, GLint v1, GLint v2)
+{
+  glUniform3iARB = (PFNGLUNIFORM3IARBPROC)glewGetProcAddress((const GLubyte*)"glUniform3iARB");
+  glUniform3iARB(location, v0, v1, v2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3ivARB (GLint location, GLsizei count, const GLint* value)
+{
+  glUniform3ivARB = (PFNGLUNIFORM3IVARBPROC)glewGetProcAddress((const GLubyte*)"glUniform3ivARB");
+  glUniform3ivARB(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4fARB (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+  glUniform4fARB = (PFNGLUNIFORM4FARBPROC)glewGetProcAddress((const GLubyte*)"glUniform4fARB");
+  glUniform4fARB(location, v0, v1, v2, v3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4fvARB (GLint location, GLsizei count, const GLfloat* value)
+{
+  glUniform4fvARB = (PFNGLUNIFORM4FVARBPROC)glewGetProcAddress((const GLubyte*)"glUniform4fvARB");
+  glUniform4fvARB(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4iARB (GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+  glUniform4iARB = (PFNGLUNIFORM4IARBPROC)glewGetProcAddress((const GLubyte*)"glUniform4iARB");
+  glUniform4iARB(location, v0, v1, v2, v3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4ivARB (GLint location, GLsizei count, const GLint* value)
+{
+  glUniform4ivARB = (PFNGLUNIFORM4IVARBPROC)glewGetProcAddress((const GLubyte*)"glUniform4ivARB");
+  glUniform4ivARB(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix2fvARB (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+  glUniformMatrix2fvARB = (PFNGLUNIFORMMATRIX2FVARBPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix2fvARB");
+  glUniformMatrix2fvARB(location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix3fvARB (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+  glUniformMatrix3fvARB = (PFNGLUNIFORMMATRIX3FVARBPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix3fvARB");
+  glUniformMatrix3fvARB(location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformMatrix4fvARB (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+  glUniformMatrix4fvARB = (PFNGLUNIFORMMATRIX4FVARBPROC)glewGetProcAddress((const GLubyte*)"glUniformMatrix4fvARB");
+  glUniformMatrix4fvARB(location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUseProgramObjectARB (GLhandleARB programObj)
+{
+  glUseProgramObjectARB = (PFNGLUSEPROGRAMOBJECTARBPROC)glewGetProcAddress((const GLubyte*)"glUseProgramObjectARB");
+  glUseProgramObjectARB(programObj);
+}
+
+static void GLAPIENTRY _glewLazy_glValidateProgramARB (GLhandleARB programObj)
+{
+  glValidateProgramARB = (PFNGLVALIDATEPROGRAMARBPROC)glewGetProcAddress((const GLubyte*)"glValidateProgramARB");
+  glValidateProgramARB(programObj);
+}
+
+
+static void GLAPIENTRY _glewLazy_glShaderStorageBlockBinding (GLuint program, GLuint storageBlockIndex, GLuint storageBlockBinding)
+{
+  glShaderStorageBlockBinding = (PFNGLSHADERSTORAGEBLOCKBINDINGPROC)glewGetProcAddress((const GLubyte*)"glShaderStorageBlockBinding");
+  glShaderStorageBlockBinding(program, storageBlockIndex, storageBlockBinding);
+}
+
+
+static void GLAPIENTRY _glewLazy_glGetActiveSubroutineName (GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei* length, GLchar *name)
+{
+  glGetActiveSubroutineName = (PFNGLGETACTIVESUBROUTINENAMEPROC)glewGetProcAddress((const GLubyte*)"glGetActiveSubroutineName");
+  glGetActiveSubroutineName(program, shadertype, index, bufsize, length, name);
+}
+
+static void GLAPIENTRY _glewLazy_glGetActiveSubroutineUniformName (GLuint program, GLenum shadertype, GLuint index, GLsizei bufsize, GLsizei* length, GLchar *name)
+{
+  glGetActiveSubroutineUniformName = (PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC)glewGetProcAddress((const GLubyte*)"glGetActiveSubroutineUniformName");
+  glGetActiveSubroutineUniformName(program, shadertype, index, bufsize, length, name);
+}
+
+static void GLAPIENTRY _glewLazy_glGetActiveSubroutineUniformiv (GLuint program, GLenum shadertype, GLuint index, GLenum pname, GLint* values)
+{
+  glGetActiveSubroutineUniformiv = (PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC)glewGetProcAddress((const GLubyte*)"glGetActiveSubroutineUniformiv");
+  glGetActiveSubroutineUniformiv(program, shadertype, index, pname, values);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramStageiv (GLuint program, GLenum shadertype, GLenum pname, GLint* values)
+{
+  glGetProgramStageiv = (PFNGLGETPROGRAMSTAGEIVPROC)glewGetProcAddress((const GLubyte*)"glGetProgramStageiv");
+  glGetProgramStageiv(program, shadertype, pname, values);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glGetSubroutineIndex (GLuint program, GLenum shadertype, const GLchar* name)
+{
+  glGetSubroutineIndex = (PFNGLGETSUBROUTINEINDEXPROC)glewGetProcAddress((const GLubyte*)"glGetSubroutineIndex");
+  return glGetSubroutineIndex(program, shadertype, name);
+}
+
+static GLint GLAPIENTRY _glewLazy_glGetSubroutineUniformLocation (GLuint program, GLenum shadertype, const GLchar* name)
+{
+  glGetSubroutineUniformLocation = (PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC)glewGetProcAddress((const GLubyte*)"glGetSubroutineUniformLocation");
+  return glGetSubroutineUniformLocation(program, shadertype, name);
+}
+
+static void GLAPIENTRY _glewLazy_glGetUniformSubroutineuiv (GLenum shadertype, GLint location, GLuint* params)
+{
+  glGetUniformSubroutineuiv = (PFNGLGETUNIFORMSUBROUTINEUIVPROC)glewGetProcAddress((const GLubyte*)"glGetUniformSubroutineuiv");
+  glGetUniformSubroutineuiv(shadertype, location, params);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformSubroutinesuiv (GLenum shadertype, GLsizei count, const GLuint* indices)
+{
+  glUniformSubroutinesuiv = (PFNGLUNIFORMSUBROUTINESUIVPROC)glewGetProcAddress((const GLubyte*)"glUniformSubroutinesuiv");
+  glUniformSubroutinesuiv(shadertype, count, indices);
+}
+
+
+static void GLAPIENTRY _glewLazy_glCompileShaderIncludeARB (GLuint shader, GLsizei count, const GLchar* const *path, const GLint *length)
+{
+  glCompileShaderIncludeARB = (PFNGLCOMPILESHADERINCLUDEARBPROC)glewGetProcAddress((const GLubyte*)"glCompileShaderIncludeARB");
+  glCompileShaderIncludeARB(shader, count, path, length);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteNamedStringARB (GLint namelen, const GLchar* name)
+{
+  glDeleteNamedStringARB = (PFNGLDELETENAMEDSTRINGARBPROC)glewGetProcAddress((const GLubyte*)"glDeleteNamedStringARB");
+  glDeleteNamedStringARB(namelen, name);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedStringARB (GLint namelen, const GLchar* name, GLsizei bufSize, GLint *stringlen, GLchar *string)
+{
+  glGetNamedStringARB = (PFNGLGETNAMEDSTRINGARBPROC)glewGetProcAddress((const GLubyte*)"glGetNamedStringARB");
+  glGetNamedStringARB(namelen, name, bufSize, stringlen, string);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedStringivARB (GLint namelen, const GLchar* name, GLenum pname, GLint *params)
+{
+  glGetNamedStringivARB = (PFNGLGETNAMEDSTRINGIVARBPROC)glewGetProcAddress((const GLubyte*)"glGetNamedStringivARB");
+  glGetNamedStringivARB(namelen, name, pname, params);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsNamedStringARB (GLint namelen, const GLchar* name)
+{
+  glIsNamedStringARB = (PFNGLISNAMEDSTRINGARBPROC)glewGetProcAddress((const GLubyte*)"glIsNamedStringARB");
+  return glIsNamedStringARB(namelen, name);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedStringARB (GLenum type, GLint namelen, const GLchar* name, GLint stringlen, const GLchar *string)
+{
+  glNamedStringARB = (PFNGLNAMEDSTRINGARBPROC)glewGetProcAddress((const GLubyte*)"glNamedStringARB");
+  glNamedStringARB(type, namelen, name, stringlen, string);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBufferPageCommitmentARB (GLenum target, GLintptr offset, GLsizeiptr size, GLboolean commit)
+{
+  glBufferPageCommitmentARB = (PFNGLBUFFERPAGECOMMITMENTARBPROC)glewGetProcAddress((const GLubyte*)"glBufferPageCommitmentARB");
+  glBufferPageCommitmentARB(target, offset, size, commit);
+}
+
+
+static void GLAPIENTRY _glewLazy_glTexPageCommitmentARB (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLboolean commit)
+{
+  glTexPageCommitmentARB = (PFNGLTEXPAGECOMMITMENTARBPROC)glewGetProcAddress((const GLubyte*)"glTexPageCommitmentARB");
+  glTexPageCommitmentARB(target, level, xoffset, yoffset, zoffset, width, height, depth, commit);
+}
+
+static void GLAPIENTRY _glewLazy_glTexturePageCommitmentEXT (GLuint texture, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLboolean commit)
+{
+  glTexturePageCommitmentEXT = (PFNGLTEXTUREPAGECOMMITMENTEXTPROC)glewGetProcAddress((const GLubyte*)"glTexturePageCommitmentEXT");
+  glTexturePageCommitmentEXT(texture, level, xoffset, yoffset, zoffset, width, height, depth, commit);
+}
+
+
+static GLenum GLAPIENTRY _glewLazy_glClientWaitSync (GLsync GLsync, GLbitfield flags, GLuint64 timeout)
+{
+  glClientWaitSync = (PFNGLCLIENTWAITSYNCPROC)glewGetProcAddress((const GLubyte*)"glClientWaitSync");
+  return glClientWaitSync(GLsync, flags, timeout);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteSync (GLsync GLsync)
+{
+  glDeleteSync = (PFNGLDELETESYNCPROC)glewGetProcAddress((const GLubyte*)"glDeleteSync");
+  glDeleteSync(GLsync);
+}
+
+static GLsync GLAPIENTRY _glewLazy_glFenceSync (GLenum condition, GLbitfield flags)
+{
+  glFenceSync = (PFNGLFENCESYNCPROC)glewGetProcAddress((const GLubyte*)"glFenceSync");
+  return glFenceSync(condition, flags);
+}
+
+static void GLAPIENTRY _glewLazy_glGetInteger64v (GLenum pname, GLint64* params)
+{
+  glGetInteger64v = (PFNGLGETINTEGER64VPROC)glewGetProcAddress((const GLubyte*)"glGetInteger64v");
+  glGetInteger64v(pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetSynciv (GLsync GLsync, GLenum pname, GLsizei bufSize, GLsizei* length, GLint *values)
+{
+  glGetSynciv = (PFNGLGETSYNCIVPROC)glewGetProcAddress((const GLubyte*)"glGetSynciv");
+  glGetSynciv(GLsync, pname, bufSize, length, values);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsSync (GLsync GLsync)
+{
+  glIsSync = (PFNGLISSYNCPROC)glewGetProcAddress((const GLubyte*)"glIsSync");
+  return glIsSync(GLsync);
+}
+
+static void GLAPIENTRY _glewLazy_glWaitSync (GLsync GLsync, GLbitfield flags, GLuint64 timeout)
+{
+  glWaitSync = (PFNGLWAITSYNCPROC)glewGetProcAddress((const GLubyte*)"glWaitSync");
+  glWaitSync(GLsync, flags, timeout);
+}
+
+
+static void GLAPIENTRY _glewLazy_glPatchParameterfv (GLenum pname, const GLfloat* values)
+{
+  glPatchParameterfv = (PFNGLPATCHPARAMETERFVPROC)glewGetProcAddress((const GLubyte*)"glPatchParameterfv");
+  glPatchParameterfv(pname, values);
+}
+
+static void GLAPIENTRY _glewLazy_glPatchParameteri (GLenum pname, GLint value)
+{
+  glPatchParameteri = (PFNGLPATCHPARAMETERIPROC)glewGetProcAddress((const GLubyte*)"glPatchParameteri");
+  glPatchParameteri(pname, value);
+}
+
+
+static void GLAPIENTRY _glewLazy_glTextureBarrier (void)
+{
+  glTextureBarrier = (PFNGLTEXTUREBARRIERPROC)glewGetProcAddress((const GLubyte*)"glTextureBarrier");
+  glTextureBarrier();
+}
+
+
+static void GLAPIENTRY _glewLazy_glTexBufferARB (GLenum target, GLenum internalformat, GLuint buffer)
+{
+  glTexBufferARB = (PFNGLTEXBUFFERARBPROC)glewGetProcAddress((const GLubyte*)"glTexBufferARB");
+  glTexBufferARB(target, internalformat, buffer);
+}
+
+
+static void GLAPIENTRY _glewLazy_glTexBufferRange (GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+  glTexBufferRange = (PFNGLTEXBUFFERRANGEPROC)glewGetProcAddress((const GLubyte*)"glTexBufferRange");
+  glTexBufferRange(target, internalformat, buffer, offset, size);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureBufferRangeEXT (GLuint texture, GLenum target, GLenum internalformat, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+  glTextureBufferRangeEXT = (PFNGLTEXTUREBUFFERRANGEEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureBufferRangeEXT");
+  glTextureBufferRangeEXT(texture, target, internalformat, buffer, offset, size);
+}
+
+
+static void GLAPIENTRY _glewLazy_glCompressedTexImage1DARB (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data)
+{
+  glCompressedTexImage1DARB = (PFNGLCOMPRESSEDTEXIMAGE1DARBPROC)glewGetProcAddress((const GLubyte*)"glCompressedTexImage1DARB");
+  glCompressedTexImage1DARB(target, level, internalformat, width, border, imageSize, data);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTexImage2DARB (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data)
+{
+  glCompressedTexImage2DARB = (PFNGLCOMPRESSEDTEXIMAGE2DARBPROC)glewGetProcAddress((const GLubyte*)"glCompressedTexImage2DARB");
+  glCompressedTexImage2DARB(target, level, internalformat, width, height, border, imageSize, data);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTexImage3DARB (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data)
+{
+  glCompressedTexImage3DARB = (PFNGLCOMPRESSEDTEXIMAGE3DARBPROC)glewGetProcAddress((const GLubyte*)"glCompressedTexImage3DARB");
+  glCompressedTexImage3DARB(target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTexSubImage1DARB (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data)
+{
+  glCompressedTexSubImage1DARB = (PFNGLCOMPRESSEDTEXSUBIMAGE1DARBPROC)glewGetProcAddress((const GLubyte*)"glCompressedTexSubImage1DARB");
+  glCompressedTexSubImage1DARB(target, level, xoffset, width, format, imageSize, data);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTexSubImage2DARB (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data)
+{
+  glCompressedTexSubImage2DARB = (PFNGLCOMPRESSEDTEXSUBIMAGE2DARBPROC)glewGetProcAddress((const GLubyte*)"glCompressedTexSubImage2DARB");
+  glCompressedTexSubImage2DARB(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTexSubImage3DARB (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data)
+{
+  glCompressedTexSubImage3DARB = (PFNGLCOMPRESSEDTEXSUBIMAGE3DARBPROC)glewGetProcAddress((const GLubyte*)"glCompressedTexSubImage3DARB");
+  glCompressedTexSubImage3DARB(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+
+static void GLAPIENTRY _glewLazy_glGetCompressedTexImageARB (GLenum target, GLint lod, void *img)
+{
+  glGetCompressedTexImageARB = (PFNGLGETCOMPRESSEDTEXIMAGEARBPROC)glewGetProcAddress((const GLubyte*)"glGetCompressedTexImageARB");
+  glGetCompressedTexImageARB(target, lod, img);
+}
+
+
+static void GLAPIENTRY _glewLazy_glGetMultisamplefv (GLenum pname, GLuint index, GLfloat* val)
+{
+  glGetMultisamplefv = (PFNGLGETMULTISAMPLEFVPROC)glewGetProcAddress((const GLubyte*)"glGetMultisamplefv");
+  glGetMultisamplefv(pname, index, val);
+}
+
+static void GLAPIENTRY _glewLazy_glSampleMaski (GLuint index, GLbitfield mask)
+{
+  glSampleMaski = (PFNGLSAMPLEMASKIPROC)glewGetProcAddress((const GLubyte*)"glSampleMaski");
+  glSampleMaski(index, mask);
+}
+
+static void GLAPIENTRY _glewLazy_glTexImage2DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+  glTexImage2DMultisample = (PFNGLTEXIMAGE2DMULTISAMPLEPROC)glewGetProcAddress((const GLubyte*)"glTexImage2DMultisample");
+  glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+
+static void GLAPIENTRY _glewLazy_glTexImage3DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+  glTexImage3DMultisample = (PFNGLTEXIMAGE3DMULTISAMPLEPROC)glewGetProcAddress((const GLubyte*)"glTexImage3DMultisample");
+  glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+
+
+static void GLAPIENTRY _glewLazy_glTexStorage1D (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width)
+{
+  glTexStorage1D = (PFNGLTEXSTORAGE1DPROC)glewGetProcAddress((const GLubyte*)"glTexStorage1D");
+  glTexStorage1D(target, levels, internalformat, width);
+}
+
+static void GLAPIENTRY _glewLazy_glTexStorage2D (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+{
+  glTexStorage2D = (PFNGLTEXSTORAGE2DPROC)glewGetProcAddress((const GLubyte*)"glTexStorage2D");
+  glTexStorage2D(target, levels, internalformat, width, height);
+}
+
+static void GLAPIENTRY _glewLazy_glTexStorage3D (GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+{
+  glTexStorage3D = (PFNGLTEXSTORAGE3DPROC)glewGetProcAddress((const GLubyte*)"glTexStorage3D");
+  glTexStorage3D(target, levels, internalformat, width, height, depth);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureStorage1DEXT (GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width)
+{
+  glTextureStorage1DEXT = (PFNGLTEXTURESTORAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureStorage1DEXT");
+  glTextureStorage1DEXT(texture, target, levels, internalformat, width);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureStorage2DEXT (GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height)
+{
+  glTextureStorage2DEXT = (PFNGLTEXTURESTORAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureStorage2DEXT");
+  glTextureStorage2DEXT(texture, target, levels, internalformat, width, height);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureStorage3DEXT (GLuint texture, GLenum target, GLsizei levels, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth)
+{
+  glTextureStorage3DEXT = (PFNGLTEXTURESTORAGE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureStorage3DEXT");
+  glTextureStorage3DEXT(texture, target, levels, internalformat, width, height, depth);
+}
+
+
+static void GLAPIENTRY _glewLazy_glTexStorage2DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+  glTexStorage2DMultisample = (PFNGLTEXSTORAGE2DMULTISAMPLEPROC)glewGetProcAddress((const GLubyte*)"glTexStorage2DMultisample");
+  glTexStorage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+}
+
+static void GLAPIENTRY _glewLazy_glTexStorage3DMultisample (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+  glTexStorage3DMultisample = (PFNGLTEXSTORAGE3DMULTISAMPLEPROC)glewGetProcAddress((const GLubyte*)"glTexStorage3DMultisample");
+  glTexStorage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureStorage2DMultisampleEXT (GLuint texture, GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations)
+{
+  glTextureStorage2DMultisampleEXT = (PFNGLTEXTURESTORAGE2DMULTISAMPLEEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureStorage2DMultisampleEXT");
+  glTextureStorage2DMultisampleEXT(texture, target, samples, internalformat, width, height, fixedsamplelocations);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureStorage3DMultisampleEXT (GLuint texture, GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations)
+{
+  glTextureStorage3DMultisampleEXT = (PFNGLTEXTURESTORAGE3DMULTISAMPLEEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureStorage3DMultisampleEXT");
+  glTextureStorage3DMultisampleEXT(texture, target, samples, internalformat, width, height, depth, fixedsamplelocations);
+}
+
+
+static void GLAPIENTRY _glewLazy_glTextureView (GLuint texture, GLenum target, GLuint origtexture, GLenum internalformat, GLuint minlevel, GLuint numlevels, GLuint minlayer, GLuint numlayers)
+{
+  glTextureView = (PFNGLTEXTUREVIEWPROC)glewGetProcAddress((const GLubyte*)"glTextureView");
+  glTextureView(texture, target, origtexture, internalformat, minlevel, numlevels, minlayer, numlayers);
+}
+
+
+static void GLAPIENTRY _glewLazy_glGetQueryObjecti64v (GLuint id, GLenum pname, GLint64* params)
+{
+  glGetQueryObjecti64v = (PFNGLGETQUERYOBJECTI64VPROC)glewGetProcAddress((const GLubyte*)"glGetQueryObjecti64v");
+  glGetQueryObjecti64v(id, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryObjectui64v (GLuint id, GLenum pname, GLuint64* params)
+{
+  glGetQueryObjectui64v = (PFNGLGETQUERYOBJECTUI64VPROC)glewGetProcAddress((const GLubyte*)"glGetQueryObjectui64v");
+  glGetQueryObjectui64v(id, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glQueryCounter (GLuint id, GLenum target)
+{
+  glQueryCounter = (PFNGLQUERYCOUNTERPROC)glewGetProcAddress((const GLubyte*)"glQueryCounter");
+  glQueryCounter(id, target);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBindTransformFeedback (GLenum target, GLuint id)
+{
+  glBindTransformFeedback = (PFNGLBINDTRANSFORMFEEDBACKPROC)glewGetProcAddress((const GLubyte*)"glBindTransformFeedback");
+  glBindTransformFeedback(target, id);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteTransformFeedbacks (GLsizei n, const GLuint* ids)
+{
+  glDeleteTransformFeedbacks = (PFNGLDELETETRANSFORMFEEDBACKSPROC)glewGetProcAddress((const GLubyte*)"glDeleteTransformFeedbacks");
+  glDeleteTransformFeedbacks(n, ids);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawTransformFeedback (GLenum mode, GLuint id)
+{
+  glDrawTransformFeedback = (PFNGLDRAWTRANSFORMFEEDBACKPROC)glewGetProcAddress((const GLubyte*)"glDrawTransformFeedback");
+  glDrawTransformFeedback(mode, id);
+}
+
+static void GLAPIENTRY _glewLazy_glGenTransformFeedbacks (GLsizei n, GLuint* ids)
+{
+  glGenTransformFeedbacks = (PFNGLGENTRANSFORMFEEDBACKSPROC)glewGetProcAddress((const GLubyte*)"glGenTransformFeedbacks");
+  glGenTransformFeedbacks(n, ids);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsTransformFeedback (GLuint id)
+{
+  glIsTransformFeedback = (PFNGLISTRANSFORMFEEDBACKPROC)glewGetProcAddress((const GLubyte*)"glIsTransformFeedback");
+  return glIsTransformFeedback(id);
+}
+
+static void GLAPIENTRY _glewLazy_glPauseTransformFeedback (void)
+{
+  glPauseTransformFeedback = (PFNGLPAUSETRANSFORMFEEDBACKPROC)glewGetProcAddress((const GLubyte*)"glPauseTransformFeedback");
+  glPauseTransformFeedback();
+}
+
+static void GLAPIENTRY _glewLazy_glResumeTransformFeedback (void)
+{
+  glResumeTransformFeedback = (PFNGLRESUMETRANSFORMFEEDBACKPROC)glewGetProcAddress((const GLubyte*)"glResumeTransformFeedback");
+  glResumeTransformFeedback();
+}
+
+
+static void GLAPIENTRY _glewLazy_glBeginQueryIndexed (GLenum target, GLuint index, GLuint id)
+{
+  glBeginQueryIndexed = (PFNGLBEGINQUERYINDEXEDPROC)glewGetProcAddress((const GLubyte*)"glBeginQueryIndexed");
+  glBeginQueryIndexed(target, index, id);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawTransformFeedbackStream (GLenum mode, GLuint id, GLuint stream)
+{
+  glDrawTransformFeedbackStream = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC)glewGetProcAddress((const GLubyte*)"glDrawTransformFeedbackStream");
+  glDrawTransformFeedbackStream(mode, id, stream);
+}
+
+static void GLAPIENTRY _glewLazy_glEndQueryIndexed (GLenum target, GLuint index)
+{
+  glEndQueryIndexed = (PFNGLENDQUERYINDEXEDPROC)glewGetProcAddress((const GLubyte*)"glEndQueryIndexed");
+  glEndQueryIndexed(target, index);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryIndexediv (GLenum target, GLuint index, GLenum pname, GLint* params)
+{
+  glGetQueryIndexediv = (PFNGLGETQUERYINDEXEDIVPROC)glewGetProcAddress((const GLubyte*)"glGetQueryIndexediv");
+  glGetQueryIndexediv(target, index, pname, params);
+}
+
+
+static void GLAPIENTRY _glewLazy_glDrawTransformFeedbackInstanced (GLenum mode, GLuint id, GLsizei primcount)
+{
+  glDrawTransformFeedbackInstanced = (PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC)glewGetProcAddress((const GLubyte*)"glDrawTransformFeedbackInstanced");
+  glDrawTransformFeedbackInstanced(mode, id, primcount);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawTransformFeedbackStreamInstanced (GLenum mode, GLuint id, GLuint stream, GLsizei primcount)
+{
+  glDrawTransformFeedbackStreamInstanced = (PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC)glewGetProcAddress((const GLubyte*)"glDrawTransformFeedbackStreamInstanced");
+  glDrawTransformFeedbackStreamInstanced(mode, id, stream, primcount);
+}
+
+
+static void GLAPIENTRY _glewLazy_glLoadTransposeMatrixdARB (GLdouble m[16])
+{
+  glLoadTransposeMatrixdARB = (PFNGLLOADTRANSPOSEMATRIXDARBPROC)glewGetProcAddress((const GLubyte*)"glLoadTransposeMatrixdARB");
+  glLoadTransposeMatrixdARB(m);
+}
+
+static void GLAPIENTRY _glewLazy_glLoadTransposeMatrixfARB (GLfloat m[16])
+{
+  glLoadTransposeMatrixfARB = (PFNGLLOADTRANSPOSEMATRIXFARBPROC)glewGetProcAddress((const GLubyte*)"glLoadTransposeMatrixfARB");
+  glLoadTransposeMatrixfARB(m);
+}
+
+static void GLAPIENTRY _glewLazy_glMultTransposeMatrixdARB (GLdouble m[16])
+{
+  glMultTransposeMatrixdARB = (PFNGLMULTTRANSPOSEMATRIXDARBPROC)glewGetProcAddress((const GLubyte*)"glMultTransposeMatrixdARB");
+  glMultTransposeMatrixdARB(m);
+}
+
+static void GLAPIENTRY _glewLazy_glMultTransposeMatrixfARB (GLfloat m[16])
+{
+  glMultTransposeMatrixfARB = (PFNGLMULTTRANSPOSEMATRIXFARBPROC)glewGetProcAddress((const GLubyte*)"glMultTransposeMatrixfARB");
+  glMultTransposeMatrixfARB(m);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBindBufferBase (GLenum target, GLuint index, GLuint buffer)
+{
+  glBindBufferBase = (PFNGLBINDBUFFERBASEPROC)glewGetProcAddress((const GLubyte*)"glBindBufferBase");
+  glBindBufferBase(target, index, buffer);
+}
+
+static void GLAPIENTRY _glewLazy_glBindBufferRange (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+  glBindBufferRange = (PFNGLBINDBUFFERRANGEPROC)glewGetProcAddress((const GLubyte*)"glBindBufferRange");
+  glBindBufferRange(target, index, buffer, offset, size);
+}
+
+static void GLAPIENTRY _glewLazy_glGetActiveUniformBlockName (GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei* length, GLchar* uniformBlockName)
+{
+  glGetActiveUniformBlockName = (PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC)glewGetProcAddress((const GLubyte*)"glGetActiveUniformBlockName");
+  glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+}
+
+static void GLAPIENTRY _glewLazy_glGetActiveUniformBlockiv (GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint* params)
+{
+  glGetActiveUniformBlockiv = (PFNGLGETACTIVEUNIFORMBLOCKIVPROC)glewGetProcAddress((const GLubyte*)"glGetActiveUniformBlockiv");
+  glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetActiveUniformName (GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei* length, GLchar* uniformName)
+{
+  glGetActiveUniformName = (PFNGLGETACTIVEUNIFORMNAMEPROC)glewGetProcAddress((const GLubyte*)"glGetActiveUniformName");
+  glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+}
+
+static void GLAPIENTRY _glewLazy_glGetActiveUniformsiv (GLuint program, GLsizei uniformCount, const GLuint* uniformIndices, GLenum pname, GLint* params)
+{
+  glGetActiveUniformsiv = (PFNGLGETACTIVEUNIFORMSIVPROC)glewGetProcAddress((const GLubyte*)"glGetActiveUniformsiv");
+  glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetIntegeri_v (GLenum target, GLuint index, GLint* data)
+{
+  glGetIntegeri_v = (PFNGLGETINTEGERI_VPROC)glewGetProcAddress((const GLubyte*)"glGetIntegeri_v");
+  glGetIntegeri_v(target, index, data);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glGetUniformBlockIndex (GLuint program, const GLchar* uniformBlockName)
+{
+  glGetUniformBlockIndex = (PFNGLGETUNIFORMBLOCKINDEXPROC)glewGetProcAddress((const GLubyte*)"glGetUniformBlockIndex");
+  return glGetUniformBlockIndex(program, uniformBlockName);
+}
+
+static void GLAPIENTRY _glewLazy_glGetUniformIndices (GLuint program, GLsizei uniformCount, const GLchar* const * uniformNames, GLuint* uniformIndices)
+{
+  glGetUniformIndices = (PFNGLGETUNIFORMINDICESPROC)glewGetProcAddress((const GLubyte*)"glGetUniformIndices");
+  glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformBlockBinding (GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding)
+{
+  glUniformBlockBinding = (PFNGLUNIFORMBLOCKBINDINGPROC)glewGetProcAddress((const GLubyte*)"glUniformBlockBinding");
+  glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBindVertexArray (GLuint array)
+{
+  glBindVertexArray = (PFNGLBINDVERTEXARRAYPROC)glewGetProcAddress((const GLubyte*)"glBindVertexArray");
+  glBindVertexArray(array);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteVertexArrays (GLsizei n, const GLuint* arrays)
+{
+  glDeleteVertexArrays = (PFNGLDELETEVERTEXARRAYSPROC)glewGetProcAddress((const GLubyte*)"glDeleteVertexArrays");
+  glDeleteVertexArrays(n, arrays);
+}
+
+static void GLAPIENTRY _glewLazy_glGenVertexArrays (GLsizei n, GLuint* arrays)
+{
+  glGenVertexArrays = (PFNGLGENVERTEXARRAYSPROC)glewGetProcAddress((const GLubyte*)"glGenVertexArrays");
+  glGenVertexArrays(n, arrays);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsVertexArray (GLuint array)
+{
+  glIsVertexArray = (PFNGLISVERTEXARRAYPROC)glewGetProcAddress((const GLubyte*)"glIsVertexArray");
+  return glIsVertexArray(array);
+}
+
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribLdv (GLuint index, GLenum pname, GLdouble* params)
+{
+  glGetVertexAttribLdv = (PFNGLGETVERTEXATTRIBLDVPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribLdv");
+  glGetVertexAttribLdv(index, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL1d (GLuint index, GLdouble x)
+{
+  glVertexAttribL1d = (PFNGLVERTEXATTRIBL1DPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL1d");
+  glVertexAttribL1d(index, x);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL1dv (GLuint index, const GLdouble* v)
+{
+  glVertexAttribL1dv = (PFNGLVERTEXATTRIBL1DVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL1dv");
+  glVertexAttribL1dv(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL2d (GLuint index, GLdouble x, GLdouble y)
+{
+  glVertexAttribL2d = (PFNGLVERTEXATTRIBL2DPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL2d");
+  glVertexAttribL2d(index, x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL2dv (GLuint index, const GLdouble* v)
+{
+  glVertexAttribL2dv = (PFNGLVERTEXATTRIBL2DVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL2dv");
+  glVertexAttribL2dv(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL3d (GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+  glVertexAttribL3d = (PFNGLVERTEXATTRIBL3DPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL3d");
+  glVertexAttribL3d(index, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL3dv (GLuint index, const GLdouble* v)
+{
+  glVertexAttribL3dv = (PFNGLVERTEXATTRIBL3DVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL3dv");
+  glVertexAttribL3dv(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL4d (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+  glVertexAttribL4d = (PFNGLVERTEXATTRIBL4DPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL4d");
+  glVertexAttribL4d(index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL4dv (GLuint index, const GLdouble* v)
+{
+  glVertexAttribL4dv = (PFNGLVERTEXATTRIBL4DVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL4dv");
+  glVertexAttribL4dv(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribLPointer (GLuint index, GLint size, GLenum type, GLsizei stride, const void* pointer)
+{
+  glVertexAttribLPointer = (PFNGLVERTEXATTRIBLPOINTERPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribLPointer");
+  glVertexAttribLPointer(index, size, type, stride, pointer);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBindVertexBuffer (GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride)
+{
+  glBindVertexBuffer = (PFNGLBINDVERTEXBUFFERPROC)glewGetProcAddress((const GLubyte*)"glBindVertexBuffer");
+  glBindVertexBuffer(bindingindex, buffer, offset, stride);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayBindVertexBufferEXT (GLuint vaobj, GLuint bindingindex, GLuint buffer, GLintptr offset, GLsizei stride)
+{
+  glVertexArrayBindVertexBufferEXT = (PFNGLVERTEXARRAYBINDVERTEXBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayBindVertexBufferEXT");
+  glVertexArrayBindVertexBufferEXT(vaobj, bindingindex, buffer, offset, stride);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayVertexAttribBindingEXT (GLuint vaobj, GLuint attribindex, GLuint bindingindex)
+{
+  glVertexArrayVertexAttribBindingEXT = (PFNGLVERTEXARRAYVERTEXATTRIBBINDINGEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayVertexAttribBindingEXT");
+  glVertexArrayVertexAttribBindingEXT(vaobj, attribindex, bindingindex);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayVertexAttribFormatEXT (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset)
+{
+  glVertexArrayVertexAttribFormatEXT = (PFNGLVERTEXARRAYVERTEXATTRIBFORMATEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayVertexAttribFormatEXT");
+  glVertexArrayVertexAttribFormatEXT(vaobj, attribindex, size, type, normalized, relativeoffset);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayVertexAttribIFormatEXT (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+  glVertexArrayVertexAttribIFormatEXT = (PFNGLVERTEXARRAYVERTEXATTRIBIFORMATEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayVertexAttribIFormatEXT");
+  glVertexArrayVertexAttribIFormatEXT(vaobj, attribindex, size, type, relativeoffset);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayVertexAttribLFormatEXT (GLuint vaobj, GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+  glVertexArrayVertexAttribLFormatEXT = (PFNGLVERTEXARRAYVERTEXATTRIBLFORMATEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayVertexAttribLFormatEXT");
+  glVertexArrayVertexAttribLFormatEXT(vaobj, attribindex, size, type, relativeoffset);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayVertexBindingDivisorEXT (GLuint vaobj, GLuint bindingindex, GLuint divisor)
+{
+  glVertexArrayVertexBindingDivisorEXT = (PFNGLVERTEXARRAYVERTEXBINDINGDIVISOREXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayVertexBindingDivisorEXT");
+  glVertexArrayVertexBindingDivisorEXT(vaobj, bindingindex, divisor);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribBinding (GLuint attribindex, GLuint bindingindex)
+{
+  glVertexAttribBinding = (PFNGLVERTEXATTRIBBINDINGPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribBinding");
+  glVertexAttribBinding(attribindex, bindingindex);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribFormat (GLuint attribindex, GLint size, GLenum type, GLboolean normalized, GLuint relativeoffset)
+{
+  glVertexAttribFormat = (PFNGLVERTEXATTRIBFORMATPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribFormat");
+  glVertexAttribFormat(attribindex, size, type, normalized, relativeoffset);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribIFormat (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+  glVertexAttribIFormat = (PFNGLVERTEXATTRIBIFORMATPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribIFormat");
+  glVertexAttribIFormat(attribindex, size, type, relativeoffset);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribLFormat (GLuint attribindex, GLint size, GLenum type, GLuint relativeoffset)
+{
+  glVertexAttribLFormat = (PFNGLVERTEXATTRIBLFORMATPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribLFormat");
+  glVertexAttribLFormat(attribindex, size, type, relativeoffset);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexBindingDivisor (GLuint bindingindex, GLuint divisor)
+{
+  glVertexBindingDivisor = (PFNGLVERTEXBINDINGDIVISORPROC)glewGetProcAddress((const GLubyte*)"glVertexBindingDivisor");
+  glVertexBindingDivisor(bindingindex, divisor);
+}
+
+
+static void GLAPIENTRY _glewLazy_glVertexBlendARB (GLint count)
+{
+  glVertexBlendARB = (PFNGLVERTEXBLENDARBPROC)glewGetProcAddress((const GLubyte*)"glVertexBlendARB");
+  glVertexBlendARB(count);
+}
+
+static void GLAPIENTRY _glewLazy_glWeightPointerARB (GLint size, GLenum type, GLsizei stride, void *pointer)
+{
+  glWeightPointerARB = (PFNGLWEIGHTPOINTERARBPROC)glewGetProcAddress((const GLubyte*)"glWeightPointerARB");
+  glWeightPointerARB(size, type, stride, pointer);
+}
+
+static void GLAPIENTRY _glewLazy_glWeightbvARB (GLint size, GLbyte *weights)
+{
+  glWeightbvARB = (PFNGLWEIGHTBVARBPROC)glewGetProcAddress((const GLubyte*)"glWeightbvARB");
+  glWeightbvARB(size, weights);
+}
+
+static void GLAPIENTRY _glewLazy_glWeightdvARB (GLint size, GLdouble *weights)
+{
+  glWeightdvARB = (PFNGLWEIGHTDVARBPROC)glewGetProcAddress((const GLubyte*)"glWeightdvARB");
+  glWeightdvARB(size, weights);
+}
+
+static void GLAPIENTRY _glewLazy_glWeightfvARB (GLint size, GLfloat *weights)
+{
+  glWeightfvARB = (PFNGLWEIGHTFVARBPROC)glewGetProcAddress((const GLubyte*)"glWeightfvARB");
+  glWeightfvARB(size, weights);
+}
+
+static void GLAPIENTRY _glewLazy_glWeightivARB (GLint size, GLint *weights)
+{
+  glWeightivARB = (PFNGLWEIGHTIVARBPROC)glewGetProcAddress((const GLubyte*)"glWeightivARB");
+  glWeightivARB(size, weights);
+}
+
+static void GLAPIENTRY _glewLazy_glWeightsvARB (GLint size, GLshort *weights)
+{
+  glWeightsvARB = (PFNGLWEIGHTSVARBPROC)glewGetProcAddress((const GLubyte*)"glWeightsvARB");
+  glWeightsvARB(size, weights);
+}
+
+static void GLAPIENTRY _glewLazy_glWeightubvARB (GLint size, GLubyte *weights)
+{
+  glWeightubvARB = (PFNGLWEIGHTUBVARBPROC)glewGetProcAddress((const GLubyte*)"glWeightubvARB");
+  glWeightubvARB(size, weights);
+}
+
+static void GLAPIENTRY _glewLazy_glWeightuivARB (GLint size, GLuint *weights)
+{
+  glWeightuivARB = (PFNGLWEIGHTUIVARBPROC)glewGetProcAddress((const GLubyte*)"glWeightuivARB");
+  glWeightuivARB(size, weights);
+}
+
+static void GLAPIENTRY _glewLazy_glWeightusvARB (GLint size, GLushort *weights)
+{
+  glWeightusvARB = (PFNGLWEIGHTUSVARBPROC)glewGetProcAddress((const GLubyte*)"glWeightusvARB");
+  glWeightusvARB(size, weights);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBindBufferARB (GLenum target, GLuint buffer)
+{
+  glBindBufferARB = (PFNGLBINDBUFFERARBPROC)glewGetProcAddress((const GLubyte*)"glBindBufferARB");
+  glBindBufferARB(target, buffer);
+}
+
+static void GLAPIENTRY _glewLazy_glBufferDataARB (GLenum target, GLsizeiptrARB size, const void *data, GLenum usage)
+{
+  glBufferDataARB = (PFNGLBUFFERDATAARBPROC)glewGetProcAddress((const GLubyte*)"glBufferDataARB");
+  glBufferDataARB(target, size, data, usage);
+}
+
+static void GLAPIENTRY _glewLazy_glBufferSubDataARB (GLenum target, GLintptrARB offset, GLsizeiptrARB size, const void *data)
+{
+  glBufferSubDataARB = (PFNGLBUFFERSUBDATAARBPROC)glewGetProcAddress((const GLubyte*)"glBufferSubDataARB");
+  glBufferSubDataARB(target, offset, size, data);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteBuffersARB (GLsizei n, const GLuint* buffers)
+{
+  glDeleteBuffersARB = (PFNGLDELETEBUFFERSARBPROC)glewGetProcAddress((const GLubyte*)"glDeleteBuffersARB");
+  glDeleteBuffersARB(n, buffers);
+}
+
+static void GLAPIENTRY _glewLazy_glGenBuffersARB (GLsizei n, GLuint* buffers)
+{
+  glGenBuffersARB = (PFNGLGENBUFFERSARBPROC)glewGetProcAddress((const GLubyte*)"glGenBuffersARB");
+  glGenBuffersARB(n, buffers);
+}
+
+static void GLAPIENTRY _glewLazy_glGetBufferParameterivARB (GLenum target, GLenum pname, GLint* params)
+{
+  glGetBufferParameterivARB = (PFNGLGETBUFFERPARAMETERIVARBPROC)glewGetProcAddress((const GLubyte*)"glGetBufferParameterivARB");
+  glGetBufferParameterivARB(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetBufferPointervARB (GLenum target, GLenum pname, void** params)
+{
+  glGetBufferPointervARB = (PFNGLGETBUFFERPOINTERVARBPROC)glewGetProcAddress((const GLubyte*)"glGetBufferPointervARB");
+  glGetBufferPointervARB(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetBufferSubDataARB (GLenum target, GLintptrARB offset, GLsizeiptrARB size, void *data)
+{
+  glGetBufferSubDataARB = (PFNGLGETBUFFERSUBDATAARBPROC)glewGetProcAddress((const GLubyte*)"glGetBufferSubDataARB");
+  glGetBufferSubDataARB(target, offset, size, data);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsBufferARB (GLuint buffer)
+{
+  glIsBufferARB = (PFNGLISBUFFERARBPROC)glewGetProcAddress((const GLubyte*)"glIsBufferARB");
+  return glIsBufferARB(buffer);
+}
+
+static void * GLAPIENTRY _glewLazy_glMapBufferARB (GLenum target, GLenum access)
+{
+  glMapBufferARB = (PFNGLMAPBUFFERARBPROC)glewGetProcAddress((const GLubyte*)"glMapBufferARB");
+  return glMapBufferARB(target, access);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glUnmapBufferARB (GLenum target)
+{
+  glUnmapBufferARB = (PFNGLUNMAPBUFFERARBPROC)glewGetProcAddress((const GLubyte*)"glUnmapBufferARB");
+  return glUnmapBufferARB(target);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBindProgramARB (GLenum target, GLuint program)
+{
+  glBindProgramARB = (PFNGLBINDPROGRAMARBPROC)glewGetProcAddress((const GLubyte*)"glBindProgramARB");
+  glBindProgramARB(target, program);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteProgramsARB (GLsizei n, const GLuint* programs)
+{
+  glDeleteProgramsARB = (PFNGLDELETEPROGRAMSARBPROC)glewGetProcAddress((const GLubyte*)"glDeleteProgramsARB");
+  glDeleteProgramsARB(n, programs);
+}
+
+static void GLAPIENTRY _glewLazy_glDisableVertexAttribArrayARB (GLuint index)
+{
+  glDisableVertexAttribArrayARB = (PFNGLDISABLEVERTEXATTRIBARRAYARBPROC)glewGetProcAddress((const GLubyte*)"glDisableVertexAttribArrayARB");
+  glDisableVertexAttribArrayARB(index);
+}
+
+static void GLAPIENTRY _glewLazy_glEnableVertexAttribArrayARB (GLuint index)
+{
+  glEnableVertexAttribArrayARB = (PFNGLENABLEVERTEXATTRIBARRAYARBPROC)glewGetProcAddress((const GLubyte*)"glEnableVertexAttribArrayARB");
+  glEnableVertexAttribArrayARB(index);
+}
+
+static void GLAPIENTRY _glewLazy_glGenProgramsARB (GLsizei n, GLuint* programs)
+{
+  glGenProgramsARB = (PFNGLGENPROGRAMSARBPROC)glewGetProcAddress((const GLubyte*)"glGenProgramsARB");
+  glGenProgramsARB(n, programs);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramEnvParameterdvARB (GLenum target, GLuint index, GLdouble* params)
+{
+  glGetProgramEnvParameterdvARB = (PFNGLGETPROGRAMENVPARAMETERDVARBPROC)glewGetProcAddress((const GLubyte*)"glGetProgramEnvParameterdvARB");
+  glGetProgramEnvParameterdvARB(target, index, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramEnvParameterfvARB (GLenum target, GLuint index, GLfloat* params)
+{
+  glGetProgramEnvParameterfvARB = (PFNGLGETPROGRAMENVPARAMETERFVARBPROC)glewGetProcAddress((const GLubyte*)"glGetProgramEnvParameterfvARB");
+  glGetProgramEnvParameterfvARB(target, index, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramLocalParameterdvARB (GLenum target, GLuint index, GLdouble* params)
+{
+  glGetProgramLocalParameterdvARB = (PFNGLGETPROGRAMLOCALPARAMETERDVARBPROC)glewGetProcAddress((const GLubyte*)"glGetProgramLocalParameterdvARB");
+  glGetProgramLocalParameterdvARB(target, index, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramLocalParameterfvARB (GLenum target, GLuint index, GLfloat* params)
+{
+  glGetProgramLocalParameterfvARB = (PFNGLGETPROGRAMLOCALPARAMETERFVARBPROC)glewGetProcAddress((const GLubyte*)"glGetProgramLocalParameterfvARB");
+  glGetProgramLocalParameterfvARB(target, index, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramStringARB (GLenum target, GLenum pname, void *string)
+{
+  glGetProgramStringARB = (PFNGLGETPROGRAMSTRINGARBPROC)glewGetProcAddress((const GLubyte*)"glGetProgramStringARB");
+  glGetProgramStringARB(target, pname, string);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramivARB (GLenum target, GLenum pname, GLint* params)
+{
+  glGetProgramivARB = (PFNGLGETPROGRAMIVARBPROC)glewGetProcAddress((const GLubyte*)"glGetProgramivARB");
+  glGetProgramivARB(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribPointervARB (GLuint index, GLenum pname, void** pointer)
+{
+  glGetVertexAttribPointervARB = (PFNGLGETVERTEXATTRIBPOINTERVARBPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribPointervARB");
+  glGetVertexAttribPointervARB(index, pname, pointer);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribdvARB (GLuint index, GLenum pname, GLdouble* params)
+{
+  glGetVertexAttribdvARB = (PFNGLGETVERTEXATTRIBDVARBPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribdvARB");
+  glGetVertexAttribdvARB(index, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribfvARB (GLuint index, GLenum pname, GLfloat* params)
+{
+  glGetVertexAttribfvARB = (PFNGLGETVERTEXATTRIBFVARBPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribfvARB");
+  glGetVertexAttribfvARB(index, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribivARB (GLuint index, GLenum pname, GLint* params)
+{
+  glGetVertexAttribivARB = (PFNGLGETVERTEXATTRIBIVARBPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribivARB");
+  glGetVertexAttribivARB(index, pname, params);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsProgramARB (GLuint program)
+{
+  glIsProgramARB = (PFNGLISPROGRAMARBPROC)glewGetProcAddress((const GLubyte*)"glIsProgramARB");
+  return glIsProgramARB(program);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramEnvParameter4dARB (GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+  glProgramEnvParameter4dARB = (PFNGLPROGRAMENVPARAMETER4DARBPROC)glewGetProcAddress((const GLubyte*)"glProgramEnvParameter4dARB");
+  glProgramEnvParameter4dARB(target, index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramEnvParameter4dvARB (GLenum target, GLuint index, const GLdouble* params)
+{
+  glProgramEnvParameter4dvARB = (PFNGLPROGRAMENVPARAMETER4DVARBPROC)glewGetProcAddress((const GLubyte*)"glProgramEnvParameter4dvARB");
+  glProgramEnvParameter4dvARB(target, index, params);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramEnvParameter4fARB (GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+  glProgramEnvParameter4fARB = (PFNGLPROGRAMENVPARAMETER4FARBPROC)glewGetProcAddress((const GLubyte*)"glProgramEnvParameter4fARB");
+  glProgramEnvParameter4fARB(target, index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramEnvParameter4fvARB (GLenum target, GLuint index, const GLfloat* params)
+{
+  glProgramEnvParameter4fvARB = (PFNGLPROGRAMENVPARAMETER4FVARBPROC)glewGetProcAddress((const GLubyte*)"glProgramEnvParameter4fvARB");
+  glProgramEnvParameter4fvARB(target, index, params);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramLocalParameter4dARB (GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+  glProgramLocalParameter4dARB = (PFNGLPROGRAMLOCALPARAMETER4DARBPROC)glewGetProcAddress((const GLubyte*)"glProgramLocalParameter4dARB");
+  glProgramLocalParameter4dARB(target, index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramLocalParameter4dvARB (GLenum target, GLuint index, const GLdouble* params)
+{
+  glProgramLocalParameter4dvARB = (PFNGLPROGRAMLOCALPARAMETER4DVARBPROC)glewGetProcAddress((const GLubyte*)"glProgramLocalParameter4dvARB");
+  glProgramLocalParameter4dvARB(target, index, params);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramLocalParameter4fARB (GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+  glProgramLocalParameter4fARB = (PFNGLPROGRAMLOCALPARAMETER4FARBPROC)glewGetProcAddress((const GLubyte*)"glProgramLocalParameter4fARB");
+  glProgramLocalParameter4fARB(target, index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramLocalParameter4fvARB (GLenum target, GLuint index, const GLfloat* params)
+{
+  glProgramLocalParameter4fvARB = (PFNGLPROGRAMLOCALPARAMETER4FVARBPROC)glewGetProcAddress((const GLubyte*)"glProgramLocalParameter4fvARB");
+  glProgramLocalParameter4fvARB(target, index, params);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramStringARB (GLenum target, GLenum format, GLsizei len, const void *string)
+{
+  glProgramStringARB = (PFNGLPROGRAMSTRINGARBPROC)glewGetProcAddress((const GLubyte*)"glProgramStringARB");
+  glProgramStringARB(target, format, len, string);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1dARB (GLuint index, GLdouble x)
+{
+  glVertexAttrib1dARB = (PFNGLVERTEXATTRIB1DARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1dARB");
+  glVertexAttrib1dARB(index, x);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1dvARB (GLuint index, const GLdouble* v)
+{
+  glVertexAttrib1dvARB = (PFNGLVERTEXATTRIB1DVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1dvARB");
+  glVertexAttrib1dvARB(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1fARB (GLuint index, GLfloat x)
+{
+  glVertexAttrib1fARB = (PFNGLVERTEXATTRIB1FARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1fARB");
+  glVertexAttrib1fARB(index, x);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1fvARB (GLuint index, const GLfloat* v)
+{
+  glVertexAttrib1fvARB = (PFNGLVERTEXATTRIB1FVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1fvARB");
+  glVertexAttrib1fvARB(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1sARB (GLuint index, GLshort x)
+{
+  glVertexAttrib1sARB = (PFNGLVERTEXATTRIB1SARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1sARB");
+  glVertexAttrib1sARB(index, x);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1svARB (GLuint index, const GLshort* v)
+{
+  glVertexAttrib1svARB = (PFNGLVERTEXATTRIB1SVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1svARB");
+  glVertexAttrib1svARB(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2dARB (GLuint index, GLdouble x, GLdouble y)
+{
+  glVertexAttrib2dARB = (PFNGLVERTEXATTRIB2DARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2dARB");
+  glVertexAttrib2dARB(index, x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2dvARB (GLuint index, const GLdouble* v)
+{
+  glVertexAttrib2dvARB = (PFNGLVERTEXATTRIB2DVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2dvARB");
+  glVertexAttrib2dvARB(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2fARB (GLuint index, GLfloat x, GLfloat y)
+{
+  glVertexAttrib2fARB = (PFNGLVERTEXATTRIB2FARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2fARB");
+  glVertexAttrib2fARB(index, x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2fvARB (GLuint index, const GLfloat* v)
+{
+  glVertexAttrib2fvARB = (PFNGLVERTEXATTRIB2FVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2fvARB");
+  glVertexAttrib2fvARB(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2sARB (GLuint index, GLshort x, GLshort y)
+{
+  glVertexAttrib2sARB = (PFNGLVERTEXATTRIB2SARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2sARB");
+  glVertexAttrib2sARB(index, x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2svARB (GLuint index, const GLshort* v)
+{
+  glVertexAttrib2svARB = (PFNGLVERTEXATTRIB2SVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2svARB");
+  glVertexAttrib2svARB(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3dARB (GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+  glVertexAttrib3dARB = (PFNGLVERTEXATTRIB3DARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3dARB");
+  glVertexAttrib3dARB(index, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3dvARB (GLuint index, const GLdouble* v)
+{
+  glVertexAttrib3dvARB = (PFNGLVERTEXATTRIB3DVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3dvARB");
+  glVertexAttrib3dvARB(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3fARB (GLuint index, GLfloat x, GLfloat y, GLfloat z)
+{
+  glVertexAttrib3fARB = (PFNGLVERTEXATTRIB3FARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3fARB");
+  glVertexAttrib3fARB(index, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3fvARB (GLuint index, const GLfloat* v)
+{
+  glVertexAttrib3fvARB = (PFNGLVERTEXATTRIB3FVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3fvARB");
+  glVertexAttrib3fvARB(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3sARB (GLuint index, GLshort x, GLshort y, GLshort z)
+{
+  glVertexAttrib3sARB = (PFNGLVERTEXATTRIB3SARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3sARB");
+  glVertexAttrib3sARB(index, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3svARB (GLuint index, const GLshort* v)
+{
+  glVertexAttrib3svARB = (PFNGLVERTEXATTRIB3SVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3svARB");
+  glVertexAttrib3svARB(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4NbvARB (GLuint index, const GLbyte* v)
+{
+  glVertexAttrib4NbvARB = (PFNGLVERTEXATTRIB4NBVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4NbvARB");
+  glVertexAttrib4NbvARB(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4NivARB (GLuint index, const GLint* v)
+{
+  glVertexAttrib4NivARB = (PFNGLVERTEXATTRIB4NIVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4NivARB");
+  glVertexAttrib4NivARB(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4NsvARB (GLuint index, const GLshort* v)
+{
+  glVertexAttrib4NsvARB = (PFNGLVERTEXATTRIB4NSVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4NsvARB");
+  glVertexAttrib4NsvARB(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4NubARB (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
+{
+  glVertexAttrib4NubARB = (PFNGLVERTEXATTRIB4NUBARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4NubARB");
+  glVertexAttrib4NubARB(index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4NubvARB (GLuint index, const GLubyte* v)
+{
+  glVertexAttrib4NubvARB = (PFNGLVERTEXATTRIB4NUBVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4NubvARB");
+  glVertexAttrib4NubvARB(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4NuivARB (GLuint index, const GLuint* v)
+{
+  glVertexAttrib4NuivARB = (PFNGLVERTEXATTRIB4NUIVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4NuivARB");
+  glVertexAttrib4NuivARB(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4NusvARB (GLuint index, const GLushort* v)
+{
+  glVertexAttrib4NusvARB = (PFNGLVERTEXATTRIB4NUSVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4NusvARB");
+  glVertexAttrib4NusvARB(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4bvARB (GLuint index, const GLbyte* v)
+{
+  glVertexAttrib4bvARB = (PFNGLVERTEXATTRIB4BVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4bvARB");
+  glVertexAttrib4bvARB(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4dARB (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+  glVertexAttrib4dARB = (PFNGLVERTEXATTRIB4DARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4dARB");
+  glVertexAttrib4dARB(index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4dvARB (GLuint index, const GLdouble* v)
+{
+  glVertexAttrib4dvARB = (PFNGLVERTEXATTRIB4DVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4dvARB");
+  glVertexAttrib4dvARB(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4fARB (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+  glVertexAttrib4fARB = (PFNGLVERTEXATTRIB4FARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4fARB");
+  glVertexAttrib4fARB(index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4fvARB (GLuint index, const GLfloat* v)
+{
+  glVertexAttrib4fvARB = (PFNGLVERTEXATTRIB4FVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4fvARB");
+  glVertexAttrib4fvARB(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4ivARB (GLuint index, const GLint* v)
+{
+  glVertexAttrib4ivARB = (PFNGLVERTEXATTRIB4IVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4ivARB");
+  glVertexAttrib4ivARB(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4sARB (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
+{
+  glVertexAttrib4sARB = (PFNGLVERTEXATTRIB4SARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4sARB");
+  glVertexAttrib4sARB(index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4svARB (GLuint index, const GLshort* v)
+{
+  glVertexAttrib4svARB = (PFNGLVERTEXATTRIB4SVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4svARB");
+  glVertexAttrib4svARB(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4ubvARB (GLuint index, const GLubyte* v)
+{
+  glVertexAttrib4ubvARB = (PFNGLVERTEXATTRIB4UBVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4ubvARB");
+  glVertexAttrib4ubvARB(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4uivARB (GLuint index, const GLuint* v)
+{
+  glVertexAttrib4uivARB = (PFNGLVERTEXATTRIB4UIVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4uivARB");
+  glVertexAttrib4uivARB(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4usvARB (GLuint index, const GLushort* v)
+{
+  glVertexAttrib4usvARB = (PFNGLVERTEXATTRIB4USVARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4usvARB");
+  glVertexAttrib4usvARB(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribPointerARB (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer)
+{
+  glVertexAttribPointerARB = (PFNGLVERTEXATTRIBPOINTERARBPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribPointerARB");
+  glVertexAttribPointerARB(index, size, type, normalized, stride, pointer);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBindAttribLocationARB (GLhandleARB programObj, GLuint index, const GLcharARB* name)
+{
+  glBindAttribLocationARB = (PFNGLBINDATTRIBLOCATIONARBPROC)glewGetProcAddress((const GLubyte*)"glBindAttribLocationARB");
+  glBindAttribLocationARB(programObj, index, name);
+}
+
+static void GLAPIENTRY _glewLazy_glGetActiveAttribARB (GLhandleARB programObj, GLuint index, GLsizei maxLength, GLsizei* length, GLint *size, GLenum *type, GLcharARB *name)
+{
+  glGetActiveAttribARB = (PFNGLGETACTIVEATTRIBARBPROC)glewGetProcAddress((const GLubyte*)"glGetActiveAttribARB");
+  glGetActiveAttribARB(programObj, index, maxLength, length, size, type, name);
+}
+
+static GLint GLAPIENTRY _glewLazy_glGetAttribLocationARB (GLhandleARB programObj, const GLcharARB* name)
+{
+  glGetAttribLocationARB = (PFNGLGETATTRIBLOCATIONARBPROC)glewGetProcAddress((const GLubyte*)"glGetAttribLocationARB");
+  return glGetAttribLocationARB(programObj, name);
+}
+
+
+static void GLAPIENTRY _glewLazy_glColorP3ui (GLenum type, GLuint color)
+{
+  glColorP3ui = (PFNGLCOLORP3UIPROC)glewGetProcAddress((const GLubyte*)"glColorP3ui");
+  glColorP3ui(type, color);
+}
+
+static void GLAPIENTRY _glewLazy_glColorP3uiv (GLenum type, const GLuint* color)
+{
+  glColorP3uiv = (PFNGLCOLORP3UIVPROC)glewGetProcAddress((const GLubyte*)"glColorP3uiv");
+  glColorP3uiv(type, color);
+}
+
+static void GLAPIENTRY _glewLazy_glColorP4ui (GLenum type, GLuint color)
+{
+  glColorP4ui = (PFNGLCOLORP4UIPROC)glewGetProcAddress((const GLubyte*)"glColorP4ui");
+  glColorP4ui(type, color);
+}
+
+static void GLAPIENTRY _glewLazy_glColorP4uiv (GLenum type, const GLuint* color)
+{
+  glColorP4uiv = (PFNGLCOLORP4UIVPROC)glewGetProcAddress((const GLubyte*)"glColorP4uiv");
+  glColorP4uiv(type, color);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoordP1ui (GLenum texture, GLenum type, GLuint coords)
+{
+  glMultiTexCoordP1ui = (PFNGLMULTITEXCOORDP1UIPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoordP1ui");
+  glMultiTexCoordP1ui(texture, type, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoordP1uiv (GLenum texture, GLenum type, const GLuint* coords)
+{
+  glMultiTexCoordP1uiv = (PFNGLMULTITEXCOORDP1UIVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoordP1uiv");
+  glMultiTexCoordP1uiv(texture, type, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoordP2ui (GLenum texture, GLenum type, GLuint coords)
+{
+  glMultiTexCoordP2ui = (PFNGLMULTITEXCOORDP2UIPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoordP2ui");
+  glMultiTexCoordP2ui(texture, type, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoordP2uiv (GLenum texture, GLenum type, const GLuint* coords)
+{
+  glMultiTexCoordP2uiv = (PFNGLMULTITEXCOORDP2UIVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoordP2uiv");
+  glMultiTexCoordP2uiv(texture, type, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoordP3ui (GLenum texture, GLenum type, GLuint coords)
+{
+  glMultiTexCoordP3ui = (PFNGLMULTITEXCOORDP3UIPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoordP3ui");
+  glMultiTexCoordP3ui(texture, type, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoordP3uiv (GLenum texture, GLenum type, const GLuint* coords)
+{
+  glMultiTexCoordP3uiv = (PFNGLMULTITEXCOORDP3UIVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoordP3uiv");
+  glMultiTexCoordP3uiv(texture, type, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoordP4ui (GLenum texture, GLenum type, GLuint coords)
+{
+  glMultiTexCoordP4ui = (PFNGLMULTITEXCOORDP4UIPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoordP4ui");
+  glMultiTexCoordP4ui(texture, type, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoordP4uiv (GLenum texture, GLenum type, const GLuint* coords)
+{
+  glMultiTexCoordP4uiv = (PFNGLMULTITEXCOORDP4UIVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoordP4uiv");
+  glMultiTexCoordP4uiv(texture, type, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glNormalP3ui (GLenum type, GLuint coords)
+{
+  glNormalP3ui = (PFNGLNORMALP3UIPROC)glewGetProcAddress((const GLubyte*)"glNormalP3ui");
+  glNormalP3ui(type, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glNormalP3uiv (GLenum type, const GLuint* coords)
+{
+  glNormalP3uiv = (PFNGLNORMALP3UIVPROC)glewGetProcAddress((const GLubyte*)"glNormalP3uiv");
+  glNormalP3uiv(type, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColorP3ui (GLenum type, GLuint color)
+{
+  glSecondaryColorP3ui = (PFNGLSECONDARYCOLORP3UIPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColorP3ui");
+  glSecondaryColorP3ui(type, color);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColorP3uiv (GLenum type, const GLuint* color)
+{
+  glSecondaryColorP3uiv = (PFNGLSECONDARYCOLORP3UIVPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColorP3uiv");
+  glSecondaryColorP3uiv(type, color);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoordP1ui (GLenum type, GLuint coords)
+{
+  glTexCoordP1ui = (PFNGLTEXCOORDP1UIPROC)glewGetProcAddress((const GLubyte*)"glTexCoordP1ui");
+  glTexCoordP1ui(type, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoordP1uiv (GLenum type, const GLuint* coords)
+{
+  glTexCoordP1uiv = (PFNGLTEXCOORDP1UIVPROC)glewGetProcAddress((const GLubyte*)"glTexCoordP1uiv");
+  glTexCoordP1uiv(type, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoordP2ui (GLenum type, GLuint coords)
+{
+  glTexCoordP2ui = (PFNGLTEXCOORDP2UIPROC)glewGetProcAddress((const GLubyte*)"glTexCoordP2ui");
+  glTexCoordP2ui(type, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoordP2uiv (GLenum type, const GLuint* coords)
+{
+  glTexCoordP2uiv = (PFNGLTEXCOORDP2UIVPROC)glewGetProcAddress((const GLubyte*)"glTexCoordP2uiv");
+  glTexCoordP2uiv(type, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoordP3ui (GLenum type, GLuint coords)
+{
+  glTexCoordP3ui = (PFNGLTEXCOORDP3UIPROC)glewGetProcAddress((const GLubyte*)"glTexCoordP3ui");
+  glTexCoordP3ui(type, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoordP3uiv (GLenum type, const GLuint* coords)
+{
+  glTexCoordP3uiv = (PFNGLTEXCOORDP3UIVPROC)glewGetProcAddress((const GLubyte*)"glTexCoordP3uiv");
+  glTexCoordP3uiv(type, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoordP4ui (GLenum type, GLuint coords)
+{
+  glTexCoordP4ui = (PFNGLTEXCOORDP4UIPROC)glewGetProcAddress((const GLubyte*)"glTexCoordP4ui");
+  glTexCoordP4ui(type, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoordP4uiv (GLenum type, const GLuint* coords)
+{
+  glTexCoordP4uiv = (PFNGLTEXCOORDP4UIVPROC)glewGetProcAddress((const GLubyte*)"glTexCoordP4uiv");
+  glTexCoordP4uiv(type, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribP1ui (GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+  glVertexAttribP1ui = (PFNGLVERTEXATTRIBP1UIPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribP1ui");
+  glVertexAttribP1ui(index, type, normalized, value);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribP1uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint* value)
+{
+  glVertexAttribP1uiv = (PFNGLVERTEXATTRIBP1UIVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribP1uiv");
+  glVertexAttribP1uiv(index, type, normalized, value);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribP2ui (GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+  glVertexAttribP2ui = (PFNGLVERTEXATTRIBP2UIPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribP2ui");
+  glVertexAttribP2ui(index, type, normalized, value);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribP2uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint* value)
+{
+  glVertexAttribP2uiv = (PFNGLVERTEXATTRIBP2UIVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribP2uiv");
+  glVertexAttribP2uiv(index, type, normalized, value);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribP3ui (GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+  glVertexAttribP3ui = (PFNGLVERTEXATTRIBP3UIPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribP3ui");
+  glVertexAttribP3ui(index, type, normalized, value);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribP3uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint* value)
+{
+  glVertexAttribP3uiv = (PFNGLVERTEXATTRIBP3UIVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribP3uiv");
+  glVertexAttribP3uiv(index, type, normalized, value);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribP4ui (GLuint index, GLenum type, GLboolean normalized, GLuint value)
+{
+  glVertexAttribP4ui = (PFNGLVERTEXATTRIBP4UIPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribP4ui");
+  glVertexAttribP4ui(index, type, normalized, value);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribP4uiv (GLuint index, GLenum type, GLboolean normalized, const GLuint* value)
+{
+  glVertexAttribP4uiv = (PFNGLVERTEXATTRIBP4UIVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribP4uiv");
+  glVertexAttribP4uiv(index, type, normalized, value);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexP2ui (GLenum type, GLuint value)
+{
+  glVertexP2ui = (PFNGLVERTEXP2UIPROC)glewGetProcAddress((const GLubyte*)"glVertexP2ui");
+  glVertexP2ui(type, value);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexP2uiv (GLenum type, const GLuint* value)
+{
+  glVertexP2uiv = (PFNGLVERTEXP2UIVPROC)glewGetProcAddress((const GLubyte*)"glVertexP2uiv");
+  glVertexP2uiv(type, value);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexP3ui (GLenum type, GLuint value)
+{
+  glVertexP3ui = (PFNGLVERTEXP3UIPROC)glewGetProcAddress((const GLubyte*)"glVertexP3ui");
+  glVertexP3ui(type, value);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexP3uiv (GLenum type, const GLuint* value)
+{
+  glVertexP3uiv = (PFNGLVERTEXP3UIVPROC)glewGetProcAddress((const GLubyte*)"glVertexP3uiv");
+  glVertexP3uiv(type, value);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexP4ui (GLenum type, GLuint value)
+{
+  glVertexP4ui = (PFNGLVERTEXP4UIPROC)glewGetProcAddress((const GLubyte*)"glVertexP4ui");
+  glVertexP4ui(type, value);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexP4uiv (GLenum type, const GLuint* value)
+{
+  glVertexP4uiv = (PFNGLVERTEXP4UIVPROC)glewGetProcAddress((const GLubyte*)"glVertexP4uiv");
+  glVertexP4uiv(type, value);
+}
+
+
+static void GLAPIENTRY _glewLazy_glDepthRangeArrayv (GLuint first, GLsizei count, const GLclampd * v)
+{
+  glDepthRangeArrayv = (PFNGLDEPTHRANGEARRAYVPROC)glewGetProcAddress((const GLubyte*)"glDepthRangeArrayv");
+  glDepthRangeArrayv(first, count, v);
+}
+
+static void GLAPIENTRY _glewLazy_glDepthRangeIndexed (GLuint index, GLclampd n, GLclampd f)
+{
+  glDepthRangeIndexed = (PFNGLDEPTHRANGEINDEXEDPROC)glewGetProcAddress((const GLubyte*)"glDepthRangeIndexed");
+  glDepthRangeIndexed(index, n, f);
+}
+
+static void GLAPIENTRY _glewLazy_glGetDoublei_v (GLenum target, GLuint index, GLdouble* data)
+{
+  glGetDoublei_v = (PFNGLGETDOUBLEI_VPROC)glewGetProcAddress((const GLubyte*)"glGetDoublei_v");
+  glGetDoublei_v(target, index, data);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFloati_v (GLenum target, GLuint index, GLfloat* data)
+{
+  glGetFloati_v = (PFNGLGETFLOATI_VPROC)glewGetProcAddress((const GLubyte*)"glGetFloati_v");
+  glGetFloati_v(target, index, data);
+}
+
+static void GLAPIENTRY _glewLazy_glScissorArrayv (GLuint first, GLsizei count, const GLint * v)
+{
+  glScissorArrayv = (PFNGLSCISSORARRAYVPROC)glewGetProcAddress((const GLubyte*)"glScissorArrayv");
+  glScissorArrayv(first, count, v);
+}
+
+static void GLAPIENTRY _glewLazy_glScissorIndexed (GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei height)
+{
+  glScissorIndexed = (PFNGLSCISSORINDEXEDPROC)glewGetProcAddress((const GLubyte*)"glScissorIndexed");
+  glScissorIndexed(index, left, bottom, width, height);
+}
+
+static void GLAPIENTRY _glewLazy_glScissorIndexedv (GLuint index, const GLint * v)
+{
+  glScissorIndexedv = (PFNGLSCISSORINDEXEDVPROC)glewGetProcAddress((const GLubyte*)"glScissorIndexedv");
+  glScissorIndexedv(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glViewportArrayv (GLuint first, GLsizei count, const GLfloat * v)
+{
+  glViewportArrayv = (PFNGLVIEWPORTARRAYVPROC)glewGetProcAddress((const GLubyte*)"glViewportArrayv");
+  glViewportArrayv(first, count, v);
+}
+
+static void GLAPIENTRY _glewLazy_glViewportIndexedf (GLuint index, GLfloat x, GLfloat y, GLfloat w, GLfloat h)
+{
+  glViewportIndexedf = (PFNGLVIEWPORTINDEXEDFPROC)glewGetProcAddress((const GLubyte*)"glViewportIndexedf");
+  glViewportIndexedf(index, x, y, w, h);
+}
+
+static void GLAPIENTRY _glewLazy_glViewportIndexedfv (GLuint index, const GLfloat * v)
+{
+  glViewportIndexedfv = (PFNGLVIEWPORTINDEXEDFVPROC)glewGetProcAddress((const GLubyte*)"glViewportIndexedfv");
+  glViewportIndexedfv(index, v);
+}
+
+
+static void GLAPIENTRY _glewLazy_glWindowPos2dARB (GLdouble x, GLdouble y)
+{
+  glWindowPos2dARB = (PFNGLWINDOWPOS2DARBPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2dARB");
+  glWindowPos2dARB(x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2dvARB (const GLdouble* p)
+{
+  glWindowPos2dvARB = (PFNGLWINDOWPOS2DVARBPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2dvARB");
+  glWindowPos2dvARB(p);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2fARB (GLfloat x, GLfloat y)
+{
+  glWindowPos2fARB = (PFNGLWINDOWPOS2FARBPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2fARB");
+  glWindowPos2fARB(x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2fvARB (const GLfloat* p)
+{
+  glWindowPos2fvARB = (PFNGLWINDOWPOS2FVARBPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2fvARB");
+  glWindowPos2fvARB(p);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2iARB (GLint x, GLint y)
+{
+  glWindowPos2iARB = (PFNGLWINDOWPOS2IARBPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2iARB");
+  glWindowPos2iARB(x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2ivARB (const GLint* p)
+{
+  glWindowPos2ivARB = (PFNGLWINDOWPOS2IVARBPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2ivARB");
+  glWindowPos2ivARB(p);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2sARB (GLshort x, GLshort y)
+{
+  glWindowPos2sARB = (PFNGLWINDOWPOS2SARBPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2sARB");
+  glWindowPos2sARB(x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2svARB (const GLshort* p)
+{
+  glWindowPos2svARB = (PFNGLWINDOWPOS2SVARBPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2svARB");
+  glWindowPos2svARB(p);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3dARB (GLdouble x, GLdouble y, GLdouble z)
+{
+  glWindowPos3dARB = (PFNGLWINDOWPOS3DARBPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3dARB");
+  glWindowPos3dARB(x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3dvARB (const GLdouble* p)
+{
+  glWindowPos3dvARB = (PFNGLWINDOWPOS3DVARBPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3dvARB");
+  glWindowPos3dvARB(p);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3fARB (GLfloat x, GLfloat y, GLfloat z)
+{
+  glWindowPos3fARB = (PFNGLWINDOWPOS3FARBPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3fARB");
+  glWindowPos3fARB(x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3fvARB (const GLfloat* p)
+{
+  glWindowPos3fvARB = (PFNGLWINDOWPOS3FVARBPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3fvARB");
+  glWindowPos3fvARB(p);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3iARB (GLint x, GLint y, GLint z)
+{
+  glWindowPos3iARB = (PFNGLWINDOWPOS3IARBPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3iARB");
+  glWindowPos3iARB(x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3ivARB (const GLint* p)
+{
+  glWindowPos3ivARB = (PFNGLWINDOWPOS3IVARBPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3ivARB");
+  glWindowPos3ivARB(p);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3sARB (GLshort x, GLshort y, GLshort z)
+{
+  glWindowPos3sARB = (PFNGLWINDOWPOS3SARBPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3sARB");
+  glWindowPos3sARB(x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3svARB (const GLshort* p)
+{
+  glWindowPos3svARB = (PFNGLWINDOWPOS3SVARBPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3svARB");
+  glWindowPos3svARB(p);
+}
+
+
+static void GLAPIENTRY _glewLazy_glDrawBuffersATI (GLsizei n, const GLenum* bufs)
+{
+  glDrawBuffersATI = (PFNGLDRAWBUFFERSATIPROC)glewGetProcAddress((const GLubyte*)"glDrawBuffersATI");
+  glDrawBuffersATI(n, bufs);
+}
+
+
+static void GLAPIENTRY _glewLazy_glDrawElementArrayATI (GLenum mode, GLsizei count)
+{
+  glDrawElementArrayATI = (PFNGLDRAWELEMENTARRAYATIPROC)glewGetProcAddress((const GLubyte*)"glDrawElementArrayATI");
+  glDrawElementArrayATI(mode, count);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawRangeElementArrayATI (GLenum mode, GLuint start, GLuint end, GLsizei count)
+{
+  glDrawRangeElementArrayATI = (PFNGLDRAWRANGEELEMENTARRAYATIPROC)glewGetProcAddress((const GLubyte*)"glDrawRangeElementArrayATI");
+  glDrawRangeElementArrayATI(mode, start, end, count);
+}
+
+static void GLAPIENTRY _glewLazy_glElementPointerATI (GLenum type, const void *pointer)
+{
+  glElementPointerATI = (PFNGLELEMENTPOINTERATIPROC)glewGetProcAddress((const GLubyte*)"glElementPointerATI");
+  glElementPointerATI(type, pointer);
+}
+
+
+static void GLAPIENTRY _glewLazy_glGetTexBumpParameterfvATI (GLenum pname, GLfloat *param)
+{
+  glGetTexBumpParameterfvATI = (PFNGLGETTEXBUMPPARAMETERFVATIPROC)glewGetProcAddress((const GLubyte*)"glGetTexBumpParameterfvATI");
+  glGetTexBumpParameterfvATI(pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTexBumpParameterivATI (GLenum pname, GLint *param)
+{
+  glGetTexBumpParameterivATI = (PFNGLGETTEXBUMPPARAMETERIVATIPROC)glewGetProcAddress((const GLubyte*)"glGetTexBumpParameterivATI");
+  glGetTexBumpParameterivATI(pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glTexBumpParameterfvATI (GLenum pname, GLfloat *param)
+{
+  glTexBumpParameterfvATI = (PFNGLTEXBUMPPARAMETERFVATIPROC)glewGetProcAddress((const GLubyte*)"glTexBumpParameterfvATI");
+  glTexBumpParameterfvATI(pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glTexBumpParameterivATI (GLenum pname, GLint *param)
+{
+  glTexBumpParameterivATI = (PFNGLTEXBUMPPARAMETERIVATIPROC)glewGetProcAddress((const GLubyte*)"glTexBumpParameterivATI");
+  glTexBumpParameterivATI(pname, param);
+}
+
+
+static void GLAPIENTRY _glewLazy_glAlphaFragmentOp1ATI (GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod)
+{
+  glAlphaFragmentOp1ATI = (PFNGLALPHAFRAGMENTOP1ATIPROC)glewGetProcAddress((const GLubyte*)"glAlphaFragmentOp1ATI");
+  glAlphaFragmentOp1ATI(op, dst, dstMod, arg1, arg1Rep, arg1Mod);
+}
+
+static void GLAPIENTRY _glewLazy_glAlphaFragmentOp2ATI (GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod)
+{
+  glAlphaFragmentOp2ATI = (PFNGLALPHAFRAGMENTOP2ATIPROC)glewGetProcAddress((const GLubyte*)"glAlphaFragmentOp2ATI");
+  glAlphaFragmentOp2ATI(op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod);
+}
+
+static void GLAPIENTRY _glewLazy_glAlphaFragmentOp3ATI (GLenum op, GLuint dst, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod)
+{
+  glAlphaFragmentOp3ATI = (PFNGLALPHAFRAGMENTOP3ATIPROC)glewGetProcAddress((const GLubyte*)"glAlphaFragmentOp3ATI");
+  glAlphaFragmentOp3ATI(op, dst, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod);
+}
+
+static void GLAPIENTRY _glewLazy_glBeginFragmentShaderATI (void)
+{
+  glBeginFragmentShaderATI = (PFNGLBEGINFRAGMENTSHADERATIPROC)glewGetProcAddress((const GLubyte*)"glBeginFragmentShaderATI");
+  glBeginFragmentShaderATI();
+}
+
+static void GLAPIENTRY _glewLazy_glBindFragmentShaderATI (GLuint id)
+{
+  glBindFragmentShaderATI = (PFNGLBINDFRAGMENTSHADERATIPROC)glewGetProcAddress((const GLubyte*)"glBindFragmentShaderATI");
+  glBindFragmentShaderATI(id);
+}
+
+static void GLAPIENTRY _glewLazy_glColorFragmentOp1ATI (GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod)
+{
+  glColorFragmentOp1ATI = (PFNGLCOLORFRAGMENTOP1ATIPROC)glewGetProcAddress((const GLubyte*)"glColorFragmentOp1ATI");
+  glColorFragmentOp1ATI(op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod);
+}
+
+static void GLAPIENTRY _glewLazy_glColorFragmentOp2ATI (GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod)
+{
+  glColorFragmentOp2ATI = (PFNGLCOLORFRAGMENTOP2ATIPROC)glewGetProcAddress((const GLubyte*)"glColorFragmentOp2ATI");
+  glColorFragmentOp2ATI(op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod);
+}
+
+static void GLAPIENTRY _glewLazy_glColorFragmentOp3ATI (GLenum op, GLuint dst, GLuint dstMask, GLuint dstMod, GLuint arg1, GLuint arg1Rep, GLuint arg1Mod, GLuint arg2, GLuint arg2Rep, GLuint arg2Mod, GLuint arg3, GLuint arg3Rep, GLuint arg3Mod)
+{
+  glColorFragmentOp3ATI = (PFNGLCOLORFRAGMENTOP3ATIPROC)glewGetProcAddress((const GLubyte*)"glColorFragmentOp3ATI");
+  glColorFragmentOp3ATI(op, dst, dstMask, dstMod, arg1, arg1Rep, arg1Mod, arg2, arg2Rep, arg2Mod, arg3, arg3Rep, arg3Mod);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteFragmentShaderATI (GLuint id)
+{
+  glDeleteFragmentShaderATI = (PFNGLDELETEFRAGMENTSHADERATIPROC)glewGetProcAddress((const GLubyte*)"glDeleteFragmentShaderATI");
+  glDeleteFragmentShaderATI(id);
+}
+
+static void GLAPIENTRY _glewLazy_glEndFragmentShaderATI (void)
+{
+  glEndFragmentShaderATI = (PFNGLENDFRAGMENTSHADERATIPROC)glewGetProcAddress((const GLubyte*)"glEndFragmentShaderATI");
+  glEndFragmentShaderATI();
+}
+
+static GLuint GLAPIENTRY _glewLazy_glGenFragmentShadersATI (GLuint range)
+{
+  glGenFragmentShadersATI = (PFNGLGENFRAGMENTSHADERSATIPROC)glewGetProcAddress((const GLubyte*)"glGenFragmentShadersATI");
+  return glGenFragmentShadersATI(range);
+}
+
+static void GLAPIENTRY _glewLazy_glPassTexCoordATI (GLuint dst, GLuint coord, GLenum swizzle)
+{
+  glPassTexCoordATI = (PFNGLPASSTEXCOORDATIPROC)glewGetProcAddress((const GLubyte*)"glPassTexCoordATI");
+  glPassTexCoordATI(dst, coord, swizzle);
+}
+
+static void GLAPIENTRY _glewLazy_glSampleMapATI (GLuint dst, GLuint interp, GLenum swizzle)
+{
+  glSampleMapATI = (PFNGLSAMPLEMAPATIPROC)glewGetProcAddress((const GLubyte*)"glSampleMapATI");
+  glSampleMapATI(dst, interp, swizzle);
+}
+
+static void GLAPIENTRY _glewLazy_glSetFragmentShaderConstantATI (GLuint dst, const GLfloat* value)
+{
+  glSetFragmentShaderConstantATI = (PFNGLSETFRAGMENTSHADERCONSTANTATIPROC)glewGetProcAddress((const GLubyte*)"glSetFragmentShaderConstantATI");
+  glSetFragmentShaderConstantATI(dst, value);
+}
+
+
+static void * GLAPIENTRY _glewLazy_glMapObjectBufferATI (GLuint buffer)
+{
+  glMapObjectBufferATI = (PFNGLMAPOBJECTBUFFERATIPROC)glewGetProcAddress((const GLubyte*)"glMapObjectBufferATI");
+  return glMapObjectBufferATI(buffer);
+}
+
+static void GLAPIENTRY _glewLazy_glUnmapObjectBufferATI (GLuint buffer)
+{
+  glUnmapObjectBufferATI = (PFNGLUNMAPOBJECTBUFFERATIPROC)glewGetProcAddress((const GLubyte*)"glUnmapObjectBufferATI");
+  glUnmapObjectBufferATI(buffer);
+}
+
+
+static void GLAPIENTRY _glewLazy_glPNTrianglesfATI (GLenum pname, GLfloat param)
+{
+  glPNTrianglesfATI = (PFNGLPNTRIANGLESFATIPROC)glewGetProcAddress((const GLubyte*)"glPNTrianglesfATI");
+  glPNTrianglesfATI(pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glPNTrianglesiATI (GLenum pname, GLint param)
+{
+  glPNTrianglesiATI = (PFNGLPNTRIANGLESIATIPROC)glewGetProcAddress((const GLubyte*)"glPNTrianglesiATI");
+  glPNTrianglesiATI(pname, param);
+}
+
+
+static void GLAPIENTRY _glewLazy_glStencilFuncSeparateATI (GLenum frontfunc, GLenum backfunc, GLint ref, GLuint mask)
+{
+  glStencilFuncSeparateATI = (PFNGLSTENCILFUNCSEPARATEATIPROC)glewGetProcAddress((const GLubyte*)"glStencilFuncSeparateATI");
+  glStencilFuncSeparateATI(frontfunc, backfunc, ref, mask);
+}
+
+static void GLAPIENTRY _glewLazy_glStencilOpSeparateATI (GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass)
+{
+  glStencilOpSeparateATI = (PFNGLSTENCILOPSEPARATEATIPROC)glewGetProcAddress((const GLubyte*)"glStencilOpSeparateATI");
+  glStencilOpSeparateATI(face, sfail, dpfail, dppass);
+}
+
+
+static void GLAPIENTRY _glewLazy_glArrayObjectATI (GLenum array, GLint size, GLenum type, GLsizei stride, GLuint buffer, GLuint offset)
+{
+  glArrayObjectATI = (PFNGLARRAYOBJECTATIPROC)glewGetProcAddress((const GLubyte*)"glArrayObjectATI");
+  glArrayObjectATI(array, size, type, stride, buffer, offset);
+}
+
+static void GLAPIENTRY _glewLazy_glFreeObjectBufferATI (GLuint buffer)
+{
+  glFreeObjectBufferATI = (PFNGLFREEOBJECTBUFFERATIPROC)glewGetProcAddress((const GLubyte*)"glFreeObjectBufferATI");
+  glFreeObjectBufferATI(buffer);
+}
+
+static void GLAPIENTRY _glewLazy_glGetArrayObjectfvATI (GLenum array, GLenum pname, GLfloat* params)
+{
+  glGetArrayObjectfvATI = (PFNGLGETARRAYOBJECTFVATIPROC)glewGetProcAddress((const GLubyte*)"glGetArrayObjectfvATI");
+  glGetArrayObjectfvATI(array, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetArrayObjectivATI (GLenum array, GLenum pname, GLint* params)
+{
+  glGetArrayObjectivATI = (PFNGLGETARRAYOBJECTIVATIPROC)glewGetProcAddress((const GLubyte*)"glGetArrayObjectivATI");
+  glGetArrayObjectivATI(array, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetObjectBufferfvATI (GLuint buffer, GLenum pname, GLfloat* params)
+{
+  glGetObjectBufferfvATI = (PFNGLGETOBJECTBUFFERFVATIPROC)glewGetProcAddress((const GLubyte*)"glGetObjectBufferfvATI");
+  glGetObjectBufferfvATI(buffer, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetObjectBufferivATI (GLuint buffer, GLenum pname, GLint* params)
+{
+  glGetObjectBufferivATI = (PFNGLGETOBJECTBUFFERIVATIPROC)glewGetProcAddress((const GLubyte*)"glGetObjectBufferivATI");
+  glGetObjectBufferivATI(buffer, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVariantArrayObjectfvATI (GLuint id, GLenum pname, GLfloat* params)
+{
+  glGetVariantArrayObjectfvATI = (PFNGLGETVARIANTARRAYOBJECTFVATIPROC)glewGetProcAddress((const GLubyte*)"glGetVariantArrayObjectfvATI");
+  glGetVariantArrayObjectfvATI(id, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVariantArrayObjectivATI (GLuint id, GLenum pname, GLint* params)
+{
+  glGetVariantArrayObjectivATI = (PFNGLGETVARIANTARRAYOBJECTIVATIPROC)glewGetProcAddress((const GLubyte*)"glGetVariantArrayObjectivATI");
+  glGetVariantArrayObjectivATI(id, pname, params);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsObjectBufferATI (GLuint buffer)
+{
+  glIsObjectBufferATI = (PFNGLISOBJECTBUFFERATIPROC)glewGetProcAddress((const GLubyte*)"glIsObjectBufferATI");
+  return glIsObjectBufferATI(buffer);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glNewObjectBufferATI (GLsizei size, const void *pointer, GLenum usage)
+{
+  glNewObjectBufferATI = (PFNGLNEWOBJECTBUFFERATIPROC)glewGetProcAddress((const GLubyte*)"glNewObjectBufferATI");
+  return glNewObjectBufferATI(size, pointer, usage);
+}
+
+static void GLAPIENTRY _glewLazy_glUpdateObjectBufferATI (GLuint buffer, GLuint offset, GLsizei size, const void *pointer, GLenum preserve)
+{
+  glUpdateObjectBufferATI = (PFNGLUPDATEOBJECTBUFFERATIPROC)glewGetProcAddress((const GLubyte*)"glUpdateObjectBufferATI");
+  glUpdateObjectBufferATI(buffer, offset, size, pointer, preserve);
+}
+
+static void GLAPIENTRY _glewLazy_glVariantArrayObjectATI (GLuint id, GLenum type, GLsizei stride, GLuint buffer, GLuint offset)
+{
+  glVariantArrayObjectATI = (PFNGLVARIANTARRAYOBJECTATIPROC)glewGetProcAddress((const GLubyte*)"glVariantArrayObjectATI");
+  glVariantArrayObjectATI(id, type, stride, buffer, offset);
+}
+
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribArrayObjectfvATI (GLuint index, GLenum pname, GLfloat* params)
+{
+  glGetVertexAttribArrayObjectfvATI = (PFNGLGETVERTEXATTRIBARRAYOBJECTFVATIPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribArrayObjectfvATI");
+  glGetVertexAttribArrayObjectfvATI(index, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribArrayObjectivATI (GLuint index, GLenum pname, GLint* params)
+{
+  glGetVertexAttribArrayObjectivATI = (PFNGLGETVERTEXATTRIBARRAYOBJECTIVATIPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribArrayObjectivATI");
+  glGetVertexAttribArrayObjectivATI(index, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribArrayObjectATI (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, GLuint buffer, GLuint offset)
+{
+  glVertexAttribArrayObjectATI = (PFNGLVERTEXATTRIBARRAYOBJECTATIPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribArrayObjectATI");
+  glVertexAttribArrayObjectATI(index, size, type, normalized, stride, buffer, offset);
+}
+
+
+static void GLAPIENTRY _glewLazy_glClientActiveVertexStreamATI (GLenum stream)
+{
+  glClientActiveVertexStreamATI = (PFNGLCLIENTACTIVEVERTEXSTREAMATIPROC)glewGetProcAddress((const GLubyte*)"glClientActiveVertexStreamATI");
+  glClientActiveVertexStreamATI(stream);
+}
+
+static void GLAPIENTRY _glewLazy_glNormalStream3bATI (GLenum stream, GLbyte x, GLbyte y, GLbyte z)
+{
+  glNormalStream3bATI = (PFNGLNORMALSTREAM3BATIPROC)glewGetProcAddress((const GLubyte*)"glNormalStream3bATI");
+  glNormalStream3bATI(stream, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glNormalStream3bvATI (GLenum stream, const GLbyte *coords)
+{
+  glNormalStream3bvATI = (PFNGLNORMALSTREAM3BVATIPROC)glewGetProcAddress((const GLubyte*)"glNormalStream3bvATI");
+  glNormalStream3bvATI(stream, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glNormalStream3dATI (GLenum stream, GLdouble x, GLdouble y, GLdouble z)
+{
+  glNormalStream3dATI = (PFNGLNORMALSTREAM3DATIPROC)glewGetProcAddress((const GLubyte*)"glNormalStream3dATI");
+  glNormalStream3dATI(stream, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glNormalStream3dvATI (GLenum stream, const GLdouble *coords)
+{
+  glNormalStream3dvATI = (PFNGLNORMALSTREAM3DVATIPROC)glewGetProcAddress((const GLubyte*)"glNormalStream3dvATI");
+  glNormalStream3dvATI(stream, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glNormalStream3fATI (GLenum stream, GLfloat x, GLfloat y, GLfloat z)
+{
+  glNormalStream3fATI = (PFNGLNORMALSTREAM3FATIPROC)glewGetProcAddress((const GLubyte*)"glNormalStream3fATI");
+  glNormalStream3fATI(stream, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glNormalStream3fvATI (GLenum stream, const GLfloat *coords)
+{
+  glNormalStream3fvATI = (PFNGLNORMALSTREAM3FVATIPROC)glewGetProcAddress((const GLubyte*)"glNormalStream3fvATI");
+  glNormalStream3fvATI(stream, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glNormalStream3iATI (GLenum stream, GLint x, GLint y, GLint z)
+{
+  glNormalStream3iATI = (PFNGLNORMALSTREAM3IATIPROC)glewGetProcAddress((const GLubyte*)"glNormalStream3iATI");
+  glNormalStream3iATI(stream, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glNormalStream3ivATI (GLenum stream, const GLint *coords)
+{
+  glNormalStream3ivATI = (PFNGLNORMALSTREAM3IVATIPROC)glewGetProcAddress((const GLubyte*)"glNormalStream3ivATI");
+  glNormalStream3ivATI(stream, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glNormalStream3sATI (GLenum stream, GLshort x, GLshort y, GLshort z)
+{
+  glNormalStream3sATI = (PFNGLNORMALSTREAM3SATIPROC)glewGetProcAddress((const GLubyte*)"glNormalStream3sATI");
+  glNormalStream3sATI(stream, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glNormalStream3svATI (GLenum stream, const GLshort *coords)
+{
+  glNormalStream3svATI = (PFNGLNORMALSTREAM3SVATIPROC)glewGetProcAddress((const GLubyte*)"glNormalStream3svATI");
+  glNormalStream3svATI(stream, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexBlendEnvfATI (GLenum pname, GLfloat param)
+{
+  glVertexBlendEnvfATI = (PFNGLVERTEXBLENDENVFATIPROC)glewGetProcAddress((const GLubyte*)"glVertexBlendEnvfATI");
+  glVertexBlendEnvfATI(pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexBlendEnviATI (GLenum pname, GLint param)
+{
+  glVertexBlendEnviATI = (PFNGLVERTEXBLENDENVIATIPROC)glewGetProcAddress((const GLubyte*)"glVertexBlendEnviATI");
+  glVertexBlendEnviATI(pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream1dATI (GLenum stream, GLdouble x)
+{
+  glVertexStream1dATI = (PFNGLVERTEXSTREAM1DATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream1dATI");
+  glVertexStream1dATI(stream, x);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream1dvATI (GLenum stream, const GLdouble *coords)
+{
+  glVertexStream1dvATI = (PFNGLVERTEXSTREAM1DVATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream1dvATI");
+  glVertexStream1dvATI(stream, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream1fATI (GLenum stream, GLfloat x)
+{
+  glVertexStream1fATI = (PFNGLVERTEXSTREAM1FATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream1fATI");
+  glVertexStream1fATI(stream, x);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream1fvATI (GLenum stream, const GLfloat *coords)
+{
+  glVertexStream1fvATI = (PFNGLVERTEXSTREAM1FVATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream1fvATI");
+  glVertexStream1fvATI(stream, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream1iATI (GLenum stream, GLint x)
+{
+  glVertexStream1iATI = (PFNGLVERTEXSTREAM1IATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream1iATI");
+  glVertexStream1iATI(stream, x);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream1ivATI (GLenum stream, const GLint *coords)
+{
+  glVertexStream1ivATI = (PFNGLVERTEXSTREAM1IVATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream1ivATI");
+  glVertexStream1ivATI(stream, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream1sATI (GLenum stream, GLshort x)
+{
+  glVertexStream1sATI = (PFNGLVERTEXSTREAM1SATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream1sATI");
+  glVertexStream1sATI(stream, x);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream1svATI (GLenum stream, const GLshort *coords)
+{
+  glVertexStream1svATI = (PFNGLVERTEXSTREAM1SVATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream1svATI");
+  glVertexStream1svATI(stream, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream2dATI (GLenum stream, GLdouble x, GLdouble y)
+{
+  glVertexStream2dATI = (PFNGLVERTEXSTREAM2DATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream2dATI");
+  glVertexStream2dATI(stream, x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream2dvATI (GLenum stream, const GLdouble *coords)
+{
+  glVertexStream2dvATI = (PFNGLVERTEXSTREAM2DVATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream2dvATI");
+  glVertexStream2dvATI(stream, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream2fATI (GLenum stream, GLfloat x, GLfloat y)
+{
+  glVertexStream2fATI = (PFNGLVERTEXSTREAM2FATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream2fATI");
+  glVertexStream2fATI(stream, x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream2fvATI (GLenum stream, const GLfloat *coords)
+{
+  glVertexStream2fvATI = (PFNGLVERTEXSTREAM2FVATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream2fvATI");
+  glVertexStream2fvATI(stream, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream2iATI (GLenum stream, GLint x, GLint y)
+{
+  glVertexStream2iATI = (PFNGLVERTEXSTREAM2IATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream2iATI");
+  glVertexStream2iATI(stream, x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream2ivATI (GLenum stream, const GLint *coords)
+{
+  glVertexStream2ivATI = (PFNGLVERTEXSTREAM2IVATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream2ivATI");
+  glVertexStream2ivATI(stream, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream2sATI (GLenum stream, GLshort x, GLshort y)
+{
+  glVertexStream2sATI = (PFNGLVERTEXSTREAM2SATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream2sATI");
+  glVertexStream2sATI(stream, x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream2svATI (GLenum stream, const GLshort *coords)
+{
+  glVertexStream2svATI = (PFNGLVERTEXSTREAM2SVATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream2svATI");
+  glVertexStream2svATI(stream, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream3dATI (GLenum stream, GLdouble x, GLdouble y, GLdouble z)
+{
+  glVertexStream3dATI = (PFNGLVERTEXSTREAM3DATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream3dATI");
+  glVertexStream3dATI(stream, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream3dvATI (GLenum stream, const GLdouble *coords)
+{
+  glVertexStream3dvATI = (PFNGLVERTEXSTREAM3DVATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream3dvATI");
+  glVertexStream3dvATI(stream, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream3fATI (GLenum stream, GLfloat x, GLfloat y, GLfloat z)
+{
+  glVertexStream3fATI = (PFNGLVERTEXSTREAM3FATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream3fATI");
+  glVertexStream3fATI(stream, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream3fvATI (GLenum stream, const GLfloat *coords)
+{
+  glVertexStream3fvATI = (PFNGLVERTEXSTREAM3FVATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream3fvATI");
+  glVertexStream3fvATI(stream, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream3iATI (GLenum stream, GLint x, GLint y, GLint z)
+{
+  glVertexStream3iATI = (PFNGLVERTEXSTREAM3IATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream3iATI");
+  glVertexStream3iATI(stream, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream3ivATI (GLenum stream, const GLint *coords)
+{
+  glVertexStream3ivATI = (PFNGLVERTEXSTREAM3IVATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream3ivATI");
+  glVertexStream3ivATI(stream, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream3sATI (GLenum stream, GLshort x, GLshort y, GLshort z)
+{
+  glVertexStream3sATI = (PFNGLVERTEXSTREAM3SATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream3sATI");
+  glVertexStream3sATI(stream, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream3svATI (GLenum stream, const GLshort *coords)
+{
+  glVertexStream3svATI = (PFNGLVERTEXSTREAM3SVATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream3svATI");
+  glVertexStream3svATI(stream, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream4dATI (GLenum stream, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+  glVertexStream4dATI = (PFNGLVERTEXSTREAM4DATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream4dATI");
+  glVertexStream4dATI(stream, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream4dvATI (GLenum stream, const GLdouble *coords)
+{
+  glVertexStream4dvATI = (PFNGLVERTEXSTREAM4DVATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream4dvATI");
+  glVertexStream4dvATI(stream, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream4fATI (GLenum stream, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+  glVertexStream4fATI = (PFNGLVERTEXSTREAM4FATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream4fATI");
+  glVertexStream4fATI(stream, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream4fvATI (GLenum stream, const GLfloat *coords)
+{
+  glVertexStream4fvATI = (PFNGLVERTEXSTREAM4FVATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream4fvATI");
+  glVertexStream4fvATI(stream, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream4iATI (GLenum stream, GLint x, GLint y, GLint z, GLint w)
+{
+  glVertexStream4iATI = (PFNGLVERTEXSTREAM4IATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream4iATI");
+  glVertexStream4iATI(stream, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream4ivATI (GLenum stream, const GLint *coords)
+{
+  glVertexStream4ivATI = (PFNGLVERTEXSTREAM4IVATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream4ivATI");
+  glVertexStream4ivATI(stream, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream4sATI (GLenum stream, GLshort x, GLshort y, GLshort z, GLshort w)
+{
+  glVertexStream4sATI = (PFNGLVERTEXSTREAM4SATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream4sATI");
+  glVertexStream4sATI(stream, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexStream4svATI (GLenum stream, const GLshort *coords)
+{
+  glVertexStream4svATI = (PFNGLVERTEXSTREAM4SVATIPROC)glewGetProcAddress((const GLubyte*)"glVertexStream4svATI");
+  glVertexStream4svATI(stream, coords);
+}
+
+
+static GLint GLAPIENTRY _glewLazy_glGetUniformBufferSizeEXT (GLuint program, GLint location)
+{
+  glGetUniformBufferSizeEXT = (PFNGLGETUNIFORMBUFFERSIZEEXTPROC)glewGetProcAddress((const GLubyte*)"glGetUniformBufferSizeEXT");
+  return glGetUniformBufferSizeEXT(program, location);
+}
+
+static GLintptr GLAPIENTRY _glewLazy_glGetUniformOffsetEXT (GLuint program, GLint location)
+{
+  glGetUniformOffsetEXT = (PFNGLGETUNIFORMOFFSETEXTPROC)glewGetProcAddress((const GLubyte*)"glGetUniformOffsetEXT");
+  return glGetUniformOffsetEXT(program, location);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformBufferEXT (GLuint program, GLint location, GLuint buffer)
+{
+  glUniformBufferEXT = (PFNGLUNIFORMBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glUniformBufferEXT");
+  glUniformBufferEXT(program, location, buffer);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBlendColorEXT (GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha)
+{
+  glBlendColorEXT = (PFNGLBLENDCOLOREXTPROC)glewGetProcAddress((const GLubyte*)"glBlendColorEXT");
+  glBlendColorEXT(red, green, blue, alpha);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBlendEquationSeparateEXT (GLenum modeRGB, GLenum modeAlpha)
+{
+  glBlendEquationSeparateEXT = (PFNGLBLENDEQUATIONSEPARATEEXTPROC)glewGetProcAddress((const GLubyte*)"glBlendEquationSeparateEXT");
+  glBlendEquationSeparateEXT(modeRGB, modeAlpha);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBlendFuncSeparateEXT (GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha)
+{
+  glBlendFuncSeparateEXT = (PFNGLBLENDFUNCSEPARATEEXTPROC)glewGetProcAddress((const GLubyte*)"glBlendFuncSeparateEXT");
+  glBlendFuncSeparateEXT(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBlendEquationEXT (GLenum mode)
+{
+  glBlendEquationEXT = (PFNGLBLENDEQUATIONEXTPROC)glewGetProcAddress((const GLubyte*)"glBlendEquationEXT");
+  glBlendEquationEXT(mode);
+}
+
+
+static void GLAPIENTRY _glewLazy_glColorSubTableEXT (GLenum target, GLsizei start, GLsizei count, GLenum format, GLenum type, const void *data)
+{
+  glColorSubTableEXT = (PFNGLCOLORSUBTABLEEXTPROC)glewGetProcAddress((const GLubyte*)"glColorSubTableEXT");
+  glColorSubTableEXT(target, start, count, format, type, data);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyColorSubTableEXT (GLenum target, GLsizei start, GLint x, GLint y, GLsizei width)
+{
+  glCopyColorSubTableEXT = (PFNGLCOPYCOLORSUBTABLEEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyColorSubTableEXT");
+  glCopyColorSubTableEXT(target, start, x, y, width);
+}
+
+
+static void GLAPIENTRY _glewLazy_glLockArraysEXT (GLint first, GLsizei count)
+{
+  glLockArraysEXT = (PFNGLLOCKARRAYSEXTPROC)glewGetProcAddress((const GLubyte*)"glLockArraysEXT");
+  glLockArraysEXT(first, count);
+}
+
+static void GLAPIENTRY _glewLazy_glUnlockArraysEXT (void)
+{
+  glUnlockArraysEXT = (PFNGLUNLOCKARRAYSEXTPROC)glewGetProcAddress((const GLubyte*)"glUnlockArraysEXT");
+  glUnlockArraysEXT();
+}
+
+
+static void GLAPIENTRY _glewLazy_glConvolutionFilter1DEXT (GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const void *image)
+{
+  glConvolutionFilter1DEXT = (PFNGLCONVOLUTIONFILTER1DEXTPROC)glewGetProcAddress((const GLubyte*)"glConvolutionFilter1DEXT");
+  glConvolutionFilter1DEXT(target, internalformat, width, format, type, image);
+}
+
+static void GLAPIENTRY _glewLazy_glConvolutionFilter2DEXT (GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *image)
+{
+  glConvolutionFilter2DEXT = (PFNGLCONVOLUTIONFILTER2DEXTPROC)glewGetProcAddress((const GLubyte*)"glConvolutionFilter2DEXT");
+  glConvolutionFilter2DEXT(target, internalformat, width, height, format, type, image);
+}
+
+static void GLAPIENTRY _glewLazy_glConvolutionParameterfEXT (GLenum target, GLenum pname, GLfloat param)
+{
+  glConvolutionParameterfEXT = (PFNGLCONVOLUTIONPARAMETERFEXTPROC)glewGetProcAddress((const GLubyte*)"glConvolutionParameterfEXT");
+  glConvolutionParameterfEXT(target, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glConvolutionParameterfvEXT (GLenum target, GLenum pname, const GLfloat* params)
+{
+  glConvolutionParameterfvEXT = (PFNGLCONVOLUTIONPARAMETERFVEXTPROC)glewGetProcAddress((const GLubyte*)"glConvolutionParameterfvEXT");
+  glConvolutionParameterfvEXT(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glConvolutionParameteriEXT (GLenum target, GLenum pname, GLint param)
+{
+  glConvolutionParameteriEXT = (PFNGLCONVOLUTIONPARAMETERIEXTPROC)glewGetProcAddress((const GLubyte*)"glConvolutionParameteriEXT");
+  glConvolutionParameteriEXT(target, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glConvolutionParameterivEXT (GLenum target, GLenum pname, const GLint* params)
+{
+  glConvolutionParameterivEXT = (PFNGLCONVOLUTIONPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glConvolutionParameterivEXT");
+  glConvolutionParameterivEXT(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyConvolutionFilter1DEXT (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width)
+{
+  glCopyConvolutionFilter1DEXT = (PFNGLCOPYCONVOLUTIONFILTER1DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyConvolutionFilter1DEXT");
+  glCopyConvolutionFilter1DEXT(target, internalformat, x, y, width);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyConvolutionFilter2DEXT (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+  glCopyConvolutionFilter2DEXT = (PFNGLCOPYCONVOLUTIONFILTER2DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyConvolutionFilter2DEXT");
+  glCopyConvolutionFilter2DEXT(target, internalformat, x, y, width, height);
+}
+
+static void GLAPIENTRY _glewLazy_glGetConvolutionFilterEXT (GLenum target, GLenum format, GLenum type, void *image)
+{
+  glGetConvolutionFilterEXT = (PFNGLGETCONVOLUTIONFILTEREXTPROC)glewGetProcAddress((const GLubyte*)"glGetConvolutionFilterEXT");
+  glGetConvolutionFilterEXT(target, format, type, image);
+}
+
+static void GLAPIENTRY _glewLazy_glGetConvolutionParameterfvEXT (GLenum target, GLenum pname, GLfloat* params)
+{
+  glGetConvolutionParameterfvEXT = (PFNGLGETCONVOLUTIONPARAMETERFVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetConvolutionParameterfvEXT");
+  glGetConvolutionParameterfvEXT(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetConvolutionParameterivEXT (GLenum target, GLenum pname, GLint* params)
+{
+  glGetConvolutionParameterivEXT = (PFNGLGETCONVOLUTIONPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetConvolutionParameterivEXT");
+  glGetConvolutionParameterivEXT(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetSeparableFilterEXT (GLenum target, GLenum format, GLenum type, void *row, void *column, void *span)
+{
+  glGetSeparableFilterEXT = (PFNGLGETSEPARABLEFILTEREXTPROC)glewGetProcAddress((const GLubyte*)"glGetSeparableFilterEXT");
+  glGetSeparableFilterEXT(target, format, type, row, column, span);
+}
+
+static void GLAPIENTRY _glewLazy_glSeparableFilter2DEXT (GLenum target, GLenum internalformat, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *row, const void *column)
+{
+  glSeparableFilter2DEXT = (PFNGLSEPARABLEFILTER2DEXTPROC)glewGetProcAddress((const GLubyte*)"glSeparableFilter2DEXT");
+  glSeparableFilter2DEXT(target, internalformat, width, height, format, type, row, column);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBinormalPointerEXT (GLenum type, GLsizei stride, void *pointer)
+{
+  glBinormalPointerEXT = (PFNGLBINORMALPOINTEREXTPROC)glewGetProcAddress((const GLubyte*)"glBinormalPointerEXT");
+  glBinormalPointerEXT(type, stride, pointer);
+}
+
+static void GLAPIENTRY _glewLazy_glTangentPointerEXT (GLenum type, GLsizei stride, void *pointer)
+{
+  glTangentPointerEXT = (PFNGLTANGENTPOINTEREXTPROC)glewGetProcAddress((const GLubyte*)"glTangentPointerEXT");
+  glTangentPointerEXT(type, stride, pointer);
+}
+
+
+static void GLAPIENTRY _glewLazy_glCopyTexImage1DEXT (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border)
+{
+  glCopyTexImage1DEXT = (PFNGLCOPYTEXIMAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyTexImage1DEXT");
+  glCopyTexImage1DEXT(target, level, internalformat, x, y, width, border);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyTexImage2DEXT (GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)
+{
+  glCopyTexImage2DEXT = (PFNGLCOPYTEXIMAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyTexImage2DEXT");
+  glCopyTexImage2DEXT(target, level, internalformat, x, y, width, height, border);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyTexSubImage1DEXT (GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+  glCopyTexSubImage1DEXT = (PFNGLCOPYTEXSUBIMAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyTexSubImage1DEXT");
+  glCopyTexSubImage1DEXT(target, level, xoffset, x, y, width);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyTexSubImage2DEXT (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+  glCopyTexSubImage2DEXT = (PFNGLCOPYTEXSUBIMAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyTexSubImage2DEXT");
+  glCopyTexSubImage2DEXT(target, level, xoffset, yoffset, x, y, width, height);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyTexSubImage3DEXT (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+  glCopyTexSubImage3DEXT = (PFNGLCOPYTEXSUBIMAGE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyTexSubImage3DEXT");
+  glCopyTexSubImage3DEXT(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+
+
+static void GLAPIENTRY _glewLazy_glCullParameterdvEXT (GLenum pname, GLdouble* params)
+{
+  glCullParameterdvEXT = (PFNGLCULLPARAMETERDVEXTPROC)glewGetProcAddress((const GLubyte*)"glCullParameterdvEXT");
+  glCullParameterdvEXT(pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glCullParameterfvEXT (GLenum pname, GLfloat* params)
+{
+  glCullParameterfvEXT = (PFNGLCULLPARAMETERFVEXTPROC)glewGetProcAddress((const GLubyte*)"glCullParameterfvEXT");
+  glCullParameterfvEXT(pname, params);
+}
+
+
+static void GLAPIENTRY _glewLazy_glGetObjectLabelEXT (GLenum type, GLuint object, GLsizei bufSize, GLsizei* length, GLchar *label)
+{
+  glGetObjectLabelEXT = (PFNGLGETOBJECTLABELEXTPROC)glewGetProcAddress((const GLubyte*)"glGetObjectLabelEXT");
+  glGetObjectLabelEXT(type, object, bufSize, length, label);
+}
+
+static void GLAPIENTRY _glewLazy_glLabelObjectEXT (GLenum type, GLuint object, GLsizei length, const GLchar* label)
+{
+  glLabelObjectEXT = (PFNGLLABELOBJECTEXTPROC)glewGetProcAddress((const GLubyte*)"glLabelObjectEXT");
+  glLabelObjectEXT(type, object, length, label);
+}
+
+
+static void GLAPIENTRY _glewLazy_glInsertEventMarkerEXT (GLsizei length, const GLchar* marker)
+{
+  glInsertEventMarkerEXT = (PFNGLINSERTEVENTMARKEREXTPROC)glewGetProcAddress((const GLubyte*)"glInsertEventMarkerEXT");
+  glInsertEventMarkerEXT(length, marker);
+}
+
+static void GLAPIENTRY _glewLazy_glPopGroupMarkerEXT (void)
+{
+  glPopGroupMarkerEXT = (PFNGLPOPGROUPMARKEREXTPROC)glewGetProcAddress((const GLubyte*)"glPopGroupMarkerEXT");
+  glPopGroupMarkerEXT();
+}
+
+static void GLAPIENTRY _glewLazy_glPushGroupMarkerEXT (GLsizei length, const GLchar* marker)
+{
+  glPushGroupMarkerEXT = (PFNGLPUSHGROUPMARKEREXTPROC)glewGetProcAddress((const GLubyte*)"glPushGroupMarkerEXT");
+  glPushGroupMarkerEXT(length, marker);
+}
+
+
+static void GLAPIENTRY _glewLazy_glDepthBoundsEXT (GLclampd zmin, GLclampd zmax)
+{
+  glDepthBoundsEXT = (PFNGLDEPTHBOUNDSEXTPROC)glewGetProcAddress((const GLubyte*)"glDepthBoundsEXT");
+  glDepthBoundsEXT(zmin, zmax);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBindMultiTextureEXT (GLenum texunit, GLenum target, GLuint texture)
+{
+  glBindMultiTextureEXT = (PFNGLBINDMULTITEXTUREEXTPROC)glewGetProcAddress((const GLubyte*)"glBindMultiTextureEXT");
+  glBindMultiTextureEXT(texunit, target, texture);
+}
+
+static GLenum GLAPIENTRY _glewLazy_glCheckNamedFramebufferStatusEXT (GLuint framebuffer, GLenum target)
+{
+  glCheckNamedFramebufferStatusEXT = (PFNGLCHECKNAMEDFRAMEBUFFERSTATUSEXTPROC)glewGetProcAddress((const GLubyte*)"glCheckNamedFramebufferStatusEXT");
+  return glCheckNamedFramebufferStatusEXT(framebuffer, target);
+}
+
+static void GLAPIENTRY _glewLazy_glClientAttribDefaultEXT (GLbitfield mask)
+{
+  glClientAttribDefaultEXT = (PFNGLCLIENTATTRIBDEFAULTEXTPROC)glewGetProcAddress((const GLubyte*)"glClientAttribDefaultEXT");
+  glClientAttribDefaultEXT(mask);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedMultiTexImage1DEXT (GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data)
+{
+  glCompressedMultiTexImage1DEXT = (PFNGLCOMPRESSEDMULTITEXIMAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glCompressedMultiTexImage1DEXT");
+  glCompressedMultiTexImage1DEXT(texunit, target, level, internalformat, width, border, imageSize, data);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedMultiTexImage2DEXT (GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data)
+{
+  glCompressedMultiTexImage2DEXT = (PFNGLCOMPRESSEDMULTITEXIMAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glCompressedMultiTexImage2DEXT");
+  glCompressedMultiTexImage2DEXT(texunit, target, level, internalformat, width, height, border, imageSize, data);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedMultiTexImage3DEXT (GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data)
+{
+  glCompressedMultiTexImage3DEXT = (PFNGLCOMPRESSEDMULTITEXIMAGE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glCompressedMultiTexImage3DEXT");
+  glCompressedMultiTexImage3DEXT(texunit, target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedMultiTexSubImage1DEXT (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data)
+{
+  glCompressedMultiTexSubImage1DEXT = (PFNGLCOMPRESSEDMULTITEXSUBIMAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glCompressedMultiTexSubImage1DEXT");
+  glCompressedMultiTexSubImage1DEXT(texunit, target, level, xoffset, width, format, imageSize, data);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedMultiTexSubImage2DEXT (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data)
+{
+  glCompressedMultiTexSubImage2DEXT = (PFNGLCOMPRESSEDMULTITEXSUBIMAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glCompressedMultiTexSubImage2DEXT");
+  glCompressedMultiTexSubImage2DEXT(texunit, target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedMultiTexSubImage3DEXT (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data)
+{
+  glCompressedMultiTexSubImage3DEXT = (PFNGLCOMPRESSEDMULTITEXSUBIMAGE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glCompressedMultiTexSubImage3DEXT");
+  glCompressedMultiTexSubImage3DEXT(texunit, target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTextureImage1DEXT (GLuint texture, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data)
+{
+  glCompressedTextureImage1DEXT = (PFNGLCOMPRESSEDTEXTUREIMAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glCompressedTextureImage1DEXT");
+  glCompressedTextureImage1DEXT(texture, target, level, internalformat, width, border, imageSize, data);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTextureImage2DEXT (GLuint texture, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data)
+{
+  glCompressedTextureImage2DEXT = (PFNGLCOMPRESSEDTEXTUREIMAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glCompressedTextureImage2DEXT");
+  glCompressedTextureImage2DEXT(texture, target, level, internalformat, width, height, border, imageSize, data);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTextureImage3DEXT (GLuint texture, GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data)
+{
+  glCompressedTextureImage3DEXT = (PFNGLCOMPRESSEDTEXTUREIMAGE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glCompressedTextureImage3DEXT");
+  glCompressedTextureImage3DEXT(texture, target, level, internalformat, width, height, depth, border, imageSize, data);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTextureSubImage1DEXT (GLuint texture, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data)
+{
+  glCompressedTextureSubImage1DEXT = (PFNGLCOMPRESSEDTEXTURESUBIMAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glCompressedTextureSubImage1DEXT");
+  glCompressedTextureSubImage1DEXT(texture, target, level, xoffset, width, format, imageSize, data);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTextureSubImage2DEXT (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data)
+{
+  glCompressedTextureSubImage2DEXT = (PFNGLCOMPRESSEDTEXTURESUBIMAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glCompressedTextureSubImage2DEXT");
+  glCompressedTextureSubImage2DEXT(texture, target, level, xoffset, yoffset, width, height, format, imageSize, data);
+}
+
+static void GLAPIENTRY _glewLazy_glCompressedTextureSubImage3DEXT (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data)
+{
+  glCompressedTextureSubImage3DEXT = (PFNGLCOMPRESSEDTEXTURESUBIMAGE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glCompressedTextureSubImage3DEXT");
+  glCompressedTextureSubImage3DEXT(texture, target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyMultiTexImage1DEXT (GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border)
+{
+  glCopyMultiTexImage1DEXT = (PFNGLCOPYMULTITEXIMAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyMultiTexImage1DEXT");
+  glCopyMultiTexImage1DEXT(texunit, target, level, internalformat, x, y, width, border);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyMultiTexImage2DEXT (GLenum texunit, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)
+{
+  glCopyMultiTexImage2DEXT = (PFNGLCOPYMULTITEXIMAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyMultiTexImage2DEXT");
+  glCopyMultiTexImage2DEXT(texunit, target, level, internalformat, x, y, width, height, border);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyMultiTexSubImage1DEXT (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+  glCopyMultiTexSubImage1DEXT = (PFNGLCOPYMULTITEXSUBIMAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyMultiTexSubImage1DEXT");
+  glCopyMultiTexSubImage1DEXT(texunit, target, level, xoffset, x, y, width);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyMultiTexSubImage2DEXT (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+  glCopyMultiTexSubImage2DEXT = (PFNGLCOPYMULTITEXSUBIMAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyMultiTexSubImage2DEXT");
+  glCopyMultiTexSubImage2DEXT(texunit, target, level, xoffset, yoffset, x, y, width, height);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyMultiTexSubImage3DEXT (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+  glCopyMultiTexSubImage3DEXT = (PFNGLCOPYMULTITEXSUBIMAGE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyMultiTexSubImage3DEXT");
+  glCopyMultiTexSubImage3DEXT(texunit, target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyTextureImage1DEXT (GLuint texture, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border)
+{
+  glCopyTextureImage1DEXT = (PFNGLCOPYTEXTUREIMAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyTextureImage1DEXT");
+  glCopyTextureImage1DEXT(texture, target, level, internalformat, x, y, width, border);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyTextureImage2DEXT (GLuint texture, GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border)
+{
+  glCopyTextureImage2DEXT = (PFNGLCOPYTEXTUREIMAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyTextureImage2DEXT");
+  glCopyTextureImage2DEXT(texture, target, level, internalformat, x, y, width, height, border);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyTextureSubImage1DEXT (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width)
+{
+  glCopyTextureSubImage1DEXT = (PFNGLCOPYTEXTURESUBIMAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyTextureSubImage1DEXT");
+  glCopyTextureSubImage1DEXT(texture, target, level, xoffset, x, y, width);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyTextureSubImage2DEXT (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+  glCopyTextureSubImage2DEXT = (PFNGLCOPYTEXTURESUBIMAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyTextureSubImage2DEXT");
+  glCopyTextureSubImage2DEXT(texture, target, level, xoffset, yoffset, x, y, width, height);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyTextureSubImage3DEXT (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+  glCopyTextureSubImage3DEXT = (PFNGLCOPYTEXTURESUBIMAGE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glCopyTextureSubImage3DEXT");
+  glCopyTextureSubImage3DEXT(texture, target, level, xoffset, yoffset, zoffset, x, y, width, height);
+}
+
+static void GLAPIENTRY _glewLazy_glDisableClientStateIndexedEXT (GLenum array, GLuint index)
+{
+  glDisableClientStateIndexedEXT = (PFNGLDISABLECLIENTSTATEINDEXEDEXTPROC)glewGetProcAddress((const GLubyte*)"glDisableClientStateIndexedEXT");
+  glDisableClientStateIndexedEXT(array, index);
+}
+
+static void GLAPIENTRY _glewLazy_glDisableClientStateiEXT (GLenum array, GLuint index)
+{
+  glDisableClientStateiEXT = (PFNGLDISABLECLIENTSTATEIEXTPROC)glewGetProcAddress((const GLubyte*)"glDisableClientStateiEXT");
+  glDisableClientStateiEXT(array, index);
+}
+
+static void GLAPIENTRY _glewLazy_glDisableVertexArrayAttribEXT (GLuint vaobj, GLuint index)
+{
+  glDisableVertexArrayAttribEXT = (PFNGLDISABLEVERTEXARRAYATTRIBEXTPROC)glewGetProcAddress((const GLubyte*)"glDisableVertexArrayAttribEXT");
+  glDisableVertexArrayAttribEXT(vaobj, index);
+}
+
+static void GLAPIENTRY _glewLazy_glDisableVertexArrayEXT (GLuint vaobj, GLenum array)
+{
+  glDisableVertexArrayEXT = (PFNGLDISABLEVERTEXARRAYEXTPROC)glewGetProcAddress((const GLubyte*)"glDisableVertexArrayEXT");
+  glDisableVertexArrayEXT(vaobj, array);
+}
+
+static void GLAPIENTRY _glewLazy_glEnableClientStateIndexedEXT (GLenum array, GLuint index)
+{
+  glEnableClientStateIndexedEXT = (PFNGLENABLECLIENTSTATEINDEXEDEXTPROC)glewGetProcAddress((const GLubyte*)"glEnableClientStateIndexedEXT");
+  glEnableClientStateIndexedEXT(array, index);
+}
+
+static void GLAPIENTRY _glewLazy_glEnableClientStateiEXT (GLenum array, GLuint index)
+{
+  glEnableClientStateiEXT = (PFNGLENABLECLIENTSTATEIEXTPROC)glewGetProcAddress((const GLubyte*)"glEnableClientStateiEXT");
+  glEnableClientStateiEXT(array, index);
+}
+
+static void GLAPIENTRY _glewLazy_glEnableVertexArrayAttribEXT (GLuint vaobj, GLuint index)
+{
+  glEnableVertexArrayAttribEXT = (PFNGLENABLEVERTEXARRAYATTRIBEXTPROC)glewGetProcAddress((const GLubyte*)"glEnableVertexArrayAttribEXT");
+  glEnableVertexArrayAttribEXT(vaobj, index);
+}
+
+static void GLAPIENTRY _glewLazy_glEnableVertexArrayEXT (GLuint vaobj, GLenum array)
+{
+  glEnableVertexArrayEXT = (PFNGLENABLEVERTEXARRAYEXTPROC)glewGetProcAddress((const GLubyte*)"glEnableVertexArrayEXT");
+  glEnableVertexArrayEXT(vaobj, array);
+}
+
+static void GLAPIENTRY _glewLazy_glFlushMappedNamedBufferRangeEXT (GLuint buffer, GLintptr offset, GLsizeiptr length)
+{
+  glFlushMappedNamedBufferRangeEXT = (PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEEXTPROC)glewGetProcAddress((const GLubyte*)"glFlushMappedNamedBufferRangeEXT");
+  glFlushMappedNamedBufferRangeEXT(buffer, offset, length);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferDrawBufferEXT (GLuint framebuffer, GLenum mode)
+{
+  glFramebufferDrawBufferEXT = (PFNGLFRAMEBUFFERDRAWBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glFramebufferDrawBufferEXT");
+  glFramebufferDrawBufferEXT(framebuffer, mode);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferDrawBuffersEXT (GLuint framebuffer, GLsizei n, const GLenum* bufs)
+{
+  glFramebufferDrawBuffersEXT = (PFNGLFRAMEBUFFERDRAWBUFFERSEXTPROC)glewGetProcAddress((const GLubyte*)"glFramebufferDrawBuffersEXT");
+  glFramebufferDrawBuffersEXT(framebuffer, n, bufs);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferReadBufferEXT (GLuint framebuffer, GLenum mode)
+{
+  glFramebufferReadBufferEXT = (PFNGLFRAMEBUFFERREADBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glFramebufferReadBufferEXT");
+  glFramebufferReadBufferEXT(framebuffer, mode);
+}
+
+static void GLAPIENTRY _glewLazy_glGenerateMultiTexMipmapEXT (GLenum texunit, GLenum target)
+{
+  glGenerateMultiTexMipmapEXT = (PFNGLGENERATEMULTITEXMIPMAPEXTPROC)glewGetProcAddress((const GLubyte*)"glGenerateMultiTexMipmapEXT");
+  glGenerateMultiTexMipmapEXT(texunit, target);
+}
+
+static void GLAPIENTRY _glewLazy_glGenerateTextureMipmapEXT (GLuint texture, GLenum target)
+{
+  glGenerateTextureMipmapEXT = (PFNGLGENERATETEXTUREMIPMAPEXTPROC)glewGetProcAddress((const GLubyte*)"glGenerateTextureMipmapEXT");
+  glGenerateTextureMipmapEXT(texture, target);
+}
+
+static void GLAPIENTRY _glewLazy_glGetCompressedMultiTexImageEXT (GLenum texunit, GLenum target, GLint level, void *img)
+{
+  glGetCompressedMultiTexImageEXT = (PFNGLGETCOMPRESSEDMULTITEXIMAGEEXTPROC)glewGetProcAddress((const GLubyte*)"glGetCompressedMultiTexImageEXT");
+  glGetCompressedMultiTexImageEXT(texunit, target, level, img);
+}
+
+static void GLAPIENTRY _glewLazy_glGetCompressedTextureImageEXT (GLuint texture, GLenum target, GLint level, void *img)
+{
+  glGetCompressedTextureImageEXT = (PFNGLGETCOMPRESSEDTEXTUREIMAGEEXTPROC)glewGetProcAddress((const GLubyte*)"glGetCompressedTextureImageEXT");
+  glGetCompressedTextureImageEXT(texture, target, level, img);
+}
+
+static void GLAPIENTRY _glewLazy_glGetDoubleIndexedvEXT (GLenum target, GLuint index, GLdouble* params)
+{
+  glGetDoubleIndexedvEXT = (PFNGLGETDOUBLEINDEXEDVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetDoubleIndexedvEXT");
+  glGetDoubleIndexedvEXT(target, index, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetDoublei_vEXT (GLenum pname, GLuint index, GLdouble* params)
+{
+  glGetDoublei_vEXT = (PFNGLGETDOUBLEI_VEXTPROC)glewGetProcAddress((const GLubyte*)"glGetDoublei_vEXT");
+  glGetDoublei_vEXT(pname, index, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFloatIndexedvEXT (GLenum target, GLuint index, GLfloat* params)
+{
+  glGetFloatIndexedvEXT = (PFNGLGETFLOATINDEXEDVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetFloatIndexedvEXT");
+  glGetFloatIndexedvEXT(target, index, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFloati_vEXT (GLenum pname, GLuint index, GLfloat* params)
+{
+  glGetFloati_vEXT = (PFNGLGETFLOATI_VEXTPROC)glewGetProcAddress((const GLubyte*)"glGetFloati_vEXT");
+  glGetFloati_vEXT(pname, index, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFramebufferParameterivEXT (GLuint framebuffer, GLenum pname, GLint* param)
+{
+  glGetFramebufferParameterivEXT = (PFNGLGETFRAMEBUFFERPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetFramebufferParameterivEXT");
+  glGetFramebufferParameterivEXT(framebuffer, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMultiTexEnvfvEXT (GLenum texunit, GLenum target, GLenum pname, GLfloat* params)
+{
+  glGetMultiTexEnvfvEXT = (PFNGLGETMULTITEXENVFVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetMultiTexEnvfvEXT");
+  glGetMultiTexEnvfvEXT(texunit, target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMultiTexEnvivEXT (GLenum texunit, GLenum target, GLenum pname, GLint* params)
+{
+  glGetMultiTexEnvivEXT = (PFNGLGETMULTITEXENVIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetMultiTexEnvivEXT");
+  glGetMultiTexEnvivEXT(texunit, target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMultiTexGendvEXT (GLenum texunit, GLenum coord, GLenum pname, GLdouble* params)
+{
+  glGetMultiTexGendvEXT = (PFNGLGETMULTITEXGENDVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetMultiTexGendvEXT");
+  glGetMultiTexGendvEXT(texunit, coord, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMultiTexGenfvEXT (GLenum texunit, GLenum coord, GLenum pname, GLfloat* params)
+{
+  glGetMultiTexGenfvEXT = (PFNGLGETMULTITEXGENFVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetMultiTexGenfvEXT");
+  glGetMultiTexGenfvEXT(texunit, coord, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMultiTexGenivEXT (GLenum texunit, GLenum coord, GLenum pname, GLint* params)
+{
+  glGetMultiTexGenivEXT = (PFNGLGETMULTITEXGENIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetMultiTexGenivEXT");
+  glGetMultiTexGenivEXT(texunit, coord, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMultiTexImageEXT (GLenum texunit, GLenum target, GLint level, GLenum format, GLenum type, void *pixels)
+{
+  glGetMultiTexImageEXT = (PFNGLGETMULTITEXIMAGEEXTPROC)glewGetProcAddress((const GLubyte*)"glGetMultiTexImageEXT");
+  glGetMultiTexImageEXT(texunit, target, level, format, type, pixels);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMultiTexLevelParameterfvEXT (GLenum texunit, GLenum target, GLint level, GLenum pname, GLfloat* params)
+{
+  glGetMultiTexLevelParameterfvEXT = (PFNGLGETMULTITEXLEVELPARAMETERFVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetMultiTexLevelParameterfvEXT");
+  glGetMultiTexLevelParameterfvEXT(texunit, target, level, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMultiTexLevelParameterivEXT (GLenum texunit, GLenum target, GLint level, GLenum pname, GLint* params)
+{
+  glGetMultiTexLevelParameterivEXT = (PFNGLGETMULTITEXLEVELPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetMultiTexLevelParameterivEXT");
+  glGetMultiTexLevelParameterivEXT(texunit, target, level, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMultiTexParameterIivEXT (GLenum texunit, GLenum target, GLenum pname, GLint* params)
+{
+  glGetMultiTexParameterIivEXT = (PFNGLGETMULTITEXPARAMETERIIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetMultiTexParameterIivEXT");
+  glGetMultiTexParameterIivEXT(texunit, target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMultiTexParameterIuivEXT (GLenum texunit, GLenum target, GLenum pname, GLuint* params)
+{
+  glGetMultiTexParameterIuivEXT = (PFNGLGETMULTITEXPARAMETERIUIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetMultiTexParameterIuivEXT");
+  glGetMultiTexParameterIuivEXT(texunit, target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMultiTexParameterfvEXT (GLenum texunit, GLenum target, GLenum pname, GLfloat* params)
+{
+  glGetMultiTexParameterfvEXT = (PFNGLGETMULTITEXPARAMETERFVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetMultiTexParameterfvEXT");
+  glGetMultiTexParameterfvEXT(texunit, target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMultiTexParameterivEXT (GLenum texunit, GLenum target, GLenum pname, GLint* params)
+{
+  glGetMultiTexParameterivEXT = (PFNGLGETMULTITEXPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetMultiTexParameterivEXT");
+  glGetMultiTexParameterivEXT(texunit, target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedBufferParameterivEXT (GLuint buffer, GLenum pname, GLint* params)
+{
+  glGetNamedBufferParameterivEXT = (PFNGLGETNAMEDBUFFERPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetNamedBufferParameterivEXT");
+  glGetNamedBufferParameterivEXT(buffer, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedBufferPointervEXT (GLuint buffer, GLenum pname, void** params)
+{
+  glGetNamedBufferPointervEXT = (PFNGLGETNAMEDBUFFERPOINTERVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetNamedBufferPointervEXT");
+  glGetNamedBufferPointervEXT(buffer, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedBufferSubDataEXT (GLuint buffer, GLintptr offset, GLsizeiptr size, void *data)
+{
+  glGetNamedBufferSubDataEXT = (PFNGLGETNAMEDBUFFERSUBDATAEXTPROC)glewGetProcAddress((const GLubyte*)"glGetNamedBufferSubDataEXT");
+  glGetNamedBufferSubDataEXT(buffer, offset, size, data);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedFramebufferAttachmentParameterivEXT (GLuint framebuffer, GLenum attachment, GLenum pname, GLint* params)
+{
+  glGetNamedFramebufferAttachmentParameterivEXT = (PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetNamedFramebufferAttachmentParameterivEXT");
+  glGetNamedFramebufferAttachmentParameterivEXT(framebuffer, attachment, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedProgramLocalParameterIivEXT (GLuint program, GLenum target, GLuint index, GLint* params)
+{
+  glGetNamedProgramLocalParameterIivEXT = (PFNGLGETNAMEDPROGRAMLOCALPARAMETERIIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetNamedProgramLocalParameterIivEXT");
+  glGetNamedProgramLocalParameterIivEXT(program, target, index, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedProgramLocalParameterIuivEXT (GLuint program, GLenum target, GLuint index, GLuint* params)
+{
+  glGetNamedProgramLocalParameterIuivEXT = (PFNGLGETNAMEDPROGRAMLOCALPARAMETERIUIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetNamedProgramLocalParameterIuivEXT");
+  glGetNamedProgramLocalParameterIuivEXT(program, target, index, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedProgramLocalParameterdvEXT (GLuint program, GLenum target, GLuint index, GLdouble* params)
+{
+  glGetNamedProgramLocalParameterdvEXT = (PFNGLGETNAMEDPROGRAMLOCALPARAMETERDVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetNamedProgramLocalParameterdvEXT");
+  glGetNamedProgramLocalParameterdvEXT(program, target, index, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedProgramLocalParameterfvEXT (GLuint program, GLenum target, GLuint index, GLfloat* params)
+{
+  glGetNamedProgramLocalParameterfvEXT = (PFNGLGETNAMEDPROGRAMLOCALPARAMETERFVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetNamedProgramLocalParameterfvEXT");
+  glGetNamedProgramLocalParameterfvEXT(program, target, index, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedProgramStringEXT (GLuint program, GLenum target, GLenum pname, void *string)
+{
+  glGetNamedProgramStringEXT = (PFNGLGETNAMEDPROGRAMSTRINGEXTPROC)glewGetProcAddress((const GLubyte*)"glGetNamedProgramStringEXT");
+  glGetNamedProgramStringEXT(program, target, pname, string);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedProgramivEXT (GLuint program, GLenum target, GLenum pname, GLint* params)
+{
+  glGetNamedProgramivEXT = (PFNGLGETNAMEDPROGRAMIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetNamedProgramivEXT");
+  glGetNamedProgramivEXT(program, target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedRenderbufferParameterivEXT (GLuint renderbuffer, GLenum pname, GLint* params)
+{
+  glGetNamedRenderbufferParameterivEXT = (PFNGLGETNAMEDRENDERBUFFERPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetNamedRenderbufferParameterivEXT");
+  glGetNamedRenderbufferParameterivEXT(renderbuffer, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPointerIndexedvEXT (GLenum target, GLuint index, void** params)
+{
+  glGetPointerIndexedvEXT = (PFNGLGETPOINTERINDEXEDVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetPointerIndexedvEXT");
+  glGetPointerIndexedvEXT(target, index, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPointeri_vEXT (GLenum pname, GLuint index, void** params)
+{
+  glGetPointeri_vEXT = (PFNGLGETPOINTERI_VEXTPROC)glewGetProcAddress((const GLubyte*)"glGetPointeri_vEXT");
+  glGetPointeri_vEXT(pname, index, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTextureImageEXT (GLuint texture, GLenum target, GLint level, GLenum format, GLenum type, void *pixels)
+{
+  glGetTextureImageEXT = (PFNGLGETTEXTUREIMAGEEXTPROC)glewGetProcAddress((const GLubyte*)"glGetTextureImageEXT");
+  glGetTextureImageEXT(texture, target, level, format, type, pixels);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTextureLevelParameterfvEXT (GLuint texture, GLenum target, GLint level, GLenum pname, GLfloat* params)
+{
+  glGetTextureLevelParameterfvEXT = (PFNGLGETTEXTURELEVELPARAMETERFVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetTextureLevelParameterfvEXT");
+  glGetTextureLevelParameterfvEXT(texture, target, level, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTextureLevelParameterivEXT (GLuint texture, GLenum target, GLint level, GLenum pname, GLint* params)
+{
+  glGetTextureLevelParameterivEXT = (PFNGLGETTEXTURELEVELPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetTextureLevelParameterivEXT");
+  glGetTextureLevelParameterivEXT(texture, target, level, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTextureParameterIivEXT (GLuint texture, GLenum target, GLenum pname, GLint* params)
+{
+  glGetTextureParameterIivEXT = (PFNGLGETTEXTUREPARAMETERIIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetTextureParameterIivEXT");
+  glGetTextureParameterIivEXT(texture, target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTextureParameterIuivEXT (GLuint texture, GLenum target, GLenum pname, GLuint* params)
+{
+  glGetTextureParameterIuivEXT = (PFNGLGETTEXTUREPARAMETERIUIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetTextureParameterIuivEXT");
+  glGetTextureParameterIuivEXT(texture, target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTextureParameterfvEXT (GLuint texture, GLenum target, GLenum pname, GLfloat* params)
+{
+  glGetTextureParameterfvEXT = (PFNGLGETTEXTUREPARAMETERFVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetTextureParameterfvEXT");
+  glGetTextureParameterfvEXT(texture, target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTextureParameterivEXT (GLuint texture, GLenum target, GLenum pname, GLint* params)
+{
+  glGetTextureParameterivEXT = (PFNGLGETTEXTUREPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetTextureParameterivEXT");
+  glGetTextureParameterivEXT(texture, target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexArrayIntegeri_vEXT (GLuint vaobj, GLuint index, GLenum pname, GLint* param)
+{
+  glGetVertexArrayIntegeri_vEXT = (PFNGLGETVERTEXARRAYINTEGERI_VEXTPROC)glewGetProcAddress((const GLubyte*)"glGetVertexArrayIntegeri_vEXT");
+  glGetVertexArrayIntegeri_vEXT(vaobj, index, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexArrayIntegervEXT (GLuint vaobj, GLenum pname, GLint* param)
+{
+  glGetVertexArrayIntegervEXT = (PFNGLGETVERTEXARRAYINTEGERVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetVertexArrayIntegervEXT");
+  glGetVertexArrayIntegervEXT(vaobj, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexArrayPointeri_vEXT (GLuint vaobj, GLuint index, GLenum pname, void** param)
+{
+  glGetVertexArrayPointeri_vEXT = (PFNGLGETVERTEXARRAYPOINTERI_VEXTPROC)glewGetProcAddress((const GLubyte*)"glGetVertexArrayPointeri_vEXT");
+  glGetVertexArrayPointeri_vEXT(vaobj, index, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexArrayPointervEXT (GLuint vaobj, GLenum pname, void** param)
+{
+  glGetVertexArrayPointervEXT = (PFNGLGETVERTEXARRAYPOINTERVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetVertexArrayPointervEXT");
+  glGetVertexArrayPointervEXT(vaobj, pname, param);
+}
+
+static void * GLAPIENTRY _glewLazy_glMapNamedBufferEXT (GLuint buffer, GLenum access)
+{
+  glMapNamedBufferEXT = (PFNGLMAPNAMEDBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glMapNamedBufferEXT");
+  return glMapNamedBufferEXT(buffer, access);
+}
+
+static void * GLAPIENTRY _glewLazy_glMapNamedBufferRangeEXT (GLuint buffer, GLintptr offset, GLsizeiptr length, GLbitfield access)
+{
+  glMapNamedBufferRangeEXT = (PFNGLMAPNAMEDBUFFERRANGEEXTPROC)glewGetProcAddress((const GLubyte*)"glMapNamedBufferRangeEXT");
+  return glMapNamedBufferRangeEXT(buffer, offset, length, access);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixFrustumEXT (GLenum matrixMode, GLdouble l, GLdouble r, GLdouble b, GLdouble t, GLdouble n, GLdouble f)
+{
+  glMatrixFrustumEXT = (PFNGLMATRIXFRUSTUMEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixFrustumEXT");
+  glMatrixFrustumEXT(matrixMode, l, r, b, t, n, f);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixLoadIdentityEXT (GLenum matrixMode)
+{
+  glMatrixLoadIdentityEXT = (PFNGLMATRIXLOADIDENTITYEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixLoadIdentityEXT");
+  glMatrixLoadIdentityEXT(matrixMode);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixLoadTransposedEXT (GLenum matrixMode, const GLdouble* m)
+{
+  glMatrixLoadTransposedEXT = (PFNGLMATRIXLOADTRANSPOSEDEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixLoadTransposedEXT");
+  glMatrixLoadTransposedEXT(matrixMode, m);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixLoadTransposefEXT (GLenum matrixMode, const GLfloat* m)
+{
+  glMatrixLoadTransposefEXT = (PFNGLMATRIXLOADTRANSPOSEFEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixLoadTransposefEXT");
+  glMatrixLoadTransposefEXT(matrixMode, m);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixLoaddEXT (GLenum matrixMode, const GLdouble* m)
+{
+  glMatrixLoaddEXT = (PFNGLMATRIXLOADDEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixLoaddEXT");
+  glMatrixLoaddEXT(matrixMode, m);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixLoadfEXT (GLenum matrixMode, const GLfloat* m)
+{
+  glMatrixLoadfEXT = (PFNGLMATRIXLOADFEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixLoadfEXT");
+  glMatrixLoadfEXT(matrixMode, m);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixMultTransposedEXT (GLenum matrixMode, const GLdouble* m)
+{
+  glMatrixMultTransposedEXT = (PFNGLMATRIXMULTTRANSPOSEDEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixMultTransposedEXT");
+  glMatrixMultTransposedEXT(matrixMode, m);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixMultTransposefEXT (GLenum matrixMode, const GLfloat* m)
+{
+  glMatrixMultTransposefEXT = (PFNGLMATRIXMULTTRANSPOSEFEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixMultTransposefEXT");
+  glMatrixMultTransposefEXT(matrixMode, m);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixMultdEXT (GLenum matrixMode, const GLdouble* m)
+{
+  glMatrixMultdEXT = (PFNGLMATRIXMULTDEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixMultdEXT");
+  glMatrixMultdEXT(matrixMode, m);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixMultfEXT (GLenum matrixMode, const GLfloat* m)
+{
+  glMatrixMultfEXT = (PFNGLMATRIXMULTFEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixMultfEXT");
+  glMatrixMultfEXT(matrixMode, m);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixOrthoEXT (GLenum matrixMode, GLdouble l, GLdouble r, GLdouble b, GLdouble t, GLdouble n, GLdouble f)
+{
+  glMatrixOrthoEXT = (PFNGLMATRIXORTHOEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixOrthoEXT");
+  glMatrixOrthoEXT(matrixMode, l, r, b, t, n, f);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixPopEXT (GLenum matrixMode)
+{
+  glMatrixPopEXT = (PFNGLMATRIXPOPEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixPopEXT");
+  glMatrixPopEXT(matrixMode);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixPushEXT (GLenum matrixMode)
+{
+  glMatrixPushEXT = (PFNGLMATRIXPUSHEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixPushEXT");
+  glMatrixPushEXT(matrixMode);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixRotatedEXT (GLenum matrixMode, GLdouble angle, GLdouble x, GLdouble y, GLdouble z)
+{
+  glMatrixRotatedEXT = (PFNGLMATRIXROTATEDEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixRotatedEXT");
+  glMatrixRotatedEXT(matrixMode, angle, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixRotatefEXT (GLenum matrixMode, GLfloat angle, GLfloat x, GLfloat y, GLfloat z)
+{
+  glMatrixRotatefEXT = (PFNGLMATRIXROTATEFEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixRotatefEXT");
+  glMatrixRotatefEXT(matrixMode, angle, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixScaledEXT (GLenum matrixMode, GLdouble x, GLdouble y, GLdouble z)
+{
+  glMatrixScaledEXT = (PFNGLMATRIXSCALEDEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixScaledEXT");
+  glMatrixScaledEXT(matrixMode, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixScalefEXT (GLenum matrixMode, GLfloat x, GLfloat y, GLfloat z)
+{
+  glMatrixScalefEXT = (PFNGLMATRIXSCALEFEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixScalefEXT");
+  glMatrixScalefEXT(matrixMode, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixTranslatedEXT (GLenum matrixMode, GLdouble x, GLdouble y, GLdouble z)
+{
+  glMatrixTranslatedEXT = (PFNGLMATRIXTRANSLATEDEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixTranslatedEXT");
+  glMatrixTranslatedEXT(matrixMode, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixTranslatefEXT (GLenum matrixMode, GLfloat x, GLfloat y, GLfloat z)
+{
+  glMatrixTranslatefEXT = (PFNGLMATRIXTRANSLATEFEXTPROC)glewGetProcAddress((const GLubyte*)"glMatrixTranslatefEXT");
+  glMatrixTranslatefEXT(matrixMode, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexBufferEXT (GLenum texunit, GLenum target, GLenum internalformat, GLuint buffer)
+{
+  glMultiTexBufferEXT = (PFNGLMULTITEXBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexBufferEXT");
+  glMultiTexBufferEXT(texunit, target, internalformat, buffer);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoordPointerEXT (GLenum texunit, GLint size, GLenum type, GLsizei stride, const void *pointer)
+{
+  glMultiTexCoordPointerEXT = (PFNGLMULTITEXCOORDPOINTEREXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoordPointerEXT");
+  glMultiTexCoordPointerEXT(texunit, size, type, stride, pointer);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexEnvfEXT (GLenum texunit, GLenum target, GLenum pname, GLfloat param)
+{
+  glMultiTexEnvfEXT = (PFNGLMULTITEXENVFEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexEnvfEXT");
+  glMultiTexEnvfEXT(texunit, target, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexEnvfvEXT (GLenum texunit, GLenum target, GLenum pname, const GLfloat* params)
+{
+  glMultiTexEnvfvEXT = (PFNGLMULTITEXENVFVEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexEnvfvEXT");
+  glMultiTexEnvfvEXT(texunit, target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexEnviEXT (GLenum texunit, GLenum target, GLenum pname, GLint param)
+{
+  glMultiTexEnviEXT = (PFNGLMULTITEXENVIEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexEnviEXT");
+  glMultiTexEnviEXT(texunit, target, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexEnvivEXT (GLenum texunit, GLenum target, GLenum pname, const GLint* params)
+{
+  glMultiTexEnvivEXT = (PFNGLMULTITEXENVIVEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexEnvivEXT");
+  glMultiTexEnvivEXT(texunit, target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexGendEXT (GLenum texunit, GLenum coord, GLenum pname, GLdouble param)
+{
+  glMultiTexGendEXT = (PFNGLMULTITEXGENDEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexGendEXT");
+  glMultiTexGendEXT(texunit, coord, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexGendvEXT (GLenum texunit, GLenum coord, GLenum pname, const GLdouble* params)
+{
+  glMultiTexGendvEXT = (PFNGLMULTITEXGENDVEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexGendvEXT");
+  glMultiTexGendvEXT(texunit, coord, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexGenfEXT (GLenum texunit, GLenum coord, GLenum pname, GLfloat param)
+{
+  glMultiTexGenfEXT = (PFNGLMULTITEXGENFEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexGenfEXT");
+  glMultiTexGenfEXT(texunit, coord, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexGenfvEXT (GLenum texunit, GLenum coord, GLenum pname, const GLfloat* params)
+{
+  glMultiTexGenfvEXT = (PFNGLMULTITEXGENFVEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexGenfvEXT");
+  glMultiTexGenfvEXT(texunit, coord, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexGeniEXT (GLenum texunit, GLenum coord, GLenum pname, GLint param)
+{
+  glMultiTexGeniEXT = (PFNGLMULTITEXGENIEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexGeniEXT");
+  glMultiTexGeniEXT(texunit, coord, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexGenivEXT (GLenum texunit, GLenum coord, GLenum pname, const GLint* params)
+{
+  glMultiTexGenivEXT = (PFNGLMULTITEXGENIVEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexGenivEXT");
+  glMultiTexGenivEXT(texunit, coord, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexImage1DEXT (GLenum texunit, GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+  glMultiTexImage1DEXT = (PFNGLMULTITEXIMAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexImage1DEXT");
+  glMultiTexImage1DEXT(texunit, target, level, internalformat, width, border, format, type, pixels);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexImage2DEXT (GLenum texunit, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+  glMultiTexImage2DEXT = (PFNGLMULTITEXIMAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexImage2DEXT");
+  glMultiTexImage2DEXT(texunit, target, level, internalformat, width, height, border, format, type, pixels);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexImage3DEXT (GLenum texunit, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+  glMultiTexImage3DEXT = (PFNGLMULTITEXIMAGE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexImage3DEXT");
+  glMultiTexImage3DEXT(texunit, target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexParameterIivEXT (GLenum texunit, GLenum target, GLenum pname, const GLint* params)
+{
+  glMultiTexParameterIivEXT = (PFNGLMULTITEXPARAMETERIIVEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexParameterIivEXT");
+  glMultiTexParameterIivEXT(texunit, target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexParameterIuivEXT (GLenum texunit, GLenum target, GLenum pname, const GLuint* params)
+{
+  glMultiTexParameterIuivEXT = (PFNGLMULTITEXPARAMETERIUIVEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexParameterIuivEXT");
+  glMultiTexParameterIuivEXT(texunit, target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexParameterfEXT (GLenum texunit, GLenum target, GLenum pname, GLfloat param)
+{
+  glMultiTexParameterfEXT = (PFNGLMULTITEXPARAMETERFEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexParameterfEXT");
+  glMultiTexParameterfEXT(texunit, target, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexParameterfvEXT (GLenum texunit, GLenum target, GLenum pname, const GLfloat* param)
+{
+  glMultiTexParameterfvEXT = (PFNGLMULTITEXPARAMETERFVEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexParameterfvEXT");
+  glMultiTexParameterfvEXT(texunit, target, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexParameteriEXT (GLenum texunit, GLenum target, GLenum pname, GLint param)
+{
+  glMultiTexParameteriEXT = (PFNGLMULTITEXPARAMETERIEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexParameteriEXT");
+  glMultiTexParameteriEXT(texunit, target, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexParameterivEXT (GLenum texunit, GLenum target, GLenum pname, const GLint* param)
+{
+  glMultiTexParameterivEXT = (PFNGLMULTITEXPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexParameterivEXT");
+  glMultiTexParameterivEXT(texunit, target, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexRenderbufferEXT (GLenum texunit, GLenum target, GLuint renderbuffer)
+{
+  glMultiTexRenderbufferEXT = (PFNGLMULTITEXRENDERBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexRenderbufferEXT");
+  glMultiTexRenderbufferEXT(texunit, target, renderbuffer);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexSubImage1DEXT (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels)
+{
+  glMultiTexSubImage1DEXT = (PFNGLMULTITEXSUBIMAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexSubImage1DEXT");
+  glMultiTexSubImage1DEXT(texunit, target, level, xoffset, width, format, type, pixels);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexSubImage2DEXT (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+{
+  glMultiTexSubImage2DEXT = (PFNGLMULTITEXSUBIMAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexSubImage2DEXT");
+  glMultiTexSubImage2DEXT(texunit, target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexSubImage3DEXT (GLenum texunit, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels)
+{
+  glMultiTexSubImage3DEXT = (PFNGLMULTITEXSUBIMAGE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiTexSubImage3DEXT");
+  glMultiTexSubImage3DEXT(texunit, target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedBufferDataEXT (GLuint buffer, GLsizeiptr size, const void *data, GLenum usage)
+{
+  glNamedBufferDataEXT = (PFNGLNAMEDBUFFERDATAEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedBufferDataEXT");
+  glNamedBufferDataEXT(buffer, size, data, usage);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedBufferSubDataEXT (GLuint buffer, GLintptr offset, GLsizeiptr size, const void *data)
+{
+  glNamedBufferSubDataEXT = (PFNGLNAMEDBUFFERSUBDATAEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedBufferSubDataEXT");
+  glNamedBufferSubDataEXT(buffer, offset, size, data);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedCopyBufferSubDataEXT (GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+  glNamedCopyBufferSubDataEXT = (PFNGLNAMEDCOPYBUFFERSUBDATAEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedCopyBufferSubDataEXT");
+  glNamedCopyBufferSubDataEXT(readBuffer, writeBuffer, readOffset, writeOffset, size);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferRenderbufferEXT (GLuint framebuffer, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+  glNamedFramebufferRenderbufferEXT = (PFNGLNAMEDFRAMEBUFFERRENDERBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferRenderbufferEXT");
+  glNamedFramebufferRenderbufferEXT(framebuffer, attachment, renderbuffertarget, renderbuffer);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferTexture1DEXT (GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+  glNamedFramebufferTexture1DEXT = (PFNGLNAMEDFRAMEBUFFERTEXTURE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferTexture1DEXT");
+  glNamedFramebufferTexture1DEXT(framebuffer, attachment, textarget, texture, level);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferTexture2DEXT (GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+  glNamedFramebufferTexture2DEXT = (PFNGLNAMEDFRAMEBUFFERTEXTURE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferTexture2DEXT");
+  glNamedFramebufferTexture2DEXT(framebuffer, attachment, textarget, texture, level);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferTexture3DEXT (GLuint framebuffer, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset)
+{
+  glNamedFramebufferTexture3DEXT = (PFNGLNAMEDFRAMEBUFFERTEXTURE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferTexture3DEXT");
+  glNamedFramebufferTexture3DEXT(framebuffer, attachment, textarget, texture, level, zoffset);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferTextureEXT (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level)
+{
+  glNamedFramebufferTextureEXT = (PFNGLNAMEDFRAMEBUFFERTEXTUREEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferTextureEXT");
+  glNamedFramebufferTextureEXT(framebuffer, attachment, texture, level);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferTextureFaceEXT (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLenum face)
+{
+  glNamedFramebufferTextureFaceEXT = (PFNGLNAMEDFRAMEBUFFERTEXTUREFACEEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferTextureFaceEXT");
+  glNamedFramebufferTextureFaceEXT(framebuffer, attachment, texture, level, face);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferTextureLayerEXT (GLuint framebuffer, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+  glNamedFramebufferTextureLayerEXT = (PFNGLNAMEDFRAMEBUFFERTEXTURELAYEREXTPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferTextureLayerEXT");
+  glNamedFramebufferTextureLayerEXT(framebuffer, attachment, texture, level, layer);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedProgramLocalParameter4dEXT (GLuint program, GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+  glNamedProgramLocalParameter4dEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETER4DEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedProgramLocalParameter4dEXT");
+  glNamedProgramLocalParameter4dEXT(program, target, index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedProgramLocalParameter4dvEXT (GLuint program, GLenum target, GLuint index, const GLdouble* params)
+{
+  glNamedProgramLocalParameter4dvEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETER4DVEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedProgramLocalParameter4dvEXT");
+  glNamedProgramLocalParameter4dvEXT(program, target, index, params);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedProgramLocalParameter4fEXT (GLuint program, GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+  glNamedProgramLocalParameter4fEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETER4FEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedProgramLocalParameter4fEXT");
+  glNamedProgramLocalParameter4fEXT(program, target, index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedProgramLocalParameter4fvEXT (GLuint program, GLenum target, GLuint index, const GLfloat* params)
+{
+  glNamedProgramLocalParameter4fvEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETER4FVEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedProgramLocalParameter4fvEXT");
+  glNamedProgramLocalParameter4fvEXT(program, target, index, params);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedProgramLocalParameterI4iEXT (GLuint program, GLenum target, GLuint index, GLint x, GLint y, GLint z, GLint w)
+{
+  glNamedProgramLocalParameterI4iEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETERI4IEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedProgramLocalParameterI4iEXT");
+  glNamedProgramLocalParameterI4iEXT(program, target, index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedProgramLocalParameterI4ivEXT (GLuint program, GLenum target, GLuint index, const GLint* params)
+{
+  glNamedProgramLocalParameterI4ivEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETERI4IVEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedProgramLocalParameterI4ivEXT");
+  glNamedProgramLocalParameterI4ivEXT(program, target, index, params);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedProgramLocalParameterI4uiEXT (GLuint program, GLenum target, GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
+{
+  glNamedProgramLocalParameterI4uiEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETERI4UIEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedProgramLocalParameterI4uiEXT");
+  glNamedProgramLocalParameterI4uiEXT(program, target, index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedProgramLocalParameterI4uivEXT (GLuint program, GLenum target, GLuint index, const GLuint* params)
+{
+  glNamedProgramLocalParameterI4uivEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETERI4UIVEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedProgramLocalParameterI4uivEXT");
+  glNamedProgramLocalParameterI4uivEXT(program, target, index, params);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedProgramLocalParameters4fvEXT (GLuint program, GLenum target, GLuint index, GLsizei count, const GLfloat* params)
+{
+  glNamedProgramLocalParameters4fvEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETERS4FVEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedProgramLocalParameters4fvEXT");
+  glNamedProgramLocalParameters4fvEXT(program, target, index, count, params);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedProgramLocalParametersI4ivEXT (GLuint program, GLenum target, GLuint index, GLsizei count, const GLint* params)
+{
+  glNamedProgramLocalParametersI4ivEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETERSI4IVEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedProgramLocalParametersI4ivEXT");
+  glNamedProgramLocalParametersI4ivEXT(program, target, index, count, params);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedProgramLocalParametersI4uivEXT (GLuint program, GLenum target, GLuint index, GLsizei count, const GLuint* params)
+{
+  glNamedProgramLocalParametersI4uivEXT = (PFNGLNAMEDPROGRAMLOCALPARAMETERSI4UIVEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedProgramLocalParametersI4uivEXT");
+  glNamedProgramLocalParametersI4uivEXT(program, target, index, count, params);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedProgramStringEXT (GLuint program, GLenum target, GLenum format, GLsizei len, const void *string)
+{
+  glNamedProgramStringEXT = (PFNGLNAMEDPROGRAMSTRINGEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedProgramStringEXT");
+  glNamedProgramStringEXT(program, target, format, len, string);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedRenderbufferStorageEXT (GLuint renderbuffer, GLenum internalformat, GLsizei width, GLsizei height)
+{
+  glNamedRenderbufferStorageEXT = (PFNGLNAMEDRENDERBUFFERSTORAGEEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedRenderbufferStorageEXT");
+  glNamedRenderbufferStorageEXT(renderbuffer, internalformat, width, height);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedRenderbufferStorageMultisampleCoverageEXT (GLuint renderbuffer, GLsizei coverageSamples, GLsizei colorSamples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+  glNamedRenderbufferStorageMultisampleCoverageEXT = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLECOVERAGEEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedRenderbufferStorageMultisampleCoverageEXT");
+  glNamedRenderbufferStorageMultisampleCoverageEXT(renderbuffer, coverageSamples, colorSamples, internalformat, width, height);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedRenderbufferStorageMultisampleEXT (GLuint renderbuffer, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+  glNamedRenderbufferStorageMultisampleEXT = (PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC)glewGetProcAddress((const GLubyte*)"glNamedRenderbufferStorageMultisampleEXT");
+  glNamedRenderbufferStorageMultisampleEXT(renderbuffer, samples, internalformat, width, height);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1fEXT (GLuint program, GLint location, GLfloat v0)
+{
+  glProgramUniform1fEXT = (PFNGLPROGRAMUNIFORM1FEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1fEXT");
+  glProgramUniform1fEXT(program, location, v0);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1fvEXT (GLuint program, GLint location, GLsizei count, const GLfloat* value)
+{
+  glProgramUniform1fvEXT = (PFNGLPROGRAMUNIFORM1FVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1fvEXT");
+  glProgramUniform1fvEXT(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1iEXT (GLuint program, GLint location, GLint v0)
+{
+  glProgramUniform1iEXT = (PFNGLPROGRAMUNIFORM1IEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1iEXT");
+  glProgramUniform1iEXT(program, location, v0);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1ivEXT (GLuint program, GLint location, GLsizei count, const GLint* value)
+{
+  glProgramUniform1ivEXT = (PFNGLPROGRAMUNIFORM1IVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1ivEXT");
+  glProgramUniform1ivEXT(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1uiEXT (GLuint program, GLint location, GLuint v0)
+{
+  glProgramUniform1uiEXT = (PFNGLPROGRAMUNIFORM1UIEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1uiEXT");
+  glProgramUniform1uiEXT(program, location, v0);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1uivEXT (GLuint program, GLint location, GLsizei count, const GLuint* value)
+{
+  glProgramUniform1uivEXT = (PFNGLPROGRAMUNIFORM1UIVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1uivEXT");
+  glProgramUniform1uivEXT(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2fEXT (GLuint program, GLint location, GLfloat v0, GLfloat v1)
+{
+  glProgramUniform2fEXT = (PFNGLPROGRAMUNIFORM2FEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2fEXT");
+  glProgramUniform2fEXT(program, location, v0, v1);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2fvEXT (GLuint program, GLint location, GLsizei count, const GLfloat* value)
+{
+  glProgramUniform2fvEXT = (PFNGLPROGRAMUNIFORM2FVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2fvEXT");
+  glProgramUniform2fvEXT(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2iEXT (GLuint program, GLint location, GLint v0, GLint v1)
+{
+  glProgramUniform2iEXT = (PFNGLPROGRAMUNIFORM2IEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2iEXT");
+  glProgramUniform2iEXT(program, location, v0, v1);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2ivEXT (GLuint program, GLint location, GLsizei count, const GLint* value)
+{
+  glProgramUniform2ivEXT = (PFNGLPROGRAMUNIFORM2IVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2ivEXT");
+  glProgramUniform2ivEXT(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2uiEXT (GLuint program, GLint location, GLuint v0, GLuint v1)
+{
+  glProgramUniform2uiEXT = (PFNGLPROGRAMUNIFORM2UIEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2uiEXT");
+  glProgramUniform2uiEXT(program, location, v0, v1);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2uivEXT (GLuint program, GLint location, GLsizei count, const GLuint* value)
+{
+  glProgramUniform2uivEXT = (PFNGLPROGRAMUNIFORM2UIVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2uivEXT");
+  glProgramUniform2uivEXT(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3fEXT (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2)
+{
+  glProgramUniform3fEXT = (PFNGLPROGRAMUNIFORM3FEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3fEXT");
+  glProgramUniform3fEXT(program, location, v0, v1, v2);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3fvEXT (GLuint program, GLint location, GLsizei count, const GLfloat* value)
+{
+  glProgramUniform3fvEXT = (PFNGLPROGRAMUNIFORM3FVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3fvEXT");
+  glProgramUniform3fvEXT(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3iEXT (GLuint program, GLint location, GLint v0, GLint v1, GLint v2)
+{
+  glProgramUniform3iEXT = (PFNGLPROGRAMUNIFORM3IEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3iEXT");
+  glProgramUniform3iEXT(program, location, v0, v1, v2);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3ivEXT (GLuint program, GLint location, GLsizei count, const GLint* value)
+{
+  glProgramUniform3ivEXT = (PFNGLPROGRAMUNIFORM3IVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3ivEXT");
+  glProgramUniform3ivEXT(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3uiEXT (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+  glProgramUniform3uiEXT = (PFNGLPROGRAMUNIFORM3UIEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3uiEXT");
+  glProgramUniform3uiEXT(program, location, v0, v1, v2);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3uivEXT (GLuint program, GLint location, GLsizei count, const GLuint* value)
+{
+  glProgramUniform3uivEXT = (PFNGLPROGRAMUNIFORM3UIVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3uivEXT");
+  glProgramUniform3uivEXT(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4fEXT (GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+  glProgramUniform4fEXT = (PFNGLPROGRAMUNIFORM4FEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4fEXT");
+  glProgramUniform4fEXT(program, location, v0, v1, v2, v3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4fvEXT (GLuint program, GLint location, GLsizei count, const GLfloat* value)
+{
+  glProgramUniform4fvEXT = (PFNGLPROGRAMUNIFORM4FVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4fvEXT");
+  glProgramUniform4fvEXT(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4iEXT (GLuint program, GLint location, GLint v0, GLint v1, GLint v2, GLint v3)
+{
+  glProgramUniform4iEXT = (PFNGLPROGRAMUNIFORM4IEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4iEXT");
+  glProgramUniform4iEXT(program, location, v0, v1, v2, v3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4ivEXT (GLuint program, GLint location, GLsizei count, const GLint* value)
+{
+  glProgramUniform4ivEXT = (PFNGLPROGRAMUNIFORM4IVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4ivEXT");
+  glProgramUniform4ivEXT(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4uiEXT (GLuint program, GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+  glProgramUniform4uiEXT = (PFNGLPROGRAMUNIFORM4UIEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4uiEXT");
+  glProgramUniform4uiEXT(program, location, v0, v1, v2, v3);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4uivEXT (GLuint program, GLint location, GLsizei count, const GLuint* value)
+{
+  glProgramUniform4uivEXT = (PFNGLPROGRAMUNIFORM4UIVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4uivEXT");
+  glProgramUniform4uivEXT(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix2fvEXT (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+  glProgramUniformMatrix2fvEXT = (PFNGLPROGRAMUNIFORMMATRIX2FVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix2fvEXT");
+  glProgramUniformMatrix2fvEXT(program, location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix2x3fvEXT (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+  glProgramUniformMatrix2x3fvEXT = (PFNGLPROGRAMUNIFORMMATRIX2X3FVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix2x3fvEXT");
+  glProgramUniformMatrix2x3fvEXT(program, location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix2x4fvEXT (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+  glProgramUniformMatrix2x4fvEXT = (PFNGLPROGRAMUNIFORMMATRIX2X4FVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix2x4fvEXT");
+  glProgramUniformMatrix2x4fvEXT(program, location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix3fvEXT (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+  glProgramUniformMatrix3fvEXT = (PFNGLPROGRAMUNIFORMMATRIX3FVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix3fvEXT");
+  glProgramUniformMatrix3fvEXT(program, location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix3x2fvEXT (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+  glProgramUniformMatrix3x2fvEXT = (PFNGLPROGRAMUNIFORMMATRIX3X2FVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix3x2fvEXT");
+  glProgramUniformMatrix3x2fvEXT(program, location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix3x4fvEXT (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+  glProgramUniformMatrix3x4fvEXT = (PFNGLPROGRAMUNIFORMMATRIX3X4FVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix3x4fvEXT");
+  glProgramUniformMatrix3x4fvEXT(program, location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix4fvEXT (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+  glProgramUniformMatrix4fvEXT = (PFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix4fvEXT");
+  glProgramUniformMatrix4fvEXT(program, location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix4x2fvEXT (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+  glProgramUniformMatrix4x2fvEXT = (PFNGLPROGRAMUNIFORMMATRIX4X2FVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix4x2fvEXT");
+  glProgramUniformMatrix4x2fvEXT(program, location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformMatrix4x3fvEXT (GLuint program, GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+  glProgramUniformMatrix4x3fvEXT = (PFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformMatrix4x3fvEXT");
+  glProgramUniformMatrix4x3fvEXT(program, location, count, transpose, value);
+}
+
+static void GLAPIENTRY _glewLazy_glPushClientAttribDefaultEXT (GLbitfield mask)
+{
+  glPushClientAttribDefaultEXT = (PFNGLPUSHCLIENTATTRIBDEFAULTEXTPROC)glewGetProcAddress((const GLubyte*)"glPushClientAttribDefaultEXT");
+  glPushClientAttribDefaultEXT(mask);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureBufferEXT (GLuint texture, GLenum target, GLenum internalformat, GLuint buffer)
+{
+  glTextureBufferEXT = (PFNGLTEXTUREBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glTextureBufferEXT");
+  glTextureBufferEXT(texture, target, internalformat, buffer);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureImage1DEXT (GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+  glTextureImage1DEXT = (PFNGLTEXTUREIMAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureImage1DEXT");
+  glTextureImage1DEXT(texture, target, level, internalformat, width, border, format, type, pixels);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureImage2DEXT (GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+  glTextureImage2DEXT = (PFNGLTEXTUREIMAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureImage2DEXT");
+  glTextureImage2DEXT(texture, target, level, internalformat, width, height, border, format, type, pixels);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureImage3DEXT (GLuint texture, GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+  glTextureImage3DEXT = (PFNGLTEXTUREIMAGE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureImage3DEXT");
+  glTextureImage3DEXT(texture, target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureParameterIivEXT (GLuint texture, GLenum target, GLenum pname, const GLint* params)
+{
+  glTextureParameterIivEXT = (PFNGLTEXTUREPARAMETERIIVEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureParameterIivEXT");
+  glTextureParameterIivEXT(texture, target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureParameterIuivEXT (GLuint texture, GLenum target, GLenum pname, const GLuint* params)
+{
+  glTextureParameterIuivEXT = (PFNGLTEXTUREPARAMETERIUIVEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureParameterIuivEXT");
+  glTextureParameterIuivEXT(texture, target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureParameterfEXT (GLuint texture, GLenum target, GLenum pname, GLfloat param)
+{
+  glTextureParameterfEXT = (PFNGLTEXTUREPARAMETERFEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureParameterfEXT");
+  glTextureParameterfEXT(texture, target, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureParameterfvEXT (GLuint texture, GLenum target, GLenum pname, const GLfloat* param)
+{
+  glTextureParameterfvEXT = (PFNGLTEXTUREPARAMETERFVEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureParameterfvEXT");
+  glTextureParameterfvEXT(texture, target, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureParameteriEXT (GLuint texture, GLenum target, GLenum pname, GLint param)
+{
+  glTextureParameteriEXT = (PFNGLTEXTUREPARAMETERIEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureParameteriEXT");
+  glTextureParameteriEXT(texture, target, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureParameterivEXT (GLuint texture, GLenum target, GLenum pname, const GLint* param)
+{
+  glTextureParameterivEXT = (PFNGLTEXTUREPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureParameterivEXT");
+  glTextureParameterivEXT(texture, target, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureRenderbufferEXT (GLuint texture, GLenum target, GLuint renderbuffer)
+{
+  glTextureRenderbufferEXT = (PFNGLTEXTURERENDERBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glTextureRenderbufferEXT");
+  glTextureRenderbufferEXT(texture, target, renderbuffer);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureSubImage1DEXT (GLuint texture, GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels)
+{
+  glTextureSubImage1DEXT = (PFNGLTEXTURESUBIMAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureSubImage1DEXT");
+  glTextureSubImage1DEXT(texture, target, level, xoffset, width, format, type, pixels);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureSubImage2DEXT (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+{
+  glTextureSubImage2DEXT = (PFNGLTEXTURESUBIMAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureSubImage2DEXT");
+  glTextureSubImage2DEXT(texture, target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureSubImage3DEXT (GLuint texture, GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels)
+{
+  glTextureSubImage3DEXT = (PFNGLTEXTURESUBIMAGE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureSubImage3DEXT");
+  glTextureSubImage3DEXT(texture, target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glUnmapNamedBufferEXT (GLuint buffer)
+{
+  glUnmapNamedBufferEXT = (PFNGLUNMAPNAMEDBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glUnmapNamedBufferEXT");
+  return glUnmapNamedBufferEXT(buffer);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayColorOffsetEXT (GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset)
+{
+  glVertexArrayColorOffsetEXT = (PFNGLVERTEXARRAYCOLOROFFSETEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayColorOffsetEXT");
+  glVertexArrayColorOffsetEXT(vaobj, buffer, size, type, stride, offset);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayEdgeFlagOffsetEXT (GLuint vaobj, GLuint buffer, GLsizei stride, GLintptr offset)
+{
+  glVertexArrayEdgeFlagOffsetEXT = (PFNGLVERTEXARRAYEDGEFLAGOFFSETEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayEdgeFlagOffsetEXT");
+  glVertexArrayEdgeFlagOffsetEXT(vaobj, buffer, stride, offset);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayFogCoordOffsetEXT (GLuint vaobj, GLuint buffer, GLenum type, GLsizei stride, GLintptr offset)
+{
+  glVertexArrayFogCoordOffsetEXT = (PFNGLVERTEXARRAYFOGCOORDOFFSETEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayFogCoordOffsetEXT");
+  glVertexArrayFogCoordOffsetEXT(vaobj, buffer, type, stride, offset);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayIndexOffsetEXT (GLuint vaobj, GLuint buffer, GLenum type, GLsizei stride, GLintptr offset)
+{
+  glVertexArrayIndexOffsetEXT = (PFNGLVERTEXARRAYINDEXOFFSETEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayIndexOffsetEXT");
+  glVertexArrayIndexOffsetEXT(vaobj, buffer, type, stride, offset);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayMultiTexCoordOffsetEXT (GLuint vaobj, GLuint buffer, GLenum texunit, GLint size, GLenum type, GLsizei stride, GLintptr offset)
+{
+  glVertexArrayMultiTexCoordOffsetEXT = (PFNGLVERTEXARRAYMULTITEXCOORDOFFSETEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayMultiTexCoordOffsetEXT");
+  glVertexArrayMultiTexCoordOffsetEXT(vaobj, buffer, texunit, size, type, stride, offset);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayNormalOffsetEXT (GLuint vaobj, GLuint buffer, GLenum type, GLsizei stride, GLintptr offset)
+{
+  glVertexArrayNormalOffsetEXT = (PFNGLVERTEXARRAYNORMALOFFSETEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayNormalOffsetEXT");
+  glVertexArrayNormalOffsetEXT(vaobj, buffer, type, stride, offset);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArraySecondaryColorOffsetEXT (GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset)
+{
+  glVertexArraySecondaryColorOffsetEXT = (PFNGLVERTEXARRAYSECONDARYCOLOROFFSETEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArraySecondaryColorOffsetEXT");
+  glVertexArraySecondaryColorOffsetEXT(vaobj, buffer, size, type, stride, offset);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayTexCoordOffsetEXT (GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset)
+{
+  glVertexArrayTexCoordOffsetEXT = (PFNGLVERTEXARRAYTEXCOORDOFFSETEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayTexCoordOffsetEXT");
+  glVertexArrayTexCoordOffsetEXT(vaobj, buffer, size, type, stride, offset);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayVertexAttribDivisorEXT (GLuint vaobj, GLuint index, GLuint divisor)
+{
+  glVertexArrayVertexAttribDivisorEXT = (PFNGLVERTEXARRAYVERTEXATTRIBDIVISOREXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayVertexAttribDivisorEXT");
+  glVertexArrayVertexAttribDivisorEXT(vaobj, index, divisor);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayVertexAttribIOffsetEXT (GLuint vaobj, GLuint buffer, GLuint index, GLint size, GLenum type, GLsizei stride, GLintptr offset)
+{
+  glVertexArrayVertexAttribIOffsetEXT = (PFNGLVERTEXARRAYVERTEXATTRIBIOFFSETEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayVertexAttribIOffsetEXT");
+  glVertexArrayVertexAttribIOffsetEXT(vaobj, buffer, index, size, type, stride, offset);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayVertexAttribOffsetEXT (GLuint vaobj, GLuint buffer, GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, GLintptr offset)
+{
+  glVertexArrayVertexAttribOffsetEXT = (PFNGLVERTEXARRAYVERTEXATTRIBOFFSETEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayVertexAttribOffsetEXT");
+  glVertexArrayVertexAttribOffsetEXT(vaobj, buffer, index, size, type, normalized, stride, offset);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayVertexOffsetEXT (GLuint vaobj, GLuint buffer, GLint size, GLenum type, GLsizei stride, GLintptr offset)
+{
+  glVertexArrayVertexOffsetEXT = (PFNGLVERTEXARRAYVERTEXOFFSETEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayVertexOffsetEXT");
+  glVertexArrayVertexOffsetEXT(vaobj, buffer, size, type, stride, offset);
+}
+
+
+static void GLAPIENTRY _glewLazy_glColorMaskIndexedEXT (GLuint buf, GLboolean r, GLboolean g, GLboolean b, GLboolean a)
+{
+  glColorMaskIndexedEXT = (PFNGLCOLORMASKINDEXEDEXTPROC)glewGetProcAddress((const GLubyte*)"glColorMaskIndexedEXT");
+  glColorMaskIndexedEXT(buf, r, g, b, a);
+}
+
+static void GLAPIENTRY _glewLazy_glDisableIndexedEXT (GLenum target, GLuint index)
+{
+  glDisableIndexedEXT = (PFNGLDISABLEINDEXEDEXTPROC)glewGetProcAddress((const GLubyte*)"glDisableIndexedEXT");
+  glDisableIndexedEXT(target, index);
+}
+
+static void GLAPIENTRY _glewLazy_glEnableIndexedEXT (GLenum target, GLuint index)
+{
+  glEnableIndexedEXT = (PFNGLENABLEINDEXEDEXTPROC)glewGetProcAddress((const GLubyte*)"glEnableIndexedEXT");
+  glEnableIndexedEXT(target, index);
+}
+
+static void GLAPIENTRY _glewLazy_glGetBooleanIndexedvEXT (GLenum value, GLuint index, GLboolean* data)
+{
+  glGetBooleanIndexedvEXT = (PFNGLGETBOOLEANINDEXEDVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetBooleanIndexedvEXT");
+  glGetBooleanIndexedvEXT(value, index, data);
+}
+
+static void GLAPIENTRY _glewLazy_glGetIntegerIndexedvEXT (GLenum value, GLuint index, GLint* data)
+{
+  glGetIntegerIndexedvEXT = (PFNGLGETINTEGERINDEXEDVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetIntegerIndexedvEXT");
+  glGetIntegerIndexedvEXT(value, index, data);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsEnabledIndexedEXT (GLenum target, GLuint index)
+{
+  glIsEnabledIndexedEXT = (PFNGLISENABLEDINDEXEDEXTPROC)glewGetProcAddress((const GLubyte*)"glIsEnabledIndexedEXT");
+  return glIsEnabledIndexedEXT(target, index);
+}
+
+
+static void GLAPIENTRY _glewLazy_glDrawArraysInstancedEXT (GLenum mode, GLint start, GLsizei count, GLsizei primcount)
+{
+  glDrawArraysInstancedEXT = (PFNGLDRAWARRAYSINSTANCEDEXTPROC)glewGetProcAddress((const GLubyte*)"glDrawArraysInstancedEXT");
+  glDrawArraysInstancedEXT(mode, start, count, primcount);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawElementsInstancedEXT (GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei primcount)
+{
+  glDrawElementsInstancedEXT = (PFNGLDRAWELEMENTSINSTANCEDEXTPROC)glewGetProcAddress((const GLubyte*)"glDrawElementsInstancedEXT");
+  glDrawElementsInstancedEXT(mode, count, type, indices, primcount);
+}
+
+
+static void GLAPIENTRY _glewLazy_glDrawRangeElementsEXT (GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices)
+{
+  glDrawRangeElementsEXT = (PFNGLDRAWRANGEELEMENTSEXTPROC)glewGetProcAddress((const GLubyte*)"glDrawRangeElementsEXT");
+  glDrawRangeElementsEXT(mode, start, end, count, type, indices);
+}
+
+
+static void GLAPIENTRY _glewLazy_glFogCoordPointerEXT (GLenum type, GLsizei stride, const void *pointer)
+{
+  glFogCoordPointerEXT = (PFNGLFOGCOORDPOINTEREXTPROC)glewGetProcAddress((const GLubyte*)"glFogCoordPointerEXT");
+  glFogCoordPointerEXT(type, stride, pointer);
+}
+
+static void GLAPIENTRY _glewLazy_glFogCoorddEXT (GLdouble coord)
+{
+  glFogCoorddEXT = (PFNGLFOGCOORDDEXTPROC)glewGetProcAddress((const GLubyte*)"glFogCoorddEXT");
+  glFogCoorddEXT(coord);
+}
+
+static void GLAPIENTRY _glewLazy_glFogCoorddvEXT (const GLdouble *coord)
+{
+  glFogCoorddvEXT = (PFNGLFOGCOORDDVEXTPROC)glewGetProcAddress((const GLubyte*)"glFogCoorddvEXT");
+  glFogCoorddvEXT(coord);
+}
+
+static void GLAPIENTRY _glewLazy_glFogCoordfEXT (GLfloat coord)
+{
+  glFogCoordfEXT = (PFNGLFOGCOORDFEXTPROC)glewGetProcAddress((const GLubyte*)"glFogCoordfEXT");
+  glFogCoordfEXT(coord);
+}
+
+static void GLAPIENTRY _glewLazy_glFogCoordfvEXT (const GLfloat *coord)
+{
+  glFogCoordfvEXT = (PFNGLFOGCOORDFVEXTPROC)glewGetProcAddress((const GLubyte*)"glFogCoordfvEXT");
+  glFogCoordfvEXT(coord);
+}
+
+
+static void GLAPIENTRY _glewLazy_glFragmentColorMaterialEXT (GLenum face, GLenum mode)
+{
+  glFragmentColorMaterialEXT = (PFNGLFRAGMENTCOLORMATERIALEXTPROC)glewGetProcAddress((const GLubyte*)"glFragmentColorMaterialEXT");
+  glFragmentColorMaterialEXT(face, mode);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentLightModelfEXT (GLenum pname, GLfloat param)
+{
+  glFragmentLightModelfEXT = (PFNGLFRAGMENTLIGHTMODELFEXTPROC)glewGetProcAddress((const GLubyte*)"glFragmentLightModelfEXT");
+  glFragmentLightModelfEXT(pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentLightModelfvEXT (GLenum pname, GLfloat* params)
+{
+  glFragmentLightModelfvEXT = (PFNGLFRAGMENTLIGHTMODELFVEXTPROC)glewGetProcAddress((const GLubyte*)"glFragmentLightModelfvEXT");
+  glFragmentLightModelfvEXT(pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentLightModeliEXT (GLenum pname, GLint param)
+{
+  glFragmentLightModeliEXT = (PFNGLFRAGMENTLIGHTMODELIEXTPROC)glewGetProcAddress((const GLubyte*)"glFragmentLightModeliEXT");
+  glFragmentLightModeliEXT(pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentLightModelivEXT (GLenum pname, GLint* params)
+{
+  glFragmentLightModelivEXT = (PFNGLFRAGMENTLIGHTMODELIVEXTPROC)glewGetProcAddress((const GLubyte*)"glFragmentLightModelivEXT");
+  glFragmentLightModelivEXT(pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentLightfEXT (GLenum light, GLenum pname, GLfloat param)
+{
+  glFragmentLightfEXT = (PFNGLFRAGMENTLIGHTFEXTPROC)glewGetProcAddress((const GLubyte*)"glFragmentLightfEXT");
+  glFragmentLightfEXT(light, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentLightfvEXT (GLenum light, GLenum pname, GLfloat* params)
+{
+  glFragmentLightfvEXT = (PFNGLFRAGMENTLIGHTFVEXTPROC)glewGetProcAddress((const GLubyte*)"glFragmentLightfvEXT");
+  glFragmentLightfvEXT(light, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentLightiEXT (GLenum light, GLenum pname, GLint param)
+{
+  glFragmentLightiEXT = (PFNGLFRAGMENTLIGHTIEXTPROC)glewGetProcAddress((const GLubyte*)"glFragmentLightiEXT");
+  glFragmentLightiEXT(light, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentLightivEXT (GLenum light, GLenum pname, GLint* params)
+{
+  glFragmentLightivEXT = (PFNGLFRAGMENTLIGHTIVEXTPROC)glewGetProcAddress((const GLubyte*)"glFragmentLightivEXT");
+  glFragmentLightivEXT(light, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentMaterialfEXT (GLenum face, GLenum pname, const GLfloat param)
+{
+  glFragmentMaterialfEXT = (PFNGLFRAGMENTMATERIALFEXTPROC)glewGetProcAddress((const GLubyte*)"glFragmentMaterialfEXT");
+  glFragmentMaterialfEXT(face, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentMaterialfvEXT (GLenum face, GLenum pname, const GLfloat* params)
+{
+  glFragmentMaterialfvEXT = (PFNGLFRAGMENTMATERIALFVEXTPROC)glewGetProcAddress((const GLubyte*)"glFragmentMaterialfvEXT");
+  glFragmentMaterialfvEXT(face, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentMaterialiEXT (GLenum face, GLenum pname, const GLint param)
+{
+  glFragmentMaterialiEXT = (PFNGLFRAGMENTMATERIALIEXTPROC)glewGetProcAddress((const GLubyte*)"glFragmentMaterialiEXT");
+  glFragmentMaterialiEXT(face, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentMaterialivEXT (GLenum face, GLenum pname, const GLint* params)
+{
+  glFragmentMaterialivEXT = (PFNGLFRAGMENTMATERIALIVEXTPROC)glewGetProcAddress((const GLubyte*)"glFragmentMaterialivEXT");
+  glFragmentMaterialivEXT(face, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFragmentLightfvEXT (GLenum light, GLenum pname, GLfloat* params)
+{
+  glGetFragmentLightfvEXT = (PFNGLGETFRAGMENTLIGHTFVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetFragmentLightfvEXT");
+  glGetFragmentLightfvEXT(light, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFragmentLightivEXT (GLenum light, GLenum pname, GLint* params)
+{
+  glGetFragmentLightivEXT = (PFNGLGETFRAGMENTLIGHTIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetFragmentLightivEXT");
+  glGetFragmentLightivEXT(light, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFragmentMaterialfvEXT (GLenum face, GLenum pname, const GLfloat* params)
+{
+  glGetFragmentMaterialfvEXT = (PFNGLGETFRAGMENTMATERIALFVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetFragmentMaterialfvEXT");
+  glGetFragmentMaterialfvEXT(face, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFragmentMaterialivEXT (GLenum face, GLenum pname, const GLint* params)
+{
+  glGetFragmentMaterialivEXT = (PFNGLGETFRAGMENTMATERIALIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetFragmentMaterialivEXT");
+  glGetFragmentMaterialivEXT(face, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glLightEnviEXT (GLenum pname, GLint param)
+{
+  glLightEnviEXT = (PFNGLLIGHTENVIEXTPROC)glewGetProcAddress((const GLubyte*)"glLightEnviEXT");
+  glLightEnviEXT(pname, param);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBlitFramebufferEXT (GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+  glBlitFramebufferEXT = (PFNGLBLITFRAMEBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glBlitFramebufferEXT");
+  glBlitFramebufferEXT(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+
+
+static void GLAPIENTRY _glewLazy_glRenderbufferStorageMultisampleEXT (GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+  glRenderbufferStorageMultisampleEXT = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC)glewGetProcAddress((const GLubyte*)"glRenderbufferStorageMultisampleEXT");
+  glRenderbufferStorageMultisampleEXT(target, samples, internalformat, width, height);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBindFramebufferEXT (GLenum target, GLuint framebuffer)
+{
+  glBindFramebufferEXT = (PFNGLBINDFRAMEBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glBindFramebufferEXT");
+  glBindFramebufferEXT(target, framebuffer);
+}
+
+static void GLAPIENTRY _glewLazy_glBindRenderbufferEXT (GLenum target, GLuint renderbuffer)
+{
+  glBindRenderbufferEXT = (PFNGLBINDRENDERBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glBindRenderbufferEXT");
+  glBindRenderbufferEXT(target, renderbuffer);
+}
+
+static GLenum GLAPIENTRY _glewLazy_glCheckFramebufferStatusEXT (GLenum target)
+{
+  glCheckFramebufferStatusEXT = (PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC)glewGetProcAddress((const GLubyte*)"glCheckFramebufferStatusEXT");
+  return glCheckFramebufferStatusEXT(target);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteFramebuffersEXT (GLsizei n, const GLuint* framebuffers)
+{
+  glDeleteFramebuffersEXT = (PFNGLDELETEFRAMEBUFFERSEXTPROC)glewGetProcAddress((const GLubyte*)"glDeleteFramebuffersEXT");
+  glDeleteFramebuffersEXT(n, framebuffers);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteRenderbuffersEXT (GLsizei n, const GLuint* renderbuffers)
+{
+  glDeleteRenderbuffersEXT = (PFNGLDELETERENDERBUFFERSEXTPROC)glewGetProcAddress((const GLubyte*)"glDeleteRenderbuffersEXT");
+  glDeleteRenderbuffersEXT(n, renderbuffers);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferRenderbufferEXT (GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer)
+{
+  glFramebufferRenderbufferEXT = (PFNGLFRAMEBUFFERRENDERBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glFramebufferRenderbufferEXT");
+  glFramebufferRenderbufferEXT(target, attachment, renderbuffertarget, renderbuffer);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferTexture1DEXT (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+  glFramebufferTexture1DEXT = (PFNGLFRAMEBUFFERTEXTURE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTexture1DEXT");
+  glFramebufferTexture1DEXT(target, attachment, textarget, texture, level);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferTexture2DEXT (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level)
+{
+  glFramebufferTexture2DEXT = (PFNGLFRAMEBUFFERTEXTURE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTexture2DEXT");
+  glFramebufferTexture2DEXT(target, attachment, textarget, texture, level);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferTexture3DEXT (GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset)
+{
+  glFramebufferTexture3DEXT = (PFNGLFRAMEBUFFERTEXTURE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTexture3DEXT");
+  glFramebufferTexture3DEXT(target, attachment, textarget, texture, level, zoffset);
+}
+
+static void GLAPIENTRY _glewLazy_glGenFramebuffersEXT (GLsizei n, GLuint* framebuffers)
+{
+  glGenFramebuffersEXT = (PFNGLGENFRAMEBUFFERSEXTPROC)glewGetProcAddress((const GLubyte*)"glGenFramebuffersEXT");
+  glGenFramebuffersEXT(n, framebuffers);
+}
+
+static void GLAPIENTRY _glewLazy_glGenRenderbuffersEXT (GLsizei n, GLuint* renderbuffers)
+{
+  glGenRenderbuffersEXT = (PFNGLGENRENDERBUFFERSEXTPROC)glewGetProcAddress((const GLubyte*)"glGenRenderbuffersEXT");
+  glGenRenderbuffersEXT(n, renderbuffers);
+}
+
+static void GLAPIENTRY _glewLazy_glGenerateMipmapEXT (GLenum target)
+{
+  glGenerateMipmapEXT = (PFNGLGENERATEMIPMAPEXTPROC)glewGetProcAddress((const GLubyte*)"glGenerateMipmapEXT");
+  glGenerateMipmapEXT(target);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFramebufferAttachmentParameterivEXT (GLenum target, GLenum attachment, GLenum pname, GLint* params)
+{
+  glGetFramebufferAttachmentParameterivEXT = (PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetFramebufferAttachmentParameterivEXT");
+  glGetFramebufferAttachmentParameterivEXT(target, attachment, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetRenderbufferParameterivEXT (GLenum target, GLenum pname, GLint* params)
+{
+  glGetRenderbufferParameterivEXT = (PFNGLGETRENDERBUFFERPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetRenderbufferParameterivEXT");
+  glGetRenderbufferParameterivEXT(target, pname, params);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsFramebufferEXT (GLuint framebuffer)
+{
+  glIsFramebufferEXT = (PFNGLISFRAMEBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glIsFramebufferEXT");
+  return glIsFramebufferEXT(framebuffer);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsRenderbufferEXT (GLuint renderbuffer)
+{
+  glIsRenderbufferEXT = (PFNGLISRENDERBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glIsRenderbufferEXT");
+  return glIsRenderbufferEXT(renderbuffer);
+}
+
+static void GLAPIENTRY _glewLazy_glRenderbufferStorageEXT (GLenum target, GLenum internalformat, GLsizei width, GLsizei height)
+{
+  glRenderbufferStorageEXT = (PFNGLRENDERBUFFERSTORAGEEXTPROC)glewGetProcAddress((const GLubyte*)"glRenderbufferStorageEXT");
+  glRenderbufferStorageEXT(target, internalformat, width, height);
+}
+
+
+static void GLAPIENTRY _glewLazy_glFramebufferTextureEXT (GLenum target, GLenum attachment, GLuint texture, GLint level)
+{
+  glFramebufferTextureEXT = (PFNGLFRAMEBUFFERTEXTUREEXTPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTextureEXT");
+  glFramebufferTextureEXT(target, attachment, texture, level);
+}
+
+static void GLAPIENTRY _glewLazy_glFramebufferTextureFaceEXT (GLenum target, GLenum attachment, GLuint texture, GLint level, GLenum face)
+{
+  glFramebufferTextureFaceEXT = (PFNGLFRAMEBUFFERTEXTUREFACEEXTPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTextureFaceEXT");
+  glFramebufferTextureFaceEXT(target, attachment, texture, level, face);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramParameteriEXT (GLuint program, GLenum pname, GLint value)
+{
+  glProgramParameteriEXT = (PFNGLPROGRAMPARAMETERIEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramParameteriEXT");
+  glProgramParameteriEXT(program, pname, value);
+}
+
+
+static void GLAPIENTRY _glewLazy_glProgramEnvParameters4fvEXT (GLenum target, GLuint index, GLsizei count, const GLfloat* params)
+{
+  glProgramEnvParameters4fvEXT = (PFNGLPROGRAMENVPARAMETERS4FVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramEnvParameters4fvEXT");
+  glProgramEnvParameters4fvEXT(target, index, count, params);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramLocalParameters4fvEXT (GLenum target, GLuint index, GLsizei count, const GLfloat* params)
+{
+  glProgramLocalParameters4fvEXT = (PFNGLPROGRAMLOCALPARAMETERS4FVEXTPROC)glewGetProcAddress((const GLubyte*)"glProgramLocalParameters4fvEXT");
+  glProgramLocalParameters4fvEXT(target, index, count, params);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBindFragDataLocationEXT (GLuint program, GLuint color, const GLchar *name)
+{
+  glBindFragDataLocationEXT = (PFNGLBINDFRAGDATALOCATIONEXTPROC)glewGetProcAddress((const GLubyte*)"glBindFragDataLocationEXT");
+  glBindFragDataLocationEXT(program, color, name);
+}
+
+static GLint GLAPIENTRY _glewLazy_glGetFragDataLocationEXT (GLuint program, const GLchar *name)
+{
+  glGetFragDataLocationEXT = (PFNGLGETFRAGDATALOCATIONEXTPROC)glewGetProcAddress((const GLubyte*)"glGetFragDataLocationEXT");
+  return glGetFragDataLocationEXT(program, name);
+}
+
+static void GLAPIENTRY _glewLazy_glGetUniformuivEXT (GLuint program, GLint location, GLuint *params)
+{
+  glGetUniformuivEXT = (PFNGLGETUNIFORMUIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetUniformuivEXT");
+  glGetUniformuivEXT(program, location, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribIivEXT (GLuint index, GLenum pname, GLint *params)
+{
+  glGetVertexAttribIivEXT = (PFNGLGETVERTEXATTRIBIIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribIivEXT");
+  glGetVertexAttribIivEXT(index, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribIuivEXT (GLuint index, GLenum pname, GLuint *params)
+{
+  glGetVertexAttribIuivEXT = (PFNGLGETVERTEXATTRIBIUIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribIuivEXT");
+  glGetVertexAttribIuivEXT(index, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1uiEXT (GLint location, GLuint v0)
+{
+  glUniform1uiEXT = (PFNGLUNIFORM1UIEXTPROC)glewGetProcAddress((const GLubyte*)"glUniform1uiEXT");
+  glUniform1uiEXT(location, v0);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1uivEXT (GLint location, GLsizei count, const GLuint *value)
+{
+  glUniform1uivEXT = (PFNGLUNIFORM1UIVEXTPROC)glewGetProcAddress((const GLubyte*)"glUniform1uivEXT");
+  glUniform1uivEXT(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2uiEXT (GLint location, GLuint v0, GLuint v1)
+{
+  glUniform2uiEXT = (PFNGLUNIFORM2UIEXTPROC)glewGetProcAddress((const GLubyte*)"glUniform2uiEXT");
+  glUniform2uiEXT(location, v0, v1);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2uivEXT (GLint location, GLsizei count, const GLuint *value)
+{
+  glUniform2uivEXT = (PFNGLUNIFORM2UIVEXTPROC)glewGetProcAddress((const GLubyte*)"glUniform2uivEXT");
+  glUniform2uivEXT(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3uiEXT (GLint location, GLuint v0, GLuint v1, GLuint v2)
+{
+  glUniform3uiEXT = (PFNGLUNIFORM3UIEXTPROC)glewGetProcAddress((const GLubyte*)"glUniform3uiEXT");
+  glUniform3uiEXT(location, v0, v1, v2);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3uivEXT (GLint location, GLsizei count, const GLuint *value)
+{
+  glUniform3uivEXT = (PFNGLUNIFORM3UIVEXTPROC)glewGetProcAddress((const GLubyte*)"glUniform3uivEXT");
+  glUniform3uivEXT(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4uiEXT (GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3)
+{
+  glUniform4uiEXT = (PFNGLUNIFORM4UIEXTPROC)glewGetProcAddress((const GLubyte*)"glUniform4uiEXT");
+  glUniform4uiEXT(location, v0, v1, v2, v3);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4uivEXT (GLint location, GLsizei count, const GLuint *value)
+{
+  glUniform4uivEXT = (PFNGLUNIFORM4UIVEXTPROC)glewGetProcAddress((const GLubyte*)"glUniform4uivEXT");
+  glUniform4uivEXT(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI1iEXT (GLuint index, GLint x)
+{
+  glVertexAttribI1iEXT = (PFNGLVERTEXATTRIBI1IEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI1iEXT");
+  glVertexAttribI1iEXT(index, x);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI1ivEXT (GLuint index, const GLint *v)
+{
+  glVertexAttribI1ivEXT = (PFNGLVERTEXATTRIBI1IVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI1ivEXT");
+  glVertexAttribI1ivEXT(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI1uiEXT (GLuint index, GLuint x)
+{
+  glVertexAttribI1uiEXT = (PFNGLVERTEXATTRIBI1UIEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI1uiEXT");
+  glVertexAttribI1uiEXT(index, x);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI1uivEXT (GLuint index, const GLuint *v)
+{
+  glVertexAttribI1uivEXT = (PFNGLVERTEXATTRIBI1UIVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI1uivEXT");
+  glVertexAttribI1uivEXT(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI2iEXT (GLuint index, GLint x, GLint y)
+{
+  glVertexAttribI2iEXT = (PFNGLVERTEXATTRIBI2IEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI2iEXT");
+  glVertexAttribI2iEXT(index, x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI2ivEXT (GLuint index, const GLint *v)
+{
+  glVertexAttribI2ivEXT = (PFNGLVERTEXATTRIBI2IVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI2ivEXT");
+  glVertexAttribI2ivEXT(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI2uiEXT (GLuint index, GLuint x, GLuint y)
+{
+  glVertexAttribI2uiEXT = (PFNGLVERTEXATTRIBI2UIEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI2uiEXT");
+  glVertexAttribI2uiEXT(index, x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI2uivEXT (GLuint index, const GLuint *v)
+{
+  glVertexAttribI2uivEXT = (PFNGLVERTEXATTRIBI2UIVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI2uivEXT");
+  glVertexAttribI2uivEXT(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI3iEXT (GLuint index, GLint x, GLint y, GLint z)
+{
+  glVertexAttribI3iEXT = (PFNGLVERTEXATTRIBI3IEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI3iEXT");
+  glVertexAttribI3iEXT(index, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI3ivEXT (GLuint index, const GLint *v)
+{
+  glVertexAttribI3ivEXT = (PFNGLVERTEXATTRIBI3IVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI3ivEXT");
+  glVertexAttribI3ivEXT(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI3uiEXT (GLuint index, GLuint x, GLuint y, GLuint z)
+{
+  glVertexAttribI3uiEXT = (PFNGLVERTEXATTRIBI3UIEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI3uiEXT");
+  glVertexAttribI3uiEXT(index, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI3uivEXT (GLuint index, const GLuint *v)
+{
+  glVertexAttribI3uivEXT = (PFNGLVERTEXATTRIBI3UIVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI3uivEXT");
+  glVertexAttribI3uivEXT(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI4bvEXT (GLuint index, const GLbyte *v)
+{
+  glVertexAttribI4bvEXT = (PFNGLVERTEXATTRIBI4BVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI4bvEXT");
+  glVertexAttribI4bvEXT(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI4iEXT (GLuint index, GLint x, GLint y, GLint z, GLint w)
+{
+  glVertexAttribI4iEXT = (PFNGLVERTEXATTRIBI4IEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI4iEXT");
+  glVertexAttribI4iEXT(index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI4ivEXT (GLuint index, const GLint *v)
+{
+  glVertexAttribI4ivEXT = (PFNGLVERTEXATTRIBI4IVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI4ivEXT");
+  glVertexAttribI4ivEXT(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI4svEXT (GLuint index, const GLshort *v)
+{
+  glVertexAttribI4svEXT = (PFNGLVERTEXATTRIBI4SVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI4svEXT");
+  glVertexAttribI4svEXT(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI4ubvEXT (GLuint index, const GLubyte *v)
+{
+  glVertexAttribI4ubvEXT = (PFNGLVERTEXATTRIBI4UBVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI4ubvEXT");
+  glVertexAttribI4ubvEXT(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI4uiEXT (GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
+{
+  glVertexAttribI4uiEXT = (PFNGLVERTEXATTRIBI4UIEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI4uiEXT");
+  glVertexAttribI4uiEXT(index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI4uivEXT (GLuint index, const GLuint *v)
+{
+  glVertexAttribI4uivEXT = (PFNGLVERTEXATTRIBI4UIVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI4uivEXT");
+  glVertexAttribI4uivEXT(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribI4usvEXT (GLuint index, const GLushort *v)
+{
+  glVertexAttribI4usvEXT = (PFNGLVERTEXATTRIBI4USVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribI4usvEXT");
+  glVertexAttribI4usvEXT(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribIPointerEXT (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer)
+{
+  glVertexAttribIPointerEXT = (PFNGLVERTEXATTRIBIPOINTEREXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribIPointerEXT");
+  glVertexAttribIPointerEXT(index, size, type, stride, pointer);
+}
+
+
+static void GLAPIENTRY _glewLazy_glGetHistogramEXT (GLenum target, GLboolean reset, GLenum format, GLenum type, void *values)
+{
+  glGetHistogramEXT = (PFNGLGETHISTOGRAMEXTPROC)glewGetProcAddress((const GLubyte*)"glGetHistogramEXT");
+  glGetHistogramEXT(target, reset, format, type, values);
+}
+
+static void GLAPIENTRY _glewLazy_glGetHistogramParameterfvEXT (GLenum target, GLenum pname, GLfloat* params)
+{
+  glGetHistogramParameterfvEXT = (PFNGLGETHISTOGRAMPARAMETERFVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetHistogramParameterfvEXT");
+  glGetHistogramParameterfvEXT(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetHistogramParameterivEXT (GLenum target, GLenum pname, GLint* params)
+{
+  glGetHistogramParameterivEXT = (PFNGLGETHISTOGRAMPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetHistogramParameterivEXT");
+  glGetHistogramParameterivEXT(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMinmaxEXT (GLenum target, GLboolean reset, GLenum format, GLenum type, void *values)
+{
+  glGetMinmaxEXT = (PFNGLGETMINMAXEXTPROC)glewGetProcAddress((const GLubyte*)"glGetMinmaxEXT");
+  glGetMinmaxEXT(target, reset, format, type, values);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMinmaxParameterfvEXT (GLenum target, GLenum pname, GLfloat* params)
+{
+  glGetMinmaxParameterfvEXT = (PFNGLGETMINMAXPARAMETERFVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetMinmaxParameterfvEXT");
+  glGetMinmaxParameterfvEXT(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMinmaxParameterivEXT (GLenum target, GLenum pname, GLint* params)
+{
+  glGetMinmaxParameterivEXT = (PFNGLGETMINMAXPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetMinmaxParameterivEXT");
+  glGetMinmaxParameterivEXT(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glHistogramEXT (GLenum target, GLsizei width, GLenum internalformat, GLboolean sink)
+{
+  glHistogramEXT = (PFNGLHISTOGRAMEXTPROC)glewGetProcAddress((const GLubyte*)"glHistogramEXT");
+  glHistogramEXT(target, width, internalformat, sink);
+}
+
+static void GLAPIENTRY _glewLazy_glMinmaxEXT (GLenum target, GLenum internalformat, GLboolean sink)
+{
+  glMinmaxEXT = (PFNGLMINMAXEXTPROC)glewGetProcAddress((const GLubyte*)"glMinmaxEXT");
+  glMinmaxEXT(target, internalformat, sink);
+}
+
+static void GLAPIENTRY _glewLazy_glResetHistogramEXT (GLenum target)
+{
+  glResetHistogramEXT = (PFNGLRESETHISTOGRAMEXTPROC)glewGetProcAddress((const GLubyte*)"glResetHistogramEXT");
+  glResetHistogramEXT(target);
+}
+
+static void GLAPIENTRY _glewLazy_glResetMinmaxEXT (GLenum target)
+{
+  glResetMinmaxEXT = (PFNGLRESETMINMAXEXTPROC)glewGetProcAddress((const GLubyte*)"glResetMinmaxEXT");
+  glResetMinmaxEXT(target);
+}
+
+
+static void GLAPIENTRY _glewLazy_glIndexFuncEXT (GLenum func, GLfloat ref)
+{
+  glIndexFuncEXT = (PFNGLINDEXFUNCEXTPROC)glewGetProcAddress((const GLubyte*)"glIndexFuncEXT");
+  glIndexFuncEXT(func, ref);
+}
+
+
+static void GLAPIENTRY _glewLazy_glIndexMaterialEXT (GLenum face, GLenum mode)
+{
+  glIndexMaterialEXT = (PFNGLINDEXMATERIALEXTPROC)glewGetProcAddress((const GLubyte*)"glIndexMaterialEXT");
+  glIndexMaterialEXT(face, mode);
+}
+
+
+static void GLAPIENTRY _glewLazy_glApplyTextureEXT (GLenum mode)
+{
+  glApplyTextureEXT = (PFNGLAPPLYTEXTUREEXTPROC)glewGetProcAddress((const GLubyte*)"glApplyTextureEXT");
+  glApplyTextureEXT(mode);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureLightEXT (GLenum pname)
+{
+  glTextureLightEXT = (PFNGLTEXTURELIGHTEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureLightEXT");
+  glTextureLightEXT(pname);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureMaterialEXT (GLenum face, GLenum mode)
+{
+  glTextureMaterialEXT = (PFNGLTEXTUREMATERIALEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureMaterialEXT");
+  glTextureMaterialEXT(face, mode);
+}
+
+
+static void GLAPIENTRY _glewLazy_glMultiDrawArraysEXT (GLenum mode, const GLint* first, const GLsizei *count, GLsizei primcount)
+{
+  glMultiDrawArraysEXT = (PFNGLMULTIDRAWARRAYSEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawArraysEXT");
+  glMultiDrawArraysEXT(mode, first, count, primcount);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiDrawElementsEXT (GLenum mode, GLsizei* count, GLenum type, const void *const *indices, GLsizei primcount)
+{
+  glMultiDrawElementsEXT = (PFNGLMULTIDRAWELEMENTSEXTPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawElementsEXT");
+  glMultiDrawElementsEXT(mode, count, type, indices, primcount);
+}
+
+
+static void GLAPIENTRY _glewLazy_glSampleMaskEXT (GLclampf value, GLboolean invert)
+{
+  glSampleMaskEXT = (PFNGLSAMPLEMASKEXTPROC)glewGetProcAddress((const GLubyte*)"glSampleMaskEXT");
+  glSampleMaskEXT(value, invert);
+}
+
+static void GLAPIENTRY _glewLazy_glSamplePatternEXT (GLenum pattern)
+{
+  glSamplePatternEXT = (PFNGLSAMPLEPATTERNEXTPROC)glewGetProcAddress((const GLubyte*)"glSamplePatternEXT");
+  glSamplePatternEXT(pattern);
+}
+
+
+static void GLAPIENTRY _glewLazy_glColorTableEXT (GLenum target, GLenum internalFormat, GLsizei width, GLenum format, GLenum type, const void *data)
+{
+  glColorTableEXT = (PFNGLCOLORTABLEEXTPROC)glewGetProcAddress((const GLubyte*)"glColorTableEXT");
+  glColorTableEXT(target, internalFormat, width, format, type, data);
+}
+
+static void GLAPIENTRY _glewLazy_glGetColorTableEXT (GLenum target, GLenum format, GLenum type, void *data)
+{
+  glGetColorTableEXT = (PFNGLGETCOLORTABLEEXTPROC)glewGetProcAddress((const GLubyte*)"glGetColorTableEXT");
+  glGetColorTableEXT(target, format, type, data);
+}
+
+static void GLAPIENTRY _glewLazy_glGetColorTableParameterfvEXT (GLenum target, GLenum pname, GLfloat* params)
+{
+  glGetColorTableParameterfvEXT = (PFNGLGETCOLORTABLEPARAMETERFVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetColorTableParameterfvEXT");
+  glGetColorTableParameterfvEXT(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetColorTableParameterivEXT (GLenum target, GLenum pname, GLint* params)
+{
+  glGetColorTableParameterivEXT = (PFNGLGETCOLORTABLEPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetColorTableParameterivEXT");
+  glGetColorTableParameterivEXT(target, pname, params);
+}
+
+
+static void GLAPIENTRY _glewLazy_glGetPixelTransformParameterfvEXT (GLenum target, GLenum pname, const GLfloat* params)
+{
+  glGetPixelTransformParameterfvEXT = (PFNGLGETPIXELTRANSFORMPARAMETERFVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetPixelTransformParameterfvEXT");
+  glGetPixelTransformParameterfvEXT(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPixelTransformParameterivEXT (GLenum target, GLenum pname, const GLint* params)
+{
+  glGetPixelTransformParameterivEXT = (PFNGLGETPIXELTRANSFORMPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetPixelTransformParameterivEXT");
+  glGetPixelTransformParameterivEXT(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glPixelTransformParameterfEXT (GLenum target, GLenum pname, const GLfloat param)
+{
+  glPixelTransformParameterfEXT = (PFNGLPIXELTRANSFORMPARAMETERFEXTPROC)glewGetProcAddress((const GLubyte*)"glPixelTransformParameterfEXT");
+  glPixelTransformParameterfEXT(target, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glPixelTransformParameterfvEXT (GLenum target, GLenum pname, const GLfloat* params)
+{
+  glPixelTransformParameterfvEXT = (PFNGLPIXELTRANSFORMPARAMETERFVEXTPROC)glewGetProcAddress((const GLubyte*)"glPixelTransformParameterfvEXT");
+  glPixelTransformParameterfvEXT(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glPixelTransformParameteriEXT (GLenum target, GLenum pname, const GLint param)
+{
+  glPixelTransformParameteriEXT = (PFNGLPIXELTRANSFORMPARAMETERIEXTPROC)glewGetProcAddress((const GLubyte*)"glPixelTransformParameteriEXT");
+  glPixelTransformParameteriEXT(target, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glPixelTransformParameterivEXT (GLenum target, GLenum pname, const GLint* params)
+{
+  glPixelTransformParameterivEXT = (PFNGLPIXELTRANSFORMPARAMETERIVEXTPROC)glewGetProcAddress((const GLubyte*)"glPixelTransformParameterivEXT");
+  glPixelTransformParameterivEXT(target, pname, params);
+}
+
+
+static void GLAPIENTRY _glewLazy_glPointParameterfEXT (GLenum pname, GLfloat param)
+{
+  glPointParameterfEXT = (PFNGLPOINTPARAMETERFEXTPROC)glewGetProcAddress((const GLubyte*)"glPointParameterfEXT");
+  glPointParameterfEXT(pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glPointParameterfvEXT (GLenum pname, const GLfloat* params)
+{
+  glPointParameterfvEXT = (PFNGLPOINTPARAMETERFVEXTPROC)glewGetProcAddress((const GLubyte*)"glPointParameterfvEXT");
+  glPointParameterfvEXT(pname, params);
+}
+
+
+static void GLAPIENTRY _glewLazy_glPolygonOffsetEXT (GLfloat factor, GLfloat bias)
+{
+  glPolygonOffsetEXT = (PFNGLPOLYGONOFFSETEXTPROC)glewGetProcAddress((const GLubyte*)"glPolygonOffsetEXT");
+  glPolygonOffsetEXT(factor, bias);
+}
+
+
+static void GLAPIENTRY _glewLazy_glPolygonOffsetClampEXT (GLfloat factor, GLfloat units, GLfloat clamp)
+{
+  glPolygonOffsetClampEXT = (PFNGLPOLYGONOFFSETCLAMPEXTPROC)glewGetProcAddress((const GLubyte*)"glPolygonOffsetClampEXT");
+  glPolygonOffsetClampEXT(factor, units, clamp);
+}
+
+
+static void GLAPIENTRY _glewLazy_glProvokingVertexEXT (GLenum mode)
+{
+  glProvokingVertexEXT = (PFNGLPROVOKINGVERTEXEXTPROC)glewGetProcAddress((const GLubyte*)"glProvokingVertexEXT");
+  glProvokingVertexEXT(mode);
+}
+
+
+static void GLAPIENTRY _glewLazy_glCoverageModulationNV (GLenum components)
+{
+  glCoverageModulationNV = (PFNGLCOVERAGEMODULATIONNVPROC)glewGetProcAddress((const GLubyte*)"glCoverageModulationNV");
+  glCoverageModulationNV(components);
+}
+
+static void GLAPIENTRY _glewLazy_glCoverageModulationTableNV (GLsizei n, const GLfloat* v)
+{
+  glCoverageModulationTableNV = (PFNGLCOVERAGEMODULATIONTABLENVPROC)glewGetProcAddress((const GLubyte*)"glCoverageModulationTableNV");
+  glCoverageModulationTableNV(n, v);
+}
+
+static void GLAPIENTRY _glewLazy_glGetCoverageModulationTableNV (GLsizei bufsize, GLfloat* v)
+{
+  glGetCoverageModulationTableNV = (PFNGLGETCOVERAGEMODULATIONTABLENVPROC)glewGetProcAddress((const GLubyte*)"glGetCoverageModulationTableNV");
+  glGetCoverageModulationTableNV(bufsize, v);
+}
+
+static void GLAPIENTRY _glewLazy_glRasterSamplesEXT (GLuint samples, GLboolean fixedsamplelocations)
+{
+  glRasterSamplesEXT = (PFNGLRASTERSAMPLESEXTPROC)glewGetProcAddress((const GLubyte*)"glRasterSamplesEXT");
+  glRasterSamplesEXT(samples, fixedsamplelocations);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBeginSceneEXT (void)
+{
+  glBeginSceneEXT = (PFNGLBEGINSCENEEXTPROC)glewGetProcAddress((const GLubyte*)"glBeginSceneEXT");
+  glBeginSceneEXT();
+}
+
+static void GLAPIENTRY _glewLazy_glEndSceneEXT (void)
+{
+  glEndSceneEXT = (PFNGLENDSCENEEXTPROC)glewGetProcAddress((const GLubyte*)"glEndSceneEXT");
+  glEndSceneEXT();
+}
+
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3bEXT (GLbyte red, GLbyte green, GLbyte blue)
+{
+  glSecondaryColor3bEXT = (PFNGLSECONDARYCOLOR3BEXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3bEXT");
+  glSecondaryColor3bEXT(red, green, blue);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3bvEXT (const GLbyte *v)
+{
+  glSecondaryColor3bvEXT = (PFNGLSECONDARYCOLOR3BVEXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3bvEXT");
+  glSecondaryColor3bvEXT(v);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3dEXT (GLdouble red, GLdouble green, GLdouble blue)
+{
+  glSecondaryColor3dEXT = (PFNGLSECONDARYCOLOR3DEXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3dEXT");
+  glSecondaryColor3dEXT(red, green, blue);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3dvEXT (const GLdouble *v)
+{
+  glSecondaryColor3dvEXT = (PFNGLSECONDARYCOLOR3DVEXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3dvEXT");
+  glSecondaryColor3dvEXT(v);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3fEXT (GLfloat red, GLfloat green, GLfloat blue)
+{
+  glSecondaryColor3fEXT = (PFNGLSECONDARYCOLOR3FEXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3fEXT");
+  glSecondaryColor3fEXT(red, green, blue);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3fvEXT (const GLfloat *v)
+{
+  glSecondaryColor3fvEXT = (PFNGLSECONDARYCOLOR3FVEXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3fvEXT");
+  glSecondaryColor3fvEXT(v);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3iEXT (GLint red, GLint green, GLint blue)
+{
+  glSecondaryColor3iEXT = (PFNGLSECONDARYCOLOR3IEXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3iEXT");
+  glSecondaryColor3iEXT(red, green, blue);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3ivEXT (const GLint *v)
+{
+  glSecondaryColor3ivEXT = (PFNGLSECONDARYCOLOR3IVEXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3ivEXT");
+  glSecondaryColor3ivEXT(v);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3sEXT (GLshort red, GLshort green, GLshort blue)
+{
+  glSecondaryColor3sEXT = (PFNGLSECONDARYCOLOR3SEXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3sEXT");
+  glSecondaryColor3sEXT(red, green, blue);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3svEXT (const GLshort *v)
+{
+  glSecondaryColor3svEXT = (PFNGLSECONDARYCOLOR3SVEXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3svEXT");
+  glSecondaryColor3svEXT(v);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3ubEXT (GLubyte red, GLubyte green, GLubyte blue)
+{
+  glSecondaryColor3ubEXT = (PFNGLSECONDARYCOLOR3UBEXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3ubEXT");
+  glSecondaryColor3ubEXT(red, green, blue);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3ubvEXT (const GLubyte *v)
+{
+  glSecondaryColor3ubvEXT = (PFNGLSECONDARYCOLOR3UBVEXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3ubvEXT");
+  glSecondaryColor3ubvEXT(v);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3uiEXT (GLuint red, GLuint green, GLuint blue)
+{
+  glSecondaryColor3uiEXT = (PFNGLSECONDARYCOLOR3UIEXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3uiEXT");
+  glSecondaryColor3uiEXT(red, green, blue);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3uivEXT (const GLuint *v)
+{
+  glSecondaryColor3uivEXT = (PFNGLSECONDARYCOLOR3UIVEXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3uivEXT");
+  glSecondaryColor3uivEXT(v);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3usEXT (GLushort red, GLushort green, GLushort blue)
+{
+  glSecondaryColor3usEXT = (PFNGLSECONDARYCOLOR3USEXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3usEXT");
+  glSecondaryColor3usEXT(red, green, blue);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3usvEXT (const GLushort *v)
+{
+  glSecondaryColor3usvEXT = (PFNGLSECONDARYCOLOR3USVEXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3usvEXT");
+  glSecondaryColor3usvEXT(v);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColorPointerEXT (GLint size, GLenum type, GLsizei stride, const void *pointer)
+{
+  glSecondaryColorPointerEXT = (PFNGLSECONDARYCOLORPOINTEREXTPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColorPointerEXT");
+  glSecondaryColorPointerEXT(size, type, stride, pointer);
+}
+
+
+static void GLAPIENTRY _glewLazy_glActiveProgramEXT (GLuint program)
+{
+  glActiveProgramEXT = (PFNGLACTIVEPROGRAMEXTPROC)glewGetProcAddress((const GLubyte*)"glActiveProgramEXT");
+  glActiveProgramEXT(program);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glCreateShaderProgramEXT (GLenum type, const GLchar* string)
+{
+  glCreateShaderProgramEXT = (PFNGLCREATESHADERPROGRAMEXTPROC)glewGetProcAddress((const GLubyte*)"glCreateShaderProgramEXT");
+  return glCreateShaderProgramEXT(type, string);
+}
+
+static void GLAPIENTRY _glewLazy_glUseShaderProgramEXT (GLenum type, GLuint program)
+{
+  glUseShaderProgramEXT = (PFNGLUSESHADERPROGRAMEXTPROC)glewGetProcAddress((const GLubyte*)"glUseShaderProgramEXT");
+  glUseShaderProgramEXT(type, program);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBindImageTextureEXT (GLuint index, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLint format)
+{
+  glBindImageTextureEXT = (PFNGLBINDIMAGETEXTUREEXTPROC)glewGetProcAddress((const GLubyte*)"glBindImageTextureEXT");
+  glBindImageTextureEXT(index, texture, level, layered, layer, access, format);
+}
+
+static void GLAPIENTRY _glewLazy_glMemoryBarrierEXT (GLbitfield barriers)
+{
+  glMemoryBarrierEXT = (PFNGLMEMORYBARRIEREXTPROC)glewGetProcAddress((const GLubyte*)"glMemoryBarrierEXT");
+  glMemoryBarrierEXT(barriers);
+}
+
+
+static void GLAPIENTRY _glewLazy_glActiveStencilFaceEXT (GLenum face)
+{
+  glActiveStencilFaceEXT = (PFNGLACTIVESTENCILFACEEXTPROC)glewGetProcAddress((const GLubyte*)"glActiveStencilFaceEXT");
+  glActiveStencilFaceEXT(face);
+}
+
+
+static void GLAPIENTRY _glewLazy_glTexSubImage1DEXT (GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels)
+{
+  glTexSubImage1DEXT = (PFNGLTEXSUBIMAGE1DEXTPROC)glewGetProcAddress((const GLubyte*)"glTexSubImage1DEXT");
+  glTexSubImage1DEXT(target, level, xoffset, width, format, type, pixels);
+}
+
+static void GLAPIENTRY _glewLazy_glTexSubImage2DEXT (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+{
+  glTexSubImage2DEXT = (PFNGLTEXSUBIMAGE2DEXTPROC)glewGetProcAddress((const GLubyte*)"glTexSubImage2DEXT");
+  glTexSubImage2DEXT(target, level, xoffset, yoffset, width, height, format, type, pixels);
+}
+
+static void GLAPIENTRY _glewLazy_glTexSubImage3DEXT (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels)
+{
+  glTexSubImage3DEXT = (PFNGLTEXSUBIMAGE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glTexSubImage3DEXT");
+  glTexSubImage3DEXT(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+}
+
+
+static void GLAPIENTRY _glewLazy_glTexImage3DEXT (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+  glTexImage3DEXT = (PFNGLTEXIMAGE3DEXTPROC)glewGetProcAddress((const GLubyte*)"glTexImage3DEXT");
+  glTexImage3DEXT(target, level, internalformat, width, height, depth, border, format, type, pixels);
+}
+
+
+static void GLAPIENTRY _glewLazy_glFramebufferTextureLayerEXT (GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer)
+{
+  glFramebufferTextureLayerEXT = (PFNGLFRAMEBUFFERTEXTURELAYEREXTPROC)glewGetProcAddress((const GLubyte*)"glFramebufferTextureLayerEXT");
+  glFramebufferTextureLayerEXT(target, attachment, texture, level, layer);
+}
+
+
+static void GLAPIENTRY _glewLazy_glTexBufferEXT (GLenum target, GLenum internalformat, GLuint buffer)
+{
+  glTexBufferEXT = (PFNGLTEXBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"glTexBufferEXT");
+  glTexBufferEXT(target, internalformat, buffer);
+}
+
+
+static void GLAPIENTRY _glewLazy_glClearColorIiEXT (GLint red, GLint green, GLint blue, GLint alpha)
+{
+  glClearColorIiEXT = (PFNGLCLEARCOLORIIEXTPROC)glewGetProcAddress((const GLubyte*)"glClearColorIiEXT");
+  glClearColorIiEXT(red, green, blue, alpha);
+}
+
+static void GLAPIENTRY _glewLazy_glClearColorIuiEXT (GLuint red, GLuint green, GLuint blue, GLuint alpha)
+{
+  glClearColorIuiEXT = (PFNGLCLEARCOLORIUIEXTPROC)glewGetProcAddress((const GLubyte*)"glClearColorIuiEXT");
+  glClearColorIuiEXT(red, green, blue, alpha);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTexParameterIivEXT (GLenum target, GLenum pname, GLint *params)
+{
+  glGetTexParameterIivEXT = (PFNGLGETTEXPARAMETERIIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetTexParameterIivEXT");
+  glGetTexParameterIivEXT(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTexParameterIuivEXT (GLenum target, GLenum pname, GLuint *params)
+{
+  glGetTexParameterIuivEXT = (PFNGLGETTEXPARAMETERIUIVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetTexParameterIuivEXT");
+  glGetTexParameterIuivEXT(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glTexParameterIivEXT (GLenum target, GLenum pname, const GLint *params)
+{
+  glTexParameterIivEXT = (PFNGLTEXPARAMETERIIVEXTPROC)glewGetProcAddress((const GLubyte*)"glTexParameterIivEXT");
+  glTexParameterIivEXT(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glTexParameterIuivEXT (GLenum target, GLenum pname, const GLuint *params)
+{
+  glTexParameterIuivEXT = (PFNGLTEXPARAMETERIUIVEXTPROC)glewGetProcAddress((const GLubyte*)"glTexParameterIuivEXT");
+  glTexParameterIuivEXT(target, pname, params);
+}
+
+
+static GLboolean GLAPIENTRY _glewLazy_glAreTexturesResidentEXT (GLsizei n, const GLuint* textures, GLboolean* residences)
+{
+  glAreTexturesResidentEXT = (PFNGLARETEXTURESRESIDENTEXTPROC)glewGetProcAddress((const GLubyte*)"glAreTexturesResidentEXT");
+  return glAreTexturesResidentEXT(n, textures, residences);
+}
+
+static void GLAPIENTRY _glewLazy_glBindTextureEXT (GLenum target, GLuint texture)
+{
+  glBindTextureEXT = (PFNGLBINDTEXTUREEXTPROC)glewGetProcAddress((const GLubyte*)"glBindTextureEXT");
+  glBindTextureEXT(target, texture);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteTexturesEXT (GLsizei n, const GLuint* textures)
+{
+  glDeleteTexturesEXT = (PFNGLDELETETEXTURESEXTPROC)glewGetProcAddress((const GLubyte*)"glDeleteTexturesEXT");
+  glDeleteTexturesEXT(n, textures);
+}
+
+static void GLAPIENTRY _glewLazy_glGenTexturesEXT (GLsizei n, GLuint* textures)
+{
+  glGenTexturesEXT = (PFNGLGENTEXTURESEXTPROC)glewGetProcAddress((const GLubyte*)"glGenTexturesEXT");
+  glGenTexturesEXT(n, textures);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsTextureEXT (GLuint texture)
+{
+  glIsTextureEXT = (PFNGLISTEXTUREEXTPROC)glewGetProcAddress((const GLubyte*)"glIsTextureEXT");
+  return glIsTextureEXT(texture);
+}
+
+static void GLAPIENTRY _glewLazy_glPrioritizeTexturesEXT (GLsizei n, const GLuint* textures, const GLclampf* priorities)
+{
+  glPrioritizeTexturesEXT = (PFNGLPRIORITIZETEXTURESEXTPROC)glewGetProcAddress((const GLubyte*)"glPrioritizeTexturesEXT");
+  glPrioritizeTexturesEXT(n, textures, priorities);
+}
+
+
+static void GLAPIENTRY _glewLazy_glTextureNormalEXT (GLenum mode)
+{
+  glTextureNormalEXT = (PFNGLTEXTURENORMALEXTPROC)glewGetProcAddress((const GLubyte*)"glTextureNormalEXT");
+  glTextureNormalEXT(mode);
+}
+
+
+static void GLAPIENTRY _glewLazy_glGetQueryObjecti64vEXT (GLuint id, GLenum pname, GLint64EXT *params)
+{
+  glGetQueryObjecti64vEXT = (PFNGLGETQUERYOBJECTI64VEXTPROC)glewGetProcAddress((const GLubyte*)"glGetQueryObjecti64vEXT");
+  glGetQueryObjecti64vEXT(id, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetQueryObjectui64vEXT (GLuint id, GLenum pname, GLuint64EXT *params)
+{
+  glGetQueryObjectui64vEXT = (PFNGLGETQUERYOBJECTUI64VEXTPROC)glewGetProcAddress((const GLubyte*)"glGetQueryObjectui64vEXT");
+  glGetQueryObjectui64vEXT(id, pname, params);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBeginTransformFeedbackEXT (GLenum primitiveMode)
+{
+  glBeginTransformFeedbackEXT = (PFNGLBEGINTRANSFORMFEEDBACKEXTPROC)glewGetProcAddress((const GLubyte*)"glBeginTransformFeedbackEXT");
+  glBeginTransformFeedbackEXT(primitiveMode);
+}
+
+static void GLAPIENTRY _glewLazy_glBindBufferBaseEXT (GLenum target, GLuint index, GLuint buffer)
+{
+  glBindBufferBaseEXT = (PFNGLBINDBUFFERBASEEXTPROC)glewGetProcAddress((const GLubyte*)"glBindBufferBaseEXT");
+  glBindBufferBaseEXT(target, index, buffer);
+}
+
+static void GLAPIENTRY _glewLazy_glBindBufferOffsetEXT (GLenum target, GLuint index, GLuint buffer, GLintptr offset)
+{
+  glBindBufferOffsetEXT = (PFNGLBINDBUFFEROFFSETEXTPROC)glewGetProcAddress((const GLubyte*)"glBindBufferOffsetEXT");
+  glBindBufferOffsetEXT(target, index, buffer, offset);
+}
+
+static void GLAPIENTRY _glewLazy_glBindBufferRangeEXT (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+  glBindBufferRangeEXT = (PFNGLBINDBUFFERRANGEEXTPROC)glewGetProcAddress((const GLubyte*)"glBindBufferRangeEXT");
+  glBindBufferRangeEXT(target, index, buffer, offset, size);
+}
+
+static void GLAPIENTRY _glewLazy_glEndTransformFeedbackEXT (void)
+{
+  glEndTransformFeedbackEXT = (PFNGLENDTRANSFORMFEEDBACKEXTPROC)glewGetProcAddress((const GLubyte*)"glEndTransformFeedbackEXT");
+  glEndTransformFeedbackEXT();
+}
+
+static void GLAPIENTRY _glewLazy_glGetTransformFeedbackVaryingEXT (GLuint program, GLuint index, GLsizei bufSize, GLsizei* length, GLsizei *size, GLenum *type, GLchar *name)
+{
+  glGetTransformFeedbackVaryingEXT = (PFNGLGETTRANSFORMFEEDBACKVARYINGEXTPROC)glewGetProcAddress((const GLubyte*)"glGetTransformFeedbackVaryingEXT");
+  glGetTransformFeedbackVaryingEXT(program, index, bufSize, length, size, type, name);
+}
+
+static void GLAPIENTRY _glewLazy_glTransformFeedbackVaryingsEXT (GLuint program, GLsizei count, const GLchar * const* varyings, GLenum bufferMode)
+{
+  glTransformFeedbackVaryingsEXT = (PFNGLTRANSFORMFEEDBACKVARYINGSEXTPROC)glewGetProcAddress((const GLubyte*)"glTransformFeedbackVaryingsEXT");
+  glTransformFeedbackVaryingsEXT(program, count, varyings, bufferMode);
+}
+
+
+static void GLAPIENTRY _glewLazy_glArrayElementEXT (GLint i)
+{
+  glArrayElementEXT = (PFNGLARRAYELEMENTEXTPROC)glewGetProcAddress((const GLubyte*)"glArrayElementEXT");
+  glArrayElementEXT(i);
+}
+
+static void GLAPIENTRY _glewLazy_glColorPointerEXT (GLint size, GLenum type, GLsizei stride, GLsizei count, const void *pointer)
+{
+  glColorPointerEXT = (PFNGLCOLORPOINTEREXTPROC)glewGetProcAddress((const GLubyte*)"glColorPointerEXT");
+  glColorPointerEXT(size, type, stride, count, pointer);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawArraysEXT (GLenum mode, GLint first, GLsizei count)
+{
+  glDrawArraysEXT = (PFNGLDRAWARRAYSEXTPROC)glewGetProcAddress((const GLubyte*)"glDrawArraysEXT");
+  glDrawArraysEXT(mode, first, count);
+}
+
+static void GLAPIENTRY _glewLazy_glEdgeFlagPointerEXT (GLsizei stride, GLsizei count, const GLboolean* pointer)
+{
+  glEdgeFlagPointerEXT = (PFNGLEDGEFLAGPOINTEREXTPROC)glewGetProcAddress((const GLubyte*)"glEdgeFlagPointerEXT");
+  glEdgeFlagPointerEXT(stride, count, pointer);
+}
+
+static void GLAPIENTRY _glewLazy_glIndexPointerEXT (GLenum type, GLsizei stride, GLsizei count, const void *pointer)
+{
+  glIndexPointerEXT = (PFNGLINDEXPOINTEREXTPROC)glewGetProcAddress((const GLubyte*)"glIndexPointerEXT");
+  glIndexPointerEXT(type, stride, count, pointer);
+}
+
+static void GLAPIENTRY _glewLazy_glNormalPointerEXT (GLenum type, GLsizei stride, GLsizei count, const void *pointer)
+{
+  glNormalPointerEXT = (PFNGLNORMALPOINTEREXTPROC)glewGetProcAddress((const GLubyte*)"glNormalPointerEXT");
+  glNormalPointerEXT(type, stride, count, pointer);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoordPointerEXT (GLint size, GLenum type, GLsizei stride, GLsizei count, const void *pointer)
+{
+  glTexCoordPointerEXT = (PFNGLTEXCOORDPOINTEREXTPROC)glewGetProcAddress((const GLubyte*)"glTexCoordPointerEXT");
+  glTexCoordPointerEXT(size, type, stride, count, pointer);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexPointerEXT (GLint size, GLenum type, GLsizei stride, GLsizei count, const void *pointer)
+{
+  glVertexPointerEXT = (PFNGLVERTEXPOINTEREXTPROC)glewGetProcAddress((const GLubyte*)"glVertexPointerEXT");
+  glVertexPointerEXT(size, type, stride, count, pointer);
+}
+
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribLdvEXT (GLuint index, GLenum pname, GLdouble* params)
+{
+  glGetVertexAttribLdvEXT = (PFNGLGETVERTEXATTRIBLDVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribLdvEXT");
+  glGetVertexAttribLdvEXT(index, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayVertexAttribLOffsetEXT (GLuint vaobj, GLuint buffer, GLuint index, GLint size, GLenum type, GLsizei stride, GLintptr offset)
+{
+  glVertexArrayVertexAttribLOffsetEXT = (PFNGLVERTEXARRAYVERTEXATTRIBLOFFSETEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayVertexAttribLOffsetEXT");
+  glVertexArrayVertexAttribLOffsetEXT(vaobj, buffer, index, size, type, stride, offset);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL1dEXT (GLuint index, GLdouble x)
+{
+  glVertexAttribL1dEXT = (PFNGLVERTEXATTRIBL1DEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL1dEXT");
+  glVertexAttribL1dEXT(index, x);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL1dvEXT (GLuint index, const GLdouble* v)
+{
+  glVertexAttribL1dvEXT = (PFNGLVERTEXATTRIBL1DVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL1dvEXT");
+  glVertexAttribL1dvEXT(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL2dEXT (GLuint index, GLdouble x, GLdouble y)
+{
+  glVertexAttribL2dEXT = (PFNGLVERTEXATTRIBL2DEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL2dEXT");
+  glVertexAttribL2dEXT(index, x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL2dvEXT (GLuint index, const GLdouble* v)
+{
+  glVertexAttribL2dvEXT = (PFNGLVERTEXATTRIBL2DVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL2dvEXT");
+  glVertexAttribL2dvEXT(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL3dEXT (GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+  glVertexAttribL3dEXT = (PFNGLVERTEXATTRIBL3DEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL3dEXT");
+  glVertexAttribL3dEXT(index, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL3dvEXT (GLuint index, const GLdouble* v)
+{
+  glVertexAttribL3dvEXT = (PFNGLVERTEXATTRIBL3DVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL3dvEXT");
+  glVertexAttribL3dvEXT(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL4dEXT (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+  glVertexAttribL4dEXT = (PFNGLVERTEXATTRIBL4DEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL4dEXT");
+  glVertexAttribL4dEXT(index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL4dvEXT (GLuint index, const GLdouble* v)
+{
+  glVertexAttribL4dvEXT = (PFNGLVERTEXATTRIBL4DVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL4dvEXT");
+  glVertexAttribL4dvEXT(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribLPointerEXT (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer)
+{
+  glVertexAttribLPointerEXT = (PFNGLVERTEXATTRIBLPOINTEREXTPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribLPointerEXT");
+  glVertexAttribLPointerEXT(index, size, type, stride, pointer);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBeginVertexShaderEXT (void)
+{
+  glBeginVertexShaderEXT = (PFNGLBEGINVERTEXSHADEREXTPROC)glewGetProcAddress((const GLubyte*)"glBeginVertexShaderEXT");
+  glBeginVertexShaderEXT();
+}
+
+static GLuint GLAPIENTRY _glewLazy_glBindLightParameterEXT (GLenum light, GLenum value)
+{
+  glBindLightParameterEXT = (PFNGLBINDLIGHTPARAMETEREXTPROC)glewGetProcAddress((const GLubyte*)"glBindLightParameterEXT");
+  return glBindLightParameterEXT(light, value);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glBindMaterialParameterEXT (GLenum face, GLenum value)
+{
+  glBindMaterialParameterEXT = (PFNGLBINDMATERIALPARAMETEREXTPROC)glewGetProcAddress((const GLubyte*)"glBindMaterialParameterEXT");
+  return glBindMaterialParameterEXT(face, value);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glBindParameterEXT (GLenum value)
+{
+  glBindParameterEXT = (PFNGLBINDPARAMETEREXTPROC)glewGetProcAddress((const GLubyte*)"glBindParameterEXT");
+  return glBindParameterEXT(value);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glBindTexGenParameterEXT (GLenum unit, GLenum coord, GLenum value)
+{
+  glBindTexGenParameterEXT = (PFNGLBINDTEXGENPARAMETEREXTPROC)glewGetProcAddress((const GLubyte*)"glBindTexGenParameterEXT");
+  return glBindTexGenParameterEXT(unit, coord, value);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glBindTextureUnitParameterEXT (GLenum unit, GLenum value)
+{
+  glBindTextureUnitParameterEXT = (PFNGLBINDTEXTUREUNITPARAMETEREXTPROC)glewGetProcAddress((const GLubyte*)"glBindTextureUnitParameterEXT");
+  return glBindTextureUnitParameterEXT(unit, value);
+}
+
+static void GLAPIENTRY _glewLazy_glBindVertexShaderEXT (GLuint id)
+{
+  glBindVertexShaderEXT = (PFNGLBINDVERTEXSHADEREXTPROC)glewGetProcAddress((const GLubyte*)"glBindVertexShaderEXT");
+  glBindVertexShaderEXT(id);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteVertexShaderEXT (GLuint id)
+{
+  glDeleteVertexShaderEXT = (PFNGLDELETEVERTEXSHADEREXTPROC)glewGetProcAddress((const GLubyte*)"glDeleteVertexShaderEXT");
+  glDeleteVertexShaderEXT(id);
+}
+
+static void GLAPIENTRY _glewLazy_glDisableVariantClientStateEXT (GLuint id)
+{
+  glDisableVariantClientStateEXT = (PFNGLDISABLEVARIANTCLIENTSTATEEXTPROC)glewGetProcAddress((const GLubyte*)"glDisableVariantClientStateEXT");
+  glDisableVariantClientStateEXT(id);
+}
+
+static void GLAPIENTRY _glewLazy_glEnableVariantClientStateEXT (GLuint id)
+{
+  glEnableVariantClientStateEXT = (PFNGLENABLEVARIANTCLIENTSTATEEXTPROC)glewGetProcAddress((const GLubyte*)"glEnableVariantClientStateEXT");
+  glEnableVariantClientStateEXT(id);
+}
+
+static void GLAPIENTRY _glewLazy_glEndVertexShaderEXT (void)
+{
+  glEndVertexShaderEXT = (PFNGLENDVERTEXSHADEREXTPROC)glewGetProcAddress((const GLubyte*)"glEndVertexShaderEXT");
+  glEndVertexShaderEXT();
+}
+
+static void GLAPIENTRY _glewLazy_glExtractComponentEXT (GLuint res, GLuint src, GLuint num)
+{
+  glExtractComponentEXT = (PFNGLEXTRACTCOMPONENTEXTPROC)glewGetProcAddress((const GLubyte*)"glExtractComponentEXT");
+  glExtractComponentEXT(res, src, num);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glGenSymbolsEXT (GLenum dataType, GLenum storageType, GLenum range, GLuint components)
+{
+  glGenSymbolsEXT = (PFNGLGENSYMBOLSEXTPROC)glewGetProcAddress((const GLubyte*)"glGenSymbolsEXT");
+  return glGenSymbolsEXT(dataType, storageType, range, components);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glGenVertexShadersEXT (GLuint range)
+{
+  glGenVertexShadersEXT = (PFNGLGENVERTEXSHADERSEXTPROC)glewGetProcAddress((const GLubyte*)"glGenVertexShadersEXT");
+  return glGenVertexShadersEXT(range);
+}
+
+static void GLAPIENTRY _glewLazy_glGetInvariantBooleanvEXT (GLuint id, GLenum value, GLboolean *data)
+{
+  glGetInvariantBooleanvEXT = (PFNGLGETINVARIANTBOOLEANVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetInvariantBooleanvEXT");
+  glGetInvariantBooleanvEXT(id, value, data);
+}
+
+static void GLAPIENTRY _glewLazy_glGetInvariantFloatvEXT (GLuint id, GLenum value, GLfloat *data)
+{
+  glGetInvariantFloatvEXT = (PFNGLGETINVARIANTFLOATVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetInvariantFloatvEXT");
+  glGetInvariantFloatvEXT(id, value, data);
+}
+
+static void GLAPIENTRY _glewLazy_glGetInvariantIntegervEXT (GLuint id, GLenum value, GLint *data)
+{
+  glGetInvariantIntegervEXT = (PFNGLGETINVARIANTINTEGERVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetInvariantIntegervEXT");
+  glGetInvariantIntegervEXT(id, value, data);
+}
+
+static void GLAPIENTRY _glewLazy_glGetLocalConstantBooleanvEXT (GLuint id, GLenum value, GLboolean *data)
+{
+  glGetLocalConstantBooleanvEXT = (PFNGLGETLOCALCONSTANTBOOLEANVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetLocalConstantBooleanvEXT");
+  glGetLocalConstantBooleanvEXT(id, value, data);
+}
+
+static void GLAPIENTRY _glewLazy_glGetLocalConstantFloatvEXT (GLuint id, GLenum value, GLfloat *data)
+{
+  glGetLocalConstantFloatvEXT = (PFNGLGETLOCALCONSTANTFLOATVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetLocalConstantFloatvEXT");
+  glGetLocalConstantFloatvEXT(id, value, data);
+}
+
+static void GLAPIENTRY _glewLazy_glGetLocalConstantIntegervEXT (GLuint id, GLenum value, GLint *data)
+{
+  glGetLocalConstantIntegervEXT = (PFNGLGETLOCALCONSTANTINTEGERVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetLocalConstantIntegervEXT");
+  glGetLocalConstantIntegervEXT(id, value, data);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVariantBooleanvEXT (GLuint id, GLenum value, GLboolean *data)
+{
+  glGetVariantBooleanvEXT = (PFNGLGETVARIANTBOOLEANVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetVariantBooleanvEXT");
+  glGetVariantBooleanvEXT(id, value, data);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVariantFloatvEXT (GLuint id, GLenum value, GLfloat *data)
+{
+  glGetVariantFloatvEXT = (PFNGLGETVARIANTFLOATVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetVariantFloatvEXT");
+  glGetVariantFloatvEXT(id, value, data);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVariantIntegervEXT (GLuint id, GLenum value, GLint *data)
+{
+  glGetVariantIntegervEXT = (PFNGLGETVARIANTINTEGERVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetVariantIntegervEXT");
+  glGetVariantIntegervEXT(id, value, data);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVariantPointervEXT (GLuint id, GLenum value, void **data)
+{
+  glGetVariantPointervEXT = (PFNGLGETVARIANTPOINTERVEXTPROC)glewGetProcAddress((const GLubyte*)"glGetVariantPointervEXT");
+  glGetVariantPointervEXT(id, value, data);
+}
+
+static void GLAPIENTRY _glewLazy_glInsertComponentEXT (GLuint res, GLuint src, GLuint num)
+{
+  glInsertComponentEXT = (PFNGLINSERTCOMPONENTEXTPROC)glewGetProcAddress((const GLubyte*)"glInsertComponentEXT");
+  glInsertComponentEXT(res, src, num);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsVariantEnabledEXT (GLuint id, GLenum cap)
+{
+  glIsVariantEnabledEXT = (PFNGLISVARIANTENABLEDEXTPROC)glewGetProcAddress((const GLubyte*)"glIsVariantEnabledEXT");
+  return glIsVariantEnabledEXT(id, cap);
+}
+
+static void GLAPIENTRY _glewLazy_glSetInvariantEXT (GLuint id, GLenum type, void *addr)
+{
+  glSetInvariantEXT = (PFNGLSETINVARIANTEXTPROC)glewGetProcAddress((const GLubyte*)"glSetInvariantEXT");
+  glSetInvariantEXT(id, type, addr);
+}
+
+static void GLAPIENTRY _glewLazy_glSetLocalConstantEXT (GLuint id, GLenum type, void *addr)
+{
+  glSetLocalConstantEXT = (PFNGLSETLOCALCONSTANTEXTPROC)glewGetProcAddress((const GLubyte*)"glSetLocalConstantEXT");
+  glSetLocalConstantEXT(id, type, addr);
+}
+
+static void GLAPIENTRY _glewLazy_glShaderOp1EXT (GLenum op, GLuint res, GLuint arg1)
+{
+  glShaderOp1EXT = (PFNGLSHADEROP1EXTPROC)glewGetProcAddress((const GLubyte*)"glShaderOp1EXT");
+  glShaderOp1EXT(op, res, arg1);
+}
+
+static void GLAPIENTRY _glewLazy_glShaderOp2EXT (GLenum op, GLuint res, GLuint arg1, GLuint arg2)
+{
+  glShaderOp2EXT = (PFNGLSHADEROP2EXTPROC)glewGetProcAddress((const GLubyte*)"glShaderOp2EXT");
+  glShaderOp2EXT(op, res, arg1, arg2);
+}
+
+static void GLAPIENTRY _glewLazy_glShaderOp3EXT (GLenum op, GLuint res, GLuint arg1, GLuint arg2, GLuint arg3)
+{
+  glShaderOp3EXT = (PFNGLSHADEROP3EXTPROC)glewGetProcAddress((const GLubyte*)"glShaderOp3EXT");
+  glShaderOp3EXT(op, res, arg1, arg2, arg3);
+}
+
+static void GLAPIENTRY _glewLazy_glSwizzleEXT (GLuint res, GLuint in, GLenum outX, GLenum outY, GLenum outZ, GLenum outW)
+{
+  glSwizzleEXT = (PFNGLSWIZZLEEXTPROC)glewGetProcAddress((const GLubyte*)"glSwizzleEXT");
+  glSwizzleEXT(res, in, outX, outY, outZ, outW);
+}
+
+static void GLAPIENTRY _glewLazy_glVariantPointerEXT (GLuint id, GLenum type, GLuint stride, void *addr)
+{
+  glVariantPointerEXT = (PFNGLVARIANTPOINTEREXTPROC)glewGetProcAddress((const GLubyte*)"glVariantPointerEXT");
+  glVariantPointerEXT(id, type, stride, addr);
+}
+
+static void GLAPIENTRY _glewLazy_glVariantbvEXT (GLuint id, GLbyte *addr)
+{
+  glVariantbvEXT = (PFNGLVARIANTBVEXTPROC)glewGetProcAddress((const GLubyte*)"glVariantbvEXT");
+  glVariantbvEXT(id, addr);
+}
+
+static void GLAPIENTRY _glewLazy_glVariantdvEXT (GLuint id, GLdouble *addr)
+{
+  glVariantdvEXT = (PFNGLVARIANTDVEXTPROC)glewGetProcAddress((const GLubyte*)"glVariantdvEXT");
+  glVariantdvEXT(id, addr);
+}
+
+static void GLAPIENTRY _glewLazy_glVariantfvEXT (GLuint id, GLfloat *addr)
+{
+  glVariantfvEXT = (PFNGLVARIANTFVEXTPROC)glewGetProcAddress((const GLubyte*)"glVariantfvEXT");
+  glVariantfvEXT(id, addr);
+}
+
+static void GLAPIENTRY _glewLazy_glVariantivEXT (GLuint id, GLint *addr)
+{
+  glVariantivEXT = (PFNGLVARIANTIVEXTPROC)glewGetProcAddress((const GLubyte*)"glVariantivEXT");
+  glVariantivEXT(id, addr);
+}
+
+static void GLAPIENTRY _glewLazy_glVariantsvEXT (GLuint id, GLshort *addr)
+{
+  glVariantsvEXT = (PFNGLVARIANTSVEXTPROC)glewGetProcAddress((const GLubyte*)"glVariantsvEXT");
+  glVariantsvEXT(id, addr);
+}
+
+static void GLAPIENTRY _glewLazy_glVariantubvEXT (GLuint id, GLubyte *addr)
+{
+  glVariantubvEXT = (PFNGLVARIANTUBVEXTPROC)glewGetProcAddress((const GLubyte*)"glVariantubvEXT");
+  glVariantubvEXT(id, addr);
+}
+
+static void GLAPIENTRY _glewLazy_glVariantuivEXT (GLuint id, GLuint *addr)
+{
+  glVariantuivEXT = (PFNGLVARIANTUIVEXTPROC)glewGetProcAddress((const GLubyte*)"glVariantuivEXT");
+  glVariantuivEXT(id, addr);
+}
+
+static void GLAPIENTRY _glewLazy_glVariantusvEXT (GLuint id, GLushort *addr)
+{
+  glVariantusvEXT = (PFNGLVARIANTUSVEXTPROC)glewGetProcAddress((const GLubyte*)"glVariantusvEXT");
+  glVariantusvEXT(id, addr);
+}
+
+static void GLAPIENTRY _glewLazy_glWriteMaskEXT (GLuint res, GLuint in, GLenum outX, GLenum outY, GLenum outZ, GLenum outW)
+{
+  glWriteMaskEXT = (PFNGLWRITEMASKEXTPROC)glewGetProcAddress((const GLubyte*)"glWriteMaskEXT");
+  glWriteMaskEXT(res, in, outX, outY, outZ, outW);
+}
+
+
+static void GLAPIENTRY _glewLazy_glVertexWeightPointerEXT (GLint size, GLenum type, GLsizei stride, void *pointer)
+{
+  glVertexWeightPointerEXT = (PFNGLVERTEXWEIGHTPOINTEREXTPROC)glewGetProcAddress((const GLubyte*)"glVertexWeightPointerEXT");
+  glVertexWeightPointerEXT(size, type, stride, pointer);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexWeightfEXT (GLfloat weight)
+{
+  glVertexWeightfEXT = (PFNGLVERTEXWEIGHTFEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexWeightfEXT");
+  glVertexWeightfEXT(weight);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexWeightfvEXT (GLfloat* weight)
+{
+  glVertexWeightfvEXT = (PFNGLVERTEXWEIGHTFVEXTPROC)glewGetProcAddress((const GLubyte*)"glVertexWeightfvEXT");
+  glVertexWeightfvEXT(weight);
+}
+
+
+static GLsync GLAPIENTRY _glewLazy_glImportSyncEXT (GLenum external_sync_type, GLintptr external_sync, GLbitfield flags)
+{
+  glImportSyncEXT = (PFNGLIMPORTSYNCEXTPROC)glewGetProcAddress((const GLubyte*)"glImportSyncEXT");
+  return glImportSyncEXT(external_sync_type, external_sync, flags);
+}
+
+
+static void GLAPIENTRY _glewLazy_glFrameTerminatorGREMEDY (void)
+{
+  glFrameTerminatorGREMEDY = (PFNGLFRAMETERMINATORGREMEDYPROC)glewGetProcAddress((const GLubyte*)"glFrameTerminatorGREMEDY");
+  glFrameTerminatorGREMEDY();
+}
+
+
+static void GLAPIENTRY _glewLazy_glStringMarkerGREMEDY (GLsizei len, const void *string)
+{
+  glStringMarkerGREMEDY = (PFNGLSTRINGMARKERGREMEDYPROC)glewGetProcAddress((const GLubyte*)"glStringMarkerGREMEDY");
+  glStringMarkerGREMEDY(len, string);
+}
+
+
+static void GLAPIENTRY _glewLazy_glGetImageTransformParameterfvHP (GLenum target, GLenum pname, const GLfloat* params)
+{
+  glGetImageTransformParameterfvHP = (PFNGLGETIMAGETRANSFORMPARAMETERFVHPPROC)glewGetProcAddress((const GLubyte*)"glGetImageTransformParameterfvHP");
+  glGetImageTransformParameterfvHP(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetImageTransformParameterivHP (GLenum target, GLenum pname, const GLint* params)
+{
+  glGetImageTransformParameterivHP = (PFNGLGETIMAGETRANSFORMPARAMETERIVHPPROC)glewGetProcAddress((const GLubyte*)"glGetImageTransformParameterivHP");
+  glGetImageTransformParameterivHP(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glImageTransformParameterfHP (GLenum target, GLenum pname, const GLfloat param)
+{
+  glImageTransformParameterfHP = (PFNGLIMAGETRANSFORMPARAMETERFHPPROC)glewGetProcAddress((const GLubyte*)"glImageTransformParameterfHP");
+  glImageTransformParameterfHP(target, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glImageTransformParameterfvHP (GLenum target, GLenum pname, const GLfloat* params)
+{
+  glImageTransformParameterfvHP = (PFNGLIMAGETRANSFORMPARAMETERFVHPPROC)glewGetProcAddress((const GLubyte*)"glImageTransformParameterfvHP");
+  glImageTransformParameterfvHP(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glImageTransformParameteriHP (GLenum target, GLenum pname, const GLint param)
+{
+  glImageTransformParameteriHP = (PFNGLIMAGETRANSFORMPARAMETERIHPPROC)glewGetProcAddress((const GLubyte*)"glImageTransformParameteriHP");
+  glImageTransformParameteriHP(target, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glImageTransformParameterivHP (GLenum target, GLenum pname, const GLint* params)
+{
+  glImageTransformParameterivHP = (PFNGLIMAGETRANSFORMPARAMETERIVHPPROC)glewGetProcAddress((const GLubyte*)"glImageTransformParameterivHP");
+  glImageTransformParameterivHP(target, pname, params);
+}
+
+
+static void GLAPIENTRY _glewLazy_glMultiModeDrawArraysIBM (const GLenum* mode, const GLint *first, const GLsizei *count, GLsizei primcount, GLint modestride)
+{
+  glMultiModeDrawArraysIBM = (PFNGLMULTIMODEDRAWARRAYSIBMPROC)glewGetProcAddress((const GLubyte*)"glMultiModeDrawArraysIBM");
+  glMultiModeDrawArraysIBM(mode, first, count, primcount, modestride);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiModeDrawElementsIBM (const GLenum* mode, const GLsizei *count, GLenum type, const void *const *indices, GLsizei primcount, GLint modestride)
+{
+  glMultiModeDrawElementsIBM = (PFNGLMULTIMODEDRAWELEMENTSIBMPROC)glewGetProcAddress((const GLubyte*)"glMultiModeDrawElementsIBM");
+  glMultiModeDrawElementsIBM(mode, count, type, indices, primcount, modestride);
+}
+
+
+static void GLAPIENTRY _glewLazy_glColorPointerListIBM (GLint size, GLenum type, GLint stride, const void** pointer, GLint ptrstride)
+{
+  glColorPointerListIBM = (PFNGLCOLORPOINTERLISTIBMPROC)glewGetProcAddress((const GLubyte*)"glColorPointerListIBM");
+  glColorPointerListIBM(size, type, stride, pointer, ptrstride);
+}
+
+static void GLAPIENTRY _glewLazy_glEdgeFlagPointerListIBM (GLint stride, const GLboolean ** pointer, GLint ptrstride)
+{
+  glEdgeFlagPointerListIBM = (PFNGLEDGEFLAGPOINTERLISTIBMPROC)glewGetProcAddress((const GLubyte*)"glEdgeFlagPointerListIBM");
+  glEdgeFlagPointerListIBM(stride, pointer, ptrstride);
+}
+
+static void GLAPIENTRY _glewLazy_glFogCoordPointerListIBM (GLenum type, GLint stride, const void** pointer, GLint ptrstride)
+{
+  glFogCoordPointerListIBM = (PFNGLFOGCOORDPOINTERLISTIBMPROC)glewGetProcAddress((const GLubyte*)"glFogCoordPointerListIBM");
+  glFogCoordPointerListIBM(type, stride, pointer, ptrstride);
+}
+
+static void GLAPIENTRY _glewLazy_glIndexPointerListIBM (GLenum type, GLint stride, const void** pointer, GLint ptrstride)
+{
+  glIndexPointerListIBM = (PFNGLINDEXPOINTERLISTIBMPROC)glewGetProcAddress((const GLubyte*)"glIndexPointerListIBM");
+  glIndexPointerListIBM(type, stride, pointer, ptrstride);
+}
+
+static void GLAPIENTRY _glewLazy_glNormalPointerListIBM (GLenum type, GLint stride, const void** pointer, GLint ptrstride)
+{
+  glNormalPointerListIBM = (PFNGLNORMALPOINTERLISTIBMPROC)glewGetProcAddress((const GLubyte*)"glNormalPointerListIBM");
+  glNormalPointerListIBM(type, stride, pointer, ptrstride);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColorPointerListIBM (GLint size, GLenum type, GLint stride, const void** pointer, GLint ptrstride)
+{
+  glSecondaryColorPointerListIBM = (PFNGLSECONDARYCOLORPOINTERLISTIBMPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColorPointerListIBM");
+  glSecondaryColorPointerListIBM(size, type, stride, pointer, ptrstride);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoordPointerListIBM (GLint size, GLenum type, GLint stride, const void** pointer, GLint ptrstride)
+{
+  glTexCoordPointerListIBM = (PFNGLTEXCOORDPOINTERLISTIBMPROC)glewGetProcAddress((const GLubyte*)"glTexCoordPointerListIBM");
+  glTexCoordPointerListIBM(size, type, stride, pointer, ptrstride);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexPointerListIBM (GLint size, GLenum type, GLint stride, const void** pointer, GLint ptrstride)
+{
+  glVertexPointerListIBM = (PFNGLVERTEXPOINTERLISTIBMPROC)glewGetProcAddress((const GLubyte*)"glVertexPointerListIBM");
+  glVertexPointerListIBM(size, type, stride, pointer, ptrstride);
+}
+
+
+static void * GLAPIENTRY _glewLazy_glMapTexture2DINTEL (GLuint texture, GLint level, GLbitfield access, GLint* stride, GLenum *layout)
+{
+  glMapTexture2DINTEL = (PFNGLMAPTEXTURE2DINTELPROC)glewGetProcAddress((const GLubyte*)"glMapTexture2DINTEL");
+  return glMapTexture2DINTEL(texture, level, access, stride, layout);
+}
+
+static void GLAPIENTRY _glewLazy_glSyncTextureINTEL (GLuint texture)
+{
+  glSyncTextureINTEL = (PFNGLSYNCTEXTUREINTELPROC)glewGetProcAddress((const GLubyte*)"glSyncTextureINTEL");
+  glSyncTextureINTEL(texture);
+}
+
+static void GLAPIENTRY _glewLazy_glUnmapTexture2DINTEL (GLuint texture, GLint level)
+{
+  glUnmapTexture2DINTEL = (PFNGLUNMAPTEXTURE2DINTELPROC)glewGetProcAddress((const GLubyte*)"glUnmapTexture2DINTEL");
+  glUnmapTexture2DINTEL(texture, level);
+}
+
+
+static void GLAPIENTRY _glewLazy_glColorPointervINTEL (GLint size, GLenum type, const void** pointer)
+{
+  glColorPointervINTEL = (PFNGLCOLORPOINTERVINTELPROC)glewGetProcAddress((const GLubyte*)"glColorPointervINTEL");
+  glColorPointervINTEL(size, type, pointer);
+}
+
+static void GLAPIENTRY _glewLazy_glNormalPointervINTEL (GLenum type, const void** pointer)
+{
+  glNormalPointervINTEL = (PFNGLNORMALPOINTERVINTELPROC)glewGetProcAddress((const GLubyte*)"glNormalPointervINTEL");
+  glNormalPointervINTEL(type, pointer);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoordPointervINTEL (GLint size, GLenum type, const void** pointer)
+{
+  glTexCoordPointervINTEL = (PFNGLTEXCOORDPOINTERVINTELPROC)glewGetProcAddress((const GLubyte*)"glTexCoordPointervINTEL");
+  glTexCoordPointervINTEL(size, type, pointer);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexPointervINTEL (GLint size, GLenum type, const void** pointer)
+{
+  glVertexPointervINTEL = (PFNGLVERTEXPOINTERVINTELPROC)glewGetProcAddress((const GLubyte*)"glVertexPointervINTEL");
+  glVertexPointervINTEL(size, type, pointer);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBeginPerfQueryINTEL (GLuint queryHandle)
+{
+  glBeginPerfQueryINTEL = (PFNGLBEGINPERFQUERYINTELPROC)glewGetProcAddress((const GLubyte*)"glBeginPerfQueryINTEL");
+  glBeginPerfQueryINTEL(queryHandle);
+}
+
+static void GLAPIENTRY _glewLazy_glCreatePerfQueryINTEL (GLuint queryId, GLuint* queryHandle)
+{
+  glCreatePerfQueryINTEL = (PFNGLCREATEPERFQUERYINTELPROC)glewGetProcAddress((const GLubyte*)"glCreatePerfQueryINTEL");
+  glCreatePerfQueryINTEL(queryId, queryHandle);
+}
+
+static void GLAPIENTRY _glewLazy_glDeletePerfQueryINTEL (GLuint queryHandle)
+{
+  glDeletePerfQueryINTEL = (PFNGLDELETEPERFQUERYINTELPROC)glewGetProcAddress((const GLubyte*)"glDeletePerfQueryINTEL");
+  glDeletePerfQueryINTEL(queryHandle);
+}
+
+static void GLAPIENTRY _glewLazy_glEndPerfQueryINTEL (GLuint queryHandle)
+{
+  glEndPerfQueryINTEL = (PFNGLENDPERFQUERYINTELPROC)glewGetProcAddress((const GLubyte*)"glEndPerfQueryINTEL");
+  glEndPerfQueryINTEL(queryHandle);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFirstPerfQueryIdINTEL (GLuint* queryId)
+{
+  glGetFirstPerfQueryIdINTEL = (PFNGLGETFIRSTPERFQUERYIDINTELPROC)glewGetProcAddress((const GLubyte*)"glGetFirstPerfQueryIdINTEL");
+  glGetFirstPerfQueryIdINTEL(queryId);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNextPerfQueryIdINTEL (GLuint queryId, GLuint* nextQueryId)
+{
+  glGetNextPerfQueryIdINTEL = (PFNGLGETNEXTPERFQUERYIDINTELPROC)glewGetProcAddress((const GLubyte*)"glGetNextPerfQueryIdINTEL");
+  glGetNextPerfQueryIdINTEL(queryId, nextQueryId);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPerfCounterInfoINTEL (GLuint queryId, GLuint counterId, GLuint counterNameLength, GLchar* counterName, GLuint counterDescLength, GLchar *counterDesc, GLuint *counterOffset, GLuint *counterDataSize, GLuint *counterTypeEnum, GLuint *counterDataTypeEnum, GLuint64 *rawCounterMaxValue)
+{
+  glGetPerfCounterInfoINTEL = (PFNGLGETPERFCOUNTERINFOINTELPROC)glewGetProcAddress((const GLubyte*)"glGetPerfCounterInfoINTEL");
+  glGetPerfCounterInfoINTEL(queryId, counterId, counterNameLength, counterName, counterDescLength, counterDesc, counterOffset, counterDataSize, counterTypeEnum, counterDataTypeEnum, rawCounterMaxValue);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPerfQueryDataINTEL (GLuint queryHandle, GLuint flags, GLsizei dataSize, void *data, GLuint *bytesWritten)
+{
+  glGetPerfQueryDataINTEL = (PFNGLGETPERFQUERYDATAINTELPROC)glewGetProcAddress((const GLubyte*)"glGetPerfQueryDataINTEL");
+  glGetPerfQueryDataINTEL(queryHandle, flags, dataSize, data, bytesWritten);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPerfQueryIdByNameINTEL (GLchar* queryName, GLuint *queryId)
+{
+  glGetPerfQueryIdByNameINTEL = (PFNGLGETPERFQUERYIDBYNAMEINTELPROC)glewGetProcAddress((const GLubyte*)"glGetPerfQueryIdByNameINTEL");
+  glGetPerfQueryIdByNameINTEL(queryName, queryId);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPerfQueryInfoINTEL (GLuint queryId, GLuint queryNameLength, GLchar* queryName, GLuint *dataSize, GLuint *noCounters, GLuint *noInstances, GLuint *capsMask)
+{
+  glGetPerfQueryInfoINTEL = (PFNGLGETPERFQUERYINFOINTELPROC)glewGetProcAddress((const GLubyte*)"glGetPerfQueryInfoINTEL");
+  glGetPerfQueryInfoINTEL(queryId, queryNameLength, queryName, dataSize, noCounters, noInstances, capsMask);
+}
+
+
+static void GLAPIENTRY _glewLazy_glTexScissorFuncINTEL (GLenum target, GLenum lfunc, GLenum hfunc)
+{
+  glTexScissorFuncINTEL = (PFNGLTEXSCISSORFUNCINTELPROC)glewGetProcAddress((const GLubyte*)"glTexScissorFuncINTEL");
+  glTexScissorFuncINTEL(target, lfunc, hfunc);
+}
+
+static void GLAPIENTRY _glewLazy_glTexScissorINTEL (GLenum target, GLclampf tlow, GLclampf thigh)
+{
+  glTexScissorINTEL = (PFNGLTEXSCISSORINTELPROC)glewGetProcAddress((const GLubyte*)"glTexScissorINTEL");
+  glTexScissorINTEL(target, tlow, thigh);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBlendBarrierKHR (void)
+{
+  glBlendBarrierKHR = (PFNGLBLENDBARRIERKHRPROC)glewGetProcAddress((const GLubyte*)"glBlendBarrierKHR");
+  glBlendBarrierKHR();
+}
+
+
+static void GLAPIENTRY _glewLazy_glDebugMessageCallback (GLDEBUGPROC callback, const void *userParam)
+{
+  glDebugMessageCallback = (PFNGLDEBUGMESSAGECALLBACKPROC)glewGetProcAddress((const GLubyte*)"glDebugMessageCallback");
+  glDebugMessageCallback(callback, userParam);
+}
+
+static void GLAPIENTRY _glewLazy_glDebugMessageControl (GLenum source, GLenum type, GLenum severity, GLsizei count, const GLuint* ids, GLboolean enabled)
+{
+  glDebugMessageControl = (PFNGLDEBUGMESSAGECONTROLPROC)glewGetProcAddress((const GLubyte*)"glDebugMessageControl");
+  glDebugMessageControl(source, type, severity, count, ids, enabled);
+}
+
+static void GLAPIENTRY _glewLazy_glDebugMessageInsert (GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* buf)
+{
+  glDebugMessageInsert = (PFNGLDEBUGMESSAGEINSERTPROC)glewGetProcAddress((const GLubyte*)"glDebugMessageInsert");
+  glDebugMessageInsert(source, type, id, severity, length, buf);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glGetDebugMessageLog (GLuint count, GLsizei bufSize, GLenum* sources, GLenum* types, GLuint* ids, GLenum* severities, GLsizei* lengths, GLchar* messageLog)
+{
+  glGetDebugMessageLog = (PFNGLGETDEBUGMESSAGELOGPROC)glewGetProcAddress((const GLubyte*)"glGetDebugMessageLog");
+  return glGetDebugMessageLog(count, bufSize, sources, types, ids, severities, lengths, messageLog);
+}
+
+static void GLAPIENTRY _glewLazy_glGetObjectLabel (GLenum identifier, GLuint name, GLsizei bufSize, GLsizei* length, GLchar *label)
+{
+  glGetObjectLabel = (PFNGLGETOBJECTLABELPROC)glewGetProcAddress((const GLubyte*)"glGetObjectLabel");
+  glGetObjectLabel(identifier, name, bufSize, length, label);
+}
+
+static void GLAPIENTRY _glewLazy_glGetObjectPtrLabel (const void *ptr, GLsizei bufSize, GLsizei* length, GLchar *label)
+{
+  glGetObjectPtrLabel = (PFNGLGETOBJECTPTRLABELPROC)glewGetProcAddress((const GLubyte*)"glGetObjectPtrLabel");
+  glGetObjectPtrLabel(ptr, bufSize, length, label);
+}
+
+static void GLAPIENTRY _glewLazy_glObjectLabel (GLenum identifier, GLuint name, GLsizei length, const GLchar* label)
+{
+  glObjectLabel = (PFNGLOBJECTLABELPROC)glewGetProcAddress((const GLubyte*)"glObjectLabel");
+  glObjectLabel(identifier, name, length, label);
+}
+
+static void GLAPIENTRY _glewLazy_glObjectPtrLabel (const void *ptr, GLsizei length, const GLchar* label)
+{
+  glObjectPtrLabel = (PFNGLOBJECTPTRLABELPROC)glewGetProcAddress((const GLubyte*)"glObjectPtrLabel");
+  glObjectPtrLabel(ptr, length, label);
+}
+
+static void GLAPIENTRY _glewLazy_glPopDebugGroup (void)
+{
+  glPopDebugGroup = (PFNGLPOPDEBUGGROUPPROC)glewGetProcAddress((const GLubyte*)"glPopDebugGroup");
+  glPopDebugGroup();
+}
+
+static void GLAPIENTRY _glewLazy_glPushDebugGroup (GLenum source, GLuint id, GLsizei length, const GLchar * message)
+{
+  glPushDebugGroup = (PFNGLPUSHDEBUGGROUPPROC)glewGetProcAddress((const GLubyte*)"glPushDebugGroup");
+  glPushDebugGroup(source, id, length, message);
+}
+
+
+static void GLAPIENTRY _glewLazy_glGetnUniformfv (GLuint program, GLint location, GLsizei bufSize, GLfloat* params)
+{
+  glGetnUniformfv = (PFNGLGETNUNIFORMFVPROC)glewGetProcAddress((const GLubyte*)"glGetnUniformfv");
+  glGetnUniformfv(program, location, bufSize, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnUniformiv (GLuint program, GLint location, GLsizei bufSize, GLint* params)
+{
+  glGetnUniformiv = (PFNGLGETNUNIFORMIVPROC)glewGetProcAddress((const GLubyte*)"glGetnUniformiv");
+  glGetnUniformiv(program, location, bufSize, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetnUniformuiv (GLuint program, GLint location, GLsizei bufSize, GLuint* params)
+{
+  glGetnUniformuiv = (PFNGLGETNUNIFORMUIVPROC)glewGetProcAddress((const GLubyte*)"glGetnUniformuiv");
+  glGetnUniformuiv(program, location, bufSize, params);
+}
+
+static void GLAPIENTRY _glewLazy_glReadnPixels (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, GLsizei bufSize, void *data)
+{
+  glReadnPixels = (PFNGLREADNPIXELSPROC)glewGetProcAddress((const GLubyte*)"glReadnPixels");
+  glReadnPixels(x, y, width, height, format, type, bufSize, data);
+}
+
+
+static GLuint GLAPIENTRY _glewLazy_glBufferRegionEnabled (void)
+{
+  glBufferRegionEnabled = (PFNGLBUFFERREGIONENABLEDPROC)glewGetProcAddress((const GLubyte*)"glBufferRegionEnabled");
+  return glBufferRegionEnabled();
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteBufferRegion (GLenum region)
+{
+  glDeleteBufferRegion = (PFNGLDELETEBUFFERREGIONPROC)glewGetProcAddress((const GLubyte*)"glDeleteBufferRegion");
+  glDeleteBufferRegion(region);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawBufferRegion (GLuint region, GLint x, GLint y, GLsizei width, GLsizei height, GLint xDest, GLint yDest)
+{
+  glDrawBufferRegion = (PFNGLDRAWBUFFERREGIONPROC)glewGetProcAddress((const GLubyte*)"glDrawBufferRegion");
+  glDrawBufferRegion(region, x, y, width, height, xDest, yDest);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glNewBufferRegion (GLenum region)
+{
+  glNewBufferRegion = (PFNGLNEWBUFFERREGIONPROC)glewGetProcAddress((const GLubyte*)"glNewBufferRegion");
+  return glNewBufferRegion(region);
+}
+
+static void GLAPIENTRY _glewLazy_glReadBufferRegion (GLuint region, GLint x, GLint y, GLsizei width, GLsizei height)
+{
+  glReadBufferRegion = (PFNGLREADBUFFERREGIONPROC)glewGetProcAddress((const GLubyte*)"glReadBufferRegion");
+  glReadBufferRegion(region, x, y, width, height);
+}
+
+
+static void GLAPIENTRY _glewLazy_glResizeBuffersMESA (void)
+{
+  glResizeBuffersMESA = (PFNGLRESIZEBUFFERSMESAPROC)glewGetProcAddress((const GLubyte*)"glResizeBuffersMESA");
+  glResizeBuffersMESA();
+}
+
+
+static void GLAPIENTRY _glewLazy_glWindowPos2dMESA (GLdouble x, GLdouble y)
+{
+  glWindowPos2dMESA = (PFNGLWINDOWPOS2DMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2dMESA");
+  glWindowPos2dMESA(x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2dvMESA (const GLdouble* p)
+{
+  glWindowPos2dvMESA = (PFNGLWINDOWPOS2DVMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2dvMESA");
+  glWindowPos2dvMESA(p);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2fMESA (GLfloat x, GLfloat y)
+{
+  glWindowPos2fMESA = (PFNGLWINDOWPOS2FMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2fMESA");
+  glWindowPos2fMESA(x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2fvMESA (const GLfloat* p)
+{
+  glWindowPos2fvMESA = (PFNGLWINDOWPOS2FVMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2fvMESA");
+  glWindowPos2fvMESA(p);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2iMESA (GLint x, GLint y)
+{
+  glWindowPos2iMESA = (PFNGLWINDOWPOS2IMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2iMESA");
+  glWindowPos2iMESA(x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2ivMESA (const GLint* p)
+{
+  glWindowPos2ivMESA = (PFNGLWINDOWPOS2IVMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2ivMESA");
+  glWindowPos2ivMESA(p);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2sMESA (GLshort x, GLshort y)
+{
+  glWindowPos2sMESA = (PFNGLWINDOWPOS2SMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2sMESA");
+  glWindowPos2sMESA(x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos2svMESA (const GLshort* p)
+{
+  glWindowPos2svMESA = (PFNGLWINDOWPOS2SVMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos2svMESA");
+  glWindowPos2svMESA(p);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3dMESA (GLdouble x, GLdouble y, GLdouble z)
+{
+  glWindowPos3dMESA = (PFNGLWINDOWPOS3DMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3dMESA");
+  glWindowPos3dMESA(x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3dvMESA (const GLdouble* p)
+{
+  glWindowPos3dvMESA = (PFNGLWINDOWPOS3DVMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3dvMESA");
+  glWindowPos3dvMESA(p);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3fMESA (GLfloat x, GLfloat y, GLfloat z)
+{
+  glWindowPos3fMESA = (PFNGLWINDOWPOS3FMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3fMESA");
+  glWindowPos3fMESA(x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3fvMESA (const GLfloat* p)
+{
+  glWindowPos3fvMESA = (PFNGLWINDOWPOS3FVMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3fvMESA");
+  glWindowPos3fvMESA(p);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3iMESA (GLint x, GLint y, GLint z)
+{
+  glWindowPos3iMESA = (PFNGLWINDOWPOS3IMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3iMESA");
+  glWindowPos3iMESA(x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3ivMESA (const GLint* p)
+{
+  glWindowPos3ivMESA = (PFNGLWINDOWPOS3IVMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3ivMESA");
+  glWindowPos3ivMESA(p);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3sMESA (GLshort x, GLshort y, GLshort z)
+{
+  glWindowPos3sMESA = (PFNGLWINDOWPOS3SMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3sMESA");
+  glWindowPos3sMESA(x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos3svMESA (const GLshort* p)
+{
+  glWindowPos3svMESA = (PFNGLWINDOWPOS3SVMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos3svMESA");
+  glWindowPos3svMESA(p);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos4dMESA (GLdouble x, GLdouble y, GLdouble z, GLdouble a3)
+{
+  glWindowPos4dMESA = (PFNGLWINDOWPOS4DMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos4dMESA");
+  glWindowPos4dMESA(x, y, z, a3);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos4dvMESA (const GLdouble* p)
+{
+  glWindowPos4dvMESA = (PFNGLWINDOWPOS4DVMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos4dvMESA");
+  glWindowPos4dvMESA(p);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos4fMESA (GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+  glWindowPos4fMESA = (PFNGLWINDOWPOS4FMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos4fMESA");
+  glWindowPos4fMESA(x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos4fvMESA (const GLfloat* p)
+{
+  glWindowPos4fvMESA = (PFNGLWINDOWPOS4FVMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos4fvMESA");
+  glWindowPos4fvMESA(p);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos4iMESA (GLint x, GLint y, GLint z, GLint w)
+{
+  glWindowPos4iMESA = (PFNGLWINDOWPOS4IMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos4iMESA");
+  glWindowPos4iMESA(x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos4ivMESA (const GLint* p)
+{
+  glWindowPos4ivMESA = (PFNGLWINDOWPOS4IVMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos4ivMESA");
+  glWindowPos4ivMESA(p);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos4sMESA (GLshort x, GLshort y, GLshort z, GLshort w)
+{
+  glWindowPos4sMESA = (PFNGLWINDOWPOS4SMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos4sMESA");
+  glWindowPos4sMESA(x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glWindowPos4svMESA (const GLshort* p)
+{
+  glWindowPos4svMESA = (PFNGLWINDOWPOS4SVMESAPROC)glewGetProcAddress((const GLubyte*)"glWindowPos4svMESA");
+  glWindowPos4svMESA(p);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBeginConditionalRenderNVX (GLuint id)
+{
+  glBeginConditionalRenderNVX = (PFNGLBEGINCONDITIONALRENDERNVXPROC)glewGetProcAddress((const GLubyte*)"glBeginConditionalRenderNVX");
+  glBeginConditionalRenderNVX(id);
+}
+
+static void GLAPIENTRY _glewLazy_glEndConditionalRenderNVX (void)
+{
+  glEndConditionalRenderNVX = (PFNGLENDCONDITIONALRENDERNVXPROC)glewGetProcAddress((const GLubyte*)"glEndConditionalRenderNVX");
+  glEndConditionalRenderNVX();
+}
+
+
+static void GLAPIENTRY _glewLazy_glMultiDrawArraysIndirectBindlessNV (GLenum mode, const void *indirect, GLsizei drawCount, GLsizei stride, GLint vertexBufferCount)
+{
+  glMultiDrawArraysIndirectBindlessNV = (PFNGLMULTIDRAWARRAYSINDIRECTBINDLESSNVPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawArraysIndirectBindlessNV");
+  glMultiDrawArraysIndirectBindlessNV(mode, indirect, drawCount, stride, vertexBufferCount);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiDrawElementsIndirectBindlessNV (GLenum mode, GLenum type, const void *indirect, GLsizei drawCount, GLsizei stride, GLint vertexBufferCount)
+{
+  glMultiDrawElementsIndirectBindlessNV = (PFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSNVPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawElementsIndirectBindlessNV");
+  glMultiDrawElementsIndirectBindlessNV(mode, type, indirect, drawCount, stride, vertexBufferCount);
+}
+
+
+static void GLAPIENTRY _glewLazy_glMultiDrawArraysIndirectBindlessCountNV (GLenum mode, const void *indirect, GLintptr drawCount, GLsizei maxDrawCount, GLsizei stride, GLint vertexBufferCount)
+{
+  glMultiDrawArraysIndirectBindlessCountNV = (PFNGLMULTIDRAWARRAYSINDIRECTBINDLESSCOUNTNVPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawArraysIndirectBindlessCountNV");
+  glMultiDrawArraysIndirectBindlessCountNV(mode, indirect, drawCount, maxDrawCount, stride, vertexBufferCount);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiDrawElementsIndirectBindlessCountNV (GLenum mode, GLenum type, const void *indirect, GLintptr drawCount, GLsizei maxDrawCount, GLsizei stride, GLint vertexBufferCount)
+{
+  glMultiDrawElementsIndirectBindlessCountNV = (PFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSCOUNTNVPROC)glewGetProcAddress((const GLubyte*)"glMultiDrawElementsIndirectBindlessCountNV");
+  glMultiDrawElementsIndirectBindlessCountNV(mode, type, indirect, drawCount, maxDrawCount, stride, vertexBufferCount);
+}
+
+
+static GLuint64 GLAPIENTRY _glewLazy_glGetImageHandleNV (GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum format)
+{
+  glGetImageHandleNV = (PFNGLGETIMAGEHANDLENVPROC)glewGetProcAddress((const GLubyte*)"glGetImageHandleNV");
+  return glGetImageHandleNV(texture, level, layered, layer, format);
+}
+
+static GLuint64 GLAPIENTRY _glewLazy_glGetTextureHandleNV (GLuint texture)
+{
+  glGetTextureHandleNV = (PFNGLGETTEXTUREHANDLENVPROC)glewGetProcAddress((const GLubyte*)"glGetTextureHandleNV");
+  return glGetTextureHandleNV(texture);
+}
+
+static GLuint64 GLAPIENTRY _glewLazy_glGetTextureSamplerHandleNV (GLuint texture, GLuint sampler)
+{
+  glGetTextureSamplerHandleNV = (PFNGLGETTEXTURESAMPLERHANDLENVPROC)glewGetProcAddress((const GLubyte*)"glGetTextureSamplerHandleNV");
+  return glGetTextureSamplerHandleNV(texture, sampler);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsImageHandleResidentNV (GLuint64 handle)
+{
+  glIsImageHandleResidentNV = (PFNGLISIMAGEHANDLERESIDENTNVPROC)glewGetProcAddress((const GLubyte*)"glIsImageHandleResidentNV");
+  return glIsImageHandleResidentNV(handle);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsTextureHandleResidentNV (GLuint64 handle)
+{
+  glIsTextureHandleResidentNV = (PFNGLISTEXTUREHANDLERESIDENTNVPROC)glewGetProcAddress((const GLubyte*)"glIsTextureHandleResidentNV");
+  return glIsTextureHandleResidentNV(handle);
+}
+
+static void GLAPIENTRY _glewLazy_glMakeImageHandleNonResidentNV (GLuint64 handle)
+{
+  glMakeImageHandleNonResidentNV = (PFNGLMAKEIMAGEHANDLENONRESIDENTNVPROC)glewGetProcAddress((const GLubyte*)"glMakeImageHandleNonResidentNV");
+  glMakeImageHandleNonResidentNV(handle);
+}
+
+static void GLAPIENTRY _glewLazy_glMakeImageHandleResidentNV (GLuint64 handle, GLenum access)
+{
+  glMakeImageHandleResidentNV = (PFNGLMAKEIMAGEHANDLERESIDENTNVPROC)glewGetProcAddress((const GLubyte*)"glMakeImageHandleResidentNV");
+  glMakeImageHandleResidentNV(handle, access);
+}
+
+static void GLAPIENTRY _glewLazy_glMakeTextureHandleNonResidentNV (GLuint64 handle)
+{
+  glMakeTextureHandleNonResidentNV = (PFNGLMAKETEXTUREHANDLENONRESIDENTNVPROC)glewGetProcAddress((const GLubyte*)"glMakeTextureHandleNonResidentNV");
+  glMakeTextureHandleNonResidentNV(handle);
+}
+
+static void GLAPIENTRY _glewLazy_glMakeTextureHandleResidentNV (GLuint64 handle)
+{
+  glMakeTextureHandleResidentNV = (PFNGLMAKETEXTUREHANDLERESIDENTNVPROC)glewGetProcAddress((const GLubyte*)"glMakeTextureHandleResidentNV");
+  glMakeTextureHandleResidentNV(handle);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformHandleui64NV (GLuint program, GLint location, GLuint64 value)
+{
+  glProgramUniformHandleui64NV = (PFNGLPROGRAMUNIFORMHANDLEUI64NVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformHandleui64NV");
+  glProgramUniformHandleui64NV(program, location, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformHandleui64vNV (GLuint program, GLint location, GLsizei count, const GLuint64* values)
+{
+  glProgramUniformHandleui64vNV = (PFNGLPROGRAMUNIFORMHANDLEUI64VNVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformHandleui64vNV");
+  glProgramUniformHandleui64vNV(program, location, count, values);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformHandleui64NV (GLint location, GLuint64 value)
+{
+  glUniformHandleui64NV = (PFNGLUNIFORMHANDLEUI64NVPROC)glewGetProcAddress((const GLubyte*)"glUniformHandleui64NV");
+  glUniformHandleui64NV(location, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformHandleui64vNV (GLint location, GLsizei count, const GLuint64* value)
+{
+  glUniformHandleui64vNV = (PFNGLUNIFORMHANDLEUI64VNVPROC)glewGetProcAddress((const GLubyte*)"glUniformHandleui64vNV");
+  glUniformHandleui64vNV(location, count, value);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBlendBarrierNV (void)
+{
+  glBlendBarrierNV = (PFNGLBLENDBARRIERNVPROC)glewGetProcAddress((const GLubyte*)"glBlendBarrierNV");
+  glBlendBarrierNV();
+}
+
+static void GLAPIENTRY _glewLazy_glBlendParameteriNV (GLenum pname, GLint value)
+{
+  glBlendParameteriNV = (PFNGLBLENDPARAMETERINVPROC)glewGetProcAddress((const GLubyte*)"glBlendParameteriNV");
+  glBlendParameteriNV(pname, value);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBeginConditionalRenderNV (GLuint id, GLenum mode)
+{
+  glBeginConditionalRenderNV = (PFNGLBEGINCONDITIONALRENDERNVPROC)glewGetProcAddress((const GLubyte*)"glBeginConditionalRenderNV");
+  glBeginConditionalRenderNV(id, mode);
+}
+
+static void GLAPIENTRY _glewLazy_glEndConditionalRenderNV (void)
+{
+  glEndConditionalRenderNV = (PFNGLENDCONDITIONALRENDERNVPROC)glewGetProcAddress((const GLubyte*)"glEndConditionalRenderNV");
+  glEndConditionalRenderNV();
+}
+
+
+static void GLAPIENTRY _glewLazy_glSubpixelPrecisionBiasNV (GLuint xbits, GLuint ybits)
+{
+  glSubpixelPrecisionBiasNV = (PFNGLSUBPIXELPRECISIONBIASNVPROC)glewGetProcAddress((const GLubyte*)"glSubpixelPrecisionBiasNV");
+  glSubpixelPrecisionBiasNV(xbits, ybits);
+}
+
+
+static void GLAPIENTRY _glewLazy_glCopyImageSubDataNV (GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei width, GLsizei height, GLsizei depth)
+{
+  glCopyImageSubDataNV = (PFNGLCOPYIMAGESUBDATANVPROC)glewGetProcAddress((const GLubyte*)"glCopyImageSubDataNV");
+  glCopyImageSubDataNV(srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, width, height, depth);
+}
+
+
+static void GLAPIENTRY _glewLazy_glClearDepthdNV (GLdouble depth)
+{
+  glClearDepthdNV = (PFNGLCLEARDEPTHDNVPROC)glewGetProcAddress((const GLubyte*)"glClearDepthdNV");
+  glClearDepthdNV(depth);
+}
+
+static void GLAPIENTRY _glewLazy_glDepthBoundsdNV (GLdouble zmin, GLdouble zmax)
+{
+  glDepthBoundsdNV = (PFNGLDEPTHBOUNDSDNVPROC)glewGetProcAddress((const GLubyte*)"glDepthBoundsdNV");
+  glDepthBoundsdNV(zmin, zmax);
+}
+
+static void GLAPIENTRY _glewLazy_glDepthRangedNV (GLdouble zNear, GLdouble zFar)
+{
+  glDepthRangedNV = (PFNGLDEPTHRANGEDNVPROC)glewGetProcAddress((const GLubyte*)"glDepthRangedNV");
+  glDepthRangedNV(zNear, zFar);
+}
+
+
+static void GLAPIENTRY _glewLazy_glDrawTextureNV (GLuint texture, GLuint sampler, GLfloat x0, GLfloat y0, GLfloat x1, GLfloat y1, GLfloat z, GLfloat s0, GLfloat t0, GLfloat s1, GLfloat t1)
+{
+  glDrawTextureNV = (PFNGLDRAWTEXTURENVPROC)glewGetProcAddress((const GLubyte*)"glDrawTextureNV");
+  glDrawTextureNV(texture, sampler, x0, y0, x1, y1, z, s0, t0, s1, t1);
+}
+
+
+static void GLAPIENTRY _glewLazy_glEvalMapsNV (GLenum target, GLenum mode)
+{
+  glEvalMapsNV = (PFNGLEVALMAPSNVPROC)glewGetProcAddress((const GLubyte*)"glEvalMapsNV");
+  glEvalMapsNV(target, mode);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMapAttribParameterfvNV (GLenum target, GLuint index, GLenum pname, GLfloat* params)
+{
+  glGetMapAttribParameterfvNV = (PFNGLGETMAPATTRIBPARAMETERFVNVPROC)glewGetProcAddress((const GLubyte*)"glGetMapAttribParameterfvNV");
+  glGetMapAttribParameterfvNV(target, index, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMapAttribParameterivNV (GLenum target, GLuint index, GLenum pname, GLint* params)
+{
+  glGetMapAttribParameterivNV = (PFNGLGETMAPATTRIBPARAMETERIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetMapAttribParameterivNV");
+  glGetMapAttribParameterivNV(target, index, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMapControlPointsNV (GLenum target, GLuint index, GLenum type, GLsizei ustride, GLsizei vstride, GLboolean packed, void *points)
+{
+  glGetMapControlPointsNV = (PFNGLGETMAPCONTROLPOINTSNVPROC)glewGetProcAddress((const GLubyte*)"glGetMapControlPointsNV");
+  glGetMapControlPointsNV(target, index, type, ustride, vstride, packed, points);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMapParameterfvNV (GLenum target, GLenum pname, GLfloat* params)
+{
+  glGetMapParameterfvNV = (PFNGLGETMAPPARAMETERFVNVPROC)glewGetProcAddress((const GLubyte*)"glGetMapParameterfvNV");
+  glGetMapParameterfvNV(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMapParameterivNV (GLenum target, GLenum pname, GLint* params)
+{
+  glGetMapParameterivNV = (PFNGLGETMAPPARAMETERIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetMapParameterivNV");
+  glGetMapParameterivNV(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glMapControlPointsNV (GLenum target, GLuint index, GLenum type, GLsizei ustride, GLsizei vstride, GLint uorder, GLint vorder, GLboolean packed, const void *points)
+{
+  glMapControlPointsNV = (PFNGLMAPCONTROLPOINTSNVPROC)glewGetProcAddress((const GLubyte*)"glMapControlPointsNV");
+  glMapControlPointsNV(target, index, type, ustride, vstride, uorder, vorder, packed, points);
+}
+
+static void GLAPIENTRY _glewLazy_glMapParameterfvNV (GLenum target, GLenum pname, const GLfloat* params)
+{
+  glMapParameterfvNV = (PFNGLMAPPARAMETERFVNVPROC)glewGetProcAddress((const GLubyte*)"glMapParameterfvNV");
+  glMapParameterfvNV(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glMapParameterivNV (GLenum target, GLenum pname, const GLint* params)
+{
+  glMapParameterivNV = (PFNGLMAPPARAMETERIVNVPROC)glewGetProcAddress((const GLubyte*)"glMapParameterivNV");
+  glMapParameterivNV(target, pname, params);
+}
+
+
+static void GLAPIENTRY _glewLazy_glGetMultisamplefvNV (GLenum pname, GLuint index, GLfloat* val)
+{
+  glGetMultisamplefvNV = (PFNGLGETMULTISAMPLEFVNVPROC)glewGetProcAddress((const GLubyte*)"glGetMultisamplefvNV");
+  glGetMultisamplefvNV(pname, index, val);
+}
+
+static void GLAPIENTRY _glewLazy_glSampleMaskIndexedNV (GLuint index, GLbitfield mask)
+{
+  glSampleMaskIndexedNV = (PFNGLSAMPLEMASKINDEXEDNVPROC)glewGetProcAddress((const GLubyte*)"glSampleMaskIndexedNV");
+  glSampleMaskIndexedNV(index, mask);
+}
+
+static void GLAPIENTRY _glewLazy_glTexRenderbufferNV (GLenum target, GLuint renderbuffer)
+{
+  glTexRenderbufferNV = (PFNGLTEXRENDERBUFFERNVPROC)glewGetProcAddress((const GLubyte*)"glTexRenderbufferNV");
+  glTexRenderbufferNV(target, renderbuffer);
+}
+
+
+static void GLAPIENTRY _glewLazy_glDeleteFencesNV (GLsizei n, const GLuint* fences)
+{
+  glDeleteFencesNV = (PFNGLDELETEFENCESNVPROC)glewGetProcAddress((const GLubyte*)"glDeleteFencesNV");
+  glDeleteFencesNV(n, fences);
+}
+
+static void GLAPIENTRY _glewLazy_glFinishFenceNV (GLuint fence)
+{
+  glFinishFenceNV = (PFNGLFINISHFENCENVPROC)glewGetProcAddress((const GLubyte*)"glFinishFenceNV");
+  glFinishFenceNV(fence);
+}
+
+static void GLAPIENTRY _glewLazy_glGenFencesNV (GLsizei n, GLuint* fences)
+{
+  glGenFencesNV = (PFNGLGENFENCESNVPROC)glewGetProcAddress((const GLubyte*)"glGenFencesNV");
+  glGenFencesNV(n, fences);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFenceivNV (GLuint fence, GLenum pname, GLint* params)
+{
+  glGetFenceivNV = (PFNGLGETFENCEIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetFenceivNV");
+  glGetFenceivNV(fence, pname, params);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsFenceNV (GLuint fence)
+{
+  glIsFenceNV = (PFNGLISFENCENVPROC)glewGetProcAddress((const GLubyte*)"glIsFenceNV");
+  return glIsFenceNV(fence);
+}
+
+static void GLAPIENTRY _glewLazy_glSetFenceNV (GLuint fence, GLenum condition)
+{
+  glSetFenceNV = (PFNGLSETFENCENVPROC)glewGetProcAddress((const GLubyte*)"glSetFenceNV");
+  glSetFenceNV(fence, condition);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glTestFenceNV (GLuint fence)
+{
+  glTestFenceNV = (PFNGLTESTFENCENVPROC)glewGetProcAddress((const GLubyte*)"glTestFenceNV");
+  return glTestFenceNV(fence);
+}
+
+
+static void GLAPIENTRY _glewLazy_glFragmentCoverageColorNV (GLuint color)
+{
+  glFragmentCoverageColorNV = (PFNGLFRAGMENTCOVERAGECOLORNVPROC)glewGetProcAddress((const GLubyte*)"glFragmentCoverageColorNV");
+  glFragmentCoverageColorNV(color);
+}
+
+
+static void GLAPIENTRY _glewLazy_glGetProgramNamedParameterdvNV (GLuint id, GLsizei len, const GLubyte* name, GLdouble *params)
+{
+  glGetProgramNamedParameterdvNV = (PFNGLGETPROGRAMNAMEDPARAMETERDVNVPROC)glewGetProcAddress((const GLubyte*)"glGetProgramNamedParameterdvNV");
+  glGetProgramNamedParameterdvNV(id, len, name, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramNamedParameterfvNV (GLuint id, GLsizei len, const GLubyte* name, GLfloat *params)
+{
+  glGetProgramNamedParameterfvNV = (PFNGLGETPROGRAMNAMEDPARAMETERFVNVPROC)glewGetProcAddress((const GLubyte*)"glGetProgramNamedParameterfvNV");
+  glGetProgramNamedParameterfvNV(id, len, name, params);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramNamedParameter4dNV (GLuint id, GLsizei len, const GLubyte* name, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+  glProgramNamedParameter4dNV = (PFNGLPROGRAMNAMEDPARAMETER4DNVPROC)glewGetProcAddress((const GLubyte*)"glProgramNamedParameter4dNV");
+  glProgramNamedParameter4dNV(id, len, name, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramNamedParameter4dvNV (GLuint id, GLsizei len, const GLubyte* name, const GLdouble v[])
+{
+  glProgramNamedParameter4dvNV = (PFNGLPROGRAMNAMEDPARAMETER4DVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramNamedParameter4dvNV");
+  glProgramNamedParameter4dvNV(id, len, name, v);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramNamedParameter4fNV (GLuint id, GLsizei len, const GLubyte* name, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+  glProgramNamedParameter4fNV = (PFNGLPROGRAMNAMEDPARAMETER4FNVPROC)glewGetProcAddress((const GLubyte*)"glProgramNamedParameter4fNV");
+  glProgramNamedParameter4fNV(id, len, name, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramNamedParameter4fvNV (GLuint id, GLsizei len, const GLubyte* name, const GLfloat v[])
+{
+  glProgramNamedParameter4fvNV = (PFNGLPROGRAMNAMEDPARAMETER4FVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramNamedParameter4fvNV");
+  glProgramNamedParameter4fvNV(id, len, name, v);
+}
+
+
+static void GLAPIENTRY _glewLazy_glRenderbufferStorageMultisampleCoverageNV (GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLenum internalformat, GLsizei width, GLsizei height)
+{
+  glRenderbufferStorageMultisampleCoverageNV = (PFNGLRENDERBUFFERSTORAGEMULTISAMPLECOVERAGENVPROC)glewGetProcAddress((const GLubyte*)"glRenderbufferStorageMultisampleCoverageNV");
+  glRenderbufferStorageMultisampleCoverageNV(target, coverageSamples, colorSamples, internalformat, width, height);
+}
+
+
+static void GLAPIENTRY _glewLazy_glProgramVertexLimitNV (GLenum target, GLint limit)
+{
+  glProgramVertexLimitNV = (PFNGLPROGRAMVERTEXLIMITNVPROC)glewGetProcAddress((const GLubyte*)"glProgramVertexLimitNV");
+  glProgramVertexLimitNV(target, limit);
+}
+
+
+static void GLAPIENTRY _glewLazy_glProgramEnvParameterI4iNV (GLenum target, GLuint index, GLint x, GLint y, GLint z, GLint w)
+{
+  glProgramEnvParameterI4iNV = (PFNGLPROGRAMENVPARAMETERI4INVPROC)glewGetProcAddress((const GLubyte*)"glProgramEnvParameterI4iNV");
+  glProgramEnvParameterI4iNV(target, index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramEnvParameterI4ivNV (GLenum target, GLuint index, const GLint *params)
+{
+  glProgramEnvParameterI4ivNV = (PFNGLPROGRAMENVPARAMETERI4IVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramEnvParameterI4ivNV");
+  glProgramEnvParameterI4ivNV(target, index, params);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramEnvParameterI4uiNV (GLenum target, GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
+{
+  glProgramEnvParameterI4uiNV = (PFNGLPROGRAMENVPARAMETERI4UINVPROC)glewGetProcAddress((const GLubyte*)"glProgramEnvParameterI4uiNV");
+  glProgramEnvParameterI4uiNV(target, index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramEnvParameterI4uivNV (GLenum target, GLuint index, const GLuint *params)
+{
+  glProgramEnvParameterI4uivNV = (PFNGLPROGRAMENVPARAMETERI4UIVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramEnvParameterI4uivNV");
+  glProgramEnvParameterI4uivNV(target, index, params);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramEnvParametersI4ivNV (GLenum target, GLuint index, GLsizei count, const GLint *params)
+{
+  glProgramEnvParametersI4ivNV = (PFNGLPROGRAMENVPARAMETERSI4IVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramEnvParametersI4ivNV");
+  glProgramEnvParametersI4ivNV(target, index, count, params);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramEnvParametersI4uivNV (GLenum target, GLuint index, GLsizei count, const GLuint *params)
+{
+  glProgramEnvParametersI4uivNV = (PFNGLPROGRAMENVPARAMETERSI4UIVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramEnvParametersI4uivNV");
+  glProgramEnvParametersI4uivNV(target, index, count, params);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramLocalParameterI4iNV (GLenum target, GLuint index, GLint x, GLint y, GLint z, GLint w)
+{
+  glProgramLocalParameterI4iNV = (PFNGLPROGRAMLOCALPARAMETERI4INVPROC)glewGetProcAddress((const GLubyte*)"glProgramLocalParameterI4iNV");
+  glProgramLocalParameterI4iNV(target, index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramLocalParameterI4ivNV (GLenum target, GLuint index, const GLint *params)
+{
+  glProgramLocalParameterI4ivNV = (PFNGLPROGRAMLOCALPARAMETERI4IVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramLocalParameterI4ivNV");
+  glProgramLocalParameterI4ivNV(target, index, params);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramLocalParameterI4uiNV (GLenum target, GLuint index, GLuint x, GLuint y, GLuint z, GLuint w)
+{
+  glProgramLocalParameterI4uiNV = (PFNGLPROGRAMLOCALPARAMETERI4UINVPROC)glewGetProcAddress((const GLubyte*)"glProgramLocalParameterI4uiNV");
+  glProgramLocalParameterI4uiNV(target, index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramLocalParameterI4uivNV (GLenum target, GLuint index, const GLuint *params)
+{
+  glProgramLocalParameterI4uivNV = (PFNGLPROGRAMLOCALPARAMETERI4UIVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramLocalParameterI4uivNV");
+  glProgramLocalParameterI4uivNV(target, index, params);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramLocalParametersI4ivNV (GLenum target, GLuint index, GLsizei count, const GLint *params)
+{
+  glProgramLocalParametersI4ivNV = (PFNGLPROGRAMLOCALPARAMETERSI4IVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramLocalParametersI4ivNV");
+  glProgramLocalParametersI4ivNV(target, index, count, params);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramLocalParametersI4uivNV (GLenum target, GLuint index, GLsizei count, const GLuint *params)
+{
+  glProgramLocalParametersI4uivNV = (PFNGLPROGRAMLOCALPARAMETERSI4UIVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramLocalParametersI4uivNV");
+  glProgramLocalParametersI4uivNV(target, index, count, params);
+}
+
+
+static void GLAPIENTRY _glewLazy_glGetUniformi64vNV (GLuint program, GLint location, GLint64EXT* params)
+{
+  glGetUniformi64vNV = (PFNGLGETUNIFORMI64VNVPROC)glewGetProcAddress((const GLubyte*)"glGetUniformi64vNV");
+  glGetUniformi64vNV(program, location, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetUniformui64vNV (GLuint program, GLint location, GLuint64EXT* params)
+{
+  glGetUniformui64vNV = (PFNGLGETUNIFORMUI64VNVPROC)glewGetProcAddress((const GLubyte*)"glGetUniformui64vNV");
+  glGetUniformui64vNV(program, location, params);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1i64NV (GLuint program, GLint location, GLint64EXT x)
+{
+  glProgramUniform1i64NV = (PFNGLPROGRAMUNIFORM1I64NVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1i64NV");
+  glProgramUniform1i64NV(program, location, x);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1i64vNV (GLuint program, GLint location, GLsizei count, const GLint64EXT* value)
+{
+  glProgramUniform1i64vNV = (PFNGLPROGRAMUNIFORM1I64VNVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1i64vNV");
+  glProgramUniform1i64vNV(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1ui64NV (GLuint program, GLint location, GLuint64EXT x)
+{
+  glProgramUniform1ui64NV = (PFNGLPROGRAMUNIFORM1UI64NVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1ui64NV");
+  glProgramUniform1ui64NV(program, location, x);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform1ui64vNV (GLuint program, GLint location, GLsizei count, const GLuint64EXT* value)
+{
+  glProgramUniform1ui64vNV = (PFNGLPROGRAMUNIFORM1UI64VNVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform1ui64vNV");
+  glProgramUniform1ui64vNV(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2i64NV (GLuint program, GLint location, GLint64EXT x, GLint64EXT y)
+{
+  glProgramUniform2i64NV = (PFNGLPROGRAMUNIFORM2I64NVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2i64NV");
+  glProgramUniform2i64NV(program, location, x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2i64vNV (GLuint program, GLint location, GLsizei count, const GLint64EXT* value)
+{
+  glProgramUniform2i64vNV = (PFNGLPROGRAMUNIFORM2I64VNVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2i64vNV");
+  glProgramUniform2i64vNV(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2ui64NV (GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y)
+{
+  glProgramUniform2ui64NV = (PFNGLPROGRAMUNIFORM2UI64NVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2ui64NV");
+  glProgramUniform2ui64NV(program, location, x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform2ui64vNV (GLuint program, GLint location, GLsizei count, const GLuint64EXT* value)
+{
+  glProgramUniform2ui64vNV = (PFNGLPROGRAMUNIFORM2UI64VNVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform2ui64vNV");
+  glProgramUniform2ui64vNV(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3i64NV (GLuint program, GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z)
+{
+  glProgramUniform3i64NV = (PFNGLPROGRAMUNIFORM3I64NVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3i64NV");
+  glProgramUniform3i64NV(program, location, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3i64vNV (GLuint program, GLint location, GLsizei count, const GLint64EXT* value)
+{
+  glProgramUniform3i64vNV = (PFNGLPROGRAMUNIFORM3I64VNVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3i64vNV");
+  glProgramUniform3i64vNV(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3ui64NV (GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z)
+{
+  glProgramUniform3ui64NV = (PFNGLPROGRAMUNIFORM3UI64NVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3ui64NV");
+  glProgramUniform3ui64NV(program, location, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform3ui64vNV (GLuint program, GLint location, GLsizei count, const GLuint64EXT* value)
+{
+  glProgramUniform3ui64vNV = (PFNGLPROGRAMUNIFORM3UI64VNVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform3ui64vNV");
+  glProgramUniform3ui64vNV(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4i64NV (GLuint program, GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w)
+{
+  glProgramUniform4i64NV = (PFNGLPROGRAMUNIFORM4I64NVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4i64NV");
+  glProgramUniform4i64NV(program, location, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4i64vNV (GLuint program, GLint location, GLsizei count, const GLint64EXT* value)
+{
+  glProgramUniform4i64vNV = (PFNGLPROGRAMUNIFORM4I64VNVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4i64vNV");
+  glProgramUniform4i64vNV(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4ui64NV (GLuint program, GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w)
+{
+  glProgramUniform4ui64NV = (PFNGLPROGRAMUNIFORM4UI64NVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4ui64NV");
+  glProgramUniform4ui64NV(program, location, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniform4ui64vNV (GLuint program, GLint location, GLsizei count, const GLuint64EXT* value)
+{
+  glProgramUniform4ui64vNV = (PFNGLPROGRAMUNIFORM4UI64VNVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniform4ui64vNV");
+  glProgramUniform4ui64vNV(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1i64NV (GLint location, GLint64EXT x)
+{
+  glUniform1i64NV = (PFNGLUNIFORM1I64NVPROC)glewGetProcAddress((const GLubyte*)"glUniform1i64NV");
+  glUniform1i64NV(location, x);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1i64vNV (GLint location, GLsizei count, const GLint64EXT* value)
+{
+  glUniform1i64vNV = (PFNGLUNIFORM1I64VNVPROC)glewGetProcAddress((const GLubyte*)"glUniform1i64vNV");
+  glUniform1i64vNV(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1ui64NV (GLint location, GLuint64EXT x)
+{
+  glUniform1ui64NV = (PFNGLUNIFORM1UI64NVPROC)glewGetProcAddress((const GLubyte*)"glUniform1ui64NV");
+  glUniform1ui64NV(location, x);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform1ui64vNV (GLint location, GLsizei count, const GLuint64EXT* value)
+{
+  glUniform1ui64vNV = (PFNGLUNIFORM1UI64VNVPROC)glewGetProcAddress((const GLubyte*)"glUniform1ui64vNV");
+  glUniform1ui64vNV(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2i64NV (GLint location, GLint64EXT x, GLint64EXT y)
+{
+  glUniform2i64NV = (PFNGLUNIFORM2I64NVPROC)glewGetProcAddress((const GLubyte*)"glUniform2i64NV");
+  glUniform2i64NV(location, x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2i64vNV (GLint location, GLsizei count, const GLint64EXT* value)
+{
+  glUniform2i64vNV = (PFNGLUNIFORM2I64VNVPROC)glewGetProcAddress((const GLubyte*)"glUniform2i64vNV");
+  glUniform2i64vNV(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2ui64NV (GLint location, GLuint64EXT x, GLuint64EXT y)
+{
+  glUniform2ui64NV = (PFNGLUNIFORM2UI64NVPROC)glewGetProcAddress((const GLubyte*)"glUniform2ui64NV");
+  glUniform2ui64NV(location, x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform2ui64vNV (GLint location, GLsizei count, const GLuint64EXT* value)
+{
+  glUniform2ui64vNV = (PFNGLUNIFORM2UI64VNVPROC)glewGetProcAddress((const GLubyte*)"glUniform2ui64vNV");
+  glUniform2ui64vNV(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3i64NV (GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z)
+{
+  glUniform3i64NV = (PFNGLUNIFORM3I64NVPROC)glewGetProcAddress((const GLubyte*)"glUniform3i64NV");
+  glUniform3i64NV(location, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3i64vNV (GLint location, GLsizei count, const GLint64EXT* value)
+{
+  glUniform3i64vNV = (PFNGLUNIFORM3I64VNVPROC)glewGetProcAddress((const GLubyte*)"glUniform3i64vNV");
+  glUniform3i64vNV(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3ui64NV (GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z)
+{
+  glUniform3ui64NV = (PFNGLUNIFORM3UI64NVPROC)glewGetProcAddress((const GLubyte*)"glUniform3ui64NV");
+  glUniform3ui64NV(location, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform3ui64vNV (GLint location, GLsizei count, const GLuint64EXT* value)
+{
+  glUniform3ui64vNV = (PFNGLUNIFORM3UI64VNVPROC)glewGetProcAddress((const GLubyte*)"glUniform3ui64vNV");
+  glUniform3ui64vNV(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4i64NV (GLint location, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w)
+{
+  glUniform4i64NV = (PFNGLUNIFORM4I64NVPROC)glewGetProcAddress((const GLubyte*)"glUniform4i64NV");
+  glUniform4i64NV(location, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4i64vNV (GLint location, GLsizei count, const GLint64EXT* value)
+{
+  glUniform4i64vNV = (PFNGLUNIFORM4I64VNVPROC)glewGetProcAddress((const GLubyte*)"glUniform4i64vNV");
+  glUniform4i64vNV(location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4ui64NV (GLint location, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w)
+{
+  glUniform4ui64NV = (PFNGLUNIFORM4UI64NVPROC)glewGetProcAddress((const GLubyte*)"glUniform4ui64NV");
+  glUniform4ui64NV(location, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glUniform4ui64vNV (GLint location, GLsizei count, const GLuint64EXT* value)
+{
+  glUniform4ui64vNV = (PFNGLUNIFORM4UI64VNVPROC)glewGetProcAddress((const GLubyte*)"glUniform4ui64vNV");
+  glUniform4ui64vNV(location, count, value);
+}
+
+
+static void GLAPIENTRY _glewLazy_glColor3hNV (GLhalf red, GLhalf green, GLhalf blue)
+{
+  glColor3hNV = (PFNGLCOLOR3HNVPROC)glewGetProcAddress((const GLubyte*)"glColor3hNV");
+  glColor3hNV(red, green, blue);
+}
+
+static void GLAPIENTRY _glewLazy_glColor3hvNV (const GLhalf* v)
+{
+  glColor3hvNV = (PFNGLCOLOR3HVNVPROC)glewGetProcAddress((const GLubyte*)"glColor3hvNV");
+  glColor3hvNV(v);
+}
+
+static void GLAPIENTRY _glewLazy_glColor4hNV (GLhalf red, GLhalf green, GLhalf blue, GLhalf alpha)
+{
+  glColor4hNV = (PFNGLCOLOR4HNVPROC)glewGetProcAddress((const GLubyte*)"glColor4hNV");
+  glColor4hNV(red, green, blue, alpha);
+}
+
+static void GLAPIENTRY _glewLazy_glColor4hvNV (const GLhalf* v)
+{
+  glColor4hvNV = (PFNGLCOLOR4HVNVPROC)glewGetProcAddress((const GLubyte*)"glColor4hvNV");
+  glColor4hvNV(v);
+}
+
+static void GLAPIENTRY _glewLazy_glFogCoordhNV (GLhalf fog)
+{
+  glFogCoordhNV = (PFNGLFOGCOORDHNVPROC)glewGetProcAddress((const GLubyte*)"glFogCoordhNV");
+  glFogCoordhNV(fog);
+}
+
+static void GLAPIENTRY _glewLazy_glFogCoordhvNV (const GLhalf* fog)
+{
+  glFogCoordhvNV = (PFNGLFOGCOORDHVNVPROC)glewGetProcAddress((const GLubyte*)"glFogCoordhvNV");
+  glFogCoordhvNV(fog);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1hNV (GLenum target, GLhalf s)
+{
+  glMultiTexCoord1hNV = (PFNGLMULTITEXCOORD1HNVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1hNV");
+  glMultiTexCoord1hNV(target, s);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord1hvNV (GLenum target, const GLhalf* v)
+{
+  glMultiTexCoord1hvNV = (PFNGLMULTITEXCOORD1HVNVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord1hvNV");
+  glMultiTexCoord1hvNV(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2hNV (GLenum target, GLhalf s, GLhalf t)
+{
+  glMultiTexCoord2hNV = (PFNGLMULTITEXCOORD2HNVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2hNV");
+  glMultiTexCoord2hNV(target, s, t);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord2hvNV (GLenum target, const GLhalf* v)
+{
+  glMultiTexCoord2hvNV = (PFNGLMULTITEXCOORD2HVNVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord2hvNV");
+  glMultiTexCoord2hvNV(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3hNV (GLenum target, GLhalf s, GLhalf t, GLhalf r)
+{
+  glMultiTexCoord3hNV = (PFNGLMULTITEXCOORD3HNVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3hNV");
+  glMultiTexCoord3hNV(target, s, t, r);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord3hvNV (GLenum target, const GLhalf* v)
+{
+  glMultiTexCoord3hvNV = (PFNGLMULTITEXCOORD3HVNVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord3hvNV");
+  glMultiTexCoord3hvNV(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4hNV (GLenum target, GLhalf s, GLhalf t, GLhalf r, GLhalf q)
+{
+  glMultiTexCoord4hNV = (PFNGLMULTITEXCOORD4HNVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4hNV");
+  glMultiTexCoord4hNV(target, s, t, r, q);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4hvNV (GLenum target, const GLhalf* v)
+{
+  glMultiTexCoord4hvNV = (PFNGLMULTITEXCOORD4HVNVPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4hvNV");
+  glMultiTexCoord4hvNV(target, v);
+}
+
+static void GLAPIENTRY _glewLazy_glNormal3hNV (GLhalf nx, GLhalf ny, GLhalf nz)
+{
+  glNormal3hNV = (PFNGLNORMAL3HNVPROC)glewGetProcAddress((const GLubyte*)"glNormal3hNV");
+  glNormal3hNV(nx, ny, nz);
+}
+
+static void GLAPIENTRY _glewLazy_glNormal3hvNV (const GLhalf* v)
+{
+  glNormal3hvNV = (PFNGLNORMAL3HVNVPROC)glewGetProcAddress((const GLubyte*)"glNormal3hvNV");
+  glNormal3hvNV(v);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3hNV (GLhalf red, GLhalf green, GLhalf blue)
+{
+  glSecondaryColor3hNV = (PFNGLSECONDARYCOLOR3HNVPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3hNV");
+  glSecondaryColor3hNV(red, green, blue);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColor3hvNV (const GLhalf* v)
+{
+  glSecondaryColor3hvNV = (PFNGLSECONDARYCOLOR3HVNVPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColor3hvNV");
+  glSecondaryColor3hvNV(v);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord1hNV (GLhalf s)
+{
+  glTexCoord1hNV = (PFNGLTEXCOORD1HNVPROC)glewGetProcAddress((const GLubyte*)"glTexCoord1hNV");
+  glTexCoord1hNV(s);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord1hvNV (const GLhalf* v)
+{
+  glTexCoord1hvNV = (PFNGLTEXCOORD1HVNVPROC)glewGetProcAddress((const GLubyte*)"glTexCoord1hvNV");
+  glTexCoord1hvNV(v);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord2hNV (GLhalf s, GLhalf t)
+{
+  glTexCoord2hNV = (PFNGLTEXCOORD2HNVPROC)glewGetProcAddress((const GLubyte*)"glTexCoord2hNV");
+  glTexCoord2hNV(s, t);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord2hvNV (const GLhalf* v)
+{
+  glTexCoord2hvNV = (PFNGLTEXCOORD2HVNVPROC)glewGetProcAddress((const GLubyte*)"glTexCoord2hvNV");
+  glTexCoord2hvNV(v);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord3hNV (GLhalf s, GLhalf t, GLhalf r)
+{
+  glTexCoord3hNV = (PFNGLTEXCOORD3HNVPROC)glewGetProcAddress((const GLubyte*)"glTexCoord3hNV");
+  glTexCoord3hNV(s, t, r);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord3hvNV (const GLhalf* v)
+{
+  glTexCoord3hvNV = (PFNGLTEXCOORD3HVNVPROC)glewGetProcAddress((const GLubyte*)"glTexCoord3hvNV");
+  glTexCoord3hvNV(v);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord4hNV (GLhalf s, GLhalf t, GLhalf r, GLhalf q)
+{
+  glTexCoord4hNV = (PFNGLTEXCOORD4HNVPROC)glewGetProcAddress((const GLubyte*)"glTexCoord4hNV");
+  glTexCoord4hNV(s, t, r, q);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord4hvNV (const GLhalf* v)
+{
+  glTexCoord4hvNV = (PFNGLTEXCOORD4HVNVPROC)glewGetProcAddress((const GLubyte*)"glTexCoord4hvNV");
+  glTexCoord4hvNV(v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertex2hNV (GLhalf x, GLhalf y)
+{
+  glVertex2hNV = (PFNGLVERTEX2HNVPROC)glewGetProcAddress((const GLubyte*)"glVertex2hNV");
+  glVertex2hNV(x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glVertex2hvNV (const GLhalf* v)
+{
+  glVertex2hvNV = (PFNGLVERTEX2HVNVPROC)glewGetProcAddress((const GLubyte*)"glVertex2hvNV");
+  glVertex2hvNV(v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertex3hNV (GLhalf x, GLhalf y, GLhalf z)
+{
+  glVertex3hNV = (PFNGLVERTEX3HNVPROC)glewGetProcAddress((const GLubyte*)"glVertex3hNV");
+  glVertex3hNV(x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glVertex3hvNV (const GLhalf* v)
+{
+  glVertex3hvNV = (PFNGLVERTEX3HVNVPROC)glewGetProcAddress((const GLubyte*)"glVertex3hvNV");
+  glVertex3hvNV(v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertex4hNV (GLhalf x, GLhalf y, GLhalf z, GLhalf w)
+{
+  glVertex4hNV = (PFNGLVERTEX4HNVPROC)glewGetProcAddress((const GLubyte*)"glVertex4hNV");
+  glVertex4hNV(x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glVertex4hvNV (const GLhalf* v)
+{
+  glVertex4hvNV = (PFNGLVERTEX4HVNVPROC)glewGetProcAddress((const GLubyte*)"glVertex4hvNV");
+  glVertex4hvNV(v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1hNV (GLuint index, GLhalf x)
+{
+  glVertexAttrib1hNV = (PFNGLVERTEXATTRIB1HNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1hNV");
+  glVertexAttrib1hNV(index, x);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1hvNV (GLuint index, const GLhalf* v)
+{
+  glVertexAttrib1hvNV = (PFNGLVERTEXATTRIB1HVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1hvNV");
+  glVertexAttrib1hvNV(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2hNV (GLuint index, GLhalf x, GLhalf y)
+{
+  glVertexAttrib2hNV = (PFNGLVERTEXATTRIB2HNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2hNV");
+  glVertexAttrib2hNV(index, x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2hvNV (GLuint index, const GLhalf* v)
+{
+  glVertexAttrib2hvNV = (PFNGLVERTEXATTRIB2HVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2hvNV");
+  glVertexAttrib2hvNV(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3hNV (GLuint index, GLhalf x, GLhalf y, GLhalf z)
+{
+  glVertexAttrib3hNV = (PFNGLVERTEXATTRIB3HNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3hNV");
+  glVertexAttrib3hNV(index, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3hvNV (GLuint index, const GLhalf* v)
+{
+  glVertexAttrib3hvNV = (PFNGLVERTEXATTRIB3HVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3hvNV");
+  glVertexAttrib3hvNV(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4hNV (GLuint index, GLhalf x, GLhalf y, GLhalf z, GLhalf w)
+{
+  glVertexAttrib4hNV = (PFNGLVERTEXATTRIB4HNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4hNV");
+  glVertexAttrib4hNV(index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4hvNV (GLuint index, const GLhalf* v)
+{
+  glVertexAttrib4hvNV = (PFNGLVERTEXATTRIB4HVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4hvNV");
+  glVertexAttrib4hvNV(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs1hvNV (GLuint index, GLsizei n, const GLhalf* v)
+{
+  glVertexAttribs1hvNV = (PFNGLVERTEXATTRIBS1HVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs1hvNV");
+  glVertexAttribs1hvNV(index, n, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs2hvNV (GLuint index, GLsizei n, const GLhalf* v)
+{
+  glVertexAttribs2hvNV = (PFNGLVERTEXATTRIBS2HVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs2hvNV");
+  glVertexAttribs2hvNV(index, n, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs3hvNV (GLuint index, GLsizei n, const GLhalf* v)
+{
+  glVertexAttribs3hvNV = (PFNGLVERTEXATTRIBS3HVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs3hvNV");
+  glVertexAttribs3hvNV(index, n, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs4hvNV (GLuint index, GLsizei n, const GLhalf* v)
+{
+  glVertexAttribs4hvNV = (PFNGLVERTEXATTRIBS4HVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs4hvNV");
+  glVertexAttribs4hvNV(index, n, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexWeighthNV (GLhalf weight)
+{
+  glVertexWeighthNV = (PFNGLVERTEXWEIGHTHNVPROC)glewGetProcAddress((const GLubyte*)"glVertexWeighthNV");
+  glVertexWeighthNV(weight);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexWeighthvNV (const GLhalf* weight)
+{
+  glVertexWeighthvNV = (PFNGLVERTEXWEIGHTHVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexWeighthvNV");
+  glVertexWeighthvNV(weight);
+}
+
+
+static void GLAPIENTRY _glewLazy_glGetInternalformatSampleivNV (GLenum target, GLenum internalformat, GLsizei samples, GLenum pname, GLsizei bufSize, GLint* params)
+{
+  glGetInternalformatSampleivNV = (PFNGLGETINTERNALFORMATSAMPLEIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetInternalformatSampleivNV");
+  glGetInternalformatSampleivNV(target, internalformat, samples, pname, bufSize, params);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBeginOcclusionQueryNV (GLuint id)
+{
+  glBeginOcclusionQueryNV = (PFNGLBEGINOCCLUSIONQUERYNVPROC)glewGetProcAddress((const GLubyte*)"glBeginOcclusionQueryNV");
+  glBeginOcclusionQueryNV(id);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteOcclusionQueriesNV (GLsizei n, const GLuint* ids)
+{
+  glDeleteOcclusionQueriesNV = (PFNGLDELETEOCCLUSIONQUERIESNVPROC)glewGetProcAddress((const GLubyte*)"glDeleteOcclusionQueriesNV");
+  glDeleteOcclusionQueriesNV(n, ids);
+}
+
+static void GLAPIENTRY _glewLazy_glEndOcclusionQueryNV (void)
+{
+  glEndOcclusionQueryNV = (PFNGLENDOCCLUSIONQUERYNVPROC)glewGetProcAddress((const GLubyte*)"glEndOcclusionQueryNV");
+  glEndOcclusionQueryNV();
+}
+
+static void GLAPIENTRY _glewLazy_glGenOcclusionQueriesNV (GLsizei n, GLuint* ids)
+{
+  glGenOcclusionQueriesNV = (PFNGLGENOCCLUSIONQUERIESNVPROC)glewGetProcAddress((const GLubyte*)"glGenOcclusionQueriesNV");
+  glGenOcclusionQueriesNV(n, ids);
+}
+
+static void GLAPIENTRY _glewLazy_glGetOcclusionQueryivNV (GLuint id, GLenum pname, GLint* params)
+{
+  glGetOcclusionQueryivNV = (PFNGLGETOCCLUSIONQUERYIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetOcclusionQueryivNV");
+  glGetOcclusionQueryivNV(id, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetOcclusionQueryuivNV (GLuint id, GLenum pname, GLuint* params)
+{
+  glGetOcclusionQueryuivNV = (PFNGLGETOCCLUSIONQUERYUIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetOcclusionQueryuivNV");
+  glGetOcclusionQueryuivNV(id, pname, params);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsOcclusionQueryNV (GLuint id)
+{
+  glIsOcclusionQueryNV = (PFNGLISOCCLUSIONQUERYNVPROC)glewGetProcAddress((const GLubyte*)"glIsOcclusionQueryNV");
+  return glIsOcclusionQueryNV(id);
+}
+
+
+static void GLAPIENTRY _glewLazy_glProgramBufferParametersIivNV (GLenum target, GLuint buffer, GLuint index, GLsizei count, const GLint *params)
+{
+  glProgramBufferParametersIivNV = (PFNGLPROGRAMBUFFERPARAMETERSIIVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramBufferParametersIivNV");
+  glProgramBufferParametersIivNV(target, buffer, index, count, params);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramBufferParametersIuivNV (GLenum target, GLuint buffer, GLuint index, GLsizei count, const GLuint *params)
+{
+  glProgramBufferParametersIuivNV = (PFNGLPROGRAMBUFFERPARAMETERSIUIVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramBufferParametersIuivNV");
+  glProgramBufferParametersIuivNV(target, buffer, index, count, params);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramBufferParametersfvNV (GLenum target, GLuint buffer, GLuint index, GLsizei count, const GLfloat *params)
+{
+  glProgramBufferParametersfvNV = (PFNGLPROGRAMBUFFERPARAMETERSFVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramBufferParametersfvNV");
+  glProgramBufferParametersfvNV(target, buffer, index, count, params);
+}
+
+
+static void GLAPIENTRY _glewLazy_glCopyPathNV (GLuint resultPath, GLuint srcPath)
+{
+  glCopyPathNV = (PFNGLCOPYPATHNVPROC)glewGetProcAddress((const GLubyte*)"glCopyPathNV");
+  glCopyPathNV(resultPath, srcPath);
+}
+
+static void GLAPIENTRY _glewLazy_glCoverFillPathInstancedNV (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum coverMode, GLenum transformType, const GLfloat *transformValues)
+{
+  glCoverFillPathInstancedNV = (PFNGLCOVERFILLPATHINSTANCEDNVPROC)glewGetProcAddress((const GLubyte*)"glCoverFillPathInstancedNV");
+  glCoverFillPathInstancedNV(numPaths, pathNameType, paths, pathBase, coverMode, transformType, transformValues);
+}
+
+static void GLAPIENTRY _glewLazy_glCoverFillPathNV (GLuint path, GLenum coverMode)
+{
+  glCoverFillPathNV = (PFNGLCOVERFILLPATHNVPROC)glewGetProcAddress((const GLubyte*)"glCoverFillPathNV");
+  glCoverFillPathNV(path, coverMode);
+}
+
+static void GLAPIENTRY _glewLazy_glCoverStrokePathInstancedNV (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum coverMode, GLenum transformType, const GLfloat *transformValues)
+{
+  glCoverStrokePathInstancedNV = (PFNGLCOVERSTROKEPATHINSTANCEDNVPROC)glewGetProcAddress((const GLubyte*)"glCoverStrokePathInstancedNV");
+  glCoverStrokePathInstancedNV(numPaths, pathNameType, paths, pathBase, coverMode, transformType, transformValues);
+}
+
+static void GLAPIENTRY _glewLazy_glCoverStrokePathNV (GLuint path, GLenum coverMode)
+{
+  glCoverStrokePathNV = (PFNGLCOVERSTROKEPATHNVPROC)glewGetProcAddress((const GLubyte*)"glCoverStrokePathNV");
+  glCoverStrokePathNV(path, coverMode);
+}
+
+static void GLAPIENTRY _glewLazy_glDeletePathsNV (GLuint path, GLsizei range)
+{
+  glDeletePathsNV = (PFNGLDELETEPATHSNVPROC)glewGetProcAddress((const GLubyte*)"glDeletePathsNV");
+  glDeletePathsNV(path, range);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glGenPathsNV (GLsizei range)
+{
+  glGenPathsNV = (PFNGLGENPATHSNVPROC)glewGetProcAddress((const GLubyte*)"glGenPathsNV");
+  return glGenPathsNV(range);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPathColorGenfvNV (GLenum color, GLenum pname, GLfloat* value)
+{
+  glGetPathColorGenfvNV = (PFNGLGETPATHCOLORGENFVNVPROC)glewGetProcAddress((const GLubyte*)"glGetPathColorGenfvNV");
+  glGetPathColorGenfvNV(color, pname, value);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPathColorGenivNV (GLenum color, GLenum pname, GLint* value)
+{
+  glGetPathColorGenivNV = (PFNGLGETPATHCOLORGENIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetPathColorGenivNV");
+  glGetPathColorGenivNV(color, pname, value);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPathCommandsNV (GLuint path, GLubyte* commands)
+{
+  glGetPathCommandsNV = (PFNGLGETPATHCOMMANDSNVPROC)glewGetProcAddress((const GLubyte*)"glGetPathCommandsNV");
+  glGetPathCommandsNV(path, commands);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPathCoordsNV (GLuint path, GLfloat* coords)
+{
+  glGetPathCoordsNV = (PFNGLGETPATHCOORDSNVPROC)glewGetProcAddress((const GLubyte*)"glGetPathCoordsNV");
+  glGetPathCoordsNV(path, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPathDashArrayNV (GLuint path, GLfloat* dashArray)
+{
+  glGetPathDashArrayNV = (PFNGLGETPATHDASHARRAYNVPROC)glewGetProcAddress((const GLubyte*)"glGetPathDashArrayNV");
+  glGetPathDashArrayNV(path, dashArray);
+}
+
+static GLfloat GLAPIENTRY _glewLazy_glGetPathLengthNV (GLuint path, GLsizei startSegment, GLsizei numSegments)
+{
+  glGetPathLengthNV = (PFNGLGETPATHLENGTHNVPROC)glewGetProcAddress((const GLubyte*)"glGetPathLengthNV");
+  return glGetPathLengthNV(path, startSegment, numSegments);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPathMetricRangeNV (GLbitfield metricQueryMask, GLuint firstPathName, GLsizei numPaths, GLsizei stride, GLfloat* metrics)
+{
+  glGetPathMetricRangeNV = (PFNGLGETPATHMETRICRANGENVPROC)glewGetProcAddress((const GLubyte*)"glGetPathMetricRangeNV");
+  glGetPathMetricRangeNV(metricQueryMask, firstPathName, numPaths, stride, metrics);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPathMetricsNV (GLbitfield metricQueryMask, GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLsizei stride, GLfloat *metrics)
+{
+  glGetPathMetricsNV = (PFNGLGETPATHMETRICSNVPROC)glewGetProcAddress((const GLubyte*)"glGetPathMetricsNV");
+  glGetPathMetricsNV(metricQueryMask, numPaths, pathNameType, paths, pathBase, stride, metrics);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPathParameterfvNV (GLuint path, GLenum pname, GLfloat* value)
+{
+  glGetPathParameterfvNV = (PFNGLGETPATHPARAMETERFVNVPROC)glewGetProcAddress((const GLubyte*)"glGetPathParameterfvNV");
+  glGetPathParameterfvNV(path, pname, value);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPathParameterivNV (GLuint path, GLenum pname, GLint* value)
+{
+  glGetPathParameterivNV = (PFNGLGETPATHPARAMETERIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetPathParameterivNV");
+  glGetPathParameterivNV(path, pname, value);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPathSpacingNV (GLenum pathListMode, GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLfloat advanceScale, GLfloat kerningScale, GLenum transformType, GLfloat *returnedSpacing)
+{
+  glGetPathSpacingNV = (PFNGLGETPATHSPACINGNVPROC)glewGetProcAddress((const GLubyte*)"glGetPathSpacingNV");
+  glGetPathSpacingNV(pathListMode, numPaths, pathNameType, paths, pathBase, advanceScale, kerningScale, transformType, returnedSpacing);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPathTexGenfvNV (GLenum texCoordSet, GLenum pname, GLfloat* value)
+{
+  glGetPathTexGenfvNV = (PFNGLGETPATHTEXGENFVNVPROC)glewGetProcAddress((const GLubyte*)"glGetPathTexGenfvNV");
+  glGetPathTexGenfvNV(texCoordSet, pname, value);
+}
+
+static void GLAPIENTRY _glewLazy_glGetPathTexGenivNV (GLenum texCoordSet, GLenum pname, GLint* value)
+{
+  glGetPathTexGenivNV = (PFNGLGETPATHTEXGENIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetPathTexGenivNV");
+  glGetPathTexGenivNV(texCoordSet, pname, value);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramResourcefvNV (GLuint program, GLenum programInterface, GLuint index, GLsizei propCount, const GLenum* props, GLsizei bufSize, GLsizei *length, GLfloat *params)
+{
+  glGetProgramResourcefvNV = (PFNGLGETPROGRAMRESOURCEFVNVPROC)glewGetProcAddress((const GLubyte*)"glGetProgramResourcefvNV");
+  glGetProgramResourcefvNV(program, programInterface, index, propCount, props, bufSize, length, params);
+}
+
+static void GLAPIENTRY _glewLazy_glInterpolatePathsNV (GLuint resultPath, GLuint pathA, GLuint pathB, GLfloat weight)
+{
+  glInterpolatePathsNV = (PFNGLINTERPOLATEPATHSNVPROC)glewGetProcAddress((const GLubyte*)"glInterpolatePathsNV");
+  glInterpolatePathsNV(resultPath, pathA, pathB, weight);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsPathNV (GLuint path)
+{
+  glIsPathNV = (PFNGLISPATHNVPROC)glewGetProcAddress((const GLubyte*)"glIsPathNV");
+  return glIsPathNV(path);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsPointInFillPathNV (GLuint path, GLuint mask, GLfloat x, GLfloat y)
+{
+  glIsPointInFillPathNV = (PFNGLISPOINTINFILLPATHNVPROC)glewGetProcAddress((const GLubyte*)"glIsPointInFillPathNV");
+  return glIsPointInFillPathNV(path, mask, x, y);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsPointInStrokePathNV (GLuint path, GLfloat x, GLfloat y)
+{
+  glIsPointInStrokePathNV = (PFNGLISPOINTINSTROKEPATHNVPROC)glewGetProcAddress((const GLubyte*)"glIsPointInStrokePathNV");
+  return glIsPointInStrokePathNV(path, x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixLoad3x2fNV (GLenum matrixMode, const GLfloat* m)
+{
+  glMatrixLoad3x2fNV = (PFNGLMATRIXLOAD3X2FNVPROC)glewGetProcAddress((const GLubyte*)"glMatrixLoad3x2fNV");
+  glMatrixLoad3x2fNV(matrixMode, m);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixLoad3x3fNV (GLenum matrixMode, const GLfloat* m)
+{
+  glMatrixLoad3x3fNV = (PFNGLMATRIXLOAD3X3FNVPROC)glewGetProcAddress((const GLubyte*)"glMatrixLoad3x3fNV");
+  glMatrixLoad3x3fNV(matrixMode, m);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixLoadTranspose3x3fNV (GLenum matrixMode, const GLfloat* m)
+{
+  glMatrixLoadTranspose3x3fNV = (PFNGLMATRIXLOADTRANSPOSE3X3FNVPROC)glewGetProcAddress((const GLubyte*)"glMatrixLoadTranspose3x3fNV");
+  glMatrixLoadTranspose3x3fNV(matrixMode, m);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixMult3x2fNV (GLenum matrixMode, const GLfloat* m)
+{
+  glMatrixMult3x2fNV = (PFNGLMATRIXMULT3X2FNVPROC)glewGetProcAddress((const GLubyte*)"glMatrixMult3x2fNV");
+  glMatrixMult3x2fNV(matrixMode, m);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixMult3x3fNV (GLenum matrixMode, const GLfloat* m)
+{
+  glMatrixMult3x3fNV = (PFNGLMATRIXMULT3X3FNVPROC)glewGetProcAddress((const GLubyte*)"glMatrixMult3x3fNV");
+  glMatrixMult3x3fNV(matrixMode, m);
+}
+
+static void GLAPIENTRY _glewLazy_glMatrixMultTranspose3x3fNV (GLenum matrixMode, const GLfloat* m)
+{
+  glMatrixMultTranspose3x3fNV = (PFNGLMATRIXMULTTRANSPOSE3X3FNVPROC)glewGetProcAddress((const GLubyte*)"glMatrixMultTranspose3x3fNV");
+  glMatrixMultTranspose3x3fNV(matrixMode, m);
+}
+
+static void GLAPIENTRY _glewLazy_glPathColorGenNV (GLenum color, GLenum genMode, GLenum colorFormat, const GLfloat* coeffs)
+{
+  glPathColorGenNV = (PFNGLPATHCOLORGENNVPROC)glewGetProcAddress((const GLubyte*)"glPathColorGenNV");
+  glPathColorGenNV(color, genMode, colorFormat, coeffs);
+}
+
+static void GLAPIENTRY _glewLazy_glPathCommandsNV (GLuint path, GLsizei numCommands, const GLubyte* commands, GLsizei numCoords, GLenum coordType, const void*coords)
+{
+  glPathCommandsNV = (PFNGLPATHCOMMANDSNVPROC)glewGetProcAddress((const GLubyte*)"glPathCommandsNV");
+  glPathCommandsNV(path, numCommands, commands, numCoords, coordType, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glPathCoordsNV (GLuint path, GLsizei numCoords, GLenum coordType, const void *coords)
+{
+  glPathCoordsNV = (PFNGLPATHCOORDSNVPROC)glewGetProcAddress((const GLubyte*)"glPathCoordsNV");
+  glPathCoordsNV(path, numCoords, coordType, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glPathCoverDepthFuncNV (GLenum zfunc)
+{
+  glPathCoverDepthFuncNV = (PFNGLPATHCOVERDEPTHFUNCNVPROC)glewGetProcAddress((const GLubyte*)"glPathCoverDepthFuncNV");
+  glPathCoverDepthFuncNV(zfunc);
+}
+
+static void GLAPIENTRY _glewLazy_glPathDashArrayNV (GLuint path, GLsizei dashCount, const GLfloat* dashArray)
+{
+  glPathDashArrayNV = (PFNGLPATHDASHARRAYNVPROC)glewGetProcAddress((const GLubyte*)"glPathDashArrayNV");
+  glPathDashArrayNV(path, dashCount, dashArray);
+}
+
+static void GLAPIENTRY _glewLazy_glPathFogGenNV (GLenum genMode)
+{
+  glPathFogGenNV = (PFNGLPATHFOGGENNVPROC)glewGetProcAddress((const GLubyte*)"glPathFogGenNV");
+  glPathFogGenNV(genMode);
+}
+
+static GLenum GLAPIENTRY _glewLazy_glPathGlyphIndexArrayNV (GLuint firstPathName, GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLuint firstGlyphIndex, GLsizei numGlyphs, GLuint pathParameterTemplate, GLfloat emScale)
+{
+  glPathGlyphIndexArrayNV = (PFNGLPATHGLYPHINDEXARRAYNVPROC)glewGetProcAddress((const GLubyte*)"glPathGlyphIndexArrayNV");
+  return glPathGlyphIndexArrayNV(firstPathName, fontTarget, fontName, fontStyle, firstGlyphIndex, numGlyphs, pathParameterTemplate, emScale);
+}
+
+static GLenum GLAPIENTRY _glewLazy_glPathGlyphIndexRangeNV (GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLuint pathParameterTemplate, GLfloat emScale, GLuint baseAndCount[2])
+{
+  glPathGlyphIndexRangeNV = (PFNGLPATHGLYPHINDEXRANGENVPROC)glewGetProcAddress((const GLubyte*)"glPathGlyphIndexRangeNV");
+  return glPathGlyphIndexRangeNV(fontTarget, fontName, fontStyle, pathParameterTemplate, emScale, baseAndCount);
+}
+
+static void GLAPIENTRY _glewLazy_glPathGlyphRangeNV (GLuint firstPathName, GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLuint firstGlyph, GLsizei numGlyphs, GLenum handleMissingGlyphs, GLuint pathParameterTemplate, GLfloat emScale)
+{
+  glPathGlyphRangeNV = (PFNGLPATHGLYPHRANGENVPROC)glewGetProcAddress((const GLubyte*)"glPathGlyphRangeNV");
+  glPathGlyphRangeNV(firstPathName, fontTarget, fontName, fontStyle, firstGlyph, numGlyphs, handleMissingGlyphs, pathParameterTemplate, emScale);
+}
+
+static void GLAPIENTRY _glewLazy_glPathGlyphsNV (GLuint firstPathName, GLenum fontTarget, const void *fontName, GLbitfield fontStyle, GLsizei numGlyphs, GLenum type, const void*charcodes, GLenum handleMissingGlyphs, GLuint pathParameterTemplate, GLfloat emScale)
+{
+  glPathGlyphsNV = (PFNGLPATHGLYPHSNVPROC)glewGetProcAddress((const GLubyte*)"glPathGlyphsNV");
+  glPathGlyphsNV(firstPathName, fontTarget, fontName, fontStyle, numGlyphs, type, charcodes, handleMissingGlyphs, pathParameterTemplate, emScale);
+}
+
+static GLenum GLAPIENTRY _glewLazy_glPathMemoryGlyphIndexArrayNV (GLuint firstPathName, GLenum fontTarget, GLsizeiptr fontSize, const void *fontData, GLsizei faceIndex, GLuint firstGlyphIndex, GLsizei numGlyphs, GLuint pathParameterTemplate, GLfloat emScale)
+{
+  glPathMemoryGlyphIndexArrayNV = (PFNGLPATHMEMORYGLYPHINDEXARRAYNVPROC)glewGetProcAddress((const GLubyte*)"glPathMemoryGlyphIndexArrayNV");
+  return glPathMemoryGlyphIndexArrayNV(firstPathName, fontTarget, fontSize, fontData, faceIndex, firstGlyphIndex, numGlyphs, pathParameterTemplate, emScale);
+}
+
+static void GLAPIENTRY _glewLazy_glPathParameterfNV (GLuint path, GLenum pname, GLfloat value)
+{
+  glPathParameterfNV = (PFNGLPATHPARAMETERFNVPROC)glewGetProcAddress((const GLubyte*)"glPathParameterfNV");
+  glPathParameterfNV(path, pname, value);
+}
+
+static void GLAPIENTRY _glewLazy_glPathParameterfvNV (GLuint path, GLenum pname, const GLfloat* value)
+{
+  glPathParameterfvNV = (PFNGLPATHPARAMETERFVNVPROC)glewGetProcAddress((const GLubyte*)"glPathParameterfvNV");
+  glPathParameterfvNV(path, pname, value);
+}
+
+static void GLAPIENTRY _glewLazy_glPathParameteriNV (GLuint path, GLenum pname, GLint value)
+{
+  glPathParameteriNV = (PFNGLPATHPARAMETERINVPROC)glewGetProcAddress((const GLubyte*)"glPathParameteriNV");
+  glPathParameteriNV(path, pname, value);
+}
+
+static void GLAPIENTRY _glewLazy_glPathParameterivNV (GLuint path, GLenum pname, const GLint* value)
+{
+  glPathParameterivNV = (PFNGLPATHPARAMETERIVNVPROC)glewGetProcAddress((const GLubyte*)"glPathParameterivNV");
+  glPathParameterivNV(path, pname, value);
+}
+
+static void GLAPIENTRY _glewLazy_glPathStencilDepthOffsetNV (GLfloat factor, GLfloat units)
+{
+  glPathStencilDepthOffsetNV = (PFNGLPATHSTENCILDEPTHOFFSETNVPROC)glewGetProcAddress((const GLubyte*)"glPathStencilDepthOffsetNV");
+  glPathStencilDepthOffsetNV(factor, units);
+}
+
+static void GLAPIENTRY _glewLazy_glPathStencilFuncNV (GLenum func, GLint ref, GLuint mask)
+{
+  glPathStencilFuncNV = (PFNGLPATHSTENCILFUNCNVPROC)glewGetProcAddress((const GLubyte*)"glPathStencilFuncNV");
+  glPathStencilFuncNV(func, ref, mask);
+}
+
+static void GLAPIENTRY _glewLazy_glPathStringNV (GLuint path, GLenum format, GLsizei length, const void *pathString)
+{
+  glPathStringNV = (PFNGLPATHSTRINGNVPROC)glewGetProcAddress((const GLubyte*)"glPathStringNV");
+  glPathStringNV(path, format, length, pathString);
+}
+
+static void GLAPIENTRY _glewLazy_glPathSubCommandsNV (GLuint path, GLsizei commandStart, GLsizei commandsToDelete, GLsizei numCommands, const GLubyte* commands, GLsizei numCoords, GLenum coordType, const void*coords)
+{
+  glPathSubCommandsNV = (PFNGLPATHSUBCOMMANDSNVPROC)glewGetProcAddress((const GLubyte*)"glPathSubCommandsNV");
+  glPathSubCommandsNV(path, commandStart, commandsToDelete, numCommands, commands, numCoords, coordType, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glPathSubCoordsNV (GLuint path, GLsizei coordStart, GLsizei numCoords, GLenum coordType, const void *coords)
+{
+  glPathSubCoordsNV = (PFNGLPATHSUBCOORDSNVPROC)glewGetProcAddress((const GLubyte*)"glPathSubCoordsNV");
+  glPathSubCoordsNV(path, coordStart, numCoords, coordType, coords);
+}
+
+static void GLAPIENTRY _glewLazy_glPathTexGenNV (GLenum texCoordSet, GLenum genMode, GLint components, const GLfloat* coeffs)
+{
+  glPathTexGenNV = (PFNGLPATHTEXGENNVPROC)glewGetProcAddress((const GLubyte*)"glPathTexGenNV");
+  glPathTexGenNV(texCoordSet, genMode, components, coeffs);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glPointAlongPathNV (GLuint path, GLsizei startSegment, GLsizei numSegments, GLfloat distance, GLfloat* x, GLfloat *y, GLfloat *tangentX, GLfloat *tangentY)
+{
+  glPointAlongPathNV = (PFNGLPOINTALONGPATHNVPROC)glewGetProcAddress((const GLubyte*)"glPointAlongPathNV");
+  return glPointAlongPathNV(path, startSegment, numSegments, distance, x, y, tangentX, tangentY);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramPathFragmentInputGenNV (GLuint program, GLint location, GLenum genMode, GLint components, const GLfloat* coeffs)
+{
+  glProgramPathFragmentInputGenNV = (PFNGLPROGRAMPATHFRAGMENTINPUTGENNVPROC)glewGetProcAddress((const GLubyte*)"glProgramPathFragmentInputGenNV");
+  glProgramPathFragmentInputGenNV(program, location, genMode, components, coeffs);
+}
+
+static void GLAPIENTRY _glewLazy_glStencilFillPathInstancedNV (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum fillMode, GLuint mask, GLenum transformType, const GLfloat *transformValues)
+{
+  glStencilFillPathInstancedNV = (PFNGLSTENCILFILLPATHINSTANCEDNVPROC)glewGetProcAddress((const GLubyte*)"glStencilFillPathInstancedNV");
+  glStencilFillPathInstancedNV(numPaths, pathNameType, paths, pathBase, fillMode, mask, transformType, transformValues);
+}
+
+static void GLAPIENTRY _glewLazy_glStencilFillPathNV (GLuint path, GLenum fillMode, GLuint mask)
+{
+  glStencilFillPathNV = (PFNGLSTENCILFILLPATHNVPROC)glewGetProcAddress((const GLubyte*)"glStencilFillPathNV");
+  glStencilFillPathNV(path, fillMode, mask);
+}
+
+static void GLAPIENTRY _glewLazy_glStencilStrokePathInstancedNV (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLint reference, GLuint mask, GLenum transformType, const GLfloat *transformValues)
+{
+  glStencilStrokePathInstancedNV = (PFNGLSTENCILSTROKEPATHINSTANCEDNVPROC)glewGetProcAddress((const GLubyte*)"glStencilStrokePathInstancedNV");
+  glStencilStrokePathInstancedNV(numPaths, pathNameType, paths, pathBase, reference, mask, transformType, transformValues);
+}
+
+static void GLAPIENTRY _glewLazy_glStencilStrokePathNV (GLuint path, GLint reference, GLuint mask)
+{
+  glStencilStrokePathNV = (PFNGLSTENCILSTROKEPATHNVPROC)glewGetProcAddress((const GLubyte*)"glStencilStrokePathNV");
+  glStencilStrokePathNV(path, reference, mask);
+}
+
+static void GLAPIENTRY _glewLazy_glStencilThenCoverFillPathInstancedNV (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLenum fillMode, GLuint mask, GLenum coverMode, GLenum transformType, const GLfloat *transformValues)
+{
+  glStencilThenCoverFillPathInstancedNV = (PFNGLSTENCILTHENCOVERFILLPATHINSTANCEDNVPROC)glewGetProcAddress((const GLubyte*)"glStencilThenCoverFillPathInstancedNV");
+  glStencilThenCoverFillPathInstancedNV(numPaths, pathNameType, paths, pathBase, fillMode, mask, coverMode, transformType, transformValues);
+}
+
+static void GLAPIENTRY _glewLazy_glStencilThenCoverFillPathNV (GLuint path, GLenum fillMode, GLuint mask, GLenum coverMode)
+{
+  glStencilThenCoverFillPathNV = (PFNGLSTENCILTHENCOVERFILLPATHNVPROC)glewGetProcAddress((const GLubyte*)"glStencilThenCoverFillPathNV");
+  glStencilThenCoverFillPathNV(path, fillMode, mask, coverMode);
+}
+
+static void GLAPIENTRY _glewLazy_glStencilThenCoverStrokePathInstancedNV (GLsizei numPaths, GLenum pathNameType, const void *paths, GLuint pathBase, GLint reference, GLuint mask, GLenum coverMode, GLenum transformType, const GLfloat *transformValues)
+{
+  glStencilThenCoverStrokePathInstancedNV = (PFNGLSTENCILTHENCOVERSTROKEPATHINSTANCEDNVPROC)glewGetProcAddress((const GLubyte*)"glStencilThenCoverStrokePathInstancedNV");
+  glStencilThenCoverStrokePathInstancedNV(numPaths, pathNameType, paths, pathBase, reference, mask, coverMode, transformType, transformValues);
+}
+
+static void GLAPIENTRY _glewLazy_glStencilThenCoverStrokePathNV (GLuint path, GLint reference, GLuint mask, GLenum coverMode)
+{
+  glStencilThenCoverStrokePathNV = (PFNGLSTENCILTHENCOVERSTROKEPATHNVPROC)glewGetProcAddress((const GLubyte*)"glStencilThenCoverStrokePathNV");
+  glStencilThenCoverStrokePathNV(path, reference, mask, coverMode);
+}
+
+static void GLAPIENTRY _glewLazy_glTransformPathNV (GLuint resultPath, GLuint srcPath, GLenum transformType, const GLfloat* transformValues)
+{
+  glTransformPathNV = (PFNGLTRANSFORMPATHNVPROC)glewGetProcAddress((const GLubyte*)"glTransformPathNV");
+  glTransformPathNV(resultPath, srcPath, transformType, transformValues);
+}
+
+static void GLAPIENTRY _glewLazy_glWeightPathsNV (GLuint resultPath, GLsizei numPaths, const GLuint paths[], const GLfloat weights[])
+{
+  glWeightPathsNV = (PFNGLWEIGHTPATHSNVPROC)glewGetProcAddress((const GLubyte*)"glWeightPathsNV");
+  glWeightPathsNV(resultPath, numPaths, paths, weights);
+}
+
+
+static void GLAPIENTRY _glewLazy_glFlushPixelDataRangeNV (GLenum target)
+{
+  glFlushPixelDataRangeNV = (PFNGLFLUSHPIXELDATARANGENVPROC)glewGetProcAddress((const GLubyte*)"glFlushPixelDataRangeNV");
+  glFlushPixelDataRangeNV(target);
+}
+
+static void GLAPIENTRY _glewLazy_glPixelDataRangeNV (GLenum target, GLsizei length, void *pointer)
+{
+  glPixelDataRangeNV = (PFNGLPIXELDATARANGENVPROC)glewGetProcAddress((const GLubyte*)"glPixelDataRangeNV");
+  glPixelDataRangeNV(target, length, pointer);
+}
+
+
+static void GLAPIENTRY _glewLazy_glPointParameteriNV (GLenum pname, GLint param)
+{
+  glPointParameteriNV = (PFNGLPOINTPARAMETERINVPROC)glewGetProcAddress((const GLubyte*)"glPointParameteriNV");
+  glPointParameteriNV(pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glPointParameterivNV (GLenum pname, const GLint* params)
+{
+  glPointParameterivNV = (PFNGLPOINTPARAMETERIVNVPROC)glewGetProcAddress((const GLubyte*)"glPointParameterivNV");
+  glPointParameterivNV(pname, params);
+}
+
+
+static void GLAPIENTRY _glewLazy_glGetVideoi64vNV (GLuint video_slot, GLenum pname, GLint64EXT* params)
+{
+  glGetVideoi64vNV = (PFNGLGETVIDEOI64VNVPROC)glewGetProcAddress((const GLubyte*)"glGetVideoi64vNV");
+  glGetVideoi64vNV(video_slot, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVideoivNV (GLuint video_slot, GLenum pname, GLint* params)
+{
+  glGetVideoivNV = (PFNGLGETVIDEOIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetVideoivNV");
+  glGetVideoivNV(video_slot, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVideoui64vNV (GLuint video_slot, GLenum pname, GLuint64EXT* params)
+{
+  glGetVideoui64vNV = (PFNGLGETVIDEOUI64VNVPROC)glewGetProcAddress((const GLubyte*)"glGetVideoui64vNV");
+  glGetVideoui64vNV(video_slot, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVideouivNV (GLuint video_slot, GLenum pname, GLuint* params)
+{
+  glGetVideouivNV = (PFNGLGETVIDEOUIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetVideouivNV");
+  glGetVideouivNV(video_slot, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glPresentFrameDualFillNV (GLuint video_slot, GLuint64EXT minPresentTime, GLuint beginPresentTimeId, GLuint presentDurationId, GLenum type, GLenum target0, GLuint fill0, GLenum target1, GLuint fill1, GLenum target2, GLuint fill2, GLenum target3, GLuint fill3)
+{
+  glPresentFrameDualFillNV = (PFNGLPRESENTFRAMEDUALFILLNVPROC)glewGetProcAddress((const GLubyte*)"glPresentFrameDualFillNV");
+  glPresentFrameDualFillNV(video_slot, minPresentTime, beginPresentTimeId, presentDurationId, type, target0, fill0, target1, fill1, target2, fill2, target3, fill3);
+}
+
+static void GLAPIENTRY _glewLazy_glPresentFrameKeyedNV (GLuint video_slot, GLuint64EXT minPresentTime, GLuint beginPresentTimeId, GLuint presentDurationId, GLenum type, GLenum target0, GLuint fill0, GLuint key0, GLenum target1, GLuint fill1, GLuint key1)
+{
+  glPresentFrameKeyedNV = (PFNGLPRESENTFRAMEKEYEDNVPROC)glewGetProcAddress((const GLubyte*)"glPresentFrameKeyedNV");
+  glPresentFrameKeyedNV(video_slot, minPresentTime, beginPresentTimeId, presentDurationId, type, target0, fill0, key0, target1, fill1, key1);
+}
+
+
+static void GLAPIENTRY _glewLazy_glPrimitiveRestartIndexNV (GLuint index)
+{
+  glPrimitiveRestartIndexNV = (PFNGLPRIMITIVERESTARTINDEXNVPROC)glewGetProcAddress((const GLubyte*)"glPrimitiveRestartIndexNV");
+  glPrimitiveRestartIndexNV(index);
+}
+
+static void GLAPIENTRY _glewLazy_glPrimitiveRestartNV (void)
+{
+  glPrimitiveRestartNV = (PFNGLPRIMITIVERESTARTNVPROC)glewGetProcAddress((const GLubyte*)"glPrimitiveRestartNV");
+  glPrimitiveRestartNV();
+}
+
+
+static void GLAPIENTRY _glewLazy_glCombinerInputNV (GLenum stage, GLenum portion, GLenum variable, GLenum input, GLenum mapping, GLenum componentUsage)
+{
+  glCombinerInputNV = (PFNGLCOMBINERINPUTNVPROC)glewGetProcAddress((const GLubyte*)"glCombinerInputNV");
+  glCombinerInputNV(stage, portion, variable, input, mapping, componentUsage);
+}
+
+static void GLAPIENTRY _glewLazy_glCombinerOutputNV (GLenum stage, GLenum portion, GLenum abOutput, GLenum cdOutput, GLenum sumOutput, GLenum scale, GLenum bias, GLboolean abDotProduct, GLboolean cdDotProduct, GLboolean muxSum)
+{
+  glCombinerOutputNV = (PFNGLCOMBINEROUTPUTNVPROC)glewGetProcAddress((const GLubyte*)"glCombinerOutputNV");
+  glCombinerOutputNV(stage, portion, abOutput, cdOutput, sumOutput, scale, bias, abDotProduct, cdDotProduct, muxSum);
+}
+
+static void GLAPIENTRY _glewLazy_glCombinerParameterfNV (GLenum pname, GLfloat param)
+{
+  glCombinerParameterfNV = (PFNGLCOMBINERPARAMETERFNVPROC)glewGetProcAddress((const GLubyte*)"glCombinerParameterfNV");
+  glCombinerParameterfNV(pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glCombinerParameterfvNV (GLenum pname, const GLfloat* params)
+{
+  glCombinerParameterfvNV = (PFNGLCOMBINERPARAMETERFVNVPROC)glewGetProcAddress((const GLubyte*)"glCombinerParameterfvNV");
+  glCombinerParameterfvNV(pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glCombinerParameteriNV (GLenum pname, GLint param)
+{
+  glCombinerParameteriNV = (PFNGLCOMBINERPARAMETERINVPROC)glewGetProcAddress((const GLubyte*)"glCombinerParameteriNV");
+  glCombinerParameteriNV(pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glCombinerParameterivNV (GLenum pname, const GLint* params)
+{
+  glCombinerParameterivNV = (PFNGLCOMBINERPARAMETERIVNVPROC)glewGetProcAddress((const GLubyte*)"glCombinerParameterivNV");
+  glCombinerParameterivNV(pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glFinalCombinerInputNV (GLenum variable, GLenum input, GLenum mapping, GLenum componentUsage)
+{
+  glFinalCombinerInputNV = (PFNGLFINALCOMBINERINPUTNVPROC)glewGetProcAddress((const GLubyte*)"glFinalCombinerInputNV");
+  glFinalCombinerInputNV(variable, input, mapping, componentUsage);
+}
+
+static void GLAPIENTRY _glewLazy_glGetCombinerInputParameterfvNV (GLenum stage, GLenum portion, GLenum variable, GLenum pname, GLfloat* params)
+{
+  glGetCombinerInputParameterfvNV = (PFNGLGETCOMBINERINPUTPARAMETERFVNVPROC)glewGetProcAddress((const GLubyte*)"glGetCombinerInputParameterfvNV");
+  glGetCombinerInputParameterfvNV(stage, portion, variable, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetCombinerInputParameterivNV (GLenum stage, GLenum portion, GLenum variable, GLenum pname, GLint* params)
+{
+  glGetCombinerInputParameterivNV = (PFNGLGETCOMBINERINPUTPARAMETERIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetCombinerInputParameterivNV");
+  glGetCombinerInputParameterivNV(stage, portion, variable, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetCombinerOutputParameterfvNV (GLenum stage, GLenum portion, GLenum pname, GLfloat* params)
+{
+  glGetCombinerOutputParameterfvNV = (PFNGLGETCOMBINEROUTPUTPARAMETERFVNVPROC)glewGetProcAddress((const GLubyte*)"glGetCombinerOutputParameterfvNV");
+  glGetCombinerOutputParameterfvNV(stage, portion, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetCombinerOutputParameterivNV (GLenum stage, GLenum portion, GLenum pname, GLint* params)
+{
+  glGetCombinerOutputParameterivNV = (PFNGLGETCOMBINEROUTPUTPARAMETERIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetCombinerOutputParameterivNV");
+  glGetCombinerOutputParameterivNV(stage, portion, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFinalCombinerInputParameterfvNV (GLenum variable, GLenum pname, GLfloat* params)
+{
+  glGetFinalCombinerInputParameterfvNV = (PFNGLGETFINALCOMBINERINPUTPARAMETERFVNVPROC)glewGetProcAddress((const GLubyte*)"glGetFinalCombinerInputParameterfvNV");
+  glGetFinalCombinerInputParameterfvNV(variable, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFinalCombinerInputParameterivNV (GLenum variable, GLenum pname, GLint* params)
+{
+  glGetFinalCombinerInputParameterivNV = (PFNGLGETFINALCOMBINERINPUTPARAMETERIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetFinalCombinerInputParameterivNV");
+  glGetFinalCombinerInputParameterivNV(variable, pname, params);
+}
+
+
+static void GLAPIENTRY _glewLazy_glCombinerStageParameterfvNV (GLenum stage, GLenum pname, const GLfloat* params)
+{
+  glCombinerStageParameterfvNV = (PFNGLCOMBINERSTAGEPARAMETERFVNVPROC)glewGetProcAddress((const GLubyte*)"glCombinerStageParameterfvNV");
+  glCombinerStageParameterfvNV(stage, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetCombinerStageParameterfvNV (GLenum stage, GLenum pname, GLfloat* params)
+{
+  glGetCombinerStageParameterfvNV = (PFNGLGETCOMBINERSTAGEPARAMETERFVNVPROC)glewGetProcAddress((const GLubyte*)"glGetCombinerStageParameterfvNV");
+  glGetCombinerStageParameterfvNV(stage, pname, params);
+}
+
+
+static void GLAPIENTRY _glewLazy_glFramebufferSampleLocationsfvNV (GLenum target, GLuint start, GLsizei count, const GLfloat* v)
+{
+  glFramebufferSampleLocationsfvNV = (PFNGLFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)glewGetProcAddress((const GLubyte*)"glFramebufferSampleLocationsfvNV");
+  glFramebufferSampleLocationsfvNV(target, start, count, v);
+}
+
+static void GLAPIENTRY _glewLazy_glNamedFramebufferSampleLocationsfvNV (GLuint framebuffer, GLuint start, GLsizei count, const GLfloat* v)
+{
+  glNamedFramebufferSampleLocationsfvNV = (PFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVNVPROC)glewGetProcAddress((const GLubyte*)"glNamedFramebufferSampleLocationsfvNV");
+  glNamedFramebufferSampleLocationsfvNV(framebuffer, start, count, v);
+}
+
+
+static void GLAPIENTRY _glewLazy_glGetBufferParameterui64vNV (GLenum target, GLenum pname, GLuint64EXT* params)
+{
+  glGetBufferParameterui64vNV = (PFNGLGETBUFFERPARAMETERUI64VNVPROC)glewGetProcAddress((const GLubyte*)"glGetBufferParameterui64vNV");
+  glGetBufferParameterui64vNV(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetIntegerui64vNV (GLenum value, GLuint64EXT* result)
+{
+  glGetIntegerui64vNV = (PFNGLGETINTEGERUI64VNVPROC)glewGetProcAddress((const GLubyte*)"glGetIntegerui64vNV");
+  glGetIntegerui64vNV(value, result);
+}
+
+static void GLAPIENTRY _glewLazy_glGetNamedBufferParameterui64vNV (GLuint buffer, GLenum pname, GLuint64EXT* params)
+{
+  glGetNamedBufferParameterui64vNV = (PFNGLGETNAMEDBUFFERPARAMETERUI64VNVPROC)glewGetProcAddress((const GLubyte*)"glGetNamedBufferParameterui64vNV");
+  glGetNamedBufferParameterui64vNV(buffer, pname, params);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsBufferResidentNV (GLenum target)
+{
+  glIsBufferResidentNV = (PFNGLISBUFFERRESIDENTNVPROC)glewGetProcAddress((const GLubyte*)"glIsBufferResidentNV");
+  return glIsBufferResidentNV(target);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsNamedBufferResidentNV (GLuint buffer)
+{
+  glIsNamedBufferResidentNV = (PFNGLISNAMEDBUFFERRESIDENTNVPROC)glewGetProcAddress((const GLubyte*)"glIsNamedBufferResidentNV");
+  return glIsNamedBufferResidentNV(buffer);
+}
+
+static void GLAPIENTRY _glewLazy_glMakeBufferNonResidentNV (GLenum target)
+{
+  glMakeBufferNonResidentNV = (PFNGLMAKEBUFFERNONRESIDENTNVPROC)glewGetProcAddress((const GLubyte*)"glMakeBufferNonResidentNV");
+  glMakeBufferNonResidentNV(target);
+}
+
+static void GLAPIENTRY _glewLazy_glMakeBufferResidentNV (GLenum target, GLenum access)
+{
+  glMakeBufferResidentNV = (PFNGLMAKEBUFFERRESIDENTNVPROC)glewGetProcAddress((const GLubyte*)"glMakeBufferResidentNV");
+  glMakeBufferResidentNV(target, access);
+}
+
+static void GLAPIENTRY _glewLazy_glMakeNamedBufferNonResidentNV (GLuint buffer)
+{
+  glMakeNamedBufferNonResidentNV = (PFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC)glewGetProcAddress((const GLubyte*)"glMakeNamedBufferNonResidentNV");
+  glMakeNamedBufferNonResidentNV(buffer);
+}
+
+static void GLAPIENTRY _glewLazy_glMakeNamedBufferResidentNV (GLuint buffer, GLenum access)
+{
+  glMakeNamedBufferResidentNV = (PFNGLMAKENAMEDBUFFERRESIDENTNVPROC)glewGetProcAddress((const GLubyte*)"glMakeNamedBufferResidentNV");
+  glMakeNamedBufferResidentNV(buffer, access);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformui64NV (GLuint program, GLint location, GLuint64EXT value)
+{
+  glProgramUniformui64NV = (PFNGLPROGRAMUNIFORMUI64NVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformui64NV");
+  glProgramUniformui64NV(program, location, value);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramUniformui64vNV (GLuint program, GLint location, GLsizei count, const GLuint64EXT* value)
+{
+  glProgramUniformui64vNV = (PFNGLPROGRAMUNIFORMUI64VNVPROC)glewGetProcAddress((const GLubyte*)"glProgramUniformui64vNV");
+  glProgramUniformui64vNV(program, location, count, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformui64NV (GLint location, GLuint64EXT value)
+{
+  glUniformui64NV = (PFNGLUNIFORMUI64NVPROC)glewGetProcAddress((const GLubyte*)"glUniformui64NV");
+  glUniformui64NV(location, value);
+}
+
+static void GLAPIENTRY _glewLazy_glUniformui64vNV (GLint location, GLsizei count, const GLuint64EXT* value)
+{
+  glUniformui64vNV = (PFNGLUNIFORMUI64VNVPROC)glewGetProcAddress((const GLubyte*)"glUniformui64vNV");
+  glUniformui64vNV(location, count, value);
+}
+
+
+static void GLAPIENTRY _glewLazy_glTextureBarrierNV (void)
+{
+  glTextureBarrierNV = (PFNGLTEXTUREBARRIERNVPROC)glewGetProcAddress((const GLubyte*)"glTextureBarrierNV");
+  glTextureBarrierNV();
+}
+
+
+static void GLAPIENTRY _glewLazy_glTexImage2DMultisampleCoverageNV (GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations)
+{
+  glTexImage2DMultisampleCoverageNV = (PFNGLTEXIMAGE2DMULTISAMPLECOVERAGENVPROC)glewGetProcAddress((const GLubyte*)"glTexImage2DMultisampleCoverageNV");
+  glTexImage2DMultisampleCoverageNV(target, coverageSamples, colorSamples, internalFormat, width, height, fixedSampleLocations);
+}
+
+static void GLAPIENTRY _glewLazy_glTexImage3DMultisampleCoverageNV (GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations)
+{
+  glTexImage3DMultisampleCoverageNV = (PFNGLTEXIMAGE3DMULTISAMPLECOVERAGENVPROC)glewGetProcAddress((const GLubyte*)"glTexImage3DMultisampleCoverageNV");
+  glTexImage3DMultisampleCoverageNV(target, coverageSamples, colorSamples, internalFormat, width, height, depth, fixedSampleLocations);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureImage2DMultisampleCoverageNV (GLuint texture, GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations)
+{
+  glTextureImage2DMultisampleCoverageNV = (PFNGLTEXTUREIMAGE2DMULTISAMPLECOVERAGENVPROC)glewGetProcAddress((const GLubyte*)"glTextureImage2DMultisampleCoverageNV");
+  glTextureImage2DMultisampleCoverageNV(texture, target, coverageSamples, colorSamples, internalFormat, width, height, fixedSampleLocations);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureImage2DMultisampleNV (GLuint texture, GLenum target, GLsizei samples, GLint internalFormat, GLsizei width, GLsizei height, GLboolean fixedSampleLocations)
+{
+  glTextureImage2DMultisampleNV = (PFNGLTEXTUREIMAGE2DMULTISAMPLENVPROC)glewGetProcAddress((const GLubyte*)"glTextureImage2DMultisampleNV");
+  glTextureImage2DMultisampleNV(texture, target, samples, internalFormat, width, height, fixedSampleLocations);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureImage3DMultisampleCoverageNV (GLuint texture, GLenum target, GLsizei coverageSamples, GLsizei colorSamples, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations)
+{
+  glTextureImage3DMultisampleCoverageNV = (PFNGLTEXTUREIMAGE3DMULTISAMPLECOVERAGENVPROC)glewGetProcAddress((const GLubyte*)"glTextureImage3DMultisampleCoverageNV");
+  glTextureImage3DMultisampleCoverageNV(texture, target, coverageSamples, colorSamples, internalFormat, width, height, depth, fixedSampleLocations);
+}
+
+static void GLAPIENTRY _glewLazy_glTextureImage3DMultisampleNV (GLuint texture, GLenum target, GLsizei samples, GLint internalFormat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedSampleLocations)
+{
+  glTextureImage3DMultisampleNV = (PFNGLTEXTUREIMAGE3DMULTISAMPLENVPROC)glewGetProcAddress((const GLubyte*)"glTextureImage3DMultisampleNV");
+  glTextureImage3DMultisampleNV(texture, target, samples, internalFormat, width, height, depth, fixedSampleLocations);
+}
+
+
+static void GLAPIENTRY _glewLazy_glActiveVaryingNV (GLuint program, const GLchar *name)
+{
+  glActiveVaryingNV = (PFNGLACTIVEVARYINGNVPROC)glewGetProcAddress((const GLubyte*)"glActiveVaryingNV");
+  glActiveVaryingNV(program, name);
+}
+
+static void GLAPIENTRY _glewLazy_glBeginTransformFeedbackNV (GLenum primitiveMode)
+{
+  glBeginTransformFeedbackNV = (PFNGLBEGINTRANSFORMFEEDBACKNVPROC)glewGetProcAddress((const GLubyte*)"glBeginTransformFeedbackNV");
+  glBeginTransformFeedbackNV(primitiveMode);
+}
+
+static void GLAPIENTRY _glewLazy_glBindBufferBaseNV (GLenum target, GLuint index, GLuint buffer)
+{
+  glBindBufferBaseNV = (PFNGLBINDBUFFERBASENVPROC)glewGetProcAddress((const GLubyte*)"glBindBufferBaseNV");
+  glBindBufferBaseNV(target, index, buffer);
+}
+
+static void GLAPIENTRY _glewLazy_glBindBufferOffsetNV (GLenum target, GLuint index, GLuint buffer, GLintptr offset)
+{
+  glBindBufferOffsetNV = (PFNGLBINDBUFFEROFFSETNVPROC)glewGetProcAddress((const GLubyte*)"glBindBufferOffsetNV");
+  glBindBufferOffsetNV(target, index, buffer, offset);
+}
+
+static void GLAPIENTRY _glewLazy_glBindBufferRangeNV (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+{
+  glBindBufferRangeNV = (PFNGLBINDBUFFERRANGENVPROC)glewGetProcAddress((const GLubyte*)"glBindBufferRangeNV");
+  glBindBufferRangeNV(target, index, buffer, offset, size);
+}
+
+static void GLAPIENTRY _glewLazy_glEndTransformFeedbackNV (void)
+{
+  glEndTransformFeedbackNV = (PFNGLENDTRANSFORMFEEDBACKNVPROC)glewGetProcAddress((const GLubyte*)"glEndTransformFeedbackNV");
+  glEndTransformFeedbackNV();
+}
+
+static void GLAPIENTRY _glewLazy_glGetActiveVaryingNV (GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name)
+{
+  glGetActiveVaryingNV = (PFNGLGETACTIVEVARYINGNVPROC)glewGetProcAddress((const GLubyte*)"glGetActiveVaryingNV");
+  glGetActiveVaryingNV(program, index, bufSize, length, size, type, name);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTransformFeedbackVaryingNV (GLuint program, GLuint index, GLint *location)
+{
+  glGetTransformFeedbackVaryingNV = (PFNGLGETTRANSFORMFEEDBACKVARYINGNVPROC)glewGetProcAddress((const GLubyte*)"glGetTransformFeedbackVaryingNV");
+  glGetTransformFeedbackVaryingNV(program, index, location);
+}
+
+static GLint GLAPIENTRY _glewLazy_glGetVaryingLocationNV (GLuint program, const GLchar *name)
+{
+  glGetVaryingLocationNV = (PFNGLGETVARYINGLOCATIONNVPROC)glewGetProcAddress((const GLubyte*)"glGetVaryingLocationNV");
+  return glGetVaryingLocationNV(program, name);
+}
+
+static void GLAPIENTRY _glewLazy_glTransformFeedbackAttribsNV (GLuint count, const GLint *attribs, GLenum bufferMode)
+{
+  glTransformFeedbackAttribsNV = (PFNGLTRANSFORMFEEDBACKATTRIBSNVPROC)glewGetProcAddress((const GLubyte*)"glTransformFeedbackAttribsNV");
+  glTransformFeedbackAttribsNV(count, attribs, bufferMode);
+}
+
+static void GLAPIENTRY _glewLazy_glTransformFeedbackVaryingsNV (GLuint program, GLsizei count, const GLint *locations, GLenum bufferMode)
+{
+  glTransformFeedbackVaryingsNV = (PFNGLTRANSFORMFEEDBACKVARYINGSNVPROC)glewGetProcAddress((const GLubyte*)"glTransformFeedbackVaryingsNV");
+  glTransformFeedbackVaryingsNV(program, count, locations, bufferMode);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBindTransformFeedbackNV (GLenum target, GLuint id)
+{
+  glBindTransformFeedbackNV = (PFNGLBINDTRANSFORMFEEDBACKNVPROC)glewGetProcAddress((const GLubyte*)"glBindTransformFeedbackNV");
+  glBindTransformFeedbackNV(target, id);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteTransformFeedbacksNV (GLsizei n, const GLuint* ids)
+{
+  glDeleteTransformFeedbacksNV = (PFNGLDELETETRANSFORMFEEDBACKSNVPROC)glewGetProcAddress((const GLubyte*)"glDeleteTransformFeedbacksNV");
+  glDeleteTransformFeedbacksNV(n, ids);
+}
+
+static void GLAPIENTRY _glewLazy_glDrawTransformFeedbackNV (GLenum mode, GLuint id)
+{
+  glDrawTransformFeedbackNV = (PFNGLDRAWTRANSFORMFEEDBACKNVPROC)glewGetProcAddress((const GLubyte*)"glDrawTransformFeedbackNV");
+  glDrawTransformFeedbackNV(mode, id);
+}
+
+static void GLAPIENTRY _glewLazy_glGenTransformFeedbacksNV (GLsizei n, GLuint* ids)
+{
+  glGenTransformFeedbacksNV = (PFNGLGENTRANSFORMFEEDBACKSNVPROC)glewGetProcAddress((const GLubyte*)"glGenTransformFeedbacksNV");
+  glGenTransformFeedbacksNV(n, ids);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsTransformFeedbackNV (GLuint id)
+{
+  glIsTransformFeedbackNV = (PFNGLISTRANSFORMFEEDBACKNVPROC)glewGetProcAddress((const GLubyte*)"glIsTransformFeedbackNV");
+  return glIsTransformFeedbackNV(id);
+}
+
+static void GLAPIENTRY _glewLazy_glPauseTransformFeedbackNV (void)
+{
+  glPauseTransformFeedbackNV = (PFNGLPAUSETRANSFORMFEEDBACKNVPROC)glewGetProcAddress((const GLubyte*)"glPauseTransformFeedbackNV");
+  glPauseTransformFeedbackNV();
+}
+
+static void GLAPIENTRY _glewLazy_glResumeTransformFeedbackNV (void)
+{
+  glResumeTransformFeedbackNV = (PFNGLRESUMETRANSFORMFEEDBACKNVPROC)glewGetProcAddress((const GLubyte*)"glResumeTransformFeedbackNV");
+  glResumeTransformFeedbackNV();
+}
+
+
+static void GLAPIENTRY _glewLazy_glVDPAUFiniNV (void)
+{
+  glVDPAUFiniNV = (PFNGLVDPAUFININVPROC)glewGetProcAddress((const GLubyte*)"glVDPAUFiniNV");
+  glVDPAUFiniNV();
+}
+
+static void GLAPIENTRY _glewLazy_glVDPAUGetSurfaceivNV (GLvdpauSurfaceNV surface, GLenum pname, GLsizei bufSize, GLsizei* length, GLint *values)
+{
+  glVDPAUGetSurfaceivNV = (PFNGLVDPAUGETSURFACEIVNVPROC)glewGetProcAddress((const GLubyte*)"glVDPAUGetSurfaceivNV");
+  glVDPAUGetSurfaceivNV(surface, pname, bufSize, length, values);
+}
+
+static void GLAPIENTRY _glewLazy_glVDPAUInitNV (const void* vdpDevice, const void*getProcAddress)
+{
+  glVDPAUInitNV = (PFNGLVDPAUINITNVPROC)glewGetProcAddress((const GLubyte*)"glVDPAUInitNV");
+  glVDPAUInitNV(vdpDevice, getProcAddress);
+}
+
+static void GLAPIENTRY _glewLazy_glVDPAUIsSurfaceNV (GLvdpauSurfaceNV surface)
+{
+  glVDPAUIsSurfaceNV = (PFNGLVDPAUISSURFACENVPROC)glewGetProcAddress((const GLubyte*)"glVDPAUIsSurfaceNV");
+  glVDPAUIsSurfaceNV(surface);
+}
+
+static void GLAPIENTRY _glewLazy_glVDPAUMapSurfacesNV (GLsizei numSurfaces, const GLvdpauSurfaceNV* surfaces)
+{
+  glVDPAUMapSurfacesNV = (PFNGLVDPAUMAPSURFACESNVPROC)glewGetProcAddress((const GLubyte*)"glVDPAUMapSurfacesNV");
+  glVDPAUMapSurfacesNV(numSurfaces, surfaces);
+}
+
+static GLvdpauSurfaceNV GLAPIENTRY _glewLazy_glVDPAURegisterOutputSurfaceNV (const void* vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint *textureNames)
+{
+  glVDPAURegisterOutputSurfaceNV = (PFNGLVDPAUREGISTEROUTPUTSURFACENVPROC)glewGetProcAddress((const GLubyte*)"glVDPAURegisterOutputSurfaceNV");
+  return glVDPAURegisterOutputSurfaceNV(vdpSurface, target, numTextureNames, textureNames);
+}
+
+static GLvdpauSurfaceNV GLAPIENTRY _glewLazy_glVDPAURegisterVideoSurfaceNV (const void* vdpSurface, GLenum target, GLsizei numTextureNames, const GLuint *textureNames)
+{
+  glVDPAURegisterVideoSurfaceNV = (PFNGLVDPAUREGISTERVIDEOSURFACENVPROC)glewGetProcAddress((const GLubyte*)"glVDPAURegisterVideoSurfaceNV");
+  return glVDPAURegisterVideoSurfaceNV(vdpSurface, target, numTextureNames, textureNames);
+}
+
+static void GLAPIENTRY _glewLazy_glVDPAUSurfaceAccessNV (GLvdpauSurfaceNV surface, GLenum access)
+{
+  glVDPAUSurfaceAccessNV = (PFNGLVDPAUSURFACEACCESSNVPROC)glewGetProcAddress((const GLubyte*)"glVDPAUSurfaceAccessNV");
+  glVDPAUSurfaceAccessNV(surface, access);
+}
+
+static void GLAPIENTRY _glewLazy_glVDPAUUnmapSurfacesNV (GLsizei numSurface, const GLvdpauSurfaceNV* surfaces)
+{
+  glVDPAUUnmapSurfacesNV = (PFNGLVDPAUUNMAPSURFACESNVPROC)glewGetProcAddress((const GLubyte*)"glVDPAUUnmapSurfacesNV");
+  glVDPAUUnmapSurfacesNV(numSurface, surfaces);
+}
+
+static void GLAPIENTRY _glewLazy_glVDPAUUnregisterSurfaceNV (GLvdpauSurfaceNV surface)
+{
+  glVDPAUUnregisterSurfaceNV = (PFNGLVDPAUUNREGISTERSURFACENVPROC)glewGetProcAddress((const GLubyte*)"glVDPAUUnregisterSurfaceNV");
+  glVDPAUUnregisterSurfaceNV(surface);
+}
+
+
+static void GLAPIENTRY _glewLazy_glFlushVertexArrayRangeNV (void)
+{
+  glFlushVertexArrayRangeNV = (PFNGLFLUSHVERTEXARRAYRANGENVPROC)glewGetProcAddress((const GLubyte*)"glFlushVertexArrayRangeNV");
+  glFlushVertexArrayRangeNV();
+}
+
+static void GLAPIENTRY _glewLazy_glVertexArrayRangeNV (GLsizei length, void *pointer)
+{
+  glVertexArrayRangeNV = (PFNGLVERTEXARRAYRANGENVPROC)glewGetProcAddress((const GLubyte*)"glVertexArrayRangeNV");
+  glVertexArrayRangeNV(length, pointer);
+}
+
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribLi64vNV (GLuint index, GLenum pname, GLint64EXT* params)
+{
+  glGetVertexAttribLi64vNV = (PFNGLGETVERTEXATTRIBLI64VNVPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribLi64vNV");
+  glGetVertexAttribLi64vNV(index, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribLui64vNV (GLuint index, GLenum pname, GLuint64EXT* params)
+{
+  glGetVertexAttribLui64vNV = (PFNGLGETVERTEXATTRIBLUI64VNVPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribLui64vNV");
+  glGetVertexAttribLui64vNV(index, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL1i64NV (GLuint index, GLint64EXT x)
+{
+  glVertexAttribL1i64NV = (PFNGLVERTEXATTRIBL1I64NVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL1i64NV");
+  glVertexAttribL1i64NV(index, x);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL1i64vNV (GLuint index, const GLint64EXT* v)
+{
+  glVertexAttribL1i64vNV = (PFNGLVERTEXATTRIBL1I64VNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL1i64vNV");
+  glVertexAttribL1i64vNV(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL1ui64NV (GLuint index, GLuint64EXT x)
+{
+  glVertexAttribL1ui64NV = (PFNGLVERTEXATTRIBL1UI64NVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL1ui64NV");
+  glVertexAttribL1ui64NV(index, x);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL1ui64vNV (GLuint index, const GLuint64EXT* v)
+{
+  glVertexAttribL1ui64vNV = (PFNGLVERTEXATTRIBL1UI64VNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL1ui64vNV");
+  glVertexAttribL1ui64vNV(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL2i64NV (GLuint index, GLint64EXT x, GLint64EXT y)
+{
+  glVertexAttribL2i64NV = (PFNGLVERTEXATTRIBL2I64NVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL2i64NV");
+  glVertexAttribL2i64NV(index, x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL2i64vNV (GLuint index, const GLint64EXT* v)
+{
+  glVertexAttribL2i64vNV = (PFNGLVERTEXATTRIBL2I64VNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL2i64vNV");
+  glVertexAttribL2i64vNV(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL2ui64NV (GLuint index, GLuint64EXT x, GLuint64EXT y)
+{
+  glVertexAttribL2ui64NV = (PFNGLVERTEXATTRIBL2UI64NVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL2ui64NV");
+  glVertexAttribL2ui64NV(index, x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL2ui64vNV (GLuint index, const GLuint64EXT* v)
+{
+  glVertexAttribL2ui64vNV = (PFNGLVERTEXATTRIBL2UI64VNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL2ui64vNV");
+  glVertexAttribL2ui64vNV(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL3i64NV (GLuint index, GLint64EXT x, GLint64EXT y, GLint64EXT z)
+{
+  glVertexAttribL3i64NV = (PFNGLVERTEXATTRIBL3I64NVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL3i64NV");
+  glVertexAttribL3i64NV(index, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL3i64vNV (GLuint index, const GLint64EXT* v)
+{
+  glVertexAttribL3i64vNV = (PFNGLVERTEXATTRIBL3I64VNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL3i64vNV");
+  glVertexAttribL3i64vNV(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL3ui64NV (GLuint index, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z)
+{
+  glVertexAttribL3ui64NV = (PFNGLVERTEXATTRIBL3UI64NVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL3ui64NV");
+  glVertexAttribL3ui64NV(index, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL3ui64vNV (GLuint index, const GLuint64EXT* v)
+{
+  glVertexAttribL3ui64vNV = (PFNGLVERTEXATTRIBL3UI64VNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL3ui64vNV");
+  glVertexAttribL3ui64vNV(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL4i64NV (GLuint index, GLint64EXT x, GLint64EXT y, GLint64EXT z, GLint64EXT w)
+{
+  glVertexAttribL4i64NV = (PFNGLVERTEXATTRIBL4I64NVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL4i64NV");
+  glVertexAttribL4i64NV(index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL4i64vNV (GLuint index, const GLint64EXT* v)
+{
+  glVertexAttribL4i64vNV = (PFNGLVERTEXATTRIBL4I64VNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL4i64vNV");
+  glVertexAttribL4i64vNV(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL4ui64NV (GLuint index, GLuint64EXT x, GLuint64EXT y, GLuint64EXT z, GLuint64EXT w)
+{
+  glVertexAttribL4ui64NV = (PFNGLVERTEXATTRIBL4UI64NVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL4ui64NV");
+  glVertexAttribL4ui64NV(index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribL4ui64vNV (GLuint index, const GLuint64EXT* v)
+{
+  glVertexAttribL4ui64vNV = (PFNGLVERTEXATTRIBL4UI64VNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribL4ui64vNV");
+  glVertexAttribL4ui64vNV(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribLFormatNV (GLuint index, GLint size, GLenum type, GLsizei stride)
+{
+  glVertexAttribLFormatNV = (PFNGLVERTEXATTRIBLFORMATNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribLFormatNV");
+  glVertexAttribLFormatNV(index, size, type, stride);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBufferAddressRangeNV (GLenum pname, GLuint index, GLuint64EXT address, GLsizeiptr length)
+{
+  glBufferAddressRangeNV = (PFNGLBUFFERADDRESSRANGENVPROC)glewGetProcAddress((const GLubyte*)"glBufferAddressRangeNV");
+  glBufferAddressRangeNV(pname, index, address, length);
+}
+
+static void GLAPIENTRY _glewLazy_glColorFormatNV (GLint size, GLenum type, GLsizei stride)
+{
+  glColorFormatNV = (PFNGLCOLORFORMATNVPROC)glewGetProcAddress((const GLubyte*)"glColorFormatNV");
+  glColorFormatNV(size, type, stride);
+}
+
+static void GLAPIENTRY _glewLazy_glEdgeFlagFormatNV (GLsizei stride)
+{
+  glEdgeFlagFormatNV = (PFNGLEDGEFLAGFORMATNVPROC)glewGetProcAddress((const GLubyte*)"glEdgeFlagFormatNV");
+  glEdgeFlagFormatNV(stride);
+}
+
+static void GLAPIENTRY _glewLazy_glFogCoordFormatNV (GLenum type, GLsizei stride)
+{
+  glFogCoordFormatNV = (PFNGLFOGCOORDFORMATNVPROC)glewGetProcAddress((const GLubyte*)"glFogCoordFormatNV");
+  glFogCoordFormatNV(type, stride);
+}
+
+static void GLAPIENTRY _glewLazy_glGetIntegerui64i_vNV (GLenum value, GLuint index, GLuint64EXT result[])
+{
+  glGetIntegerui64i_vNV = (PFNGLGETINTEGERUI64I_VNVPROC)glewGetProcAddress((const GLubyte*)"glGetIntegerui64i_vNV");
+  glGetIntegerui64i_vNV(value, index, result);
+}
+
+static void GLAPIENTRY _glewLazy_glIndexFormatNV (GLenum type, GLsizei stride)
+{
+  glIndexFormatNV = (PFNGLINDEXFORMATNVPROC)glewGetProcAddress((const GLubyte*)"glIndexFormatNV");
+  glIndexFormatNV(type, stride);
+}
+
+static void GLAPIENTRY _glewLazy_glNormalFormatNV (GLenum type, GLsizei stride)
+{
+  glNormalFormatNV = (PFNGLNORMALFORMATNVPROC)glewGetProcAddress((const GLubyte*)"glNormalFormatNV");
+  glNormalFormatNV(type, stride);
+}
+
+static void GLAPIENTRY _glewLazy_glSecondaryColorFormatNV (GLint size, GLenum type, GLsizei stride)
+{
+  glSecondaryColorFormatNV = (PFNGLSECONDARYCOLORFORMATNVPROC)glewGetProcAddress((const GLubyte*)"glSecondaryColorFormatNV");
+  glSecondaryColorFormatNV(size, type, stride);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoordFormatNV (GLint size, GLenum type, GLsizei stride)
+{
+  glTexCoordFormatNV = (PFNGLTEXCOORDFORMATNVPROC)glewGetProcAddress((const GLubyte*)"glTexCoordFormatNV");
+  glTexCoordFormatNV(size, type, stride);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribFormatNV (GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride)
+{
+  glVertexAttribFormatNV = (PFNGLVERTEXATTRIBFORMATNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribFormatNV");
+  glVertexAttribFormatNV(index, size, type, normalized, stride);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribIFormatNV (GLuint index, GLint size, GLenum type, GLsizei stride)
+{
+  glVertexAttribIFormatNV = (PFNGLVERTEXATTRIBIFORMATNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribIFormatNV");
+  glVertexAttribIFormatNV(index, size, type, stride);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexFormatNV (GLint size, GLenum type, GLsizei stride)
+{
+  glVertexFormatNV = (PFNGLVERTEXFORMATNVPROC)glewGetProcAddress((const GLubyte*)"glVertexFormatNV");
+  glVertexFormatNV(size, type, stride);
+}
+
+
+static GLboolean GLAPIENTRY _glewLazy_glAreProgramsResidentNV (GLsizei n, const GLuint* ids, GLboolean *residences)
+{
+  glAreProgramsResidentNV = (PFNGLAREPROGRAMSRESIDENTNVPROC)glewGetProcAddress((const GLubyte*)"glAreProgramsResidentNV");
+  return glAreProgramsResidentNV(n, ids, residences);
+}
+
+static void GLAPIENTRY _glewLazy_glBindProgramNV (GLenum target, GLuint id)
+{
+  glBindProgramNV = (PFNGLBINDPROGRAMNVPROC)glewGetProcAddress((const GLubyte*)"glBindProgramNV");
+  glBindProgramNV(target, id);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteProgramsNV (GLsizei n, const GLuint* ids)
+{
+  glDeleteProgramsNV = (PFNGLDELETEPROGRAMSNVPROC)glewGetProcAddress((const GLubyte*)"glDeleteProgramsNV");
+  glDeleteProgramsNV(n, ids);
+}
+
+static void GLAPIENTRY _glewLazy_glExecuteProgramNV (GLenum target, GLuint id, const GLfloat* params)
+{
+  glExecuteProgramNV = (PFNGLEXECUTEPROGRAMNVPROC)glewGetProcAddress((const GLubyte*)"glExecuteProgramNV");
+  glExecuteProgramNV(target, id, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGenProgramsNV (GLsizei n, GLuint* ids)
+{
+  glGenProgramsNV = (PFNGLGENPROGRAMSNVPROC)glewGetProcAddress((const GLubyte*)"glGenProgramsNV");
+  glGenProgramsNV(n, ids);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramParameterdvNV (GLenum target, GLuint index, GLenum pname, GLdouble* params)
+{
+  glGetProgramParameterdvNV = (PFNGLGETPROGRAMPARAMETERDVNVPROC)glewGetProcAddress((const GLubyte*)"glGetProgramParameterdvNV");
+  glGetProgramParameterdvNV(target, index, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramParameterfvNV (GLenum target, GLuint index, GLenum pname, GLfloat* params)
+{
+  glGetProgramParameterfvNV = (PFNGLGETPROGRAMPARAMETERFVNVPROC)glewGetProcAddress((const GLubyte*)"glGetProgramParameterfvNV");
+  glGetProgramParameterfvNV(target, index, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramStringNV (GLuint id, GLenum pname, GLubyte* program)
+{
+  glGetProgramStringNV = (PFNGLGETPROGRAMSTRINGNVPROC)glewGetProcAddress((const GLubyte*)"glGetProgramStringNV");
+  glGetProgramStringNV(id, pname, program);
+}
+
+static void GLAPIENTRY _glewLazy_glGetProgramivNV (GLuint id, GLenum pname, GLint* params)
+{
+  glGetProgramivNV = (PFNGLGETPROGRAMIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetProgramivNV");
+  glGetProgramivNV(id, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTrackMatrixivNV (GLenum target, GLuint address, GLenum pname, GLint* params)
+{
+  glGetTrackMatrixivNV = (PFNGLGETTRACKMATRIXIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetTrackMatrixivNV");
+  glGetTrackMatrixivNV(target, address, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribPointervNV (GLuint index, GLenum pname, void** pointer)
+{
+  glGetVertexAttribPointervNV = (PFNGLGETVERTEXATTRIBPOINTERVNVPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribPointervNV");
+  glGetVertexAttribPointervNV(index, pname, pointer);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribdvNV (GLuint index, GLenum pname, GLdouble* params)
+{
+  glGetVertexAttribdvNV = (PFNGLGETVERTEXATTRIBDVNVPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribdvNV");
+  glGetVertexAttribdvNV(index, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribfvNV (GLuint index, GLenum pname, GLfloat* params)
+{
+  glGetVertexAttribfvNV = (PFNGLGETVERTEXATTRIBFVNVPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribfvNV");
+  glGetVertexAttribfvNV(index, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVertexAttribivNV (GLuint index, GLenum pname, GLint* params)
+{
+  glGetVertexAttribivNV = (PFNGLGETVERTEXATTRIBIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetVertexAttribivNV");
+  glGetVertexAttribivNV(index, pname, params);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsProgramNV (GLuint id)
+{
+  glIsProgramNV = (PFNGLISPROGRAMNVPROC)glewGetProcAddress((const GLubyte*)"glIsProgramNV");
+  return glIsProgramNV(id);
+}
+
+static void GLAPIENTRY _glewLazy_glLoadProgramNV (GLenum target, GLuint id, GLsizei len, const GLubyte* program)
+{
+  glLoadProgramNV = (PFNGLLOADPROGRAMNVPROC)glewGetProcAddress((const GLubyte*)"glLoadProgramNV");
+  glLoadProgramNV(target, id, len, program);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramParameter4dNV (GLenum target, GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+  glProgramParameter4dNV = (PFNGLPROGRAMPARAMETER4DNVPROC)glewGetProcAddress((const GLubyte*)"glProgramParameter4dNV");
+  glProgramParameter4dNV(target, index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramParameter4dvNV (GLenum target, GLuint index, const GLdouble* params)
+{
+  glProgramParameter4dvNV = (PFNGLPROGRAMPARAMETER4DVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramParameter4dvNV");
+  glProgramParameter4dvNV(target, index, params);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramParameter4fNV (GLenum target, GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+  glProgramParameter4fNV = (PFNGLPROGRAMPARAMETER4FNVPROC)glewGetProcAddress((const GLubyte*)"glProgramParameter4fNV");
+  glProgramParameter4fNV(target, index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramParameter4fvNV (GLenum target, GLuint index, const GLfloat* params)
+{
+  glProgramParameter4fvNV = (PFNGLPROGRAMPARAMETER4FVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramParameter4fvNV");
+  glProgramParameter4fvNV(target, index, params);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramParameters4dvNV (GLenum target, GLuint index, GLsizei num, const GLdouble* params)
+{
+  glProgramParameters4dvNV = (PFNGLPROGRAMPARAMETERS4DVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramParameters4dvNV");
+  glProgramParameters4dvNV(target, index, num, params);
+}
+
+static void GLAPIENTRY _glewLazy_glProgramParameters4fvNV (GLenum target, GLuint index, GLsizei num, const GLfloat* params)
+{
+  glProgramParameters4fvNV = (PFNGLPROGRAMPARAMETERS4FVNVPROC)glewGetProcAddress((const GLubyte*)"glProgramParameters4fvNV");
+  glProgramParameters4fvNV(target, index, num, params);
+}
+
+static void GLAPIENTRY _glewLazy_glRequestResidentProgramsNV (GLsizei n, GLuint* ids)
+{
+  glRequestResidentProgramsNV = (PFNGLREQUESTRESIDENTPROGRAMSNVPROC)glewGetProcAddress((const GLubyte*)"glRequestResidentProgramsNV");
+  glRequestResidentProgramsNV(n, ids);
+}
+
+static void GLAPIENTRY _glewLazy_glTrackMatrixNV (GLenum target, GLuint address, GLenum matrix, GLenum transform)
+{
+  glTrackMatrixNV = (PFNGLTRACKMATRIXNVPROC)glewGetProcAddress((const GLubyte*)"glTrackMatrixNV");
+  glTrackMatrixNV(target, address, matrix, transform);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1dNV (GLuint index, GLdouble x)
+{
+  glVertexAttrib1dNV = (PFNGLVERTEXATTRIB1DNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1dNV");
+  glVertexAttrib1dNV(index, x);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1dvNV (GLuint index, const GLdouble* v)
+{
+  glVertexAttrib1dvNV = (PFNGLVERTEXATTRIB1DVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1dvNV");
+  glVertexAttrib1dvNV(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1fNV (GLuint index, GLfloat x)
+{
+  glVertexAttrib1fNV = (PFNGLVERTEXATTRIB1FNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1fNV");
+  glVertexAttrib1fNV(index, x);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1fvNV (GLuint index, const GLfloat* v)
+{
+  glVertexAttrib1fvNV = (PFNGLVERTEXATTRIB1FVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1fvNV");
+  glVertexAttrib1fvNV(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1sNV (GLuint index, GLshort x)
+{
+  glVertexAttrib1sNV = (PFNGLVERTEXATTRIB1SNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1sNV");
+  glVertexAttrib1sNV(index, x);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib1svNV (GLuint index, const GLshort* v)
+{
+  glVertexAttrib1svNV = (PFNGLVERTEXATTRIB1SVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib1svNV");
+  glVertexAttrib1svNV(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2dNV (GLuint index, GLdouble x, GLdouble y)
+{
+  glVertexAttrib2dNV = (PFNGLVERTEXATTRIB2DNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2dNV");
+  glVertexAttrib2dNV(index, x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2dvNV (GLuint index, const GLdouble* v)
+{
+  glVertexAttrib2dvNV = (PFNGLVERTEXATTRIB2DVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2dvNV");
+  glVertexAttrib2dvNV(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2fNV (GLuint index, GLfloat x, GLfloat y)
+{
+  glVertexAttrib2fNV = (PFNGLVERTEXATTRIB2FNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2fNV");
+  glVertexAttrib2fNV(index, x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2fvNV (GLuint index, const GLfloat* v)
+{
+  glVertexAttrib2fvNV = (PFNGLVERTEXATTRIB2FVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2fvNV");
+  glVertexAttrib2fvNV(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2sNV (GLuint index, GLshort x, GLshort y)
+{
+  glVertexAttrib2sNV = (PFNGLVERTEXATTRIB2SNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2sNV");
+  glVertexAttrib2sNV(index, x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib2svNV (GLuint index, const GLshort* v)
+{
+  glVertexAttrib2svNV = (PFNGLVERTEXATTRIB2SVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib2svNV");
+  glVertexAttrib2svNV(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3dNV (GLuint index, GLdouble x, GLdouble y, GLdouble z)
+{
+  glVertexAttrib3dNV = (PFNGLVERTEXATTRIB3DNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3dNV");
+  glVertexAttrib3dNV(index, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3dvNV (GLuint index, const GLdouble* v)
+{
+  glVertexAttrib3dvNV = (PFNGLVERTEXATTRIB3DVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3dvNV");
+  glVertexAttrib3dvNV(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3fNV (GLuint index, GLfloat x, GLfloat y, GLfloat z)
+{
+  glVertexAttrib3fNV = (PFNGLVERTEXATTRIB3FNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3fNV");
+  glVertexAttrib3fNV(index, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3fvNV (GLuint index, const GLfloat* v)
+{
+  glVertexAttrib3fvNV = (PFNGLVERTEXATTRIB3FVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3fvNV");
+  glVertexAttrib3fvNV(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3sNV (GLuint index, GLshort x, GLshort y, GLshort z)
+{
+  glVertexAttrib3sNV = (PFNGLVERTEXATTRIB3SNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3sNV");
+  glVertexAttrib3sNV(index, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib3svNV (GLuint index, const GLshort* v)
+{
+  glVertexAttrib3svNV = (PFNGLVERTEXATTRIB3SVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib3svNV");
+  glVertexAttrib3svNV(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4dNV (GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w)
+{
+  glVertexAttrib4dNV = (PFNGLVERTEXATTRIB4DNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4dNV");
+  glVertexAttrib4dNV(index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4dvNV (GLuint index, const GLdouble* v)
+{
+  glVertexAttrib4dvNV = (PFNGLVERTEXATTRIB4DVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4dvNV");
+  glVertexAttrib4dvNV(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4fNV (GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+  glVertexAttrib4fNV = (PFNGLVERTEXATTRIB4FNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4fNV");
+  glVertexAttrib4fNV(index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4fvNV (GLuint index, const GLfloat* v)
+{
+  glVertexAttrib4fvNV = (PFNGLVERTEXATTRIB4FVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4fvNV");
+  glVertexAttrib4fvNV(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4sNV (GLuint index, GLshort x, GLshort y, GLshort z, GLshort w)
+{
+  glVertexAttrib4sNV = (PFNGLVERTEXATTRIB4SNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4sNV");
+  glVertexAttrib4sNV(index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4svNV (GLuint index, const GLshort* v)
+{
+  glVertexAttrib4svNV = (PFNGLVERTEXATTRIB4SVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4svNV");
+  glVertexAttrib4svNV(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4ubNV (GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w)
+{
+  glVertexAttrib4ubNV = (PFNGLVERTEXATTRIB4UBNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4ubNV");
+  glVertexAttrib4ubNV(index, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttrib4ubvNV (GLuint index, const GLubyte* v)
+{
+  glVertexAttrib4ubvNV = (PFNGLVERTEXATTRIB4UBVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttrib4ubvNV");
+  glVertexAttrib4ubvNV(index, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribPointerNV (GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer)
+{
+  glVertexAttribPointerNV = (PFNGLVERTEXATTRIBPOINTERNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribPointerNV");
+  glVertexAttribPointerNV(index, size, type, stride, pointer);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs1dvNV (GLuint index, GLsizei n, const GLdouble* v)
+{
+  glVertexAttribs1dvNV = (PFNGLVERTEXATTRIBS1DVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs1dvNV");
+  glVertexAttribs1dvNV(index, n, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs1fvNV (GLuint index, GLsizei n, const GLfloat* v)
+{
+  glVertexAttribs1fvNV = (PFNGLVERTEXATTRIBS1FVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs1fvNV");
+  glVertexAttribs1fvNV(index, n, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs1svNV (GLuint index, GLsizei n, const GLshort* v)
+{
+  glVertexAttribs1svNV = (PFNGLVERTEXATTRIBS1SVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs1svNV");
+  glVertexAttribs1svNV(index, n, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs2dvNV (GLuint index, GLsizei n, const GLdouble* v)
+{
+  glVertexAttribs2dvNV = (PFNGLVERTEXATTRIBS2DVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs2dvNV");
+  glVertexAttribs2dvNV(index, n, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs2fvNV (GLuint index, GLsizei n, const GLfloat* v)
+{
+  glVertexAttribs2fvNV = (PFNGLVERTEXATTRIBS2FVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs2fvNV");
+  glVertexAttribs2fvNV(index, n, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs2svNV (GLuint index, GLsizei n, const GLshort* v)
+{
+  glVertexAttribs2svNV = (PFNGLVERTEXATTRIBS2SVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs2svNV");
+  glVertexAttribs2svNV(index, n, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs3dvNV (GLuint index, GLsizei n, const GLdouble* v)
+{
+  glVertexAttribs3dvNV = (PFNGLVERTEXATTRIBS3DVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs3dvNV");
+  glVertexAttribs3dvNV(index, n, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs3fvNV (GLuint index, GLsizei n, const GLfloat* v)
+{
+  glVertexAttribs3fvNV = (PFNGLVERTEXATTRIBS3FVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs3fvNV");
+  glVertexAttribs3fvNV(index, n, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs3svNV (GLuint index, GLsizei n, const GLshort* v)
+{
+  glVertexAttribs3svNV = (PFNGLVERTEXATTRIBS3SVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs3svNV");
+  glVertexAttribs3svNV(index, n, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs4dvNV (GLuint index, GLsizei n, const GLdouble* v)
+{
+  glVertexAttribs4dvNV = (PFNGLVERTEXATTRIBS4DVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs4dvNV");
+  glVertexAttribs4dvNV(index, n, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs4fvNV (GLuint index, GLsizei n, const GLfloat* v)
+{
+  glVertexAttribs4fvNV = (PFNGLVERTEXATTRIBS4FVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs4fvNV");
+  glVertexAttribs4fvNV(index, n, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs4svNV (GLuint index, GLsizei n, const GLshort* v)
+{
+  glVertexAttribs4svNV = (PFNGLVERTEXATTRIBS4SVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs4svNV");
+  glVertexAttribs4svNV(index, n, v);
+}
+
+static void GLAPIENTRY _glewLazy_glVertexAttribs4ubvNV (GLuint index, GLsizei n, const GLubyte* v)
+{
+  glVertexAttribs4ubvNV = (PFNGLVERTEXATTRIBS4UBVNVPROC)glewGetProcAddress((const GLubyte*)"glVertexAttribs4ubvNV");
+  glVertexAttribs4ubvNV(index, n, v);
+}
+
+
+static void GLAPIENTRY _glewLazy_glBeginVideoCaptureNV (GLuint video_capture_slot)
+{
+  glBeginVideoCaptureNV = (PFNGLBEGINVIDEOCAPTURENVPROC)glewGetProcAddress((const GLubyte*)"glBeginVideoCaptureNV");
+  glBeginVideoCaptureNV(video_capture_slot);
+}
+
+static void GLAPIENTRY _glewLazy_glBindVideoCaptureStreamBufferNV (GLuint video_capture_slot, GLuint stream, GLenum frame_region, GLintptrARB offset)
+{
+  glBindVideoCaptureStreamBufferNV = (PFNGLBINDVIDEOCAPTURESTREAMBUFFERNVPROC)glewGetProcAddress((const GLubyte*)"glBindVideoCaptureStreamBufferNV");
+  glBindVideoCaptureStreamBufferNV(video_capture_slot, stream, frame_region, offset);
+}
+
+static void GLAPIENTRY _glewLazy_glBindVideoCaptureStreamTextureNV (GLuint video_capture_slot, GLuint stream, GLenum frame_region, GLenum target, GLuint texture)
+{
+  glBindVideoCaptureStreamTextureNV = (PFNGLBINDVIDEOCAPTURESTREAMTEXTURENVPROC)glewGetProcAddress((const GLubyte*)"glBindVideoCaptureStreamTextureNV");
+  glBindVideoCaptureStreamTextureNV(video_capture_slot, stream, frame_region, target, texture);
+}
+
+static void GLAPIENTRY _glewLazy_glEndVideoCaptureNV (GLuint video_capture_slot)
+{
+  glEndVideoCaptureNV = (PFNGLENDVIDEOCAPTURENVPROC)glewGetProcAddress((const GLubyte*)"glEndVideoCaptureNV");
+  glEndVideoCaptureNV(video_capture_slot);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVideoCaptureStreamdvNV (GLuint video_capture_slot, GLuint stream, GLenum pname, GLdouble* params)
+{
+  glGetVideoCaptureStreamdvNV = (PFNGLGETVIDEOCAPTURESTREAMDVNVPROC)glewGetProcAddress((const GLubyte*)"glGetVideoCaptureStreamdvNV");
+  glGetVideoCaptureStreamdvNV(video_capture_slot, stream, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVideoCaptureStreamfvNV (GLuint video_capture_slot, GLuint stream, GLenum pname, GLfloat* params)
+{
+  glGetVideoCaptureStreamfvNV = (PFNGLGETVIDEOCAPTURESTREAMFVNVPROC)glewGetProcAddress((const GLubyte*)"glGetVideoCaptureStreamfvNV");
+  glGetVideoCaptureStreamfvNV(video_capture_slot, stream, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVideoCaptureStreamivNV (GLuint video_capture_slot, GLuint stream, GLenum pname, GLint* params)
+{
+  glGetVideoCaptureStreamivNV = (PFNGLGETVIDEOCAPTURESTREAMIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetVideoCaptureStreamivNV");
+  glGetVideoCaptureStreamivNV(video_capture_slot, stream, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetVideoCaptureivNV (GLuint video_capture_slot, GLenum pname, GLint* params)
+{
+  glGetVideoCaptureivNV = (PFNGLGETVIDEOCAPTUREIVNVPROC)glewGetProcAddress((const GLubyte*)"glGetVideoCaptureivNV");
+  glGetVideoCaptureivNV(video_capture_slot, pname, params);
+}
+
+static GLenum GLAPIENTRY _glewLazy_glVideoCaptureNV (GLuint video_capture_slot, GLuint* sequence_num, GLuint64EXT *capture_time)
+{
+  glVideoCaptureNV = (PFNGLVIDEOCAPTURENVPROC)glewGetProcAddress((const GLubyte*)"glVideoCaptureNV");
+  return glVideoCaptureNV(video_capture_slot, sequence_num, capture_time);
+}
+
+static void GLAPIENTRY _glewLazy_glVideoCaptureStreamParameterdvNV (GLuint video_capture_slot, GLuint stream, GLenum pname, const GLdouble* params)
+{
+  glVideoCaptureStreamParameterdvNV = (PFNGLVIDEOCAPTURESTREAMPARAMETERDVNVPROC)glewGetProcAddress((const GLubyte*)"glVideoCaptureStreamParameterdvNV");
+  glVideoCaptureStreamParameterdvNV(video_capture_slot, stream, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glVideoCaptureStreamParameterfvNV (GLuint video_capture_slot, GLuint stream, GLenum pname, const GLfloat* params)
+{
+  glVideoCaptureStreamParameterfvNV = (PFNGLVIDEOCAPTURESTREAMPARAMETERFVNVPROC)glewGetProcAddress((const GLubyte*)"glVideoCaptureStreamParameterfvNV");
+  glVideoCaptureStreamParameterfvNV(video_capture_slot, stream, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glVideoCaptureStreamParameterivNV (GLuint video_capture_slot, GLuint stream, GLenum pname, const GLint* params)
+{
+  glVideoCaptureStreamParameterivNV = (PFNGLVIDEOCAPTURESTREAMPARAMETERIVNVPROC)glewGetProcAddress((const GLubyte*)"glVideoCaptureStreamParameterivNV");
+  glVideoCaptureStreamParameterivNV(video_capture_slot, stream, pname, params);
+}
+
+
+static void GLAPIENTRY _glewLazy_glClearDepthfOES (GLclampf depth)
+{
+  glClearDepthfOES = (PFNGLCLEARDEPTHFOESPROC)glewGetProcAddress((const GLubyte*)"glClearDepthfOES");
+  glClearDepthfOES(depth);
+}
+
+static void GLAPIENTRY _glewLazy_glClipPlanefOES (GLenum plane, const GLfloat* equation)
+{
+  glClipPlanefOES = (PFNGLCLIPPLANEFOESPROC)glewGetProcAddress((const GLubyte*)"glClipPlanefOES");
+  glClipPlanefOES(plane, equation);
+}
+
+static void GLAPIENTRY _glewLazy_glDepthRangefOES (GLclampf n, GLclampf f)
+{
+  glDepthRangefOES = (PFNGLDEPTHRANGEFOESPROC)glewGetProcAddress((const GLubyte*)"glDepthRangefOES");
+  glDepthRangefOES(n, f);
+}
+
+static void GLAPIENTRY _glewLazy_glFrustumfOES (GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n, GLfloat f)
+{
+  glFrustumfOES = (PFNGLFRUSTUMFOESPROC)glewGetProcAddress((const GLubyte*)"glFrustumfOES");
+  glFrustumfOES(l, r, b, t, n, f);
+}
+
+static void GLAPIENTRY _glewLazy_glGetClipPlanefOES (GLenum plane, GLfloat* equation)
+{
+  glGetClipPlanefOES = (PFNGLGETCLIPPLANEFOESPROC)glewGetProcAddress((const GLubyte*)"glGetClipPlanefOES");
+  glGetClipPlanefOES(plane, equation);
+}
+
+static void GLAPIENTRY _glewLazy_glOrthofOES (GLfloat l, GLfloat r, GLfloat b, GLfloat t, GLfloat n, GLfloat f)
+{
+  glOrthofOES = (PFNGLORTHOFOESPROC)glewGetProcAddress((const GLubyte*)"glOrthofOES");
+  glOrthofOES(l, r, b, t, n, f);
+}
+
+
+static void GLAPIENTRY _glewLazy_glAlphaFuncx (GLenum func, GLclampx ref)
+{
+  glAlphaFuncx = (PFNGLALPHAFUNCXPROC)glewGetProcAddress((const GLubyte*)"glAlphaFuncx");
+  glAlphaFuncx(func, ref);
+}
+
+static void GLAPIENTRY _glewLazy_glClearColorx (GLclampx red, GLclampx green, GLclampx blue, GLclampx alpha)
+{
+  glClearColorx = (PFNGLCLEARCOLORXPROC)glewGetProcAddress((const GLubyte*)"glClearColorx");
+  glClearColorx(red, green, blue, alpha);
+}
+
+static void GLAPIENTRY _glewLazy_glClearDepthx (GLclampx depth)
+{
+  glClearDepthx = (PFNGLCLEARDEPTHXPROC)glewGetProcAddress((const GLubyte*)"glClearDepthx");
+  glClearDepthx(depth);
+}
+
+static void GLAPIENTRY _glewLazy_glColor4x (GLfixed red, GLfixed green, GLfixed blue, GLfixed alpha)
+{
+  glColor4x = (PFNGLCOLOR4XPROC)glewGetProcAddress((const GLubyte*)"glColor4x");
+  glColor4x(red, green, blue, alpha);
+}
+
+static void GLAPIENTRY _glewLazy_glDepthRangex (GLclampx zNear, GLclampx zFar)
+{
+  glDepthRangex = (PFNGLDEPTHRANGEXPROC)glewGetProcAddress((const GLubyte*)"glDepthRangex");
+  glDepthRangex(zNear, zFar);
+}
+
+static void GLAPIENTRY _glewLazy_glFogx (GLenum pname, GLfixed param)
+{
+  glFogx = (PFNGLFOGXPROC)glewGetProcAddress((const GLubyte*)"glFogx");
+  glFogx(pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glFogxv (GLenum pname, const GLfixed* params)
+{
+  glFogxv = (PFNGLFOGXVPROC)glewGetProcAddress((const GLubyte*)"glFogxv");
+  glFogxv(pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glFrustumf (GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar)
+{
+  glFrustumf = (PFNGLFRUSTUMFPROC)glewGetProcAddress((const GLubyte*)"glFrustumf");
+  glFrustumf(left, right, bottom, top, zNear, zFar);
+}
+
+static void GLAPIENTRY _glewLazy_glFrustumx (GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed zNear, GLfixed zFar)
+{
+  glFrustumx = (PFNGLFRUSTUMXPROC)glewGetProcAddress((const GLubyte*)"glFrustumx");
+  glFrustumx(left, right, bottom, top, zNear, zFar);
+}
+
+static void GLAPIENTRY _glewLazy_glLightModelx (GLenum pname, GLfixed param)
+{
+  glLightModelx = (PFNGLLIGHTMODELXPROC)glewGetProcAddress((const GLubyte*)"glLightModelx");
+  glLightModelx(pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glLightModelxv (GLenum pname, const GLfixed* params)
+{
+  glLightModelxv = (PFNGLLIGHTMODELXVPROC)glewGetProcAddress((const GLubyte*)"glLightModelxv");
+  glLightModelxv(pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glLightx (GLenum light, GLenum pname, GLfixed param)
+{
+  glLightx = (PFNGLLIGHTXPROC)glewGetProcAddress((const GLubyte*)"glLightx");
+  glLightx(light, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glLightxv (GLenum light, GLenum pname, const GLfixed* params)
+{
+  glLightxv = (PFNGLLIGHTXVPROC)glewGetProcAddress((const GLubyte*)"glLightxv");
+  glLightxv(light, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glLineWidthx (GLfixed width)
+{
+  glLineWidthx = (PFNGLLINEWIDTHXPROC)glewGetProcAddress((const GLubyte*)"glLineWidthx");
+  glLineWidthx(width);
+}
+
+static void GLAPIENTRY _glewLazy_glLoadMatrixx (const GLfixed* m)
+{
+  glLoadMatrixx = (PFNGLLOADMATRIXXPROC)glewGetProcAddress((const GLubyte*)"glLoadMatrixx");
+  glLoadMatrixx(m);
+}
+
+static void GLAPIENTRY _glewLazy_glMaterialx (GLenum face, GLenum pname, GLfixed param)
+{
+  glMaterialx = (PFNGLMATERIALXPROC)glewGetProcAddress((const GLubyte*)"glMaterialx");
+  glMaterialx(face, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glMaterialxv (GLenum face, GLenum pname, const GLfixed* params)
+{
+  glMaterialxv = (PFNGLMATERIALXVPROC)glewGetProcAddress((const GLubyte*)"glMaterialxv");
+  glMaterialxv(face, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glMultMatrixx (const GLfixed* m)
+{
+  glMultMatrixx = (PFNGLMULTMATRIXXPROC)glewGetProcAddress((const GLubyte*)"glMultMatrixx");
+  glMultMatrixx(m);
+}
+
+static void GLAPIENTRY _glewLazy_glMultiTexCoord4x (GLenum target, GLfixed s, GLfixed t, GLfixed r, GLfixed q)
+{
+  glMultiTexCoord4x = (PFNGLMULTITEXCOORD4XPROC)glewGetProcAddress((const GLubyte*)"glMultiTexCoord4x");
+  glMultiTexCoord4x(target, s, t, r, q);
+}
+
+static void GLAPIENTRY _glewLazy_glNormal3x (GLfixed nx, GLfixed ny, GLfixed nz)
+{
+  glNormal3x = (PFNGLNORMAL3XPROC)glewGetProcAddress((const GLubyte*)"glNormal3x");
+  glNormal3x(nx, ny, nz);
+}
+
+static void GLAPIENTRY _glewLazy_glOrthof (GLfloat left, GLfloat right, GLfloat bottom, GLfloat top, GLfloat zNear, GLfloat zFar)
+{
+  glOrthof = (PFNGLORTHOFPROC)glewGetProcAddress((const GLubyte*)"glOrthof");
+  glOrthof(left, right, bottom, top, zNear, zFar);
+}
+
+static void GLAPIENTRY _glewLazy_glOrthox (GLfixed left, GLfixed right, GLfixed bottom, GLfixed top, GLfixed zNear, GLfixed zFar)
+{
+  glOrthox = (PFNGLORTHOXPROC)glewGetProcAddress((const GLubyte*)"glOrthox");
+  glOrthox(left, right, bottom, top, zNear, zFar);
+}
+
+static void GLAPIENTRY _glewLazy_glPointSizex (GLfixed size)
+{
+  glPointSizex = (PFNGLPOINTSIZEXPROC)glewGetProcAddress((const GLubyte*)"glPointSizex");
+  glPointSizex(size);
+}
+
+static void GLAPIENTRY _glewLazy_glPolygonOffsetx (GLfixed factor, GLfixed units)
+{
+  glPolygonOffsetx = (PFNGLPOLYGONOFFSETXPROC)glewGetProcAddress((const GLubyte*)"glPolygonOffsetx");
+  glPolygonOffsetx(factor, units);
+}
+
+static void GLAPIENTRY _glewLazy_glRotatex (GLfixed angle, GLfixed x, GLfixed y, GLfixed z)
+{
+  glRotatex = (PFNGLROTATEXPROC)glewGetProcAddress((const GLubyte*)"glRotatex");
+  glRotatex(angle, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glSampleCoveragex (GLclampx value, GLboolean invert)
+{
+  glSampleCoveragex = (PFNGLSAMPLECOVERAGEXPROC)glewGetProcAddress((const GLubyte*)"glSampleCoveragex");
+  glSampleCoveragex(value, invert);
+}
+
+static void GLAPIENTRY _glewLazy_glScalex (GLfixed x, GLfixed y, GLfixed z)
+{
+  glScalex = (PFNGLSCALEXPROC)glewGetProcAddress((const GLubyte*)"glScalex");
+  glScalex(x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glTexEnvx (GLenum target, GLenum pname, GLfixed param)
+{
+  glTexEnvx = (PFNGLTEXENVXPROC)glewGetProcAddress((const GLubyte*)"glTexEnvx");
+  glTexEnvx(target, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glTexEnvxv (GLenum target, GLenum pname, const GLfixed* params)
+{
+  glTexEnvxv = (PFNGLTEXENVXVPROC)glewGetProcAddress((const GLubyte*)"glTexEnvxv");
+  glTexEnvxv(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glTexParameterx (GLenum target, GLenum pname, GLfixed param)
+{
+  glTexParameterx = (PFNGLTEXPARAMETERXPROC)glewGetProcAddress((const GLubyte*)"glTexParameterx");
+  glTexParameterx(target, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glTranslatex (GLfixed x, GLfixed y, GLfixed z)
+{
+  glTranslatex = (PFNGLTRANSLATEXPROC)glewGetProcAddress((const GLubyte*)"glTranslatex");
+  glTranslatex(x, y, z);
+}
+
+
+static void GLAPIENTRY _glewLazy_glClipPlanef (GLenum plane, const GLfloat* equation)
+{
+  glClipPlanef = (PFNGLCLIPPLANEFPROC)glewGetProcAddress((const GLubyte*)"glClipPlanef");
+  glClipPlanef(plane, equation);
+}
+
+static void GLAPIENTRY _glewLazy_glClipPlanex (GLenum plane, const GLfixed* equation)
+{
+  glClipPlanex = (PFNGLCLIPPLANEXPROC)glewGetProcAddress((const GLubyte*)"glClipPlanex");
+  glClipPlanex(plane, equation);
+}
+
+static void GLAPIENTRY _glewLazy_glGetClipPlanef (GLenum pname, GLfloat eqn[4])
+{
+  glGetClipPlanef = (PFNGLGETCLIPPLANEFPROC)glewGetProcAddress((const GLubyte*)"glGetClipPlanef");
+  glGetClipPlanef(pname, eqn);
+}
+
+static void GLAPIENTRY _glewLazy_glGetClipPlanex (GLenum pname, GLfixed eqn[4])
+{
+  glGetClipPlanex = (PFNGLGETCLIPPLANEXPROC)glewGetProcAddress((const GLubyte*)"glGetClipPlanex");
+  glGetClipPlanex(pname, eqn);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFixedv (GLenum pname, GLfixed* params)
+{
+  glGetFixedv = (PFNGLGETFIXEDVPROC)glewGetProcAddress((const GLubyte*)"glGetFixedv");
+  glGetFixedv(pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetLightxv (GLenum light, GLenum pname, GLfixed* params)
+{
+  glGetLightxv = (PFNGLGETLIGHTXVPROC)glewGetProcAddress((const GLubyte*)"glGetLightxv");
+  glGetLightxv(light, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetMaterialxv (GLenum face, GLenum pname, GLfixed* params)
+{
+  glGetMaterialxv = (PFNGLGETMATERIALXVPROC)glewGetProcAddress((const GLubyte*)"glGetMaterialxv");
+  glGetMaterialxv(face, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTexEnvxv (GLenum env, GLenum pname, GLfixed* params)
+{
+  glGetTexEnvxv = (PFNGLGETTEXENVXVPROC)glewGetProcAddress((const GLubyte*)"glGetTexEnvxv");
+  glGetTexEnvxv(env, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetTexParameterxv (GLenum target, GLenum pname, GLfixed* params)
+{
+  glGetTexParameterxv = (PFNGLGETTEXPARAMETERXVPROC)glewGetProcAddress((const GLubyte*)"glGetTexParameterxv");
+  glGetTexParameterxv(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glPointParameterx (GLenum pname, GLfixed param)
+{
+  glPointParameterx = (PFNGLPOINTPARAMETERXPROC)glewGetProcAddress((const GLubyte*)"glPointParameterx");
+  glPointParameterx(pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glPointParameterxv (GLenum pname, const GLfixed* params)
+{
+  glPointParameterxv = (PFNGLPOINTPARAMETERXVPROC)glewGetProcAddress((const GLubyte*)"glPointParameterxv");
+  glPointParameterxv(pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glPointSizePointerOES (GLenum type, GLsizei stride, const void *pointer)
+{
+  glPointSizePointerOES = (PFNGLPOINTSIZEPOINTEROESPROC)glewGetProcAddress((const GLubyte*)"glPointSizePointerOES");
+  glPointSizePointerOES(type, stride, pointer);
+}
+
+static void GLAPIENTRY _glewLazy_glTexParameterxv (GLenum target, GLenum pname, const GLfixed* params)
+{
+  glTexParameterxv = (PFNGLTEXPARAMETERXVPROC)glewGetProcAddress((const GLubyte*)"glTexParameterxv");
+  glTexParameterxv(target, pname, params);
+}
+
+
+static const GLchar* GLAPIENTRY _glewLazy_glErrorStringREGAL (GLenum error)
+{
+  glErrorStringREGAL = (PFNGLERRORSTRINGREGALPROC)glewGetProcAddress((const GLubyte*)"glErrorStringREGAL");
+  return glErrorStringREGAL(error);
+}
+
+
+static GLboolean GLAPIENTRY _glewLazy_glGetExtensionREGAL (const GLchar* ext)
+{
+  glGetExtensionREGAL = (PFNGLGETEXTENSIONREGALPROC)glewGetProcAddress((const GLubyte*)"glGetExtensionREGAL");
+  return glGetExtensionREGAL(ext);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsSupportedREGAL (const GLchar* ext)
+{
+  glIsSupportedREGAL = (PFNGLISSUPPORTEDREGALPROC)glewGetProcAddress((const GLubyte*)"glIsSupportedREGAL");
+  return glIsSupportedREGAL(ext);
+}
+
+
+static void GLAPIENTRY _glewLazy_glLogMessageCallbackREGAL (GLLOGPROCREGAL callback)
+{
+  glLogMessageCallbackREGAL = (PFNGLLOGMESSAGECALLBACKREGALPROC)glewGetProcAddress((const GLubyte*)"glLogMessageCallbackREGAL");
+  glLogMessageCallbackREGAL(callback);
+}
+
+
+static void * GLAPIENTRY _glewLazy_glGetProcAddressREGAL (const GLchar *name)
+{
+  glGetProcAddressREGAL = (PFNGLGETPROCADDRESSREGALPROC)glewGetProcAddress((const GLubyte*)"glGetProcAddressREGAL");
+  return glGetProcAddressREGAL(name);
+}
+
+
+static void GLAPIENTRY _glewLazy_glDetailTexFuncSGIS (GLenum target, GLsizei n, const GLfloat* points)
+{
+  glDetailTexFuncSGIS = (PFNGLDETAILTEXFUNCSGISPROC)glewGetProcAddress((const GLubyte*)"glDetailTexFuncSGIS");
+  glDetailTexFuncSGIS(target, n, points);
+}
+
+static void GLAPIENTRY _glewLazy_glGetDetailTexFuncSGIS (GLenum target, GLfloat* points)
+{
+  glGetDetailTexFuncSGIS = (PFNGLGETDETAILTEXFUNCSGISPROC)glewGetProcAddress((const GLubyte*)"glGetDetailTexFuncSGIS");
+  glGetDetailTexFuncSGIS(target, points);
+}
+
+
+static void GLAPIENTRY _glewLazy_glFogFuncSGIS (GLsizei n, const GLfloat* points)
+{
+  glFogFuncSGIS = (PFNGLFOGFUNCSGISPROC)glewGetProcAddress((const GLubyte*)"glFogFuncSGIS");
+  glFogFuncSGIS(n, points);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFogFuncSGIS (GLfloat* points)
+{
+  glGetFogFuncSGIS = (PFNGLGETFOGFUNCSGISPROC)glewGetProcAddress((const GLubyte*)"glGetFogFuncSGIS");
+  glGetFogFuncSGIS(points);
+}
+
+
+static void GLAPIENTRY _glewLazy_glSampleMaskSGIS (GLclampf value, GLboolean invert)
+{
+  glSampleMaskSGIS = (PFNGLSAMPLEMASKSGISPROC)glewGetProcAddress((const GLubyte*)"glSampleMaskSGIS");
+  glSampleMaskSGIS(value, invert);
+}
+
+static void GLAPIENTRY _glewLazy_glSamplePatternSGIS (GLenum pattern)
+{
+  glSamplePatternSGIS = (PFNGLSAMPLEPATTERNSGISPROC)glewGetProcAddress((const GLubyte*)"glSamplePatternSGIS");
+  glSamplePatternSGIS(pattern);
+}
+
+
+static void GLAPIENTRY _glewLazy_glGetSharpenTexFuncSGIS (GLenum target, GLfloat* points)
+{
+  glGetSharpenTexFuncSGIS = (PFNGLGETSHARPENTEXFUNCSGISPROC)glewGetProcAddress((const GLubyte*)"glGetSharpenTexFuncSGIS");
+  glGetSharpenTexFuncSGIS(target, points);
+}
+
+static void GLAPIENTRY _glewLazy_glSharpenTexFuncSGIS (GLenum target, GLsizei n, const GLfloat* points)
+{
+  glSharpenTexFuncSGIS = (PFNGLSHARPENTEXFUNCSGISPROC)glewGetProcAddress((const GLubyte*)"glSharpenTexFuncSGIS");
+  glSharpenTexFuncSGIS(target, n, points);
+}
+
+
+static void GLAPIENTRY _glewLazy_glTexImage4DSGIS (GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLsizei extent, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+  glTexImage4DSGIS = (PFNGLTEXIMAGE4DSGISPROC)glewGetProcAddress((const GLubyte*)"glTexImage4DSGIS");
+  glTexImage4DSGIS(target, level, internalformat, width, height, depth, extent, border, format, type, pixels);
+}
+
+static void GLAPIENTRY _glewLazy_glTexSubImage4DSGIS (GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint woffset, GLsizei width, GLsizei height, GLsizei depth, GLsizei extent, GLenum format, GLenum type, const void *pixels)
+{
+  glTexSubImage4DSGIS = (PFNGLTEXSUBIMAGE4DSGISPROC)glewGetProcAddress((const GLubyte*)"glTexSubImage4DSGIS");
+  glTexSubImage4DSGIS(target, level, xoffset, yoffset, zoffset, woffset, width, height, depth, extent, format, type, pixels);
+}
+
+
+static void GLAPIENTRY _glewLazy_glGetTexFilterFuncSGIS (GLenum target, GLenum filter, GLfloat* weights)
+{
+  glGetTexFilterFuncSGIS = (PFNGLGETTEXFILTERFUNCSGISPROC)glewGetProcAddress((const GLubyte*)"glGetTexFilterFuncSGIS");
+  glGetTexFilterFuncSGIS(target, filter, weights);
+}
+
+static void GLAPIENTRY _glewLazy_glTexFilterFuncSGIS (GLenum target, GLenum filter, GLsizei n, const GLfloat* weights)
+{
+  glTexFilterFuncSGIS = (PFNGLTEXFILTERFUNCSGISPROC)glewGetProcAddress((const GLubyte*)"glTexFilterFuncSGIS");
+  glTexFilterFuncSGIS(target, filter, n, weights);
+}
+
+
+static void GLAPIENTRY _glewLazy_glAsyncMarkerSGIX (GLuint marker)
+{
+  glAsyncMarkerSGIX = (PFNGLASYNCMARKERSGIXPROC)glewGetProcAddress((const GLubyte*)"glAsyncMarkerSGIX");
+  glAsyncMarkerSGIX(marker);
+}
+
+static void GLAPIENTRY _glewLazy_glDeleteAsyncMarkersSGIX (GLuint marker, GLsizei range)
+{
+  glDeleteAsyncMarkersSGIX = (PFNGLDELETEASYNCMARKERSSGIXPROC)glewGetProcAddress((const GLubyte*)"glDeleteAsyncMarkersSGIX");
+  glDeleteAsyncMarkersSGIX(marker, range);
+}
+
+static GLint GLAPIENTRY _glewLazy_glFinishAsyncSGIX (GLuint* markerp)
+{
+  glFinishAsyncSGIX = (PFNGLFINISHASYNCSGIXPROC)glewGetProcAddress((const GLubyte*)"glFinishAsyncSGIX");
+  return glFinishAsyncSGIX(markerp);
+}
+
+static GLuint GLAPIENTRY _glewLazy_glGenAsyncMarkersSGIX (GLsizei range)
+{
+  glGenAsyncMarkersSGIX = (PFNGLGENASYNCMARKERSSGIXPROC)glewGetProcAddress((const GLubyte*)"glGenAsyncMarkersSGIX");
+  return glGenAsyncMarkersSGIX(range);
+}
+
+static GLboolean GLAPIENTRY _glewLazy_glIsAsyncMarkerSGIX (GLuint marker)
+{
+  glIsAsyncMarkerSGIX = (PFNGLISASYNCMARKERSGIXPROC)glewGetProcAddress((const GLubyte*)"glIsAsyncMarkerSGIX");
+  return glIsAsyncMarkerSGIX(marker);
+}
+
+static GLint GLAPIENTRY _glewLazy_glPollAsyncSGIX (GLuint* markerp)
+{
+  glPollAsyncSGIX = (PFNGLPOLLASYNCSGIXPROC)glewGetProcAddress((const GLubyte*)"glPollAsyncSGIX");
+  return glPollAsyncSGIX(markerp);
+}
+
+
+static void GLAPIENTRY _glewLazy_glFlushRasterSGIX (void)
+{
+  glFlushRasterSGIX = (PFNGLFLUSHRASTERSGIXPROC)glewGetProcAddress((const GLubyte*)"glFlushRasterSGIX");
+  glFlushRasterSGIX();
+}
+
+
+static void GLAPIENTRY _glewLazy_glTextureFogSGIX (GLenum pname)
+{
+  glTextureFogSGIX = (PFNGLTEXTUREFOGSGIXPROC)glewGetProcAddress((const GLubyte*)"glTextureFogSGIX");
+  glTextureFogSGIX(pname);
+}
+
+
+static void GLAPIENTRY _glewLazy_glFragmentColorMaterialSGIX (GLenum face, GLenum mode)
+{
+  glFragmentColorMaterialSGIX = (PFNGLFRAGMENTCOLORMATERIALSGIXPROC)glewGetProcAddress((const GLubyte*)"glFragmentColorMaterialSGIX");
+  glFragmentColorMaterialSGIX(face, mode);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentLightModelfSGIX (GLenum pname, GLfloat param)
+{
+  glFragmentLightModelfSGIX = (PFNGLFRAGMENTLIGHTMODELFSGIXPROC)glewGetProcAddress((const GLubyte*)"glFragmentLightModelfSGIX");
+  glFragmentLightModelfSGIX(pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentLightModelfvSGIX (GLenum pname, GLfloat* params)
+{
+  glFragmentLightModelfvSGIX = (PFNGLFRAGMENTLIGHTMODELFVSGIXPROC)glewGetProcAddress((const GLubyte*)"glFragmentLightModelfvSGIX");
+  glFragmentLightModelfvSGIX(pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentLightModeliSGIX (GLenum pname, GLint param)
+{
+  glFragmentLightModeliSGIX = (PFNGLFRAGMENTLIGHTMODELISGIXPROC)glewGetProcAddress((const GLubyte*)"glFragmentLightModeliSGIX");
+  glFragmentLightModeliSGIX(pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentLightModelivSGIX (GLenum pname, GLint* params)
+{
+  glFragmentLightModelivSGIX = (PFNGLFRAGMENTLIGHTMODELIVSGIXPROC)glewGetProcAddress((const GLubyte*)"glFragmentLightModelivSGIX");
+  glFragmentLightModelivSGIX(pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentLightfSGIX (GLenum light, GLenum pname, GLfloat param)
+{
+  glFragmentLightfSGIX = (PFNGLFRAGMENTLIGHTFSGIXPROC)glewGetProcAddress((const GLubyte*)"glFragmentLightfSGIX");
+  glFragmentLightfSGIX(light, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentLightfvSGIX (GLenum light, GLenum pname, GLfloat* params)
+{
+  glFragmentLightfvSGIX = (PFNGLFRAGMENTLIGHTFVSGIXPROC)glewGetProcAddress((const GLubyte*)"glFragmentLightfvSGIX");
+  glFragmentLightfvSGIX(light, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentLightiSGIX (GLenum light, GLenum pname, GLint param)
+{
+  glFragmentLightiSGIX = (PFNGLFRAGMENTLIGHTISGIXPROC)glewGetProcAddress((const GLubyte*)"glFragmentLightiSGIX");
+  glFragmentLightiSGIX(light, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentLightivSGIX (GLenum light, GLenum pname, GLint* params)
+{
+  glFragmentLightivSGIX = (PFNGLFRAGMENTLIGHTIVSGIXPROC)glewGetProcAddress((const GLubyte*)"glFragmentLightivSGIX");
+  glFragmentLightivSGIX(light, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentMaterialfSGIX (GLenum face, GLenum pname, const GLfloat param)
+{
+  glFragmentMaterialfSGIX = (PFNGLFRAGMENTMATERIALFSGIXPROC)glewGetProcAddress((const GLubyte*)"glFragmentMaterialfSGIX");
+  glFragmentMaterialfSGIX(face, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentMaterialfvSGIX (GLenum face, GLenum pname, const GLfloat* params)
+{
+  glFragmentMaterialfvSGIX = (PFNGLFRAGMENTMATERIALFVSGIXPROC)glewGetProcAddress((const GLubyte*)"glFragmentMaterialfvSGIX");
+  glFragmentMaterialfvSGIX(face, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentMaterialiSGIX (GLenum face, GLenum pname, const GLint param)
+{
+  glFragmentMaterialiSGIX = (PFNGLFRAGMENTMATERIALISGIXPROC)glewGetProcAddress((const GLubyte*)"glFragmentMaterialiSGIX");
+  glFragmentMaterialiSGIX(face, pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glFragmentMaterialivSGIX (GLenum face, GLenum pname, const GLint* params)
+{
+  glFragmentMaterialivSGIX = (PFNGLFRAGMENTMATERIALIVSGIXPROC)glewGetProcAddress((const GLubyte*)"glFragmentMaterialivSGIX");
+  glFragmentMaterialivSGIX(face, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFragmentLightfvSGIX (GLenum light, GLenum value, GLfloat* data)
+{
+  glGetFragmentLightfvSGIX = (PFNGLGETFRAGMENTLIGHTFVSGIXPROC)glewGetProcAddress((const GLubyte*)"glGetFragmentLightfvSGIX");
+  glGetFragmentLightfvSGIX(light, value, data);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFragmentLightivSGIX (GLenum light, GLenum value, GLint* data)
+{
+  glGetFragmentLightivSGIX = (PFNGLGETFRAGMENTLIGHTIVSGIXPROC)glewGetProcAddress((const GLubyte*)"glGetFragmentLightivSGIX");
+  glGetFragmentLightivSGIX(light, value, data);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFragmentMaterialfvSGIX (GLenum face, GLenum pname, const GLfloat* data)
+{
+  glGetFragmentMaterialfvSGIX = (PFNGLGETFRAGMENTMATERIALFVSGIXPROC)glewGetProcAddress((const GLubyte*)"glGetFragmentMaterialfvSGIX");
+  glGetFragmentMaterialfvSGIX(face, pname, data);
+}
+
+static void GLAPIENTRY _glewLazy_glGetFragmentMaterialivSGIX (GLenum face, GLenum pname, const GLint* data)
+{
+  glGetFragmentMaterialivSGIX = (PFNGLGETFRAGMENTMATERIALIVSGIXPROC)glewGetProcAddress((const GLubyte*)"glGetFragmentMaterialivSGIX");
+  glGetFragmentMaterialivSGIX(face, pname, data);
+}
+
+
+static void GLAPIENTRY _glewLazy_glFrameZoomSGIX (GLint factor)
+{
+  glFrameZoomSGIX = (PFNGLFRAMEZOOMSGIXPROC)glewGetProcAddress((const GLubyte*)"glFrameZoomSGIX");
+  glFrameZoomSGIX(factor);
+}
+
+
+static void GLAPIENTRY _glewLazy_glPixelTexGenSGIX (GLenum mode)
+{
+  glPixelTexGenSGIX = (PFNGLPIXELTEXGENSGIXPROC)glewGetProcAddress((const GLubyte*)"glPixelTexGenSGIX");
+  glPixelTexGenSGIX(mode);
+}
+
+
+static void GLAPIENTRY _glewLazy_glReferencePlaneSGIX (const GLdouble* equation)
+{
+  glReferencePlaneSGIX = (PFNGLREFERENCEPLANESGIXPROC)glewGetProcAddress((const GLubyte*)"glReferencePlaneSGIX");
+  glReferencePlaneSGIX(equation);
+}
+
+
+static void GLAPIENTRY _glewLazy_glSpriteParameterfSGIX (GLenum pname, GLfloat param)
+{
+  glSpriteParameterfSGIX = (PFNGLSPRITEPARAMETERFSGIXPROC)glewGetProcAddress((const GLubyte*)"glSpriteParameterfSGIX");
+  glSpriteParameterfSGIX(pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glSpriteParameterfvSGIX (GLenum pname, GLfloat* params)
+{
+  glSpriteParameterfvSGIX = (PFNGLSPRITEPARAMETERFVSGIXPROC)glewGetProcAddress((const GLubyte*)"glSpriteParameterfvSGIX");
+  glSpriteParameterfvSGIX(pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glSpriteParameteriSGIX (GLenum pname, GLint param)
+{
+  glSpriteParameteriSGIX = (PFNGLSPRITEPARAMETERISGIXPROC)glewGetProcAddress((const GLubyte*)"glSpriteParameteriSGIX");
+  glSpriteParameteriSGIX(pname, param);
+}
+
+static void GLAPIENTRY _glewLazy_glSpriteParameterivSGIX (GLenum pname, GLint* params)
+{
+  glSpriteParameterivSGIX = (PFNGLSPRITEPARAMETERIVSGIXPROC)glewGetProcAddress((const GLubyte*)"glSpriteParameterivSGIX");
+  glSpriteParameterivSGIX(pname, params);
+}
+
+
+static void GLAPIENTRY _glewLazy_glTagSampleBufferSGIX (void)
+{
+  glTagSampleBufferSGIX = (PFNGLTAGSAMPLEBUFFERSGIXPROC)glewGetProcAddress((const GLubyte*)"glTagSampleBufferSGIX");
+  glTagSampleBufferSGIX();
+}
+
+
+static void GLAPIENTRY _glewLazy_glColorTableParameterfvSGI (GLenum target, GLenum pname, const GLfloat* params)
+{
+  glColorTableParameterfvSGI = (PFNGLCOLORTABLEPARAMETERFVSGIPROC)glewGetProcAddress((const GLubyte*)"glColorTableParameterfvSGI");
+  glColorTableParameterfvSGI(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glColorTableParameterivSGI (GLenum target, GLenum pname, const GLint* params)
+{
+  glColorTableParameterivSGI = (PFNGLCOLORTABLEPARAMETERIVSGIPROC)glewGetProcAddress((const GLubyte*)"glColorTableParameterivSGI");
+  glColorTableParameterivSGI(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glColorTableSGI (GLenum target, GLenum internalformat, GLsizei width, GLenum format, GLenum type, const void *table)
+{
+  glColorTableSGI = (PFNGLCOLORTABLESGIPROC)glewGetProcAddress((const GLubyte*)"glColorTableSGI");
+  glColorTableSGI(target, internalformat, width, format, type, table);
+}
+
+static void GLAPIENTRY _glewLazy_glCopyColorTableSGI (GLenum target, GLenum internalformat, GLint x, GLint y, GLsizei width)
+{
+  glCopyColorTableSGI = (PFNGLCOPYCOLORTABLESGIPROC)glewGetProcAddress((const GLubyte*)"glCopyColorTableSGI");
+  glCopyColorTableSGI(target, internalformat, x, y, width);
+}
+
+static void GLAPIENTRY _glewLazy_glGetColorTableParameterfvSGI (GLenum target, GLenum pname, GLfloat* params)
+{
+  glGetColorTableParameterfvSGI = (PFNGLGETCOLORTABLEPARAMETERFVSGIPROC)glewGetProcAddress((const GLubyte*)"glGetColorTableParameterfvSGI");
+  glGetColorTableParameterfvSGI(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetColorTableParameterivSGI (GLenum target, GLenum pname, GLint* params)
+{
+  glGetColorTableParameterivSGI = (PFNGLGETCOLORTABLEPARAMETERIVSGIPROC)glewGetProcAddress((const GLubyte*)"glGetColorTableParameterivSGI");
+  glGetColorTableParameterivSGI(target, pname, params);
+}
+
+static void GLAPIENTRY _glewLazy_glGetColorTableSGI (GLenum target, GLenum format, GLenum type, void *table)
+{
+  glGetColorTableSGI = (PFNGLGETCOLORTABLESGIPROC)glewGetProcAddress((const GLubyte*)"glGetColorTableSGI");
+  glGetColorTableSGI(target, format, type, table);
+}
+
+
+static void GLAPIENTRY _glewLazy_glFinishTextureSUNX (void)
+{
+  glFinishTextureSUNX = (PFNGLFINISHTEXTURESUNXPROC)glewGetProcAddress((const GLubyte*)"glFinishTextureSUNX");
+  glFinishTextureSUNX();
+}
+
+
+static void GLAPIENTRY _glewLazy_glGlobalAlphaFactorbSUN (GLbyte factor)
+{
+  glGlobalAlphaFactorbSUN = (PFNGLGLOBALALPHAFACTORBSUNPROC)glewGetProcAddress((const GLubyte*)"glGlobalAlphaFactorbSUN");
+  glGlobalAlphaFactorbSUN(factor);
+}
+
+static void GLAPIENTRY _glewLazy_glGlobalAlphaFactordSUN (GLdouble factor)
+{
+  glGlobalAlphaFactordSUN = (PFNGLGLOBALALPHAFACTORDSUNPROC)glewGetProcAddress((const GLubyte*)"glGlobalAlphaFactordSUN");
+  glGlobalAlphaFactordSUN(factor);
+}
+
+static void GLAPIENTRY _glewLazy_glGlobalAlphaFactorfSUN (GLfloat factor)
+{
+  glGlobalAlphaFactorfSUN = (PFNGLGLOBALALPHAFACTORFSUNPROC)glewGetProcAddress((const GLubyte*)"glGlobalAlphaFactorfSUN");
+  glGlobalAlphaFactorfSUN(factor);
+}
+
+static void GLAPIENTRY _glewLazy_glGlobalAlphaFactoriSUN (GLint factor)
+{
+  glGlobalAlphaFactoriSUN = (PFNGLGLOBALALPHAFACTORISUNPROC)glewGetProcAddress((const GLubyte*)"glGlobalAlphaFactoriSUN");
+  glGlobalAlphaFactoriSUN(factor);
+}
+
+static void GLAPIENTRY _glewLazy_glGlobalAlphaFactorsSUN (GLshort factor)
+{
+  glGlobalAlphaFactorsSUN = (PFNGLGLOBALALPHAFACTORSSUNPROC)glewGetProcAddress((const GLubyte*)"glGlobalAlphaFactorsSUN");
+  glGlobalAlphaFactorsSUN(factor);
+}
+
+static void GLAPIENTRY _glewLazy_glGlobalAlphaFactorubSUN (GLubyte factor)
+{
+  glGlobalAlphaFactorubSUN = (PFNGLGLOBALALPHAFACTORUBSUNPROC)glewGetProcAddress((const GLubyte*)"glGlobalAlphaFactorubSUN");
+  glGlobalAlphaFactorubSUN(factor);
+}
+
+static void GLAPIENTRY _glewLazy_glGlobalAlphaFactoruiSUN (GLuint factor)
+{
+  glGlobalAlphaFactoruiSUN = (PFNGLGLOBALALPHAFACTORUISUNPROC)glewGetProcAddress((const GLubyte*)"glGlobalAlphaFactoruiSUN");
+  glGlobalAlphaFactoruiSUN(factor);
+}
+
+static void GLAPIENTRY _glewLazy_glGlobalAlphaFactorusSUN (GLushort factor)
+{
+  glGlobalAlphaFactorusSUN = (PFNGLGLOBALALPHAFACTORUSSUNPROC)glewGetProcAddress((const GLubyte*)"glGlobalAlphaFactorusSUN");
+  glGlobalAlphaFactorusSUN(factor);
+}
+
+
+static void GLAPIENTRY _glewLazy_glReadVideoPixelsSUN (GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void* pixels)
+{
+  glReadVideoPixelsSUN = (PFNGLREADVIDEOPIXELSSUNPROC)glewGetProcAddress((const GLubyte*)"glReadVideoPixelsSUN");
+  glReadVideoPixelsSUN(x, y, width, height, format, type, pixels);
+}
+
+
+static void GLAPIENTRY _glewLazy_glReplacementCodePointerSUN (GLenum type, GLsizei stride, const void *pointer)
+{
+  glReplacementCodePointerSUN = (PFNGLREPLACEMENTCODEPOINTERSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodePointerSUN");
+  glReplacementCodePointerSUN(type, stride, pointer);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeubSUN (GLubyte code)
+{
+  glReplacementCodeubSUN = (PFNGLREPLACEMENTCODEUBSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeubSUN");
+  glReplacementCodeubSUN(code);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeubvSUN (const GLubyte* code)
+{
+  glReplacementCodeubvSUN = (PFNGLREPLACEMENTCODEUBVSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeubvSUN");
+  glReplacementCodeubvSUN(code);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiSUN (GLuint code)
+{
+  glReplacementCodeuiSUN = (PFNGLREPLACEMENTCODEUISUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiSUN");
+  glReplacementCodeuiSUN(code);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuivSUN (const GLuint* code)
+{
+  glReplacementCodeuivSUN = (PFNGLREPLACEMENTCODEUIVSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuivSUN");
+  glReplacementCodeuivSUN(code);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeusSUN (GLushort code)
+{
+  glReplacementCodeusSUN = (PFNGLREPLACEMENTCODEUSSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeusSUN");
+  glReplacementCodeusSUN(code);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeusvSUN (const GLushort* code)
+{
+  glReplacementCodeusvSUN = (PFNGLREPLACEMENTCODEUSVSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeusvSUN");
+  glReplacementCodeusvSUN(code);
+}
+
+
+static void GLAPIENTRY _glewLazy_glColor3fVertex3fSUN (GLfloat r, GLfloat g, GLfloat b, GLfloat x, GLfloat y, GLfloat z)
+{
+  glColor3fVertex3fSUN = (PFNGLCOLOR3FVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glColor3fVertex3fSUN");
+  glColor3fVertex3fSUN(r, g, b, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glColor3fVertex3fvSUN (const GLfloat* c, const GLfloat *v)
+{
+  glColor3fVertex3fvSUN = (PFNGLCOLOR3FVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glColor3fVertex3fvSUN");
+  glColor3fVertex3fvSUN(c, v);
+}
+
+static void GLAPIENTRY _glewLazy_glColor4fNormal3fVertex3fSUN (GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z)
+{
+  glColor4fNormal3fVertex3fSUN = (PFNGLCOLOR4FNORMAL3FVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glColor4fNormal3fVertex3fSUN");
+  glColor4fNormal3fVertex3fSUN(r, g, b, a, nx, ny, nz, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glColor4fNormal3fVertex3fvSUN (const GLfloat* c, const GLfloat *n, const GLfloat *v)
+{
+  glColor4fNormal3fVertex3fvSUN = (PFNGLCOLOR4FNORMAL3FVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glColor4fNormal3fVertex3fvSUN");
+  glColor4fNormal3fVertex3fvSUN(c, n, v);
+}
+
+static void GLAPIENTRY _glewLazy_glColor4ubVertex2fSUN (GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y)
+{
+  glColor4ubVertex2fSUN = (PFNGLCOLOR4UBVERTEX2FSUNPROC)glewGetProcAddress((const GLubyte*)"glColor4ubVertex2fSUN");
+  glColor4ubVertex2fSUN(r, g, b, a, x, y);
+}
+
+static void GLAPIENTRY _glewLazy_glColor4ubVertex2fvSUN (const GLubyte* c, const GLfloat *v)
+{
+  glColor4ubVertex2fvSUN = (PFNGLCOLOR4UBVERTEX2FVSUNPROC)glewGetProcAddress((const GLubyte*)"glColor4ubVertex2fvSUN");
+  glColor4ubVertex2fvSUN(c, v);
+}
+
+static void GLAPIENTRY _glewLazy_glColor4ubVertex3fSUN (GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y, GLfloat z)
+{
+  glColor4ubVertex3fSUN = (PFNGLCOLOR4UBVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glColor4ubVertex3fSUN");
+  glColor4ubVertex3fSUN(r, g, b, a, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glColor4ubVertex3fvSUN (const GLubyte* c, const GLfloat *v)
+{
+  glColor4ubVertex3fvSUN = (PFNGLCOLOR4UBVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glColor4ubVertex3fvSUN");
+  glColor4ubVertex3fvSUN(c, v);
+}
+
+static void GLAPIENTRY _glewLazy_glNormal3fVertex3fSUN (GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z)
+{
+  glNormal3fVertex3fSUN = (PFNGLNORMAL3FVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glNormal3fVertex3fSUN");
+  glNormal3fVertex3fSUN(nx, ny, nz, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glNormal3fVertex3fvSUN (const GLfloat* n, const GLfloat *v)
+{
+  glNormal3fVertex3fvSUN = (PFNGLNORMAL3FVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glNormal3fVertex3fvSUN");
+  glNormal3fVertex3fvSUN(n, v);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiColor3fVertex3fSUN (GLuint rc, GLfloat r, GLfloat g, GLfloat b, GLfloat x, GLfloat y, GLfloat z)
+{
+  glReplacementCodeuiColor3fVertex3fSUN = (PFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiColor3fVertex3fSUN");
+  glReplacementCodeuiColor3fVertex3fSUN(rc, r, g, b, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiColor3fVertex3fvSUN (const GLuint* rc, const GLfloat *c, const GLfloat *v)
+{
+  glReplacementCodeuiColor3fVertex3fvSUN = (PFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiColor3fVertex3fvSUN");
+  glReplacementCodeuiColor3fVertex3fvSUN(rc, c, v);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiColor4fNormal3fVertex3fSUN (GLuint rc, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z)
+{
+  glReplacementCodeuiColor4fNormal3fVertex3fSUN = (PFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiColor4fNormal3fVertex3fSUN");
+  glReplacementCodeuiColor4fNormal3fVertex3fSUN(rc, r, g, b, a, nx, ny, nz, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiColor4fNormal3fVertex3fvSUN (const GLuint* rc, const GLfloat *c, const GLfloat *n, const GLfloat *v)
+{
+  glReplacementCodeuiColor4fNormal3fVertex3fvSUN = (PFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiColor4fNormal3fVertex3fvSUN");
+  glReplacementCodeuiColor4fNormal3fVertex3fvSUN(rc, c, n, v);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiColor4ubVertex3fSUN (GLuint rc, GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y, GLfloat z)
+{
+  glReplacementCodeuiColor4ubVertex3fSUN = (PFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiColor4ubVertex3fSUN");
+  glReplacementCodeuiColor4ubVertex3fSUN(rc, r, g, b, a, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiColor4ubVertex3fvSUN (const GLuint* rc, const GLubyte *c, const GLfloat *v)
+{
+  glReplacementCodeuiColor4ubVertex3fvSUN = (PFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiColor4ubVertex3fvSUN");
+  glReplacementCodeuiColor4ubVertex3fvSUN(rc, c, v);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiNormal3fVertex3fSUN (GLuint rc, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z)
+{
+  glReplacementCodeuiNormal3fVertex3fSUN = (PFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiNormal3fVertex3fSUN");
+  glReplacementCodeuiNormal3fVertex3fSUN(rc, nx, ny, nz, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiNormal3fVertex3fvSUN (const GLuint* rc, const GLfloat *n, const GLfloat *v)
+{
+  glReplacementCodeuiNormal3fVertex3fvSUN = (PFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiNormal3fVertex3fvSUN");
+  glReplacementCodeuiNormal3fVertex3fvSUN(rc, n, v);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN (GLuint rc, GLfloat s, GLfloat t, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z)
+{
+  glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN = (PFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN");
+  glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN(rc, s, t, r, g, b, a, nx, ny, nz, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN (const GLuint* rc, const GLfloat *tc, const GLfloat *c, const GLfloat *n, const GLfloat *v)
+{
+  glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN = (PFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN");
+  glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN(rc, tc, c, n, v);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN (GLuint rc, GLfloat s, GLfloat t, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z)
+{
+  glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN = (PFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN");
+  glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN(rc, s, t, nx, ny, nz, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN (const GLuint* rc, const GLfloat *tc, const GLfloat *n, const GLfloat *v)
+{
+  glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN = (PFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN");
+  glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN(rc, tc, n, v);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiTexCoord2fVertex3fSUN (GLuint rc, GLfloat s, GLfloat t, GLfloat x, GLfloat y, GLfloat z)
+{
+  glReplacementCodeuiTexCoord2fVertex3fSUN = (PFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiTexCoord2fVertex3fSUN");
+  glReplacementCodeuiTexCoord2fVertex3fSUN(rc, s, t, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiTexCoord2fVertex3fvSUN (const GLuint* rc, const GLfloat *tc, const GLfloat *v)
+{
+  glReplacementCodeuiTexCoord2fVertex3fvSUN = (PFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiTexCoord2fVertex3fvSUN");
+  glReplacementCodeuiTexCoord2fVertex3fvSUN(rc, tc, v);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiVertex3fSUN (GLuint rc, GLfloat x, GLfloat y, GLfloat z)
+{
+  glReplacementCodeuiVertex3fSUN = (PFNGLREPLACEMENTCODEUIVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiVertex3fSUN");
+  glReplacementCodeuiVertex3fSUN(rc, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glReplacementCodeuiVertex3fvSUN (const GLuint* rc, const GLfloat *v)
+{
+  glReplacementCodeuiVertex3fvSUN = (PFNGLREPLACEMENTCODEUIVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glReplacementCodeuiVertex3fvSUN");
+  glReplacementCodeuiVertex3fvSUN(rc, v);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord2fColor3fVertex3fSUN (GLfloat s, GLfloat t, GLfloat r, GLfloat g, GLfloat b, GLfloat x, GLfloat y, GLfloat z)
+{
+  glTexCoord2fColor3fVertex3fSUN = (PFNGLTEXCOORD2FCOLOR3FVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glTexCoord2fColor3fVertex3fSUN");
+  glTexCoord2fColor3fVertex3fSUN(s, t, r, g, b, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord2fColor3fVertex3fvSUN (const GLfloat* tc, const GLfloat *c, const GLfloat *v)
+{
+  glTexCoord2fColor3fVertex3fvSUN = (PFNGLTEXCOORD2FCOLOR3FVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glTexCoord2fColor3fVertex3fvSUN");
+  glTexCoord2fColor3fVertex3fvSUN(tc, c, v);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord2fColor4fNormal3fVertex3fSUN (GLfloat s, GLfloat t, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z)
+{
+  glTexCoord2fColor4fNormal3fVertex3fSUN = (PFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glTexCoord2fColor4fNormal3fVertex3fSUN");
+  glTexCoord2fColor4fNormal3fVertex3fSUN(s, t, r, g, b, a, nx, ny, nz, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord2fColor4fNormal3fVertex3fvSUN (const GLfloat* tc, const GLfloat *c, const GLfloat *n, const GLfloat *v)
+{
+  glTexCoord2fColor4fNormal3fVertex3fvSUN = (PFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glTexCoord2fColor4fNormal3fVertex3fvSUN");
+  glTexCoord2fColor4fNormal3fVertex3fvSUN(tc, c, n, v);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord2fColor4ubVertex3fSUN (GLfloat s, GLfloat t, GLubyte r, GLubyte g, GLubyte b, GLubyte a, GLfloat x, GLfloat y, GLfloat z)
+{
+  glTexCoord2fColor4ubVertex3fSUN = (PFNGLTEXCOORD2FCOLOR4UBVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glTexCoord2fColor4ubVertex3fSUN");
+  glTexCoord2fColor4ubVertex3fSUN(s, t, r, g, b, a, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord2fColor4ubVertex3fvSUN (const GLfloat* tc, const GLubyte *c, const GLfloat *v)
+{
+  glTexCoord2fColor4ubVertex3fvSUN = (PFNGLTEXCOORD2FCOLOR4UBVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glTexCoord2fColor4ubVertex3fvSUN");
+  glTexCoord2fColor4ubVertex3fvSUN(tc, c, v);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord2fNormal3fVertex3fSUN (GLfloat s, GLfloat t, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z)
+{
+  glTexCoord2fNormal3fVertex3fSUN = (PFNGLTEXCOORD2FNORMAL3FVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glTexCoord2fNormal3fVertex3fSUN");
+  glTexCoord2fNormal3fVertex3fSUN(s, t, nx, ny, nz, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord2fNormal3fVertex3fvSUN (const GLfloat* tc, const GLfloat *n, const GLfloat *v)
+{
+  glTexCoord2fNormal3fVertex3fvSUN = (PFNGLTEXCOORD2FNORMAL3FVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glTexCoord2fNormal3fVertex3fvSUN");
+  glTexCoord2fNormal3fVertex3fvSUN(tc, n, v);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord2fVertex3fSUN (GLfloat s, GLfloat t, GLfloat x, GLfloat y, GLfloat z)
+{
+  glTexCoord2fVertex3fSUN = (PFNGLTEXCOORD2FVERTEX3FSUNPROC)glewGetProcAddress((const GLubyte*)"glTexCoord2fVertex3fSUN");
+  glTexCoord2fVertex3fSUN(s, t, x, y, z);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord2fVertex3fvSUN (const GLfloat* tc, const GLfloat *v)
+{
+  glTexCoord2fVertex3fvSUN = (PFNGLTEXCOORD2FVERTEX3FVSUNPROC)glewGetProcAddress((const GLubyte*)"glTexCoord2fVertex3fvSUN");
+  glTexCoord2fVertex3fvSUN(tc, v);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord4fColor4fNormal3fVertex4fSUN (GLfloat s, GLfloat t, GLfloat p, GLfloat q, GLfloat r, GLfloat g, GLfloat b, GLfloat a, GLfloat nx, GLfloat ny, GLfloat nz, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+  glTexCoord4fColor4fNormal3fVertex4fSUN = (PFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FSUNPROC)glewGetProcAddress((const GLubyte*)"glTexCoord4fColor4fNormal3fVertex4fSUN");
+  glTexCoord4fColor4fNormal3fVertex4fSUN(s, t, p, q, r, g, b, a, nx, ny, nz, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord4fColor4fNormal3fVertex4fvSUN (const GLfloat* tc, const GLfloat *c, const GLfloat *n, const GLfloat *v)
+{
+  glTexCoord4fColor4fNormal3fVertex4fvSUN = (PFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FVSUNPROC)glewGetProcAddress((const GLubyte*)"glTexCoord4fColor4fNormal3fVertex4fvSUN");
+  glTexCoord4fColor4fNormal3fVertex4fvSUN(tc, c, n, v);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord4fVertex4fSUN (GLfloat s, GLfloat t, GLfloat p, GLfloat q, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
+{
+  glTexCoord4fVertex4fSUN = (PFNGLTEXCOORD4FVERTEX4FSUNPROC)glewGetProcAddress((const GLubyte*)"glTexCoord4fVertex4fSUN");
+  glTexCoord4fVertex4fSUN(s, t, p, q, x, y, z, w);
+}
+
+static void GLAPIENTRY _glewLazy_glTexCoord4fVertex4fvSUN (const GLfloat* tc, const GLfloat *v)
+{
+  glTexCoord4fVertex4fvSUN = (PFNGLTEXCOORD4FVERTEX4FVSUNPROC)glewGetProcAddress((const GLubyte*)"glTexCoord4fVertex4fvSUN");
+  glTexCoord4fVertex4fvSUN(tc, v);
+}
+
+
+static void GLAPIENTRY _glewLazy_glAddSwapHintRectWIN (GLint x, GLint y, GLsizei width, GLsizei height)
+{
+  glAddSwapHintRectWIN = (PFNGLADDSWAPHINTRECTWINPROC)glewGetProcAddress((const GLubyte*)"glAddSwapHintRectWIN");
+  glAddSwapHintRectWIN(x, y, width, height);
+}
+
+
+PFNGLTBUFFERMASK3DFXPROC __glewTbufferMask3DFX = _glewLazy_glTbufferMask3DFX;
+
+PFNGLDEBUGMESSAGECALLBACKAMDPROC __glewDebugMessageCallbackAMD = _glewLazy_glDebugMessageCallbackAMD;
+PFNGLDEBUGMESSAGEENABLEAMDPROC __glewDebugMessageEnableAMD = _glewLazy_glDebugMessageEnableAMD;
+PFNGLDEBUGMESSAGEINSERTAMDPROC __glewDebugMessageInsertAMD = _glewLazy_glDebugMessageInsertAMD;
+PFNGLGETDEBUGMESSAGELOGAMDPROC __glewGetDebugMessageLogAMD = _glewLazy_glGetDebugMessageLogAMD;
+
+PFNGLBLENDEQUATIONINDEXEDAMDPROC __glewBlendEquationIndexedAMD = _glewLazy_glBlendEquationIndexedAMD;
+PFNGLBLENDEQUATIONSEPARATEINDEXEDAMDPROC __glewBlendEquationSeparateIndexedAMD = _glewLazy_glBlendEquationSeparateIndexedAMD;
+PFNGLBLENDFUNCINDEXEDAMDPROC __glewBlendFuncIndexedAMD = _glewLazy_glBlendFuncIndexedAMD;
+PFNGLBLENDFUNCSEPARATEINDEXEDAMDPROC __glewBlendFuncSeparateIndexedAMD = _glewLazy_glBlendFuncSeparateIndexedAMD;
+
+PFNGLVERTEXATTRIBPARAMETERIAMDPROC __glewVertexAttribParameteriAMD = _glewLazy_glVertexAttribParameteriAMD;
+
+PFNGLMULTIDRAWARRAYSINDIRECTAMDPROC __glewMultiDrawArraysIndirectAMD = _glewLazy_glMultiDrawArraysIndirectAMD;
+PFNGLMULTIDRAWELEMENTSINDIRECTAMDPROC __glewMultiDrawElementsIndirectAMD = _glewLazy_glMultiDrawElementsIndirectAMD;
+
+PFNGLDELETENAMESAMDPROC __glewDeleteNamesAMD = _glewLazy_glDeleteNamesAMD;
+PFNGLGENNAMESAMDPROC __glewGenNamesAMD = _glewLazy_glGenNamesAMD;
+PFNGLISNAMEAMDPROC __glewIsNameAMD = _glewLazy_glIsNameAMD;
+
+PFNGLQUERYOBJECTPARAMETERUIAMDPROC __glewQueryObjectParameteruiAMD = _glewLazy_glQueryObjectParameteruiAMD;
+
+PFNGLBEGINPERFMONITORAMDPROC __glewBeginPerfMonitorAMD = _glewLazy_glBeginPerfMonitorAMD;
+PFNGLDELETEPERFMONITORSAMDPROC __glewDeletePerfMonitorsAMD = _glewLazy_glDeletePerfMonitorsAMD;
+PFNGLENDPERFMONITORAMDPROC __glewEndPerfMonitorAMD = _glewLazy_glEndPerfMonitorAMD;
+PFNGLGENPERFMONITORSAMDPROC __glewGenPerfMonitorsAMD = _glewLazy_glGenPerfMonitorsAMD;
+PFNGLGETPERFMONITORCOUNTERDATAAMDPROC __glewGetPerfMonitorCounterDataAMD = _glewLazy_glGetPerfMonitorCounterDataAMD;
+PFNGLGETPERFMONITORCOUNTERINFOAMDPROC __glewGetPerfMonitorCounterInfoAMD = _glewLazy_glGetPerfMonitorCounterInfoAMD;
+PFNGLGETPERFMONITORCOUNTERSTRINGAMDPROC __glewGetPerfMonitorCounterStringAMD = _glewLazy_glGetPerfMonitorCounterStringAMD;
+PFNGLGETPERFMONITORCOUNTERSAMDPROC __glewGetPerfMonitorCountersAMD = _glewLazy_glGetPerfMonitorCountersAMD;
+PFNGLGETPERFMONITORGROUPSTRINGAMDPROC __glewGetPerfMonitorGroupStringAMD = _glewLazy_glGetPerfMonitorGroupStringAMD;
+PFNGLGETPERFMONITORGROUPSAMDPROC __glewGetPerfMonitorGroupsAMD = _glewLazy_glGetPerfMonitorGroupsAMD;
+PFNGLSELECTPERFMONITORCOUNTERSAMDPROC __glewSelectPerfMonitorCountersAMD = _glewLazy_glSelectPerfMonitorCountersAMD;
+
+PFNGLSETMULTISAMPLEFVAMDPROC __glewSetMultisamplefvAMD = _glewLazy_glSetMultisamplefvAMD;
+
+PFNGLTEXSTORAGESPARSEAMDPROC __glewTexStorageSparseAMD = _glewLazy_glTexStorageSparseAMD;
+PFNGLTEXTURESTORAGESPARSEAMDPROC __glewTextureStorageSparseAMD = _glewLazy_glTextureStorageSparseAMD;
+
+PFNGLSTENCILOPVALUEAMDPROC __glewStencilOpValueAMD = _glewLazy_glStencilOpValueAMD;
+
+PFNGLTESSELLATIONFACTORAMDPROC __glewTessellationFactorAMD = _glewLazy_glTessellationFactorAMD;
+PFNGLTESSELLATIONMODEAMDPROC __glewTessellationModeAMD = _glewLazy_glTessellationModeAMD;
+
+PFNGLBLITFRAMEBUFFERANGLEPROC __glewBlitFramebufferANGLE = _glewLazy_glBlitFramebufferANGLE;
+
+PFNGLRENDERBUFFERSTORAGEMULTISAMPLEANGLEPROC __glewRenderbufferStorageMultisampleANGLE = _glewLazy_glRenderbufferStorageMultisampleANGLE;
+
+PFNGLDRAWARRAYSINSTANCEDANGLEPROC __glewDrawArraysInstancedANGLE = _glewLazy_glDrawArraysInstancedANGLE;
+PFNGLDRAWELEMENTSINSTANCEDANGLEPROC __glewDrawElementsInstancedANGLE = _glewLazy_glDrawElementsInstancedANGLE;
+PFNGLVERTEXATTRIBDIVISORANGLEPROC __glewVertexAttribDivisorANGLE = _glewLazy_glVertexAttribDivisorANGLE;
+
+PFNGLBEGINQUERYANGLEPROC __glewBeginQueryANGLE = _glewLazy_glBeginQueryANGLE;
+PFNGLDELETEQUERIESANGLEPROC __glewDeleteQueriesANGLE = _glewLazy_glDeleteQueriesANGLE;
+PFNGLENDQUERYANGLEPROC __glewEndQueryANGLE = _glewLazy_glEndQueryANGLE;
+PFNGLGENQUERIESANGLEPROC __glewGenQueriesANGLE = _glewLazy_glGenQueriesANGLE;
+PFNGLGETQUERYOBJECTI64VANGLEPROC __glewGetQueryObjecti64vANGLE = _glewLazy_glGetQueryObjecti64vANGLE;
+PFNGLGETQUERYOBJECTIVANGLEPROC __glewGetQueryObjectivANGLE = _glewLazy_glGetQueryObjectivANGLE;
+PFNGLGETQUERYOBJECTUI64VANGLEPROC __glewGetQueryObjectui64vANGLE = _glewLazy_glGetQueryObjectui64vANGLE;
+PFNGLGETQUERYOBJECTUIVANGLEPROC __glewGetQueryObjectuivANGLE = _glewLazy_glGetQueryObjectuivANGLE;
+PFNGLGETQUERYIVANGLEPROC __glewGetQueryivANGLE = _glewLazy_glGetQueryivANGLE;
+PFNGLISQUERYANGLEPROC __glewIsQueryANGLE = _glewLazy_glIsQueryANGLE;
+PFNGLQUERYCOUNTERANGLEPROC __glewQueryCounterANGLE = _glewLazy_glQueryCounterANGLE;
+
+PFNGLGETTRANSLATEDSHADERSOURCEANGLEPROC __glewGetTranslatedShaderSourceANGLE = _glewLazy_glGetTranslatedShaderSourceANGLE;
+
+PFNGLDRAWELEMENTARRAYAPPLEPROC __glewDrawElementArrayAPPLE = _glewLazy_glDrawElementArrayAPPLE;
+PFNGLDRAWRANGEELEMENTARRAYAPPLEPROC __glewDrawRangeElementArrayAPPLE = _glewLazy_glDrawRangeElementArrayAPPLE;
+PFNGLELEMENTPOINTERAPPLEPROC __glewElementPointerAPPLE = _glewLazy_glElementPointerAPPLE;
+PFNGLMULTIDRAWELEMENTARRAYAPPLEPROC __glewMultiDrawElementArrayAPPLE = _glewLazy_glMultiDrawElementArrayAPPLE;
+PFNGLMULTIDRAWRANGEELEMENTARRAYAPPLEPROC __glewMultiDrawRangeElementArrayAPPLE = _glewLazy_glMultiDrawRangeElementArrayAPPLE;
+
+PFNGLDELETEFENCESAPPLEPROC __glewDeleteFencesAPPLE = _glewLazy_glDeleteFencesAPPLE;
+PFNGLFINISHFENCEAPPLEPROC __glewFinishFenceAPPLE = _glewLazy_glFinishFenceAPPLE;
+PFNGLFINISHOBJECTAPPLEPROC __glewFinishObjectAPPLE = _glewLazy_glFinishObjectAPPLE;
+PFNGLGENFENCESAPPLEPROC __glewGenFencesAPPLE = _glewLazy_glGenFencesAPPLE;
+PFNGLISFENCEAPPLEPROC __glewIsFenceAPPLE = _glewLazy_glIsFenceAPPLE;
+PFNGLSETFENCEAPPLEPROC __glewSetFenceAPPLE = _glewLazy_glSetFenceAPPLE;
+PFNGLTESTFENCEAPPLEPROC __glewTestFenceAPPLE = _glewLazy_glTestFenceAPPLE;
+PFNGLTESTOBJECTAPPLEPROC __glewTestObjectAPPLE = _glewLazy_glTestObjectAPPLE;
+
+PFNGLBUFFERPARAMETERIAPPLEPROC __glewBufferParameteriAPPLE = _glewLazy_glBufferParameteriAPPLE;
+PFNGLFLUSHMAPPEDBUFFERRANGEAPPLEPROC __glewFlushMappedBufferRangeAPPLE = _glewLazy_glFlushMappedBufferRangeAPPLE;
+
+PFNGLGETOBJECTPARAMETERIVAPPLEPROC __glewGetObjectParameterivAPPLE = _glewLazy_glGetObjectParameterivAPPLE;
+PFNGLOBJECTPURGEABLEAPPLEPROC __glewObjectPurgeableAPPLE = _glewLazy_glObjectPurgeableAPPLE;
+PFNGLOBJECTUNPURGEABLEAPPLEPROC __glewObjectUnpurgeableAPPLE = _glewLazy_glObjectUnpurgeableAPPLE;
+
+PFNGLGETTEXPARAMETERPOINTERVAPPLEPROC __glewGetTexParameterPointervAPPLE = _glewLazy_glGetTexParameterPointervAPPLE;
+PFNGLTEXTURERANGEAPPLEPROC __glewTextureRangeAPPLE = _glewLazy_glTextureRangeAPPLE;
+
+PFNGLBINDVERTEXARRAYAPPLEPROC __glewBindVertexArrayAPPLE = _glewLazy_glBindVertexArrayAPPLE;
+PFNGLDELETEVERTEXARRAYSAPPLEPROC __glewDeleteVertexArraysAPPLE = _glewLazy_glDeleteVertexArraysAPPLE;
+PFNGLGENVERTEXARRAYSAPPLEPROC __glewGenVertexArraysAPPLE = _glewLazy_glGenVertexArraysAPPLE;
+PFNGLISVERTEXARRAYAPPLEPROC __glewIsVertexArrayAPPLE = _glewLazy_glIsVertexArrayAPPLE;
+
+PFNGLFLUSHVERTEXARRAYRANGEAPPLEPROC __glewFlushVertexArrayRangeAPPLE = _glewLazy_glFlushVertexArrayRangeAPPLE;
+PFNGLVERTEXARRAYPARAMETERIAPPLEPROC __glewVertexArrayParameteriAPPLE = _glewLazy_glVertexArrayParameteriAPPLE;
+PFNGLVERTEXARRAYRANGEAPPLEPROC __glewVertexArrayRangeAPPLE = _glewLazy_glVertexArrayRangeAPPLE;
+
+PFNGLDISABLEVERTEXATTRIBAPPLEPROC __glewDisableVertexAttribAPPLE = _glewLazy_glDisableVertexAttribAPPLE;
+PFNGLENABLEVERTEXATTRIBAPPLEPROC __glewEnableVertexAttribAPPLE = _glewLazy_glEnableVertexAttribAPPLE;
+PFNGLISVERTEXATTRIBENABLEDAPPLEPROC __glewIsVertexAttribEnabledAPPLE = _glewLazy_glIsVertexAttribEnabledAPPLE;
+PFNGLMAPVERTEXATTRIB1DAPPLEPROC __glewMapVertexAttrib1dAPPLE = _glewLazy_glMapVertexAttrib1dAPPLE;
+PFNGLMAPVERTEXATTRIB1FAPPLEPROC __glewMapVertexAttrib1fAPPLE = _glewLazy_glMapVertexAttrib1fAPPLE;
+PFNGLMAPVERTEXATTRIB2DAPPLEPROC __glewMapVertexAttrib2dAPPLE = _glewLazy_glMapVertexAttrib2dAPPLE;
+PFNGLMAPVERTEXATTRIB2FAPPLEPROC __glewMapVertexAttrib2fAPPLE = _glewLazy_glMapVertexAttrib2fAPPLE;
+
+PFNGLCLEARDEPTHFPROC __glewClearDepthf = _glewLazy_glClearDepthf;
+PFNGLDEPTHRANGEFPROC __glewDepthRangef = _glewLazy_glDepthRangef;
+PFNGLGETSHADERPRECISIONFORMATPROC __glewGetShaderPrecisionFormat = _glewLazy_glGetShaderPrecisionFormat;
+PFNGLRELEASESHADERCOMPILERPROC __glewReleaseShaderCompiler = _glewLazy_glReleaseShaderCompiler;
+PFNGLSHADERBINARYPROC __glewShaderBinary = _glewLazy_glShaderBinary;
+
+PFNGLMEMORYBARRIERBYREGIONPROC __glewMemoryBarrierByRegion = _glewLazy_glMemoryBarrierByRegion;
+
+PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC __glewDrawArraysInstancedBaseInstance = _glewLazy_glDrawArraysInstancedBaseInstance;
+PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC __glewDrawElementsInstancedBaseInstance = _glewLazy_glDrawElementsInstancedBaseInstance;
+PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC __glewDrawElementsInstancedBaseVertexBaseInstance = _glewLazy_glDrawElementsInstancedBaseVertexBaseInstance;
+
+PFNGLGETIMAGEHANDLEARBPROC __glewGetImageHandleARB = _glewLazy_glGetImageHandleARB;
+PFNGLGETTEXTUREHANDLEARBPROC __glewGetTextureHandleARB = _glewLazy_glGetTextureHandleARB;
+PFNGLGETTEXTURESAMPLERHANDLEARBPROC __glewGetTextureSamplerHandleARB = _glewLazy_glGetTextureSamplerHandleARB;
+PFNGLGETVERTEXATTRIBLUI64VARBPROC __glewGetVertexAttribLui64vARB = _glewLazy_glGetVertexAttribLui64vARB;
+PFNGLISIMAGEHANDLERESIDENTARBPROC __glewIsImageHandleResidentARB = _glewLazy_glIsImageHandleResidentARB;
+PFNGLISTEXTUREHANDLERESIDENTARBPROC __glewIsTextureHandleResidentARB = _glewLazy_glIsTextureHandleResidentARB;
+PFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC __glewMakeImageHandleNonResidentARB = _glewLazy_glMakeImageHandleNonResidentARB;
+PFNGLMAKEIMAGEHANDLERESIDENTARBPROC __glewMakeImageHandleResidentARB = _glewLazy_glMakeImageHandleResidentARB;
+PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC __glewMakeTextureHandleNonResidentARB = _glewLazy_glMakeTextureHandleNonResidentARB;
+PFNGLMAKETEXTUREHANDLERESIDENTARBPROC __glewMakeTextureHandleResidentARB = _glewLazy_glMakeTextureHandleResidentARB;
+PFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC __glewProgramUniformHandleui64ARB = _glewLazy_glProgramUniformHandleui64ARB;
+PFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC __glewProgramUniformHandleui64vARB = _glewLazy_glProgramUniformHandleui64vARB;
+PFNGLUNIFORMHANDLEUI64ARBPROC __glewUniformHandleui64ARB = _glewLazy_glUniformHandleui64ARB;
+PFNGLUNIFORMHANDLEUI64VARBPROC __glewUniformHandleui64vARB = _glewLazy_glUniformHandleui64vARB;
+PFNGLVERTEXATTRIBL1UI64ARBPROC __glewVertexAttribL1ui64ARB = _glewLazy_glVertexAttribL1ui64ARB;
+PFNGLVERTEXATTRIBL1UI64VARBPROC __glewVertexAttribL1ui64vARB = _glewLazy_glVertexAttribL1ui64vARB;
+
+PFNGLBINDFRAGDATALOCATIONINDEXEDPROC __glewBindFragDataLocationIndexed = _glewLazy_glBindFragDataLocationIndexed;
+PFNGLGETFRAGDATAINDEXPROC __glewGetFragDataIndex = _glewLazy_glGetFragDataIndex;
+
+PFNGLBUFFERSTORAGEPROC __glewBufferStorage = _glewLazy_glBufferStorage;
+PFNGLNAMEDBUFFERSTORAGEEXTPROC __glewNamedBufferStorageEXT = _glewLazy_glNamedBufferStorageEXT;
+
+PFNGLCREATESYNCFROMCLEVENTARBPROC __glewCreateSyncFromCLeventARB = _glewLazy_glCreateSyncFromCLeventARB;
+
+PFNGLCLEARBUFFERDATAPROC __glewClearBufferData = _glewLazy_glClearBufferData;
+PFNGLCLEARBUFFERSUBDATAPROC __glewClearBufferSubData = _glewLazy_glClearBufferSubData;
+PFNGLCLEARNAMEDBUFFERDATAEXTPROC __glewClearNamedBufferDataEXT = _glewLazy_glClearNamedBufferDataEXT;
+PFNGLCLEARNAMEDBUFFERSUBDATAEXTPROC __glewClearNamedBufferSubDataEXT = _glewLazy_glClearNamedBufferSubDataEXT;
+
+PFNGLCLEARTEXIMAGEPROC __glewClearTexImage = _glewLazy_glClearTexImage;
+PFNGLCLEARTEXSUBIMAGEPROC __glewClearTexSubImage = _glewLazy_glClearTexSubImage;
+
+PFNGLCLIPCONTROLPROC __glewClipControl = _glewLazy_glClipControl;
+
+PFNGLCLAMPCOLORARBPROC __glewClampColorARB = _glewLazy_glClampColorARB;
+
+PFNGLDISPATCHCOMPUTEPROC __glewDispatchCompute = _glewLazy_glDispatchCompute;
+PFNGLDISPATCHCOMPUTEINDIRECTPROC __glewDispatchComputeIndirect = _glewLazy_glDispatchComputeIndirect;
+
+PFNGLDISPATCHCOMPUTEGROUPSIZEARBPROC __glewDispatchComputeGroupSizeARB = _glewLazy_glDispatchComputeGroupSizeARB;
+
+PFNGLCOPYBUFFERSUBDATAPROC __glewCopyBufferSubData = _glewLazy_glCopyBufferSubData;
+
+PFNGLCOPYIMAGESUBDATAPROC __glewCopyImageSubData = _glewLazy_glCopyImageSubData;
+
+PFNGLDEBUGMESSAGECALLBACKARBPROC __glewDebugMessageCallbackARB = _glewLazy_glDebugMessageCallbackARB;
+PFNGLDEBUGMESSAGECONTROLARBPROC __glewDebugMessageControlARB = _glewLazy_glDebugMessageControlARB;
+PFNGLDEBUGMESSAGEINSERTARBPROC __glewDebugMessageInsertARB = _glewLazy_glDebugMessageInsertARB;
+PFNGLGETDEBUGMESSAGELOGARBPROC __glewGetDebugMessageLogARB = _glewLazy_glGetDebugMessageLogARB;
+
+PFNGLBINDTEXTUREUNITPROC __glewBindTextureUnit = _glewLazy_glBindTextureUnit;
+PFNGLBLITNAMEDFRAMEBUFFERPROC __glewBlitNamedFramebuffer = _glewLazy_glBlitNamedFramebuffer;
+PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC __glewCheckNamedFramebufferStatus = _glewLazy_glCheckNamedFramebufferStatus;
+PFNGLCLEARNAMEDBUFFERDATAPROC __glewClearNamedBufferData = _glewLazy_glClearNamedBufferData;
+PFNGLCLEARNAMEDBUFFERSUBDATAPROC __glewClearNamedBufferSubData = _glewLazy_glClearNamedBufferSubData;
+PFNGLCLEARNAMEDFRAMEBUFFERFIPROC __glewClearNamedFramebufferfi = _glewLazy_glClearNamedFramebufferfi;
+PFNGLCLEARNAMEDFRAMEBUFFERFVPROC __glewClearNamedFramebufferfv = _glewLazy_glClearNamedFramebufferfv;
+PFNGLCLEARNAMEDFRAMEBUFFERIVPROC __glewClearNamedFramebufferiv = _glewLazy_glClearNamedFramebufferiv;
+PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC __glewClearNamedFramebufferuiv = _glewLazy_glClearNamedFramebufferuiv;
+PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC __glewCompressedTextureSubImage1D = _glewLazy_glCompressedTextureSubImage1D;
+PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC __glewCompressedTextureSubImage2D = _glewLazy_glCompressedTextureSubImage2D;
+PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC __glewCompressedTextureSubImage3D = _glewLazy_glCompressedTextureSubImage3D;
+PFNGLCOPYNAMEDBUFFERSUBDATAPROC __glewCopyNamedBufferSubData = _glewLazy_glCopyNamedBufferSubData;
+PFNGLCOPYTEXTURESUBIMAGE1DPROC __glewCopyTextureSubImage1D = _glewLazy_glCopyTextureSubImage1D;
+PFNGLCOPYTEXTURESUBIMAGE2DPROC __glewCopyTextureSubImage2D = _glewLazy_glCopyTextureSubImage2D;
+PFNGLCOPYTEXTURESUBIMAGE3DPROC __glewCopyTextureSubImage3D = _glewLazy_glCopyTextureSubImage3D;
+PFNGLCREATEBUFFERSPROC __glewCreateBuffers = _glewLazy_glCreateBuffers;
+PFNGLCREATEFRAMEBUFFERSPROC __glewCreateFramebuffers = _glewLazy_glCreateFramebuffers;
+PFNGLCREATEPROGRAMPIPELINESPROC __glewCreateProgramPipelines = _glewLazy_glCreateProgramPipelines;
+PFNGLCREATEQUERIESPROC __glewCreateQueries = _glewLazy_glCreateQueries;
+PFNGLCREATERENDERBUFFERSPROC __glewCreateRenderbuffers = _glewLazy_glCreateRenderbuffers;
+PFNGLCREATESAMPLERSPROC __glewCreateSamplers = _glewLazy_glCreateSamplers;
+PFNGLCREATETEXTURESPROC __glewCreateTextures = _glewLazy_glCreateTextures;
+PFNGLCREATETRANSFORMFEEDBACKSPROC __glewCreateTransformFeedbacks = _glewLazy_glCreateTransformFeedbacks;
+PFNGLCREATEVERTEXARRAYSPROC __glewCreateVertexArrays = _glewLazy_glCreateVertexArrays;
+PFNGLDISABLEVERTEXARRAYATTRIBPROC __glewDisableVertexArrayAttrib = _glewLazy_glDisableVertexArrayAttrib;
+PFNGLENABLEVERTEXARRAYATTRIBPROC __glewEnableVertexArrayAttrib = _glewLazy_glEnableVertexArrayAttrib;
+PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC __glewFlushMappedNamedBufferRange = _glewLazy_glFlushMappedNamedBufferRange;
+PFNGLGENERATETEXTUREMIPMAPPROC __glewGenerateTextureMipmap = _glewLazy_glGenerateTextureMipmap;
+PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC __glewGetCompressedTextureImage = _glewLazy_glGetCompressedTextureImage;
+PFNGLGETNAMEDBUFFERPARAMETERI64VPROC __glewGetNamedBufferParameteri64v = _glewLazy_glGetNamedBufferParameteri64v;
+PFNGLGETNAMEDBUFFERPARAMETERIVPROC __glewGetNamedBufferParameteriv = _glewLazy_glGetNamedBufferParameteriv;
+PFNGLGETNAMEDBUFFERPOINTERVPROC __glewGetNamedBufferPointerv = _glewLazy_glGetNamedBufferPointerv;
+PFNGLGETNAMEDBUFFERSUBDATAPROC __glewGetNamedBufferSubData = _glewLazy_glGetNamedBufferSubData;
+PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC __glewGetNamedFramebufferAttachmentParameteriv = _glewLazy_glGetNamedFramebufferAttachmentParameteriv;
+PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC __glewGetNamedFramebufferParameteriv = _glewLazy_glGetNamedFramebufferParameteriv;
+PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC __glewGetNamedRenderbufferParameteriv = _glewLazy_glGetNamedRenderbufferParameteriv;
+PFNGLGETQUERYBUFFEROBJECTI64VPROC __glewGetQueryBufferObjecti64v = _glewLazy_glGetQueryBufferObjecti64v;
+PFNGLGETQUERYBUFFEROBJECTIVPROC __glewGetQueryBufferObjectiv = _glewLazy_glGetQueryBufferObjectiv;
+PFNGLGETQUERYBUFFEROBJECTUI64VPROC __glewGetQueryBufferObjectui64v = _glewLazy_glGetQueryBufferObjectui64v;
+PFNGLGETQUERYBUFFEROBJECTUIVPROC __glewGetQueryBufferObjectuiv = _glewLazy_glGetQueryBufferObjectuiv;
+PFNGLGETTEXTUREIMAGEPROC __glewGetTextureImage = _glewLazy_glGetTextureImage;
+PFNGLGETTEXTURELEVELPARAMETERFVPROC __glewGetTextureLevelParameterfv = _glewLazy_glGetTextureLevelParameterfv;
+PFNGLGETTEXTURELEVELPARAMETERIVPROC __glewGetTextureLevelParameteriv = _glewLazy_glGetTextureLevelParameteriv;
+PFNGLGETTEXTUREPARAMETERIIVPROC __glewGetTextureParameterIiv = _glewLazy_glGetTextureParameterIiv;
+PFNGLGETTEXTUREPARAMETERIUIVPROC __glewGetTextureParameterIuiv = _glewLazy_glGetTextureParameterIuiv;
+PFNGLGETTEXTUREPARAMETERFVPROC __glewGetTextureParameterfv = _glewLazy_glGetTextureParameterfv;
+PFNGLGETTEXTUREPARAMETERIVPROC __glewGetTextureParameteriv = _glewLazy_glGetTextureParameteriv;
+PFNGLGETTRANSFORMFEEDBACKI64_VPROC __glewGetTransformFeedbacki64_v = _glewLazy_glGetTransformFeedbacki64_v;
+PFNGLGETTRANSFORMFEEDBACKI_VPROC __glewGetTransformFeedbacki_v = _glewLazy_glGetTransformFeedbacki_v;
+PFNGLGETTRANSFORMFEEDBACKIVPROC __glewGetTransformFeedbackiv = _glewLazy_glGetTransformFeedbackiv;
+PFNGLGETVERTEXARRAYINDEXED64IVPROC __glewGetVertexArrayIndexed64iv = _glewLazy_glGetVertexArrayIndexed64iv;
+PFNGLGETVERTEXARRAYINDEXEDIVPROC __glewGetVertexArrayIndexediv = _glewLazy_glGetVertexArrayIndexediv;
+PFNGLGETVERTEXARRAYIVPROC __glewGetVertexArrayiv = _glewLazy_glGetVertexArrayiv;
+PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC __glewInvalidateNamedFramebufferData = _glewLazy_glInvalidateNamedFramebufferData;
+PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC __glewInvalidateNamedFramebufferSubData = _glewLazy_glInvalidateNamedFramebufferSubData;
+PFNGLMAPNAMEDBUFFERPROC __glewMapNamedBuffer = _glewLazy_glMapNamedBuffer;
+PFNGLMAPNAMEDBUFFERRANGEPROC __glewMapNamedBufferRange = _glewLazy_glMapNamedBufferRange;
+PFNGLNAMEDBUFFERDATAPROC __glewNamedBufferData = _glewLazy_glNamedBufferData;
+PFNGLNAMEDBUFFERSTORAGEPROC __glewNamedBufferStorage = _glewLazy_glNamedBufferStorage;
+PFNGLNAMEDBUFFERSUBDATAPROC __glewNamedBufferSubData = _glewLazy_glNamedBufferSubData;
+PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC __glewNamedFramebufferDrawBuffer = _glewLazy_glNamedFramebufferDrawBuffer;
+PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC __glewNamedFramebufferDrawBuffers = _glewLazy_glNamedFramebufferDrawBuffers;
+PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC __glewNamedFramebufferParameteri = _glewLazy_glNamedFramebufferParameteri;
+PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC __glewNamedFramebufferReadBuffer = _glewLazy_glNamedFramebufferReadBuffer;
+PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC __glewNamedFramebufferRenderbuffer = _glewLazy_glNamedFramebufferRenderbuffer;
+PFNGLNAMEDFRAMEBUFFERTEXTUREPROC __glewNamedFramebufferTexture = _glewLazy_glNamedFramebufferTexture;
+PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC __glewNamedFramebufferTextureLayer = _glewLazy_glNamedFramebufferTextureLayer;
+PFNGLNAMEDRENDERBUFFERSTORAGEPROC __glewNamedRenderbufferStorage = _glewLazy_glNamedRenderbufferStorage;
+PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC __glewNamedRenderbufferStorageMultisample = _glewLazy_glNamedRenderbufferStorageMultisample;
+PFNGLTEXTUREBUFFERPROC __glewTextureBuffer = _glewLazy_glTextureBuffer;
+PFNGLTEXTUREBUFFERRANGEPROC __glewTextureBufferRange = _glewLazy_glTextureBufferRange;
+PFNGLTEXTUREPARAMETERIIVPROC __glewTextureParameterIiv = _glewLazy_glTextureParameterIiv;
+PFNGLTEXTUREPARAMETERIUIVPROC __glewTextureParameterIuiv = _glewLazy_glTextureParameterIuiv;
+PFNGLTEXTUREPARAMETERFPROC __glewTextureParameterf = _glewLazy_glTextureParameterf;
+PFNGLTEXTUREPARAMETERFVPROC __glewTextureParameterfv = _glewLazy_glTextureParameterfv;
+PFNGLTEXTUREPARAMETERIPROC __glewTextureParameteri = _glewLazy_glTextureParameteri;
+PFNGLTEXTUREPARAMETERIVPROC __glewTextureParameteriv = _glewLazy_glTextureParameteriv;
+PFNGLTEXTURESTORAGE1DPROC __glewTextureStorage1D = _glewLazy_glTextureStorage1D;
+PFNGLTEXTURESTORAGE2DPROC __glewTextureStorage2D = _glewLazy_glTextureStorage2D;
+PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC __glewTextureStorage2DMultisample = _glewLazy_glTextureStorage2DMultisample;
+PFNGLTEXTURESTORAGE3DPROC __glewTextureStorage3D = _glewLazy_glTextureStorage3D;
+PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC __glewTextureStorage3DMultisample = _glewLazy_glTextureStorage3DMultisample;
+PFNGLTEXTURESUBIMAGE1DPROC __glewTextureSubImage1D = _glewLazy_glTextureSubImage1D;
+PFNGLTEXTURESUBIMAGE2DPROC __glewTextureSubImage2D = _glewLazy_glTextureSubImage2D;
+PFNGLTEXTURESUBIMAGE3DPROC __glewTextureSubImage3D = _glewLazy_glTextureSubImage3D;
+PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC __glewTransformFeedbackBufferBase = _glewLazy_glTransformFeedbackBufferBase;
+PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC __glewTransformFeedbackBufferRange = _glewLazy_glTransformFeedbackBufferRange;
+PFNGLUNMAPNAMEDBUFFERPROC __glewUnmapNamedBuffer = _glewLazy_glUnmapNamedBuffer;
+PFNGLVERTEXARRAYATTRIBBINDINGPROC __glewVertexArrayAttribBinding = _glewLazy_glVertexArrayAttribBinding;
+PFNGLVERTEXARRAYATTRIBFORMATPROC __glewVertexArrayAttribFormat = _glewLazy_glVertexArrayAttribFormat;
+PFNGLVERTEXARRAYATTRIBIFORMATPROC __glewVertexArrayAttribIFormat = _glewLazy_glVertexArrayAttribIFormat;
+PFNGLVERTEXARRAYATTRIBLFORMATPROC __glewVertexArrayAttribLFormat = _glewLazy_glVertexArrayAttribLFormat;
+PFNGLVERTEXARRAYBINDINGDIVISORPROC __glewVertexArrayBindingDivisor = _glewLazy_glVertexArrayBindingDivisor;
+PFNGLVERTEXARRAYELEMENTBUFFERPROC __glewVertexArrayElementBuffer = _glewLazy_glVertexArrayElementBuffer;
+PFNGLVERTEXARRAYVERTEXBUFFERPROC __glewVertexArrayVertexBuffer = _glewLazy_glVertexArrayVertexBuffer;
+PFNGLVERTEXARRAYVERTEXBUFFERSPROC __glewVertexArrayVertexBuffers = _glewLazy_glVertexArrayVertexBuffers;
+
+PFNGLDRAWBUFFERSARBPROC __glewDrawBuffersARB = _glewLazy_glDrawBuffersARB;
+
+PFNGLBLENDEQUATIONSEPARATEIARBPROC __glewBlendEquationSeparateiARB = _glewLazy_glBlendEquationSeparateiARB;
+PFNGLBLENDEQUATIONIARBPROC __glewBlendEquationiARB = _glewLazy_glBlendEquationiARB;
+PFNGLBLENDFUNCSEPARATEIARBPROC __glewBlendFuncSeparateiARB = _glewLazy_glBlendFuncSeparateiARB;
+PFNGLBLENDFUNCIARBPROC __glewBlendFunciARB = _glewLazy_glBlendFunciARB;
+
+PFNGLDRAWELEMENTSBASEVERTEXPROC __glewDrawElementsBaseVertex = _glewLazy_glDrawElementsBaseVertex;
+PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC __glewDrawElementsInstancedBaseVertex = _glewLazy_glDrawElementsInstancedBaseVertex;
+PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC __glewDrawRangeElementsBaseVertex = _glewLazy_glDrawRangeElementsBaseVertex;
+PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC __glewMultiDrawElementsBaseVertex = _glewLazy_glMultiDrawElementsBaseVertex;
+
+PFNGLDRAWARRAYSINDIRECTPROC __glewDrawArraysIndirect = _glewLazy_glDrawArraysIndirect;
+PFNGLDRAWELEMENTSINDIRECTPROC __glewDrawElementsIndirect = _glewLazy_glDrawElementsIndirect;
+
+PFNGLFRAMEBUFFERPARAMETERIPROC __glewFramebufferParameteri = _glewLazy_glFramebufferParameteri;
+PFNGLGETFRAMEBUFFERPARAMETERIVPROC __glewGetFramebufferParameteriv = _glewLazy_glGetFramebufferParameteriv;
+PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVEXTPROC __glewGetNamedFramebufferParameterivEXT = _glewLazy_glGetNamedFramebufferParameterivEXT;
+PFNGLNAMEDFRAMEBUFFERPARAMETERIEXTPROC __glewNamedFramebufferParameteriEXT = _glewLazy_glNamedFramebufferParameteriEXT;
+
+PFNGLBINDFRAMEBUFFERPROC __glewBindFramebuffer = _glewLazy_glBindFramebuffer;
+PFNGLBINDRENDERBUFFERPROC __glewBindRenderbuffer = _glewLazy_glBindRenderbuffer;
+PFNGLBLITFRAMEBUFFERPROC __glewBlitFramebuffer = _glewLazy_glBlitFramebuffer;
+PFNGLCHECKFRAMEBUFFERSTATUSPROC __glewCheckFramebufferStatus = _glewLazy_glCheckFramebufferStatus;
+PFNGLDELETEFRAMEBUFFERSPROC __glewDeleteFramebuffers = _glewLazy_glDeleteFramebuffers;
+PFNGLDELETERENDERBUFFERSPROC __glewDeleteRenderbuffers = _glewLazy_glDeleteRenderbuffers;
+PFNGLFRAMEBUFFERRENDERBUFFERPROC __glewFramebufferRenderbuffer = _glewLazy_glFramebufferRenderbuffer;
+PFNGLFRAMEBUFFERTEXTURE1DPROC __glewFramebufferTexture1D = _glewLazy_glFramebufferTexture1D;
+PFNGLFRAMEBUFFERTEXTURE2DPROC __glewFramebufferTexture2D = _glewLazy_glFramebufferTexture2D;
+PFNGLFRAMEBUFFERTEXTURE3DPROC __glewFramebufferTexture3D = _glewLazy_glFramebufferTexture3D;
+PFNGLFRAMEBUFFERTEXTURELAYERPROC __glewFramebufferTextureLayer = _glewLazy_glFramebufferTextureLayer;
+PFNGLGENFRAMEBUFFERSPROC __glewGenFramebuffers = _glewLazy_glGenFramebuffers;
+PFNGLGENRENDERBUFFERSPROC __glewGenRenderbuffers = _glewLazy_glGenRenderbuffers;
+PFNGLGENERATEMIPMAPPROC __glewGenerateMipmap = _glewLazy_glGenerateMipmap;
+PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC __glewGetFramebufferAttachmentParameteriv = _glewLazy_glGetFramebufferAttachmentParameteriv;
+PFNGLGETRENDERBUFFERPARAMETERIVPROC __glewGetRenderbufferParameteriv = _glewLazy_glGetRenderbufferParameteriv;
+PFNGLISFRAMEBUFFERPROC __glewIsFramebuffer = _glewLazy_glIsFramebuffer;
+PFNGLISRENDERBUFFERPROC __glewIsRenderbuffer = _glewLazy_glIsRenderbuffer;
+PFNGLRENDERBUFFERSTORAGEPROC __glewRenderbufferStorage = _glewLazy_glRenderbufferStorage;
+PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC __glewRenderbufferStorageMultisample = _glewLazy_glRenderbufferStorageMultisample;
+
+PFNGLFRAMEBUFFERTEXTUREARBPROC __glewFramebufferTextureARB = _glewLazy_glFramebufferTextureARB;
+PFNGLFRAMEBUFFERTEXTUREFACEARBPROC __glewFramebufferTextureFaceARB = _glewLazy_glFramebufferTextureFaceARB;
+PFNGLFRAMEBUFFERTEXTURELAYERARBPROC __glewFramebufferTextureLayerARB = _glewLazy_glFramebufferTextureLayerARB;
+PFNGLPROGRAMPARAMETERIARBPROC __glewProgramParameteriARB = _glewLazy_glProgramParameteriARB;
+
+PFNGLGETPROGRAMBINARYPROC __glewGetProgramBinary = _glewLazy_glGetProgramBinary;
+PFNGLPROGRAMBINARYPROC __glewProgramBinary = _glewLazy_glProgramBinary;
+PFNGLPROGRAMPARAMETERIPROC __glewProgramParameteri = _glewLazy_glProgramParameteri;
+
+PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC __glewGetCompressedTextureSubImage = _glewLazy_glGetCompressedTextureSubImage;
+PFNGLGETTEXTURESUBIMAGEPROC __glewGetTextureSubImage = _glewLazy_glGetTextureSubImage;
+
+PFNGLGETUNIFORMDVPROC __glewGetUniformdv = _glewLazy_glGetUniformdv;
+PFNGLUNIFORM1DPROC __glewUniform1d = _glewLazy_glUniform1d;
+PFNGLUNIFORM1DVPROC __glewUniform1dv = _glewLazy_glUniform1dv;
+PFNGLUNIFORM2DPROC __glewUniform2d = _glewLazy_glUniform2d;
+PFNGLUNIFORM2DVPROC __glewUniform2dv = _glewLazy_glUniform2dv;
+PFNGLUNIFORM3DPROC __glewUniform3d = _glewLazy_glUniform3d;
+PFNGLUNIFORM3DVPROC __glewUniform3dv = _glewLazy_glUniform3dv;
+PFNGLUNIFORM4DPROC __glewUniform4d = _glewLazy_glUniform4d;
+PFNGLUNIFORM4DVPROC __glewUniform4dv = _glewLazy_glUniform4dv;
+PFNGLUNIFORMMATRIX2DVPROC __glewUniformMatrix2dv = _glewLazy_glUniformMatrix2dv;
+PFNGLUNIFORMMATRIX2X3DVPROC __glewUniformMatrix2x3dv = _glewLazy_glUniformMatrix2x3dv;
+PFNGLUNIFORMMATRIX2X4DVPROC __glewUniformMatrix2x4dv = _glewLazy_glUniformMatrix2x4dv;
+PFNGLUNIFORMMATRIX3DVPROC __glewUniformMatrix3dv = _glewLazy_glUniformMatrix3dv;
+PFNGLUNIFORMMATRIX3X2DVPROC __glewUniformMatrix3x2dv = _glewLazy_glUniformMatrix3x2dv;
+PFNGLUNIFORMMATRIX3X4DVPROC __glewUniformMatrix3x4dv = _glewLazy_glUniformMatrix3x4dv;
+PFNGLUNIFORMMATRIX4DVPROC __glewUniformMatrix4dv = _glewLazy_glUniformMatrix4dv;
+PFNGLUNIFORMMATRIX4X2DVPROC __glewUniformMatrix4x2dv = _glewLazy_glUniformMatrix4x2dv;
+PFNGLUNIFORMMATRIX4X3DVPROC __glewUniformMatrix4x3dv = _glewLazy_glUniformMatrix4x3dv;
+
+PFNGLCOLORSUBTABLEPROC __glewColorSubTable = _glewLazy_glColorSubTable;
+PFNGLCOLORTABLEPROC __glewColorTable = _glewLazy_glColorTable;
+PFNGLCOLORTABLEPARAMETERFVPROC __glewColorTableParameterfv = _glewLazy_glColorTableParameterfv;
+PFNGLCOLORTABLEPARAMETERIVPROC __glewColorTableParameteriv = _glewLazy_glColorTableParameteriv;
+PFNGLCONVOLUTIONFILTER1DPROC __glewConvolutionFilter1D = _glewLazy_glConvolutionFilter1D;
+PFNGLCONVOLUTIONFILTER2DPROC __glewConvolutionFilter2D = _glewLazy_glConvolutionFilter2D;
+PFNGLCONVOLUTIONPARAMETERFPROC __glewConvolutionParameterf = _glewLazy_glConvolutionParameterf;
+PFNGLCONVOLUTIONPARAMETERFVPROC __glewConvolutionParameterfv = _glewLazy_glConvolutionParameterfv;
+PFNGLCONVOLUTIONPARAMETERIPROC __glewConvolutionParameteri = _glewLazy_glConvolutionParameteri;
+PFNGLCONVOLUTIONPARAMETERIVPROC __glewConvolutionParameteriv = _glewLazy_glConvolutionParameteriv;
+PFNGLCOPYCOLORSUBTABLEPROC __glewCopyColorSubTable = _glewLazy_glCopyColorSubTable;
+PFNGLCOPYCOLORTABLEPROC __glewCopyColorTable = _glewLazy_glCopyColorTable;
+PFNGLCOPYCONVOLUTIONFILTER1DPROC __glewCopyConvolutionFilter1D = _glewLazy_glCopyConvolutionFilter1D;
+PFNGLCOPYCONVOLUTIONFILTER2DPROC __glewCopyConvolutionFilter2D = _glewLazy_glCopyConvolutionFilter2D;
+PFNGLGETCOLORTABLEPROC __glewGetColorTable = _glewLazy_glGetColorTable;
+PFNGLGETCOLORTABLEPARAMETERFVPROC __glewGetColorTableParameterfv = _glewLazy_glGetColorTableParameterfv;
+PFNGLGETCOLORTABLEPARAMETERIVPROC __glewGetColorTableParameteriv = _glewLazy_glGetColorTableParameteriv;
+PFNGLGETCONVOLUTIONFILTERPROC __glewGetConvolutionFilter = _glewLazy_glGetConvolutionFilter;
+PFNGLGETCONVOLUTIONPARAMETERFVPROC __glewGetConvolutionParameterfv = _glewLazy_glGetConvolutionParameterfv;
+PFNGLGETCONVOLUTIONPARAMETERIVPROC __glewGetConvolutionParameteriv = _glewLazy_glGetConvolutionParameteriv;
+PFNGLGETHISTOGRAMPROC __glewGetHistogram = _glewLazy_glGetHistogram;
+PFNGLGETHISTOGRAMPARAMETERFVPROC __glewGetHistogramParameterfv = _glewLazy_glGetHistogramParameterfv;
+PFNGLGETHISTOGRAMPARAMETERIVPROC __glewGetHistogramParameteriv = _glewLazy_glGetHistogramParameteriv;
+PFNGLGETMINMAXPROC __glewGetMinmax = _glewLazy_glGetMinmax;
+PFNGLGETMINMAXPARAMETERFVPROC __glewGetMinmaxParameterfv = _glewLazy_glGetMinmaxParameterfv;
+PFNGLGETMINMAXPARAMETERIVPROC __glewGetMinmaxParameteriv = _glewLazy_glGetMinmaxParameteriv;
+PFNGLGETSEPARABLEFILTERPROC __glewGetSeparableFilter = _glewLazy_glGetSeparableFilter;
+PFNGLHISTOGRAMPROC __glewHistogram = _glewLazy_glHistogram;
+PFNGLMINMAXPROC __glewMinmax = _glewLazy_glMinmax;
+PFNGLRESETHISTOGRAMPROC __glewResetHistogram = _glewLazy_glResetHistogram;
+PFNGLRESETMINMAXPROC __glewResetMinmax = _glewLazy_glResetMinmax;
+PFNGLSEPARABLEFILTER2DPROC __glewSeparableFilter2D = _glewLazy_glSeparableFilter2D;
+
+PFNGLMULTIDRAWARRAYSINDIRECTCOUNTARBPROC __glewMultiDrawArraysIndirectCountARB = _glewLazy_glMultiDrawArraysIndirectCountARB;
+PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTARBPROC __glewMultiDrawElementsIndirectCountARB = _glewLazy_glMultiDrawElementsIndirectCountARB;
+
+PFNGLDRAWARRAYSINSTANCEDARBPROC __glewDrawArraysInstancedARB = _glewLazy_glDrawArraysInstancedARB;
+PFNGLDRAWELEMENTSINSTANCEDARBPROC __glewDrawElementsInstancedARB = _glewLazy_glDrawElementsInstancedARB;
+PFNGLVERTEXATTRIBDIVISORARBPROC __glewVertexAttribDivisorARB = _glewLazy_glVertexAttribDivisorARB;
+
+PFNGLGETINTERNALFORMATIVPROC __glewGetInternalformativ = _glewLazy_glGetInternalformativ;
+
+PFNGLGETINTERNALFORMATI64VPROC __glewGetInternalformati64v = _glewLazy_glGetInternalformati64v;
+
+PFNGLINVALIDATEBUFFERDATAPROC __glewInvalidateBufferData = _glewLazy_glInvalidateBufferData;
+PFNGLINVALIDATEBUFFERSUBDATAPROC __glewInvalidateBufferSubData = _glewLazy_glInvalidateBufferSubData;
+PFNGLINVALIDATEFRAMEBUFFERPROC __glewInvalidateFramebuffer = _glewLazy_glInvalidateFramebuffer;
+PFNGLINVALIDATESUBFRAMEBUFFERPROC __glewInvalidateSubFramebuffer = _glewLazy_glInvalidateSubFramebuffer;
+PFNGLINVALIDATETEXIMAGEPROC __glewInvalidateTexImage = _glewLazy_glInvalidateTexImage;
+PFNGLINVALIDATETEXSUBIMAGEPROC __glewInvalidateTexSubImage = _glewLazy_glInvalidateTexSubImage;
+
+PFNGLFLUSHMAPPEDBUFFERRANGEPROC __glewFlushMappedBufferRange = _glewLazy_glFlushMappedBufferRange;
+PFNGLMAPBUFFERRANGEPROC __glewMapBufferRange = _glewLazy_glMapBufferRange;
+
+PFNGLCURRENTPALETTEMATRIXARBPROC __glewCurrentPaletteMatrixARB = _glewLazy_glCurrentPaletteMatrixARB;
+PFNGLMATRIXINDEXPOINTERARBPROC __glewMatrixIndexPointerARB = _glewLazy_glMatrixIndexPointerARB;
+PFNGLMATRIXINDEXUBVARBPROC __glewMatrixIndexubvARB = _glewLazy_glMatrixIndexubvARB;
+PFNGLMATRIXINDEXUIVARBPROC __glewMatrixIndexuivARB = _glewLazy_glMatrixIndexuivARB;
+PFNGLMATRIXINDEXUSVARBPROC __glewMatrixIndexusvARB = _glewLazy_glMatrixIndexusvARB;
+
+PFNGLBINDBUFFERSBASEPROC __glewBindBuffersBase = _glewLazy_glBindBuffersBase;
+PFNGLBINDBUFFERSRANGEPROC __glewBindBuffersRange = _glewLazy_glBindBuffersRange;
+PFNGLBINDIMAGETEXTURESPROC __glewBindImageTextures = _glewLazy_glBindImageTextures;
+PFNGLBINDSAMPLERSPROC __glewBindSamplers = _glewLazy_glBindSamplers;
+PFNGLBINDTEXTURESPROC __glewBindTextures = _glewLazy_glBindTextures;
+PFNGLBINDVERTEXBUFFERSPROC __glewBindVertexBuffers = _glewLazy_glBindVertexBuffers;
+
+PFNGLMULTIDRAWARRAYSINDIRECTPROC __glewMultiDrawArraysIndirect = _glewLazy_glMultiDrawArraysIndirect;
+PFNGLMULTIDRAWELEMENTSINDIRECTPROC __glewMultiDrawElementsIndirect = _glewLazy_glMultiDrawElementsIndirect;
+
+PFNGLSAMPLECOVERAGEARBPROC __glewSampleCoverageARB = _glewLazy_glSampleCoverageARB;
+
+PFNGLACTIVETEXTUREARBPROC __glewActiveTextureARB = _glewLazy_glActiveTextureARB;
+PFNGLCLIENTACTIVETEXTUREARBPROC __glewClientActiveTextureARB = _glewLazy_glClientActiveTextureARB;
+PFNGLMULTITEXCOORD1DARBPROC __glewMultiTexCoord1dARB = _glewLazy_glMultiTexCoord1dARB;
+PFNGLMULTITEXCOORD1DVARBPROC __glewMultiTexCoord1dvARB = _glewLazy_glMultiTexCoord1dvARB;
+PFNGLMULTITEXCOORD1FARBPROC __glewMultiTexCoord1fARB = _glewLazy_glMultiTexCoord1fARB;
+PFNGLMULTITEXCOORD1FVARBPROC __glewMultiTexCoord1fvARB = _glewLazy_glMultiTexCoord1fvARB;
+PFNGLMULTITEXCOORD1IARBPROC __glewMultiTexCoord1iARB = _glewLazy_glMultiTexCoord1iARB;
+PFNGLMULTITEXCOORD1IVARBPROC __glewMultiTexCoord1ivARB = _glewLazy_glMultiTexCoord1ivARB;
+PFNGLMULTITEXCOORD1SARBPROC __glewMultiTexCoord1sARB = _glewLazy_glMultiTexCoord1sARB;
+PFNGLMULTITEXCOORD1SVARBPROC __glewMultiTexCoord1svARB = _glewLazy_glMultiTexCoord1svARB;
+PFNGLMULTITEXCOORD2DARBPROC __glewMultiTexCoord2dARB = _glewLazy_glMultiTexCoord2dARB;
+PFNGLMULTITEXCOORD2DVARBPROC __glewMultiTexCoord2dvARB = _glewLazy_glMultiTexCoord2dvARB;
+PFNGLMULTITEXCOORD2FARBPROC __glewMultiTexCoord2fARB = _glewLazy_glMultiTexCoord2fARB;
+PFNGLMULTITEXCOORD2FVARBPROC __glewMultiTexCoord2fvARB = _glewLazy_glMultiTexCoord2fvARB;
+PFNGLMULTITEXCOORD2IARBPROC __glewMultiTexCoord2iARB = _glewLazy_glMultiTexCoord2iARB;
+PFNGLMULTITEXCOORD2IVARBPROC __glewMultiTexCoord2ivARB = _glewLazy_glMultiTexCoord2ivARB;
+PFNGLMULTITEXCOORD2SARBPROC __glewMultiTexCoord2sARB = _glewLazy_glMultiTexCoord2sARB;
+PFNGLMULTITEXCOORD2SVARBPROC __glewMultiTexCoord2svARB = _glewLazy_glMultiTexCoord2svARB;
+PFNGLMULTITEXCOORD3DARBPROC __glewMultiTexCoord3dARB = _glewLazy_glMultiTexCoord3dARB;
+PFNGLMULTITEXCOORD3DVARBPROC __glewMultiTexCoord3dvARB = _glewLazy_glMultiTexCoord3dvARB;
+PFNGLMULTITEXCOORD3FARBPROC __glewMultiTexCoord3fARB = _glewLazy_glMultiTexCoord3fARB;
+PFNGLMULTITEXCOORD3FVARBPROC __glewMultiTexCoord3fvARB = _glewLazy_glMultiTexCoord3fvARB;
+PFNGLMULTITEXCOORD3IARBPROC __glewMultiTexCoord3iARB = _glewLazy_glMultiTexCoord3iARB;
+PFNGLMULTITEXCOORD3IVARBPROC __glewMultiTexCoord3ivARB = _glewLazy_glMultiTexCoord3ivARB;
+PFNGLMULTITEXCOORD3SARBPROC __glewMultiTexCoord3sARB = _glewLazy_glMultiTexCoord3sARB;
+PFNGLMULTITEXCOORD3SVARBPROC __glewMultiTexCoord3svARB = _glewLazy_glMultiTexCoord3svARB;
+PFNGLMULTITEXCOORD4DARBPROC __glewMultiTexCoord4dARB = _glewLazy_glMultiTexCoord4dARB;
+PFNGLMULTITEXCOORD4DVARBPROC __glewMultiTexCoord4dvARB = _glewLazy_glMultiTexCoord4dvARB;
+PFNGLMULTITEXCOORD4FARBPROC __glewMultiTexCoord4fARB = _glewLazy_glMultiTexCoord4fARB;
+PFNGLMULTITEXCOORD4FVARBPROC __glewMultiTexCoord4fvARB = _glewLazy_glMultiTexCoord4fvARB;
+PFNGLMULTITEXCOORD4IARBPROC __glewMultiTexCoord4iARB = _glewLazy_glMultiTexCoord4iARB;
+PFNGLMULTITEXCOORD4IVARBPROC __glewMultiTexCoord4ivARB = _glewLazy_glMultiTexCoord4ivARB;
+PFNGLMULTITEXCOORD4SARBPROC __glewMultiTexCoord4sARB = _glewLazy_glMultiTexCoord4sARB;
+PFNGLMULTITEXCOORD4SVARBPROC __glewMultiTexCoord4svARB = _glewLazy_glMultiTexCoord4svARB;
+
+PFNGLBEGINQUERYARBPROC __glewBeginQueryARB = _glewLazy_glBeginQueryARB;
+PFNGLDELETEQUERIESARBPROC __glewDeleteQueriesARB = _glewLazy_glDeleteQueriesARB;
+PFNGLENDQUERYARBPROC __glewEndQueryARB = _glewLazy_glEndQueryARB;
+PFNGLGENQUERIESARBPROC __glewGenQueriesARB = _glewLazy_glGenQueriesARB;
+PFNGLGETQUERYOBJECTIVARBPROC __glewGetQueryObjectivARB = _glewLazy_glGetQueryObjectivARB;
+PFNGLGETQUERYOBJECTUIVARBPROC __glewGetQueryObjectuivARB = _glewLazy_glGetQueryObjectuivARB;
+PFNGLGETQUERYIVARBPROC __glewGetQueryivARB = _glewLazy_glGetQueryivARB;
+PFNGLISQUERYARBPROC __glewIsQueryARB = _glewLazy_glIsQueryARB;
+
+PFNGLPOINTPARAMETERFARBPROC __glewPointParameterfARB = _glewLazy_glPointParameterfARB;
+PFNGLPOINTPARAMETERFVARBPROC __glewPointParameterfvARB = _glewLazy_glPointParameterfvARB;
+
+PFNGLGETPROGRAMINTERFACEIVPROC __glewGetProgramInterfaceiv = _glewLazy_glGetProgramInterfaceiv;
+PFNGLGETPROGRAMRESOURCEINDEXPROC __glewGetProgramResourceIndex = _glewLazy_glGetProgramResourceIndex;
+PFNGLGETPROGRAMRESOURCELOCATIONPROC __glewGetProgramResourceLocation = _glewLazy_glGetProgramResourceLocation;
+PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC __glewGetProgramResourceLocationIndex = _glewLazy_glGetProgramResourceLocationIndex;
+PFNGLGETPROGRAMRESOURCENAMEPROC __glewGetProgramResourceName = _glewLazy_glGetProgramResourceName;
+PFNGLGETPROGRAMRESOURCEIVPROC __glewGetProgramResourceiv = _glewLazy_glGetProgramResourceiv;
+
+PFNGLPROVOKINGVERTEXPROC __glewProvokingVertex = _glewLazy_glProvokingVertex;
+
+PFNGLGETGRAPHICSRESETSTATUSARBPROC __glewGetGraphicsResetStatusARB = _glewLazy_glGetGraphicsResetStatusARB;
+PFNGLGETNCOLORTABLEARBPROC __glewGetnColorTableARB = _glewLazy_glGetnColorTableARB;
+PFNGLGETNCOMPRESSEDTEXIMAGEARBPROC __glewGetnCompressedTexImageARB = _glewLazy_glGetnCompressedTexImageARB;
+PFNGLGETNCONVOLUTIONFILTERARBPROC __glewGetnConvolutionFilterARB = _glewLazy_glGetnConvolutionFilterARB;
+PFNGLGETNHISTOGRAMARBPROC __glewGetnHistogramARB = _glewLazy_glGetnHistogramARB;
+PFNGLGETNMAPDVARBPROC __glewGetnMapdvARB = _glewLazy_glGetnMapdvARB;
+PFNGLGETNMAPFVARBPROC __glewGetnMapfvARB = _glewLazy_glGetnMapfvARB;
+PFNGLGETNMAPIVARBPROC __glewGetnMapivARB = _glewLazy_glGetnMapivARB;
+PFNGLGETNMINMAXARBPROC __glewGetnMinmaxARB = _glewLazy_glGetnMinmaxARB;
+PFNGLGETNPIXELMAPFVARBPROC __glewGetnPixelMapfvARB = _glewLazy_glGetnPixelMapfvARB;
+PFNGLGETNPIXELMAPUIVARBPROC __glewGetnPixelMapuivARB = _glewLazy_glGetnPixelMapuivARB;
+PFNGLGETNPIXELMAPUSVARBPROC __glewGetnPixelMapusvARB = _glewLazy_glGetnPixelMapusvARB;
+PFNGLGETNPOLYGONSTIPPLEARBPROC __glewGetnPolygonStippleARB = _glewLazy_glGetnPolygonStippleARB;
+PFNGLGETNSEPARABLEFILTERARBPROC __glewGetnSeparableFilterARB = _glewLazy_glGetnSeparableFilterARB;
+PFNGLGETNTEXIMAGEARBPROC __glewGetnTexImageARB = _glewLazy_glGetnTexImageARB;
+PFNGLGETNUNIFORMDVARBPROC __glewGetnUniformdvARB = _glewLazy_glGetnUniformdvARB;
+PFNGLGETNUNIFORMFVARBPROC __glewGetnUniformfvARB = _glewLazy_glGetnUniformfvARB;
+PFNGLGETNUNIFORMIVARBPROC __glewGetnUniformivARB = _glewLazy_glGetnUniformivARB;
+PFNGLGETNUNIFORMUIVARBPROC __glewGetnUniformuivARB = _glewLazy_glGetnUniformuivARB;
+PFNGLREADNPIXELSARBPROC __glewReadnPixelsARB = _glewLazy_glReadnPixelsARB;
+
+PFNGLMINSAMPLESHADINGARBPROC __glewMinSampleShadingARB = _glewLazy_glMinSampleShadingARB;
+
+PFNGLBINDSAMPLERPROC __glewBindSampler = _glewLazy_glBindSampler;
+PFNGLDELETESAMPLERSPROC __glewDeleteSamplers = _glewLazy_glDeleteSamplers;
+PFNGLGENSAMPLERSPROC __glewGenSamplers = _glewLazy_glGenSamplers;
+PFNGLGETSAMPLERPARAMETERIIVPROC __glewGetSamplerParameterIiv = _glewLazy_glGetSamplerParameterIiv;
+PFNGLGETSAMPLERPARAMETERIUIVPROC __glewGetSamplerParameterIuiv = _glewLazy_glGetSamplerParameterIuiv;
+PFNGLGETSAMPLERPARAMETERFVPROC __glewGetSamplerParameterfv = _glewLazy_glGetSamplerParameterfv;
+PFNGLGETSAMPLERPARAMETERIVPROC __glewGetSamplerParameteriv = _glewLazy_glGetSamplerParameteriv;
+PFNGLISSAMPLERPROC __glewIsSampler = _glewLazy_glIsSampler;
+PFNGLSAMPLERPARAMETERIIVPROC __glewSamplerParameterIiv = _glewLazy_glSamplerParameterIiv;
+PFNGLSAMPLERPARAMETERIUIVPROC __glewSamplerParameterIuiv = _glewLazy_glSamplerParameterIuiv;
+PFNGLSAMPLERPARAMETERFPROC __glewSamplerParameterf = _glewLazy_glSamplerParameterf;
+PFNGLSAMPLERPARAMETERFVPROC __glewSamplerParameterfv = _glewLazy_glSamplerParameterfv;
+PFNGLSAMPLERPARAMETERIPROC __glewSamplerParameteri = _glewLazy_glSamplerParameteri;
+PFNGLSAMPLERPARAMETERIVPROC __glewSamplerParameteriv = _glewLazy_glSamplerParameteriv;
+
+PFNGLACTIVESHADERPROGRAMPROC __glewActiveShaderProgram = _glewLazy_glActiveShaderProgram;
+PFNGLBINDPROGRAMPIPELINEPROC __glewBindProgramPipeline = _glewLazy_glBindProgramPipeline;
+PFNGLCREATESHADERPROGRAMVPROC __glewCreateShaderProgramv = _glewLazy_glCreateShaderProgramv;
+PFNGLDELETEPROGRAMPIPELINESPROC __glewDeleteProgramPipelines = _glewLazy_glDeleteProgramPipelines;
+PFNGLGENPROGRAMPIPELINESPROC __glewGenProgramPipelines = _glewLazy_glGenProgramPipelines;
+PFNGLGETPROGRAMPIPELINEINFOLOGPROC __glewGetProgramPipelineInfoLog = _glewLazy_glGetProgramPipelineInfoLog;
+PFNGLGETPROGRAMPIPELINEIVPROC __glewGetProgramPipelineiv = _glewLazy_glGetProgramPipelineiv;
+PFNGLISPROGRAMPIPELINEPROC __glewIsProgramPipeline = _glewLazy_glIsProgramPipeline;
+PFNGLPROGRAMUNIFORM1DPROC __glewProgramUniform1d = _glewLazy_glProgramUniform1d;
+PFNGLPROGRAMUNIFORM1DVPROC __glewProgramUniform1dv = _glewLazy_glProgramUniform1dv;
+PFNGLPROGRAMUNIFORM1FPROC __glewProgramUniform1f = _glewLazy_glProgramUniform1f;
+PFNGLPROGRAMUNIFORM1FVPROC __glewProgramUniform1fv = _glewLazy_glProgramUniform1fv;
+PFNGLPROGRAMUNIFORM1IPROC __glewProgramUniform1i = _glewLazy_glProgramUniform1i;
+PFNGLPROGRAMUNIFORM1IVPROC __glewProgramUniform1iv = _glewLazy_glProgramUniform1iv;
+PFNGLPROGRAMUNIFORM1UIPROC __glewProgramUniform1ui = _glewLazy_glProgramUniform1ui;
+PFNGLPROGRAMUNIFORM1UIVPROC __glewProgramUniform1uiv = _glewLazy_glProgramUniform1uiv;
+PFNGLPROGRAMUNIFORM2DPROC __glewProgramUniform2d = _glewLazy_glProgramUniform2d;
+PFNGLPROGRAMUNIFORM2DVPROC __glewProgramUniform2dv = _glewLazy_glProgramUniform2dv;
+PFNGLPROGRAMUNIFORM2FPROC __glewProgramUniform2f = _glewLazy_glProgramUniform2f;
+PFNGLPROGRAMUNIFORM2FVPROC __glewProgramUniform2fv = _glewLazy_glProgramUniform2fv;
+PFNGLPROGRAMUNIFORM2IPROC __glewProgramUniform2i = _glewLazy_glProgramUniform2i;
+PFNGLPROGRAMUNIFORM2IVPROC __glewProgramUniform2iv = _glewLazy_glProgramUniform2iv;
+PFNGLPROGRAMUNIFORM2UIPROC __glewProgramUniform2ui = _glewLazy_glProgramUniform2ui;
+PFNGLPROGRAMUNIFORM2UIVPROC __glewProgramUniform2uiv = _glewLazy_glProgramUniform2uiv;
+PFNGLPROGRAMUNIFORM3DPROC __glewProgramUniform3d = _glewLazy_glProgramUniform3d;
+PFNGLPROGRAMUNIFORM3DVPROC __glewProgramUniform3dv = _glewLazy_glProgramUniform3dv;
+PFNGLPROGRAMUNIFORM3FPROC __glewProgramUniform3f = _glewLazy_glProgramUniform3f;
+PFNGLPROGRAMUNIFORM3FVPROC __glewProgramUniform3fv = _glewLazy_glProgramUniform3fv;
+PFNGLPROGRAMUNIFORM3IPROC __glewProgramUniform3i = _glewLazy_glProgramUniform3i;
+PFNGLPROGRAMUNIFORM3IVPROC __glewProgramUniform3iv = _glewLazy_glProgramUniform3iv;
+PFNGLPROGRAMUNIFORM3UIPROC __glewProgramUniform3ui = _glewLazy_glProgramUniform3ui;
+PFNGLPROGRAMUNIFORM3UIVPROC __glewProgramUniform3uiv = _glewLazy_glProgramUniform3uiv;
+PFNGLPROGRAMUNIFORM4DPROC __glewProgramUniform4d = _glewLazy_glProgramUniform4d;
+PFNGLPROGRAMUNIFORM4DVPROC __glewProgramUniform4dv = _glewLazy_glProgramUniform4dv;
+PFNGLPROGRAMUNIFORM4FPROC __glewProgramUniform4f = _glewLazy_glProgramUniform4f;
+PFNGLPROGRAMUNIFORM4FVPROC __glewProgramUniform4fv = _glewLazy_glProgramUniform4fv;
+PFNGLPROGRAMUNIFORM4IPROC __glewProgramUniform4i = _glewLazy_glProgramUniform4i;
+PFNGLPROGRAMUNIFORM4IVPROC __glewProgramUniform4iv = _glewLazy_glProgramUniform4iv;
+PFNGLPROGRAMUNIFORM4UIPROC __glewProgramUniform4ui = _glewLazy_glProgramUniform4ui;
+PFNGLPROGRAMUNIFORM4UIVPROC __glewProgramUniform4uiv = _glewLazy_glProgramUniform4uiv;
+PFNGLPROGRAMUNIFORMMATRIX2DVPROC __glewProgramUniformMatrix2dv = _glewLazy_glProgramUniformMatrix2dv;
+PFNGLPROGRAMUNIFORMMATRIX2FVPROC __glewProgramUniformMatrix2fv = _glewLazy_glProgramUniformMatrix2fv;
+PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC __glewProgramUniformMatrix2x3dv = _glewLazy_glProgramUniformMatrix2x3dv;
+PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC __glewProgramUniformMatrix2x3fv = _glewLazy_glProgramUniformMatrix2x3fv;
+PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC __glewProgramUniformMatrix2x4dv = _glewLazy_glProgramUniformMatrix2x4dv;
+PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC __glewProgramUniformMatrix2x4fv = _glewLazy_glProgramUniformMatrix2x4fv;
+PFNGLPROGRAMUNIFORMMATRIX3DVPROC __glewProgramUniformMatrix3dv = _glewLazy_glProgramUniformMatrix3dv;
+PFNGLPROGRAMUNIFORMMATRIX3FVPROC __glewProgramUniformMatrix3fv = _glewLazy_glProgramUniformMatrix3fv;
+PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC __glewProgramUniformMatrix3x2dv = _glewLazy_glProgramUniformMatrix3x2dv;
+PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC __glewProgramUniformMatrix3x2fv = _glewLazy_glProgramUniformMatrix3x2fv;
+PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC __glewProgramUniformMatrix3x4dv = _glewLazy_glProgramUniformMatrix3x4dv;
+PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC __glewProgramUniformMatrix3x4fv = _glewLazy_glProgramUniformMatrix3x4fv;
+PFNGLPROGRAMUNIFORMMATRIX4DVPROC __glewProgramUniformMatrix4dv = _glewLazy_glProgramUniformMatrix4dv;
+PFNGLPROGRAMUNIFORMMATRIX4FVPROC __glewProgramUniformMatrix4fv = _glewLazy_glProgramUniformMatrix4fv;
+PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC __glewProgramUniformMatrix4x2dv = _glewLazy_glProgramUniformMatrix4x2dv;
+PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC __glewProgramUniformMatrix4x2fv = _glewLazy_glProgramUniformMatrix4x2fv;
+PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC __glewProgramUniformMatrix4x3dv = _glewLazy_glProgramUniformMatrix4x3dv;
+PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC __glewProgramUniformMatrix4x3fv = _glewLazy_glProgramUniformMatrix4x3fv;
+PFNGLUSEPROGRAMSTAGESPROC __glewUseProgramStages = _glewLazy_glUseProgramStages;
+PFNGLVALIDATEPROGRAMPIPELINEPROC __glewValidateProgramPipeline = _glewLazy_glValidateProgramPipeline;
+
+PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC __glewGetActiveAtomicCounterBufferiv = _glewLazy_glGetActiveAtomicCounterBufferiv;
+
+PFNGLBINDIMAGETEXTUREPROC __glewBindImageTexture = _glewLazy_glBindImageTexture;
+PFNGLMEMORYBARRIERPROC __glewMemoryBarrier = _glewLazy_glMemoryBarrier;
+
+PFNGLATTACHOBJECTARBPROC __glewAttachObjectARB = _glewLazy_glAttachObjectARB;
+PFNGLCOMPILESHADERARBPROC __glewCompileShaderARB = _glewLazy_glCompileShaderARB;
+PFNGLCREATEPROGRAMOBJECTARBPROC __glewCreateProgramObjectARB = _glewLazy_glCreateProgramObjectARB;
+PFNGLCREATESHADEROBJECTARBPROC __glewCreateShaderObjectARB = _glewLazy_glCreateShaderObjectARB;
+PFNGLDELETEOBJECTARBPROC __glewDeleteObjectARB = _glewLazy_glDeleteObjectARB;
+PFNGLDETACHOBJECTARBPROC __glewDetachObjectARB = _glewLazy_glDetachObjectARB;
+PFNGLGETACTIVEUNIFORMARBPROC __glewGetActiveUniformARB = _glewLazy_glGetActiveUniformARB;
+PFNGLGETATTACHEDOBJECTSARBPROC __glewGetAttachedObjectsARB = _glewLazy_glGetAttachedObjectsARB;
+PFNGLGETHANDLEARBPROC __glewGetHandleARB = _glewLazy_glGetHandleARB;
+PFNGLGETINFOLOGARBPROC __glewGetInfoLogARB = _glewLazy_glGetInfoLogARB;
+PFNGLGETOBJECTPARAMETERFVARBPROC __glewGetObjectParameterfvARB = _glewLazy_glGetObjectParameterfvARB;
+PFNGLGETOBJECTPARAMETERIVARBPROC __glewGetObjectParameterivARB = _glewLazy_glGetObjectParameterivARB;
+PFNGLGETSHADERSOURCEARBPROC __glewGetShaderSourceARB = _glewLazy_glGetShaderSourceARB;
+PFNGLGETUNIFORMLOCATIONARBPROC __glewGetUniformLocationARB = _glewLazy_glGetUniformLocationARB;
+PFNGLGETUNIFORMFVARBPROC __glewGetUniformfvARB = _glewLazy_glGetUniformfvARB;
+PFNGLGETUNIFORMIVARBPROC __glewGetUniformivARB = _glewLazy_glGetUniformivARB;
+PFNGLLINKPROGRAMARBPROC __glewLinkProgramARB = _glewLazy_glLinkProgramARB;
+PFNGLSHADERSOURCEARBPROC __glewShaderSourceARB = _glewLazy_glShaderSourceARB;
+PFNGLUNIFORM1FARBPROC __glewUniform1fARB = _glewLazy_glUniform1fARB;
+PFNGLUNIFORM1FVARBPROC __glewUniform1fvARB = _glewLazy_glUniform1fvARB;
+PFNGLUNIFORM1IARBPROC __glewUniform1iARB = _glewLazy_glUniform1iARB;
+PFNGLUNIFORM1IVARBPROC __glewUniform1ivARB = _glewLazy_glUniform1ivARB;
+PFNGLUNIFORM2FARBPROC __glewUniform2fARB = _glewLazy_glUniform2fARB;
+PFNGLUNIFORM2FVARBPROC __glewUniform2fvARB = _glewLazy_glUniform2fvARB;
+PFNGLUNIFORM2IARBPROC __glewUniform2iARB = _glewLazy_glUniform2iARB;
+PFNGLUNIFORM2IVARBPROC __glewUniform2ivARB = _glewLazy_glUniform2ivARB;
+PFNGLUNIFORM3FARBPROC __glewUniform3fARB = _glewLazy_glUniform3fARB;
+PFNGLUNIFORM3FVARBPROC __glewUniform3fvARB = _glewLazy_glUniform3fvARB;
+PFNGLUNIFORM3IARBPROC __glewUniform3iARB = _glewLazy_glUniform3iARB;
+PFNGLUNIFORM3IVARBPROC __glewUniform3ivARB = _glewLazy_glUniform3ivARB;
+PFNGLUNIFORM4FARBPROC __glewUniform4fARB = _glewLazy_glUniform4fARB;
+PFNGLUNIFORM4FVARBPROC __glewUniform4fvARB = _glewLazy_glUniform4fvARB;
+PFNGLUNIFORM4IARBPROC __glewUniform4iARB = _glewLazy_glUniform4iARB;
+PFNGLUNIFORM4IVARBPROC __glewUniform4ivARB = _glewLazy_glUniform4ivARB;
+PFNGLUNIFORMMATRIX2FVARBPROC __glewUniformMatrix2fvARB = _glewLazy_glUniformMatrix2fvARB;
+PFNGLUNIFORMMATRIX3FVARBPROC __glewUniformMatrix3fvARB = _glewLazy_glUniformMatrix3fvARB;
+PFNGLUNIFORMMATRIX4FVARBPROC __glewUniformMatrix4fvARB = _glewLazy_glUniformMatrix4fvARB;
+PFNGLUSEPROGRAMOBJECTARBPROC __glewUseProgramObjectARB = _glewLazy_glUseProgramObjectARB;
+PFNGLVALIDATEPROGRAMARBPROC __glewValidateProgramARB = _glewLazy_glValidateProgramARB;
+
+PFNGLSHADERSTORAGEBLOCKBINDINGPROC __glewShaderStorageBlockBinding = _glewLazy_glShaderStorageBlockBinding;
+
+PFNGLGETACTIVESUBROUTINENAMEPROC __glewGetActiveSubroutineName = _glewLazy_glGetActiveSubroutineName;
+PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC __glewGetActiveSubroutineUniformName = _glewLazy_glGetActiveSubroutineUniformName;
+PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC __glewGetActiveSubroutineUniformiv = _glewLazy_glGetActiveSubroutineUniformiv;
+PFNGLGETPROGRAMSTAGEIVPROC __glewGetProgramStageiv = _glewLazy_glGetProgramStageiv;
+PFNGLGETSUBROUTINEINDEXPROC __glewGetSubroutineIndex = _glewLazy_glGetSubroutineIndex;
+PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC __glewGetSubroutineUniformLocation = _glewLazy_glGetSubroutineUniformLocation;
+PFNGLGETUNIFORMSUBROUTINEUIVPROC __glewGetUniformSubroutineuiv = _glewLazy_glGetUniformSubroutineuiv;
+PFNGLUNIFORMSUBROUTINESUIVPROC __glewUniformSubroutinesuiv = _glewLazy_glUniformSubroutinesuiv;
+
+PFNGLCOMPILESHADERINCLUDEARBPROC __glewCompileShaderIncludeARB = _glewLazy_glCompileShaderIncludeARB;
+PFNGLDELETENAMEDSTRINGARBPROC __glewDeleteNamedStringARB = _glewLazy_glDeleteNamedStringARB;
+PFNGLGETNAMEDSTRINGARBPROC __glewGetNamedStringARB = _glewLazy_glGetNamedStringARB;
+PFNGLGETNAMEDSTRINGIVARBPROC __glewGetNamedStringivARB = _glewLazy_glGetNamedStringivARB;
+PFNGLISNAMEDSTRINGARBPROC __glewIsNamedStringARB = _glewLazy_glIsNamedStringARB;
+PFNGLNAMEDSTRINGARBPROC __glewNamedStringARB = _glewLazy_glNamedStringARB;
+
+PFNGLBUFFERPAGECOMMITMENTARBPROC __glewBufferPageCommitmentARB = _glewLazy_glBufferPageCommitmentARB;
+
+PFNGLTEXPAGECOMMITMENTARBPROC __glewTexPageCommitmentARB = _glewLazy_glTexPageCommitmentARB;
+PFNGLTEXTUREPAGECOMMITMENTEXTPROC __glewTexturePageCommitmentEXT = _glewLazy_glTexturePageCommitmentEXT;
+
+PFNGLCLIENTWAITSYNCPROC __glewClientWaitSync = _glewLazy_glClientWaitSync;
+PFNGLDELETESYNCPROC __glewDeleteSync = _glewLazy_glDeleteSync;
+PFNGLFENCESYNCPROC __glewFenceSync = _glewLazy_glFenceSync;
+PFNGLGETINTEGER64VPROC __glewGetInteger64v = _glewLazy_glGetInteger64v;
+PFNGLGETSYNCIVPROC __glewGetSynciv = _glewLazy_glGetSynciv;
+PFNGLISSYNCPROC __glewIsSync = _glewLazy_glIsSync;
+PFNGLWAITSYNCPROC __glewWaitSync = _glewLazy_glWaitSync;
+
+PFNGLPATCHPARAMETERFVPROC __glewPatchParameterfv = _glewLazy_glPatchParameterfv;
+PFNGLPATCHPARAMETERIPROC __glewPatchParameteri = _glewLazy_glPatchParameteri;
+
+PFNGLTEXTUREBARRIERPROC __glewTextureBarrier = _glewLazy_glTextureBarrier;
+
+PFNGLTEXBUFFERARBPROC __glewTexBufferARB = _glewLazy_glTexBufferARB;
+
+PFNGLTEXBUFFERRANGEPROC __glewTexBufferRange = _glewLazy_glTexBufferRange;
+PFNGLTEXTUREBUFFERRANGEEXTPROC __glewTextureBufferRangeEXT = _glewLazy_glTextureBufferRangeEXT;
+
+PFNGLCOMPRESSEDTEXIMAGE1DARBPROC __glewCompressedTexImage1DARB = _glewLazy_glCompressedTexImage1DARB;
+PFNGLCOMPRESSEDTEXIMAGE2DARBPROC __glewCompressedTexImage2DARB = _glewLazy_glCompressedTexImage2DARB;
+PFNGLCOMPRESSEDTEXIMAGE3DARBPROC __glewCompressedTexImage3DARB = _glewLazy_glCompressedTexImage3DARB;
+PFNGLCOMPRESSEDTEXSUBIMAGE1DARBPROC __glewCompressedTexSubImage1DARB = _glewLazy_glCompressedTexSubImage1DARB;
+PFNGLCOMPRESSEDTEXSUBIMAGE2DARBPROC __glewCompressedTexSubImage2DARB = _glewLazy_glCompressedTexSubImage2DARB;
+PFNGLCOMPRESSEDTEXSUBIMAGE3DARBPROC __glewCompressedTexSubImage3DARB = _glewLazy_glCompressedTexSubImage3DARB;
+PFNGLGETCOMPRESSEDTEXIMAGEARBPROC __glewGetCompressedTexImageARB = _glewLazy_glGetCompressedTexImageARB;
+
+PFNGLGETMULTISAMPLEFVPROC __glewGetMultisamplefv = _glewLazy_glGetMultisamplefv;
+PFNGLSAMPLEMASKIPROC __glewSampleMaski = _glewLazy_glSampleMaski;
+PFNGLTEXIMAGE2DMULTISAMPLEPROC __glewTexImage2DMultisample = _glewLazy_glTexImage2DMultisample;
+PFNGLTEXIMAGE3DMULTISAMPLEPROC __glewTexImage3DMultisample = _glewLazy_glTexImage3DMultisample;
+
+PFNGLTEXSTORAGE1DPROC __glewTexStorage1D = _glewLazy_glTexStorage1D;
+PFNGLTEXSTORAGE2DPROC __glewTexStorage2D = _glewLazy_glTexStorage2D;
+PFNGLTEXSTORAGE3DPROC __glewTexStorage3D = _glewLazy_glTexStorage3D;
+PFNGLTEXTURESTORAGE1DEXTPROC __glewTextureStorage1DEXT = _glewLazy_glTextureStorage1DEXT;
+PFNGLTEXTURESTORAGE2DEXTPROC __glewTextureStorage2DEXT = _glewLazy_glTextureStorage2DEXT;
+PFNGLTEXTURESTORAGE3DEXTPROC __glewTextureStorage3DEXT = _glewLazy_glTextureStorage3DEXT;
+
+PFNGLTEXSTORAGE2DMULTISAMPLEPROC __glewTexStorage2DMultisample = _glewLazy_glTexStorage2DMultisample;
+PFNGLTEXSTORAGE3DMULTISAMPLEPROC __glewTexStorage3DMultisample = _glewLazy_glTexStorage3DMultisample;
+PFNGLTEXTURESTORAGE2DMULTISAMPLEEXTPROC __glewTextureStorage2DMultisampleEXT = _glewLazy_glTextureStorage2DMultisampleEXT;
+PFNGLTEXTURESTORAGE3DMULTISAMPLEEXTPROC __glewTextureStorage3DMultisampleEXT = _glewLazy_glTextureStorage3DMultisampleEXT;
+
+PFNGLTEXTUREVIEWPROC __glewTextureView = _glewLazy_glTextureView;
+
+PFNGLGETQUERYOBJECTI64VPROC __glewGetQueryObjecti64v = _glewLazy_glGetQueryObjecti64v;
+PFNGLGETQUERYOBJECTUI64VPROC __glewGetQueryObjectui64v = _glewLazy_glGetQueryObjectui64v;
+PFNGLQUERYCOUNTERPROC __glewQueryCounter = _glewLazy_glQueryCounter;
+
+PFNGLBINDTRANSFORMFEEDBACKPROC __glewBindTransformFeedback = _glewLazy_glBindTransformFeedback;
+PFNGLDELETETRANSFORMFEEDBACKSPROC __glewDeleteTransformFeedbacks = _glewLazy_glDeleteTransformFeedbacks;
+PFNGLDRAWTRANSFORMFEEDBACKPROC __glewDrawTransformFeedback = _glewLazy_glDrawTransformFeedback;
+PFNGLGENTRANSFORMFEEDBACKSPROC __glewGenTransformFeedbacks = _glewLazy_glGenTransformFeedbacks;
+PFNGLISTRANSFORMFEEDBACKPROC __glewIsTransformFeedback = _glewLazy_glIsTransformFeedback;
+PFNGLPAUSETRANSFORMFEEDBACKPROC __glewPauseTransformFeedback = _glewLazy_glPauseTransformFeedback;
+PFNGLRESUMETRANSFORMFEEDBACKPROC __glewResumeTransformFeedback = _glewLazy_glResumeTransformFeedback;
+
+PFNGLBEGINQUERYINDEXEDPROC __glewBeginQueryIndexed = _glewLazy_glBeginQueryIndexed;
+PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC __glewDrawTransformFeedbackStream = _glewLazy_glDrawTransformFeedbackStream;
+PFNGLENDQUERYINDEXEDPROC __glewEndQueryIndexed = _glewLazy_glEndQueryIndexed;
+PFNGLGETQUERYINDEXEDIVPROC __glewGetQueryIndexediv = _glewLazy_glGetQueryIndexediv;
+
+PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC __glewDrawTransformFeedbackInstanced = _glewLazy_glDrawTransformFeedbackInstanced;
+PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC __glewDrawTransformFeedbackStreamInstanced = _glewLazy_glDrawTransformFeedbackStreamInstanced;
+
+PFNGLLOADTRANSPOSEMATRIXDARBPROC __glewLoadTransposeMatrixdARB = _glewLazy_glLoadTransposeMatrixdARB;
+PFNGLLOADTRANSPOSEMATRIXFARBPROC __glewLoadTransposeMatrixfARB = _glewLazy_glLoadTransposeMatrixfARB;
+PFNGLMULTTRANSPOSEMATRIXDARBPROC __glewMultTransposeMatrixdARB = _glewLazy_glMultTransposeMatrixdARB;
+PFNGLMULTTRANSPOSEMATRIXFARBPROC __glewMultTransposeMatrixfARB = _glewLazy_glMultTransposeMatrixfARB;
+
+PFNGLBINDBUFFERBASEPROC __glewBindBufferBase = _glewLazy_glBindBufferBase;
+PFNGLBINDBUFFERRANGEPROC __glewBindBufferRange = _glewLazy_glBindBufferRange;
+PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC __glewGetActiveUniformBlockName = _glewLazy_glGetActiveUniformBlockName;
+PFNGLGETACTIVEUNIFORMBLOCKIVPROC __glewGetActiveUniformBlockiv = _glewLazy_glGetActiveUniformBlockiv;
+PFNGLGETACTIVEUNIFORMNAMEPROC __glewGetActiveUniformName = _glewLazy_glGetActiveUniformName;
+PFNGLGETACTIVEUNIFORMSIVPROC __glewGetActiveUniformsiv = _glewLazy_glGetActiveUniformsiv;
+PFNGLGETINTEGERI_VPROC __glewGetIntegeri_v = _glewLazy_glGetIntegeri_v;
+PFNGLGETUNIFORMBLOCKINDEXPROC __glewGetUniformBlockIndex = _glewLazy_glGetUniformBlockIndex;
+PFNGLGETUNIFORMINDICESPROC __glewGetUniformIndices = _glewLazy_glGetUniformIndices;
+PFNGLUNIFORMBLOCKBINDINGPROC __glewUniformBlockBinding = _glewLazy_glUniformBlockBinding;
+
+PFNGLBINDVERTEXARRAYPROC __glewBindVertexArray = _glewLazy_glBindVertexArray;
+PFNGLDELETEVERTEXARRAYSPROC __glewDeleteVertexArrays = _glewLazy_glDeleteVertexArrays;
+PFNGLGENVERTEXARRAYSPROC __glewGenVertexArrays = _glewLazy_glGenVertexArrays;
+PFNGLISVERTEXARRAYPROC __glewIsVertexArray = _glewLazy_glIsVertexArray;
+
+PFNGLGETVERTEXATTRIBLDVPROC __glewGetVertexAttribLdv = _glewLazy_glGetVertexAttribLdv;
+PFNGLVERTEXATTRIBL1DPROC __glewVertexAttribL1d = _glewLazy_glVertexAttribL1d;
+PFNGLVERTEXATTRIBL1DVPROC __glewVertexAttribL1dv = _glewLazy_glVertexAttribL1dv;
+PFNGLVERTEXATTRIBL2DPROC __glewVertexAttribL2d = _glewLazy_glVertexAttribL2d;
+PFNGLVERTEXATTRIBL2DVPROC __glewVertexAttribL2dv = _glewLazy_glVertexAttribL2dv;
+PFNGLVERTEXATTRIBL3DPROC __glewVertexAttribL3d = _glewLazy_glVertexAttribL3d;
+PFNGLVERTEXATTRIBL3DVPROC __glewVertexAttribL3dv = _glewLazy_glVertexAttribL3dv;
+PFNGLVERTEXATTRIBL4DPROC __glewVertexAttribL4d = _glewLazy_glVertexAttribL4d;
+PFNGLVERTEXATTRIBL4DVPROC __glewVertexAttribL4dv = _glewLazy_glVertexAttribL4dv;
+PFNGLVERTEXATTRIBLPOINTERPROC __glewVertexAttribLPointer = _glewLazy_glVertexAttribLPointer;
+
+PFNGLBINDVERTEXBUFFERPROC __glewBindVertexBuffer = _glewLazy_glBindVertexBuffer;
+PFNGLVERTEXARRAYBINDVERTEXBUFFEREXTPROC __glewVertexArrayBindVertexBufferEXT = _glewLazy_glVertexArrayBindVertexBufferEXT;
+PFNGLVERTEXARRAYVERTEXATTRIBBINDINGEXTPROC __glewVertexArrayVertexAttribBindingEXT = _glewLazy_glVertexArrayVertexAttribBindingEXT;
+PFNGLVERTEXARRAYVERTEXATTRIBFORMATEXTPROC __glewVertexArrayVertexAttribFormatEXT = _glewLazy_glVertexArrayVertexAttribFormatEXT;
+PFNGLVERTEXARRAYVERTEXATTRIBIFORMATEXTPROC __glewVertexArrayVertexAttribIFormatEXT = _glewLazy_glVertexArrayVertexAttribIFormatEXT;
+PFNGLVERTEXARRAYVERTEXATTRIBLFORMATEXTPROC __glewVertexArrayVertexAttribLFormatEXT = _glewLazy_glVertexArrayVertexAttribLFormatEXT;
+PFNGLVERTEXARRAYVERTEXBINDINGDIVISOREXTPROC __glewVertexArrayVertexBindingDivisorEXT = _glewLazy_glVertexArrayVertexBindingDivisorEXT;
+PFNGLVERTEXATTRIBBINDINGPROC __glewVertexAttribBinding = _glewLazy_glVertexAttribBinding;
+PFNGLVERTEXATTRIBFORMATPROC __glewVertexAttribFormat = _glewLazy_glVertexAttribFormat;
+PFNGLVERTEXATTRIBIFORMATPROC __glewVertexAttribIFormat = _glewLazy_glVertexAttribIFormat;
+PFNGLVERTEXATTRIBLFORMATPROC __glewVertexAttribLFormat = _glewLazy_glVertexAttribLFormat;
+PFNGLVERTEXBINDINGDIVISORPROC __glewVertexBindingDivisor = _glewLazy_glVertexBindingDivisor;
+
+PFNGLVERTEXBLENDARBPROC __glewVertexBlendARB = _glewLazy_glVertexBlendARB;
+PFNGLWEIGHTPOINTERARBPROC __glewWeightPointerARB = _glewLazy_glWeightPointerARB;
+PFNGLWEIGHTBVARBPROC __glewWeightbvARB = _glewLazy_glWeightbvARB;
+PFNGLWEIGHTDVARBPROC __glewWeightdvARB = _glewLazy_glWeightdvARB;
+PFNGLWEIGHTFVARBPROC __glewWeightfvARB = _glewLazy_glWeightfvARB;
+PFNGLWEIGHTIVARBPROC __glewWeightivARB = _glewLazy_glWeightivARB;
+PFNGLWEIGHTSVARBPROC __glewWeightsvARB = _glewLazy_glWeightsvARB;
+PFNGLWEIGHTUBVARBPROC __glewWeightubvARB = _glewLazy_glWeightubvARB;
+PFNGLWEIGHTUIVARBPROC __glewWeightuivARB = _glewLazy_glWeightuivARB;
+PFNGLWEIGHTUSVARBPROC __glewWeightusvARB = _glewLazy_glWeightusvARB;
+
+PFNGLBINDBUFFERARBPROC __glewBindBufferARB = _glewLazy_glBindBufferARB;
+PFNGLBUFFERDATAARBPROC __glewBufferDataARB = _glewLazy_glBufferDataARB;
+PFNGLBUFFERSUBDATAARBPROC __glewBufferSubDataARB = _glewLazy_glBufferSubDataARB;
+PFNGLDELETEBUFFERSARBPROC __glewDeleteBuffersARB = _glewLazy_glDeleteBuffersARB;
+PFNGLGENBUFFERSARBPROC __glewGenBuffersARB = _glewLazy_glGenBuffersARB;
+PFNGLGETBUFFERPARAMETERIVARBPROC __glewGetBufferParameterivARB = _glewLazy_glGetBufferParameterivARB;
+PFNGLGETBUFFERPOINTERVARBPROC __glewGetBufferPointervARB = _glewLazy_glGetBufferPointervARB;
+PFNGLGETBUFFERSUBDATAARBPROC __glewGetBufferSubDataARB = _glewLazy_glGetBufferSubDataARB;
+PFNGLISBUFFERARBPROC __glewIsBufferARB = _glewLazy_glIsBufferARB;
+PFNGLMAPBUFFERARBPROC __glewMapBufferARB = _glewLazy_glMapBufferARB;
+PFNGLUNMAPBUFFERARBPROC __glewUnmapBufferARB = _glewLazy_glUnmapBufferARB;
+
+PFNGLBINDPROGRAMARBPROC __glewBindProgramARB = _glewLazy_glBindProgramARB;
+PFNGLDELETEPROGRAMSARBPROC __glewDeleteProgramsARB = _glewLazy_glDeleteProgramsARB;
+PFNGLDISABLEVERTEXATTRIBARRAYARBPROC __glewDisableVertexAttribArrayARB = _glewLazy_glDisableVertexAttribArrayARB;
+PFNGLENABLEVERTEXATTRIBARRAYARBPROC __glewEnableVertexAttribArrayARB = _glewLazy_glEnableVertexAttribArrayARB;
+PFNGLGENPROGRAMSARBPROC __glewGenProgramsARB = _glewLazy_glGenProgramsARB;
+PFNGLGETPROGRAMENVPARAMETERDVARBPROC __glewGetProgramEnvParameterdvARB = _glewLazy_glGetProgramEnvParameterdvARB;
+PFNGLGETPROGRAMENVPARAMETERFVARBPROC __glewGetProgramEnvParameterfvARB = _glewLazy_glGetProgramEnvParameterfvARB;
+PFNGLGETPROGRAMLOCALPARAMETERDVARBPROC __glewGetProgramLocalParameterdvARB = _glewLazy_glGetProgramLocalParameterdvARB;
+PFNGLGETPROGRAMLOCALPARAMETERFVARBPROC __glewGetProgramLocalParameterfvARB = _glewLazy_glGetProgramLocalParameterfvARB;
+PFNGLGETPROGRAMSTRINGARBPROC __glewGetProgramStringARB = _glewLazy_glGetProgramStringARB;
+PFNGLGETPROGRAMIVARBPROC __glewGetProgramivARB = _glewLazy_glGetProgramivARB;
+PFNGLGETVERTEXATTRIBPOINTERVARBPROC __glewGetVertexAttribPointervARB = _glewLazy_glGetVertexAttribPointervARB;
+PFNGLGETVERTEXATTRIBDVARBPROC __glewGetVertexAttribdvARB = _glewLazy_glGetVertexAttribdvARB;
+PFNGLGETVERTEXATTRIBFVARBPROC __glewGetVertexAttribfvARB = _glewLazy_glGetVertexAttribfvARB;
+PFNGLGETVERTEXATTRIBIVARBPROC __glewGetVertexAttribivARB = _glewLazy_glGetVertexAttribivARB;
+PFNGLISPROGRAMARBPROC __glewIsProgramARB = _glewLazy_glIsProgramARB;
+PFNGLPROGRAMENVPARAMETER4DARBPROC __glewProgramEnvParameter4dARB = _glewLazy_glProgramEnvParameter4dARB;
+PFNGLPROGRAMENVPARAMETER4DVARBPROC __glewProgramEnvParameter4dvARB = _glewLazy_glProgramEnvParameter4dvARB;
+PFNGLPROGRAMENVPARAMETER4FARBPROC __glewProgramEnvParameter4fARB = _glewLazy_glProgramEnvParameter4fARB;
+PFNGLPROGRAMENVPARAMETER4FVARBPROC __glewProgramEnvParameter4fvARB = _glewLazy_glProgramEnvParameter4fvARB;
+PFNGLPROGRAMLOCALPARAMETER4DARBPROC __glewProgramLocalParameter4dARB = _glewLazy_glProgramLocalParameter4dARB;
+PFNGLPROGRAMLOCALPARAMETER4DVARBPROC __glewProgramLocalParameter4dvARB = _glewLazy_glProgramLocalParameter4dvARB;
+PFNGLPROGRAMLOCALPARAMETER4FARBPROC __glewProgramLocalParameter4fARB = _glewLazy_glProgramLocalParameter4fARB;
+PFNGLPROGRAMLOCALPARAMETER4FVARBPROC __glewProgramLocalParameter4fvARB = _glewLazy_glProgramLocalParameter4fvARB;
+PFNGLPROGRAMSTRINGARBPROC __glewProgramStringARB = _glewLazy_glProgramStringARB;
+PFNGLVERTEXATTRIB1DARBPROC __glewVertexAttrib1dARB = _glewLazy_glVertexAttrib1dARB;
+PFNGLVERTEXATTRIB1DVARBPROC __glewVertexAttrib1dvARB = _glewLazy_glVertexAttrib1dvARB;
+PFNGLVERTEXATTRIB1FARBPROC __glewVertexAttrib1fARB = _glewLazy_glVertexAttrib1fARB;
+PFNGLVERTEXATTRIB1FVARBPROC __glewVertexAttrib1fvARB = _glewLazy_glVertexAttrib1fvARB;
+PFNGLVERTEXATTRIB1SARBPROC __glewVertexAttrib1sARB = _glewLazy_glVertexAttrib1sARB;
+PFNGLVERTEXATTRIB1SVARBPROC __glewVertexAttrib1svARB = _glewLazy_glVertexAttrib1svARB;
+PFNGLVERTEXATTRIB2DARBPROC __glewVertexAttrib2dARB = _glewLazy_glVertexAttrib2dARB;
+PFNGLVERTEXATTRIB2DVARBPROC __glewVertexAttrib2dvARB = _glewLazy_glVertexAttrib2dvARB;
+PFNGLVERTEXATTRIB2FARBPROC __glewVertexAttrib2fARB = _glewLazy_glVertexAttrib2fARB;
+PFNGLVERTEXATTRIB2FVARBPROC __glewVertexAttrib2fvARB = _glewLazy_glVertexAttrib2fvARB;
+PFNGLVERTEXATTRIB2SARBPROC __glewVertexAttrib2sARB = _glewLazy_glVertexAttrib2sARB;
+PFNGLVERTEXATTRIB2SVARBPROC __glewVertexAttrib2svARB = _glewLazy_glVertexAttrib2svARB;
+PFNGLVERTEXATTRIB3DARBPROC __glewVertexAttrib3dARB = _glewLazy_glVertexAttrib3dARB;
+PFNGLVERTEXATTRIB3DVARBPROC __glewVertexAttrib3dvARB = _glewLazy_glVertexAttrib3dvARB;
+PFNGLVERTEXATTRIB3FARBPROC __glewVertexAttrib3fARB = _glewLazy_glVertexAttrib3fARB;
+PFNGLVERTEXATTRIB3FVARBPROC __glewVertexAttrib3fvARB = _glewLazy_glVertexAttrib3fvARB;
+PFNGLVERTEXATTRIB3SARBPROC __glewVertexAttrib3sARB = _glewLazy_glVertexAttrib3sARB;
+PFNGLVERTEXATTRIB3SVARBPROC __glewVertexAttrib3svARB = _glewLazy_glVertexAttrib3svARB;
+PFNGLVERTEXATTRIB4NBVARBPROC __glewVertexAttrib4NbvARB = _glewLazy_glVertexAttrib4NbvARB;
+PFNGLVERTEXATTRIB4NIVARBPROC __glewVertexAttrib4NivARB = _glewLazy_glVertexAttrib4NivARB;
+PFNGLVERTEXATTRIB4NSVARBPROC __glewVertexAttrib4NsvARB = _glewLazy_glVertexAttrib4NsvARB;
+PFNGLVERTEXATTRIB4NUBARBPROC __glewVertexAttrib4NubARB = _glewLazy_glVertexAttrib4NubARB;
+PFNGLVERTEXATTRIB4NUBVARBPROC __glewVertexAttrib4NubvARB = _glewLazy_glVertexAttrib4NubvARB;
+PFNGLVERTEXATTRIB4NUIVARBPROC __glewVertexAttrib4NuivARB = _glewLazy_glVertexAttrib4NuivARB;
+PFNGLVERTEXATTRIB4NUSVARBPROC __glewVertexAttrib4NusvARB = _glewLazy_glVertexAttrib4NusvARB;
+PFNGLVERTEXATTRIB4BVARBPROC __glewVertexAttrib4bvARB = _glewLazy_glVertexAttrib4bvARB;
+PFNGLVERTEXATTRIB4DARBPROC __glewVertexAttrib4dARB = _glewLazy_glVertexAttrib4dARB;
+PFNGLVERTEXATTRIB4DVARBPROC __glewVertexAttrib4dvARB = _glewLazy_glVertexAttrib4dvARB;
+PFNGLVERTEXATTRIB4FARBPROC __glewVertexAttrib4fARB = _glewLazy_glVertexAttrib4fARB;
+PFNGLVERTEXATTRIB4FVARBPROC __glewVertexAttrib4fvARB = _glewLazy_glVertexAttrib4fvARB;
+PFNGLVERTEXATTRIB4IVARBPROC __glewVertexAttrib4ivARB = _glewLazy_glVertexAttrib4ivARB;
+PFNGLVERTEXATTRIB4SARBPROC __glewVertexAttrib4sARB = _glewLazy_glVertexAttrib4sARB;
+PFNGLVERTEXATTRIB4SVARBPROC __glewVertexAttrib4svARB = _glewLazy_glVertexAttrib4svARB;
+PFNGLVERTEXATTRIB4UBVARBPROC __glewVertexAttrib4ubvARB = _glewLazy_glVertexAttrib4ubvARB;
+PFNGLVERTEXATTRIB4UIVARBPROC __glewVertexAttrib4uivARB = _glewLazy_glVertexAttrib4uivARB;
+PFNGLVERTEXATTRIB4USVARBPROC __glewVertexAttrib4usvARB = _glewLazy_glVertexAttrib4usvARB;
+PFNGLVERTEXATTRIBPOINTERARBPROC __glewVertexAttribPointerARB = _glewLazy_glVertexAttribPointerARB;
+
+PFNGLBINDATTRIBLOCATIONARBPROC __glewBindAttribLocationARB = _glewLazy_glBindAttribLocationARB;
+PFNGLGETACTIVEATTRIBARBPROC __glewGetActiveAttribARB = _glewLazy_glGetActiveAttribARB;
+PFNGLGETATTRIBLOCATIONARBPROC __glewGetAttribLocationARB = _glewLazy_glGetAttribLocationARB;
+
+PFNGLCOLORP3UIPROC __glewColorP3ui = _glewLazy_glColorP3ui;
+PFNGLCOLORP3UIVPROC __glewColorP3uiv = _glewLazy_glColorP3uiv;
+PFNGLCOLORP4UIPROC __glewColorP4ui = _glewLazy_glColorP4ui;
+PFNGLCOLORP4UIVPROC __glewColorP4uiv = _glewLazy_glColorP4uiv;
+PFNGLMULTITEXCOORDP1UIPROC __glewMultiTexCoordP1ui = _glewLazy_glMultiTexCoordP1ui;
+PFNGLMULTITEXCOORDP1UIVPROC __glewMultiTexCoordP1uiv = _glewLazy_glMultiTexCoordP1uiv;
+PFNGLMULTITEXCOORDP2UIPROC __glewMultiTexCoordP2ui = _glewLazy_glMultiTexCoordP2ui;
+PFNGLMULTITEXCOORDP2UIVPROC __glewMultiTexCoordP2uiv = _glewLazy_glMultiTexCoordP2uiv;
+PFNGLMULTITEXCOORDP3UIPROC __glewMultiTexCoordP3ui = _glewLazy_glMultiTexCoordP3ui;
+PFNGLMULTITEXCOORDP3UIVPROC __glewMultiTexCoordP3uiv = _glewLazy_glMultiTexCoordP3uiv;
+PFNGLMULTITEXCOORDP4UIPROC __glewMultiTexCoordP4ui = _glewLazy_glMultiTexCoordP4ui;
+PFNGLMULTITEXCOORDP4UIVPROC __glewMultiTexCoordP4uiv = _glewLazy_glMultiTexCoordP4uiv;
+PFNGLNORMALP3UIPROC __glewNormalP3ui = _glewLazy_glNormalP3ui;
+PFNGLNORMALP3UIVPROC __glewNormalP3uiv = _glewLazy_glNormalP3uiv;
+PFNGLSECONDARYCOLORP3UIPROC __glewSecondaryColorP3ui = _glewLazy_glSecondaryColorP3ui;
+PFNGLSECONDARYCOLORP3UIVPROC __glewSecondaryColorP3uiv = _glewLazy_glSecondaryColorP3uiv;
+PFNGLTEXCOORDP1UIPROC __glewTexCoordP1ui = _glewLazy_glTexCoordP1ui;
+PFNGLTEXCOORDP1UIVPROC __glewTexCoordP1uiv = _glewLazy_glTexCoordP1uiv;
+PFNGLTEXCOORDP2UIPROC __glewTexCoordP2ui = _glewLazy_glTexCoordP2ui;
+PFNGLTEXCOORDP2UIVPROC __glewTexCoordP2uiv = _glewLazy_glTexCoordP2uiv;
+PFNGLTEXCOORDP3UIPROC __glewTexCoordP3ui = _glewLazy_glTexCoordP3ui;
+PFNGLTEXCOORDP3UIVPROC __glewTexCoordP3uiv = _glewLazy_glTexCoordP3uiv;
+PFNGLTEXCOORDP4UIPROC __glewTexCoordP4ui = _glewLazy_glTexCoordP4ui;
+PFNGLTEXCOORDP4UIVPROC __glewTexCoordP4uiv = _glewLazy_glTexCoordP4uiv;
+PFNGLVERTEXATTRIBP1UIPROC __glewVertexAttribP1ui = _glewLazy_glVertexAttribP1ui;
+PFNGLVERTEXATTRIBP1UIVPROC __glewVertexAttribP1uiv = _glewLazy_glVertexAttribP1uiv;
+PFNGLVERTEXATTRIBP2UIPROC __glewVertexAttribP2ui = _glewLazy_glVertexAttribP2ui;
+PFNGLVERTEXATTRIBP2UIVPROC __glewVertexAttribP2uiv = _glewLazy_glVertexAttribP2uiv;
+PFNGLVERTEXATTRIBP3UIPROC __glewVertexAttribP3ui = _glewLazy_glVertexAttribP3ui;
+PFNGLVERTEXATTRIBP3UIVPROC __glewVertexAttribP3uiv = _glewLazy_glVertexAttribP3uiv;
+PFNGLVERTEXATTRIBP4UIPROC __glewVertexAttribP4ui = _glewLazy_glVertexAttribP4ui;
+PFNGLVERTEXATTRIBP4UIVPROC __glewVertexAttribP4uiv = _glewLazy_glVertexAttribP4uiv;
+PFNGLVERTEXP2UIPROC __glewVertexP2ui = _glewLazy_glVertexP2ui;
+PFNGLVERTEXP2UIVPROC __glewVertexP2uiv = _glewLazy_glVertexP2uiv;
+PFNGLVERTEXP3UIPROC __glewVertexP3ui = _glewLazy_glVertexP3ui;
+PFNGLVERTEXP3UIVPROC __glewVertexP3uiv = _glewLazy_glVertexP3uiv;
+PFNGLVERTEXP4UIPROC __glewVertexP4ui = _glewLazy_glVertexP4ui;
+PFNGLVERTEXP4UIVPROC __glewVertexP4uiv = _glewLazy_glVertexP4uiv;
+
+PFNGLDEPTHRANGEARRAYVPROC __glewDepthRangeArrayv = _glewLazy_glDepthRangeArrayv;
+PFNGLDEPTHRANGEINDEXEDPROC __glewDepthRangeIndexed = _glewLazy_glDepthRangeIndexed;
+PFNGLGETDOUBLEI_VPROC __glewGetDoublei_v = _glewLazy_glGetDoublei_v;
+PFNGLGETFLOATI_VPROC __glewGetFloati_v = _glewLazy_glGetFloati_v;
+PFNGLSCISSORARRAYVPROC __glewScissorArrayv = _glewLazy_glScissorArrayv;
+PFNGLSCISSORINDEXEDPROC __glewScissorIndexed = _glewLazy_glScissorIndexed;
+PFNGLSCISSORINDEXEDVPROC __glewScissorIndexedv = _glewLazy_glScissorIndexedv;
+PFNGLVIEWPORTARRAYVPROC __glewViewportArrayv = _glewLazy_glViewportArrayv;
+PFNGLVIEWPORTINDEXEDFPROC __glewViewportIndexedf = _glewLazy_glViewportIndexedf;
+PFNGLVIEWPORTINDEXEDFVPROC __glewViewportIndexedfv = _glewLazy_glViewportIndexedfv;
+
+PFNGLWINDOWPOS2DARBPROC __glewWindowPos2dARB = _glewLazy_glWindowPos2dARB;
+PFNGLWINDOWPOS2DVARBPROC __glewWindowPos2dvARB = _glewLazy_glWindowPos2dvARB;
+PFNGLWINDOWPOS2FARBPROC __glewWindowPos2fARB = _glewLazy_glWindowPos2fARB;
+PFNGLWINDOWPOS2FVARBPROC __glewWindowPos2fvARB = _glewLazy_glWindowPos2fvARB;
+PFNGLWINDOWPOS2IARBPROC __glewWindowPos2iARB = _glewLazy_glWindowPos2iARB;
+PFNGLWINDOWPOS2IVARBPROC __glewWindowPos2ivARB = _glewLazy_glWindowPos2ivARB;
+PFNGLWINDOWPOS2SARBPROC __glewWindowPos2sARB = _glewLazy_glWindowPos2sARB;
+PFNGLWINDOWPOS2SVARBPROC __glewWindowPos2svARB = _glewLazy_glWindowPos2svARB;
+PFNGLWINDOWPOS3DARBPROC __glewWindowPos3dARB = _glewLazy_glWindowPos3dARB;
+PFNGLWINDOWPOS3DVARBPROC __glewWindowPos3dvARB = _glewLazy_glWindowPos3dvARB;
+PFNGLWINDOWPOS3FARBPROC __glewWindowPos3fARB = _glewLazy_glWindowPos3fARB;
+PFNGLWINDOWPOS3FVARBPROC __glewWindowPos3fvARB = _glewLazy_glWindowPos3fvARB;
+PFNGLWINDOWPOS3IARBPROC __glewWindowPos3iARB = _glewLazy_glWindowPos3iARB;
+PFNGLWINDOWPOS3IVARBPROC __glewWindowPos3ivARB = _glewLazy_glWindowPos3ivARB;
+PFNGLWINDOWPOS3SARBPROC __glewWindowPos3sARB = _glewLazy_glWindowPos3sARB;
+PFNGLWINDOWPOS3SVARBPROC __glewWindowPos3svARB = _glewLazy_glWindowPos3svARB;
+
+PFNGLDRAWBUFFERSATIPROC __glewDrawBuffersATI = _glewLazy_glDrawBuffersATI;
+
+PFNGLDRAWELEMENTARRAYATIPROC __glewDrawElementArrayATI = _glewLazy_glDrawElementArrayATI;
+PFNGLDRAWRANGEELEMENTARRAYATIPROC __glewDrawRangeElementArrayATI = _glewLazy_glDrawRangeElementArrayATI;
+PFNGLELEMENTPOINTERATIPROC __glewElementPointerATI = _glewLazy_glElementPointerATI;
+
+PFNGLGETTEXBUMPPARAMETERFVATIPROC __glewGetTexBumpParameterfvATI = _glewLazy_glGetTexBumpParameterfvATI;
+PFNGLGETTEXBUMPPARAMETERIVATIPROC __glewGetTexBumpParameterivATI = _glewLazy_glGetTexBumpParameterivATI;
+PFNGLTEXBUMPPARAMETERFVATIPROC __glewTexBumpParameterfvATI = _glewLazy_glTexBumpParameterfvATI;
+PFNGLTEXBUMPPARAMETERIVATIPROC __glewTexBumpParameterivATI = _glewLazy_glTexBumpParameterivATI;
+
+PFNGLALPHAFRAGMENTOP1ATIPROC __glewAlphaFragmentOp1ATI = _glewLazy_glAlphaFragmentOp1ATI;
+PFNGLALPHAFRAGMENTOP2ATIPROC __glewAlphaFragmentOp2ATI = _glewLazy_glAlphaFragmentOp2ATI;
+PFNGLALPHAFRAGMENTOP3ATIPROC __glewAlphaFragmentOp3ATI = _glewLazy_glAlphaFragmentOp3ATI;
+PFNGLBEGINFRAGMENTSHADERATIPROC __glewBeginFragmentShaderATI = _glewLazy_glBeginFragmentShaderATI;
+PFNGLBINDFRAGMENTSHADERATIPROC __glewBindFragmentShaderATI = _glewLazy_glBindFragmentShaderATI;
+PFNGLCOLORFRAGMENTOP1ATIPROC __glewColorFragmentOp1ATI = _glewLazy_glColorFragmentOp1ATI;
+PFNGLCOLORFRAGMENTOP2ATIPROC __glewColorFragmentOp2ATI = _glewLazy_glColorFragmentOp2ATI;
+PFNGLCOLORFRAGMENTOP3ATIPROC __glewColorFragmentOp3ATI = _glewLazy_glColorFragmentOp3ATI;
+PFNGLDELETEFRAGMENTSHADERATIPROC __glewDeleteFragmentShaderATI = _glewLazy_glDeleteFragmentShaderATI;
+PFNGLENDFRAGMENTSHADERATIPROC __glewEndFragmentShaderATI = _glewLazy_glEndFragmentShaderATI;
+PFNGLGENFRAGMENTSHADERSATIPROC __glewGenFragmentShadersATI = _glewLazy_glGenFragmentShadersATI;
+PFNGLPASSTEXCOORDATIPROC __glewPassTexCoordATI = _glewLazy_glPassTexCoordATI;
+PFNGLSAMPLEMAPATIPROC __glewSampleMapATI = _glewLazy_glSampleMapATI;
+PFNGLSETFRAGMENTSHADERCONSTANTATIPROC __glewSetFragmentShaderConstantATI = _glewLazy_glSetFragmentShaderConstantATI;
+
+PFNGLMAPOBJECTBUFFERATIPROC __glewMapObjectBufferATI = _glewLazy_glMapObjectBufferATI;
+PFNGLUNMAPOBJECTBUFFERATIPROC __glewUnmapObjectBufferATI = _glewLazy_glUnmapObjectBufferATI;
+
+PFNGLPNTRIANGLESFATIPROC __glewPNTrianglesfATI = _glewLazy_glPNTrianglesfATI;
+PFNGLPNTRIANGLESIATIPROC __glewPNTrianglesiATI = _glewLazy_glPNTrianglesiATI;
+
+PFNGLSTENCILFUNCSEPARATEATIPROC __glewStencilFuncSeparateATI = _glewLazy_glStencilFuncSeparateATI;
+PFNGLSTENCILOPSEPARATEATIPROC __glewStencilOpSeparateATI = _glewLazy_glStencilOpSeparateATI;
+
+PFNGLARRAYOBJECTATIPROC __glewArrayObjectATI = _glewLazy_glArrayObjectATI;
+PFNGLFREEOBJECTBUFFERATIPROC __glewFreeObjectBufferATI = _glewLazy_glFreeObjectBufferATI;
+PFNGLGETARRAYOBJECTFVATIPROC __glewGetArrayObjectfvATI = _glewLazy_glGetArrayObjectfvATI;
+PFNGLGETARRAYOBJECTIVATIPROC __glewGetArrayObjectivATI = _glewLazy_glGetArrayObjectivATI;
+PFNGLGETOBJECTBUFFERFVATIPROC __glewGetObjectBufferfvATI = _glewLazy_glGetObjectBufferfvATI;
+PFNGLGETOBJECTBUFFERIVATIPROC __glewGetObjectBufferivATI = _glewLazy_glGetObjectBufferivATI;
+PFNGLGETVARIANTARRAYOBJECTFVATIPROC __glewGetVariantArrayObjectfvATI = _glewLazy_glGetVariantArrayObjectfvATI;
+PFNGLGETVARIANTARRAYOBJECTIVATIPROC __glewGetVariantArrayObjectivATI = _glewLazy_glGetVariantArrayObjectivATI;
+PFNGLISOBJECTBUFFERATIPROC __glewIsObjectBufferATI = _glewLazy_glIsObjectBufferATI;
+PFNGLNEWOBJECTBUFFERATIPROC __glewNewObjectBufferATI = _glewLazy_glNewObjectBufferATI;
+PFNGLUPDATEOBJECTBUFFERATIPROC __glewUpdateObjectBufferATI = _glewLazy_glUpdateObjectBufferATI;
+PFNGLVARIANTARRAYOBJECTATIPROC __glewVariantArrayObjectATI = _glewLazy_glVariantArrayObjectATI;
+
+PFNGLGETVERTEXATTRIBARRAYOBJECTFVATIPROC __glewGetVertexAttribArrayObjectfvATI = _glewLazy_glGetVertexAttribArrayObjectfvATI;
+PFNGLGETVERTEXATTRIBARRAYOBJECTIVATIPROC __glewGetVertexAttribArrayObjectivATI = _glewLazy_glGetVertexAttribArrayObjectivATI;
+PFNGLVERTEXATTRIBARRAYOBJECTATIPROC __glewVertexAttribArrayObjectATI = _glewLazy_glVertexAttribArrayObjectATI;
+
+PFNGLCLIENTACTIVEVERTEXSTREAMATIPROC __glewClientActiveVertexStreamATI = _glewLazy_glClientActiveVertexStreamATI;
+PFNGLNORMALSTREAM3BATIPROC __glewNormalStream3bATI = _glewLazy_glNormalStream3bATI;
+PFNGLNORMALSTREAM3BVATIPROC __glewNormalStream3bvATI = _glewLazy_glNormalStream3bvATI;
+PFNGLNORMALSTREAM3DATIPROC __glewNormalStream3dATI = _glewLazy_glNormalStream3dATI;
+PFNGLNORMALSTREAM3DVATIPROC __glewNormalStream3dvATI = _glewLazy_glNormalStream3dvATI;
+PFNGLNORMALSTREAM3FATIPROC __glewNormalStream3fATI = _glewLazy_glNormalStream3fATI;
+PFNGLNORMALSTREAM3FVATIPROC __glewNormalStream3fvATI = _glewLazy_glNormalStream3fvATI;
+PFNGLNORMALSTREAM3IATIPROC __glewNormalStream3iATI = _glewLazy_glNormalStream3iATI;
+PFNGLNORMALSTREAM3IVATIPROC __glewNormalStream3ivATI = _glewLazy_glNormalStream3ivATI;
+PFNGLNORMALSTREAM3SATIPROC __glewNormalStream3sATI = _glewLazy_glNormalStream3sATI;
+PFNGLNORMALSTREAM3SVATIPROC __glewNormalStream3svATI = _glewLazy_glNormalStream3svATI;
+PFNGLVERTEXBLENDENVFATIPROC __glewVertexBlendEnvfATI = _glewLazy_glVertexBlendEnvfATI;
+PFNGLVERTEXBLENDENVIATIPROC __glewVertexBlendEnviATI = _glewLazy_glVertexBlendEnviATI;
+PFNGLVERTEXSTREAM1DATIPROC __glewVertexStream1dATI = _glewLazy_glVertexStream1dATI;
+PFNGLVERTEXSTREAM1DVATIPROC __glewVertexStream1dvATI = _glewLazy_glVertexStream1dvATI;
+PFNGLVERTEXSTREAM1FATIPROC __glewVertexStream1fATI = _glewLazy_glVertexStream1fATI;
+PFNGLVERTEXSTREAM1FVATIPROC __glewVertexStream1fvATI = _glewLazy_glVertexStream1fvATI;
+PFNGLVERTEXSTREAM1IATIPROC __glewVertexStream1iATI = _glewLazy_glVertexStream1iATI;
+PFNGLVERTEXSTREAM1IVATIPROC __glewVertexStream1ivATI = _glewLazy_glVertexStream1ivATI;
+PFNGLVERTEXSTREAM1SATIPROC __glewVertexStream1sATI = _glewLazy_glVertexStream1sATI;
+PFNGLVERTEXSTREAM1SVATIPROC __glewVertexStream1svATI = _glewLazy_glVertexStream1svATI;
+PFNGLVERTEXSTREAM2DATIPROC __glewVertexStream2dATI = _glewLazy_glVertexStream2dATI;
+PFNGLVERTEXSTREAM2DVATIPROC __glewVertexStream2dvATI = _glewLazy_glVertexStream2dvATI;
+PFNGLVERTEXSTREAM2FATIPROC __glewVertexStream2fATI = _glewLazy_glVertexStream2fATI;
+PFNGLVERTEXSTREAM2FVATIPROC __glewVertexStream2fvATI = _glewLazy_glVertexStream2fvATI;
+PFNGLVERTEXSTREAM2IATIPROC __glewVertexStream2iATI = _glewLazy_glVertexStream2iATI;
+PFNGLVERTEXSTREAM2IVATIPROC __glewVertexStream2ivATI = _glewLazy_glVertexStream2ivATI;
+PFNGLVERTEXSTREAM2SATIPROC __glewVertexStream2sATI = _glewLazy_glVertexStream2sATI;
+PFNGLVERTEXSTREAM2SVATIPROC __glewVertexStream2svATI = _glewLazy_glVertexStream2svATI;
+PFNGLVERTEXSTREAM3DATIPROC __glewVertexStream3dATI = _glewLazy_glVertexStream3dATI;
+PFNGLVERTEXSTREAM3DVATIPROC __glewVertexStream3dvATI = _glewLazy_glVertexStream3dvATI;
+PFNGLVERTEXSTREAM3FATIPROC __glewVertexStream3fATI = _glewLazy_glVertexStream3fATI;
+PFNGLVERTEXSTREAM3FVATIPROC __glewVertexStream3fvATI = _glewLazy_glVertexStream3fvATI;
+PFNGLVERTEXSTREAM3IATIPROC __glewVertexStream3iATI = _glewLazy_glVertexStream3iATI;
+PFNGLVERTEXSTREAM3IVATIPROC __glewVertexStream3ivATI = _glewLazy_glVertexStream3ivATI;
+PFNGLVERTEXSTREAM3SATIPROC __glewVertexStream3sATI = _glewLazy_glVertexStream3sATI;
+PFNGLVERTEXSTREAM3SVATIPROC __glewVertexStream3svATI = _glewLazy_glVertexStream3svATI;
+PFNGLVERTEXSTREAM4DATIPROC __glewVertexStream4dATI = _glewLazy_glVertexStream4dATI;
+PFNGLVERTEXSTREAM4DVATIPROC __glewVertexStream4dvATI = _glewLazy_glVertexStream4dvATI;
+PFNGLVERTEXSTREAM4FATIPROC __glewVertexStream4fATI = _glewLazy_glVertexStream4fATI;
+PFNGLVERTEXSTREAM4FVATIPROC __glewVertexStream4fvATI = _glewLazy_glVertexStream4fvATI;
+PFNGLVERTEXSTREAM4IATIPROC __glewVertexStream4iATI = _glewLazy_glVertexStream4iATI;
+PFNGLVERTEXSTREAM4IVATIPROC __glewVertexStream4ivATI = _glewLazy_glVertexStream4ivATI;
+PFNGLVERTEXSTREAM4SATIPROC __glewVertexStream4sATI = _glewLazy_glVertexStream4sATI;
+PFNGLVERTEXSTREAM4SVATIPROC __glewVertexStream4svATI = _glewLazy_glVertexStream4svATI;
+
+PFNGLGETUNIFORMBUFFERSIZEEXTPROC __glewGetUniformBufferSizeEXT = _glewLazy_glGetUniformBufferSizeEXT;
+PFNGLGETUNIFORMOFFSETEXTPROC __glewGetUniformOffsetEXT = _glewLazy_glGetUniformOffsetEXT;
+PFNGLUNIFORMBUFFEREXTPROC __glewUniformBufferEXT = _glewLazy_glUniformBufferEXT;
+
+PFNGLBLENDCOLOREXTPROC __glewBlendColorEXT = _glewLazy_glBlendColorEXT;
+
+PFNGLBLENDEQUATIONSEPARATEEXTPROC __glewBlendEquationSeparateEXT = _glewLazy_glBlendEquationSeparateEXT;
+
+PFNGLBLENDFUNCSEPARATEEXTPROC __glewBlendFuncSeparateEXT = _glewLazy_glBlendFuncSeparateEXT;
+
+PFNGLBLENDEQUATIONEXTPROC __glewBlendEquationEXT = _glewLazy_glBlendEquationEXT;
+
+PFNGLCOLORSUBTABLEEXTPROC __glewColorSubTableEXT = _glewLazy_glColorSubTableEXT;
+PFNGLCOPYCOLORSUBTABLEEXTPROC __glewCopyColorSubTableEXT = _glewLazy_glCopyColorSubTableEXT;
+
+PFNGLLOCKARRAYSEXTPROC __glewLockArraysEXT = _glewLazy_glLockArraysEXT;
+PFNGLUNLOCKARRAYSEXTPROC __glewUnlockArraysEXT = _glewLazy_glUnlockArraysEXT;
+
+PFNGLCONVOLUTIONFILTER1DEXTPROC __glewConvolutionFilter1DEXT = _glewLazy_glConvolutionFilter1DEXT;
+PFNGLCONVOLUTIONFILTER2DEXTPROC __glewConvolutionFilter2DEXT = _glewLazy_glConvolutionFilter2DEXT;
+PFNGLCONVOLUTIONPARAMETERFEXTPROC __glewConvolutionParameterfEXT = _glewLazy_glConvolutionParameterfEXT;
+PFNGLCONVOLUTIONPARAMETERFVEXTPROC __glewConvolutionParameterfvEXT = _glewLazy_glConvolutionParameterfvEXT;
+PFNGLCONVOLUTIONPARAMETERIEXTPROC __glewConvolutionParameteriEXT = _glewLazy_glConvolutionParameteriEXT;
+PFNGLCONVOLUTIONPARAMETERIVEXTPROC __glewConvolutionParameterivEXT = _glewLazy_glConvolutionParameterivEXT;
+PFNGLCOPYCONVOLUTIONFILTER1DEXTPROC __glewCopyConvolutionFilter1DEXT = _glewLazy_glCopyConvolutionFilter1DEXT;
+PFNGLCOPYCONVOLUTIONFILTER2DEXTPROC __glewCopyConvolutionFilter2DEXT = _glewLazy_glCopyConvolutionFilter2DEXT;
+PFNGLGETCONVOLUTIONFILTEREXTPROC __glewGetConvolutionFilterEXT = _glewLazy_glGetConvolutionFilterEXT;
+PFNGLGETCONVOLUTIONPARAMETERFVEXTPROC __glewGetConvolutionParameterfvEXT = _glewLazy_glGetConvolutionParameterfvEXT;
+PFNGLGETCONVOLUTIONPARAMETERIVEXTPROC __glewGetConvolutionParameterivEXT = _glewLazy_glGetConvolutionParameterivEXT;
+PFNGLGETSEPARABLEFILTEREXTPROC __glewGetSeparableFilterEXT = _glewLazy_glGetSeparableFilterEXT;
+PFNGLSEPARABLEFILTER2DEXTPROC __glewSeparableFilter2DEXT = _glewLazy_glSeparableFilter2DEXT;
+
+PFNGLBINORMALPOINTEREXTPROC __glewBinormalPointerEXT = _glewLazy_glBinormalPointerEXT;
+PFNGLTANGENTPOINTEREXTPROC __glewTangentPointerEXT = _glewLazy_glTangentPointerEXT;
+
+PFNGLCOPYTEXIMAGE1DEXTPROC __glewCopyTexImage1DEXT = _glewLazy_glCopyTexImage1DEXT;
+PFNGLCOPYTEXIMAGE2DEXTPROC __glewCopyTexImage2DEXT = _glewLazy_glCopyTexImage2DEXT;
+PFNGLCOPYTEXSUBIMAGE1DEXTPROC __glewCopyTexSubImage1DEXT = _glewLazy_glCopyTexSubImage1DEXT;
+PFNGLCOPYTEXSUBIMAGE2DEXTPROC __glewCopyTexSubImage2DEXT = _glewLazy_glCopyTexSubImage2DEXT;
+PFNGLCOPYTEXSUBIMAGE3DEXTPROC __glewCopyTexSubImage3DEXT = _glewLazy_glCopyTexSubImage3DEXT;
+
+PFNGLCULLPARAMETERDVEXTPROC __glewCullParameterdvEXT = _glewLazy_glCullParameterdvEXT;
+PFNGLCULLPARAMETERFVEXTPROC __glewCullParameterfvEXT = _glewLazy_glCullParameterfvEXT;
+
+PFNGLGETOBJECTLABELEXTPROC __glewGetObjectLabelEXT = _glewLazy_glGetObjectLabelEXT;
+PFNGLLABELOBJECTEXTPROC __glewLabelObjectEXT = _glewLazy_glLabelObjectEXT;
+
+PFNGLINSERTEVENTMARKEREXTPROC __glewInsertEventMarkerEXT = _glewLazy_glInsertEventMarkerEXT;
+PFNGLPOPGROUPMARKEREXTPROC __glewPopGroupMarkerEXT = _glewLazy_glPopGroupMarkerEXT;
+PFNGLPUSHGROUPMARKEREXTPROC __glewPushGroupMarkerEXT = _glewLazy_glPushGroupMarkerEXT;
+
+PFNGLDEPTHBOUNDSEXTPROC __glewDepthBoundsEXT = _glewLazy_glDepthBoundsEXT;
+
+PFNGLBINDMULTITEXTUREEXTPROC __glewBindMultiTextureEXT = _glewLazy_glBindMultiTextureEXT;
+PFNGLCHECKNAMEDFRAMEBUFFERSTATUSEXTPROC __glewCheckNamedFramebufferStatusEXT = _glewLazy_glCheckNamedFramebufferStatusEXT;
+PFNGLCLIENTATTRIBDEFAULTEXTPROC __glewClientAttribDefaultEXT = _glewLazy_glClientAttribDefaultEXT;
+PFNGLCOMPRESSEDMULTITEXIMAGE1DEXTPROC __glewCompressedMultiTexImage1DEXT = _glewLazy_glCompressedMultiTexImage1DEXT;
+PFNGLCOMPRESSEDMULTITEXIMAGE2DEXTPROC __glewCompressedMultiTexImage2DEXT = _glewLazy_glCompressedMultiTexImage2DEXT;
+PFNGLCOMPRESSEDMULTITEXIMAGE3DEXTPROC __glewCompressedMultiTexImage3DEXT = _glewLazy_glCompressedMultiTexImage3DEXT;
+PFNGLCOMPRESSEDMULTITEXSUBIMAGE1DEXTPROC __glewCompressedMultiTexSubImage1DEXT = _glewLazy_glCompressedMultiTexSubImage1DEXT;
+PFNGLCOMPRESSEDMULTITEXSUBIMAGE2DEXTPROC __glewCompressedMultiTexSubImage2DEXT = _glewLazy_glCompressedMultiTexSubImage2DEXT;
+PFNGLCOMPRESSEDMULTITEXSUBIMAGE3DEXTPROC __glewCompressedMultiTexSubImage3DEXT = _glewLazy_glCompressedMultiTexSubImage3DEXT;
+PFNGLCOMPRESSEDTEXTUREIMAGE1DEXTPROC __glewCompressedTextureImage1DEXT = _glewLazy_glCompressedTextureImage1DEXT;
+PFNGLCOMPRESSEDTEXTUREIMAGE2DEXTPROC __glewCompressedTextureImage2DEXT = _glewLazy_glCompressedTextureImage2DEXT;
+PFNGLCOMPRESSEDTEXTUREIMAGE3DEXTPROC __glewCompressedTextureImage3DEXT = _glewLazy_glCompressedTextureImage3DEXT;
+PFNGLCOMPRESSEDTEXTURESUBIMAGE1DEXTPROC __glewCompressedTextureSubImage1DEXT = _glewLazy_glCompressedTextureSubImage1DEXT;
+PFNGLCOMPRESSEDTEXTURESUBIMAGE2DEXTPROC __glewCompressedTextureSubImage2DEXT = _glewLazy_glCompressedTextureSubImage2DEXT;
+PFNGLCOMPRESSEDTEXTURESUBIMAGE3DEXTPROC __glewCompressedTextureSubImage3DEXT = _glewLazy_glCompressedTextureSubImage3DEXT;
+PFNGLCOPYMULTITEXIMAGE1DEXTPROC __glewCopyMultiTexImage1DEXT = _glewLazy_glCopyMultiTexImage1DEXT;
+PFNGLCOPYMULTITEXIMAGE2DEXTPROC __glewCopyMultiTexImage2DEXT = _glewLazy_glCopyMultiTexImage2DEXT;
+PFNGLCOPYMULTITEXSUBIMAGE1DEXTPROC __glewCopyMultiTexSubImage1DEXT = _glewLazy_glCopyMultiTexSubImage1DEXT;
+PFNGLCOPYMULTITEXSUBIMAGE2DEXTPROC __glewCopyMultiTexSubImage2DEXT = _glewLazy_glCopyMultiTexSubImage2DEXT;
+PFNGLCOPYMULTITEXSUBIMAGE3DEXTPROC __glewCopyMultiTexSubImage3DEXT = _glewLazy_glCopyMultiTexSubImage3DEXT;
+PFNGLCOPYTEXTUREIMAGE1DEXTPROC __glewCopyTextureImage1DEXT = _glewLazy_glCopyTextureImage1DEXT;
+PFNGLCOPYTEXTUREIMAGE2DEXTPROC __glewCopyTextureImage2DEXT = _glewLazy_glCopyTextureImage2DEXT;
+PFNGLCOPYTEXTURESUBIMAGE1DEXTPROC __glewCopyTextureSubImage1DEXT = _glewLazy_glCopyTextureSubImage1DEXT;
+PFNGLCOPYTEXTURESUBIMAGE2DEXTPROC __glewCopyTextureSubImage2DEXT = _glewLazy_glCopyTextureSubImage2DEXT;
+PFNGLCOPYTEXTURESUBIMAGE3DEXTPROC __glewCopyTextureSubImage3DEXT = _glewLazy_glCopyTextureSubImage3DEXT;
+PFNGLDISABLECLIENTSTATEINDEXEDEXTPROC __glewDisableClientStateIndexedEXT = _glewLazy_glDisableClientStateIndexedEXT;
+PFNGLDISABLECLIENTSTATEIEXTPROC __glewDisableClientStateiEXT = _glewLazy_glDisableClientStateiEXT;
+PFNGLDISABLEVERTEXARRAYATTRIBEXTPROC __glewDisableVertexArrayAttribEXT = _glewLazy_glDisableVertexArrayAttribEXT;
+PFNGLDISABLEVERTEXARRAYEXTPROC __glewDisableVertexArrayEXT = _glewLazy_glDisableVertexArrayEXT;
+PFNGLENABLECLIENTSTATEINDEXEDEXTPROC __glewEnableClientStateIndexedEXT = _glewLazy_glEnableClientStateIndexedEXT;
+PFNGLENABLECLIENTSTATEIEXTPROC __glewEnableClientStateiEXT = _glewLazy_glEnableClientStateiEXT;
+PFNGLENABLEVERTEXARRAYATTRIBEXTPROC __glewEnableVertexArrayAttribEXT = _glewLazy_glEnableVertexArrayAttribEXT;
+PFNGLENABLEVERTEXARRAYEXTPROC __glewEnableVertexArrayEXT = _glewLazy_glEnableVertexArrayEXT;
+PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEEXTPROC __glewFlushMappedNamedBufferRangeEXT = _glewLazy_glFlushMappedNamedBufferRangeEXT;
+PFNGLFRAMEBUFFERDRAWBUFFEREXTPROC __glewFramebufferDrawBufferEXT = _glewLazy_glFramebufferDrawBufferEXT;
+PFNGLFRAMEBUFFERDRAWBUFFERSEXTPROC __glewFramebufferDrawBuffersEXT = _glewLazy_glFramebufferDrawBuffersEXT;
+PFNGLFRAMEBUFFERREADBUFFEREXTPROC __glewFramebufferReadBufferEXT = _glewLazy_glFramebufferReadBufferEXT;
+PFNGLGENERATEMULTITEXMIPMAPEXTPROC __glewGenerateMultiTexMipmapEXT = _glewLazy_glGenerateMultiTexMipmapEXT;
+PFNGLGENERATETEXTUREMIPMAPEXTPROC __glewGenerateTextureMipmapEXT = _glewLazy_glGenerateTextureMipmapEXT;
+PFNGLGETCOMPRESSEDMULTITEXIMAGEEXTPROC __glewGetCompressedMultiTexImageEXT = _glewLazy_glGetCompressedMultiTexImageEXT;
+PFNGLGETCOMPRESSEDTEXTUREIMAGEEXTPROC __glewGetCompressedTextureImageEXT = _glewLazy_glGetCompressedTextureImageEXT;
+PFNGLGETDOUBLEINDEXEDVEXTPROC __glewGetDoubleIndexedvEXT = _glewLazy_glGetDoubleIndexedvEXT;
+PFNGLGETDOUBLEI_VEXTPROC __glewGetDoublei_vEXT = _glewLazy_glGetDoublei_vEXT;
+PFNGLGETFLOATINDEXEDVEXTPROC __glewGetFloatIndexedvEXT = _glewLazy_glGetFloatIndexedvEXT;
+PFNGLGETFLOATI_VEXTPROC __glewGetFloati_vEXT = _glewLazy_glGetFloati_vEXT;
+PFNGLGETFRAMEBUFFERPARAMETERIVEXTPROC __glewGetFramebufferParameterivEXT = _glewLazy_glGetFramebufferParameterivEXT;
+PFNGLGETMULTITEXENVFVEXTPROC __glewGetMultiTexEnvfvEXT = _glewLazy_glGetMultiTexEnvfvEXT;
+PFNGLGETMULTITEXENVIVEXTPROC __glewGetMultiTexEnvivEXT = _glewLazy_glGetMultiTexEnvivEXT;
+PFNGLGETMULTITEXGENDVEXTPROC __glewGetMultiTexGendvEXT = _glewLazy_glGetMultiTexGendvEXT;
+PFNGLGETMULTITEXGENFVEXTPROC __glewGetMultiTexGenfvEXT = _glewLazy_glGetMultiTexGenfvEXT;
+PFNGLGETMULTITEXGENIVEXTPROC __glewGetMultiTexGenivEXT = _glewLazy_glGetMultiTexGenivEXT;
+PFNGLGETMULTITEXIMAGEEXTPROC __glewGetMultiTexImageEXT = _glewLazy_glGetMultiTexImageEXT;
+PFNGLGETMULTITEXLEVELPARAMETERFVEXTPROC __glewGetMultiTexLevelParameterfvEXT = _glewLazy_glGetMultiTexLevelParameterfvEXT;
+PFNGLGETMULTITEXLEVELPARAMETERIVEXTPROC __glewGetMultiTexLevelParameterivEXT = _glewLazy_glGetMultiTexLevelParameterivEXT;
+PFNGLGETMULTITEXPARAMETERIIVEXTPROC __glewGetMultiTexParameterIivEXT = _glewLazy_glGetMultiTexParameterIivEXT;
+PFNGLGETMULTITEXPARAMETERIUIVEXTPROC __glewGetMultiTexParameterIuivEXT = _glewLazy_glGetMultiTexParameterIuivEXT;
+PFNGLGETMULTITEXPARAMETERFVEXTPROC __glewGetMultiTexParameterfvEXT = _glewLazy_glGetMultiTexParameterfvEXT;
+PFNGLGETMULTITEXPARAMETERIVEXTPROC __glewGetMultiTexParameterivEXT = _glewLazy_glGetMultiTexParameterivEXT;
+PFNGLGETNAMEDBUFFERPARAMETERIVEXTPROC __glewGetNamedBufferParameterivEXT = _glewLazy_glGetNamedBufferParameterivEXT;
+PFNGLGETNAMEDBUFFERPOINTERVEXTPROC __glewGetNamedBufferPointervEXT = _glewLazy_glGetNamedBufferPointervEXT;
+PFNGLGETNAMEDBUFFERSUBDATAEXTPROC __glewGetNamedBufferSubDataEXT = _glewLazy_glGetNamedBufferSubDataEXT;
+PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC __glewGetNamedFramebufferAttachmentParameterivEXT = _glewLazy_glGetNamedFramebufferAttachmentParameterivEXT;
+PFNGLGETNAMEDPROGRAMLOCALPARAMETERIIVEXTPROC __glewGetNamedProgramLocalParameterIivEXT = _glewLazy_glGetNamedProgramLocalParameterIivEXT;
+PFNGLGETNAMEDPROGRAMLOCALPARAMETERIUIVEXTPROC __glewGetNamedProgramLocalParameterIuivEXT = _glewLazy_glGetNamedProgramLocalParameterIuivEXT;
+PFNGLGETNAMEDPROGRAMLOCALPARAMETERDVEXTPROC __glewGetNamedProgramLocalParameterdvEXT = _glewLazy_glGetNamedProgramLocalParameterdvEXT;
+PFNGLGETNAMEDPROGRAMLOCALPARAMETERFVEXTPROC __glewGetNamedProgramLocalParameterfvEXT = _glewLazy_glGetNamedProgramLocalParameterfvEXT;
+PFNGLGETNAMEDPROGRAMSTRINGEXTPROC __glewGetNamedProgramStringEXT = _glewLazy_glGetNamedProgramStringEXT;
+PFNGLGETNAMEDPROGRAMIVEXTPROC __glewGetNamedProgramivEXT = _glewLazy_glGetNamedProgramivEXT;
+PFNGLGETNAMEDRENDERBUFFERPARAMETERIVEXTPROC __glewGetNamedRenderbufferParameterivEXT = _glewLazy_glGetNamedRenderbufferParameterivEXT;
+PFNGLGETPOINTERINDEXEDVEXTPROC __glewGetPointerIndexedvEXT = _glewLazy_glGetPointerIndexedvEXT;
+PFNGLGETPOINTERI_VEXTPROC __glewGetPointeri_vEXT = _glewLazy_glGetPointeri_vEXT;
+PFNGLGETTEXTUREIMAGEEXTPROC __glewGetTextureImageEXT = _glewLazy_glGetTextureImageEXT;
+PFNGLGETTEXTURELEVELPARAMETERFVEXTPROC __glewGetTextureLevelParameterfvEXT = _glewLazy_glGetTextureLevelParameterfvEXT;
+PFNGLGETTEXTURELEVELPARAMETERIVEXTPROC __glewGetTextureLevelParameterivEXT = _glewLazy_glGetTextureLevelParameterivEXT;
+PFNGLGETTEXTUREPARAMETERIIVEXTPROC __glewGetTextureParameterIivEXT = _glewLazy_glGetTextureParameterIivEXT;
+PFNGLGETTEXTUREPARAMETERIUIVEXTPROC __glewGetTextureParameterIuivEXT = _glewLazy_glGetTextureParameterIuivEXT;
+PFNGLGETTEXTUREPARAMETERFVEXTPROC __glewGetTextureParameterfvEXT = _glewLazy_glGetTextureParameterfvEXT;
+PFNGLGETTEXTUREPARAMETERIVEXTPROC __glewGetTextureParameterivEXT = _glewLazy_glGetTextureParameterivEXT;
+PFNGLGETVERTEXARRAYINTEGERI_VEXTPROC __glewGetVertexArrayIntegeri_vEXT = _glewLazy_glGetVertexArrayIntegeri_vEXT;
+PFNGLGETVERTEXARRAYINTEGERVEXTPROC __glewGetVertexArrayIntegervEXT = _glewLazy_glGetVertexArrayIntegervEXT;
+PFNGLGETVERTEXARRAYPOINTERI_VEXTPROC __glewGetVertexArrayPointeri_vEXT = _glewLazy_glGetVertexArrayPointeri_vEXT;
+PFNGLGETVERTEXARRAYPOINTERVEXTPROC __glewGetVertexArrayPointervEXT = _glewLazy_glGetVertexArrayPointervEXT;
+PFNGLMAPNAMEDBUFFEREXTPROC __glewMapNamedBufferEXT = _glewLazy_glMapNamedBufferEXT;
+PFNGLMAPNAMEDBUFFERRANGEEXTPROC __glewMapNamedBufferRangeEXT = _glewLazy_glMapNamedBufferRangeEXT;
+PFNGLMATRIXFRUSTUMEXTPROC __glewMatrixFrustumEXT = _glewLazy_glMatrixFrustumEXT;
+PFNGLMATRIXLOADIDENTITYEXTPROC __glewMatrixLoadIdentityEXT = _glewLazy_glMatrixLoadIdentityEXT;
+PFNGLMATRIXLOADTRANSPOSEDEXTPROC __glewMatrixLoadTransposedEXT = _glewLazy_glMatrixLoadTransposedEXT;
+PFNGLMATRIXLOADTRANSPOSEFEXTPROC __glewMatrixLoadTransposefEXT = _glewLazy_glMatrixLoadTransposefEXT;
+PFNGLMATRIXLOADDEXTPROC __glewMatrixLoaddEXT = _glewLazy_glMatrixLoaddEXT;
+PFNGLMATRIXLOADFEXTPROC __glewMatrixLoadfEXT = _glewLazy_glMatrixLoadfEXT;
+PFNGLMATRIXMULTTRANSPOSEDEXTPROC __glewMatrixMultTransposedEXT = _glewLazy_glMatrixMultTransposedEXT;
+PFNGLMATRIXMULTTRANSPOSEFEXTPROC __glewMatrixMultTransposefEXT = _glewLazy_glMatrixMultTransposefEXT;
+PFNGLMATRIXMULTDEXTPROC __glewMatrixMultdEXT = _glewLazy_glMatrixMultdEXT;
+PFNGLMATRIXMULTFEXTPROC __glewMatrixMultfEXT = _glewLazy_glMatrixMultfEXT;
+PFNGLMATRIXORTHOEXTPROC __glewMatrixOrthoEXT = _glewLazy_glMatrixOrthoEXT;
+PFNGLMATRIXPOPEXTPROC __glewMatrixPopEXT = _glewLazy_glMatrixPopEXT;
+PFNGLMATRIXPUSHEXTPROC __glewMatrixPushEXT = _glewLazy_glMatrixPushEXT;
+PFNGLMATRIXROTATEDEXTPROC __glewMatrixRotatedEXT = _glewLazy_glMatrixRotatedEXT;
+PFNGLMATRIXROTATEFEXTPROC __glewMatrixRotatefEXT = _glewLazy_glMatrixRotatefEXT;
+PFNGLMATRIXSCALEDEXTPROC __glewMatrixScaledEXT = _glewLazy_glMatrixScaledEXT;
+PFNGLMATRIXSCALEFEXTPROC __glewMatrixScalefEXT = _glewLazy_glMatrixScalefEXT;
+PFNGLMATRIXTRANSLATEDEXTPROC __glewMatrixTranslatedEXT = _glewLazy_glMatrixTranslatedEXT;
+PFNGLMATRIXTRANSLATEFEXTPROC __glewMatrixTranslatefEXT = _glewLazy_glMatrixTranslatefEXT;
+PFNGLMULTITEXBUFFEREXTPROC __glewMultiTexBufferEXT = _glewLazy_glMultiTexBufferEXT;
+PFNGLMULTITEXCOORDPOINTEREXTPROC __glewMultiTexCoordPointerEXT = _glewLazy_glMultiTexCoordPointerEXT;
+PFNGLMULTITEXENVFEXTPROC __glewMultiTexEnvfEXT = _glewLazy_glMultiTexEnvfEXT;
+PFNGLMULTITEXENVFVEXTPROC __glewMultiTexEnvfvEXT = _glewLazy_glMultiTexEnvfvEXT;
+PFNGLMULTITEXENVIEXTPROC __glewMultiTexEnviEXT = _glewLazy_glMultiTexEnviEXT;
+PFNGLMULTITEXENVIVEXTPROC __glewMultiTexEnvivEXT = _glewLazy_glMultiTexEnvivEXT;
+PFNGLMULTITEXGENDEXTPROC __glewMultiTexGendEXT = _glewLazy_glMultiTexGendEXT;
+PFNGLMULTITEXGENDVEXTPROC __glewMultiTexGendvEXT = _glewLazy_glMultiTexGendvEXT;
+PFNGLMULTITEXGENFEXTPROC __glewMultiTexGenfEXT = _glewLazy_glMultiTexGenfEXT;
+PFNGLMULTITEXGENFVEXTPROC __glewMultiTexGenfvEXT = _glewLazy_glMultiTexGenfvEXT;
+PFNGLMULTITEXGENIEXTPROC __glewMultiTexGeniEXT = _glewLazy_glMultiTexGeniEXT;
+PFNGLMULTITEXGENIVEXTPROC __glewMultiTexGenivEXT = _glewLazy_glMultiTexGenivEXT;
+PFNGLMULTITEXIMAGE1DEXTPROC __glewMultiTexImage1DEXT = _glewLazy_glMultiTexImage1DEXT;
+PFNGLMULTITEXIMAGE2DEXTPROC __glewMultiTexImage2DEXT = _glewLazy_glMultiTexImage2DEXT;
+PFNGLMULTITEXIMAGE3DEXTPROC __glewMultiTexImage3DEXT = _glewLazy_glMultiTexImage3DEXT;
+PFNGLMULTITEXPARAMETERIIVEXTPROC __glewMultiTexParameterIivEXT = _glewLazy_glMultiTexParameterIivEXT;
+PFNGLMULTITEXPARAMETERIUIVEXTPROC __glewMultiTexParameterIuivEXT = _glewLazy_glMultiTexParameterIuivEXT;
+PFNGLMULTITEXPARAMETERFEXTPROC __glewMultiTexParameterfEXT = _glewLazy_glMultiTexParameterfEXT;
+PFNGLMULTITEXPARAMETERFVEXTPROC __glewMultiTexParameterfvEXT = _glewLazy_glMultiTexParameterfvEXT;
+PFNGLMULTITEXPARAMETERIEXTPROC __glewMultiTexParameteriEXT = _glewLazy_glMultiTexParameteriEXT;
+PFNGLMULTITEXPARAMETERIVEXTPROC __glewMultiTexParameterivEXT = _glewLazy_glMultiTexParameterivEXT;
+PFNGLMULTITEXRENDERBUFFEREXTPROC __glewMultiTexRenderbufferEXT = _glewLazy_glMultiTexRenderbufferEXT;
+PFNGLMULTITEXSUBIMAGE1DEXTPROC __glewMultiTexSubImage1DEXT = _glewLazy_glMultiTexSubImage1DEXT;
+PFNGLMULTITEXSUBIMAGE2DEXTPROC __glewMultiTexSubImage2DEXT = _glewLazy_glMultiTexSubImage2DEXT;
+PFNGLMULTITEXSUBIMAGE3DEXTPROC __glewMultiTexSubImage3DEXT = _glewLazy_glMultiTexSubImage3DEXT;
+PFNGLNAMEDBUFFERDATAEXTPROC __glewNamedBufferDataEXT = _glewLazy_glNamedBufferDataEXT;
+PFNGLNAMEDBUFFERSUBDATAEXTPROC __glewNamedBufferSubDataEXT = _glewLazy_glNamedBufferSubDataEXT;
+PFNGLNAMEDCOPYBUFFERSUBDATAEXTPROC __glewNamedCopyBufferSubDataEXT = _glewLazy_glNamedCopyBufferSubDataEXT;
+PFNGLNAMEDFRAMEBUFFERRENDERBUFFEREXTPROC __glewNamedFramebufferRenderbufferEXT = _glewLazy_glNamedFramebufferRenderbufferEXT;
+PFNGLNAMEDFRAMEBUFFERTEXTURE1DEXTPROC __glewNamedFramebufferTexture1DEXT = _glewLazy_glNamedFramebufferTexture1DEXT;
+PFNGLNAMEDFRAMEBUFFERTEXTURE2DEXTPROC __glewNamedFramebufferTexture2DEXT = _glewLazy_glNamedFramebufferTexture2DEXT;
+PFNGLNAMEDFRAMEBUFFERTEXTURE3DEXTPROC __glewNamedFramebufferTexture3DEXT = _glewLazy_glNamedFramebufferTexture3DEXT;
+PFNGLNAMEDFRAMEBUFFERTEXTUREEXTPROC __glewNamedFramebufferTextureEXT = _glewLazy_glNamedFramebufferTextureEXT;
+PFNGLNAMEDFRAMEBUFFERTEXTUREFACEEXTPROC __glewNamedFramebufferTextureFaceEXT = _glewLazy_glNamedFramebufferTextureFaceEXT;
+PFNGLNAMEDFRAMEBUFFERTEXTURELAYEREXTPROC __glewNamedFramebufferTextureLayerEXT = _glewLazy_glNamedFramebufferTextureLayerEXT;
+PFNGLNAMEDPROGRAMLOCALPARAMETER4DEXTPROC __glewNamedProgramLocalParameter4dEXT = _glewLazy_glNamedProgramLocalParameter4dEXT;
+PFNGLNAMEDPROGRAMLOCALPARAMETER4DVEXTPROC __glewNamedProgramLocalParameter4dvEXT = _glewLazy_glNamedProgramLocalParameter4dvEXT;
+PFNGLNAMEDPROGRAMLOCALPARAMETER4FEXTPROC __glewNamedProgramLocalParameter4fEXT = _glewLazy_glNamedProgramLocalParameter4fEXT;
+PFNGLNAMEDPROGRAMLOCALPARAMETER4FVEXTPROC __glewNamedProgramLocalParameter4fvEXT = _glewLazy_glNamedProgramLocalParameter4fvEXT;
+PFNGLNAMEDPROGRAMLOCALPARAMETERI4IEXTPROC __glewNamedProgramLocalParameterI4iEXT = _glewLazy_glNamedProgramLocalParameterI4iEXT;
+PFNGLNAMEDPROGRAMLOCALPARAMETERI4IVEXTPROC __glewNamedProgramLocalParameterI4ivEXT = _glewLazy_glNamedProgramLocalParameterI4ivEXT;
+PFNGLNAMEDPROGRAMLOCALPARAMETERI4UIEXTPROC __glewNamedProgramLocalParameterI4uiEXT = _glewLazy_glNamedProgramLocalParameterI4uiEXT;
+PFNGLNAMEDPROGRAMLOCALPARAMETERI4UIVEXTPROC __glewNamedProgramLocalParameterI4uivEXT = _glewLazy_glNamedProgramLocalParameterI4uivEXT;
+PFNGLNAMEDPROGRAMLOCALPARAMETERS4FVEXTPROC __glewNamedProgramLocalParameters4fvEXT = _glewLazy_glNamedProgramLocalParameters4fvEXT;
+PFNGLNAMEDPROGRAMLOCALPARAMETERSI4IVEXTPROC __glewNamedProgramLocalParametersI4ivEXT = _glewLazy_glNamedProgramLocalParametersI4ivEXT;
+PFNGLNAMEDPROGRAMLOCALPARAMETERSI4UIVEXTPROC __glewNamedProgramLocalParametersI4uivEXT = _glewLazy_glNamedProgramLocalParametersI4uivEXT;
+PFNGLNAMEDPROGRAMSTRINGEXTPROC __glewNamedProgramStringEXT = _glewLazy_glNamedProgramStringEXT;
+PFNGLNAMEDRENDERBUFFERSTORAGEEXTPROC __glewNamedRenderbufferStorageEXT = _glewLazy_glNamedRenderbufferStorageEXT;
+PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLECOVERAGEEXTPROC __glewNamedRenderbufferStorageMultisampleCoverageEXT = _glewLazy_glNamedRenderbufferStorageMultisampleCoverageEXT;
+PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC __glewNamedRenderbufferStorageMultisampleEXT = _glewLazy_glNamedRenderbufferStorageMultisampleEXT;
+PFNGLPROGRAMUNIFORM1FEXTPROC __glewProgramUniform1fEXT = _glewLazy_glProgramUniform1fEXT;
+PFNGLPROGRAMUNIFORM1FVEXTPROC __glewProgramUniform1fvEXT = _glewLazy_glProgramUniform1fvEXT;
+PFNGLPROGRAMUNIFORM1IEXTPROC __glewProgramUniform1iEXT = _glewLazy_glProgramUniform1iEXT;
+PFNGLPROGRAMUNIFORM1IVEXTPROC __glewProgramUniform1ivEXT = _glewLazy_glProgramUniform1ivEXT;
+PFNGLPROGRAMUNIFORM1UIEXTPROC __glewProgramUniform1uiEXT = _glewLazy_glProgramUniform1uiEXT;
+PFNGLPROGRAMUNIFORM1UIVEXTPROC __glewProgramUniform1uivEXT = _glewLazy_glProgramUniform1uivEXT;
+PFNGLPROGRAMUNIFORM2FEXTPROC __glewProgramUniform2fEXT = _glewLazy_glProgramUniform2fEXT;
+PFNGLPROGRAMUNIFORM2FVEXTPROC __glewProgramUniform2fvEXT = _glewLazy_glProgramUniform2fvEXT;
+PFNGLPROGRAMUNIFORM2IEXTPROC __glewProgramUniform2iEXT = _glewLazy_glProgramUniform2iEXT;
+PFNGLPROGRAMUNIFORM2IVEXTPROC __glewProgramUniform2ivEXT = _glewLazy_glProgramUniform2ivEXT;
+PFNGLPROGRAMUNIFORM2UIEXTPROC __glewProgramUniform2uiEXT = _glewLazy_glProgramUniform2uiEXT;
+PFNGLPROGRAMUNIFORM2UIVEXTPROC __glewProgramUniform2uivEXT = _glewLazy_glProgramUniform2uivEXT;
+PFNGLPROGRAMUNIFORM3FEXTPROC __glewProgramUniform3fEXT = _glewLazy_glProgramUniform3fEXT;
+PFNGLPROGRAMUNIFORM3FVEXTPROC __glewProgramUniform3fvEXT = _glewLazy_glProgramUniform3fvEXT;
+PFNGLPROGRAMUNIFORM3IEXTPROC __glewProgramUniform3iEXT = _glewLazy_glProgramUniform3iEXT;
+PFNGLPROGRAMUNIFORM3IVEXTPROC __glewProgramUniform3ivEXT = _glewLazy_glProgramUniform3ivEXT;
+PFNGLPROGRAMUNIFORM3UIEXTPROC __glewProgramUniform3uiEXT = _glewLazy_glProgramUniform3uiEXT;
+PFNGLPROGRAMUNIFORM3UIVEXTPROC __glewProgramUniform3uivEXT = _glewLazy_glProgramUniform3uivEXT;
+PFNGLPROGRAMUNIFORM4FEXTPROC __glewProgramUniform4fEXT = _glewLazy_glProgramUniform4fEXT;
+PFNGLPROGRAMUNIFORM4FVEXTPROC __glewProgramUniform4fvEXT = _glewLazy_glProgramUniform4fvEXT;
+PFNGLPROGRAMUNIFORM4IEXTPROC __glewProgramUniform4iEXT = _glewLazy_glProgramUniform4iEXT;
+PFNGLPROGRAMUNIFORM4IVEXTPROC __glewProgramUniform4ivEXT = _glewLazy_glProgramUniform4ivEXT;
+PFNGLPROGRAMUNIFORM4UIEXTPROC __glewProgramUniform4uiEXT = _glewLazy_glProgramUniform4uiEXT;
+PFNGLPROGRAMUNIFORM4UIVEXTPROC __glewProgramUniform4uivEXT = _glewLazy_glProgramUniform4uivEXT;
+PFNGLPROGRAMUNIFORMMATRIX2FVEXTPROC __glewProgramUniformMatrix2fvEXT = _glewLazy_glProgramUniformMatrix2fvEXT;
+PFNGLPROGRAMUNIFORMMATRIX2X3FVEXTPROC __glewProgramUniformMatrix2x3fvEXT = _glewLazy_glProgramUniformMatrix2x3fvEXT;
+PFNGLPROGRAMUNIFORMMATRIX2X4FVEXTPROC __glewProgramUniformMatrix2x4fvEXT = _glewLazy_glProgramUniformMatrix2x4fvEXT;
+PFNGLPROGRAMUNIFORMMATRIX3FVEXTPROC __glewProgramUniformMatrix3fvEXT = _glewLazy_glProgramUniformMatrix3fvEXT;
+PFNGLPROGRAMUNIFORMMATRIX3X2FVEXTPROC __glewProgramUniformMatrix3x2fvEXT = _glewLazy_glProgramUniformMatrix3x2fvEXT;
+PFNGLPROGRAMUNIFORMMATRIX3X4FVEXTPROC __glewProgramUniformMatrix3x4fvEXT = _glewLazy_glProgramUniformMatrix3x4fvEXT;
+PFNGLPROGRAMUNIFORMMATRIX4FVEXTPROC __glewProgramUniformMatrix4fvEXT = _glewLazy_glProgramUniformMatrix4fvEXT;
+PFNGLPROGRAMUNIFORMMATRIX4X2FVEXTPROC __glewProgramUniformMatrix4x2fvEXT = _glewLazy_glProgramUniformMatrix4x2fvEXT;
+PFNGLPROGRAMUNIFORMMATRIX4X3FVEXTPROC __glewProgramUniformMatrix4x3fvEXT = _glewLazy_glProgramUniformMatrix4x3fvEXT;
+PFNGLPUSHCLIENTATTRIBDEFAULTEXTPROC __glewPushClientAttribDefaultEXT = _glewLazy_glPushClientAttribDefaultEXT;
+PFNGLTEXTUREBUFFEREXTPROC __glewTextureBufferEXT = _glewLazy_glTextureBufferEXT;
+PFNGLTEXTUREIMAGE1DEXTPROC __glewTextureImage1DEXT = _glewLazy_glTextureImage1DEXT;
+PFNGLTEXTUREIMAGE2DEXTPROC __glewTextureImage2DEXT = _glewLazy_glTextureImage2DEXT;
+PFNGLTEXTUREIMAGE3DEXTPROC __glewTextureImage3DEXT = _glewLazy_glTextureImage3DEXT;
+PFNGLTEXTUREPARAMETERIIVEXTPROC __glewTextureParameterIivEXT = _glewLazy_glTextureParameterIivEXT;
+PFNGLTEXTUREPARAMETERIUIVEXTPROC __glewTextureParameterIuivEXT = _glewLazy_glTextureParameterIuivEXT;
+PFNGLTEXTUREPARAMETERFEXTPROC __glewTextureParameterfEXT = _glewLazy_glTextureParameterfEXT;
+PFNGLTEXTUREPARAMETERFVEXTPROC __glewTextureParameterfvEXT = _glewLazy_glTextureParameterfvEXT;
+PFNGLTEXTUREPARAMETERIEXTPROC __glewTextureParameteriEXT = _glewLazy_glTextureParameteriEXT;
+PFNGLTEXTUREPARAMETERIVEXTPROC __glewTextureParameterivEXT = _glewLazy_glTextureParameterivEXT;
+PFNGLTEXTURERENDERBUFFEREXTPROC __glewTextureRenderbufferEXT = _glewLazy_glTextureRenderbufferEXT;
+PFNGLTEXTURESUBIMAGE1DEXTPROC __glewTextureSubImage1DEXT = _glewLazy_glTextureSubImage1DEXT;
+PFNGLTEXTURESUBIMAGE2DEXTPROC __glewTextureSubImage2DEXT = _glewLazy_glTextureSubImage2DEXT;
+PFNGLTEXTURESUBIMAGE3DEXTPROC __glewTextureSubImage3DEXT = _glewLazy_glTextureSubImage3DEXT;
+PFNGLUNMAPNAMEDBUFFEREXTPROC __glewUnmapNamedBufferEXT = _glewLazy_glUnmapNamedBufferEXT;
+PFNGLVERTEXARRAYCOLOROFFSETEXTPROC __glewVertexArrayColorOffsetEXT = _glewLazy_glVertexArrayColorOffsetEXT;
+PFNGLVERTEXARRAYEDGEFLAGOFFSETEXTPROC __glewVertexArrayEdgeFlagOffsetEXT = _glewLazy_glVertexArrayEdgeFlagOffsetEXT;
+PFNGLVERTEXARRAYFOGCOORDOFFSETEXTPROC __glewVertexArrayFogCoordOffsetEXT = _glewLazy_glVertexArrayFogCoordOffsetEXT;
+PFNGLVERTEXARRAYINDEXOFFSETEXTPROC __glewVertexArrayIndexOffsetEXT = _glewLazy_glVertexArrayIndexOffsetEXT;
+PFNGLVERTEXARRAYMULTITEXCOORDOFFSETEXTPROC __glewVertexArrayMultiTexCoordOffsetEXT = _glewLazy_glVertexArrayMultiTexCoordOffsetEXT;
+PFNGLVERTEXARRAYNORMALOFFSETEXTPROC __glewVertexArrayNormalOffsetEXT = _glewLazy_glVertexArrayNormalOffsetEXT;
+PFNGLVERTEXARRAYSECONDARYCOLOROFFSETEXTPROC __glewVertexArraySecondaryColorOffsetEXT = _glewLazy_glVertexArraySecondaryColorOffsetEXT;
+PFNGLVERTEXARRAYTEXCOORDOFFSETEXTPROC __glewVertexArrayTexCoordOffsetEXT = _glewLazy_glVertexArrayTexCoordOffsetEXT;
+PFNGLVERTEXARRAYVERTEXATTRIBDIVISOREXTPROC __glewVertexArrayVertexAttribDivisorEXT = _glewLazy_glVertexArrayVertexAttribDivisorEXT;
+PFNGLVERTEXARRAYVERTEXATTRIBIOFFSETEXTPROC __glewVertexArrayVertexAttribIOffsetEXT = _glewLazy_glVertexArrayVertexAttribIOffsetEXT;
+PFNGLVERTEXARRAYVERTEXATTRIBOFFSETEXTPROC __glewVertexArrayVertexAttribOffsetEXT = _glewLazy_glVertexArrayVertexAttribOffsetEXT;
+PFNGLVERTEXARRAYVERTEXOFFSETEXTPROC __glewVertexArrayVertexOffsetEXT = _glewLazy_glVertexArrayVertexOffsetEXT;
+
+PFNGLCOLORMASKINDEXEDEXTPROC __glewColorMaskIndexedEXT = _glewLazy_glColorMaskIndexedEXT;
+PFNGLDISABLEINDEXEDEXTPROC __glewDisableIndexedEXT = _glewLazy_glDisableIndexedEXT;
+PFNGLENABLEINDEXEDEXTPROC __glewEnableIndexedEXT = _glewLazy_glEnableIndexedEXT;
+PFNGLGETBOOLEANINDEXEDVEXTPROC __glewGetBooleanIndexedvEXT = _glewLazy_glGetBooleanIndexedvEXT;
+PFNGLGETINTEGERINDEXEDVEXTPROC __glewGetIntegerIndexedvEXT = _glewLazy_glGetIntegerIndexedvEXT;
+PFNGLISENABLEDINDEXEDEXTPROC __glewIsEnabledIndexedEXT = _glewLazy_glIsEnabledIndexedEXT;
+
+PFNGLDRAWARRAYSINSTANCEDEXTPROC __glewDrawArraysInstancedEXT = _glewLazy_glDrawArraysInstancedEXT;
+PFNGLDRAWELEMENTSINSTANCEDEXTPROC __glewDrawElementsInstancedEXT = _glewLazy_glDrawElementsInstancedEXT;
+
+PFNGLDRAWRANGEELEMENTSEXTPROC __glewDrawRangeElementsEXT = _glewLazy_glDrawRangeElementsEXT;
+
+PFNGLFOGCOORDPOINTEREXTPROC __glewFogCoordPointerEXT = _glewLazy_glFogCoordPointerEXT;
+PFNGLFOGCOORDDEXTPROC __glewFogCoorddEXT = _glewLazy_glFogCoorddEXT;
+PFNGLFOGCOORDDVEXTPROC __glewFogCoorddvEXT = _glewLazy_glFogCoorddvEXT;
+PFNGLFOGCOORDFEXTPROC __glewFogCoordfEXT = _glewLazy_glFogCoordfEXT;
+PFNGLFOGCOORDFVEXTPROC __glewFogCoordfvEXT = _glewLazy_glFogCoordfvEXT;
+
+PFNGLFRAGMENTCOLORMATERIALEXTPROC __glewFragmentColorMaterialEXT = _glewLazy_glFragmentColorMaterialEXT;
+PFNGLFRAGMENTLIGHTMODELFEXTPROC __glewFragmentLightModelfEXT = _glewLazy_glFragmentLightModelfEXT;
+PFNGLFRAGMENTLIGHTMODELFVEXTPROC __glewFragmentLightModelfvEXT = _glewLazy_glFragmentLightModelfvEXT;
+PFNGLFRAGMENTLIGHTMODELIEXTPROC __glewFragmentLightModeliEXT = _glewLazy_glFragmentLightModeliEXT;
+PFNGLFRAGMENTLIGHTMODELIVEXTPROC __glewFragmentLightModelivEXT = _glewLazy_glFragmentLightModelivEXT;
+PFNGLFRAGMENTLIGHTFEXTPROC __glewFragmentLightfEXT = _glewLazy_glFragmentLightfEXT;
+PFNGLFRAGMENTLIGHTFVEXTPROC __glewFragmentLightfvEXT = _glewLazy_glFragmentLightfvEXT;
+PFNGLFRAGMENTLIGHTIEXTPROC __glewFragmentLightiEXT = _glewLazy_glFragmentLightiEXT;
+PFNGLFRAGMENTLIGHTIVEXTPROC __glewFragmentLightivEXT = _glewLazy_glFragmentLightivEXT;
+PFNGLFRAGMENTMATERIALFEXTPROC __glewFragmentMaterialfEXT = _glewLazy_glFragmentMaterialfEXT;
+PFNGLFRAGMENTMATERIALFVEXTPROC __glewFragmentMaterialfvEXT = _glewLazy_glFragmentMaterialfvEXT;
+PFNGLFRAGMENTMATERIALIEXTPROC __glewFragmentMaterialiEXT = _glewLazy_glFragmentMaterialiEXT;
+PFNGLFRAGMENTMATERIALIVEXTPROC __glewFragmentMaterialivEXT = _glewLazy_glFragmentMaterialivEXT;
+PFNGLGETFRAGMENTLIGHTFVEXTPROC __glewGetFragmentLightfvEXT = _glewLazy_glGetFragmentLightfvEXT;
+PFNGLGETFRAGMENTLIGHTIVEXTPROC __glewGetFragmentLightivEXT = _glewLazy_glGetFragmentLightivEXT;
+PFNGLGETFRAGMENTMATERIALFVEXTPROC __glewGetFragmentMaterialfvEXT = _glewLazy_glGetFragmentMaterialfvEXT;
+PFNGLGETFRAGMENTMATERIALIVEXTPROC __glewGetFragmentMaterialivEXT = _glewLazy_glGetFragmentMaterialivEXT;
+PFNGLLIGHTENVIEXTPROC __glewLightEnviEXT = _glewLazy_glLightEnviEXT;
+
+PFNGLBLITFRAMEBUFFEREXTPROC __glewBlitFramebufferEXT = _glewLazy_glBlitFramebufferEXT;
+
+PFNGLRENDERBUFFERSTORAGEMULTISAMPLEEXTPROC __glewRenderbufferStorageMultisampleEXT = _glewLazy_glRenderbufferStorageMultisampleEXT;
+
+PFNGLBINDFRAMEBUFFEREXTPROC __glewBindFramebufferEXT = _glewLazy_glBindFramebufferEXT;
+PFNGLBINDRENDERBUFFEREXTPROC __glewBindRenderbufferEXT = _glewLazy_glBindRenderbufferEXT;
+PFNGLCHECKFRAMEBUFFERSTATUSEXTPROC __glewCheckFramebufferStatusEXT = _glewLazy_glCheckFramebufferStatusEXT;
+PFNGLDELETEFRAMEBUFFERSEXTPROC __glewDeleteFramebuffersEXT = _glewLazy_glDeleteFramebuffersEXT;
+PFNGLDELETERENDERBUFFERSEXTPROC __glewDeleteRenderbuffersEXT = _glewLazy_glDeleteRenderbuffersEXT;
+PFNGLFRAMEBUFFERRENDERBUFFEREXTPROC __glewFramebufferRenderbufferEXT = _glewLazy_glFramebufferRenderbufferEXT;
+PFNGLFRAMEBUFFERTEXTURE1DEXTPROC __glewFramebufferTexture1DEXT = _glewLazy_glFramebufferTexture1DEXT;
+PFNGLFRAMEBUFFERTEXTURE2DEXTPROC __glewFramebufferTexture2DEXT = _glewLazy_glFramebufferTexture2DEXT;
+PFNGLFRAMEBUFFERTEXTURE3DEXTPROC __glewFramebufferTexture3DEXT = _glewLazy_glFramebufferTexture3DEXT;
+PFNGLGENFRAMEBUFFERSEXTPROC __glewGenFramebuffersEXT = _glewLazy_glGenFramebuffersEXT;
+PFNGLGENRENDERBUFFERSEXTPROC __glewGenRenderbuffersEXT = _glewLazy_glGenRenderbuffersEXT;
+PFNGLGENERATEMIPMAPEXTPROC __glewGenerateMipmapEXT = _glewLazy_glGenerateMipmapEXT;
+PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVEXTPROC __glewGetFramebufferAttachmentParameterivEXT = _glewLazy_glGetFramebufferAttachmentParameterivEXT;
+PFNGLGETRENDERBUFFERPARAMETERIVEXTPROC __glewGetRenderbufferParameterivEXT = _glewLazy_glGetRenderbufferParameterivEXT;
+PFNGLISFRAMEBUFFEREXTPROC __glewIsFramebufferEXT = _glewLazy_glIsFramebufferEXT;
+PFNGLISRENDERBUFFEREXTPROC __glewIsRenderbufferEXT = _glewLazy_glIsRenderbufferEXT;
+PFNGLRENDERBUFFERSTORAGEEXTPROC __glewRenderbufferStorageEXT = _glewLazy_glRenderbufferStorageEXT;
+
+PFNGLFRAMEBUFFERTEXTUREEXTPROC __glewFramebufferTextureEXT = _glewLazy_glFramebufferTextureEXT;
+PFNGLFRAMEBUFFERTEXTUREFACEEXTPROC __glewFramebufferTextureFaceEXT = _glewLazy_glFramebufferTextureFaceEXT;
+PFNGLPROGRAMPARAMETERIEXTPROC __glewProgramParameteriEXT = _glewLazy_glProgramParameteriEXT;
+
+PFNGLPROGRAMENVPARAMETERS4FVEXTPROC __glewProgramEnvParameters4fvEXT = _glewLazy_glProgramEnvParameters4fvEXT;
+PFNGLPROGRAMLOCALPARAMETERS4FVEXTPROC __glewProgramLocalParameters4fvEXT = _glewLazy_glProgramLocalParameters4fvEXT;
+
+PFNGLBINDFRAGDATALOCATIONEXTPROC __glewBindFragDataLocationEXT = _glewLazy_glBindFragDataLocationEXT;
+PFNGLGETFRAGDATALOCATIONEXTPROC __glewGetFragDataLocationEXT = _glewLazy_glGetFragDataLocationEXT;
+PFNGLGETUNIFORMUIVEXTPROC __glewGetUniformuivEXT = _glewLazy_glGetUniformuivEXT;
+PFNGLGETVERTEXATTRIBIIVEXTPROC __glewGetVertexAttribIivEXT = _glewLazy_glGetVertexAttribIivEXT;
+PFNGLGETVERTEXATTRIBIUIVEXTPROC __glewGetVertexAttribIuivEXT = _glewLazy_glGetVertexAttribIuivEXT;
+PFNGLUNIFORM1UIEXTPROC __glewUniform1uiEXT = _glewLazy_glUniform1uiEXT;
+PFNGLUNIFORM1UIVEXTPROC __glewUniform1uivEXT = _glewLazy_glUniform1uivEXT;
+PFNGLUNIFORM2UIEXTPROC __glewUniform2uiEXT = _glewLazy_glUniform2uiEXT;
+PFNGLUNIFORM2UIVEXTPROC __glewUniform2uivEXT = _glewLazy_glUniform2uivEXT;
+PFNGLUNIFORM3UIEXTPROC __glewUniform3uiEXT = _glewLazy_glUniform3uiEXT;
+PFNGLUNIFORM3UIVEXTPROC __glewUniform3uivEXT = _glewLazy_glUniform3uivEXT;
+PFNGLUNIFORM4UIEXTPROC __glewUniform4uiEXT = _glewLazy_glUniform4uiEXT;
+PFNGLUNIFORM4UIVEXTPROC __glewUniform4uivEXT = _glewLazy_glUniform4uivEXT;
+PFNGLVERTEXATTRIBI1IEXTPROC __glewVertexAttribI1iEXT = _glewLazy_glVertexAttribI1iEXT;
+PFNGLVERTEXATTRIBI1IVEXTPROC __glewVertexAttribI1ivEXT = _glewLazy_glVertexAttribI1ivEXT;
+PFNGLVERTEXATTRIBI1UIEXTPROC __glewVertexAttribI1uiEXT = _glewLazy_glVertexAttribI1uiEXT;
+PFNGLVERTEXATTRIBI1UIVEXTPROC __glewVertexAttribI1uivEXT = _glewLazy_glVertexAttribI1uivEXT;
+PFNGLVERTEXATTRIBI2IEXTPROC __glewVertexAttribI2iEXT = _glewLazy_glVertexAttribI2iEXT;
+PFNGLVERTEXATTRIBI2IVEXTPROC __glewVertexAttribI2ivEXT = _glewLazy_glVertexAttribI2ivEXT;
+PFNGLVERTEXATTRIBI2UIEXTPROC __glewVertexAttribI2uiEXT = _glewLazy_glVertexAttribI2uiEXT;
+PFNGLVERTEXATTRIBI2UIVEXTPROC __glewVertexAttribI2uivEXT = _glewLazy_glVertexAttribI2uivEXT;
+PFNGLVERTEXATTRIBI3IEXTPROC __glewVertexAttribI3iEXT = _glewLazy_glVertexAttribI3iEXT;
+PFNGLVERTEXATTRIBI3IVEXTPROC __glewVertexAttribI3ivEXT = _glewLazy_glVertexAttribI3ivEXT;
+PFNGLVERTEXATTRIBI3UIEXTPROC __glewVertexAttribI3uiEXT = _glewLazy_glVertexAttribI3uiEXT;
+PFNGLVERTEXATTRIBI3UIVEXTPROC __glewVertexAttribI3uivEXT = _glewLazy_glVertexAttribI3uivEXT;
+PFNGLVERTEXATTRIBI4BVEXTPROC __glewVertexAttribI4bvEXT = _glewLazy_glVertexAttribI4bvEXT;
+PFNGLVERTEXATTRIBI4IEXTPROC __glewVertexAttribI4iEXT = _glewLazy_glVertexAttribI4iEXT;
+PFNGLVERTEXATTRIBI4IVEXTPROC __glewVertexAttribI4ivEXT = _glewLazy_glVertexAttribI4ivEXT;
+PFNGLVERTEXATTRIBI4SVEXTPROC __glewVertexAttribI4svEXT = _glewLazy_glVertexAttribI4svEXT;
+PFNGLVERTEXATTRIBI4UBVEXTPROC __glewVertexAttribI4ubvEXT = _glewLazy_glVertexAttribI4ubvEXT;
+PFNGLVERTEXATTRIBI4UIEXTPROC __glewVertexAttribI4uiEXT = _glewLazy_glVertexAttribI4uiEXT;
+PFNGLVERTEXATTRIBI4UIVEXTPROC __glewVertexAttribI4uivEXT = _glewLazy_glVertexAttribI4uivEXT;
+PFNGLVERTEXATTRIBI4USVEXTPROC __glewVertexAttribI4usvEXT = _glewLazy_glVertexAttribI4usvEXT;
+PFNGLVERTEXATTRIBIPOINTEREXTPROC __glewVertexAttribIPointerEXT = _glewLazy_glVertexAttribIPointerEXT;
+
+PFNGLGETHISTOGRAMEXTPROC __glewGetHistogramEXT = _glewLazy_glGetHistogramEXT;
+PFNGLGETHISTOGRAMPARAMETERFVEXTPROC __glewGetHistogramParameterfvEXT = _glewLazy_glGetHistogramParameterfvEXT;
+PFNGLGETHISTOGRAMPARAMETERIVEXTPROC __glewGetHistogramParameterivEXT = _glewLazy_glGetHistogramParameterivEXT;
+PFNGLGETMINMAXEXTPROC __glewGetMinmaxEXT = _glewLazy_glGetMinmaxEXT;
+PFNGLGETMINMAXPARAMETERFVEXTPROC __glewGetMinmaxParameterfvEXT = _glewLazy_glGetMinmaxParameterfvEXT;
+PFNGLGETMINMAXPARAMETERIVEXTPROC __glewGetMinmaxParameterivEXT = _glewLazy_glGetMinmaxParameterivEXT;
+PFNGLHISTOGRAMEXTPROC __glewHistogramEXT = _glewLazy_glHistogramEXT;
+PFNGLMINMAXEXTPROC __glewMinmaxEXT = _glewLazy_glMinmaxEXT;
+PFNGLRESETHISTOGRAMEXTPROC __glewResetHistogramEXT = _glewLazy_glResetHistogramEXT;
+PFNGLRESETMINMAXEXTPROC __glewResetMinmaxEXT = _glewLazy_glResetMinmaxEXT;
+
+PFNGLINDEXFUNCEXTPROC __glewIndexFuncEXT = _glewLazy_glIndexFuncEXT;
+
+PFNGLINDEXMATERIALEXTPROC __glewIndexMaterialEXT = _glewLazy_glIndexMaterialEXT;
+
+PFNGLAPPLYTEXTUREEXTPROC __glewApplyTextureEXT = _glewLazy_glApplyTextureEXT;
+PFNGLTEXTURELIGHTEXTPROC __glewTextureLightEXT = _glewLazy_glTextureLightEXT;
+PFNGLTEXTUREMATERIALEXTPROC __glewTextureMaterialEXT = _glewLazy_glTextureMaterialEXT;
+
+PFNGLMULTIDRAWARRAYSEXTPROC __glewMultiDrawArraysEXT = _glewLazy_glMultiDrawArraysEXT;
+PFNGLMULTIDRAWELEMENTSEXTPROC __glewMultiDrawElementsEXT = _glewLazy_glMultiDrawElementsEXT;
+
+PFNGLSAMPLEMASKEXTPROC __glewSampleMaskEXT = _glewLazy_glSampleMaskEXT;
+PFNGLSAMPLEPATTERNEXTPROC __glewSamplePatternEXT = _glewLazy_glSamplePatternEXT;
+
+PFNGLCOLORTABLEEXTPROC __glewColorTableEXT = _glewLazy_glColorTableEXT;
+PFNGLGETCOLORTABLEEXTPROC __glewGetColorTableEXT = _glewLazy_glGetColorTableEXT;
+PFNGLGETCOLORTABLEPARAMETERFVEXTPROC __glewGetColorTableParameterfvEXT = _glewLazy_glGetColorTableParameterfvEXT;
+PFNGLGETCOLORTABLEPARAMETERIVEXTPROC __glewGetColorTableParameterivEXT = _glewLazy_glGetColorTableParameterivEXT;
+
+PFNGLGETPIXELTRANSFORMPARAMETERFVEXTPROC __glewGetPixelTransformParameterfvEXT = _glewLazy_glGetPixelTransformParameterfvEXT;
+PFNGLGETPIXELTRANSFORMPARAMETERIVEXTPROC __glewGetPixelTransformParameterivEXT = _glewLazy_glGetPixelTransformParameterivEXT;
+PFNGLPIXELTRANSFORMPARAMETERFEXTPROC __glewPixelTransformParameterfEXT = _glewLazy_glPixelTransformParameterfEXT;
+PFNGLPIXELTRANSFORMPARAMETERFVEXTPROC __glewPixelTransformParameterfvEXT = _glewLazy_glPixelTransformParameterfvEXT;
+PFNGLPIXELTRANSFORMPARAMETERIEXTPROC __glewPixelTransformParameteriEXT = _glewLazy_glPixelTransformParameteriEXT;
+PFNGLPIXELTRANSFORMPARAMETERIVEXTPROC __glewPixelTransformParameterivEXT = _glewLazy_glPixelTransformParameterivEXT;
+
+PFNGLPOINTPARAMETERFEXTPROC __glewPointParameterfEXT = _glewLazy_glPointParameterfEXT;
+PFNGLPOINTPARAMETERFVEXTPROC __glewPointParameterfvEXT = _glewLazy_glPointParameterfvEXT;
+
+PFNGLPOLYGONOFFSETEXTPROC __glewPolygonOffsetEXT = _glewLazy_glPolygonOffsetEXT;
+
+PFNGLPOLYGONOFFSETCLAMPEXTPROC __glewPolygonOffsetClampEXT = _glewLazy_glPolygonOffsetClampEXT;
+
+PFNGLPROVOKINGVERTEXEXTPROC __glewProvokingVertexEXT = _glewLazy_glProvokingVertexEXT;
+
+PFNGLCOVERAGEMODULATIONNVPROC __glewCoverageModulationNV = _glewLazy_glCoverageModulationNV;
+PFNGLCOVERAGEMODULATIONTABLENVPROC __glewCoverageModulationTableNV = _glewLazy_glCoverageModulationTableNV;
+PFNGLGETCOVERAGEMODULATIONTABLENVPROC __glewGetCoverageModulationTableNV = _glewLazy_glGetCoverageModulationTableNV;
+PFNGLRASTERSAMPLESEXTPROC __glewRasterSamplesEXT = _glewLazy_glRasterSamplesEXT;
+
+PFNGLBEGINSCENEEXTPROC __glewBeginSceneEXT = _glewLazy_glBeginSceneEXT;
+PFNGLENDSCENEEXTPROC __glewEndSceneEXT = _glewLazy_glEndSceneEXT;
+
+PFNGLSECONDARYCOLOR3BEXTPROC __glewSecondaryColor3bEXT = _glewLazy_glSecondaryColor3bEXT;
+PFNGLSECONDARYCOLOR3BVEXTPROC __glewSecondaryColor3bvEXT = _glewLazy_glSecondaryColor3bvEXT;
+PFNGLSECONDARYCOLOR3DEXTPROC __glewSecondaryColor3dEXT = _glewLazy_glSecondaryColor3dEXT;
+PFNGLSECONDARYCOLOR3DVEXTPROC __glewSecondaryColor3dvEXT = _glewLazy_glSecondaryColor3dvEXT;
+PFNGLSECONDARYCOLOR3FEXTPROC __glewSecondaryColor3fEXT = _glewLazy_glSecondaryColor3fEXT;
+PFNGLSECONDARYCOLOR3FVEXTPROC __glewSecondaryColor3fvEXT = _glewLazy_glSecondaryColor3fvEXT;
+PFNGLSECONDARYCOLOR3IEXTPROC __glewSecondaryColor3iEXT = _glewLazy_glSecondaryColor3iEXT;
+PFNGLSECONDARYCOLOR3IVEXTPROC __glewSecondaryColor3ivEXT = _glewLazy_glSecondaryColor3ivEXT;
+PFNGLSECONDARYCOLOR3SEXTPROC __glewSecondaryColor3sEXT = _glewLazy_glSecondaryColor3sEXT;
+PFNGLSECONDARYCOLOR3SVEXTPROC __glewSecondaryColor3svEXT = _glewLazy_glSecondaryColor3svEXT;
+PFNGLSECONDARYCOLOR3UBEXTPROC __glewSecondaryColor3ubEXT = _glewLazy_glSecondaryColor3ubEXT;
+PFNGLSECONDARYCOLOR3UBVEXTPROC __glewSecondaryColor3ubvEXT = _glewLazy_glSecondaryColor3ubvEXT;
+PFNGLSECONDARYCOLOR3UIEXTPROC __glewSecondaryColor3uiEXT = _glewLazy_glSecondaryColor3uiEXT;
+PFNGLSECONDARYCOLOR3UIVEXTPROC __glewSecondaryColor3uivEXT = _glewLazy_glSecondaryColor3uivEXT;
+PFNGLSECONDARYCOLOR3USEXTPROC __glewSecondaryColor3usEXT = _glewLazy_glSecondaryColor3usEXT;
+PFNGLSECONDARYCOLOR3USVEXTPROC __glewSecondaryColor3usvEXT = _glewLazy_glSecondaryColor3usvEXT;
+PFNGLSECONDARYCOLORPOINTEREXTPROC __glewSecondaryColorPointerEXT = _glewLazy_glSecondaryColorPointerEXT;
+
+PFNGLACTIVEPROGRAMEXTPROC __glewActiveProgramEXT = _glewLazy_glActiveProgramEXT;
+PFNGLCREATESHADERPROGRAMEXTPROC __glewCreateShaderProgramEXT = _glewLazy_glCreateShaderProgramEXT;
+PFNGLUSESHADERPROGRAMEXTPROC __glewUseShaderProgramEXT = _glewLazy_glUseShaderProgramEXT;
+
+PFNGLBINDIMAGETEXTUREEXTPROC __glewBindImageTextureEXT = _glewLazy_glBindImageTextureEXT;
+PFNGLMEMORYBARRIEREXTPROC __glewMemoryBarrierEXT = _glewLazy_glMemoryBarrierEXT;
+
+PFNGLACTIVESTENCILFACEEXTPROC __glewActiveStencilFaceEXT = _glewLazy_glActiveStencilFaceEXT;
+
+PFNGLTEXSUBIMAGE1DEXTPROC __glewTexSubImage1DEXT = _glewLazy_glTexSubImage1DEXT;
+PFNGLTEXSUBIMAGE2DEXTPROC __glewTexSubImage2DEXT = _glewLazy_glTexSubImage2DEXT;
+PFNGLTEXSUBIMAGE3DEXTPROC __glewTexSubImage3DEXT = _glewLazy_glTexSubImage3DEXT;
+
+PFNGLTEXIMAGE3DEXTPROC __glewTexImage3DEXT = _glewLazy_glTexImage3DEXT;
+
+PFNGLFRAMEBUFFERTEXTURELAYEREXTPROC __glewFramebufferTextureLayerEXT = _glewLazy_glFramebufferTextureLayerEXT;
+
+PFNGLTEXBUFFEREXTPROC __glewTexBufferEXT = _glewLazy_glTexBufferEXT;
+
+PFNGLCLEARCOLORIIEXTPROC __glewClearColorIiEXT = _glewLazy_glClearColorIiEXT;
+PFNGLCLEARCOLORIUIEXTPROC __glewClearColorIuiEXT = _glewLazy_glClearColorIuiEXT;
+PFNGLGETTEXPARAMETERIIVEXTPROC __glewGetTexParameterIivEXT = _glewLazy_glGetTexParameterIivEXT;
+PFNGLGETTEXPARAMETERIUIVEXTPROC __glewGetTexParameterIuivEXT = _glewLazy_glGetTexParameterIuivEXT;
+PFNGLTEXPARAMETERIIVEXTPROC __glewTexParameterIivEXT = _glewLazy_glTexParameterIivEXT;
+PFNGLTEXPARAMETERIUIVEXTPROC __glewTexParameterIuivEXT = _glewLazy_glTexParameterIuivEXT;
+
+PFNGLARETEXTURESRESIDENTEXTPROC __glewAreTexturesResidentEXT = _glewLazy_glAreTexturesResidentEXT;
+PFNGLBINDTEXTUREEXTPROC __glewBindTextureEXT = _glewLazy_glBindTextureEXT;
+PFNGLDELETETEXTURESEXTPROC __glewDeleteTexturesEXT = _glewLazy_glDeleteTexturesEXT;
+PFNGLGENTEXTURESEXTPROC __glewGenTexturesEXT = _glewLazy_glGenTexturesEXT;
+PFNGLISTEXTUREEXTPROC __glewIsTextureEXT = _glewLazy_glIsTextureEXT;
+PFNGLPRIORITIZETEXTURESEXTPROC __glewPrioritizeTexturesEXT = _glewLazy_glPrioritizeTexturesEXT;
+
+PFNGLTEXTURENORMALEXTPROC __glewTextureNormalEXT = _glewLazy_glTextureNormalEXT;
+
+PFNGLGETQUERYOBJECTI64VEXTPROC __glewGetQueryObjecti64vEXT = _glewLazy_glGetQueryObjecti64vEXT;
+PFNGLGETQUERYOBJECTUI64VEXTPROC __glewGetQueryObjectui64vEXT = _glewLazy_glGetQueryObjectui64vEXT;
+
+PFNGLBEGINTRANSFORMFEEDBACKEXTPROC __glewBeginTransformFeedbackEXT = _glewLazy_glBeginTransformFeedbackEXT;
+PFNGLBINDBUFFERBASEEXTPROC __glewBindBufferBaseEXT = _glewLazy_glBindBufferBaseEXT;
+PFNGLBINDBUFFEROFFSETEXTPROC __glewBindBufferOffsetEXT = _glewLazy_glBindBufferOffsetEXT;
+PFNGLBINDBUFFERRANGEEXTPROC __glewBindBufferRangeEXT = _glewLazy_glBindBufferRangeEXT;
+PFNGLENDTRANSFORMFEEDBACKEXTPROC __glewEndTransformFeedbackEXT = _glewLazy_glEndTransformFeedbackEXT;
+PFNGLGETTRANSFORMFEEDBACKVARYINGEXTPROC __glewGetTransformFeedbackVaryingEXT = _glewLazy_glGetTransformFeedbackVaryingEXT;
+PFNGLTRANSFORMFEEDBACKVARYINGSEXTPROC __glewTransformFeedbackVaryingsEXT = _glewLazy_glTransformFeedbackVaryingsEXT;
+
+PFNGLARRAYELEMENTEXTPROC __glewArrayElementEXT = _glewLazy_glArrayElementEXT;
+PFNGLCOLORPOINTEREXTPROC __glewColorPointerEXT = _glewLazy_glColorPointerEXT;
+PFNGLDRAWARRAYSEXTPROC __glewDrawArraysEXT = _glewLazy_glDrawArraysEXT;
+PFNGLEDGEFLAGPOINTEREXTPROC __glewEdgeFlagPointerEXT = _glewLazy_glEdgeFlagPointerEXT;
+PFNGLINDEXPOINTEREXTPROC __glewIndexPointerEXT = _glewLazy_glIndexPointerEXT;
+PFNGLNORMALPOINTEREXTPROC __glewNormalPointerEXT = _glewLazy_glNormalPointerEXT;
+PFNGLTEXCOORDPOINTEREXTPROC __glewTexCoordPointerEXT = _glewLazy_glTexCoordPointerEXT;
+PFNGLVERTEXPOINTEREXTPROC __glewVertexPointerEXT = _glewLazy_glVertexPointerEXT;
+
+PFNGLGETVERTEXATTRIBLDVEXTPROC __glewGetVertexAttribLdvEXT = _glewLazy_glGetVertexAttribLdvEXT;
+PFNGLVERTEXARRAYVERTEXATTRIBLOFFSETEXTPROC __glewVertexArrayVertexAttribLOffsetEXT = _glewLazy_glVertexArrayVertexAttribLOffsetEXT;
+PFNGLVERTEXATTRIBL1DEXTPROC __glewVertexAttribL1dEXT = _glewLazy_glVertexAttribL1dEXT;
+PFNGLVERTEXATTRIBL1DVEXTPROC __glewVertexAttribL1dvEXT = _glewLazy_glVertexAttribL1dvEXT;
+PFNGLVERTEXATTRIBL2DEXTPROC __glewVertexAttribL2dEXT = _glewLazy_glVertexAttribL2dEXT;
+PFNGLVERTEXATTRIBL2DVEXTPROC __glewVertexAttribL2dvEXT = _glewLazy_glVertexAttribL2dvEXT;
+PFNGLVERTEXATTRIBL3DEXTPROC __glewVertexAttribL3dEXT = _glewLazy_glVertexAttribL3dEXT;
+PFNGLVERTEXATTRIBL3DVEXTPROC __glewVertexAttribL3dvEXT = _glewLazy_glVertexAttribL3dvEXT;
+PFNGLVERTEXATTRIBL4DEXTPROC __glewVertexAttribL4dEXT = _glewLazy_glVertexAttribL4dEXT;
+PFNGLVERTEXATTRIBL4DVEXTPROC __glewVertexAttribL4dvEXT = _glewLazy_glVertexAttribL4dvEXT;
+PFNGLVERTEXATTRIBLPOINTEREXTPROC __glewVertexAttribLPointerEXT = _glewLazy_glVertexAttribLPointerEXT;
+
+PFNGLBEGINVERTEXSHADEREXTPROC __glewBeginVertexShaderEXT = _glewLazy_glBeginVertexShaderEXT;
+PFNGLBINDLIGHTPARAMETEREXTPROC __glewBindLightParameterEXT = _glewLazy_glBindLightParameterEXT;
+PFNGLBINDMATERIALPARAMETEREXTPROC __glewBindMaterialParameterEXT = _glewLazy_glBindMaterialParameterEXT;
+PFNGLBINDPARAMETEREXTPROC __glewBindParameterEXT = _glewLazy_glBindParameterEXT;
+PFNGLBINDTEXGENPARAMETEREXTPROC __glewBindTexGenParameterEXT = _glewLazy_glBindTexGenParameterEXT;
+PFNGLBINDTEXTUREUNITPARAMETEREXTPROC __glewBindTextureUnitParameterEXT = _glewLazy_glBindTextureUnitParameterEXT;
+PFNGLBINDVERTEXSHADEREXTPROC __glewBindVertexShaderEXT = _glewLazy_glBindVertexShaderEXT;
+PFNGLDELETEVERTEXSHADEREXTPROC __glewDeleteVertexShaderEXT = _glewLazy_glDeleteVertexShaderEXT;
+PFNGLDISABLEVARIANTCLIENTSTATEEXTPROC __glewDisableVariantClientStateEXT = _glewLazy_glDisableVariantClientStateEXT;
+PFNGLENABLEVARIANTCLIENTSTATEEXTPROC __glewEnableVariantClientStateEXT = _glewLazy_glEnableVariantClientStateEXT;
+PFNGLENDVERTEXSHADEREXTPROC __glewEndVertexShaderEXT = _glewLazy_glEndVertexShaderEXT;
+PFNGLEXTRACTCOMPONENTEXTPROC __glewExtractComponentEXT = _glewLazy_glExtractComponentEXT;
+PFNGLGENSYMBOLSEXTPROC __glewGenSymbolsEXT = _glewLazy_glGenSymbolsEXT;
+PFNGLGENVERTEXSHADERSEXTPROC __glewGenVertexShadersEXT = _glewLazy_glGenVertexShadersEXT;
+PFNGLGETINVARIANTBOOLEANVEXTPROC __glewGetInvariantBooleanvEXT = _glewLazy_glGetInvariantBooleanvEXT;
+PFNGLGETINVARIANTFLOATVEXTPROC __glewGetInvariantFloatvEXT = _glewLazy_glGetInvariantFloatvEXT;
+PFNGLGETINVARIANTINTEGERVEXTPROC __glewGetInvariantIntegervEXT = _glewLazy_glGetInvariantIntegervEXT;
+PFNGLGETLOCALCONSTANTBOOLEANVEXTPROC __glewGetLocalConstantBooleanvEXT = _glewLazy_glGetLocalConstantBooleanvEXT;
+PFNGLGETLOCALCONSTANTFLOATVEXTPROC __glewGetLocalConstantFloatvEXT = _glewLazy_glGetLocalConstantFloatvEXT;
+PFNGLGETLOCALCONSTANTINTEGERVEXTPROC __glewGetLocalConstantIntegervEXT = _glewLazy_glGetLocalConstantIntegervEXT;
+PFNGLGETVARIANTBOOLEANVEXTPROC __glewGetVariantBooleanvEXT = _glewLazy_glGetVariantBooleanvEXT;
+PFNGLGETVARIANTFLOATVEXTPROC __glewGetVariantFloatvEXT = _glewLazy_glGetVariantFloatvEXT;
+PFNGLGETVARIANTINTEGERVEXTPROC __glewGetVariantIntegervEXT = _glewLazy_glGetVariantIntegervEXT;
+PFNGLGETVARIANTPOINTERVEXTPROC __glewGetVariantPointervEXT = _glewLazy_glGetVariantPointervEXT;
+PFNGLINSERTCOMPONENTEXTPROC __glewInsertComponentEXT = _glewLazy_glInsertComponentEXT;
+PFNGLISVARIANTENABLEDEXTPROC __glewIsVariantEnabledEXT = _glewLazy_glIsVariantEnabledEXT;
+PFNGLSETINVARIANTEXTPROC __glewSetInvariantEXT = _glewLazy_glSetInvariantEXT;
+PFNGLSETLOCALCONSTANTEXTPROC __glewSetLocalConstantEXT = _glewLazy_glSetLocalConstantEXT;
+PFNGLSHADEROP1EXTPROC __glewShaderOp1EXT = _glewLazy_glShaderOp1EXT;
+PFNGLSHADEROP2EXTPROC __glewShaderOp2EXT = _glewLazy_glShaderOp2EXT;
+PFNGLSHADEROP3EXTPROC __glewShaderOp3EXT = _glewLazy_glShaderOp3EXT;
+PFNGLSWIZZLEEXTPROC __glewSwizzleEXT = _glewLazy_glSwizzleEXT;
+PFNGLVARIANTPOINTEREXTPROC __glewVariantPointerEXT = _glewLazy_glVariantPointerEXT;
+PFNGLVARIANTBVEXTPROC __glewVariantbvEXT = _glewLazy_glVariantbvEXT;
+PFNGLVARIANTDVEXTPROC __glewVariantdvEXT = _glewLazy_glVariantdvEXT;
+PFNGLVARIANTFVEXTPROC __glewVariantfvEXT = _glewLazy_glVariantfvEXT;
+PFNGLVARIANTIVEXTPROC __glewVariantivEXT = _glewLazy_glVariantivEXT;
+PFNGLVARIANTSVEXTPROC __glewVariantsvEXT = _glewLazy_glVariantsvEXT;
+PFNGLVARIANTUBVEXTPROC __glewVariantubvEXT = _glewLazy_glVariantubvEXT;
+PFNGLVARIANTUIVEXTPROC __glewVariantuivEXT = _glewLazy_glVariantuivEXT;
+PFNGLVARIANTUSVEXTPROC __glewVariantusvEXT = _glewLazy_glVariantusvEXT;
+PFNGLWRITEMASKEXTPROC __glewWriteMaskEXT = _glewLazy_glWriteMaskEXT;
+
+PFNGLVERTEXWEIGHTPOINTEREXTPROC __glewVertexWeightPointerEXT = _glewLazy_glVertexWeightPointerEXT;
+PFNGLVERTEXWEIGHTFEXTPROC __glewVertexWeightfEXT = _glewLazy_glVertexWeightfEXT;
+PFNGLVERTEXWEIGHTFVEXTPROC __glewVertexWeightfvEXT = _glewLazy_glVertexWeightfvEXT;
+
+PFNGLIMPORTSYNCEXTPROC __glewImportSyncEXT = _glewLazy_glImportSyncEXT;
+
+PFNGLFRAMETERMINATORGREMEDYPROC __glewFrameTerminatorGREMEDY = _glewLazy_glFrameTerminatorGREMEDY;
+
+PFNGLSTRINGMARKERGREMEDYPROC __glewStringMarkerGREMEDY = _glewLazy_glStringMarkerGREMEDY;
+
+PFNGLGETIMAGETRANSFORMPARAMETERFVHPPROC __glewGetImageTransformParameterfvHP = _glewLazy_glGetImageTransformParameterfvHP;
+PFNGLGETIMAGETRANSFORMPARAMETERIVHPPROC __glewGetImageTransformParameterivHP = _glewLazy_glGetImageTransformParameterivHP;
+PFNGLIMAGETRANSFORMPARAMETERFHPPROC __glewImageTransformParameterfHP = _glewLazy_glImageTransformParameterfHP;
+PFNGLIMAGETRANSFORMPARAMETERFVHPPROC __glewImageTransformParameterfvHP = _glewLazy_glImageTransformParameterfvHP;
+PFNGLIMAGETRANSFORMPARAMETERIHPPROC __glewImageTransformParameteriHP = _glewLazy_glImageTransformParameteriHP;
+PFNGLIMAGETRANSFORMPARAMETERIVHPPROC __glewImageTransformParameterivHP = _glewLazy_glImageTransformParameterivHP;
+
+PFNGLMULTIMODEDRAWARRAYSIBMPROC __glewMultiModeDrawArraysIBM = _glewLazy_glMultiModeDrawArraysIBM;
+PFNGLMULTIMODEDRAWELEMENTSIBMPROC __glewMultiModeDrawElementsIBM = _glewLazy_glMultiModeDrawElementsIBM;
+
+PFNGLCOLORPOINTERLISTIBMPROC __glewColorPointerListIBM = _glewLazy_glColorPointerListIBM;
+PFNGLEDGEFLAGPOINTERLISTIBMPROC __glewEdgeFlagPointerListIBM = _glewLazy_glEdgeFlagPointerListIBM;
+PFNGLFOGCOORDPOINTERLISTIBMPROC __glewFogCoordPointerListIBM = _glewLazy_glFogCoordPointerListIBM;
+PFNGLINDEXPOINTERLISTIBMPROC __glewIndexPointerListIBM = _glewLazy_glIndexPointerListIBM;
+PFNGLNORMALPOINTERLISTIBMPROC __glewNormalPointerListIBM = _glewLazy_glNormalPointerListIBM;
+PFNGLSECONDARYCOLORPOINTERLISTIBMPROC __glewSecondaryColorPointerListIBM = _glewLazy_glSecondaryColorPointerListIBM;
+PFNGLTEXCOORDPOINTERLISTIBMPROC __glewTexCoordPointerListIBM = _glewLazy_glTexCoordPointerListIBM;
+PFNGLVERTEXPOINTERLISTIBMPROC __glewVertexPointerListIBM = _glewLazy_glVertexPointerListIBM;
+
+PFNGLMAPTEXTURE2DINTELPROC __glewMapTexture2DINTEL = _glewLazy_glMapTexture2DINTEL;
+PFNGLSYNCTEXTUREINTELPROC __glewSyncTextureINTEL = _glewLazy_glSyncTextureINTEL;
+PFNGLUNMAPTEXTURE2DINTELPROC __glewUnmapTexture2DINTEL = _glewLazy_glUnmapTexture2DINTEL;
+
+PFNGLCOLORPOINTERVINTELPROC __glewColorPointervINTEL = _glewLazy_glColorPointervINTEL;
+PFNGLNORMALPOINTERVINTELPROC __glewNormalPointervINTEL = _glewLazy_glNormalPointervINTEL;
+PFNGLTEXCOORDPOINTERVINTELPROC __glewTexCoordPointervINTEL = _glewLazy_glTexCoordPointervINTEL;
+PFNGLVERTEXPOINTERVINTELPROC __glewVertexPointervINTEL = _glewLazy_glVertexPointervINTEL;
+
+PFNGLBEGINPERFQUERYINTELPROC __glewBeginPerfQueryINTEL = _glewLazy_glBeginPerfQueryINTEL;
+PFNGLCREATEPERFQUERYINTELPROC __glewCreatePerfQueryINTEL = _glewLazy_glCreatePerfQueryINTEL;
+PFNGLDELETEPERFQUERYINTELPROC __glewDeletePerfQueryINTEL = _glewLazy_glDeletePerfQueryINTEL;
+PFNGLENDPERFQUERYINTELPROC __glewEndPerfQueryINTEL = _glewLazy_glEndPerfQueryINTEL;
+PFNGLGETFIRSTPERFQUERYIDINTELPROC __glewGetFirstPerfQueryIdINTEL = _glewLazy_glGetFirstPerfQueryIdINTEL;
+PFNGLGETNEXTPERFQUERYIDINTELPROC __glewGetNextPerfQueryIdINTEL = _glewLazy_glGetNextPerfQueryIdINTEL;
+PFNGLGETPERFCOUNTERINFOINTELPROC __glewGetPerfCounterInfoINTEL = _glewLazy_glGetPerfCounterInfoINTEL;
+PFNGLGETPERFQUERYDATAINTELPROC __glewGetPerfQueryDataINTEL = _glewLazy_glGetPerfQueryDataINTEL;
+PFNGLGETPERFQUERYIDBYNAMEINTELPROC __glewGetPerfQueryIdByNameINTEL = _glewLazy_glGetPerfQueryIdByNameINTEL;
+PFNGLGETPERFQUERYINFOINTELPROC __glewGetPerfQueryInfoINTEL = _glewLazy_glGetPerfQueryInfoINTEL;
+
+PFNGLTEXSCISSORFUNCINTELPROC __glewTexScissorFuncINTEL = _glewLazy_glTexScissorFuncINTEL;
+PFNGLTEXSCISSORINTELPROC __glewTexScissorINTEL = _glewLazy_glTexScissorINTEL;
+
+PFNGLBLENDBARRIERKHRPROC __glewBlendBarrierKHR = _glewLazy_glBlendBarrierKHR;
+
+PFNGLDEBUGMESSAGECALLBACKPROC __glewDebugMessageCallback = _glewLazy_glDebugMessageCallback;
+PFNGLDEBUGMESSAGECONTROLPROC __glewDebugMessageControl = _glewLazy_glDebugMessageControl;
+PFNGLDEBUGMESSAGEINSERTPROC __glewDebugMessageInsert = _glewLazy_glDebugMessageInsert;
+PFNGLGETDEBUGMESSAGELOGPROC __glewGetDebugMessageLog = _glewLazy_glGetDebugMessageLog;
+PFNGLGETOBJECTLABELPROC __glewGetObjectLabel = _glewLazy_glGetObjectLabel;
+PFNGLGETOBJECTPTRLABELPROC __glewGetObjectPtrLabel = _glewLazy_glGetObjectPtrLabel;
+PFNGLOBJECTLABELPROC __glewObjectLabel = _glewLazy_glObjectLabel;
+PFNGLOBJECTPTRLABELPROC __glewObjectPtrLabel = _glewLazy_glObjectPtrLabel;
+PFNGLPOPDEBUGGROUPPROC __glewPopDebugGroup = _glewLazy_glPopDebugGroup;
+PFNGLPUSHDEBUGGROUPPROC __glewPushDebugGroup = _glewLazy_glPushDebugGroup;
+
+PFNGLGETNUNIFORMFVPROC __glewGetnUniformfv = _glewLazy_glGetnUniformfv;
+PFNGLGETNUNIFORMIVPROC __glewGetnUniformiv = _glewLazy_glGetnUniformiv;
+PFNGLGETNUNIFORMUIVPROC __glewGetnUniformuiv = _glewLazy_glGetnUniformuiv;
+PFNGLREADNPIXELSPROC __glewReadnPixels = _glewLazy_glReadnPixels;
+
+PFNGLBUFFERREGIONENABLEDPROC __glewBufferRegionEnabled = _glewLazy_glBufferRegionEnabled;
+PFNGLDELETEBUFFERREGIONPROC __glewDeleteBufferRegion = _glewLazy_glDeleteBufferRegion;
+PFNGLDRAWBUFFERREGIONPROC __glewDrawBufferRegion = _glewLazy_glDrawBufferRegion;
+PFNGLNEWBUFFERREGIONPROC __glewNewBufferRegion = _glewLazy_glNewBufferRegion;
+PFNGLREADBUFFERREGIONPROC __glewReadBufferRegion = _glewLazy_glReadBufferRegion;
+
+PFNGLRESIZEBUFFERSMESAPROC __glewResizeBuffersMESA = _glewLazy_glResizeBuffersMESA;
+
+PFNGLWINDOWPOS2DMESAPROC __glewWindowPos2dMESA = _glewLazy_glWindowPos2dMESA;
+PFNGLWINDOWPOS2DVMESAPROC __glewWindowPos2dvMESA = _glewLazy_glWindowPos2dvMESA;
+PFNGLWINDOWPOS2FMESAPROC __glewWindowPos2fMESA = _glewLazy_glWindowPos2fMESA;
+PFNGLWINDOWPOS2FVMESAPROC __glewWindowPos2fvMESA = _glewLazy_glWindowPos2fvMESA;
+PFNGLWINDOWPOS2IMESAPROC __glewWindowPos2iMESA = _glewLazy_glWindowPos2iMESA;
+PFNGLWINDOWPOS2IVMESAPROC __glewWindowPos2ivMESA = _glewLazy_glWindowPos2ivMESA;
+PFNGLWINDOWPOS2SMESAPROC __glewWindowPos2sMESA = _glewLazy_glWindowPos2sMESA;
+PFNGLWINDOWPOS2SVMESAPROC __glewWindowPos2svMESA = _glewLazy_glWindowPos2svMESA;
+PFNGLWINDOWPOS3DMESAPROC __glewWindowPos3dMESA = _glewLazy_glWindowPos3dMESA;
+PFNGLWINDOWPOS3DVMESAPROC __glewWindowPos3dvMESA = _glewLazy_glWindowPos3dvMESA;
+PFNGLWINDOWPOS3FMESAPROC __glewWindowPos3fMESA = _glewLazy_glWindowPos3fMESA;
+PFNGLWINDOWPOS3FVMESAPROC __glewWindowPos3fvMESA = _glewLazy_glWindowPos3fvMESA;
+PFNGLWINDOWPOS3IMESAPROC __glewWindowPos3iMESA = _glewLazy_glWindowPos3iMESA;
+PFNGLWINDOWPOS3IVMESAPROC __glewWindowPos3ivMESA = _glewLazy_glWindowPos3ivMESA;
+PFNGLWINDOWPOS3SMESAPROC __glewWindowPos3sMESA = _glewLazy_glWindowPos3sMESA;
+PFNGLWINDOWPOS3SVMESAPROC __glewWindowPos3svMESA = _glewLazy_glWindowPos3svMESA;
+PFNGLWINDOWPOS4DMESAPROC __glewWindowPos4dMESA = _glewLazy_glWindowPos4dMESA;
+PFNGLWINDOWPOS4DVMESAPROC __glewWindowPos4dvMESA = _glewLazy_glWindowPos4dvMESA;
+PFNGLWINDOWPOS4FMESAPROC __glewWindowPos4fMESA = _glewLazy_glWindowPos4fMESA;
+PFNGLWINDOWPOS4FVMESAPROC __glewWindowPos4fvMESA = _glewLazy_glWindowPos4fvMESA;
+PFNGLWINDOWPOS4IMESAPROC __glewWindowPos4iMESA = _glewLazy_glWindowPos4iMESA;
+PFNGLWINDOWPOS4IVMESAPROC __glewWindowPos4ivMESA = _glewLazy_glWindowPos4ivMESA;
+PFNGLWINDOWPOS4SMESAPROC __glewWindowPos4sMESA = _glewLazy_glWindowPos4sMESA;
+PFNGLWINDOWPOS4SVMESAPROC __glewWindowPos4svMESA = _glewLazy_glWindowPos4svMESA;
+
+PFNGLBEGINCONDITIONALRENDERNVXPROC __glewBeginConditionalRenderNVX = _glewLazy_glBeginConditionalRenderNVX;
+PFNGLENDCONDITIONALRENDERNVXPROC __glewEndConditionalRenderNVX = _glewLazy_glEndConditionalRenderNVX;
+
+PFNGLMULTIDRAWARRAYSINDIRECTBINDLESSNVPROC __glewMultiDrawArraysIndirectBindlessNV = _glewLazy_glMultiDrawArraysIndirectBindlessNV;
+PFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSNVPROC __glewMultiDrawElementsIndirectBindlessNV = _glewLazy_glMultiDrawElementsIndirectBindlessNV;
+
+PFNGLMULTIDRAWARRAYSINDIRECTBINDLESSCOUNTNVPROC __glewMultiDrawArraysIndirectBindlessCountNV = _glewLazy_glMultiDrawArraysIndirectBindlessCountNV;
+PFNGLMULTIDRAWELEMENTSINDIRECTBINDLESSCOUNTNVPROC __glewMultiDrawElementsIndirectBindlessCountNV = _glewLazy_glMultiDrawElementsIndirectBindlessCountNV;
+
+PFNGLGETIMAGEHANDLENVPROC __glewGetImageHandleNV = _glewLazy_glGetImageHandleNV;
+PFNGLGETTEXTUREHANDLENVPROC __glewGetTextureHandleNV = _glewLazy_glGetTextureHandleNV;
+PFNGLGETTEXTURESAMPLERHANDLENVPROC __glewGetTextureSamplerHandleNV = _glewLazy_glGetTextureSamplerHandleNV;
+PFNGLISIMAGEHANDLERESIDENTNVPROC __glewIsImageHandleResidentNV = _glewLazy_glIsImageHandleResidentNV;
+PFNGLISTEXTUREHANDLERESIDENTNVPROC __glewIsTextureHandleResidentNV = _glewLazy_glIsTextureHandleResidentNV;
+PFNGLMAKEIMAGEHANDLENONRESIDENTNVPROC __glewMakeImageHandleNonResidentNV = _glewLazy_glMakeImageHandleNonResidentNV;
+PFNGLMAKEIMAGEHANDLERESIDENTNVPROC __glewMakeImageHandleResidentNV = _glewLazy_glMakeImageHandleResidentNV;
+PFNGLMAKETEXTUREHANDLENONRESIDENTNVPROC __glewMakeTextureHandleNonResidentNV = _glewLazy_glMakeTextureHandleNonResidentNV;
+PFNGLMAKETEXTUREHANDLERESIDENTNVPROC __glewMakeTextureHandleResidentNV = _glewLazy_glMakeTextureHandleResidentNV;
+PFNGLPROGRAMUNIFORMHANDLEUI64NVPROC __glewProgramUniformHandleui64NV = _glewLazy_glProgramUniformHandleui64NV;
+PFNGLPROGRAMUNIFORMHANDLEUI64VNVPROC __glewProgramUniformHandleui64vNV = _glewLazy_glProgramUniformHandleui64vNV;
+PFNGLUNIFORMHANDLEUI64NVPROC __glewUniformHandleui64NV = _glewLazy_glUniformHandleui64NV;
+PFNGLUNIFORMHANDLEUI64VNVPROC __glewUniformHandleui64vNV = _glewLazy_glUniformHandleui64vNV;
+
+PFNGLBLENDBARRIERNVPROC __glewBlendBarrierNV = _glewLazy_glBlendBarrierNV;
+PFNGLBLENDPARAMETERINVPROC __glewBlendParameteriNV = _glewLazy_glBlendParameteriNV;
+
+PFNGLBEGINCONDITIONALRENDERNVPROC __glewBeginConditionalRenderNV = _glewLazy_glBeginConditionalRenderNV;
+PFNGLENDCONDITIONALRENDERNVPROC __glewEndConditionalRenderNV = _glewLazy_glEndConditionalRenderNV;
+
+PFNGLSUBPIXELPRECISIONBIASNVPROC __glewSubpixelPrecisionBiasNV = _glewLazy_glSubpixelPrecisionBiasNV;
+
+PFNGLCOPYIMAGESUBDATANVPROC __glewCopyImageSubDataNV = _glewLazy_glCopyImageSubDataNV;
+
+PFNGLCLEARDEPTHDNVPROC __glewClearDepthdNV = _glewLazy_glClearDepthdNV;
+PFNGLDEPTHBOUNDSDNVPROC __glewDepthBoundsdNV = _glewLazy_glDepthBoundsdNV;
+PFNGLDEPTHRANGEDNVPROC __glewDepthRangedNV = _glewLazy_glDepthRangedNV;
+
+PFNGLDRAWTEXTURENVPROC __glewDrawTextureNV = _glewLazy_glDrawTextureNV;
+
+PFNGLEVALMAPSNVPROC __glewEvalMapsNV = _glewLazy_glEvalMapsNV;
+PFNGLGETMAPATTRIBPARAMETERFVNVPROC __glewGetMapAttribParameterfvNV = _glewLazy_glGetMapAttribParameterfvNV;
+PFNGLGETMAPATTRIBPARAMETERIVNVPROC __glewGetMapAttribParameterivNV = _glewLazy_glGetMapAttribParameterivNV;
+PFNGLGETMAPCONTROLPOINTSNVPROC __glewGetMapControlPointsNV = _glewLazy_glGetMapControlPointsNV;
+PFNGLGETMAPPARAMETERFVNVPROC __glewGetMapParameterfvNV = _glewLazy_glGetMapParameterfvNV;
+PFNGLGETMAPPARAMETERIVNVPROC __glewGetMapParameterivNV = _glewLazy_glGetMapParameterivNV;
+PFNGLMAPCONTROLPOINTSNVPROC __glewMapControlPointsNV = _glewLazy_glMapControlPointsNV;
+PFNGLMAPPARAMETERFVNVPROC __glewMapParameterfvNV = _glewLazy_glMapParameterfvNV;
+PFNGLMAPPARAMETERIVNVPROC __glewMapParameterivNV = _glewLazy_glMapParameterivNV;
+
+PFNGLGETMULTISAMPLEFVNVPROC __glewGetMultisamplefvNV = _glewLazy_glGetMultisamplefvNV;
+PFNGLSAMPLEMASKINDEXEDNVPROC __glewSampleMaskIndexedNV = _glewLazy_glSampleMaskIndexedNV;
+PFNGLTEXRENDERBUFFERNVPROC __glewTexRenderbufferNV = _glewLazy_glTexRenderbufferNV;
+
+PFNGLDELETEFENCESNVPROC __glewDeleteFencesNV = _glewLazy_glDeleteFencesNV;
+PFNGLFINISHFENCENVPROC __glewFinishFenceNV = _glewLazy_glFinishFenceNV;
+PFNGLGENFENCESNVPROC __glewGenFencesNV = _glewLazy_glGenFencesNV;
+PFNGLGETFENCEIVNVPROC __glewGetFenceivNV = _glewLazy_glGetFenceivNV;
+PFNGLISFENCENVPROC __glewIsFenceNV = _glewLazy_glIsFenceNV;
+PFNGLSETFENCENVPROC __glewSetFenceNV = _glewLazy_glSetFenceNV;
+PFNGLTESTFENCENVPROC __glewTestFenceNV = _glewLazy_glTestFenceNV;
+
+PFNGLFRAGMENTCOVERAGECOLORNVPROC __glewFragmentCoverageColorNV = _glewLazy_glFragmentCoverageColorNV;
+
+PFNGLGETPROGRAMNAMEDPARAMETERDVNVPROC __glewGetProgramNamedParameterdvNV = _glewLazy_glGetProgramNamedParameterdvNV;
+PFNGLGETPROGRAMNAMEDPARAMETERFVNVPROC __glewGetProgramNamedParameterfvNV = _glewLazy_glGetProgramNamedParameterfvNV;
+PFNGLPROGRAMNAMEDPARAMETER4DNVPROC __glewProgramNamedParameter4dNV = _glewLazy_glProgramNamedParameter4dNV;
+PFNGLPROGRAMNAMEDPARAMETER4DVNVPROC __glewProgramNamedParameter4dvNV = _glewLazy_glProgramNamedParameter4dvNV;
+PFNGLPROGRAMNAMEDPARAMETER4FNVPROC __glewProgramNamedParameter4fNV = _glewLazy_glProgramNamedParameter4fNV;
+PFNGLPROGRAMNAMEDPARAMETER4FVNVPROC __glewProgramNamedParameter4fvNV = _glewLazy_glProgramNamedParameter4fvNV;
+
+PFNGLRENDERBUFFERSTORAGEMULTISAMPLECOVERAGENVPROC __glewRenderbufferStorageMultisampleCoverageNV = _glewLazy_glRenderbufferStorageMultisampleCoverageNV;
+
+PFNGLPROGRAMVERTEXLIMITNVPROC __glewProgramVertexLimitNV = _glewLazy_glProgramVertexLimitNV;
+
+PFNGLPROGRAMENVPARAMETERI4INVPROC __glewProgramEnvParameterI4iNV = _glewLazy_glProgramEnvParameterI4iNV;
+PFNGLPROGRAMENVPARAMETERI4IVNVPROC __glewProgramEnvParameterI4ivNV = _glewLazy_glProgramEnvParameterI4ivNV;
+PFNGLPROGRAMENVPARAMETERI4UINVPROC __glewProgramEnvParameterI4uiNV = _glewLazy_glProgramEnvParameterI4uiNV;
+PFNGLPROGRAMENVPARAMETERI4UIVNVPROC __glewProgramEnvParameterI4uivNV = _glewLazy_glProgramEnvParameterI4uivNV;
+PFNGLPROGRAMENVPARAMETERSI4IVNVPROC __glewProgramEnvParametersI4ivNV = _glewLazy_glProgramEnvParametersI4ivNV;
+PFNGLPROGRAMENVPARAMETERSI4UIVNVPROC __glewProgramEnvParametersI4uivNV = _glewLazy_glProgramEnvParametersI4uivNV;
+PFNGLPROGRAMLOCALPARAMETERI4INVPROC __glewProgramLocalParameterI4iNV = _glewLazy_glProgramLocalParameterI4iNV;
+PFNGLPROGRAMLOCALPARAMETERI4IVNVPROC __glewProgramLocalParameterI4ivNV = _glewLazy_glProgramLocalParameterI4ivNV;
+PFNGLPROGRAMLOCALPARAMETERI4UINVPROC __glewProgramLocalParameterI4uiNV = _glewLazy_glProgramLocalParameterI4uiNV;
+PFNGLPROGRAMLOCALPARAMETERI4UIVNVPROC __glewProgramLocalParameterI4uivNV = _glewLazy_glProgramLocalParameterI4uivNV;
+PFNGLPROGRAMLOCALPARAMETERSI4IVNVPROC __glewProgramLocalParametersI4ivNV = _glewLazy_glProgramLocalParametersI4ivNV;
+PFNGLPROGRAMLOCALPARAMETERSI4UIVNVPROC __glewProgramLocalParametersI4uivNV = _glewLazy_glProgramLocalParametersI4uivNV;
+
+PFNGLGETUNIFORMI64VNVPROC __glewGetUniformi64vNV = _glewLazy_glGetUniformi64vNV;
+PFNGLGETUNIFORMUI64VNVPROC __glewGetUniformui64vNV = _glewLazy_glGetUniformui64vNV;
+PFNGLPROGRAMUNIFORM1I64NVPROC __glewProgramUniform1i64NV = _glewLazy_glProgramUniform1i64NV;
+PFNGLPROGRAMUNIFORM1I64VNVPROC __glewProgramUniform1i64vNV = _glewLazy_glProgramUniform1i64vNV;
+PFNGLPROGRAMUNIFORM1UI64NVPROC __glewProgramUniform1ui64NV = _glewLazy_glProgramUniform1ui64NV;
+PFNGLPROGRAMUNIFORM1UI64VNVPROC __glewProgramUniform1ui64vNV = _glewLazy_glProgramUniform1ui64vNV;
+PFNGLPROGRAMUNIFORM2I64NVPROC __glewProgramUniform2i64NV = _glewLazy_glProgramUniform2i64NV;
+PFNGLPROGRAMUNIFORM2I64VNVPROC __glewProgramUniform2i64vNV = _glewLazy_glProgramUniform2i64vNV;
+PFNGLPROGRAMUNIFORM2UI64NVPROC __glewProgramUniform2ui64NV = _glewLazy_glProgramUniform2ui64NV;
+PFNGLPROGRAMUNIFORM2UI64VNVPROC __glewProgramUniform2ui64vNV = _glewLazy_glProgramUniform2ui64vNV;
+PFNGLPROGRAMUNIFORM3I64NVPROC __glewProgramUniform3i64NV = _glewLazy_glProgramUniform3i64NV;
+PFNGLPROGRAMUNIFORM3I64VNVPROC __glewProgramUniform3i64vNV = _glewLazy_glProgramUniform3i64vNV;
+PFNGLPROGRAMUNIFORM3UI64NVPROC __glewProgramUniform3ui64NV = _glewLazy_glProgramUniform3ui64NV;
+PFNGLPROGRAMUNIFORM3UI64VNVPROC __glewProgramUniform3ui64vNV = _glewLazy_glProgramUniform3ui64vNV;
+PFNGLPROGRAMUNIFORM4I64NVPROC __glewProgramUniform4i64NV = _glewLazy_glProgramUniform4i64NV;
+PFNGLPROGRAMUNIFORM4I64VNVPROC __glewProgramUniform4i64vNV = _glewLazy_glProgramUniform4i64vNV;
+PFNGLPROGRAMUNIFORM4UI64NVPROC __glewProgramUniform4ui64NV = _glewLazy_glProgramUniform4ui64NV;
+PFNGLPROGRAMUNIFORM4UI64VNVPROC __glewProgramUniform4ui64vNV = _glewLazy_glProgramUniform4ui64vNV;
+PFNGLUNIFORM1I64NVPROC __glewUniform1i64NV = _glewLazy_glUniform1i64NV;
+PFNGLUNIFORM1I64VNVPROC __glewUniform1i64vNV = _glewLazy_glUniform1i64vNV;
+PFNGLUNIFORM1UI64NVPROC __glewUniform1ui64NV = _glewLazy_glUniform1ui64NV;
+PFNGLUNIFORM1UI64VNVPROC __glewUniform1ui64vNV = _glewLazy_glUniform1ui64vNV;
+PFNGLUNIFORM2I64NVPROC __glewUniform2i64NV = _glewLazy_glUniform2i64NV;
+PFNGLUNIFORM2I64VNVPROC __glewUniform2i64vNV = _glewLazy_glUniform2i64vNV;
+PFNGLUNIFORM2UI64NVPROC __glewUniform2ui64NV = _glewLazy_glUniform2ui64NV;
+PFNGLUNIFORM2UI64VNVPROC __glewUniform2ui64vNV = _glewLazy_glUniform2ui64vNV;
+PFNGLUNIFORM3I64NVPROC __glewUniform3i64NV = _glewLazy_glUniform3i64NV;
+PFNGLUNIFORM3I64VNVPROC __glewUniform3i64vNV = _glewLazy_glUniform3i64vNV;
+PFNGLUNIFORM3UI64NVPROC __glewUniform3ui64NV = _glewLazy_glUniform3ui64NV;
+PFNGLUNIFORM3UI64VNVPROC __glewUniform3ui64vNV = _glewLazy_glUniform3ui64vNV;
+PFNGLUNIFORM4I64NVPROC __glewUniform4i64NV = _glewLazy_glUniform4i64NV;
+PFNGLUNIFORM4I64VNVPROC __glewUniform4i64vNV = _glewLazy_glUniform4i64vNV;
+PFNGLUNIFORM4UI64NVPROC __glewUniform4ui64NV = _glewLazy_glUniform4ui64NV;
+PFNGLUNIFORM4UI64VNVPROC __glewUniform4ui64vNV = _glewLazy_glUniform4ui64vNV;
+
+PFNGLCOLOR3HNVPROC __glewColor3hNV = _glewLazy_glColor3hNV;
+PFNGLCOLOR3HVNVPROC __glewColor3hvNV = _glewLazy_glColor3hvNV;
+PFNGLCOLOR4HNVPROC __glewColor4hNV = _glewLazy_glColor4hNV;
+PFNGLCOLOR4HVNVPROC __glewColor4hvNV = _glewLazy_glColor4hvNV;
+PFNGLFOGCOORDHNVPROC __glewFogCoordhNV = _glewLazy_glFogCoordhNV;
+PFNGLFOGCOORDHVNVPROC __glewFogCoordhvNV = _glewLazy_glFogCoordhvNV;
+PFNGLMULTITEXCOORD1HNVPROC __glewMultiTexCoord1hNV = _glewLazy_glMultiTexCoord1hNV;
+PFNGLMULTITEXCOORD1HVNVPROC __glewMultiTexCoord1hvNV = _glewLazy_glMultiTexCoord1hvNV;
+PFNGLMULTITEXCOORD2HNVPROC __glewMultiTexCoord2hNV = _glewLazy_glMultiTexCoord2hNV;
+PFNGLMULTITEXCOORD2HVNVPROC __glewMultiTexCoord2hvNV = _glewLazy_glMultiTexCoord2hvNV;
+PFNGLMULTITEXCOORD3HNVPROC __glewMultiTexCoord3hNV = _glewLazy_glMultiTexCoord3hNV;
+PFNGLMULTITEXCOORD3HVNVPROC __glewMultiTexCoord3hvNV = _glewLazy_glMultiTexCoord3hvNV;
+PFNGLMULTITEXCOORD4HNVPROC __glewMultiTexCoord4hNV = _glewLazy_glMultiTexCoord4hNV;
+PFNGLMULTITEXCOORD4HVNVPROC __glewMultiTexCoord4hvNV = _glewLazy_glMultiTexCoord4hvNV;
+PFNGLNORMAL3HNVPROC __glewNormal3hNV = _glewLazy_glNormal3hNV;
+PFNGLNORMAL3HVNVPROC __glewNormal3hvNV = _glewLazy_glNormal3hvNV;
+PFNGLSECONDARYCOLOR3HNVPROC __glewSecondaryColor3hNV = _glewLazy_glSecondaryColor3hNV;
+PFNGLSECONDARYCOLOR3HVNVPROC __glewSecondaryColor3hvNV = _glewLazy_glSecondaryColor3hvNV;
+PFNGLTEXCOORD1HNVPROC __glewTexCoord1hNV = _glewLazy_glTexCoord1hNV;
+PFNGLTEXCOORD1HVNVPROC __glewTexCoord1hvNV = _glewLazy_glTexCoord1hvNV;
+PFNGLTEXCOORD2HNVPROC __glewTexCoord2hNV = _glewLazy_glTexCoord2hNV;
+PFNGLTEXCOORD2HVNVPROC __glewTexCoord2hvNV = _glewLazy_glTexCoord2hvNV;
+PFNGLTEXCOORD3HNVPROC __glewTexCoord3hNV = _glewLazy_glTexCoord3hNV;
+PFNGLTEXCOORD3HVNVPROC __glewTexCoord3hvNV = _glewLazy_glTexCoord3hvNV;
+PFNGLTEXCOORD4HNVPROC __glewTexCoord4hNV = _glewLazy_glTexCoord4hNV;
+PFNGLTEXCOORD4HVNVPROC __glewTexCoord4hvNV = _glewLazy_glTexCoord4hvNV;
+PFNGLVERTEX2HNVPROC __glewVertex2hNV = _glewLazy_glVertex2hNV;
+PFNGLVERTEX2HVNVPROC __glewVertex2hvNV = _glewLazy_glVertex2hvNV;
+PFNGLVERTEX3HNVPROC __glewVertex3hNV = _glewLazy_glVertex3hNV;
+PFNGLVERTEX3HVNVPROC __glewVertex3hvNV = _glewLazy_glVertex3hvNV;
+PFNGLVERTEX4HNVPROC __glewVertex4hNV = _glewLazy_glVertex4hNV;
+PFNGLVERTEX4HVNVPROC __glewVertex4hvNV = _glewLazy_glVertex4hvNV;
+PFNGLVERTEXATTRIB1HNVPROC __glewVertexAttrib1hNV = _glewLazy_glVertexAttrib1hNV;
+PFNGLVERTEXATTRIB1HVNVPROC __glewVertexAttrib1hvNV = _glewLazy_glVertexAttrib1hvNV;
+PFNGLVERTEXATTRIB2HNVPROC __glewVertexAttrib2hNV = _glewLazy_glVertexAttrib2hNV;
+PFNGLVERTEXATTRIB2HVNVPROC __glewVertexAttrib2hvNV = _glewLazy_glVertexAttrib2hvNV;
+PFNGLVERTEXATTRIB3HNVPROC __glewVertexAttrib3hNV = _glewLazy_glVertexAttrib3hNV;
+PFNGLVERTEXATTRIB3HVNVPROC __glewVertexAttrib3hvNV = _glewLazy_glVertexAttrib3hvNV;
+PFNGLVERTEXATTRIB4HNVPROC __glewVertexAttrib4hNV = _glewLazy_glVertexAttrib4hNV;
+PFNGLVERTEXATTRIB4HVNVPROC __glewVertexAttrib4hvNV = _glewLazy_glVertexAttrib4hvNV;
+PFNGLVERTEXATTRIBS1HVNVPROC __glewVertexAttribs1hvNV = _glewLazy_glVertexAttribs1hvNV;
+PFNGLVERTEXATTRIBS2HVNVPROC __glewVertexAttribs2hvNV = _glewLazy_glVertexAttribs2hvNV;
+PFNGLVERTEXATTRIBS3HVNVPROC __glewVertexAttribs3hvNV = _glewLazy_glVertexAttribs3hvNV;
+PFNGLVERTEXATTRIBS4HVNVPROC __glewVertexAttribs4hvNV = _glewLazy_glVertexAttribs4hvNV;
+PFNGLVERTEXWEIGHTHNVPROC __glewVertexWeighthNV = _glewLazy_glVertexWeighthNV;
+PFNGLVERTEXWEIGHTHVNVPROC __glewVertexWeighthvNV = _glewLazy_glVertexWeighthvNV;
+
+PFNGLGETINTERNALFORMATSAMPLEIVNVPROC __glewGetInternalformatSampleivNV = _glewLazy_glGetInternalformatSampleivNV;
+
+PFNGLBEGINOCCLUSIONQUERYNVPROC __glewBeginOcclusionQueryNV = _glewLazy_glBeginOcclusionQueryNV;
+PFNGLDELETEOCCLUSIONQUERIESNVPROC __glewDeleteOcclusionQueriesNV = _glewLazy_glDeleteOcclusionQueriesNV;
+PFNGLENDOCCLUSIONQUERYNVPROC __glewEndOcclusionQueryNV = _glewLazy_glEndOcclusionQueryNV;
+PFNGLGENOCCLUSIONQUERIESNVPROC __glewGenOcclusionQueriesNV = _glewLazy_glGenOcclusionQueriesNV;
+PFNGLGETOCCLUSIONQUERYIVNVPROC __glewGetOcclusionQueryivNV = _glewLazy_glGetOcclusionQueryivNV;
+PFNGLGETOCCLUSIONQUERYUIVNVPROC __glewGetOcclusionQueryuivNV = _glewLazy_glGetOcclusionQueryuivNV;
+PFNGLISOCCLUSIONQUERYNVPROC __glewIsOcclusionQueryNV = _glewLazy_glIsOcclusionQueryNV;
+
+PFNGLPROGRAMBUFFERPARAMETERSIIVNVPROC __glewProgramBufferParametersIivNV = _glewLazy_glProgramBufferParametersIivNV;
+PFNGLPROGRAMBUFFERPARAMETERSIUIVNVPROC __glewProgramBufferParametersIuivNV = _glewLazy_glProgramBufferParametersIuivNV;
+PFNGLPROGRAMBUFFERPARAMETERSFVNVPROC __glewProgramBufferParametersfvNV = _glewLazy_glProgramBufferParametersfvNV;
+
+PFNGLCOPYPATHNVPROC __glewCopyPathNV = _glewLazy_glCopyPathNV;
+PFNGLCOVERFILLPATHINSTANCEDNVPROC __glewCoverFillPathInstancedNV = _glewLazy_glCoverFillPathInstancedNV;
+PFNGLCOVERFILLPATHNVPROC __glewCoverFillPathNV = _glewLazy_glCoverFillPathNV;
+PFNGLCOVERSTROKEPATHINSTANCEDNVPROC __glewCoverStrokePathInstancedNV = _glewLazy_glCoverStrokePathInstancedNV;
+PFNGLCOVERSTROKEPATHNVPROC __glewCoverStrokePathNV = _glewLazy_glCoverStrokePathNV;
+PFNGLDELETEPATHSNVPROC __glewDeletePathsNV = _glewLazy_glDeletePathsNV;
+PFNGLGENPATHSNVPROC __glewGenPathsNV = _glewLazy_glGenPathsNV;
+PFNGLGETPATHCOLORGENFVNVPROC __glewGetPathColorGenfvNV = _glewLazy_glGetPathColorGenfvNV;
+PFNGLGETPATHCOLORGENIVNVPROC __glewGetPathColorGenivNV = _glewLazy_glGetPathColorGenivNV;
+PFNGLGETPATHCOMMANDSNVPROC __glewGetPathCommandsNV = _glewLazy_glGetPathCommandsNV;
+PFNGLGETPATHCOORDSNVPROC __glewGetPathCoordsNV = _glewLazy_glGetPathCoordsNV;
+PFNGLGETPATHDASHARRAYNVPROC __glewGetPathDashArrayNV = _glewLazy_glGetPathDashArrayNV;
+PFNGLGETPATHLENGTHNVPROC __glewGetPathLengthNV = _glewLazy_glGetPathLengthNV;
+PFNGLGETPATHMETRICRANGENVPROC __glewGetPathMetricRangeNV = _glewLazy_glGetPathMetricRangeNV;
+PFNGLGETPATHMETRICSNVPROC __glewGetPathMetricsNV = _glewLazy_glGetPathMetricsNV;
+PFNGLGETPATHPARAMETERFVNVPROC __glewGetPathParameterfvNV = _glewLazy_glGetPathParameterfvNV;
+PFNGLGETPATHPARAMETERIVNVPROC __glewGetPathParameterivNV = _glewLazy_glGetPathParameterivNV;
+PFNGLGETPATHSPACINGNVPROC __glewGetPathSpacingNV = _glewLazy_glGetPathSpacingNV;
+PFNGLGETPATHTEXGENFVNVPROC __glewGetPathTexGenfvNV = _glewLazy_glGetPathTexGenfvNV;
+PFNGLGETPATHTEXGENIVNVPROC __glewGetPathTexGenivNV = _glewLazy_glGetPathTexGenivNV;
+PFNGLGETPROGRAMRESOURCEFVNVPROC __glewGetProgramResourcefvNV = _glewLazy_glGetProgramResourcefvNV;
+PFNGLINTERPOLATEPATHSNVPROC __glewInterpolatePathsNV = _glewLazy_glInterpolatePathsNV;
+PFNGLISPATHNVPROC __glewIsPathNV = _glewLazy_glIsPathNV;
+PFNGLISPOINTINFILLPATHNVPROC __glewIsPointInFillPathNV = _glewLazy_glIsPointInFillPathNV;
+PFNGLISPOINTINSTROKEPATHNVPROC __glewIsPointInStrokePathNV = _glewLazy_glIsPointInStrokePathNV;
+PFNGLMATRIXLOAD3X2FNVPROC __glewMatrixLoad3x2fNV = _glewLazy_glMatrixLoad3x2fNV;
+PFNGLMATRIXLOAD3X3FNVPROC __glewMatrixLoad3x3fNV = _glewLazy_glMatrixLoad3x3fNV;
+PFNGLMATRIXLOADTRANSPOSE3X3FNVPROC __glewMatrixLoadTranspose3x3fNV = _glewLazy_glMatrixLoadTranspose3x3fNV;
+PFNGLMATRIXMULT3X2FNVPROC __glewMatrixMult3x2fNV = _glewLazy_glMatrixMult3x2fNV;
+PFNGLMATRIXMULT3X3FNVPROC __glewMatrixMult3x3fNV = _glewLazy_glMatrixMult3x3fNV;
+PFNGLMATRIXMULTTRANSPOSE3X3FNVPROC __glewMatrixMultTranspose3x3fNV = _glewLazy_glMatrixMultTranspose3x3fNV;
+PFNGLPATHCOLORGENNVPROC __glewPathColorGenNV = _glewLazy_glPathColorGenNV;
+PFNGLPATHCOMMANDSNVPROC __glewPathCommandsNV = _glewLazy_glPathCommandsNV;
+PFNGLPATHCOORDSNVPROC __glewPathCoordsNV = _glewLazy_glPathCoordsNV;
+PFNGLPATHCOVERDEPTHFUNCNVPROC __glewPathCoverDepthFuncNV = _glewLazy_glPathCoverDepthFuncNV;
+PFNGLPATHDASHARRAYNVPROC __glewPathDashArrayNV = _glewLazy_glPathDashArrayNV;
+PFNGLPATHFOGGENNVPROC __glewPathFogGenNV = _glewLazy_glPathFogGenNV;
+PFNGLPATHGLYPHINDEXARRAYNVPROC __glewPathGlyphIndexArrayNV = _glewLazy_glPathGlyphIndexArrayNV;
+PFNGLPATHGLYPHINDEXRANGENVPROC __glewPathGlyphIndexRangeNV = _glewLazy_glPathGlyphIndexRangeNV;
+PFNGLPATHGLYPHRANGENVPROC __glewPathGlyphRangeNV = _glewLazy_glPathGlyphRangeNV;
+PFNGLPATHGLYPHSNVPROC __glewPathGlyphsNV = _glewLazy_glPathGlyphsNV;
+PFNGLPATHMEMORYGLYPHINDEXARRAYNVPROC __glewPathMemoryGlyphIndexArrayNV = _glewLazy_glPathMemoryGlyphIndexArrayNV;
+PFNGLPATHPARAMETERFNVPROC __glewPathParameterfNV = _glewLazy_glPathParameterfNV;
+PFNGLPATHPARAMETERFVNVPROC __glewPathParameterfvNV = _glewLazy_glPathParameterfvNV;
+PFNGLPATHPARAMETERINVPROC __glewPathParameteriNV = _glewLazy_glPathParameteriNV;
+PFNGLPATHPARAMETERIVNVPROC __glewPathParameterivNV = _glewLazy_glPathParameterivNV;
+PFNGLPATHSTENCILDEPTHOFFSETNVPROC __glewPathStencilDepthOffsetNV = _glewLazy_glPathStencilDepthOffsetNV;
+PFNGLPATHSTENCILFUNCNVPROC __glewPathStencilFuncNV = _glewLazy_glPathStencilFuncNV;
+PFNGLPATHSTRINGNVPROC __glewPathStringNV = _glewLazy_glPathStringNV;
+PFNGLPATHSUBCOMMANDSNVPROC __glewPathSubCommandsNV = _glewLazy_glPathSubCommandsNV;
+PFNGLPATHSUBCOORDSNVPROC __glewPathSubCoordsNV = _glewLazy_glPathSubCoordsNV;
+PFNGLPATHTEXGENNVPROC __glewPathTexGenNV = _glewLazy_glPathTexGenNV;
+PFNGLPOINTALONGPATHNVPROC __glewPointAlongPathNV = _glewLazy_glPointAlongPathNV;
+PFNGLPROGRAMPATHFRAGMENTINPUTGENNVPROC __glewProgramPathFragmentInputGenNV = _glewLazy_glProgramPathFragmentInputGenNV;
+PFNGLSTENCILFILLPATHINSTANCEDNVPROC __glewStencilFillPathInstancedNV = _glewLazy_glStencilFillPathInstancedNV;
+PFNGLSTENCILFILLPATHNVPROC __glewStencilFillPathNV = _glewLazy_glStencilFillPathNV;
+PFNGLSTENCILSTROKEPATHINSTANCEDNVPROC __glewStencilStrokePathInstancedNV = _glewLazy_glStencilStrokePathInstancedNV;
+PFNGLSTENCILSTROKEPATHNVPROC __glewStencilStrokePathNV = _glewLazy_glStencilStrokePathNV;
+PFNGLSTENCILTHENCOVERFILLPATHINSTANCEDNVPROC __glewStencilThenCoverFillPathInstancedNV = _glewLazy_glStencilThenCoverFillPathInstancedNV;
+PFNGLSTENCILTHENCOVERFILLPATHNVPROC __glewStencilThenCoverFillPathNV = _glewLazy_glStencilThenCoverFillPathNV;
+PFNGLSTENCILTHENCOVERSTROKEPATHINSTANCEDNVPROC __glewStencilThenCoverStrokePathInstancedNV = _glewLazy_glStencilThenCoverStrokePathInstancedNV;
+PFNGLSTENCILTHENCOVERSTROKEPATHNVPROC __glewStencilThenCoverStrokePathNV = _glewLazy_glStencilThenCoverStrokePathNV;
+PFNGLTRANSFORMPATHNVPROC __glewTransformPathNV = _glewLazy_glTransformPathNV;
+PFNGLWEIGHTPATHSNVPROC __glewWeightPathsNV = _glewLazy_glWeightPathsNV;
+
+PFNGLFLUSHPIXELDATARANGENVPROC __glewFlushPixelDataRangeNV = _glewLazy_glFlushPixelDataRangeNV;
+PFNGLPIXELDATARANGENVPROC __glewPixelDataRangeNV = _glewLazy_glPixelDataRangeNV;
+
+PFNGLPOINTPARAMETERINVPROC __glewPointParameteriNV = _glewLazy_glPointParameteriNV;
+PFNGLPOINTPARAMETERIVNVPROC __glewPointParameterivNV = _glewLazy_glPointParameterivNV;
+
+PFNGLGETVIDEOI64VNVPROC __glewGetVideoi64vNV = _glewLazy_glGetVideoi64vNV;
+PFNGLGETVIDEOIVNVPROC __glewGetVideoivNV = _glewLazy_glGetVideoivNV;
+PFNGLGETVIDEOUI64VNVPROC __glewGetVideoui64vNV = _glewLazy_glGetVideoui64vNV;
+PFNGLGETVIDEOUIVNVPROC __glewGetVideouivNV = _glewLazy_glGetVideouivNV;
+PFNGLPRESENTFRAMEDUALFILLNVPROC __glewPresentFrameDualFillNV = _glewLazy_glPresentFrameDualFillNV;
+PFNGLPRESENTFRAMEKEYEDNVPROC __glewPresentFrameKeyedNV = _glewLazy_glPresentFrameKeyedNV;
+
+PFNGLPRIMITIVERESTARTINDEXNVPROC __glewPrimitiveRestartIndexNV = _glewLazy_glPrimitiveRestartIndexNV;
+PFNGLPRIMITIVERESTARTNVPROC __glewPrimitiveRestartNV = _glewLazy_glPrimitiveRestartNV;
+
+PFNGLCOMBINERINPUTNVPROC __glewCombinerInputNV = _glewLazy_glCombinerInputNV;
+PFNGLCOMBINEROUTPUTNVPROC __glewCombinerOutputNV = _glewLazy_glCombinerOutputNV;
+PFNGLCOMBINERPARAMETERFNVPROC __glewCombinerParameterfNV = _glewLazy_glCombinerParameterfNV;
+PFNGLCOMBINERPARAMETERFVNVPROC __glewCombinerParameterfvNV = _glewLazy_glCombinerParameterfvNV;
+PFNGLCOMBINERPARAMETERINVPROC __glewCombinerParameteriNV = _glewLazy_glCombinerParameteriNV;
+PFNGLCOMBINERPARAMETERIVNVPROC __glewCombinerParameterivNV = _glewLazy_glCombinerParameterivNV;
+PFNGLFINALCOMBINERINPUTNVPROC __glewFinalCombinerInputNV = _glewLazy_glFinalCombinerInputNV;
+PFNGLGETCOMBINERINPUTPARAMETERFVNVPROC __glewGetCombinerInputParameterfvNV = _glewLazy_glGetCombinerInputParameterfvNV;
+PFNGLGETCOMBINERINPUTPARAMETERIVNVPROC __glewGetCombinerInputParameterivNV = _glewLazy_glGetCombinerInputParameterivNV;
+PFNGLGETCOMBINEROUTPUTPARAMETERFVNVPROC __glewGetCombinerOutputParameterfvNV = _glewLazy_glGetCombinerOutputParameterfvNV;
+PFNGLGETCOMBINEROUTPUTPARAMETERIVNVPROC __glewGetCombinerOutputParameterivNV = _glewLazy_glGetCombinerOutputParameterivNV;
+PFNGLGETFINALCOMBINERINPUTPARAMETERFVNVPROC __glewGetFinalCombinerInputParameterfvNV = _glewLazy_glGetFinalCombinerInputParameterfvNV;
+PFNGLGETFINALCOMBINERINPUTPARAMETERIVNVPROC __glewGetFinalCombinerInputParameterivNV = _glewLazy_glGetFinalCombinerInputParameterivNV;
+
+PFNGLCOMBINERSTAGEPARAMETERFVNVPROC __glewCombinerStageParameterfvNV = _glewLazy_glCombinerStageParameterfvNV;
+PFNGLGETCOMBINERSTAGEPARAMETERFVNVPROC __glewGetCombinerStageParameterfvNV = _glewLazy_glGetCombinerStageParameterfvNV;
+
+PFNGLFRAMEBUFFERSAMPLELOCATIONSFVNVPROC __glewFramebufferSampleLocationsfvNV = _glewLazy_glFramebufferSampleLocationsfvNV;
+PFNGLNAMEDFRAMEBUFFERSAMPLELOCATIONSFVNVPROC __glewNamedFramebufferSampleLocationsfvNV = _glewLazy_glNamedFramebufferSampleLocationsfvNV;
+
+PFNGLGETBUFFERPARAMETERUI64VNVPROC __glewGetBufferParameterui64vNV = _glewLazy_glGetBufferParameterui64vNV;
+PFNGLGETINTEGERUI64VNVPROC __glewGetIntegerui64vNV = _glewLazy_glGetIntegerui64vNV;
+PFNGLGETNAMEDBUFFERPARAMETERUI64VNVPROC __glewGetNamedBufferParameterui64vNV = _glewLazy_glGetNamedBufferParameterui64vNV;
+PFNGLISBUFFERRESIDENTNVPROC __glewIsBufferResidentNV = _glewLazy_glIsBufferResidentNV;
+PFNGLISNAMEDBUFFERRESIDENTNVPROC __glewIsNamedBufferResidentNV = _glewLazy_glIsNamedBufferResidentNV;
+PFNGLMAKEBUFFERNONRESIDENTNVPROC __glewMakeBufferNonResidentNV = _glewLazy_glMakeBufferNonResidentNV;
+PFNGLMAKEBUFFERRESIDENTNVPROC __glewMakeBufferResidentNV = _glewLazy_glMakeBufferResidentNV;
+PFNGLMAKENAMEDBUFFERNONRESIDENTNVPROC __glewMakeNamedBufferNonResidentNV = _glewLazy_glMakeNamedBufferNonResidentNV;
+PFNGLMAKENAMEDBUFFERRESIDENTNVPROC __glewMakeNamedBufferResidentNV = _glewLazy_glMakeNamedBufferResidentNV;
+PFNGLPROGRAMUNIFORMUI64NVPROC __glewProgramUniformui64NV = _glewLazy_glProgramUniformui64NV;
+PFNGLPROGRAMUNIFORMUI64VNVPROC __glewProgramUniformui64vNV = _glewLazy_glProgramUniformui64vNV;
+PFNGLUNIFORMUI64NVPROC __glewUniformui64NV = _glewLazy_glUniformui64NV;
+PFNGLUNIFORMUI64VNVPROC __glewUniformui64vNV = _glewLazy_glUniformui64vNV;
+
+PFNGLTEXTUREBARRIERNVPROC __glewTextureBarrierNV = _glewLazy_glTextureBarrierNV;
+
+PFNGLTEXIMAGE2DMULTISAMPLECOVERAGENVPROC __glewTexImage2DMultisampleCoverageNV = _glewLazy_glTexImage2DMultisampleCoverageNV;
+PFNGLTEXIMAGE3DMULTISAMPLECOVERAGENVPROC __glewTexImage3DMultisampleCoverageNV = _glewLazy_glTexImage3DMultisampleCoverageNV;
+PFNGLTEXTUREIMAGE2DMULTISAMPLECOVERAGENVPROC __glewTextureImage2DMultisampleCoverageNV = _glewLazy_glTextureImage2DMultisampleCoverageNV;
+PFNGLTEXTUREIMAGE2DMULTISAMPLENVPROC __glewTextureImage2DMultisampleNV = _glewLazy_glTextureImage2DMultisampleNV;
+PFNGLTEXTUREIMAGE3DMULTISAMPLECOVERAGENVPROC __glewTextureImage3DMultisampleCoverageNV = _glewLazy_glTextureImage3DMultisampleCoverageNV;
+PFNGLTEXTUREIMAGE3DMULTISAMPLENVPROC __glewTextureImage3DMultisampleNV = _glewLazy_glTextureImage3DMultisampleNV;
+
+PFNGLACTIVEVARYINGNVPROC __glewActiveVaryingNV = _glewLazy_glActiveVaryingNV;
+PFNGLBEGINTRANSFORMFEEDBACKNVPROC __glewBeginTransformFeedbackNV = _glewLazy_glBeginTransformFeedbackNV;
+PFNGLBINDBUFFERBASENVPROC __glewBindBufferBaseNV = _glewLazy_glBindBufferBaseNV;
+PFNGLBINDBUFFEROFFSETNVPROC __glewBindBufferOffsetNV = _glewLazy_glBindBufferOffsetNV;
+PFNGLBINDBUFFERRANGENVPROC __glewBindBufferRangeNV = _glewLazy_glBindBufferRangeNV;
+PFNGLENDTRANSFORMFEEDBACKNVPROC __glewEndTransformFeedbackNV = _glewLazy_glEndTransformFeedbackNV;
+PFNGLGETACTIVEVARYINGNVPROC __glewGetActiveVaryingNV = _glewLazy_glGetActiveVaryingNV;
+PFNGLGETTRANSFORMFEEDBACKVARYINGNVPROC __glewGetTransformFeedbackVaryingNV = _glewLazy_glGetTransformFeedbackVaryingNV;
+PFNGLGETVARYINGLOCATIONNVPROC __glewGetVaryingLocationNV = _glewLazy_glGetVaryingLocationNV;
+PFNGLTRANSFORMFEEDBACKATTRIBSNVPROC __glewTransformFeedbackAttribsNV = _glewLazy_glTransformFeedbackAttribsNV;
+PFNGLTRANSFORMFEEDBACKVARYINGSNVPROC __glewTransformFeedbackVaryingsNV = _glewLazy_glTransformFeedbackVaryingsNV;
+
+PFNGLBINDTRANSFORMFEEDBACKNVPROC __glewBindTransformFeedbackNV = _glewLazy_glBindTransformFeedbackNV;
+PFNGLDELETETRANSFORMFEEDBACKSNVPROC __glewDeleteTransformFeedbacksNV = _glewLazy_glDeleteTransformFeedbacksNV;
+PFNGLDRAWTRANSFORMFEEDBACKNVPROC __glewDrawTransformFeedbackNV = _glewLazy_glDrawTransformFeedbackNV;
+PFNGLGENTRANSFORMFEEDBACKSNVPROC __glewGenTransformFeedbacksNV = _glewLazy_glGenTransformFeedbacksNV;
+PFNGLISTRANSFORMFEEDBACKNVPROC __glewIsTransformFeedbackNV = _glewLazy_glIsTransformFeedbackNV;
+PFNGLPAUSETRANSFORMFEEDBACKNVPROC __glewPauseTransformFeedbackNV = _glewLazy_glPauseTransformFeedbackNV;
+PFNGLRESUMETRANSFORMFEEDBACKNVPROC __glewResumeTransformFeedbackNV = _glewLazy_glResumeTransformFeedbackNV;
+
+PFNGLVDPAUFININVPROC __glewVDPAUFiniNV = _glewLazy_glVDPAUFiniNV;
+PFNGLVDPAUGETSURFACEIVNVPROC __glewVDPAUGetSurfaceivNV = _glewLazy_glVDPAUGetSurfaceivNV;
+PFNGLVDPAUINITNVPROC __glewVDPAUInitNV = _glewLazy_glVDPAUInitNV;
+PFNGLVDPAUISSURFACENVPROC __glewVDPAUIsSurfaceNV = _glewLazy_glVDPAUIsSurfaceNV;
+PFNGLVDPAUMAPSURFACESNVPROC __glewVDPAUMapSurfacesNV = _glewLazy_glVDPAUMapSurfacesNV;
+PFNGLVDPAUREGISTEROUTPUTSURFACENVPROC __glewVDPAURegisterOutputSurfaceNV = _glewLazy_glVDPAURegisterOutputSurfaceNV;
+PFNGLVDPAUREGISTERVIDEOSURFACENVPROC __glewVDPAURegisterVideoSurfaceNV = _glewLazy_glVDPAURegisterVideoSurfaceNV;
+PFNGLVDPAUSURFACEACCESSNVPROC __glewVDPAUSurfaceAccessNV = _glewLazy_glVDPAUSurfaceAccessNV;
+PFNGLVDPAUUNMAPSURFACESNVPROC __glewVDPAUUnmapSurfacesNV = _glewLazy_glVDPAUUnmapSurfacesNV;
+PFNGLVDPAUUNREGISTERSURFACENVPROC __glewVDPAUUnregisterSurfaceNV = _glewLazy_glVDPAUUnregisterSurfaceNV;
+
+PFNGLFLUSHVERTEXARRAYRANGENVPROC __glewFlushVertexArrayRangeNV = _glewLazy_glFlushVertexArrayRangeNV;
+PFNGLVERTEXARRAYRANGENVPROC __glewVertexArrayRangeNV = _glewLazy_glVertexArrayRangeNV;
+
+PFNGLGETVERTEXATTRIBLI64VNVPROC __glewGetVertexAttribLi64vNV = _glewLazy_glGetVertexAttribLi64vNV;
+PFNGLGETVERTEXATTRIBLUI64VNVPROC __glewGetVertexAttribLui64vNV = _glewLazy_glGetVertexAttribLui64vNV;
+PFNGLVERTEXATTRIBL1I64NVPROC __glewVertexAttribL1i64NV = _glewLazy_glVertexAttribL1i64NV;
+PFNGLVERTEXATTRIBL1I64VNVPROC __glewVertexAttribL1i64vNV = _glewLazy_glVertexAttribL1i64vNV;
+PFNGLVERTEXATTRIBL1UI64NVPROC __glewVertexAttribL1ui64NV = _glewLazy_glVertexAttribL1ui64NV;
+PFNGLVERTEXATTRIBL1UI64VNVPROC __glewVertexAttribL1ui64vNV = _glewLazy_glVertexAttribL1ui64vNV;
+PFNGLVERTEXATTRIBL2I64NVPROC __glewVertexAttribL2i64NV = _glewLazy_glVertexAttribL2i64NV;
+PFNGLVERTEXATTRIBL2I64VNVPROC __glewVertexAttribL2i64vNV = _glewLazy_glVertexAttribL2i64vNV;
+PFNGLVERTEXATTRIBL2UI64NVPROC __glewVertexAttribL2ui64NV = _glewLazy_glVertexAttribL2ui64NV;
+PFNGLVERTEXATTRIBL2UI64VNVPROC __glewVertexAttribL2ui64vNV = _glewLazy_glVertexAttribL2ui64vNV;
+PFNGLVERTEXATTRIBL3I64NVPROC __glewVertexAttribL3i64NV = _glewLazy_glVertexAttribL3i64NV;
+PFNGLVERTEXATTRIBL3I64VNVPROC __glewVertexAttribL3i64vNV = _glewLazy_glVertexAttribL3i64vNV;
+PFNGLVERTEXATTRIBL3UI64NVPROC __glewVertexAttribL3ui64NV = _glewLazy_glVertexAttribL3ui64NV;
+PFNGLVERTEXATTRIBL3UI64VNVPROC __glewVertexAttribL3ui64vNV = _glewLazy_glVertexAttribL3ui64vNV;
+PFNGLVERTEXATTRIBL4I64NVPROC __glewVertexAttribL4i64NV = _glewLazy_glVertexAttribL4i64NV;
+PFNGLVERTEXATTRIBL4I64VNVPROC __glewVertexAttribL4i64vNV = _glewLazy_glVertexAttribL4i64vNV;
+PFNGLVERTEXATTRIBL4UI64NVPROC __glewVertexAttribL4ui64NV = _glewLazy_glVertexAttribL4ui64NV;
+PFNGLVERTEXATTRIBL4UI64VNVPROC __glewVertexAttribL4ui64vNV = _glewLazy_glVertexAttribL4ui64vNV;
+PFNGLVERTEXATTRIBLFORMATNVPROC __glewVertexAttribLFormatNV = _glewLazy_glVertexAttribLFormatNV;
+
+PFNGLBUFFERADDRESSRANGENVPROC __glewBufferAddressRangeNV = _glewLazy_glBufferAddressRangeNV;
+PFNGLCOLORFORMATNVPROC __glewColorFormatNV = _glewLazy_glColorFormatNV;
+PFNGLEDGEFLAGFORMATNVPROC __glewEdgeFlagFormatNV = _glewLazy_glEdgeFlagFormatNV;
+PFNGLFOGCOORDFORMATNVPROC __glewFogCoordFormatNV = _glewLazy_glFogCoordFormatNV;
+PFNGLGETINTEGERUI64I_VNVPROC __glewGetIntegerui64i_vNV = _glewLazy_glGetIntegerui64i_vNV;
+PFNGLINDEXFORMATNVPROC __glewIndexFormatNV = _glewLazy_glIndexFormatNV;
+PFNGLNORMALFORMATNVPROC __glewNormalFormatNV = _glewLazy_glNormalFormatNV;
+PFNGLSECONDARYCOLORFORMATNVPROC __glewSecondaryColorFormatNV = _glewLazy_glSecondaryColorFormatNV;
+PFNGLTEXCOORDFORMATNVPROC __glewTexCoordFormatNV = _glewLazy_glTexCoordFormatNV;
+PFNGLVERTEXATTRIBFORMATNVPROC __glewVertexAttribFormatNV = _glewLazy_glVertexAttribFormatNV;
+PFNGLVERTEXATTRIBIFORMATNVPROC __glewVertexAttribIFormatNV = _glewLazy_glVertexAttribIFormatNV;
+PFNGLVERTEXFORMATNVPROC __glewVertexFormatNV = _glewLazy_glVertexFormatNV;
+
+PFNGLAREPROGRAMSRESIDENTNVPROC __glewAreProgramsResidentNV = _glewLazy_glAreProgramsResidentNV;
+PFNGLBINDPROGRAMNVPROC __glewBindProgramNV = _glewLazy_glBindProgramNV;
+PFNGLDELETEPROGRAMSNVPROC __glewDeleteProgramsNV = _glewLazy_glDeleteProgramsNV;
+PFNGLEXECUTEPROGRAMNVPROC __glewExecuteProgramNV = _glewLazy_glExecuteProgramNV;
+PFNGLGENPROGRAMSNVPROC __glewGenProgramsNV = _glewLazy_glGenProgramsNV;
+PFNGLGETPROGRAMPARAMETERDVNVPROC __glewGetProgramParameterdvNV = _glewLazy_glGetProgramParameterdvNV;
+PFNGLGETPROGRAMPARAMETERFVNVPROC __glewGetProgramParameterfvNV = _glewLazy_glGetProgramParameterfvNV;
+PFNGLGETPROGRAMSTRINGNVPROC __glewGetProgramStringNV = _glewLazy_glGetProgramStringNV;
+PFNGLGETPROGRAMIVNVPROC __glewGetProgramivNV = _glewLazy_glGetProgramivNV;
+PFNGLGETTRACKMATRIXIVNVPROC __glewGetTrackMatrixivNV = _glewLazy_glGetTrackMatrixivNV;
+PFNGLGETVERTEXATTRIBPOINTERVNVPROC __glewGetVertexAttribPointervNV = _glewLazy_glGetVertexAttribPointervNV;
+PFNGLGETVERTEXATTRIBDVNVPROC __glewGetVertexAttribdvNV = _glewLazy_glGetVertexAttribdvNV;
+PFNGLGETVERTEXATTRIBFVNVPROC __glewGetVertexAttribfvNV = _glewLazy_glGetVertexAttribfvNV;
+PFNGLGETVERTEXATTRIBIVNVPROC __glewGetVertexAttribivNV = _glewLazy_glGetVertexAttribivNV;
+PFNGLISPROGRAMNVPROC __glewIsProgramNV = _glewLazy_glIsProgramNV;
+PFNGLLOADPROGRAMNVPROC __glewLoadProgramNV = _glewLazy_glLoadProgramNV;
+PFNGLPROGRAMPARAMETER4DNVPROC __glewProgramParameter4dNV = _glewLazy_glProgramParameter4dNV;
+PFNGLPROGRAMPARAMETER4DVNVPROC __glewProgramParameter4dvNV = _glewLazy_glProgramParameter4dvNV;
+PFNGLPROGRAMPARAMETER4FNVPROC __glewProgramParameter4fNV = _glewLazy_glProgramParameter4fNV;
+PFNGLPROGRAMPARAMETER4FVNVPROC __glewProgramParameter4fvNV = _glewLazy_glProgramParameter4fvNV;
+PFNGLPROGRAMPARAMETERS4DVNVPROC __glewProgramParameters4dvNV = _glewLazy_glProgramParameters4dvNV;
+PFNGLPROGRAMPARAMETERS4FVNVPROC __glewProgramParameters4fvNV = _glewLazy_glProgramParameters4fvNV;
+PFNGLREQUESTRESIDENTPROGRAMSNVPROC __glewRequestResidentProgramsNV = _glewLazy_glRequestResidentProgramsNV;
+PFNGLTRACKMATRIXNVPROC __glewTrackMatrixNV = _glewLazy_glTrackMatrixNV;
+PFNGLVERTEXATTRIB1DNVPROC __glewVertexAttrib1dNV = _glewLazy_glVertexAttrib1dNV;
+PFNGLVERTEXATTRIB1DVNVPROC __glewVertexAttrib1dvNV = _glewLazy_glVertexAttrib1dvNV;
+PFNGLVERTEXATTRIB1FNVPROC __glewVertexAttrib1fNV = _glewLazy_glVertexAttrib1fNV;
+PFNGLVERTEXATTRIB1FVNVPROC __glewVertexAttrib1fvNV = _glewLazy_glVertexAttrib1fvNV;
+PFNGLVERTEXATTRIB1SNVPROC __glewVertexAttrib1sNV = _glewLazy_glVertexAttrib1sNV;
+PFNGLVERTEXATTRIB1SVNVPROC __glewVertexAttrib1svNV = _glewLazy_glVertexAttrib1svNV;
+PFNGLVERTEXATTRIB2DNVPROC __glewVertexAttrib2dNV = _glewLazy_glVertexAttrib2dNV;
+PFNGLVERTEXATTRIB2DVNVPROC __glewVertexAttrib2dvNV = _glewLazy_glVertexAttrib2dvNV;
+PFNGLVERTEXATTRIB2FNVPROC __glewVertexAttrib2fNV = _glewLazy_glVertexAttrib2fNV;
+PFNGLVERTEXATTRIB2FVNVPROC __glewVertexAttrib2fvNV = _glewLazy_glVertexAttrib2fvNV;
+PFNGLVERTEXATTRIB2SNVPROC __glewVertexAttrib2sNV = _glewLazy_glVertexAttrib2sNV;
+PFNGLVERTEXATTRIB2SVNVPROC __glewVertexAttrib2svNV = _glewLazy_glVertexAttrib2svNV;
+PFNGLVERTEXATTRIB3DNVPROC __glewVertexAttrib3dNV = _glewLazy_glVertexAttrib3dNV;
+PFNGLVERTEXATTRIB3DVNVPROC __glewVertexAttrib3dvNV = _glewLazy_glVertexAttrib3dvNV;
+PFNGLVERTEXATTRIB3FNVPROC __glewVertexAttrib3fNV = _glewLazy_glVertexAttrib3fNV;
+PFNGLVERTEXATTRIB3FVNVPROC __glewVertexAttrib3fvNV = _glewLazy_glVertexAttrib3fvNV;
+PFNGLVERTEXATTRIB3SNVPROC __glewVertexAttrib3sNV = _glewLazy_glVertexAttrib3sNV;
+PFNGLVERTEXATTRIB3SVNVPROC __glewVertexAttrib3svNV = _glewLazy_glVertexAttrib3svNV;
+PFNGLVERTEXATTRIB4DNVPROC __glewVertexAttrib4dNV = _glewLazy_glVertexAttrib4dNV;
+PFNGLVERTEXATTRIB4DVNVPROC __glewVertexAttrib4dvNV = _glewLazy_glVertexAttrib4dvNV;
+PFNGLVERTEXATTRIB4FNVPROC __glewVertexAttrib4fNV = _glewLazy_glVertexAttrib4fNV;
+PFNGLVERTEXATTRIB4FVNVPROC __glewVertexAttrib4fvNV = _glewLazy_glVertexAttrib4fvNV;
+PFNGLVERTEXATTRIB4SNVPROC __glewVertexAttrib4sNV = _glewLazy_glVertexAttrib4sNV;
+PFNGLVERTEXATTRIB4SVNVPROC __glewVertexAttrib4svNV = _glewLazy_glVertexAttrib4svNV;
+PFNGLVERTEXATTRIB4UBNVPROC __glewVertexAttrib4ubNV = _glewLazy_glVertexAttrib4ubNV;
+PFNGLVERTEXATTRIB4UBVNVPROC __glewVertexAttrib4ubvNV = _glewLazy_glVertexAttrib4ubvNV;
+PFNGLVERTEXATTRIBPOINTERNVPROC __glewVertexAttribPointerNV = _glewLazy_glVertexAttribPointerNV;
+PFNGLVERTEXATTRIBS1DVNVPROC __glewVertexAttribs1dvNV = _glewLazy_glVertexAttribs1dvNV;
+PFNGLVERTEXATTRIBS1FVNVPROC __glewVertexAttribs1fvNV = _glewLazy_glVertexAttribs1fvNV;
+PFNGLVERTEXATTRIBS1SVNVPROC __glewVertexAttribs1svNV = _glewLazy_glVertexAttribs1svNV;
+PFNGLVERTEXATTRIBS2DVNVPROC __glewVertexAttribs2dvNV = _glewLazy_glVertexAttribs2dvNV;
+PFNGLVERTEXATTRIBS2FVNVPROC __glewVertexAttribs2fvNV = _glewLazy_glVertexAttribs2fvNV;
+PFNGLVERTEXATTRIBS2SVNVPROC __glewVertexAttribs2svNV = _glewLazy_glVertexAttribs2svNV;
+PFNGLVERTEXATTRIBS3DVNVPROC __glewVertexAttribs3dvNV = _glewLazy_glVertexAttribs3dvNV;
+PFNGLVERTEXATTRIBS3FVNVPROC __glewVertexAttribs3fvNV = _glewLazy_glVertexAttribs3fvNV;
+PFNGLVERTEXATTRIBS3SVNVPROC __glewVertexAttribs3svNV = _glewLazy_glVertexAttribs3svNV;
+PFNGLVERTEXATTRIBS4DVNVPROC __glewVertexAttribs4dvNV = _glewLazy_glVertexAttribs4dvNV;
+PFNGLVERTEXATTRIBS4FVNVPROC __glewVertexAttribs4fvNV = _glewLazy_glVertexAttribs4fvNV;
+PFNGLVERTEXATTRIBS4SVNVPROC __glewVertexAttribs4svNV = _glewLazy_glVertexAttribs4svNV;
+PFNGLVERTEXATTRIBS4UBVNVPROC __glewVertexAttribs4ubvNV = _glewLazy_glVertexAttribs4ubvNV;
+
+PFNGLBEGINVIDEOCAPTURENVPROC __glewBeginVideoCaptureNV = _glewLazy_glBeginVideoCaptureNV;
+PFNGLBINDVIDEOCAPTURESTREAMBUFFERNVPROC __glewBindVideoCaptureStreamBufferNV = _glewLazy_glBindVideoCaptureStreamBufferNV;
+PFNGLBINDVIDEOCAPTURESTREAMTEXTURENVPROC __glewBindVideoCaptureStreamTextureNV = _glewLazy_glBindVideoCaptureStreamTextureNV;
+PFNGLENDVIDEOCAPTURENVPROC __glewEndVideoCaptureNV = _glewLazy_glEndVideoCaptureNV;
+PFNGLGETVIDEOCAPTURESTREAMDVNVPROC __glewGetVideoCaptureStreamdvNV = _glewLazy_glGetVideoCaptureStreamdvNV;
+PFNGLGETVIDEOCAPTURESTREAMFVNVPROC __glewGetVideoCaptureStreamfvNV = _glewLazy_glGetVideoCaptureStreamfvNV;
+PFNGLGETVIDEOCAPTURESTREAMIVNVPROC __glewGetVideoCaptureStreamivNV = _glewLazy_glGetVideoCaptureStreamivNV;
+PFNGLGETVIDEOCAPTUREIVNVPROC __glewGetVideoCaptureivNV = _glewLazy_glGetVideoCaptureivNV;
+PFNGLVIDEOCAPTURENVPROC __glewVideoCaptureNV = _glewLazy_glVideoCaptureNV;
+PFNGLVIDEOCAPTURESTREAMPARAMETERDVNVPROC __glewVideoCaptureStreamParameterdvNV = _glewLazy_glVideoCaptureStreamParameterdvNV;
+PFNGLVIDEOCAPTURESTREAMPARAMETERFVNVPROC __glewVideoCaptureStreamParameterfvNV = _glewLazy_glVideoCaptureStreamParameterfvNV;
+PFNGLVIDEOCAPTURESTREAMPARAMETERIVNVPROC __glewVideoCaptureStreamParameterivNV = _glewLazy_glVideoCaptureStreamParameterivNV;
+
+PFNGLCLEARDEPTHFOESPROC __glewClearDepthfOES = _glewLazy_glClearDepthfOES;
+PFNGLCLIPPLANEFOESPROC __glewClipPlanefOES = _glewLazy_glClipPlanefOES;
+PFNGLDEPTHRANGEFOESPROC __glewDepthRangefOES = _glewLazy_glDepthRangefOES;
+PFNGLFRUSTUMFOESPROC __glewFrustumfOES = _glewLazy_glFrustumfOES;
+PFNGLGETCLIPPLANEFOESPROC __glewGetClipPlanefOES = _glewLazy_glGetClipPlanefOES;
+PFNGLORTHOFOESPROC __glewOrthofOES = _glewLazy_glOrthofOES;
+
+PFNGLALPHAFUNCXPROC __glewAlphaFuncx = _glewLazy_glAlphaFuncx;
+PFNGLCLEARCOLORXPROC __glewClearColorx = _glewLazy_glClearColorx;
+PFNGLCLEARDEPTHXPROC __glewClearDepthx = _glewLazy_glClearDepthx;
+PFNGLCOLOR4XPROC __glewColor4x = _glewLazy_glColor4x;
+PFNGLDEPTHRANGEXPROC __glewDepthRangex = _glewLazy_glDepthRangex;
+PFNGLFOGXPROC __glewFogx = _glewLazy_glFogx;
+PFNGLFOGXVPROC __glewFogxv = _glewLazy_glFogxv;
+PFNGLFRUSTUMFPROC __glewFrustumf = _glewLazy_glFrustumf;
+PFNGLFRUSTUMXPROC __glewFrustumx = _glewLazy_glFrustumx;
+PFNGLLIGHTMODELXPROC __glewLightModelx = _glewLazy_glLightModelx;
+PFNGLLIGHTMODELXVPROC __glewLightModelxv = _glewLazy_glLightModelxv;
+PFNGLLIGHTXPROC __glewLightx = _glewLazy_glLightx;
+PFNGLLIGHTXVPROC __glewLightxv = _glewLazy_glLightxv;
+PFNGLLINEWIDTHXPROC __glewLineWidthx = _glewLazy_glLineWidthx;
+PFNGLLOADMATRIXXPROC __glewLoadMatrixx = _glewLazy_glLoadMatrixx;
+PFNGLMATERIALXPROC __glewMaterialx = _glewLazy_glMaterialx;
+PFNGLMATERIALXVPROC __glewMaterialxv = _glewLazy_glMaterialxv;
+PFNGLMULTMATRIXXPROC __glewMultMatrixx = _glewLazy_glMultMatrixx;
+PFNGLMULTITEXCOORD4XPROC __glewMultiTexCoord4x = _glewLazy_glMultiTexCoord4x;
+PFNGLNORMAL3XPROC __glewNormal3x = _glewLazy_glNormal3x;
+PFNGLORTHOFPROC __glewOrthof = _glewLazy_glOrthof;
+PFNGLORTHOXPROC __glewOrthox = _glewLazy_glOrthox;
+PFNGLPOINTSIZEXPROC __glewPointSizex = _glewLazy_glPointSizex;
+PFNGLPOLYGONOFFSETXPROC __glewPolygonOffsetx = _glewLazy_glPolygonOffsetx;
+PFNGLROTATEXPROC __glewRotatex = _glewLazy_glRotatex;
+PFNGLSAMPLECOVERAGEXPROC __glewSampleCoveragex = _glewLazy_glSampleCoveragex;
+PFNGLSCALEXPROC __glewScalex = _glewLazy_glScalex;
+PFNGLTEXENVXPROC __glewTexEnvx = _glewLazy_glTexEnvx;
+PFNGLTEXENVXVPROC __glewTexEnvxv = _glewLazy_glTexEnvxv;
+PFNGLTEXPARAMETERXPROC __glewTexParameterx = _glewLazy_glTexParameterx;
+PFNGLTRANSLATEXPROC __glewTranslatex = _glewLazy_glTranslatex;
+
+PFNGLCLIPPLANEFPROC __glewClipPlanef = _glewLazy_glClipPlanef;
+PFNGLCLIPPLANEXPROC __glewClipPlanex = _glewLazy_glClipPlanex;
+PFNGLGETCLIPPLANEFPROC __glewGetClipPlanef = _glewLazy_glGetClipPlanef;
+PFNGLGETCLIPPLANEXPROC __glewGetClipPlanex = _glewLazy_glGetClipPlanex;
+PFNGLGETFIXEDVPROC __glewGetFixedv = _glewLazy_glGetFixedv;
+PFNGLGETLIGHTXVPROC __glewGetLightxv = _glewLazy_glGetLightxv;
+PFNGLGETMATERIALXVPROC __glewGetMaterialxv = _glewLazy_glGetMaterialxv;
+PFNGLGETTEXENVXVPROC __glewGetTexEnvxv = _glewLazy_glGetTexEnvxv;
+PFNGLGETTEXPARAMETERXVPROC __glewGetTexParameterxv = _glewLazy_glGetTexParameterxv;
+PFNGLPOINTPARAMETERXPROC __glewPointParameterx = _glewLazy_glPointParameterx;
+PFNGLPOINTPARAMETERXVPROC __glewPointParameterxv = _glewLazy_glPointParameterxv;
+PFNGLPOINTSIZEPOINTEROESPROC __glewPointSizePointerOES = _glewLazy_glPointSizePointerOES;
+PFNGLTEXPARAMETERXVPROC __glewTexParameterxv = _glewLazy_glTexParameterxv;
+
+PFNGLERRORSTRINGREGALPROC __glewErrorStringREGAL = _glewLazy_glErrorStringREGAL;
+
+PFNGLGETEXTENSIONREGALPROC __glewGetExtensionREGAL = _glewLazy_glGetExtensionREGAL;
+PFNGLISSUPPORTEDREGALPROC __glewIsSupportedREGAL = _glewLazy_glIsSupportedREGAL;
+
+PFNGLLOGMESSAGECALLBACKREGALPROC __glewLogMessageCallbackREGAL = _glewLazy_glLogMessageCallbackREGAL;
+
+PFNGLGETPROCADDRESSREGALPROC __glewGetProcAddressREGAL = _glewLazy_glGetProcAddressREGAL;
+
+PFNGLDETAILTEXFUNCSGISPROC __glewDetailTexFuncSGIS = _glewLazy_glDetailTexFuncSGIS;
+PFNGLGETDETAILTEXFUNCSGISPROC __glewGetDetailTexFuncSGIS = _glewLazy_glGetDetailTexFuncSGIS;
+
+PFNGLFOGFUNCSGISPROC __glewFogFuncSGIS = _glewLazy_glFogFuncSGIS;
+PFNGLGETFOGFUNCSGISPROC __glewGetFogFuncSGIS = _glewLazy_glGetFogFuncSGIS;
+
+PFNGLSAMPLEMASKSGISPROC __glewSampleMaskSGIS = _glewLazy_glSampleMaskSGIS;
+PFNGLSAMPLEPATTERNSGISPROC __glewSamplePatternSGIS = _glewLazy_glSamplePatternSGIS;
+
+PFNGLGETSHARPENTEXFUNCSGISPROC __glewGetSharpenTexFuncSGIS = _glewLazy_glGetSharpenTexFuncSGIS;
+PFNGLSHARPENTEXFUNCSGISPROC __glewSharpenTexFuncSGIS = _glewLazy_glSharpenTexFuncSGIS;
+
+PFNGLTEXIMAGE4DSGISPROC __glewTexImage4DSGIS = _glewLazy_glTexImage4DSGIS;
+PFNGLTEXSUBIMAGE4DSGISPROC __glewTexSubImage4DSGIS = _glewLazy_glTexSubImage4DSGIS;
+
+PFNGLGETTEXFILTERFUNCSGISPROC __glewGetTexFilterFuncSGIS = _glewLazy_glGetTexFilterFuncSGIS;
+PFNGLTEXFILTERFUNCSGISPROC __glewTexFilterFuncSGIS = _glewLazy_glTexFilterFuncSGIS;
+
+PFNGLASYNCMARKERSGIXPROC __glewAsyncMarkerSGIX = _glewLazy_glAsyncMarkerSGIX;
+PFNGLDELETEASYNCMARKERSSGIXPROC __glewDeleteAsyncMarkersSGIX = _glewLazy_glDeleteAsyncMarkersSGIX;
+PFNGLFINISHASYNCSGIXPROC __glewFinishAsyncSGIX = _glewLazy_glFinishAsyncSGIX;
+PFNGLGENASYNCMARKERSSGIXPROC __glewGenAsyncMarkersSGIX = _glewLazy_glGenAsyncMarkersSGIX;
+PFNGLISASYNCMARKERSGIXPROC __glewIsAsyncMarkerSGIX = _glewLazy_glIsAsyncMarkerSGIX;
+PFNGLPOLLASYNCSGIXPROC __glewPollAsyncSGIX = _glewLazy_glPollAsyncSGIX;
+
+PFNGLFLUSHRASTERSGIXPROC __glewFlushRasterSGIX = _glewLazy_glFlushRasterSGIX;
+
+PFNGLTEXTUREFOGSGIXPROC __glewTextureFogSGIX = _glewLazy_glTextureFogSGIX;
+
+PFNGLFRAGMENTCOLORMATERIALSGIXPROC __glewFragmentColorMaterialSGIX = _glewLazy_glFragmentColorMaterialSGIX;
+PFNGLFRAGMENTLIGHTMODELFSGIXPROC __glewFragmentLightModelfSGIX = _glewLazy_glFragmentLightModelfSGIX;
+PFNGLFRAGMENTLIGHTMODELFVSGIXPROC __glewFragmentLightModelfvSGIX = _glewLazy_glFragmentLightModelfvSGIX;
+PFNGLFRAGMENTLIGHTMODELISGIXPROC __glewFragmentLightModeliSGIX = _glewLazy_glFragmentLightModeliSGIX;
+PFNGLFRAGMENTLIGHTMODELIVSGIXPROC __glewFragmentLightModelivSGIX = _glewLazy_glFragmentLightModelivSGIX;
+PFNGLFRAGMENTLIGHTFSGIXPROC __glewFragmentLightfSGIX = _glewLazy_glFragmentLightfSGIX;
+PFNGLFRAGMENTLIGHTFVSGIXPROC __glewFragmentLightfvSGIX = _glewLazy_glFragmentLightfvSGIX;
+PFNGLFRAGMENTLIGHTISGIXPROC __glewFragmentLightiSGIX = _glewLazy_glFragmentLightiSGIX;
+PFNGLFRAGMENTLIGHTIVSGIXPROC __glewFragmentLightivSGIX = _glewLazy_glFragmentLightivSGIX;
+PFNGLFRAGMENTMATERIALFSGIXPROC __glewFragmentMaterialfSGIX = _glewLazy_glFragmentMaterialfSGIX;
+PFNGLFRAGMENTMATERIALFVSGIXPROC __glewFragmentMaterialfvSGIX = _glewLazy_glFragmentMaterialfvSGIX;
+PFNGLFRAGMENTMATERIALISGIXPROC __glewFragmentMaterialiSGIX = _glewLazy_glFragmentMaterialiSGIX;
+PFNGLFRAGMENTMATERIALIVSGIXPROC __glewFragmentMaterialivSGIX = _glewLazy_glFragmentMaterialivSGIX;
+PFNGLGETFRAGMENTLIGHTFVSGIXPROC __glewGetFragmentLightfvSGIX = _glewLazy_glGetFragmentLightfvSGIX;
+PFNGLGETFRAGMENTLIGHTIVSGIXPROC __glewGetFragmentLightivSGIX = _glewLazy_glGetFragmentLightivSGIX;
+PFNGLGETFRAGMENTMATERIALFVSGIXPROC __glewGetFragmentMaterialfvSGIX = _glewLazy_glGetFragmentMaterialfvSGIX;
+PFNGLGETFRAGMENTMATERIALIVSGIXPROC __glewGetFragmentMaterialivSGIX = _glewLazy_glGetFragmentMaterialivSGIX;
+
+PFNGLFRAMEZOOMSGIXPROC __glewFrameZoomSGIX = _glewLazy_glFrameZoomSGIX;
+
+PFNGLPIXELTEXGENSGIXPROC __glewPixelTexGenSGIX = _glewLazy_glPixelTexGenSGIX;
+
+PFNGLREFERENCEPLANESGIXPROC __glewReferencePlaneSGIX = _glewLazy_glReferencePlaneSGIX;
+
+PFNGLSPRITEPARAMETERFSGIXPROC __glewSpriteParameterfSGIX = _glewLazy_glSpriteParameterfSGIX;
+PFNGLSPRITEPARAMETERFVSGIXPROC __glewSpriteParameterfvSGIX = _glewLazy_glSpriteParameterfvSGIX;
+PFNGLSPRITEPARAMETERISGIXPROC __glewSpriteParameteriSGIX = _glewLazy_glSpriteParameteriSGIX;
+PFNGLSPRITEPARAMETERIVSGIXPROC __glewSpriteParameterivSGIX = _glewLazy_glSpriteParameterivSGIX;
+
+PFNGLTAGSAMPLEBUFFERSGIXPROC __glewTagSampleBufferSGIX = _glewLazy_glTagSampleBufferSGIX;
+
+PFNGLCOLORTABLEPARAMETERFVSGIPROC __glewColorTableParameterfvSGI = _glewLazy_glColorTableParameterfvSGI;
+PFNGLCOLORTABLEPARAMETERIVSGIPROC __glewColorTableParameterivSGI = _glewLazy_glColorTableParameterivSGI;
+PFNGLCOLORTABLESGIPROC __glewColorTableSGI = _glewLazy_glColorTableSGI;
+PFNGLCOPYCOLORTABLESGIPROC __glewCopyColorTableSGI = _glewLazy_glCopyColorTableSGI;
+PFNGLGETCOLORTABLEPARAMETERFVSGIPROC __glewGetColorTableParameterfvSGI = _glewLazy_glGetColorTableParameterfvSGI;
+PFNGLGETCOLORTABLEPARAMETERIVSGIPROC __glewGetColorTableParameterivSGI = _glewLazy_glGetColorTableParameterivSGI;
+PFNGLGETCOLORTABLESGIPROC __glewGetColorTableSGI = _glewLazy_glGetColorTableSGI;
+
+PFNGLFINISHTEXTURESUNXPROC __glewFinishTextureSUNX = _glewLazy_glFinishTextureSUNX;
+
+PFNGLGLOBALALPHAFACTORBSUNPROC __glewGlobalAlphaFactorbSUN = _glewLazy_glGlobalAlphaFactorbSUN;
+PFNGLGLOBALALPHAFACTORDSUNPROC __glewGlobalAlphaFactordSUN = _glewLazy_glGlobalAlphaFactordSUN;
+PFNGLGLOBALALPHAFACTORFSUNPROC __glewGlobalAlphaFactorfSUN = _glewLazy_glGlobalAlphaFactorfSUN;
+PFNGLGLOBALALPHAFACTORISUNPROC __glewGlobalAlphaFactoriSUN = _glewLazy_glGlobalAlphaFactoriSUN;
+PFNGLGLOBALALPHAFACTORSSUNPROC __glewGlobalAlphaFactorsSUN = _glewLazy_glGlobalAlphaFactorsSUN;
+PFNGLGLOBALALPHAFACTORUBSUNPROC __glewGlobalAlphaFactorubSUN = _glewLazy_glGlobalAlphaFactorubSUN;
+PFNGLGLOBALALPHAFACTORUISUNPROC __glewGlobalAlphaFactoruiSUN = _glewLazy_glGlobalAlphaFactoruiSUN;
+PFNGLGLOBALALPHAFACTORUSSUNPROC __glewGlobalAlphaFactorusSUN = _glewLazy_glGlobalAlphaFactorusSUN;
+
+PFNGLREADVIDEOPIXELSSUNPROC __glewReadVideoPixelsSUN = _glewLazy_glReadVideoPixelsSUN;
+
+PFNGLREPLACEMENTCODEPOINTERSUNPROC __glewReplacementCodePointerSUN = _glewLazy_glReplacementCodePointerSUN;
+PFNGLREPLACEMENTCODEUBSUNPROC __glewReplacementCodeubSUN = _glewLazy_glReplacementCodeubSUN;
+PFNGLREPLACEMENTCODEUBVSUNPROC __glewReplacementCodeubvSUN = _glewLazy_glReplacementCodeubvSUN;
+PFNGLREPLACEMENTCODEUISUNPROC __glewReplacementCodeuiSUN = _glewLazy_glReplacementCodeuiSUN;
+PFNGLREPLACEMENTCODEUIVSUNPROC __glewReplacementCodeuivSUN = _glewLazy_glReplacementCodeuivSUN;
+PFNGLREPLACEMENTCODEUSSUNPROC __glewReplacementCodeusSUN = _glewLazy_glReplacementCodeusSUN;
+PFNGLREPLACEMENTCODEUSVSUNPROC __glewReplacementCodeusvSUN = _glewLazy_glReplacementCodeusvSUN;
+
+PFNGLCOLOR3FVERTEX3FSUNPROC __glewColor3fVertex3fSUN = _glewLazy_glColor3fVertex3fSUN;
+PFNGLCOLOR3FVERTEX3FVSUNPROC __glewColor3fVertex3fvSUN = _glewLazy_glColor3fVertex3fvSUN;
+PFNGLCOLOR4FNORMAL3FVERTEX3FSUNPROC __glewColor4fNormal3fVertex3fSUN = _glewLazy_glColor4fNormal3fVertex3fSUN;
+PFNGLCOLOR4FNORMAL3FVERTEX3FVSUNPROC __glewColor4fNormal3fVertex3fvSUN = _glewLazy_glColor4fNormal3fVertex3fvSUN;
+PFNGLCOLOR4UBVERTEX2FSUNPROC __glewColor4ubVertex2fSUN = _glewLazy_glColor4ubVertex2fSUN;
+PFNGLCOLOR4UBVERTEX2FVSUNPROC __glewColor4ubVertex2fvSUN = _glewLazy_glColor4ubVertex2fvSUN;
+PFNGLCOLOR4UBVERTEX3FSUNPROC __glewColor4ubVertex3fSUN = _glewLazy_glColor4ubVertex3fSUN;
+PFNGLCOLOR4UBVERTEX3FVSUNPROC __glewColor4ubVertex3fvSUN = _glewLazy_glColor4ubVertex3fvSUN;
+PFNGLNORMAL3FVERTEX3FSUNPROC __glewNormal3fVertex3fSUN = _glewLazy_glNormal3fVertex3fSUN;
+PFNGLNORMAL3FVERTEX3FVSUNPROC __glewNormal3fVertex3fvSUN = _glewLazy_glNormal3fVertex3fvSUN;
+PFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FSUNPROC __glewReplacementCodeuiColor3fVertex3fSUN = _glewLazy_glReplacementCodeuiColor3fVertex3fSUN;
+PFNGLREPLACEMENTCODEUICOLOR3FVERTEX3FVSUNPROC __glewReplacementCodeuiColor3fVertex3fvSUN = _glewLazy_glReplacementCodeuiColor3fVertex3fvSUN;
+PFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FSUNPROC __glewReplacementCodeuiColor4fNormal3fVertex3fSUN = _glewLazy_glReplacementCodeuiColor4fNormal3fVertex3fSUN;
+PFNGLREPLACEMENTCODEUICOLOR4FNORMAL3FVERTEX3FVSUNPROC __glewReplacementCodeuiColor4fNormal3fVertex3fvSUN = _glewLazy_glReplacementCodeuiColor4fNormal3fVertex3fvSUN;
+PFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FSUNPROC __glewReplacementCodeuiColor4ubVertex3fSUN = _glewLazy_glReplacementCodeuiColor4ubVertex3fSUN;
+PFNGLREPLACEMENTCODEUICOLOR4UBVERTEX3FVSUNPROC __glewReplacementCodeuiColor4ubVertex3fvSUN = _glewLazy_glReplacementCodeuiColor4ubVertex3fvSUN;
+PFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FSUNPROC __glewReplacementCodeuiNormal3fVertex3fSUN = _glewLazy_glReplacementCodeuiNormal3fVertex3fSUN;
+PFNGLREPLACEMENTCODEUINORMAL3FVERTEX3FVSUNPROC __glewReplacementCodeuiNormal3fVertex3fvSUN = _glewLazy_glReplacementCodeuiNormal3fVertex3fvSUN;
+PFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC __glewReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN = _glewLazy_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fSUN;
+PFNGLREPLACEMENTCODEUITEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC __glewReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN = _glewLazy_glReplacementCodeuiTexCoord2fColor4fNormal3fVertex3fvSUN;
+PFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FSUNPROC __glewReplacementCodeuiTexCoord2fNormal3fVertex3fSUN = _glewLazy_glReplacementCodeuiTexCoord2fNormal3fVertex3fSUN;
+PFNGLREPLACEMENTCODEUITEXCOORD2FNORMAL3FVERTEX3FVSUNPROC __glewReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN = _glewLazy_glReplacementCodeuiTexCoord2fNormal3fVertex3fvSUN;
+PFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FSUNPROC __glewReplacementCodeuiTexCoord2fVertex3fSUN = _glewLazy_glReplacementCodeuiTexCoord2fVertex3fSUN;
+PFNGLREPLACEMENTCODEUITEXCOORD2FVERTEX3FVSUNPROC __glewReplacementCodeuiTexCoord2fVertex3fvSUN = _glewLazy_glReplacementCodeuiTexCoord2fVertex3fvSUN;
+PFNGLREPLACEMENTCODEUIVERTEX3FSUNPROC __glewReplacementCodeuiVertex3fSUN = _glewLazy_glReplacementCodeuiVertex3fSUN;
+PFNGLREPLACEMENTCODEUIVERTEX3FVSUNPROC __glewReplacementCodeuiVertex3fvSUN = _glewLazy_glReplacementCodeuiVertex3fvSUN;
+PFNGLTEXCOORD2FCOLOR3FVERTEX3FSUNPROC __glewTexCoord2fColor3fVertex3fSUN = _glewLazy_glTexCoord2fColor3fVertex3fSUN;
+PFNGLTEXCOORD2FCOLOR3FVERTEX3FVSUNPROC __glewTexCoord2fColor3fVertex3fvSUN = _glewLazy_glTexCoord2fColor3fVertex3fvSUN;
+PFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FSUNPROC __glewTexCoord2fColor4fNormal3fVertex3fSUN = _glewLazy_glTexCoord2fColor4fNormal3fVertex3fSUN;
+PFNGLTEXCOORD2FCOLOR4FNORMAL3FVERTEX3FVSUNPROC __glewTexCoord2fColor4fNormal3fVertex3fvSUN = _glewLazy_glTexCoord2fColor4fNormal3fVertex3fvSUN;
+PFNGLTEXCOORD2FCOLOR4UBVERTEX3FSUNPROC __glewTexCoord2fColor4ubVertex3fSUN = _glewLazy_glTexCoord2fColor4ubVertex3fSUN;
+PFNGLTEXCOORD2FCOLOR4UBVERTEX3FVSUNPROC __glewTexCoord2fColor4ubVertex3fvSUN = _glewLazy_glTexCoord2fColor4ubVertex3fvSUN;
+PFNGLTEXCOORD2FNORMAL3FVERTEX3FSUNPROC __glewTexCoord2fNormal3fVertex3fSUN = _glewLazy_glTexCoord2fNormal3fVertex3fSUN;
+PFNGLTEXCOORD2FNORMAL3FVERTEX3FVSUNPROC __glewTexCoord2fNormal3fVertex3fvSUN = _glewLazy_glTexCoord2fNormal3fVertex3fvSUN;
+PFNGLTEXCOORD2FVERTEX3FSUNPROC __glewTexCoord2fVertex3fSUN = _glewLazy_glTexCoord2fVertex3fSUN;
+PFNGLTEXCOORD2FVERTEX3FVSUNPROC __glewTexCoord2fVertex3fvSUN = _glewLazy_glTexCoord2fVertex3fvSUN;
+PFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FSUNPROC __glewTexCoord4fColor4fNormal3fVertex4fSUN = _glewLazy_glTexCoord4fColor4fNormal3fVertex4fSUN;
+PFNGLTEXCOORD4FCOLOR4FNORMAL3FVERTEX4FVSUNPROC __glewTexCoord4fColor4fNormal3fVertex4fvSUN = _glewLazy_glTexCoord4fColor4fNormal3fVertex4fvSUN;
+PFNGLTEXCOORD4FVERTEX4FSUNPROC __glewTexCoord4fVertex4fSUN = _glewLazy_glTexCoord4fVertex4fSUN;
+PFNGLTEXCOORD4FVERTEX4FVSUNPROC __glewTexCoord4fVertex4fvSUN = _glewLazy_glTexCoord4fVertex4fvSUN;
+
+PFNGLADDSWAPHINTRECTWINPROC __glewAddSwapHintRectWIN = _glewLazy_glAddSwapHintRectWIN;
+
+#if defined(_WIN32)
+
+static BOOL WINAPI _glewLazy_wglSetStereoEmitterState3DL (HDC hDC, UINT uState)
+{
+  wglSetStereoEmitterState3DL = (PFNWGLSETSTEREOEMITTERSTATE3DLPROC)glewGetProcAddress((const GLubyte*)"wglSetStereoEmitterState3DL");
+  return wglSetStereoEmitterState3DL(hDC, uState);
+}
+
+
+static VOID WINAPI _glewLazy_wglBlitContextFramebufferAMD (HGLRC dstCtx, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+  wglBlitContextFramebufferAMD = (PFNWGLBLITCONTEXTFRAMEBUFFERAMDPROC)glewGetProcAddress((const GLubyte*)"wglBlitContextFramebufferAMD");
+  wglBlitContextFramebufferAMD(dstCtx, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+
+static HGLRC WINAPI _glewLazy_wglCreateAssociatedContextAMD (UINT id)
+{
+  wglCreateAssociatedContextAMD = (PFNWGLCREATEASSOCIATEDCONTEXTAMDPROC)glewGetProcAddress((const GLubyte*)"wglCreateAssociatedContextAMD");
+  return wglCreateAssociatedContextAMD(id);
+}
+
+static HGLRC WINAPI _glewLazy_wglCreateAssociatedContextAttribsAMD (UINT id, HGLRC hShareContext, const int* attribList)
+{
+  wglCreateAssociatedContextAttribsAMD = (PFNWGLCREATEASSOCIATEDCONTEXTATTRIBSAMDPROC)glewGetProcAddress((const GLubyte*)"wglCreateAssociatedContextAttribsAMD");
+  return wglCreateAssociatedContextAttribsAMD(id, hShareContext, attribList);
+}
+
+static BOOL WINAPI _glewLazy_wglDeleteAssociatedContextAMD (HGLRC hglrc)
+{
+  wglDeleteAssociatedContextAMD = (PFNWGLDELETEASSOCIATEDCONTEXTAMDPROC)glewGetProcAddress((const GLubyte*)"wglDeleteAssociatedContextAMD");
+  return wglDeleteAssociatedContextAMD(hglrc);
+}
+
+static UINT WINAPI _glewLazy_wglGetContextGPUIDAMD (HGLRC hglrc)
+{
+  wglGetContextGPUIDAMD = (PFNWGLGETCONTEXTGPUIDAMDPROC)glewGetProcAddress((const GLubyte*)"wglGetContextGPUIDAMD");
+  return wglGetContextGPUIDAMD(hglrc);
+}
+
+static HGLRC WINAPI _glewLazy_wglGetCurrentAssociatedContextAMD (void)
+{
+  wglGetCurrentAssociatedContextAMD = (PFNWGLGETCURRENTASSOCIATEDCONTEXTAMDPROC)glewGetProcAddress((const GLubyte*)"wglGetCurrentAssociatedContextAMD");
+  return wglGetCurrentAssociatedContextAMD();
+}
+
+static UINT WINAPI _glewLazy_wglGetGPUIDsAMD (UINT maxCount, UINT* ids)
+{
+  wglGetGPUIDsAMD = (PFNWGLGETGPUIDSAMDPROC)glewGetProcAddress((const GLubyte*)"wglGetGPUIDsAMD");
+  return wglGetGPUIDsAMD(maxCount, ids);
+}
+
+static INT WINAPI _glewLazy_wglGetGPUInfoAMD (UINT id, INT property, GLenum dataType, UINT size, void* data)
+{
+  wglGetGPUInfoAMD = (PFNWGLGETGPUINFOAMDPROC)glewGetProcAddress((const GLubyte*)"wglGetGPUInfoAMD");
+  return wglGetGPUInfoAMD(id, property, dataType, size, data);
+}
+
+static BOOL WINAPI _glewLazy_wglMakeAssociatedContextCurrentAMD (HGLRC hglrc)
+{
+  wglMakeAssociatedContextCurrentAMD = (PFNWGLMAKEASSOCIATEDCONTEXTCURRENTAMDPROC)glewGetProcAddress((const GLubyte*)"wglMakeAssociatedContextCurrentAMD");
+  return wglMakeAssociatedContextCurrentAMD(hglrc);
+}
+
+
+static HANDLE WINAPI _glewLazy_wglCreateBufferRegionARB (HDC hDC, int iLayerPlane, UINT uType)
+{
+  wglCreateBufferRegionARB = (PFNWGLCREATEBUFFERREGIONARBPROC)glewGetProcAddress((const GLubyte*)"wglCreateBufferRegionARB");
+  return wglCreateBufferRegionARB(hDC, iLayerPlane, uType);
+}
+
+static VOID WINAPI _glewLazy_wglDeleteBufferRegionARB (HANDLE hRegion)
+{
+  wglDeleteBufferRegionARB = (PFNWGLDELETEBUFFERREGIONARBPROC)glewGetProcAddress((const GLubyte*)"wglDeleteBufferRegionARB");
+  wglDeleteBufferRegionARB(hRegion);
+}
+
+static BOOL WINAPI _glewLazy_wglRestoreBufferRegionARB (HANDLE hRegion, int x, int y, int width, int height, int xSrc, int ySrc)
+{
+  wglRestoreBufferRegionARB = (PFNWGLRESTOREBUFFERREGIONARBPROC)glewGetProcAddress((const GLubyte*)"wglRestoreBufferRegionARB");
+  return wglRestoreBufferRegionARB(hRegion, x, y, width, height, xSrc, ySrc);
+}
+
+static BOOL WINAPI _glewLazy_wglSaveBufferRegionARB (HANDLE hRegion, int x, int y, int width, int height)
+{
+  wglSaveBufferRegionARB = (PFNWGLSAVEBUFFERREGIONARBPROC)glewGetProcAddress((const GLubyte*)"wglSaveBufferRegionARB");
+  return wglSaveBufferRegionARB(hRegion, x, y, width, height);
+}
+
+
+static HGLRC WINAPI _glewLazy_wglCreateContextAttribsARB (HDC hDC, HGLRC hShareContext, const int* attribList)
+{
+  wglCreateContextAttribsARB = (PFNWGLCREATECONTEXTATTRIBSARBPROC)glewGetProcAddress((const GLubyte*)"wglCreateContextAttribsARB");
+  return wglCreateContextAttribsARB(hDC, hShareContext, attribList);
+}
+
+
+static const char* WINAPI _glewLazy_wglGetExtensionsStringARB (HDC hdc)
+{
+  wglGetExtensionsStringARB = (PFNWGLGETEXTENSIONSSTRINGARBPROC)glewGetProcAddress((const GLubyte*)"wglGetExtensionsStringARB");
+  return wglGetExtensionsStringARB(hdc);
+}
+
+
+static HDC WINAPI _glewLazy_wglGetCurrentReadDCARB (void)
+{
+  wglGetCurrentReadDCARB = (PFNWGLGETCURRENTREADDCARBPROC)glewGetProcAddress((const GLubyte*)"wglGetCurrentReadDCARB");
+  return wglGetCurrentReadDCARB();
+}
+
+static BOOL WINAPI _glewLazy_wglMakeContextCurrentARB (HDC hDrawDC, HDC hReadDC, HGLRC hglrc)
+{
+  wglMakeContextCurrentARB = (PFNWGLMAKECONTEXTCURRENTARBPROC)glewGetProcAddress((const GLubyte*)"wglMakeContextCurrentARB");
+  return wglMakeContextCurrentARB(hDrawDC, hReadDC, hglrc);
+}
+
+
+static HPBUFFERARB WINAPI _glewLazy_wglCreatePbufferARB (HDC hDC, int iPixelFormat, int iWidth, int iHeight, const int* piAttribList)
+{
+  wglCreatePbufferARB = (PFNWGLCREATEPBUFFERARBPROC)glewGetProcAddress((const GLubyte*)"wglCreatePbufferARB");
+  return wglCreatePbufferARB(hDC, iPixelFormat, iWidth, iHeight, piAttribList);
+}
+
+static BOOL WINAPI _glewLazy_wglDestroyPbufferARB (HPBUFFERARB hPbuffer)
+{
+  wglDestroyPbufferARB = (PFNWGLDESTROYPBUFFERARBPROC)glewGetProcAddress((const GLubyte*)"wglDestroyPbufferARB");
+  return wglDestroyPbufferARB(hPbuffer);
+}
+
+static HDC WINAPI _glewLazy_wglGetPbufferDCARB (HPBUFFERARB hPbuffer)
+{
+  wglGetPbufferDCARB = (PFNWGLGETPBUFFERDCARBPROC)glewGetProcAddress((const GLubyte*)"wglGetPbufferDCARB");
+  return wglGetPbufferDCARB(hPbuffer);
+}
+
+static BOOL WINAPI _glewLazy_wglQueryPbufferARB (HPBUFFERARB hPbuffer, int iAttribute, int* piValue)
+{
+  wglQueryPbufferARB = (PFNWGLQUERYPBUFFERARBPROC)glewGetProcAddress((const GLubyte*)"wglQueryPbufferARB");
+  return wglQueryPbufferARB(hPbuffer, iAttribute, piValue);
+}
+
+static int WINAPI _glewLazy_wglReleasePbufferDCARB (HPBUFFERARB hPbuffer, HDC hDC)
+{
+  wglReleasePbufferDCARB = (PFNWGLRELEASEPBUFFERDCARBPROC)glewGetProcAddress((const GLubyte*)"wglReleasePbufferDCARB");
+  return wglReleasePbufferDCARB(hPbuffer, hDC);
+}
+
+
+static BOOL WINAPI _glewLazy_wglChoosePixelFormatARB (HDC hdc, const int* piAttribIList, const FLOAT *pfAttribFList, UINT nMaxFormats, int *piFormats, UINT *nNumFormats)
+{
+  wglChoosePixelFormatARB = (PFNWGLCHOOSEPIXELFORMATARBPROC)glewGetProcAddress((const GLubyte*)"wglChoosePixelFormatARB");
+  return wglChoosePixelFormatARB(hdc, piAttribIList, pfAttribFList, nMaxFormats, piFormats, nNumFormats);
+}
+
+static BOOL WINAPI _glewLazy_wglGetPixelFormatAttribfvARB (HDC hdc, int iPixelFormat, int iLayerPlane, UINT nAttributes, const int* piAttributes, FLOAT *pfValues)
+{
+  wglGetPixelFormatAttribfvARB = (PFNWGLGETPIXELFORMATATTRIBFVARBPROC)glewGetProcAddress((const GLubyte*)"wglGetPixelFormatAttribfvARB");
+  return wglGetPixelFormatAttribfvARB(hdc, iPixelFormat, iLayerPlane, nAttributes, piAttributes, pfValues);
+}
+
+static BOOL WINAPI _glewLazy_wglGetPixelFormatAttribivARB (HDC hdc, int iPixelFormat, int iLayerPlane, UINT nAttributes, const int* piAttributes, int *piValues)
+{
+  wglGetPixelFormatAttribivARB = (PFNWGLGETPIXELFORMATATTRIBIVARBPROC)glewGetProcAddress((const GLubyte*)"wglGetPixelFormatAttribivARB");
+  return wglGetPixelFormatAttribivARB(hdc, iPixelFormat, iLayerPlane, nAttributes, piAttributes, piValues);
+}
+
+
+static BOOL WINAPI _glewLazy_wglBindTexImageARB (HPBUFFERARB hPbuffer, int iBuffer)
+{
+  wglBindTexImageARB = (PFNWGLBINDTEXIMAGEARBPROC)glewGetProcAddress((const GLubyte*)"wglBindTexImageARB");
+  return wglBindTexImageARB(hPbuffer, iBuffer);
+}
+
+static BOOL WINAPI _glewLazy_wglReleaseTexImageARB (HPBUFFERARB hPbuffer, int iBuffer)
+{
+  wglReleaseTexImageARB = (PFNWGLRELEASETEXIMAGEARBPROC)glewGetProcAddress((const GLubyte*)"wglReleaseTexImageARB");
+  return wglReleaseTexImageARB(hPbuffer, iBuffer);
+}
+
+static BOOL WINAPI _glewLazy_wglSetPbufferAttribARB (HPBUFFERARB hPbuffer, const int* piAttribList)
+{
+  wglSetPbufferAttribARB = (PFNWGLSETPBUFFERATTRIBARBPROC)glewGetProcAddress((const GLubyte*)"wglSetPbufferAttribARB");
+  return wglSetPbufferAttribARB(hPbuffer, piAttribList);
+}
+
+
+static GLboolean WINAPI _glewLazy_wglBindDisplayColorTableEXT (GLushort id)
+{
+  wglBindDisplayColorTableEXT = (PFNWGLBINDDISPLAYCOLORTABLEEXTPROC)glewGetProcAddress((const GLubyte*)"wglBindDisplayColorTableEXT");
+  return wglBindDisplayColorTableEXT(id);
+}
+
+static GLboolean WINAPI _glewLazy_wglCreateDisplayColorTableEXT (GLushort id)
+{
+  wglCreateDisplayColorTableEXT = (PFNWGLCREATEDISPLAYCOLORTABLEEXTPROC)glewGetProcAddress((const GLubyte*)"wglCreateDisplayColorTableEXT");
+  return wglCreateDisplayColorTableEXT(id);
+}
+
+static void WINAPI _glewLazy_wglDestroyDisplayColorTableEXT (GLushort id)
+{
+  wglDestroyDisplayColorTableEXT = (PFNWGLDESTROYDISPLAYCOLORTABLEEXTPROC)glewGetProcAddress((const GLubyte*)"wglDestroyDisplayColorTableEXT");
+  wglDestroyDisplayColorTableEXT(id);
+}
+
+static GLboolean WINAPI _glewLazy_wglLoadDisplayColorTableEXT (GLushort* table, GLuint length)
+{
+  wglLoadDisplayColorTableEXT = (PFNWGLLOADDISPLAYCOLORTABLEEXTPROC)glewGetProcAddress((const GLubyte*)"wglLoadDisplayColorTableEXT");
+  return wglLoadDisplayColorTableEXT(table, length);
+}
+
+
+static const char* WINAPI _glewLazy_wglGetExtensionsStringEXT (void)
+{
+  wglGetExtensionsStringEXT = (PFNWGLGETEXTENSIONSSTRINGEXTPROC)glewGetProcAddress((const GLubyte*)"wglGetExtensionsStringEXT");
+  return wglGetExtensionsStringEXT();
+}
+
+
+static HDC WINAPI _glewLazy_wglGetCurrentReadDCEXT (void)
+{
+  wglGetCurrentReadDCEXT = (PFNWGLGETCURRENTREADDCEXTPROC)glewGetProcAddress((const GLubyte*)"wglGetCurrentReadDCEXT");
+  return wglGetCurrentReadDCEXT();
+}
+
+static BOOL WINAPI _glewLazy_wglMakeContextCurrentEXT (HDC hDrawDC, HDC hReadDC, HGLRC hglrc)
+{
+  wglMakeContextCurrentEXT = (PFNWGLMAKECONTEXTCURRENTEXTPROC)glewGetProcAddress((const GLubyte*)"wglMakeContextCurrentEXT");
+  return wglMakeContextCurrentEXT(hDrawDC, hReadDC, hglrc);
+}
+
+
+static HPBUFFEREXT WINAPI _glewLazy_wglCreatePbufferEXT (HDC hDC, int iPixelFormat, int iWidth, int iHeight, const int* piAttribList)
+{
+  wglCreatePbufferEXT = (PFNWGLCREATEPBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"wglCreatePbufferEXT");
+  return wglCreatePbufferEXT(hDC, iPixelFormat, iWidth, iHeight, piAttribList);
+}
+
+static BOOL WINAPI _glewLazy_wglDestroyPbufferEXT (HPBUFFEREXT hPbuffer)
+{
+  wglDestroyPbufferEXT = (PFNWGLDESTROYPBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"wglDestroyPbufferEXT");
+  return wglDestroyPbufferEXT(hPbuffer);
+}
+
+static HDC WINAPI _glewLazy_wglGetPbufferDCEXT (HPBUFFEREXT hPbuffer)
+{
+  wglGetPbufferDCEXT = (PFNWGLGETPBUFFERDCEXTPROC)glewGetProcAddress((const GLubyte*)"wglGetPbufferDCEXT");
+  return wglGetPbufferDCEXT(hPbuffer);
+}
+
+static BOOL WINAPI _glewLazy_wglQueryPbufferEXT (HPBUFFEREXT hPbuffer, int iAttribute, int* piValue)
+{
+  wglQueryPbufferEXT = (PFNWGLQUERYPBUFFEREXTPROC)glewGetProcAddress((const GLubyte*)"wglQueryPbufferEXT");
+  return wglQueryPbufferEXT(hPbuffer, iAttribute, piValue);
+}
+
+static int WINAPI _glewLazy_wglReleasePbufferDCEXT (HPBUFFEREXT hPbuffer, HDC hDC)
+{
+  wglReleasePbufferDCEXT = (PFNWGLRELEASEPBUFFERDCEXTPROC)glewGetProcAddress((const GLubyte*)"wglReleasePbufferDCEXT");
+  return wglReleasePbufferDCEXT(hPbuffer, hDC);
+}
+
+
+static BOOL WINAPI _glewLazy_wglChoosePixelFormatEXT (HDC hdc, const int* piAttribIList, const FLOAT *pfAttribFList, UINT nMaxFormats, int *piFormats, UINT *nNumFormats)
+{
+  wglChoosePixelFormatEXT = (PFNWGLCHOOSEPIXELFORMATEXTPROC)glewGetProcAddress((const GLubyte*)"wglChoosePixelFormatEXT");
+  return wglChoosePixelFormatEXT(hdc, piAttribIList, pfAttribFList, nMaxFormats, piFormats, nNumFormats);
+}
+
+static BOOL WINAPI _glewLazy_wglGetPixelFormatAttribfvEXT (HDC hdc, int iPixelFormat, int iLayerPlane, UINT nAttributes, int* piAttributes, FLOAT *pfValues)
+{
+  wglGetPixelFormatAttribfvEXT = (PFNWGLGETPIXELFORMATATTRIBFVEXTPROC)glewGetProcAddress((const GLubyte*)"wglGetPixelFormatAttribfvEXT");
+  return wglGetPixelFormatAttribfvEXT(hdc, iPixelFormat, iLayerPlane, nAttributes, piAttributes, pfValues);
+}
+
+static BOOL WINAPI _glewLazy_wglGetPixelFormatAttribivEXT (HDC hdc, int iPixelFormat, int iLayerPlane, UINT nAttributes, int* piAttributes, int *piValues)
+{
+  wglGetPixelFormatAttribivEXT = (PFNWGLGETPIXELFORMATATTRIBIVEXTPROC)glewGetProcAddress((const GLubyte*)"wglGetPixelFormatAttribivEXT");
+  return wglGetPixelFormatAttribivEXT(hdc, iPixelFormat, iLayerPlane, nAttributes, piAttributes, piValues);
+}
+
+
+static int WINAPI _glewLazy_wglGetSwapIntervalEXT (void)
+{
+  wglGetSwapIntervalEXT = (PFNWGLGETSWAPINTERVALEXTPROC)glewGetProcAddress((const GLubyte*)"wglGetSwapIntervalEXT");
+  return wglGetSwapIntervalEXT();
+}
+
+static BOOL WINAPI _glewLazy_wglSwapIntervalEXT (int interval)
+{
+  wglSwapIntervalEXT = (PFNWGLSWAPINTERVALEXTPROC)glewGetProcAddress((const GLubyte*)"wglSwapIntervalEXT");
+  return wglSwapIntervalEXT(interval);
+}
+
+
+static BOOL WINAPI _glewLazy_wglGetDigitalVideoParametersI3D (HDC hDC, int iAttribute, int* piValue)
+{
+  wglGetDigitalVideoParametersI3D = (PFNWGLGETDIGITALVIDEOPARAMETERSI3DPROC)glewGetProcAddress((const GLubyte*)"wglGetDigitalVideoParametersI3D");
+  return wglGetDigitalVideoParametersI3D(hDC, iAttribute, piValue);
+}
+
+static BOOL WINAPI _glewLazy_wglSetDigitalVideoParametersI3D (HDC hDC, int iAttribute, const int* piValue)
+{
+  wglSetDigitalVideoParametersI3D = (PFNWGLSETDIGITALVIDEOPARAMETERSI3DPROC)glewGetProcAddress((const GLubyte*)"wglSetDigitalVideoParametersI3D");
+  return wglSetDigitalVideoParametersI3D(hDC, iAttribute, piValue);
+}
+
+
+static BOOL WINAPI _glewLazy_wglGetGammaTableI3D (HDC hDC, int iEntries, USHORT* puRed, USHORT *puGreen, USHORT *puBlue)
+{
+  wglGetGammaTableI3D = (PFNWGLGETGAMMATABLEI3DPROC)glewGetProcAddress((const GLubyte*)"wglGetGammaTableI3D");
+  return wglGetGammaTableI3D(hDC, iEntries, puRed, puGreen, puBlue);
+}
+
+static BOOL WINAPI _glewLazy_wglGetGammaTableParametersI3D (HDC hDC, int iAttribute, int* piValue)
+{
+  wglGetGammaTableParametersI3D = (PFNWGLGETGAMMATABLEPARAMETERSI3DPROC)glewGetProcAddress((const GLubyte*)"wglGetGammaTableParametersI3D");
+  return wglGetGammaTableParametersI3D(hDC, iAttribute, piValue);
+}
+
+static BOOL WINAPI _glewLazy_wglSetGammaTableI3D (HDC hDC, int iEntries, const USHORT* puRed, const USHORT *puGreen, const USHORT *puBlue)
+{
+  wglSetGammaTableI3D = (PFNWGLSETGAMMATABLEI3DPROC)glewGetProcAddress((const GLubyte*)"wglSetGammaTableI3D");
+  return wglSetGammaTableI3D(hDC, iEntries, puRed, puGreen, puBlue);
+}
+
+static BOOL WINAPI _glewLazy_wglSetGammaTableParametersI3D (HDC hDC, int iAttribute, const int* piValue)
+{
+  wglSetGammaTableParametersI3D = (PFNWGLSETGAMMATABLEPARAMETERSI3DPROC)glewGetProcAddress((const GLubyte*)"wglSetGammaTableParametersI3D");
+  return wglSetGammaTableParametersI3D(hDC, iAttribute, piValue);
+}
+
+
+static BOOL WINAPI _glewLazy_wglDisableGenlockI3D (HDC hDC)
+{
+  wglDisableGenlockI3D = (PFNWGLDISABLEGENLOCKI3DPROC)glewGetProcAddress((const GLubyte*)"wglDisableGenlockI3D");
+  return wglDisableGenlockI3D(hDC);
+}
+
+static BOOL WINAPI _glewLazy_wglEnableGenlockI3D (HDC hDC)
+{
+  wglEnableGenlockI3D = (PFNWGLENABLEGENLOCKI3DPROC)glewGetProcAddress((const GLubyte*)"wglEnableGenlockI3D");
+  return wglEnableGenlockI3D(hDC);
+}
+
+static BOOL WINAPI _glewLazy_wglGenlockSampleRateI3D (HDC hDC, UINT uRate)
+{
+  wglGenlockSampleRateI3D = (PFNWGLGENLOCKSAMPLERATEI3DPROC)glewGetProcAddress((const GLubyte*)"wglGenlockSampleRateI3D");
+  return wglGenlockSampleRateI3D(hDC, uRate);
+}
+
+static BOOL WINAPI _glewLazy_wglGenlockSourceDelayI3D (HDC hDC, UINT uDelay)
+{
+  wglGenlockSourceDelayI3D = (PFNWGLGENLOCKSOURCEDELAYI3DPROC)glewGetProcAddress((const GLubyte*)"wglGenlockSourceDelayI3D");
+  return wglGenlockSourceDelayI3D(hDC, uDelay);
+}
+
+static BOOL WINAPI _glewLazy_wglGenlockSourceEdgeI3D (HDC hDC, UINT uEdge)
+{
+  wglGenlockSourceEdgeI3D = (PFNWGLGENLOCKSOURCEEDGEI3DPROC)glewGetProcAddress((const GLubyte*)"wglGenlockSourceEdgeI3D");
+  return wglGenlockSourceEdgeI3D(hDC, uEdge);
+}
+
+static BOOL WINAPI _glewLazy_wglGenlockSourceI3D (HDC hDC, UINT uSource)
+{
+  wglGenlockSourceI3D = (PFNWGLGENLOCKSOURCEI3DPROC)glewGetProcAddress((const GLubyte*)"wglGenlockSourceI3D");
+  return wglGenlockSourceI3D(hDC, uSource);
+}
+
+static BOOL WINAPI _glewLazy_wglGetGenlockSampleRateI3D (HDC hDC, UINT* uRate)
+{
+  wglGetGenlockSampleRateI3D = (PFNWGLGETGENLOCKSAMPLERATEI3DPROC)glewGetProcAddress((const GLubyte*)"wglGetGenlockSampleRateI3D");
+  return wglGetGenlockSampleRateI3D(hDC, uRate);
+}
+
+static BOOL WINAPI _glewLazy_wglGetGenlockSourceDelayI3D (HDC hDC, UINT* uDelay)
+{
+  wglGetGenlockSourceDelayI3D = (PFNWGLGETGENLOCKSOURCEDELAYI3DPROC)glewGetProcAddress((const GLubyte*)"wglGetGenlockSourceDelayI3D");
+  return wglGetGenlockSourceDelayI3D(hDC, uDelay);
+}
+
+static BOOL WINAPI _glewLazy_wglGetGenlockSourceEdgeI3D (HDC hDC, UINT* uEdge)
+{
+  wglGetGenlockSourceEdgeI3D = (PFNWGLGETGENLOCKSOURCEEDGEI3DPROC)glewGetProcAddress((const GLubyte*)"wglGetGenlockSourceEdgeI3D");
+  return wglGetGenlockSourceEdgeI3D(hDC, uEdge);
+}
+
+static BOOL WINAPI _glewLazy_wglGetGenlockSourceI3D (HDC hDC, UINT* uSource)
+{
+  wglGetGenlockSourceI3D = (PFNWGLGETGENLOCKSOURCEI3DPROC)glewGetProcAddress((const GLubyte*)"wglGetGenlockSourceI3D");
+  return wglGetGenlockSourceI3D(hDC, uSource);
+}
+
+static BOOL WINAPI _glewLazy_wglIsEnabledGenlockI3D (HDC hDC, BOOL* pFlag)
+{
+  wglIsEnabledGenlockI3D = (PFNWGLISENABLEDGENLOCKI3DPROC)glewGetProcAddress((const GLubyte*)"wglIsEnabledGenlockI3D");
+  return wglIsEnabledGenlockI3D(hDC, pFlag);
+}
+
+static BOOL WINAPI _glewLazy_wglQueryGenlockMaxSourceDelayI3D (HDC hDC, UINT* uMaxLineDelay, UINT *uMaxPixelDelay)
+{
+  wglQueryGenlockMaxSourceDelayI3D = (PFNWGLQUERYGENLOCKMAXSOURCEDELAYI3DPROC)glewGetProcAddress((const GLubyte*)"wglQueryGenlockMaxSourceDelayI3D");
+  return wglQueryGenlockMaxSourceDelayI3D(hDC, uMaxLineDelay, uMaxPixelDelay);
+}
+
+
+static BOOL WINAPI _glewLazy_wglAssociateImageBufferEventsI3D (HDC hdc, HANDLE* pEvent, LPVOID *pAddress, DWORD *pSize, UINT count)
+{
+  wglAssociateImageBufferEventsI3D = (PFNWGLASSOCIATEIMAGEBUFFEREVENTSI3DPROC)glewGetProcAddress((const GLubyte*)"wglAssociateImageBufferEventsI3D");
+  return wglAssociateImageBufferEventsI3D(hdc, pEvent, pAddress, pSize, count);
+}
+
+static LPVOID WINAPI _glewLazy_wglCreateImageBufferI3D (HDC hDC, DWORD dwSize, UINT uFlags)
+{
+  wglCreateImageBufferI3D = (PFNWGLCREATEIMAGEBUFFERI3DPROC)glewGetProcAddress((const GLubyte*)"wglCreateImageBufferI3D");
+  return wglCreateImageBufferI3D(hDC, dwSize, uFlags);
+}
+
+static BOOL WINAPI _glewLazy_wglDestroyImageBufferI3D (HDC hDC, LPVOID pAddress)
+{
+  wglDestroyImageBufferI3D = (PFNWGLDESTROYIMAGEBUFFERI3DPROC)glewGetProcAddress((const GLubyte*)"wglDestroyImageBufferI3D");
+  return wglDestroyImageBufferI3D(hDC, pAddress);
+}
+
+static BOOL WINAPI _glewLazy_wglReleaseImageBufferEventsI3D (HDC hdc, LPVOID* pAddress, UINT count)
+{
+  wglReleaseImageBufferEventsI3D = (PFNWGLRELEASEIMAGEBUFFEREVENTSI3DPROC)glewGetProcAddress((const GLubyte*)"wglReleaseImageBufferEventsI3D");
+  return wglReleaseImageBufferEventsI3D(hdc, pAddress, count);
+}
+
+
+static BOOL WINAPI _glewLazy_wglDisableFrameLockI3D (void)
+{
+  wglDisableFrameLockI3D = (PFNWGLDISABLEFRAMELOCKI3DPROC)glewGetProcAddress((const GLubyte*)"wglDisableFrameLockI3D");
+  return wglDisableFrameLockI3D();
+}
+
+static BOOL WINAPI _glewLazy_wglEnableFrameLockI3D (void)
+{
+  wglEnableFrameLockI3D = (PFNWGLENABLEFRAMELOCKI3DPROC)glewGetProcAddress((const GLubyte*)"wglEnableFrameLockI3D");
+  return wglEnableFrameLockI3D();
+}
+
+static BOOL WINAPI _glewLazy_wglIsEnabledFrameLockI3D (BOOL* pFlag)
+{
+  wglIsEnabledFrameLockI3D = (PFNWGLISENABLEDFRAMELOCKI3DPROC)glewGetProcAddress((const GLubyte*)"wglIsEnabledFrameLockI3D");
+  return wglIsEnabledFrameLockI3D(pFlag);
+}
+
+static BOOL WINAPI _glewLazy_wglQueryFrameLockMasterI3D (BOOL* pFlag)
+{
+  wglQueryFrameLockMasterI3D = (PFNWGLQUERYFRAMELOCKMASTERI3DPROC)glewGetProcAddress((const GLubyte*)"wglQueryFrameLockMasterI3D");
+  return wglQueryFrameLockMasterI3D(pFlag);
+}
+
+
+static BOOL WINAPI _glewLazy_wglBeginFrameTrackingI3D (void)
+{
+  wglBeginFrameTrackingI3D = (PFNWGLBEGINFRAMETRACKINGI3DPROC)glewGetProcAddress((const GLubyte*)"wglBeginFrameTrackingI3D");
+  return wglBeginFrameTrackingI3D();
+}
+
+static BOOL WINAPI _glewLazy_wglEndFrameTrackingI3D (void)
+{
+  wglEndFrameTrackingI3D = (PFNWGLENDFRAMETRACKINGI3DPROC)glewGetProcAddress((const GLubyte*)"wglEndFrameTrackingI3D");
+  return wglEndFrameTrackingI3D();
+}
+
+static BOOL WINAPI _glewLazy_wglGetFrameUsageI3D (float* pUsage)
+{
+  wglGetFrameUsageI3D = (PFNWGLGETFRAMEUSAGEI3DPROC)glewGetProcAddress((const GLubyte*)"wglGetFrameUsageI3D");
+  return wglGetFrameUsageI3D(pUsage);
+}
+
+static BOOL WINAPI _glewLazy_wglQueryFrameTrackingI3D (DWORD* pFrameCount, DWORD *pMissedFrames, float *pLastMissedUsage)
+{
+  wglQueryFrameTrackingI3D = (PFNWGLQUERYFRAMETRACKINGI3DPROC)glewGetProcAddress((const GLubyte*)"wglQueryFrameTrackingI3D");
+  return wglQueryFrameTrackingI3D(pFrameCount, pMissedFrames, pLastMissedUsage);
+}
+
+
+static BOOL WINAPI _glewLazy_wglDXCloseDeviceNV (HANDLE hDevice)
+{
+  wglDXCloseDeviceNV = (PFNWGLDXCLOSEDEVICENVPROC)glewGetProcAddress((const GLubyte*)"wglDXCloseDeviceNV");
+  return wglDXCloseDeviceNV(hDevice);
+}
+
+static BOOL WINAPI _glewLazy_wglDXLockObjectsNV (HANDLE hDevice, GLint count, HANDLE* hObjects)
+{
+  wglDXLockObjectsNV = (PFNWGLDXLOCKOBJECTSNVPROC)glewGetProcAddress((const GLubyte*)"wglDXLockObjectsNV");
+  return wglDXLockObjectsNV(hDevice, count, hObjects);
+}
+
+static BOOL WINAPI _glewLazy_wglDXObjectAccessNV (HANDLE hObject, GLenum access)
+{
+  wglDXObjectAccessNV = (PFNWGLDXOBJECTACCESSNVPROC)glewGetProcAddress((const GLubyte*)"wglDXObjectAccessNV");
+  return wglDXObjectAccessNV(hObject, access);
+}
+
+static HANDLE WINAPI _glewLazy_wglDXOpenDeviceNV (void* dxDevice)
+{
+  wglDXOpenDeviceNV = (PFNWGLDXOPENDEVICENVPROC)glewGetProcAddress((const GLubyte*)"wglDXOpenDeviceNV");
+  return wglDXOpenDeviceNV(dxDevice);
+}
+
+static HANDLE WINAPI _glewLazy_wglDXRegisterObjectNV (HANDLE hDevice, void* dxObject, GLuint name, GLenum type, GLenum access)
+{
+  wglDXRegisterObjectNV = (PFNWGLDXREGISTEROBJECTNVPROC)glewGetProcAddress((const GLubyte*)"wglDXRegisterObjectNV");
+  return wglDXRegisterObjectNV(hDevice, dxObject, name, type, access);
+}
+
+static BOOL WINAPI _glewLazy_wglDXSetResourceShareHandleNV (void* dxObject, HANDLE shareHandle)
+{
+  wglDXSetResourceShareHandleNV = (PFNWGLDXSETRESOURCESHAREHANDLENVPROC)glewGetProcAddress((const GLubyte*)"wglDXSetResourceShareHandleNV");
+  return wglDXSetResourceShareHandleNV(dxObject, shareHandle);
+}
+
+static BOOL WINAPI _glewLazy_wglDXUnlockObjectsNV (HANDLE hDevice, GLint count, HANDLE* hObjects)
+{
+  wglDXUnlockObjectsNV = (PFNWGLDXUNLOCKOBJECTSNVPROC)glewGetProcAddress((const GLubyte*)"wglDXUnlockObjectsNV");
+  return wglDXUnlockObjectsNV(hDevice, count, hObjects);
+}
+
+static BOOL WINAPI _glewLazy_wglDXUnregisterObjectNV (HANDLE hDevice, HANDLE hObject)
+{
+  wglDXUnregisterObjectNV = (PFNWGLDXUNREGISTEROBJECTNVPROC)glewGetProcAddress((const GLubyte*)"wglDXUnregisterObjectNV");
+  return wglDXUnregisterObjectNV(hDevice, hObject);
+}
+
+
+static BOOL WINAPI _glewLazy_wglCopyImageSubDataNV (HGLRC hSrcRC, GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, HGLRC hDstRC, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei width, GLsizei height, GLsizei depth)
+{
+  wglCopyImageSubDataNV = (PFNWGLCOPYIMAGESUBDATANVPROC)glewGetProcAddress((const GLubyte*)"wglCopyImageSubDataNV");
+  return wglCopyImageSubDataNV(hSrcRC, srcName, srcTarget, srcLevel, srcX, srcY, srcZ, hDstRC, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, width, height, depth);
+}
+
+
+static BOOL WINAPI _glewLazy_wglDelayBeforeSwapNV (HDC hDC, GLfloat seconds)
+{
+  wglDelayBeforeSwapNV = (PFNWGLDELAYBEFORESWAPNVPROC)glewGetProcAddress((const GLubyte*)"wglDelayBeforeSwapNV");
+  return wglDelayBeforeSwapNV(hDC, seconds);
+}
+
+
+static HDC WINAPI _glewLazy_wglCreateAffinityDCNV (const HGPUNV *phGpuList)
+{
+  wglCreateAffinityDCNV = (PFNWGLCREATEAFFINITYDCNVPROC)glewGetProcAddress((const GLubyte*)"wglCreateAffinityDCNV");
+  return wglCreateAffinityDCNV(phGpuList);
+}
+
+static BOOL WINAPI _glewLazy_wglDeleteDCNV (HDC hdc)
+{
+  wglDeleteDCNV = (PFNWGLDELETEDCNVPROC)glewGetProcAddress((const GLubyte*)"wglDeleteDCNV");
+  return wglDeleteDCNV(hdc);
+}
+
+static BOOL WINAPI _glewLazy_wglEnumGpuDevicesNV (HGPUNV hGpu, UINT iDeviceIndex, PGPU_DEVICE lpGpuDevice)
+{
+  wglEnumGpuDevicesNV = (PFNWGLENUMGPUDEVICESNVPROC)glewGetProcAddress((const GLubyte*)"wglEnumGpuDevicesNV");
+  return wglEnumGpuDevicesNV(hGpu, iDeviceIndex, lpGpuDevice);
+}
+
+static BOOL WINAPI _glewLazy_wglEnumGpusFromAffinityDCNV (HDC hAffinityDC, UINT iGpuIndex, HGPUNV *hGpu)
+{
+  wglEnumGpusFromAffinityDCNV = (PFNWGLENUMGPUSFROMAFFINITYDCNVPROC)glewGetProcAddress((const GLubyte*)"wglEnumGpusFromAffinityDCNV");
+  return wglEnumGpusFromAffinityDCNV(hAffinityDC, iGpuIndex, hGpu);
+}
+
+static BOOL WINAPI _glewLazy_wglEnumGpusNV (UINT iGpuIndex, HGPUNV *phGpu)
+{
+  wglEnumGpusNV = (PFNWGLENUMGPUSNVPROC)glewGetProcAddress((const GLubyte*)"wglEnumGpusNV");
+  return wglEnumGpusNV(iGpuIndex, phGpu);
+}
+
+
+static BOOL WINAPI _glewLazy_wglBindVideoDeviceNV (HDC hDc, unsigned int uVideoSlot, HVIDEOOUTPUTDEVICENV hVideoDevice, const int* piAttribList)
+{
+  wglBindVideoDeviceNV = (PFNWGLBINDVIDEODEVICENVPROC)glewGetProcAddress((const GLubyte*)"wglBindVideoDeviceNV");
+  return wglBindVideoDeviceNV(hDc, uVideoSlot, hVideoDevice, piAttribList);
+}
+
+static int WINAPI _glewLazy_wglEnumerateVideoDevicesNV (HDC hDc, HVIDEOOUTPUTDEVICENV* phDeviceList)
+{
+  wglEnumerateVideoDevicesNV = (PFNWGLENUMERATEVIDEODEVICESNVPROC)glewGetProcAddress((const GLubyte*)"wglEnumerateVideoDevicesNV");
+  return wglEnumerateVideoDevicesNV(hDc, phDeviceList);
+}
+
+static BOOL WINAPI _glewLazy_wglQueryCurrentContextNV (int iAttribute, int* piValue)
+{
+  wglQueryCurrentContextNV = (PFNWGLQUERYCURRENTCONTEXTNVPROC)glewGetProcAddress((const GLubyte*)"wglQueryCurrentContextNV");
+  return wglQueryCurrentContextNV(iAttribute, piValue);
+}
+
+
+static BOOL WINAPI _glewLazy_wglBindSwapBarrierNV (GLuint group, GLuint barrier)
+{
+  wglBindSwapBarrierNV = (PFNWGLBINDSWAPBARRIERNVPROC)glewGetProcAddress((const GLubyte*)"wglBindSwapBarrierNV");
+  return wglBindSwapBarrierNV(group, barrier);
+}
+
+static BOOL WINAPI _glewLazy_wglJoinSwapGroupNV (HDC hDC, GLuint group)
+{
+  wglJoinSwapGroupNV = (PFNWGLJOINSWAPGROUPNVPROC)glewGetProcAddress((const GLubyte*)"wglJoinSwapGroupNV");
+  return wglJoinSwapGroupNV(hDC, group);
+}
+
+static BOOL WINAPI _glewLazy_wglQueryFrameCountNV (HDC hDC, GLuint* count)
+{
+  wglQueryFrameCountNV = (PFNWGLQUERYFRAMECOUNTNVPROC)glewGetProcAddress((const GLubyte*)"wglQueryFrameCountNV");
+  return wglQueryFrameCountNV(hDC, count);
+}
+
+static BOOL WINAPI _glewLazy_wglQueryMaxSwapGroupsNV (HDC hDC, GLuint* maxGroups, GLuint *maxBarriers)
+{
+  wglQueryMaxSwapGroupsNV = (PFNWGLQUERYMAXSWAPGROUPSNVPROC)glewGetProcAddress((const GLubyte*)"wglQueryMaxSwapGroupsNV");
+  return wglQueryMaxSwapGroupsNV(hDC, maxGroups, maxBarriers);
+}
+
+static BOOL WINAPI _glewLazy_wglQuerySwapGroupNV (HDC hDC, GLuint* group, GLuint *barrier)
+{
+  wglQuerySwapGroupNV = (PFNWGLQUERYSWAPGROUPNVPROC)glewGetProcAddress((const GLubyte*)"wglQuerySwapGroupNV");
+  return wglQuerySwapGroupNV(hDC, group, barrier);
+}
+
+static BOOL WINAPI _glewLazy_wglResetFrameCountNV (HDC hDC)
+{
+  wglResetFrameCountNV = (PFNWGLRESETFRAMECOUNTNVPROC)glewGetProcAddress((const GLubyte*)"wglResetFrameCountNV");
+  return wglResetFrameCountNV(hDC);
+}
+
+
+static void * WINAPI _glewLazy_wglAllocateMemoryNV (GLsizei size, GLfloat readFrequency, GLfloat writeFrequency, GLfloat priority)
+{
+  wglAllocateMemoryNV = (PFNWGLALLOCATEMEMORYNVPROC)glewGetProcAddress((const GLubyte*)"wglAllocateMemoryNV");
+  return wglAllocateMemoryNV(size, readFrequency, writeFrequency, priority);
+}
+
+static void WINAPI _glewLazy_wglFreeMemoryNV (void *pointer)
+{
+  wglFreeMemoryNV = (PFNWGLFREEMEMORYNVPROC)glewGetProcAddress((const GLubyte*)"wglFreeMemoryNV");
+  wglFreeMemoryNV(pointer);
+}
+
+
+static BOOL WINAPI _glewLazy_wglBindVideoCaptureDeviceNV (UINT uVideoSlot, HVIDEOINPUTDEVICENV hDevice)
+{
+  wglBindVideoCaptureDeviceNV = (PFNWGLBINDVIDEOCAPTUREDEVICENVPROC)glewGetProcAddress((const GLubyte*)"wglBindVideoCaptureDeviceNV");
+  return wglBindVideoCaptureDeviceNV(uVideoSlot, hDevice);
+}
+
+static UINT WINAPI _glewLazy_wglEnumerateVideoCaptureDevicesNV (HDC hDc, HVIDEOINPUTDEVICENV* phDeviceList)
+{
+  wglEnumerateVideoCaptureDevicesNV = (PFNWGLENUMERATEVIDEOCAPTUREDEVICESNVPROC)glewGetProcAddress((const GLubyte*)"wglEnumerateVideoCaptureDevicesNV");
+  return wglEnumerateVideoCaptureDevicesNV(hDc, phDeviceList);
+}
+
+static BOOL WINAPI _glewLazy_wglLockVideoCaptureDeviceNV (HDC hDc, HVIDEOINPUTDEVICENV hDevice)
+{
+  wglLockVideoCaptureDeviceNV = (PFNWGLLOCKVIDEOCAPTUREDEVICENVPROC)glewGetProcAddress((const GLubyte*)"wglLockVideoCaptureDeviceNV");
+  return wglLockVideoCaptureDeviceNV(hDc, hDevice);
+}
+
+static BOOL WINAPI _glewLazy_wglQueryVideoCaptureDeviceNV (HDC hDc, HVIDEOINPUTDEVICENV hDevice, int iAttribute, int* piValue)
+{
+  wglQueryVideoCaptureDeviceNV = (PFNWGLQUERYVIDEOCAPTUREDEVICENVPROC)glewGetProcAddress((const GLubyte*)"wglQueryVideoCaptureDeviceNV");
+  return wglQueryVideoCaptureDeviceNV(hDc, hDevice, iAttribute, piValue);
+}
+
+static BOOL WINAPI _glewLazy_wglReleaseVideoCaptureDeviceNV (HDC hDc, HVIDEOINPUTDEVICENV hDevice)
+{
+  wglReleaseVideoCaptureDeviceNV = (PFNWGLRELEASEVIDEOCAPTUREDEVICENVPROC)glewGetProcAddress((const GLubyte*)"wglReleaseVideoCaptureDeviceNV");
+  return wglReleaseVideoCaptureDeviceNV(hDc, hDevice);
+}
+
+
+static BOOL WINAPI _glewLazy_wglBindVideoImageNV (HPVIDEODEV hVideoDevice, HPBUFFERARB hPbuffer, int iVideoBuffer)
+{
+  wglBindVideoImageNV = (PFNWGLBINDVIDEOIMAGENVPROC)glewGetProcAddress((const GLubyte*)"wglBindVideoImageNV");
+  return wglBindVideoImageNV(hVideoDevice, hPbuffer, iVideoBuffer);
+}
+
+static BOOL WINAPI _glewLazy_wglGetVideoDeviceNV (HDC hDC, int numDevices, HPVIDEODEV* hVideoDevice)
+{
+  wglGetVideoDeviceNV = (PFNWGLGETVIDEODEVICENVPROC)glewGetProcAddress((const GLubyte*)"wglGetVideoDeviceNV");
+  return wglGetVideoDeviceNV(hDC, numDevices, hVideoDevice);
+}
+
+static BOOL WINAPI _glewLazy_wglGetVideoInfoNV (HPVIDEODEV hpVideoDevice, unsigned long* pulCounterOutputPbuffer, unsigned long *pulCounterOutputVideo)
+{
+  wglGetVideoInfoNV = (PFNWGLGETVIDEOINFONVPROC)glewGetProcAddress((const GLubyte*)"wglGetVideoInfoNV");
+  return wglGetVideoInfoNV(hpVideoDevice, pulCounterOutputPbuffer, pulCounterOutputVideo);
+}
+
+static BOOL WINAPI _glewLazy_wglReleaseVideoDeviceNV (HPVIDEODEV hVideoDevice)
+{
+  wglReleaseVideoDeviceNV = (PFNWGLRELEASEVIDEODEVICENVPROC)glewGetProcAddress((const GLubyte*)"wglReleaseVideoDeviceNV");
+  return wglReleaseVideoDeviceNV(hVideoDevice);
+}
+
+static BOOL WINAPI _glewLazy_wglReleaseVideoImageNV (HPBUFFERARB hPbuffer, int iVideoBuffer)
+{
+  wglReleaseVideoImageNV = (PFNWGLRELEASEVIDEOIMAGENVPROC)glewGetProcAddress((const GLubyte*)"wglReleaseVideoImageNV");
+  return wglReleaseVideoImageNV(hPbuffer, iVideoBuffer);
+}
+
+static BOOL WINAPI _glewLazy_wglSendPbufferToVideoNV (HPBUFFERARB hPbuffer, int iBufferType, unsigned long* pulCounterPbuffer, BOOL bBlock)
+{
+  wglSendPbufferToVideoNV = (PFNWGLSENDPBUFFERTOVIDEONVPROC)glewGetProcAddress((const GLubyte*)"wglSendPbufferToVideoNV");
+  return wglSendPbufferToVideoNV(hPbuffer, iBufferType, pulCounterPbuffer, bBlock);
+}
+
+
+static BOOL WINAPI _glewLazy_wglGetMscRateOML (HDC hdc, INT32* numerator, INT32 *denominator)
+{
+  wglGetMscRateOML = (PFNWGLGETMSCRATEOMLPROC)glewGetProcAddress((const GLubyte*)"wglGetMscRateOML");
+  return wglGetMscRateOML(hdc, numerator, denominator);
+}
+
+static BOOL WINAPI _glewLazy_wglGetSyncValuesOML (HDC hdc, INT64* ust, INT64 *msc, INT64 *sbc)
+{
+  wglGetSyncValuesOML = (PFNWGLGETSYNCVALUESOMLPROC)glewGetProcAddress((const GLubyte*)"wglGetSyncValuesOML");
+  return wglGetSyncValuesOML(hdc, ust, msc, sbc);
+}
+
+static INT64 WINAPI _glewLazy_wglSwapBuffersMscOML (HDC hdc, INT64 target_msc, INT64 divisor, INT64 remainder)
+{
+  wglSwapBuffersMscOML = (PFNWGLSWAPBUFFERSMSCOMLPROC)glewGetProcAddress((const GLubyte*)"wglSwapBuffersMscOML");
+  return wglSwapBuffersMscOML(hdc, target_msc, divisor, remainder);
+}
+
+static INT64 WINAPI _glewLazy_wglSwapLayerBuffersMscOML (HDC hdc, INT fuPlanes, INT64 target_msc, INT64 divisor, INT64 remainder)
+{
+  wglSwapLayerBuffersMscOML = (PFNWGLSWAPLAYERBUFFERSMSCOMLPROC)glewGetProcAddress((const GLubyte*)"wglSwapLayerBuffersMscOML");
+  return wglSwapLayerBuffersMscOML(hdc, fuPlanes, target_msc, divisor, remainder);
+}
+
+static BOOL WINAPI _glewLazy_wglWaitForMscOML (HDC hdc, INT64 target_msc, INT64 divisor, INT64 remainder, INT64* ust, INT64 *msc, INT64 *sbc)
+{
+  wglWaitForMscOML = (PFNWGLWAITFORMSCOMLPROC)glewGetProcAddress((const GLubyte*)"wglWaitForMscOML");
+  return wglWaitForMscOML(hdc, target_msc, divisor, remainder, ust, msc, sbc);
+}
+
+static BOOL WINAPI _glewLazy_wglWaitForSbcOML (HDC hdc, INT64 target_sbc, INT64* ust, INT64 *msc, INT64 *sbc)
+{
+  wglWaitForSbcOML = (PFNWGLWAITFORSBCOMLPROC)glewGetProcAddress((const GLubyte*)"wglWaitForSbcOML");
+  return wglWaitForSbcOML(hdc, target_sbc, ust, msc, sbc);
+}
+
+
+PFNWGLSETSTEREOEMITTERSTATE3DLPROC __wglewSetStereoEmitterState3DL = _glewLazy_wglSetStereoEmitterState3DL;
+
+PFNWGLBLITCONTEXTFRAMEBUFFERAMDPROC __wglewBlitContextFramebufferAMD = _glewLazy_wglBlitContextFramebufferAMD;
+PFNWGLCREATEASSOCIATEDCONTEXTAMDPROC __wglewCreateAssociatedContextAMD = _glewLazy_wglCreateAssociatedContextAMD;
+PFNWGLCREATEASSOCIATEDCONTEXTATTRIBSAMDPROC __wglewCreateAssociatedContextAttribsAMD = _glewLazy_wglCreateAssociatedContextAttribsAMD;
+PFNWGLDELETEASSOCIATEDCONTEXTAMDPROC __wglewDeleteAssociatedContextAMD = _glewLazy_wglDeleteAssociatedContextAMD;
+PFNWGLGETCONTEXTGPUIDAMDPROC __wglewGetContextGPUIDAMD = _glewLazy_wglGetContextGPUIDAMD;
+PFNWGLGETCURRENTASSOCIATEDCONTEXTAMDPROC __wglewGetCurrentAssociatedContextAMD = _glewLazy_wglGetCurrentAssociatedContextAMD;
+PFNWGLGETGPUIDSAMDPROC __wglewGetGPUIDsAMD = _glewLazy_wglGetGPUIDsAMD;
+PFNWGLGETGPUINFOAMDPROC __wglewGetGPUInfoAMD = _glewLazy_wglGetGPUInfoAMD;
+PFNWGLMAKEASSOCIATEDCONTEXTCURRENTAMDPROC __wglewMakeAssociatedContextCurrentAMD = _glewLazy_wglMakeAssociatedContextCurrentAMD;
+
+PFNWGLCREATEBUFFERREGIONARBPROC __wglewCreateBufferRegionARB = _glewLazy_wglCreateBufferRegionARB;
+PFNWGLDELETEBUFFERREGIONARBPROC __wglewDeleteBufferRegionARB = _glewLazy_wglDeleteBufferRegionARB;
+PFNWGLRESTOREBUFFERREGIONARBPROC __wglewRestoreBufferRegionARB = _glewLazy_wglRestoreBufferRegionARB;
+PFNWGLSAVEBUFFERREGIONARBPROC __wglewSaveBufferRegionARB = _glewLazy_wglSaveBufferRegionARB;
+
+PFNWGLCREATECONTEXTATTRIBSARBPROC __wglewCreateContextAttribsARB = _glewLazy_wglCreateContextAttribsARB;
+
+PFNWGLGETEXTENSIONSSTRINGARBPROC __wglewGetExtensionsStringARB = _glewLazy_wglGetExtensionsStringARB;
+
+PFNWGLGETCURRENTREADDCARBPROC __wglewGetCurrentReadDCARB = _glewLazy_wglGetCurrentReadDCARB;
+PFNWGLMAKECONTEXTCURRENTARBPROC __wglewMakeContextCurrentARB = _glewLazy_wglMakeContextCurrentARB;
+
+PFNWGLCREATEPBUFFERARBPROC __wglewCreatePbufferARB = _glewLazy_wglCreatePbufferARB;
+PFNWGLDESTROYPBUFFERARBPROC __wglewDestroyPbufferARB = _glewLazy_wglDestroyPbufferARB;
+PFNWGLGETPBUFFERDCARBPROC __wglewGetPbufferDCARB = _glewLazy_wglGetPbufferDCARB;
+PFNWGLQUERYPBUFFERARBPROC __wglewQueryPbufferARB = _glewLazy_wglQueryPbufferARB;
+PFNWGLRELEASEPBUFFERDCARBPROC __wglewReleasePbufferDCARB = _glewLazy_wglReleasePbufferDCARB;
+
+PFNWGLCHOOSEPIXELFORMATARBPROC __wglewChoosePixelFormatARB = _glewLazy_wglChoosePixelFormatARB;
+PFNWGLGETPIXELFORMATATTRIBFVARBPROC __wglewGetPixelFormatAttribfvARB = _glewLazy_wglGetPixelFormatAttribfvARB;
+PFNWGLGETPIXELFORMATATTRIBIVARBPROC __wglewGetPixelFormatAttribivARB = _glewLazy_wglGetPixelFormatAttribivARB;
+
+PFNWGLBINDTEXIMAGEARBPROC __wglewBindTexImageARB = _glewLazy_wglBindTexImageARB;
+PFNWGLRELEASETEXIMAGEARBPROC __wglewReleaseTexImageARB = _glewLazy_wglReleaseTexImageARB;
+PFNWGLSETPBUFFERATTRIBARBPROC __wglewSetPbufferAttribARB = _glewLazy_wglSetPbufferAttribARB;
+
+PFNWGLBINDDISPLAYCOLORTABLEEXTPROC __wglewBindDisplayColorTableEXT = _glewLazy_wglBindDisplayColorTableEXT;
+PFNWGLCREATEDISPLAYCOLORTABLEEXTPROC __wglewCreateDisplayColorTableEXT = _glewLazy_wglCreateDisplayColorTableEXT;
+PFNWGLDESTROYDISPLAYCOLORTABLEEXTPROC __wglewDestroyDisplayColorTableEXT = _glewLazy_wglDestroyDisplayColorTableEXT;
+PFNWGLLOADDISPLAYCOLORTABLEEXTPROC __wglewLoadDisplayColorTableEXT = _glewLazy_wglLoadDisplayColorTableEXT;
+
+PFNWGLGETEXTENSIONSSTRINGEXTPROC __wglewGetExtensionsStringEXT = _glewLazy_wglGetExtensionsStringEXT;
+
+PFNWGLGETCURRENTREADDCEXTPROC __wglewGetCurrentReadDCEXT = _glewLazy_wglGetCurrentReadDCEXT;
+PFNWGLMAKECONTEXTCURRENTEXTPROC __wglewMakeContextCurrentEXT = _glewLazy_wglMakeContextCurrentEXT;
+
+PFNWGLCREATEPBUFFEREXTPROC __wglewCreatePbufferEXT = _glewLazy_wglCreatePbufferEXT;
+PFNWGLDESTROYPBUFFEREXTPROC __wglewDestroyPbufferEXT = _glewLazy_wglDestroyPbufferEXT;
+PFNWGLGETPBUFFERDCEXTPROC __wglewGetPbufferDCEXT = _glewLazy_wglGetPbufferDCEXT;
+PFNWGLQUERYPBUFFEREXTPROC __wglewQueryPbufferEXT = _glewLazy_wglQueryPbufferEXT;
+PFNWGLRELEASEPBUFFERDCEXTPROC __wglewReleasePbufferDCEXT = _glewLazy_wglReleasePbufferDCEXT;
+
+PFNWGLCHOOSEPIXELFORMATEXTPROC __wglewChoosePixelFormatEXT = _glewLazy_wglChoosePixelFormatEXT;
+PFNWGLGETPIXELFORMATATTRIBFVEXTPROC __wglewGetPixelFormatAttribfvEXT = _glewLazy_wglGetPixelFormatAttribfvEXT;
+PFNWGLGETPIXELFORMATATTRIBIVEXTPROC __wglewGetPixelFormatAttribivEXT = _glewLazy_wglGetPixelFormatAttribivEXT;
+
+PFNWGLGETSWAPINTERVALEXTPROC __wglewGetSwapIntervalEXT = _glewLazy_wglGetSwapIntervalEXT;
+PFNWGLSWAPINTERVALEXTPROC __wglewSwapIntervalEXT = _glewLazy_wglSwapIntervalEXT;
+
+PFNWGLGETDIGITALVIDEOPARAMETERSI3DPROC __wglewGetDigitalVideoParametersI3D = _glewLazy_wglGetDigitalVideoParametersI3D;
+PFNWGLSETDIGITALVIDEOPARAMETERSI3DPROC __wglewSetDigitalVideoParametersI3D = _glewLazy_wglSetDigitalVideoParametersI3D;
+
+PFNWGLGETGAMMATABLEI3DPROC __wglewGetGammaTableI3D = _glewLazy_wglGetGammaTableI3D;
+PFNWGLGETGAMMATABLEPARAMETERSI3DPROC __wglewGetGammaTableParametersI3D = _glewLazy_wglGetGammaTableParametersI3D;
+PFNWGLSETGAMMATABLEI3DPROC __wglewSetGammaTableI3D = _glewLazy_wglSetGammaTableI3D;
+PFNWGLSETGAMMATABLEPARAMETERSI3DPROC __wglewSetGammaTableParametersI3D = _glewLazy_wglSetGammaTableParametersI3D;
+
+PFNWGLDISABLEGENLOCKI3DPROC __wglewDisableGenlockI3D = _glewLazy_wglDisableGenlockI3D;
+PFNWGLENABLEGENLOCKI3DPROC __wglewEnableGenlockI3D = _glewLazy_wglEnableGenlockI3D;
+PFNWGLGENLOCKSAMPLERATEI3DPROC __wglewGenlockSampleRateI3D = _glewLazy_wglGenlockSampleRateI3D;
+PFNWGLGENLOCKSOURCEDELAYI3DPROC __wglewGenlockSourceDelayI3D = _glewLazy_wglGenlockSourceDelayI3D;
+PFNWGLGENLOCKSOURCEEDGEI3DPROC __wglewGenlockSourceEdgeI3D = _glewLazy_wglGenlockSourceEdgeI3D;
+PFNWGLGENLOCKSOURCEI3DPROC __wglewGenlockSourceI3D = _glewLazy_wglGenlockSourceI3D;
+PFNWGLGETGENLOCKSAMPLERATEI3DPROC __wglewGetGenlockSampleRateI3D = _glewLazy_wglGetGenlockSampleRateI3D;
+PFNWGLGETGENLOCKSOURCEDELAYI3DPROC __wglewGetGenlockSourceDelayI3D = _glewLazy_wglGetGenlockSourceDelayI3D;
+PFNWGLGETGENLOCKSOURCEEDGEI3DPROC __wglewGetGenlockSourceEdgeI3D = _glewLazy_wglGetGenlockSourceEdgeI3D;
+PFNWGLGETGENLOCKSOURCEI3DPROC __wglewGetGenlockSourceI3D = _glewLazy_wglGetGenlockSourceI3D;
+PFNWGLISENABLEDGENLOCKI3DPROC __wglewIsEnabledGenlockI3D = _glewLazy_wglIsEnabledGenlockI3D;
+PFNWGLQUERYGENLOCKMAXSOURCEDELAYI3DPROC __wglewQueryGenlockMaxSourceDelayI3D = _glewLazy_wglQueryGenlockMaxSourceDelayI3D;
+
+PFNWGLASSOCIATEIMAGEBUFFEREVENTSI3DPROC __wglewAssociateImageBufferEventsI3D = _glewLazy_wglAssociateImageBufferEventsI3D;
+PFNWGLCREATEIMAGEBUFFERI3DPROC __wglewCreateImageBufferI3D = _glewLazy_wglCreateImageBufferI3D;
+PFNWGLDESTROYIMAGEBUFFERI3DPROC __wglewDestroyImageBufferI3D = _glewLazy_wglDestroyImageBufferI3D;
+PFNWGLRELEASEIMAGEBUFFEREVENTSI3DPROC __wglewReleaseImageBufferEventsI3D = _glewLazy_wglReleaseImageBufferEventsI3D;
+
+PFNWGLDISABLEFRAMELOCKI3DPROC __wglewDisableFrameLockI3D = _glewLazy_wglDisableFrameLockI3D;
+PFNWGLENABLEFRAMELOCKI3DPROC __wglewEnableFrameLockI3D = _glewLazy_wglEnableFrameLockI3D;
+PFNWGLISENABLEDFRAMELOCKI3DPROC __wglewIsEnabledFrameLockI3D = _glewLazy_wglIsEnabledFrameLockI3D;
+PFNWGLQUERYFRAMELOCKMASTERI3DPROC __wglewQueryFrameLockMasterI3D = _glewLazy_wglQueryFrameLockMasterI3D;
+
+PFNWGLBEGINFRAMETRACKINGI3DPROC __wglewBeginFrameTrackingI3D = _glewLazy_wglBeginFrameTrackingI3D;
+PFNWGLENDFRAMETRACKINGI3DPROC __wglewEndFrameTrackingI3D = _glewLazy_wglEndFrameTrackingI3D;
+PFNWGLGETFRAMEUSAGEI3DPROC __wglewGetFrameUsageI3D = _glewLazy_wglGetFrameUsageI3D;
+PFNWGLQUERYFRAMETRACKINGI3DPROC __wglewQueryFrameTrackingI3D = _glewLazy_wglQueryFrameTrackingI3D;
+
+PFNWGLDXCLOSEDEVICENVPROC __wglewDXCloseDeviceNV = _glewLazy_wglDXCloseDeviceNV;
+PFNWGLDXLOCKOBJECTSNVPROC __wglewDXLockObjectsNV = _glewLazy_wglDXLockObjectsNV;
+PFNWGLDXOBJECTACCESSNVPROC __wglewDXObjectAccessNV = _glewLazy_wglDXObjectAccessNV;
+PFNWGLDXOPENDEVICENVPROC __wglewDXOpenDeviceNV = _glewLazy_wglDXOpenDeviceNV;
+PFNWGLDXREGISTEROBJECTNVPROC __wglewDXRegisterObjectNV = _glewLazy_wglDXRegisterObjectNV;
+PFNWGLDXSETRESOURCESHAREHANDLENVPROC __wglewDXSetResourceShareHandleNV = _glewLazy_wglDXSetResourceShareHandleNV;
+PFNWGLDXUNLOCKOBJECTSNVPROC __wglewDXUnlockObjectsNV = _glewLazy_wglDXUnlockObjectsNV;
+PFNWGLDXUNREGISTEROBJECTNVPROC __wglewDXUnregisterObjectNV = _glewLazy_wglDXUnregisterObjectNV;
+
+PFNWGLCOPYIMAGESUBDATANVPROC __wglewCopyImageSubDataNV = _glewLazy_wglCopyImageSubDataNV;
+
+PFNWGLDELAYBEFORESWAPNVPROC __wglewDelayBeforeSwapNV = _glewLazy_wglDelayBeforeSwapNV;
+
+PFNWGLCREATEAFFINITYDCNVPROC __wglewCreateAffinityDCNV = _glewLazy_wglCreateAffinityDCNV;
+PFNWGLDELETEDCNVPROC __wglewDeleteDCNV = _glewLazy_wglDeleteDCNV;
+PFNWGLENUMGPUDEVICESNVPROC __wglewEnumGpuDevicesNV = _glewLazy_wglEnumGpuDevicesNV;
+PFNWGLENUMGPUSFROMAFFINITYDCNVPROC __wglewEnumGpusFromAffinityDCNV = _glewLazy_wglEnumGpusFromAffinityDCNV;
+PFNWGLENUMGPUSNVPROC __wglewEnumGpusNV = _glewLazy_wglEnumGpusNV;
+
+PFNWGLBINDVIDEODEVICENVPROC __wglewBindVideoDeviceNV = _glewLazy_wglBindVideoDeviceNV;
+PFNWGLENUMERATEVIDEODEVICESNVPROC __wglewEnumerateVideoDevicesNV = _glewLazy_wglEnumerateVideoDevicesNV;
+PFNWGLQUERYCURRENTCONTEXTNVPROC __wglewQueryCurrentContextNV = _glewLazy_wglQueryCurrentContextNV;
+
+PFNWGLBINDSWAPBARRIERNVPROC __wglewBindSwapBarrierNV = _glewLazy_wglBindSwapBarrierNV;
+PFNWGLJOINSWAPGROUPNVPROC __wglewJoinSwapGroupNV = _glewLazy_wglJoinSwapGroupNV;
+PFNWGLQUERYFRAMECOUNTNVPROC __wglewQueryFrameCountNV = _glewLazy_wglQueryFrameCountNV;
+PFNWGLQUERYMAXSWAPGROUPSNVPROC __wglewQueryMaxSwapGroupsNV = _glewLazy_wglQueryMaxSwapGroupsNV;
+PFNWGLQUERYSWAPGROUPNVPROC __wglewQuerySwapGroupNV = _glewLazy_wglQuerySwapGroupNV;
+PFNWGLRESETFRAMECOUNTNVPROC __wglewResetFrameCountNV = _glewLazy_wglResetFrameCountNV;
+
+PFNWGLALLOCATEMEMORYNVPROC __wglewAllocateMemoryNV = _glewLazy_wglAllocateMemoryNV;
+PFNWGLFREEMEMORYNVPROC __wglewFreeMemoryNV = _glewLazy_wglFreeMemoryNV;
+
+PFNWGLBINDVIDEOCAPTUREDEVICENVPROC __wglewBindVideoCaptureDeviceNV = _glewLazy_wglBindVideoCaptureDeviceNV;
+PFNWGLENUMERATEVIDEOCAPTUREDEVICESNVPROC __wglewEnumerateVideoCaptureDevicesNV = _glewLazy_wglEnumerateVideoCaptureDevicesNV;
+PFNWGLLOCKVIDEOCAPTUREDEVICENVPROC __wglewLockVideoCaptureDeviceNV = _glewLazy_wglLockVideoCaptureDeviceNV;
+PFNWGLQUERYVIDEOCAPTUREDEVICENVPROC __wglewQueryVideoCaptureDeviceNV = _glewLazy_wglQueryVideoCaptureDeviceNV;
+PFNWGLRELEASEVIDEOCAPTUREDEVICENVPROC __wglewReleaseVideoCaptureDeviceNV = _glewLazy_wglReleaseVideoCaptureDeviceNV;
+
+PFNWGLBINDVIDEOIMAGENVPROC __wglewBindVideoImageNV = _glewLazy_wglBindVideoImageNV;
+PFNWGLGETVIDEODEVICENVPROC __wglewGetVideoDeviceNV = _glewLazy_wglGetVideoDeviceNV;
+PFNWGLGETVIDEOINFONVPROC __wglewGetVideoInfoNV = _glewLazy_wglGetVideoInfoNV;
+PFNWGLRELEASEVIDEODEVICENVPROC __wglewReleaseVideoDeviceNV = _glewLazy_wglReleaseVideoDeviceNV;
+PFNWGLRELEASEVIDEOIMAGENVPROC __wglewReleaseVideoImageNV = _glewLazy_wglReleaseVideoImageNV;
+PFNWGLSENDPBUFFERTOVIDEONVPROC __wglewSendPbufferToVideoNV = _glewLazy_wglSendPbufferToVideoNV;
+
+PFNWGLGETMSCRATEOMLPROC __wglewGetMscRateOML = _glewLazy_wglGetMscRateOML;
+PFNWGLGETSYNCVALUESOMLPROC __wglewGetSyncValuesOML = _glewLazy_wglGetSyncValuesOML;
+PFNWGLSWAPBUFFERSMSCOMLPROC __wglewSwapBuffersMscOML = _glewLazy_wglSwapBuffersMscOML;
+PFNWGLSWAPLAYERBUFFERSMSCOMLPROC __wglewSwapLayerBuffersMscOML = _glewLazy_wglSwapLayerBuffersMscOML;
+PFNWGLWAITFORMSCOMLPROC __wglewWaitForMscOML = _glewLazy_wglWaitForMscOML;
+PFNWGLWAITFORSBCOMLPROC __wglewWaitForSbcOML = _glewLazy_wglWaitForSbcOML;
+
+#elif !defined(__ANDROID__) && !defined(__native_client__) && !defined(__HAIKU__) && (!defined(__APPLE__) || defined(GLEW_APPLE_GLX))
+
+static Display* _glewLazy_glXGetCurrentDisplay (void)
+{
+  glXGetCurrentDisplay = (PFNGLXGETCURRENTDISPLAYPROC)glewGetProcAddress((const GLubyte*)"glXGetCurrentDisplay");
+  return glXGetCurrentDisplay();
+}
+
+
+static GLXFBConfig* _glewLazy_glXChooseFBConfig (Display *dpy, int screen, const int *attrib_list, int *nelements)
+{
+  glXChooseFBConfig = (PFNGLXCHOOSEFBCONFIGPROC)glewGetProcAddress((const GLubyte*)"glXChooseFBConfig");
+  return glXChooseFBConfig(dpy, screen, attrib_list, nelements);
+}
+
+static GLXContext _glewLazy_glXCreateNewContext (Display *dpy, GLXFBConfig config, int render_type, GLXContext share_list, Bool direct)
+{
+  glXCreateNewContext = (PFNGLXCREATENEWCONTEXTPROC)glewGetProcAddress((const GLubyte*)"glXCreateNewContext");
+  return glXCreateNewContext(dpy, config, render_type, share_list, direct);
+}
+
+static GLXPbuffer _glewLazy_glXCreatePbuffer (Display *dpy, GLXFBConfig config, const int *attrib_list)
+{
+  glXCreatePbuffer = (PFNGLXCREATEPBUFFERPROC)glewGetProcAddress((const GLubyte*)"glXCreatePbuffer");
+  return glXCreatePbuffer(dpy, config, attrib_list);
+}
+
+static GLXPixmap _glewLazy_glXCreatePixmap (Display *dpy, GLXFBConfig config, Pixmap pixmap, const int *attrib_list)
+{
+  glXCreatePixmap = (PFNGLXCREATEPIXMAPPROC)glewGetProcAddress((const GLubyte*)"glXCreatePixmap");
+  return glXCreatePixmap(dpy, config, pixmap, attrib_list);
+}
+
+static GLXWindow _glewLazy_glXCreateWindow (Display *dpy, GLXFBConfig config, Window win, const int *attrib_list)
+{
+  glXCreateWindow = (PFNGLXCREATEWINDOWPROC)glewGetProcAddress((const GLubyte*)"glXCreateWindow");
+  return glXCreateWindow(dpy, config, win, attrib_list);
+}
+
+static void _glewLazy_glXDestroyPbuffer (Display *dpy, GLXPbuffer pbuf)
+{
+  glXDestroyPbuffer = (PFNGLXDESTROYPBUFFERPROC)glewGetProcAddress((const GLubyte*)"glXDestroyPbuffer");
+  glXDestroyPbuffer(dpy, pbuf);
+}
+
+static void _glewLazy_glXDestroyPixmap (Display *dpy, GLXPixmap pixmap)
+{
+  glXDestroyPixmap = (PFNGLXDESTROYPIXMAPPROC)glewGetProcAddress((const GLubyte*)"glXDestroyPixmap");
+  glXDestroyPixmap(dpy, pixmap);
+}
+
+static void _glewLazy_glXDestroyWindow (Display *dpy, GLXWindow win)
+{
+  glXDestroyWindow = (PFNGLXDESTROYWINDOWPROC)glewGetProcAddress((const GLubyte*)"glXDestroyWindow");
+  glXDestroyWindow(dpy, win);
+}
+
+static GLXDrawable _glewLazy_glXGetCurrentReadDrawable (void)
+{
+  glXGetCurrentReadDrawable = (PFNGLXGETCURRENTREADDRAWABLEPROC)glewGetProcAddress((const GLubyte*)"glXGetCurrentReadDrawable");
+  return glXGetCurrentReadDrawable();
+}
+
+static int _glewLazy_glXGetFBConfigAttrib (Display *dpy, GLXFBConfig config, int attribute, int *value)
+{
+  glXGetFBConfigAttrib = (PFNGLXGETFBCONFIGATTRIBPROC)glewGetProcAddress((const GLubyte*)"glXGetFBConfigAttrib");
+  return glXGetFBConfigAttrib(dpy, config, attribute, value);
+}
+
+static GLXFBConfig* _glewLazy_glXGetFBConfigs (Display *dpy, int screen, int *nelements)
+{
+  glXGetFBConfigs = (PFNGLXGETFBCONFIGSPROC)glewGetProcAddress((const GLubyte*)"glXGetFBConfigs");
+  return glXGetFBConfigs(dpy, screen, nelements);
+}
+
+static void _glewLazy_glXGetSelectedEvent (Display *dpy, GLXDrawable draw, unsigned long *event_mask)
+{
+  glXGetSelectedEvent = (PFNGLXGETSELECTEDEVENTPROC)glewGetProcAddress((const GLubyte*)"glXGetSelectedEvent");
+  glXGetSelectedEvent(dpy, draw, event_mask);
+}
+
+static XVisualInfo* _glewLazy_glXGetVisualFromFBConfig (Display *dpy, GLXFBConfig config)
+{
+  glXGetVisualFromFBConfig = (PFNGLXGETVISUALFROMFBCONFIGPROC)glewGetProcAddress((const GLubyte*)"glXGetVisualFromFBConfig");
+  return glXGetVisualFromFBConfig(dpy, config);
+}
+
+static Bool _glewLazy_glXMakeContextCurrent (Display *display, GLXDrawable draw, GLXDrawable read, GLXContext ctx)
+{
+  glXMakeContextCurrent = (PFNGLXMAKECONTEXTCURRENTPROC)glewGetProcAddress((const GLubyte*)"glXMakeContextCurrent");
+  return glXMakeContextCurrent(display, draw, read, ctx);
+}
+
+static int _glewLazy_glXQueryContext (Display *dpy, GLXContext ctx, int attribute, int *value)
+{
+  glXQueryContext = (PFNGLXQUERYCONTEXTPROC)glewGetProcAddress((const GLubyte*)"glXQueryContext");
+  return glXQueryContext(dpy, ctx, attribute, value);
+}
+
+static void _glewLazy_glXQueryDrawable (Display *dpy, GLXDrawable draw, int attribute, unsigned int *value)
+{
+  glXQueryDrawable = (PFNGLXQUERYDRAWABLEPROC)glewGetProcAddress((const GLubyte*)"glXQueryDrawable");
+  glXQueryDrawable(dpy, draw, attribute, value);
+}
+
+static void _glewLazy_glXSelectEvent (Display *dpy, GLXDrawable draw, unsigned long event_mask)
+{
+  glXSelectEvent = (PFNGLXSELECTEVENTPROC)glewGetProcAddress((const GLubyte*)"glXSelectEvent");
+  glXSelectEvent(dpy, draw, event_mask);
+}
+
+
+PFNGLXGETCURRENTDISPLAYPROC __glewXGetCurrentDisplay = _glewLazy_glXGetCurrentDisplay;
+
+PFNGLXCHOOSEFBCONFIGPROC __glewXChooseFBConfig = _glewLazy_glXChooseFBConfig;
+PFNGLXCREATENEWCONTEXTPROC __glewXCreateNewContext = _glewLazy_glXCreateNewContext;
+PFNGLXCREATEPBUFFERPROC __glewXCreatePbuffer = _glewLazy_glXCreatePbuffer;
+PFNGLXCREATEPIXMAPPROC __glewXCreatePixmap = _glewLazy_glXCreatePixmap;
+PFNGLXCREATEWINDOWPROC __glewXCreateWindow = _glewLazy_glXCreateWindow;
+PFNGLXDESTROYPBUFFERPROC __glewXDestroyPbuffer = _glewLazy_glXDestroyPbuffer;
+PFNGLXDESTROYPIXMAPPROC __glewXDestroyPixmap = _glewLazy_glXDestroyPixmap;
+PFNGLXDESTROYWINDOWPROC __glewXDestroyWindow = _glewLazy_glXDestroyWindow;
+PFNGLXGETCURRENTREADDRAWABLEPROC __glewXGetCurrentReadDrawable = _glewLazy_glXGetCurrentReadDrawable;
+PFNGLXGETFBCONFIGATTRIBPROC __glewXGetFBConfigAttrib = _glewLazy_glXGetFBConfigAttrib;
+PFNGLXGETFBCONFIGSPROC __glewXGetFBConfigs = _glewLazy_glXGetFBConfigs;
+PFNGLXGETSELECTEDEVENTPROC __glewXGetSelectedEvent = _glewLazy_glXGetSelectedEvent;
+PFNGLXGETVISUALFROMFBCONFIGPROC __glewXGetVisualFromFBConfig = _glewLazy_glXGetVisualFromFBConfig;
+PFNGLXMAKECONTEXTCURRENTPROC __glewXMakeContextCurrent = _glewLazy_glXMakeContextCurrent;
+PFNGLXQUERYCONTEXTPROC __glewXQueryContext = _glewLazy_glXQueryContext;
+PFNGLXQUERYDRAWABLEPROC __glewXQueryDrawable = _glewLazy_glXQueryDrawable;
+PFNGLXSELECTEVENTPROC __glewXSelectEvent = _glewLazy_glXSelectEvent;
+
+static void _glewLazy_glXBlitContextFramebufferAMD (GLXContext dstCtx, GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter)
+{
+  glXBlitContextFramebufferAMD = (PFNGLXBLITCONTEXTFRAMEBUFFERAMDPROC)glewGetProcAddress((const GLubyte*)"glXBlitContextFramebufferAMD");
+  glXBlitContextFramebufferAMD(dstCtx, srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+}
+
+static GLXContext _glewLazy_glXCreateAssociatedContextAMD (unsigned int id, GLXContext share_list)
+{
+  glXCreateAssociatedContextAMD = (PFNGLXCREATEASSOCIATEDCONTEXTAMDPROC)glewGetProcAddress((const GLubyte*)"glXCreateAssociatedContextAMD");
+  return glXCreateAssociatedContextAMD(id, share_list);
+}
+
+static GLXContext _glewLazy_glXCreateAssociatedContextAttribsAMD (unsigned int id, GLXContext share_context, const int* attribList)
+{
+  glXCreateAssociatedContextAttribsAMD = (PFNGLXCREATEASSOCIATEDCONTEXTATTRIBSAMDPROC)glewGetProcAddress((const GLubyte*)"glXCreateAssociatedContextAttribsAMD");
+  return glXCreateAssociatedContextAttribsAMD(id, share_context, attribList);
+}
+
+static Bool _glewLazy_glXDeleteAssociatedContextAMD (GLXContext ctx)
+{
+  glXDeleteAssociatedContextAMD = (PFNGLXDELETEASSOCIATEDCONTEXTAMDPROC)glewGetProcAddress((const GLubyte*)"glXDeleteAssociatedContextAMD");
+  return glXDeleteAssociatedContextAMD(ctx);
+}
+
+static unsigned int _glewLazy_glXGetContextGPUIDAMD (GLXContext ctx)
+{
+  glXGetContextGPUIDAMD = (PFNGLXGETCONTEXTGPUIDAMDPROC)glewGetProcAddress((const GLubyte*)"glXGetContextGPUIDAMD");
+  return glXGetContextGPUIDAMD(ctx);
+}
+
+static GLXContext _glewLazy_glXGetCurrentAssociatedContextAMD (void)
+{
+  glXGetCurrentAssociatedContextAMD = (PFNGLXGETCURRENTASSOCIATEDCONTEXTAMDPROC)glewGetProcAddress((const GLubyte*)"glXGetCurrentAssociatedContextAMD");
+  return glXGetCurrentAssociatedContextAMD();
+}
+
+static unsigned int _glewLazy_glXGetGPUIDsAMD (unsigned int maxCount, unsigned int* ids)
+{
+  glXGetGPUIDsAMD = (PFNGLXGETGPUIDSAMDPROC)glewGetProcAddress((const GLubyte*)"glXGetGPUIDsAMD");
+  return glXGetGPUIDsAMD(maxCount, ids);
+}
+
+static int _glewLazy_glXGetGPUInfoAMD (unsigned int id, int property, GLenum dataType, unsigned int size, void* data)
+{
+  glXGetGPUInfoAMD = (PFNGLXGETGPUINFOAMDPROC)glewGetProcAddress((const GLubyte*)"glXGetGPUInfoAMD");
+  return glXGetGPUInfoAMD(id, property, dataType, size, data);
+}
+
+static Bool _glewLazy_glXMakeAssociatedContextCurrentAMD (GLXContext ctx)
+{
+  glXMakeAssociatedContextCurrentAMD = (PFNGLXMAKEASSOCIATEDCONTEXTCURRENTAMDPROC)glewGetProcAddress((const GLubyte*)"glXMakeAssociatedContextCurrentAMD");
+  return glXMakeAssociatedContextCurrentAMD(ctx);
+}
+
+
+static GLXContext _glewLazy_glXCreateContextAttribsARB (Display* dpy, GLXFBConfig config, GLXContext share_context, Bool direct, const int *attrib_list)
+{
+  glXCreateContextAttribsARB = (PFNGLXCREATECONTEXTATTRIBSARBPROC)glewGetProcAddress((const GLubyte*)"glXCreateContextAttribsARB");
+  return glXCreateContextAttribsARB(dpy, config, share_context, direct, attrib_list);
+}
+
+
+static void _glewLazy_glXBindTexImageATI (Display *dpy, GLXPbuffer pbuf, int buffer)
+{
+  glXBindTexImageATI = (PFNGLXBINDTEXIMAGEATIPROC)glewGetProcAddress((const GLubyte*)"glXBindTexImageATI");
+  glXBindTexImageATI(dpy, pbuf, buffer);
+}
+
+static void _glewLazy_glXDrawableAttribATI (Display *dpy, GLXDrawable draw, const int *attrib_list)
+{
+  glXDrawableAttribATI = (PFNGLXDRAWABLEATTRIBATIPROC)glewGetProcAddress((const GLubyte*)"glXDrawableAttribATI");
+  glXDrawableAttribATI(dpy, draw, attrib_list);
+}
+
+static void _glewLazy_glXReleaseTexImageATI (Display *dpy, GLXPbuffer pbuf, int buffer)
+{
+  glXReleaseTexImageATI = (PFNGLXRELEASETEXIMAGEATIPROC)glewGetProcAddress((const GLubyte*)"glXReleaseTexImageATI");
+  glXReleaseTexImageATI(dpy, pbuf, buffer);
+}
+
+
+static void _glewLazy_glXFreeContextEXT (Display* dpy, GLXContext context)
+{
+  glXFreeContextEXT = (PFNGLXFREECONTEXTEXTPROC)glewGetProcAddress((const GLubyte*)"glXFreeContextEXT");
+  glXFreeContextEXT(dpy, context);
+}
+
+static GLXContextID _glewLazy_glXGetContextIDEXT (const GLXContext context)
+{
+  glXGetContextIDEXT = (PFNGLXGETCONTEXTIDEXTPROC)glewGetProcAddress((const GLubyte*)"glXGetContextIDEXT");
+  return glXGetContextIDEXT(context);
+}
+
+static GLXContext _glewLazy_glXImportContextEXT (Display* dpy, GLXContextID contextID)
+{
+  glXImportContextEXT = (PFNGLXIMPORTCONTEXTEXTPROC)glewGetProcAddress((const GLubyte*)"glXImportContextEXT");
+  return glXImportContextEXT(dpy, contextID);
+}
+
+static int _glewLazy_glXQueryContextInfoEXT (Display* dpy, GLXContext context, int attribute, int *value)
+{
+  glXQueryContextInfoEXT = (PFNGLXQUERYCONTEXTINFOEXTPROC)glewGetProcAddress((const GLubyte*)"glXQueryContextInfoEXT");
+  return glXQueryContextInfoEXT(dpy, context, attribute, value);
+}
+
+
+static void _glewLazy_glXSwapIntervalEXT (Display* dpy, GLXDrawable drawable, int interval)
+{
+  glXSwapIntervalEXT = (PFNGLXSWAPINTERVALEXTPROC)glewGetProcAddress((const GLubyte*)"glXSwapIntervalEXT");
+  glXSwapIntervalEXT(dpy, drawable, interval);
+}
+
+
+static void _glewLazy_glXBindTexImageEXT (Display* display, GLXDrawable drawable, int buffer, const int *attrib_list)
+{
+  glXBindTexImageEXT = (PFNGLXBINDTEXIMAGEEXTPROC)glewGetProcAddress((const GLubyte*)"glXBindTexImageEXT");
+  glXBindTexImageEXT(display, drawable, buffer, attrib_list);
+}
+
+static void _glewLazy_glXReleaseTexImageEXT (Display* display, GLXDrawable drawable, int buffer)
+{
+  glXReleaseTexImageEXT = (PFNGLXRELEASETEXIMAGEEXTPROC)glewGetProcAddress((const GLubyte*)"glXReleaseTexImageEXT");
+  glXReleaseTexImageEXT(display, drawable, buffer);
+}
+
+
+static unsigned int _glewLazy_glXGetAGPOffsetMESA (const void* pointer)
+{
+  glXGetAGPOffsetMESA = (PFNGLXGETAGPOFFSETMESAPROC)glewGetProcAddress((const GLubyte*)"glXGetAGPOffsetMESA");
+  return glXGetAGPOffsetMESA(pointer);
+}
+
+
+static void _glewLazy_glXCopySubBufferMESA (Display* dpy, GLXDrawable drawable, int x, int y, int width, int height)
+{
+  glXCopySubBufferMESA = (PFNGLXCOPYSUBBUFFERMESAPROC)glewGetProcAddress((const GLubyte*)"glXCopySubBufferMESA");
+  glXCopySubBufferMESA(dpy, drawable, x, y, width, height);
+}
+
+
+static GLXPixmap _glewLazy_glXCreateGLXPixmapMESA (Display* dpy, XVisualInfo *visual, Pixmap pixmap, Colormap cmap)
+{
+  glXCreateGLXPixmapMESA = (PFNGLXCREATEGLXPIXMAPMESAPROC)glewGetProcAddress((const GLubyte*)"glXCreateGLXPixmapMESA");
+  return glXCreateGLXPixmapMESA(dpy, visual, pixmap, cmap);
+}
+
+
+static Bool _glewLazy_glXQueryCurrentRendererIntegerMESA (int attribute, unsigned int* value)
+{
+  glXQueryCurrentRendererIntegerMESA = (PFNGLXQUERYCURRENTRENDERERINTEGERMESAPROC)glewGetProcAddress((const GLubyte*)"glXQueryCurrentRendererIntegerMESA");
+  return glXQueryCurrentRendererIntegerMESA(attribute, value);
+}
+
+static const char* _glewLazy_glXQueryCurrentRendererStringMESA (int attribute)
+{
+  glXQueryCurrentRendererStringMESA = (PFNGLXQUERYCURRENTRENDERERSTRINGMESAPROC)glewGetProcAddress((const GLubyte*)"glXQueryCurrentRendererStringMESA");
+  return glXQueryCurrentRendererStringMESA(attribute);
+}
+
+static Bool _glewLazy_glXQueryRendererIntegerMESA (Display* dpy, int screen, int renderer, int attribute, unsigned int *value)
+{
+  glXQueryRendererIntegerMESA = (PFNGLXQUERYRENDERERINTEGERMESAPROC)glewGetProcAddress((const GLubyte*)"glXQueryRendererIntegerMESA");
+  return glXQueryRendererIntegerMESA(dpy, screen, renderer, attribute, value);
+}
+
+static const char* _glewLazy_glXQueryRendererStringMESA (Display *dpy, int screen, int renderer, int attribute)
+{
+  glXQueryRendererStringMESA = (PFNGLXQUERYRENDERERSTRINGMESAPROC)glewGetProcAddress((const GLubyte*)"glXQueryRendererStringMESA");
+  return glXQueryRendererStringMESA(dpy, screen, renderer, attribute);
+}
+
+
+static Bool _glewLazy_glXReleaseBuffersMESA (Display* dpy, GLXDrawable d)
+{
+  glXReleaseBuffersMESA = (PFNGLXRELEASEBUFFERSMESAPROC)glewGetProcAddress((const GLubyte*)"glXReleaseBuffersMESA");
+  return glXReleaseBuffersMESA(dpy, d);
+}
+
+
+static GLboolean _glewLazy_glXSet3DfxModeMESA (GLint mode)
+{
+  glXSet3DfxModeMESA = (PFNGLXSET3DFXMODEMESAPROC)glewGetProcAddress((const GLubyte*)"glXSet3DfxModeMESA");
+  return glXSet3DfxModeMESA(mode);
+}
+
+
+static int _glewLazy_glXGetSwapIntervalMESA (void)
+{
+  glXGetSwapIntervalMESA = (PFNGLXGETSWAPINTERVALMESAPROC)glewGetProcAddress((const GLubyte*)"glXGetSwapIntervalMESA");
+  return glXGetSwapIntervalMESA();
+}
+
+static int _glewLazy_glXSwapIntervalMESA (unsigned int interval)
+{
+  glXSwapIntervalMESA = (PFNGLXSWAPINTERVALMESAPROC)glewGetProcAddress((const GLubyte*)"glXSwapIntervalMESA");
+  return glXSwapIntervalMESA(interval);
+}
+
+
+static void _glewLazy_glXCopyBufferSubDataNV (Display* dpy, GLXContext readCtx, GLXContext writeCtx, GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+  glXCopyBufferSubDataNV = (PFNGLXCOPYBUFFERSUBDATANVPROC)glewGetProcAddress((const GLubyte*)"glXCopyBufferSubDataNV");
+  glXCopyBufferSubDataNV(dpy, readCtx, writeCtx, readTarget, writeTarget, readOffset, writeOffset, size);
+}
+
+static void _glewLazy_glXNamedCopyBufferSubDataNV (Display* dpy, GLXContext readCtx, GLXContext writeCtx, GLuint readBuffer, GLuint writeBuffer, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size)
+{
+  glXNamedCopyBufferSubDataNV = (PFNGLXNAMEDCOPYBUFFERSUBDATANVPROC)glewGetProcAddress((const GLubyte*)"glXNamedCopyBufferSubDataNV");
+  glXNamedCopyBufferSubDataNV(dpy, readCtx, writeCtx, readBuffer, writeBuffer, readOffset, writeOffset, size);
+}
+
+
+static void _glewLazy_glXCopyImageSubDataNV (Display *dpy, GLXContext srcCtx, GLuint srcName, GLenum srcTarget, GLint srcLevel, GLint srcX, GLint srcY, GLint srcZ, GLXContext dstCtx, GLuint dstName, GLenum dstTarget, GLint dstLevel, GLint dstX, GLint dstY, GLint dstZ, GLsizei width, GLsizei height, GLsizei depth)
+{
+  glXCopyImageSubDataNV = (PFNGLXCOPYIMAGESUBDATANVPROC)glewGetProcAddress((const GLubyte*)"glXCopyImageSubDataNV");
+  glXCopyImageSubDataNV(dpy, srcCtx, srcName, srcTarget, srcLevel, srcX, srcY, srcZ, dstCtx, dstName, dstTarget, dstLevel, dstX, dstY, dstZ, width, height, depth);
+}
+
+
+static Bool _glewLazy_glXDelayBeforeSwapNV (Display* dpy, GLXDrawable drawable, GLfloat seconds)
+{
+  glXDelayBeforeSwapNV = (PFNGLXDELAYBEFORESWAPNVPROC)glewGetProcAddress((const GLubyte*)"glXDelayBeforeSwapNV");
+  return glXDelayBeforeSwapNV(dpy, drawable, seconds);
+}
+
+
+static int _glewLazy_glXBindVideoDeviceNV (Display* dpy, unsigned int video_slot, unsigned int video_device, const int *attrib_list)
+{
+  glXBindVideoDeviceNV = (PFNGLXBINDVIDEODEVICENVPROC)glewGetProcAddress((const GLubyte*)"glXBindVideoDeviceNV");
+  return glXBindVideoDeviceNV(dpy, video_slot, video_device, attrib_list);
+}
+
+static unsigned int* _glewLazy_glXEnumerateVideoDevicesNV (Display *dpy, int screen, int *nelements)
+{
+  glXEnumerateVideoDevicesNV = (PFNGLXENUMERATEVIDEODEVICESNVPROC)glewGetProcAddress((const GLubyte*)"glXEnumerateVideoDevicesNV");
+  return glXEnumerateVideoDevicesNV(dpy, screen, nelements);
+}
+
+
+static Bool _glewLazy_glXBindSwapBarrierNV (Display* dpy, GLuint group, GLuint barrier)
+{
+  glXBindSwapBarrierNV = (PFNGLXBINDSWAPBARRIERNVPROC)glewGetProcAddress((const GLubyte*)"glXBindSwapBarrierNV");
+  return glXBindSwapBarrierNV(dpy, group, barrier);
+}
+
+static Bool _glewLazy_glXJoinSwapGroupNV (Display* dpy, GLXDrawable drawable, GLuint group)
+{
+  glXJoinSwapGroupNV = (PFNGLXJOINSWAPGROUPNVPROC)glewGetProcAddress((const GLubyte*)"glXJoinSwapGroupNV");
+  return glXJoinSwapGroupNV(dpy, drawable, group);
+}
+
+static Bool _glewLazy_glXQueryFrameCountNV (Display* dpy, int screen, GLuint *count)
+{
+  glXQueryFrameCountNV = (PFNGLXQUERYFRAMECOUNTNVPROC)glewGetProcAddress((const GLubyte*)"glXQueryFrameCountNV");
+  return glXQueryFrameCountNV(dpy, screen, count);
+}
+
+static Bool _glewLazy_glXQueryMaxSwapGroupsNV (Display* dpy, int screen, GLuint *maxGroups, GLuint *maxBarriers)
+{
+  glXQueryMaxSwapGroupsNV = (PFNGLXQUERYMAXSWAPGROUPSNVPROC)glewGetProcAddress((const GLubyte*)"glXQueryMaxSwapGroupsNV");
+  return glXQueryMaxSwapGroupsNV(dpy, screen, maxGroups, maxBarriers);
+}
+
+static Bool _glewLazy_glXQuerySwapGroupNV (Display* dpy, GLXDrawable drawable, GLuint *group, GLuint *barrier)
+{
+  glXQuerySwapGroupNV = (PFNGLXQUERYSWAPGROUPNVPROC)glewGetProcAddress((const GLubyte*)"glXQuerySwapGroupNV");
+  return glXQuerySwapGroupNV(dpy, drawable, group, barrier);
+}
+
+static Bool _glewLazy_glXResetFrameCountNV (Display* dpy, int screen)
+{
+  glXResetFrameCountNV = (PFNGLXRESETFRAMECOUNTNVPROC)glewGetProcAddress((const GLubyte*)"glXResetFrameCountNV");
+  return glXResetFrameCountNV(dpy, screen);
+}
+
+
+static void * _glewLazy_glXAllocateMemoryNV (GLsizei size, GLfloat readFrequency, GLfloat writeFrequency, GLfloat priority)
+{
+  glXAllocateMemoryNV = (PFNGLXALLOCATEMEMORYNVPROC)glewGetProcAddress((const GLubyte*)"glXAllocateMemoryNV");
+  return glXAllocateMemoryNV(size, readFrequency, writeFrequency, priority);
+}
+
+static void _glewLazy_glXFreeMemoryNV (void *pointer)
+{
+  glXFreeMemoryNV = (PFNGLXFREEMEMORYNVPROC)glewGetProcAddress((const GLubyte*)"glXFreeMemoryNV");
+  glXFreeMemoryNV(pointer);
+}
+
+
+static int _glewLazy_glXBindVideoCaptureDeviceNV (Display* dpy, unsigned int video_capture_slot, GLXVideoCaptureDeviceNV device)
+{
+  glXBindVideoCaptureDeviceNV = (PFNGLXBINDVIDEOCAPTUREDEVICENVPROC)glewGetProcAddress((const GLubyte*)"glXBindVideoCaptureDeviceNV");
+  return glXBindVideoCaptureDeviceNV(dpy, video_capture_slot, device);
+}
+
+static GLXVideoCaptureDeviceNV * _glewLazy_glXEnumerateVideoCaptureDevicesNV (Display* dpy, int screen, int *nelements)
+{
+  glXEnumerateVideoCaptureDevicesNV = (PFNGLXENUMERATEVIDEOCAPTUREDEVICESNVPROC)glewGetProcAddress((const GLubyte*)"glXEnumerateVideoCaptureDevicesNV");
+  return glXEnumerateVideoCaptureDevicesNV(dpy, screen, nelements);
+}
+
+static void _glewLazy_glXLockVideoCaptureDeviceNV (Display* dpy, GLXVideoCaptureDeviceNV device)
+{
+  glXLockVideoCaptureDeviceNV = (PFNGLXLOCKVIDEOCAPTUREDEVICENVPROC)glewGetProcAddress((const GLubyte*)"glXLockVideoCaptureDeviceNV");
+  glXLockVideoCaptureDeviceNV(dpy, device);
+}
+
+static int _glewLazy_glXQueryVideoCaptureDeviceNV (Display* dpy, GLXVideoCaptureDeviceNV device, int attribute, int *value)
+{
+  glXQueryVideoCaptureDeviceNV = (PFNGLXQUERYVIDEOCAPTUREDEVICENVPROC)glewGetProcAddress((const GLubyte*)"glXQueryVideoCaptureDeviceNV");
+  return glXQueryVideoCaptureDeviceNV(dpy, device, attribute, value);
+}
+
+static void _glewLazy_glXReleaseVideoCaptureDeviceNV (Display* dpy, GLXVideoCaptureDeviceNV device)
+{
+  glXReleaseVideoCaptureDeviceNV = (PFNGLXRELEASEVIDEOCAPTUREDEVICENVPROC)glewGetProcAddress((const GLubyte*)"glXReleaseVideoCaptureDeviceNV");
+  glXReleaseVideoCaptureDeviceNV(dpy, device);
+}
+
+
+static int _glewLazy_glXBindVideoImageNV (Display* dpy, GLXVideoDeviceNV VideoDevice, GLXPbuffer pbuf, int iVideoBuffer)
+{
+  glXBindVideoImageNV = (PFNGLXBINDVIDEOIMAGENVPROC)glewGetProcAddress((const GLubyte*)"glXBindVideoImageNV");
+  return glXBindVideoImageNV(dpy, VideoDevice, pbuf, iVideoBuffer);
+}
+
+static int _glewLazy_glXGetVideoDeviceNV (Display* dpy, int screen, int numVideoDevices, GLXVideoDeviceNV *pVideoDevice)
+{
+  glXGetVideoDeviceNV = (PFNGLXGETVIDEODEVICENVPROC)glewGetProcAddress((const GLubyte*)"glXGetVideoDeviceNV");
+  return glXGetVideoDeviceNV(dpy, screen, numVideoDevices, pVideoDevice);
+}
+
+static int _glewLazy_glXGetVideoInfoNV (Display* dpy, int screen, GLXVideoDeviceNV VideoDevice, unsigned long *pulCounterOutputPbuffer, unsigned long *pulCounterOutputVideo)
+{
+  glXGetVideoInfoNV = (PFNGLXGETVIDEOINFONVPROC)glewGetProcAddress((const GLubyte*)"glXGetVideoInfoNV");
+  return glXGetVideoInfoNV(dpy, screen, VideoDevice, pulCounterOutputPbuffer, pulCounterOutputVideo);
+}
+
+static int _glewLazy_glXReleaseVideoDeviceNV (Display* dpy, int screen, GLXVideoDeviceNV VideoDevice)
+{
+  glXReleaseVideoDeviceNV = (PFNGLXRELEASEVIDEODEVICENVPROC)glewGetProcAddress((const GLubyte*)"glXReleaseVideoDeviceNV");
+  return glXReleaseVideoDeviceNV(dpy, screen, VideoDevice);
+}
+
+static int _glewLazy_glXReleaseVideoImageNV (Display* dpy, GLXPbuffer pbuf)
+{
+  glXReleaseVideoImageNV = (PFNGLXRELEASEVIDEOIMAGENVPROC)glewGetProcAddress((const GLubyte*)"glXReleaseVideoImageNV");
+  return glXReleaseVideoImageNV(dpy, pbuf);
+}
+
+static int _glewLazy_glXSendPbufferToVideoNV (Display* dpy, GLXPbuffer pbuf, int iBufferType, unsigned long *pulCounterPbuffer, GLboolean bBlock)
+{
+  glXSendPbufferToVideoNV = (PFNGLXSENDPBUFFERTOVIDEONVPROC)glewGetProcAddress((const GLubyte*)"glXSendPbufferToVideoNV");
+  return glXSendPbufferToVideoNV(dpy, pbuf, iBufferType, pulCounterPbuffer, bBlock);
+}
+
+
+static Bool _glewLazy_glXGetMscRateOML (Display* dpy, GLXDrawable drawable, int32_t* numerator, int32_t* denominator)
+{
+  glXGetMscRateOML = (PFNGLXGETMSCRATEOMLPROC)glewGetProcAddress((const GLubyte*)"glXGetMscRateOML");
+  return glXGetMscRateOML(dpy, drawable, numerator, denominator);
+}
+
+static Bool _glewLazy_glXGetSyncValuesOML (Display* dpy, GLXDrawable drawable, int64_t* ust, int64_t* msc, int64_t* sbc)
+{
+  glXGetSyncValuesOML = (PFNGLXGETSYNCVALUESOMLPROC)glewGetProcAddress((const GLubyte*)"glXGetSyncValuesOML");
+  return glXGetSyncValuesOML(dpy, drawable, ust, msc, sbc);
+}
+
+static int64_t _glewLazy_glXSwapBuffersMscOML (Display* dpy, GLXDrawable drawable, int64_t target_msc, int64_t divisor, int64_t remainder)
+{
+  glXSwapBuffersMscOML = (PFNGLXSWAPBUFFERSMSCOMLPROC)glewGetProcAddress((const GLubyte*)"glXSwapBuffersMscOML");
+  return glXSwapBuffersMscOML(dpy, drawable, target_msc, divisor, remainder);
+}
+
+static Bool _glewLazy_glXWaitForMscOML (Display* dpy, GLXDrawable drawable, int64_t target_msc, int64_t divisor, int64_t remainder, int64_t* ust, int64_t* msc, int64_t* sbc)
+{
+  glXWaitForMscOML = (PFNGLXWAITFORMSCOMLPROC)glewGetProcAddress((const GLubyte*)"glXWaitForMscOML");
+  return glXWaitForMscOML(dpy, drawable, target_msc, divisor, remainder, ust, msc, sbc);
+}
+
+static Bool _glewLazy_glXWaitForSbcOML (Display* dpy, GLXDrawable drawable, int64_t target_sbc, int64_t* ust, int64_t* msc, int64_t* sbc)
+{
+  glXWaitForSbcOML = (PFNGLXWAITFORSBCOMLPROC)glewGetProcAddress((const GLubyte*)"glXWaitForSbcOML");
+  return glXWaitForSbcOML(dpy, drawable, target_sbc, ust, msc, sbc);
+}
+
+
+static GLXFBConfigSGIX* _glewLazy_glXChooseFBConfigSGIX (Display *dpy, int screen, const int *attrib_list, int *nelements)
+{
+  glXChooseFBConfigSGIX = (PFNGLXCHOOSEFBCONFIGSGIXPROC)glewGetProcAddress((const GLubyte*)"glXChooseFBConfigSGIX");
+  return glXChooseFBConfigSGIX(dpy, screen, attrib_list, nelements);
+}
+
+static GLXContext _glewLazy_glXCreateContextWithConfigSGIX (Display* dpy, GLXFBConfig config, int render_type, GLXContext share_list, Bool direct)
+{
+  glXCreateContextWithConfigSGIX = (PFNGLXCREATECONTEXTWITHCONFIGSGIXPROC)glewGetProcAddress((const GLubyte*)"glXCreateContextWithConfigSGIX");
+  return glXCreateContextWithConfigSGIX(dpy, config, render_type, share_list, direct);
+}
+
+static GLXPixmap _glewLazy_glXCreateGLXPixmapWithConfigSGIX (Display* dpy, GLXFBConfig config, Pixmap pixmap)
+{
+  glXCreateGLXPixmapWithConfigSGIX = (PFNGLXCREATEGLXPIXMAPWITHCONFIGSGIXPROC)glewGetProcAddress((const GLubyte*)"glXCreateGLXPixmapWithConfigSGIX");
+  return glXCreateGLXPixmapWithConfigSGIX(dpy, config, pixmap);
+}
+
+static int _glewLazy_glXGetFBConfigAttribSGIX (Display* dpy, GLXFBConfigSGIX config, int attribute, int *value)
+{
+  glXGetFBConfigAttribSGIX = (PFNGLXGETFBCONFIGATTRIBSGIXPROC)glewGetProcAddress((const GLubyte*)"glXGetFBConfigAttribSGIX");
+  return glXGetFBConfigAttribSGIX(dpy, config, attribute, value);
+}
+
+static GLXFBConfigSGIX _glewLazy_glXGetFBConfigFromVisualSGIX (Display* dpy, XVisualInfo *vis)
+{
+  glXGetFBConfigFromVisualSGIX = (PFNGLXGETFBCONFIGFROMVISUALSGIXPROC)glewGetProcAddress((const GLubyte*)"glXGetFBConfigFromVisualSGIX");
+  return glXGetFBConfigFromVisualSGIX(dpy, vis);
+}
+
+static XVisualInfo* _glewLazy_glXGetVisualFromFBConfigSGIX (Display *dpy, GLXFBConfig config)
+{
+  glXGetVisualFromFBConfigSGIX = (PFNGLXGETVISUALFROMFBCONFIGSGIXPROC)glewGetProcAddress((const GLubyte*)"glXGetVisualFromFBConfigSGIX");
+  return glXGetVisualFromFBConfigSGIX(dpy, config);
+}
+
+
+static int _glewLazy_glXBindHyperpipeSGIX (Display *dpy, int hpId)
+{
+  glXBindHyperpipeSGIX = (PFNGLXBINDHYPERPIPESGIXPROC)glewGetProcAddress((const GLubyte*)"glXBindHyperpipeSGIX");
+  return glXBindHyperpipeSGIX(dpy, hpId);
+}
+
+static int _glewLazy_glXDestroyHyperpipeConfigSGIX (Display *dpy, int hpId)
+{
+  glXDestroyHyperpipeConfigSGIX = (PFNGLXDESTROYHYPERPIPECONFIGSGIXPROC)glewGetProcAddress((const GLubyte*)"glXDestroyHyperpipeConfigSGIX");
+  return glXDestroyHyperpipeConfigSGIX(dpy, hpId);
+}
+
+static int _glewLazy_glXHyperpipeAttribSGIX (Display *dpy, int timeSlice, int attrib, int size, void *attribList)
+{
+  glXHyperpipeAttribSGIX = (PFNGLXHYPERPIPEATTRIBSGIXPROC)glewGetProcAddress((const GLubyte*)"glXHyperpipeAttribSGIX");
+  return glXHyperpipeAttribSGIX(dpy, timeSlice, attrib, size, attribList);
+}
+
+static int _glewLazy_glXHyperpipeConfigSGIX (Display *dpy, int networkId, int npipes, GLXHyperpipeConfigSGIX *cfg, int *hpId)
+{
+  glXHyperpipeConfigSGIX = (PFNGLXHYPERPIPECONFIGSGIXPROC)glewGetProcAddress((const GLubyte*)"glXHyperpipeConfigSGIX");
+  return glXHyperpipeConfigSGIX(dpy, networkId, npipes, cfg, hpId);
+}
+
+static int _glewLazy_glXQueryHyperpipeAttribSGIX (Display *dpy, int timeSlice, int attrib, int size, void *returnAttribList)
+{
+  glXQueryHyperpipeAttribSGIX = (PFNGLXQUERYHYPERPIPEATTRIBSGIXPROC)glewGetProcAddress((const GLubyte*)"glXQueryHyperpipeAttribSGIX");
+  return glXQueryHyperpipeAttribSGIX(dpy, timeSlice, attrib, size, returnAttribList);
+}
+
+static int _glewLazy_glXQueryHyperpipeBestAttribSGIX (Display *dpy, int timeSlice, int attrib, int size, void *attribList, void *returnAttribList)
+{
+  glXQueryHyperpipeBestAttribSGIX = (PFNGLXQUERYHYPERPIPEBESTATTRIBSGIXPROC)glewGetProcAddress((const GLubyte*)"glXQueryHyperpipeBestAttribSGIX");
+  return glXQueryHyperpipeBestAttribSGIX(dpy, timeSlice, attrib, size, attribList, returnAttribList);
+}
+
+static GLXHyperpipeConfigSGIX * _glewLazy_glXQueryHyperpipeConfigSGIX (Display *dpy, int hpId, int *npipes)
+{
+  glXQueryHyperpipeConfigSGIX = (PFNGLXQUERYHYPERPIPECONFIGSGIXPROC)glewGetProcAddress((const GLubyte*)"glXQueryHyperpipeConfigSGIX");
+  return glXQueryHyperpipeConfigSGIX(dpy, hpId, npipes);
+}
+
+static GLXHyperpipeNetworkSGIX * _glewLazy_glXQueryHyperpipeNetworkSGIX (Display *dpy, int *npipes)
+{
+  glXQueryHyperpipeNetworkSGIX = (PFNGLXQUERYHYPERPIPENETWORKSGIXPROC)glewGetProcAddress((const GLubyte*)"glXQueryHyperpipeNetworkSGIX");
+  return glXQueryHyperpipeNetworkSGIX(dpy, npipes);
+}
+
+
+static GLXPbuffer _glewLazy_glXCreateGLXPbufferSGIX (Display* dpy, GLXFBConfig config, unsigned int width, unsigned int height, int *attrib_list)
+{
+  glXCreateGLXPbufferSGIX = (PFNGLXCREATEGLXPBUFFERSGIXPROC)glewGetProcAddress((const GLubyte*)"glXCreateGLXPbufferSGIX");
+  return glXCreateGLXPbufferSGIX(dpy, config, width, height, attrib_list);
+}
+
+static void _glewLazy_glXDestroyGLXPbufferSGIX (Display* dpy, GLXPbuffer pbuf)
+{
+  glXDestroyGLXPbufferSGIX = (PFNGLXDESTROYGLXPBUFFERSGIXPROC)glewGetProcAddress((const GLubyte*)"glXDestroyGLXPbufferSGIX");
+  glXDestroyGLXPbufferSGIX(dpy, pbuf);
+}
+
+static void _glewLazy_glXGetSelectedEventSGIX (Display* dpy, GLXDrawable drawable, unsigned long *mask)
+{
+  glXGetSelectedEventSGIX = (PFNGLXGETSELECTEDEVENTSGIXPROC)glewGetProcAddress((const GLubyte*)"glXGetSelectedEventSGIX");
+  glXGetSelectedEventSGIX(dpy, drawable, mask);
+}
+
+static void _glewLazy_glXQueryGLXPbufferSGIX (Display* dpy, GLXPbuffer pbuf, int attribute, unsigned int *value)
+{
+  glXQueryGLXPbufferSGIX = (PFNGLXQUERYGLXPBUFFERSGIXPROC)glewGetProcAddress((const GLubyte*)"glXQueryGLXPbufferSGIX");
+  glXQueryGLXPbufferSGIX(dpy, pbuf, attribute, value);
+}
+
+static void _glewLazy_glXSelectEventSGIX (Display* dpy, GLXDrawable drawable, unsigned long mask)
+{
+  glXSelectEventSGIX = (PFNGLXSELECTEVENTSGIXPROC)glewGetProcAddress((const GLubyte*)"glXSelectEventSGIX");
+  glXSelectEventSGIX(dpy, drawable, mask);
+}
+
+
+static void _glewLazy_glXBindSwapBarrierSGIX (Display *dpy, GLXDrawable drawable, int barrier)
+{
+  glXBindSwapBarrierSGIX = (PFNGLXBINDSWAPBARRIERSGIXPROC)glewGetProcAddress((const GLubyte*)"glXBindSwapBarrierSGIX");
+  glXBindSwapBarrierSGIX(dpy, drawable, barrier);
+}
+
+static Bool _glewLazy_glXQueryMaxSwapBarriersSGIX (Display *dpy, int screen, int *max)
+{
+  glXQueryMaxSwapBarriersSGIX = (PFNGLXQUERYMAXSWAPBARRIERSSGIXPROC)glewGetProcAddress((const GLubyte*)"glXQueryMaxSwapBarriersSGIX");
+  return glXQueryMaxSwapBarriersSGIX(dpy, screen, max);
+}
+
+
+static void _glewLazy_glXJoinSwapGroupSGIX (Display *dpy, GLXDrawable drawable, GLXDrawable member)
+{
+  glXJoinSwapGroupSGIX = (PFNGLXJOINSWAPGROUPSGIXPROC)glewGetProcAddress((const GLubyte*)"glXJoinSwapGroupSGIX");
+  glXJoinSwapGroupSGIX(dpy, drawable, member);
+}
+
+
+static int _glewLazy_glXBindChannelToWindowSGIX (Display* display, int screen, int channel, Window window)
+{
+  glXBindChannelToWindowSGIX = (PFNGLXBINDCHANNELTOWINDOWSGIXPROC)glewGetProcAddress((const GLubyte*)"glXBindChannelToWindowSGIX");
+  return glXBindChannelToWindowSGIX(display, screen, channel, window);
+}
+
+static int _glewLazy_glXChannelRectSGIX (Display* display, int screen, int channel, int x, int y, int w, int h)
+{
+  glXChannelRectSGIX = (PFNGLXCHANNELRECTSGIXPROC)glewGetProcAddress((const GLubyte*)"glXChannelRectSGIX");
+  return glXChannelRectSGIX(display, screen, channel, x, y, w, h);
+}
+
+static int _glewLazy_glXChannelRectSyncSGIX (Display* display, int screen, int channel, GLenum synctype)
+{
+  glXChannelRectSyncSGIX = (PFNGLXCHANNELRECTSYNCSGIXPROC)glewGetProcAddress((const GLubyte*)"glXChannelRectSyncSGIX");
+  return glXChannelRectSyncSGIX(display, screen, channel, synctype);
+}
+
+static int _glewLazy_glXQueryChannelDeltasSGIX (Display* display, int screen, int channel, int *x, int *y, int *w, int *h)
+{
+  glXQueryChannelDeltasSGIX = (PFNGLXQUERYCHANNELDELTASSGIXPROC)glewGetProcAddress((const GLubyte*)"glXQueryChannelDeltasSGIX");
+  return glXQueryChannelDeltasSGIX(display, screen, channel, x, y, w, h);
+}
+
+static int _glewLazy_glXQueryChannelRectSGIX (Display* display, int screen, int channel, int *dx, int *dy, int *dw, int *dh)
+{
+  glXQueryChannelRectSGIX = (PFNGLXQUERYCHANNELRECTSGIXPROC)glewGetProcAddress((const GLubyte*)"glXQueryChannelRectSGIX");
+  return glXQueryChannelRectSGIX(display, screen, channel, dx, dy, dw, dh);
+}
+
+
+static void _glewLazy_glXCushionSGI (Display* dpy, Window window, float cushion)
+{
+  glXCushionSGI = (PFNGLXCUSHIONSGIPROC)glewGetProcAddress((const GLubyte*)"glXCushionSGI");
+  glXCushionSGI(dpy, window, cushion);
+}
+
+
+static GLXDrawable _glewLazy_glXGetCurrentReadDrawableSGI (void)
+{
+  glXGetCurrentReadDrawableSGI = (PFNGLXGETCURRENTREADDRAWABLESGIPROC)glewGetProcAddress((const GLubyte*)"glXGetCurrentReadDrawableSGI");
+  return glXGetCurrentReadDrawableSGI();
+}
+
+static Bool _glewLazy_glXMakeCurrentReadSGI (Display* dpy, GLXDrawable draw, GLXDrawable read, GLXContext ctx)
+{
+  glXMakeCurrentReadSGI = (PFNGLXMAKECURRENTREADSGIPROC)glewGetProcAddress((const GLubyte*)"glXMakeCurrentReadSGI");
+  return glXMakeCurrentReadSGI(dpy, draw, read, ctx);
+}
+
+
+static int _glewLazy_glXSwapIntervalSGI (int interval)
+{
+  glXSwapIntervalSGI = (PFNGLXSWAPINTERVALSGIPROC)glewGetProcAddress((const GLubyte*)"glXSwapIntervalSGI");
+  return glXSwapIntervalSGI(interval);
+}
+
+
+static int _glewLazy_glXGetVideoSyncSGI (unsigned int* count)
+{
+  glXGetVideoSyncSGI = (PFNGLXGETVIDEOSYNCSGIPROC)glewGetProcAddress((const GLubyte*)"glXGetVideoSyncSGI");
+  return glXGetVideoSyncSGI(count);
+}
+
+static int _glewLazy_glXWaitVideoSyncSGI (int divisor, int remainder, unsigned int* count)
+{
+  glXWaitVideoSyncSGI = (PFNGLXWAITVIDEOSYNCSGIPROC)glewGetProcAddress((const GLubyte*)"glXWaitVideoSyncSGI");
+  return glXWaitVideoSyncSGI(divisor, remainder, count);
+}
+
+
+static Status _glewLazy_glXGetTransparentIndexSUN (Display* dpy, Window overlay, Window underlay, unsigned long *pTransparentIndex)
+{
+  glXGetTransparentIndexSUN = (PFNGLXGETTRANSPARENTINDEXSUNPROC)glewGetProcAddress((const GLubyte*)"glXGetTransparentIndexSUN");
+  return glXGetTransparentIndexSUN(dpy, overlay, underlay, pTransparentIndex);
+}
+
+
+static int _glewLazy_glXGetVideoResizeSUN (Display* display, GLXDrawable window, float* factor)
+{
+  glXGetVideoResizeSUN = (PFNGLXGETVIDEORESIZESUNPROC)glewGetProcAddress((const GLubyte*)"glXGetVideoResizeSUN");
+  return glXGetVideoResizeSUN(display, window, factor);
+}
+
+static int _glewLazy_glXVideoResizeSUN (Display* display, GLXDrawable window, float factor)
+{
+  glXVideoResizeSUN = (PFNGLXVIDEORESIZESUNPROC)glewGetProcAddress((const GLubyte*)"glXVideoResizeSUN");
+  return glXVideoResizeSUN(display, window, factor);
+}
+
+
+PFNGLXBLITCONTEXTFRAMEBUFFERAMDPROC __glewXBlitContextFramebufferAMD = _glewLazy_glXBlitContextFramebufferAMD;
+PFNGLXCREATEASSOCIATEDCONTEXTAMDPROC __glewXCreateAssociatedContextAMD = _glewLazy_glXCreateAssociatedContextAMD;
+PFNGLXCREATEASSOCIATEDCONTEXTATTRIBSAMDPROC __glewXCreateAssociatedContextAttribsAMD = _glewLazy_glXCreateAssociatedContextAttribsAMD;
+PFNGLXDELETEASSOCIATEDCONTEXTAMDPROC __glewXDeleteAssociatedContextAMD = _glewLazy_glXDeleteAssociatedContextAMD;
+PFNGLXGETCONTEXTGPUIDAMDPROC __glewXGetContextGPUIDAMD = _glewLazy_glXGetContextGPUIDAMD;
+PFNGLXGETCURRENTASSOCIATEDCONTEXTAMDPROC __glewXGetCurrentAssociatedContextAMD = _glewLazy_glXGetCurrentAssociatedContextAMD;
+PFNGLXGETGPUIDSAMDPROC __glewXGetGPUIDsAMD = _glewLazy_glXGetGPUIDsAMD;
+PFNGLXGETGPUINFOAMDPROC __glewXGetGPUInfoAMD = _glewLazy_glXGetGPUInfoAMD;
+PFNGLXMAKEASSOCIATEDCONTEXTCURRENTAMDPROC __glewXMakeAssociatedContextCurrentAMD = _glewLazy_glXMakeAssociatedContextCurrentAMD;
+
+PFNGLXCREATECONTEXTATTRIBSARBPROC __glewXCreateContextAttribsARB = _glewLazy_glXCreateContextAttribsARB;
+
+PFNGLXBINDTEXIMAGEATIPROC __glewXBindTexImageATI = _glewLazy_glXBindTexImageATI;
+PFNGLXDRAWABLEATTRIBATIPROC __glewXDrawableAttribATI = _glewLazy_glXDrawableAttribATI;
+PFNGLXRELEASETEXIMAGEATIPROC __glewXReleaseTexImageATI = _glewLazy_glXReleaseTexImageATI;
+
+PFNGLXFREECONTEXTEXTPROC __glewXFreeContextEXT = _glewLazy_glXFreeContextEXT;
+PFNGLXGETCONTEXTIDEXTPROC __glewXGetContextIDEXT = _glewLazy_glXGetContextIDEXT;
+PFNGLXIMPORTCONTEXTEXTPROC __glewXImportContextEXT = _glewLazy_glXImportContextEXT;
+PFNGLXQUERYCONTEXTINFOEXTPROC __glewXQueryContextInfoEXT = _glewLazy_glXQueryContextInfoEXT;
+
+PFNGLXSWAPINTERVALEXTPROC __glewXSwapIntervalEXT = _glewLazy_glXSwapIntervalEXT;
+
+PFNGLXBINDTEXIMAGEEXTPROC __glewXBindTexImageEXT = _glewLazy_glXBindTexImageEXT;
+PFNGLXRELEASETEXIMAGEEXTPROC __glewXReleaseTexImageEXT = _glewLazy_glXReleaseTexImageEXT;
+
+PFNGLXGETAGPOFFSETMESAPROC __glewXGetAGPOffsetMESA = _glewLazy_glXGetAGPOffsetMESA;
+
+PFNGLXCOPYSUBBUFFERMESAPROC __glewXCopySubBufferMESA = _glewLazy_glXCopySubBufferMESA;
+
+PFNGLXCREATEGLXPIXMAPMESAPROC __glewXCreateGLXPixmapMESA = _glewLazy_glXCreateGLXPixmapMESA;
+
+PFNGLXQUERYCURRENTRENDERERINTEGERMESAPROC __glewXQueryCurrentRendererIntegerMESA = _glewLazy_glXQueryCurrentRendererIntegerMESA;
+PFNGLXQUERYCURRENTRENDERERSTRINGMESAPROC __glewXQueryCurrentRendererStringMESA = _glewLazy_glXQueryCurrentRendererStringMESA;
+PFNGLXQUERYRENDERERINTEGERMESAPROC __glewXQueryRendererIntegerMESA = _glewLazy_glXQueryRendererIntegerMESA;
+PFNGLXQUERYRENDERERSTRINGMESAPROC __glewXQueryRendererStringMESA = _glewLazy_glXQueryRendererStringMESA;
+
+PFNGLXRELEASEBUFFERSMESAPROC __glewXReleaseBuffersMESA = _glewLazy_glXReleaseBuffersMESA;
+
+PFNGLXSET3DFXMODEMESAPROC __glewXSet3DfxModeMESA = _glewLazy_glXSet3DfxModeMESA;
+
+PFNGLXGETSWAPINTERVALMESAPROC __glewXGetSwapIntervalMESA = _glewLazy_glXGetSwapIntervalMESA;
+PFNGLXSWAPINTERVALMESAPROC __glewXSwapIntervalMESA = _glewLazy_glXSwapIntervalMESA;
+
+PFNGLXCOPYBUFFERSUBDATANVPROC __glewXCopyBufferSubDataNV = _glewLazy_glXCopyBufferSubDataNV;
+PFNGLXNAMEDCOPYBUFFERSUBDATANVPROC __glewXNamedCopyBufferSubDataNV = _glewLazy_glXNamedCopyBufferSubDataNV;
+
+PFNGLXCOPYIMAGESUBDATANVPROC __glewXCopyImageSubDataNV = _glewLazy_glXCopyImageSubDataNV;
+
+PFNGLXDELAYBEFORESWAPNVPROC __glewXDelayBeforeSwapNV = _glewLazy_glXDelayBeforeSwapNV;
+
+PFNGLXBINDVIDEODEVICENVPROC __glewXBindVideoDeviceNV = _glewLazy_glXBindVideoDeviceNV;
+PFNGLXENUMERATEVIDEODEVICESNVPROC __glewXEnumerateVideoDevicesNV = _glewLazy_glXEnumerateVideoDevicesNV;
+
+PFNGLXBINDSWAPBARRIERNVPROC __glewXBindSwapBarrierNV = _glewLazy_glXBindSwapBarrierNV;
+PFNGLXJOINSWAPGROUPNVPROC __glewXJoinSwapGroupNV = _glewLazy_glXJoinSwapGroupNV;
+PFNGLXQUERYFRAMECOUNTNVPROC __glewXQueryFrameCountNV = _glewLazy_glXQueryFrameCountNV;
+PFNGLXQUERYMAXSWAPGROUPSNVPROC __glewXQueryMaxSwapGroupsNV = _glewLazy_glXQueryMaxSwapGroupsNV;
+PFNGLXQUERYSWAPGROUPNVPROC __glewXQuerySwapGroupNV = _glewLazy_glXQuerySwapGroupNV;
+PFNGLXRESETFRAMECOUNTNVPROC __glewXResetFrameCountNV = _glewLazy_glXResetFrameCountNV;
+
+PFNGLXALLOCATEMEMORYNVPROC __glewXAllocateMemoryNV = _glewLazy_glXAllocateMemoryNV;
+PFNGLXFREEMEMORYNVPROC __glewXFreeMemoryNV = _glewLazy_glXFreeMemoryNV;
+
+PFNGLXBINDVIDEOCAPTUREDEVICENVPROC __glewXBindVideoCaptureDeviceNV = _glewLazy_glXBindVideoCaptureDeviceNV;
+PFNGLXENUMERATEVIDEOCAPTUREDEVICESNVPROC __glewXEnumerateVideoCaptureDevicesNV = _glewLazy_glXEnumerateVideoCaptureDevicesNV;
+PFNGLXLOCKVIDEOCAPTUREDEVICENVPROC __glewXLockVideoCaptureDeviceNV = _glewLazy_glXLockVideoCaptureDeviceNV;
+PFNGLXQUERYVIDEOCAPTUREDEVICENVPROC __glewXQueryVideoCaptureDeviceNV = _glewLazy_glXQueryVideoCaptureDeviceNV;
+PFNGLXRELEASEVIDEOCAPTUREDEVICENVPROC __glewXReleaseVideoCaptureDeviceNV = _glewLazy_glXReleaseVideoCaptureDeviceNV;
+
+PFNGLXBINDVIDEOIMAGENVPROC __glewXBindVideoImageNV = _glewLazy_glXBindVideoImageNV;
+PFNGLXGETVIDEODEVICENVPROC __glewXGetVideoDeviceNV = _glewLazy_glXGetVideoDeviceNV;
+PFNGLXGETVIDEOINFONVPROC __glewXGetVideoInfoNV = _glewLazy_glXGetVideoInfoNV;
+PFNGLXRELEASEVIDEODEVICENVPROC __glewXReleaseVideoDeviceNV = _glewLazy_glXReleaseVideoDeviceNV;
+PFNGLXRELEASEVIDEOIMAGENVPROC __glewXReleaseVideoImageNV = _glewLazy_glXReleaseVideoImageNV;
+PFNGLXSENDPBUFFERTOVIDEONVPROC __glewXSendPbufferToVideoNV = _glewLazy_glXSendPbufferToVideoNV;
+
+PFNGLXGETMSCRATEOMLPROC __glewXGetMscRateOML = _glewLazy_glXGetMscRateOML;
+PFNGLXGETSYNCVALUESOMLPROC __glewXGetSyncValuesOML = _glewLazy_glXGetSyncValuesOML;
+PFNGLXSWAPBUFFERSMSCOMLPROC __glewXSwapBuffersMscOML = _glewLazy_glXSwapBuffersMscOML;
+PFNGLXWAITFORMSCOMLPROC __glewXWaitForMscOML = _glewLazy_glXWaitForMscOML;
+PFNGLXWAITFORSBCOMLPROC __glewXWaitForSbcOML = _glewLazy_glXWaitForSbcOML;
+
+PFNGLXCHOOSEFBCONFIGSGIXPROC __glewXChooseFBConfigSGIX = _glewLazy_glXChooseFBConfigSGIX;
+PFNGLXCREATECONTEXTWITHCONFIGSGIXPROC __glewXCreateContextWithConfigSGIX = _glewLazy_glXCreateContextWithConfigSGIX;
+PFNGLXCREATEGLXPIXMAPWITHCONFIGSGIXPROC __glewXCreateGLXPixmapWithConfigSGIX = _glewLazy_glXCreateGLXPixmapWithConfigSGIX;
+PFNGLXGETFBCONFIGATTRIBSGIXPROC __glewXGetFBConfigAttribSGIX = _glewLazy_glXGetFBConfigAttribSGIX;
+PFNGLXGETFBCONFIGFROMVISUALSGIXPROC __glewXGetFBConfigFromVisualSGIX = _glewLazy_glXGetFBConfigFromVisualSGIX;
+PFNGLXGETVISUALFROMFBCONFIGSGIXPROC __glewXGetVisualFromFBConfigSGIX = _glewLazy_glXGetVisualFromFBConfigSGIX;
+
+PFNGLXBINDHYPERPIPESGIXPROC __glewXBindHyperpipeSGIX = _glewLazy_glXBindHyperpipeSGIX;
+PFNGLXDESTROYHYPERPIPECONFIGSGIXPROC __glewXDestroyHyperpipeConfigSGIX = _glewLazy_glXDestroyHyperpipeConfigSGIX;
+PFNGLXHYPERPIPEATTRIBSGIXPROC __glewXHyperpipeAttribSGIX = _glewLazy_glXHyperpipeAttribSGIX;
+PFNGLXHYPERPIPECONFIGSGIXPROC __glewXHyperpipeConfigSGIX = _glewLazy_glXHyperpipeConfigSGIX;
+PFNGLXQUERYHYPERPIPEATTRIBSGIXPROC __glewXQueryHyperpipeAttribSGIX = _glewLazy_glXQueryHyperpipeAttribSGIX;
+PFNGLXQUERYHYPERPIPEBESTATTRIBSGIXPROC __glewXQueryHyperpipeBestAttribSGIX = _glewLazy_glXQueryHyperpipeBestAttribSGIX;
+PFNGLXQUERYHYPERPIPECONFIGSGIXPROC __glewXQueryHyperpipeConfigSGIX = _glewLazy_glXQueryHyperpipeConfigSGIX;
+PFNGLXQUERYHYPERPIPENETWORKSGIXPROC __glewXQueryHyperpipeNetworkSGIX = _glewLazy_glXQueryHyperpipeNetworkSGIX;
+
+PFNGLXCREATEGLXPBUFFERSGIXPROC __glewXCreateGLXPbufferSGIX = _glewLazy_glXCreateGLXPbufferSGIX;
+PFNGLXDESTROYGLXPBUFFERSGIXPROC __glewXDestroyGLXPbufferSGIX = _glewLazy_glXDestroyGLXPbufferSGIX;
+PFNGLXGETSELECTEDEVENTSGIXPROC __glewXGetSelectedEventSGIX = _glewLazy_glXGetSelectedEventSGIX;
+PFNGLXQUERYGLXPBUFFERSGIXPROC __glewXQueryGLXPbufferSGIX = _glewLazy_glXQueryGLXPbufferSGIX;
+PFNGLXSELECTEVENTSGIXPROC __glewXSelectEventSGIX = _glewLazy_glXSelectEventSGIX;
+
+PFNGLXBINDSWAPBARRIERSGIXPROC __glewXBindSwapBarrierSGIX = _glewLazy_glXBindSwapBarrierSGIX;
+PFNGLXQUERYMAXSWAPBARRIERSSGIXPROC __glewXQueryMaxSwapBarriersSGIX = _glewLazy_glXQueryMaxSwapBarriersSGIX;
+
+PFNGLXJOINSWAPGROUPSGIXPROC __glewXJoinSwapGroupSGIX = _glewLazy_glXJoinSwapGroupSGIX;
+
+PFNGLXBINDCHANNELTOWINDOWSGIXPROC __glewXBindChannelToWindowSGIX = _glewLazy_glXBindChannelToWindowSGIX;
+PFNGLXCHANNELRECTSGIXPROC __glewXChannelRectSGIX = _glewLazy_glXChannelRectSGIX;
+PFNGLXCHANNELRECTSYNCSGIXPROC __glewXChannelRectSyncSGIX = _glewLazy_glXChannelRectSyncSGIX;
+PFNGLXQUERYCHANNELDELTASSGIXPROC __glewXQueryChannelDeltasSGIX = _glewLazy_glXQueryChannelDeltasSGIX;
+PFNGLXQUERYCHANNELRECTSGIXPROC __glewXQueryChannelRectSGIX = _glewLazy_glXQueryChannelRectSGIX;
+
+PFNGLXCUSHIONSGIPROC __glewXCushionSGI = _glewLazy_glXCushionSGI;
+
+PFNGLXGETCURRENTREADDRAWABLESGIPROC __glewXGetCurrentReadDrawableSGI = _glewLazy_glXGetCurrentReadDrawableSGI;
+PFNGLXMAKECURRENTREADSGIPROC __glewXMakeCurrentReadSGI = _glewLazy_glXMakeCurrentReadSGI;
+
+PFNGLXSWAPINTERVALSGIPROC __glewXSwapIntervalSGI = _glewLazy_glXSwapIntervalSGI;
+
+PFNGLXGETVIDEOSYNCSGIPROC __glewXGetVideoSyncSGI = _glewLazy_glXGetVideoSyncSGI;
+PFNGLXWAITVIDEOSYNCSGIPROC __glewXWaitVideoSyncSGI = _glewLazy_glXWaitVideoSyncSGI;
+
+PFNGLXGETTRANSPARENTINDEXSUNPROC __glewXGetTransparentIndexSUN = _glewLazy_glXGetTransparentIndexSUN;
+
+PFNGLXGETVIDEORESIZESUNPROC __glewXGetVideoResizeSUN = _glewLazy_glXGetVideoResizeSUN;
+PFNGLXVIDEORESIZESUNPROC __glewXVideoResizeSUN = _glewLazy_glXVideoResizeSUN;
+
+#endif /* _WIN32 */
+
+#endif /* GLEW_LAZY */
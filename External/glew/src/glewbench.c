@@ -0,0 +1,1573 @@
+/*
+** glewbench.c
+**
+** glewbench times glewInit() against a stub OpenGL implementation, so
+** no window, context or driver is needed and runs on different machines
+** can be compared.  The stub advertises 400 extensions (some real, most
+** made up, as a large driver would), in one string or, as a core profile,
+** one at a time through glGetStringi, and hands out a dummy entry point
+** for every function GLEW asks for, counting the calls.
+**
+** usage: glewbench [-runs N] [-json results.json]
+**
+** Built with GLEW_LAZY (glewbench_lazy), it also checks that nothing is
+** looked up until it is called, and then only once.
+**
+** Built with GLEW_MX and GLEW_MX_TLS (glewbench_mx), it checks that
+** contexts alike share a GLEWContext (but not across X servers), that
+** threads meeting a new context at once get the same one and that every
+** thread has its own current one, and times glewInit() for a context
+** like one seen before.
+**
+** Built with GLEW_INSTRUMENT (glewbench_instrument), it checks the calls
+** counted and recorded for a frame, prints the report for it, and the
+** dispatch timing shows what the wrappers cost.
+**
+** Built with GLEW_STATE_CACHE (glewbench_statecache), it replays calls
+** through the cache against a stub that keeps the state they set, checks
+** that it ends up as without the cache, and reports what is dropped; the
+** dispatch timing is then that of a call dropped.
+**
+** Built with GLEW_COMMAND_BUFFER (glewbench_cmd), it checks that
+** replaying a buffer makes the calls recorded into it, and times 100k
+** draws made directly, recorded on -threads N threads (4 by default),
+** and replayed against the stub, which does nothing but hash them.
+**
+** Only the GLX path is stubbed, so this is built on Linux only.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <GL/glew.h>
+#include <GL/glxew.h>
+#if defined(GLEW_MX_TLS) || defined(GLEW_COMMAND_BUFFER)
+#include <pthread.h>
+#endif
+
+#define BENCH_EXTENSIONS 400
+#define BENCH_CALLS 100000
+
+/* a "make custom" build only knows the extensions in auto/custom.txt */
+#if defined(GL_VERSION_4_5) && defined(GL_SGIS_generate_mipmap)
+#define BENCH_FULL_BUILD 1
+#else
+#define BENCH_FULL_BUILD 0
+#endif
+
+#if defined(GLEW_LAZY)
+#define BENCH_NAME "glewbench_lazy"
+#elif defined(GLEW_MX_TLS)
+#define BENCH_NAME "glewbench_mx"
+#elif defined(GLEW_INSTRUMENT)
+#define BENCH_NAME "glewbench_instrument"
+#elif defined(GLEW_STATE_CACHE)
+#define BENCH_NAME "glewbench_statecache"
+#elif defined(GLEW_COMMAND_BUFFER)
+#define BENCH_NAME "glewbench_cmd"
+#else
+#define BENCH_NAME "glewbench"
+#endif
+
+/* extensions GLEW knows about, as a driver would advertise them */
+static const char* bench_real_extensions[] =
+{
+  "GL_ARB_base_instance", "GL_ARB_blend_func_extended", "GL_ARB_buffer_storage",
+  "GL_ARB_clear_buffer_object", "GL_ARB_clip_control", "GL_ARB_compute_shader",
+  "GL_ARB_copy_buffer", "GL_ARB_copy_image", "GL_ARB_debug_output",
+  "GL_ARB_depth_buffer_float", "GL_ARB_direct_state_access", "GL_ARB_draw_buffers",
+  "GL_ARB_draw_elements_base_vertex", "GL_ARB_draw_indirect", "GL_ARB_draw_instanced",
+  "GL_ARB_ES2_compatibility", "GL_ARB_ES3_compatibility", "GL_ARB_explicit_attrib_location",
+  "GL_ARB_fragment_program", "GL_ARB_fragment_shader", "GL_ARB_framebuffer_object",
+  "GL_ARB_framebuffer_sRGB", "GL_ARB_geometry_shader4", "GL_ARB_get_program_binary",
+  "GL_ARB_gpu_shader5", "GL_ARB_half_float_pixel", "GL_ARB_instanced_arrays",
+  "GL_ARB_internalformat_query2", "GL_ARB_invalidate_subdata", "GL_ARB_map_buffer_range",
+  "GL_ARB_multi_bind", "GL_ARB_multi_draw_indirect", "GL_ARB_multisample",
+  "GL_ARB_multitexture", "GL_ARB_occlusion_query", "GL_ARB_pixel_buffer_object",
+  "GL_ARB_point_sprite", "GL_ARB_program_interface_query", "GL_ARB_sampler_objects",
+  "GL_ARB_separate_shader_objects", "GL_ARB_shader_image_load_store", "GL_ARB_shader_objects",
+  "GL_ARB_shader_storage_buffer_object", "GL_ARB_sync", "GL_ARB_tessellation_shader",
+  "GL_ARB_texture_buffer_object", "GL_ARB_texture_compression", "GL_ARB_texture_compression_bptc",
+  "GL_ARB_texture_compression_rgtc", "GL_ARB_texture_cube_map", "GL_ARB_texture_float",
+  "GL_ARB_texture_non_power_of_two", "GL_ARB_texture_rectangle", "GL_ARB_texture_storage",
+  "GL_ARB_timer_query", "GL_ARB_transform_feedback2", "GL_ARB_uniform_buffer_object",
+  "GL_ARB_vertex_array_object", "GL_ARB_vertex_attrib_binding", "GL_ARB_vertex_buffer_object",
+  "GL_ARB_vertex_program", "GL_ARB_vertex_shader", "GL_ARB_viewport_array",
+  "GL_EXT_abgr", "GL_EXT_bgra", "GL_EXT_blend_equation_separate",
+  "GL_EXT_blend_func_separate", "GL_EXT_direct_state_access", "GL_EXT_draw_range_elements",
+  "GL_EXT_framebuffer_blit", "GL_EXT_framebuffer_multisample", "GL_EXT_framebuffer_object",
+  "GL_EXT_packed_depth_stencil", "GL_EXT_texture_compression_s3tc", "GL_EXT_texture_filter_anisotropic",
+  "GL_EXT_texture_sRGB", "GL_EXT_timer_query", "GL_EXT_transform_feedback",
+  "GL_KHR_debug", "GL_NV_bindless_texture", "GL_NV_conditional_render",
+  "GL_NV_copy_image", "GL_NV_depth_buffer_float", "GL_NV_gpu_program4",
+  "GL_NV_half_float", "GL_NV_primitive_restart", "GL_NV_shader_buffer_load",
+  "GL_NV_texture_barrier", "GL_NV_vertex_buffer_unified_memory", "GL_AMD_seamless_cubemap_per_texture",
+  "GL_ATI_texture_mirror_once", "GL_IBM_rasterpos_clip", "GL_SGIS_generate_mipmap"
+};
+
+/* extensions GLEW knows about that the stub does not advertise */
+static const char* bench_missing_extensions[] =
+{
+  "GL_3DFX_tbuffer", "GL_SUN_vertex", "GL_INTEL_map_texture", "GL_APPLE_fence"
+};
+
+static const char* bench_glx_extensions =
+  "GLX_ARB_create_context GLX_ARB_create_context_profile GLX_ARB_get_proc_address "
+  "GLX_ARB_multisample GLX_EXT_swap_control GLX_EXT_visual_info GLX_SGI_swap_control";
+
+static char bench_extensions[BENCH_EXTENSIONS*48];
+static const char* bench_extension_names[BENCH_EXTENSIONS];
+static char bench_extension_storage[BENCH_EXTENSIONS][48];
+static unsigned long bench_resolver_calls = 0;
+
+/* the context the stub pretends to be */
+typedef struct
+{
+  const char* name;
+  const char* version;
+  int core;
+  GLboolean experimental;
+} BenchContext;
+
+static const BenchContext bench_contexts[] =
+{
+  { "glewInit/gl_2.1_400_extensions", "2.1 glewbench", 0, GL_FALSE },
+  { "glewInit/gl_4.5_400_extensions", "4.5.0 glewbench", 0, GL_FALSE },
+  { "glewInit/core_3.3_400_extensions", "3.3.0 Core Profile glewbench", 1, GL_FALSE },
+  { "glewInit/core_3.3_experimental", "3.3.0 Core Profile glewbench", 1, GL_TRUE }
+};
+#define BENCH_CONTEXTS (int)(sizeof(bench_contexts)/sizeof(*bench_contexts))
+
+static const BenchContext* bench_context = &bench_contexts[0];
+
+/* ------------------------------------------------------------------------ */
+
+/* the stub: enough of GL and GLX for glewInit() */
+
+static void bench_entry_point (void)
+{
+}
+
+/* the X server the context is on, one of two */
+static int bench_displays[2];
+static int bench_display = 0;
+
+static Display* bench_glXGetCurrentDisplay (void)
+{
+  return (Display*)&bench_displays[bench_display];
+}
+
+static const GLubyte* GLAPIENTRY bench_glGetStringi (GLenum name, GLuint index)
+{
+  if (name != GL_EXTENSIONS || index >= BENCH_EXTENSIONS)
+    return NULL;
+  return (const GLubyte*)bench_extension_names[index];
+}
+
+const GLubyte* GLAPIENTRY glGetString (GLenum name)
+{
+  switch (name)
+  {
+    case GL_VERSION: return (const GLubyte*)bench_context->version;
+    case GL_VENDOR: return (const GLubyte*)"glewbench";
+    case GL_RENDERER: return (const GLubyte*)"stub";
+    /* an error in a core profile */
+    case GL_EXTENSIONS: return bench_context->core ? NULL : (const GLubyte*)bench_extensions;
+    default: return NULL;
+  }
+}
+
+void GLAPIENTRY glGetIntegerv (GLenum pname, GLint* params)
+{
+  *params = pname == GL_NUM_EXTENSIONS ? BENCH_EXTENSIONS : 0;
+}
+
+#ifdef GLEW_STATE_CACHE
+/* GLEW_STATE_CACHE: the stub keeps the state set, as a driver would, so
+   that it can be compared with what every call made would have set */
+#define BENCH_NAMES 3 /* the object names used, 0 to 2 */
+#define BENCH_UNITS 4
+
+typedef struct
+{
+  GLuint program;
+  GLuint vertexArray;
+  GLuint elementBuffer[BENCH_NAMES]; /* part of the vertex array */
+  GLuint arrayBuffer;
+  GLuint uniformBuffer;
+  GLuint activeTexture;
+  GLuint texture[BENCH_UNITS][2];    /* GL_TEXTURE_2D, GL_TEXTURE_CUBE_MAP */
+  GLuint imageTexture[BENCH_UNITS];
+  GLuint cap[3];                     /* GL_BLEND, GL_DEPTH_TEST, GL_CULL_FACE */
+  GLuint blendFunc[4];
+  GLuint blendEquation[2];
+  GLuint depthFunc;
+  GLuint depthMask;
+  GLuint viewport[4];
+  GLuint unpackAlignment;
+} BenchState;
+
+enum
+{
+  BENCH_USE_PROGRAM,
+  BENCH_DELETE_PROGRAM,
+  BENCH_BIND_VERTEX_ARRAY,
+  BENCH_DELETE_VERTEX_ARRAY,
+  BENCH_BIND_BUFFER,
+  BENCH_BIND_BUFFER_BASE,
+  BENCH_DELETE_BUFFER,
+  BENCH_ACTIVE_TEXTURE,
+  BENCH_BIND_TEXTURE,
+  BENCH_DELETE_TEXTURE,
+  BENCH_BIND_TEXTURES,
+  BENCH_BIND_TEXTURE_UNIT,
+  BENCH_BIND_MULTI_TEXTURE,
+  BENCH_BIND_IMAGE_TEXTURE,
+  BENCH_ENABLE,
+  BENCH_DISABLE,
+  BENCH_BLEND_FUNC,
+  BENCH_BLEND_FUNC_SEPARATE,
+  BENCH_BLEND_EQUATION,
+  BENCH_DEPTH_FUNC,
+  BENCH_DEPTH_MASK,
+  BENCH_VIEWPORT,
+  BENCH_PIXEL_STORE,
+  BENCH_OPS
+};
+
+/* a call, with its arguments as GL takes them */
+typedef struct
+{
+  int op;
+  GLuint a[4];
+} BenchCall;
+
+static BenchState bench_driver;
+static unsigned long bench_driver_calls = 0;
+
+static GLuint* bench_state_buffer (BenchState* s, GLenum target)
+{
+  if (target == GL_ELEMENT_ARRAY_BUFFER)
+    return &s->elementBuffer[s->vertexArray];
+  return target == GL_ARRAY_BUFFER ? &s->arrayBuffer : &s->uniformBuffer;
+}
+
+static GLuint bench_state_cap (GLenum cap)
+{
+  return cap == GL_BLEND ? 0 : cap == GL_DEPTH_TEST ? 1 : 2;
+}
+
+/* the target a texture was made for, which binding it to a unit binds
+   it to: the odd names are 2D textures, the even ones cube maps */
+static void bench_state_unit (BenchState* s, GLuint unit, GLuint texture)
+{
+  if (texture == 0)
+    s->texture[unit][0] = s->texture[unit][1] = 0;
+  else
+    s->texture[unit][texture % 2 ? 0 : 1] = texture;
+}
+
+static void bench_state_apply (BenchState* s, const BenchCall* c)
+{
+  GLuint i, j;
+  switch (c->op)
+  {
+    case BENCH_USE_PROGRAM: s->program = c->a[0]; break;
+    /* (a program in use stays in use) */
+    case BENCH_DELETE_PROGRAM: break;
+    case BENCH_BIND_VERTEX_ARRAY: s->vertexArray = c->a[0]; break;
+    case BENCH_DELETE_VERTEX_ARRAY:
+      if (c->a[0] != 0 && s->vertexArray == c->a[0]) s->vertexArray = 0;
+      if (c->a[0] != 0) s->elementBuffer[c->a[0]] = 0;
+      break;
+    case BENCH_BIND_BUFFER: *bench_state_buffer(s, c->a[0]) = c->a[1]; break;
+    case BENCH_BIND_BUFFER_BASE: *bench_state_buffer(s, c->a[0]) = c->a[2]; break;
+    /* unbound from the vertex array bound, not the others */
+    case BENCH_DELETE_BUFFER:
+      if (c->a[0] != 0 && s->arrayBuffer == c->a[0]) s->arrayBuffer = 0;
+      if (c->a[0] != 0 && s->uniformBuffer == c->a[0]) s->uniformBuffer = 0;
+      if (c->a[0] != 0 && s->elementBuffer[s->vertexArray] == c->a[0]) s->elementBuffer[s->vertexArray] = 0;
+      break;
+    case BENCH_ACTIVE_TEXTURE: s->activeTexture = c->a[0] - GL_TEXTURE0; break;
+    case BENCH_BIND_TEXTURE: s->texture[s->activeTexture][c->a[0] == GL_TEXTURE_2D ? 0 : 1] = c->a[1]; break;
+    case BENCH_DELETE_TEXTURE:
+      for (i = 0; i < BENCH_UNITS; i++)
+        for (j = 0; j < 2; j++)
+          if (c->a[0] != 0 && s->texture[i][j] == c->a[0]) s->texture[i][j] = 0;
+      break;
+    /* two units from a[0], a[3] for no textures given */
+    case BENCH_BIND_TEXTURES:
+      bench_state_unit(s, c->a[0], c->a[3] ? 0 : c->a[1]);
+      bench_state_unit(s, c->a[0] + 1, c->a[3] ? 0 : c->a[2]);
+      break;
+    case BENCH_BIND_TEXTURE_UNIT: bench_state_unit(s, c->a[0], c->a[1]); break;
+    case BENCH_BIND_MULTI_TEXTURE: s->texture[c->a[0] - GL_TEXTURE0][c->a[1] == GL_TEXTURE_2D ? 0 : 1] = c->a[2]; break;
+    case BENCH_BIND_IMAGE_TEXTURE: s->imageTexture[c->a[0]] = c->a[1]; break;
+    case BENCH_ENABLE: s->cap[bench_state_cap(c->a[0])] = GL_TRUE; break;
+    case BENCH_DISABLE: s->cap[bench_state_cap(c->a[0])] = GL_FALSE; break;
+    case BENCH_BLEND_FUNC:
+      s->blendFunc[0] = s->blendFunc[2] = c->a[0];
+      s->blendFunc[1] = s->blendFunc[3] = c->a[1];
+      break;
+    case BENCH_BLEND_FUNC_SEPARATE: memcpy(s->blendFunc, c->a, sizeof(s->blendFunc)); break;
+    case BENCH_BLEND_EQUATION: s->blendEquation[0] = s->blendEquation[1] = c->a[0]; break;
+    case BENCH_DEPTH_FUNC: s->depthFunc = c->a[0]; break;
+    case BENCH_DEPTH_MASK: s->depthMask = c->a[0]; break;
+    case BENCH_VIEWPORT: memcpy(s->viewport, c->a, sizeof(s->viewport)); break;
+    case BENCH_PIXEL_STORE: s->unpackAlignment = c->a[1]; break;
+  }
+}
+
+static void bench_driver_call (int op, GLuint a0, GLuint a1, GLuint a2, GLuint a3)
+{
+  BenchCall c;
+  c.op = op;
+  c.a[0] = a0;
+  c.a[1] = a1;
+  c.a[2] = a2;
+  c.a[3] = a3;
+  bench_driver_calls++;
+  bench_state_apply(&bench_driver, &c);
+}
+
+/* OpenGL 1.1, which glew.c calls directly (the names are the cache's
+   in the rest of this file) */
+#undef glBindTexture
+#undef glDeleteTextures
+#undef glEnable
+#undef glDisable
+#undef glBlendFunc
+#undef glDepthFunc
+#undef glDepthMask
+#undef glViewport
+#undef glPixelStorei
+#undef glPixelStoref
+
+void GLAPIENTRY glBindTexture (GLenum target, GLuint texture)
+{
+  bench_driver_call(BENCH_BIND_TEXTURE, target, texture, 0, 0);
+}
+
+void GLAPIENTRY glDeleteTextures (GLsizei n, const GLuint* textures)
+{
+  GLsizei i;
+  for (i = 0; i < n; i++)
+    bench_driver_call(BENCH_DELETE_TEXTURE, textures[i], 0, 0, 0);
+}
+
+void GLAPIENTRY glEnable (GLenum cap)
+{
+  bench_driver_call(BENCH_ENABLE, cap, 0, 0, 0);
+}
+
+void GLAPIENTRY glDisable (GLenum cap)
+{
+  bench_driver_call(BENCH_DISABLE, cap, 0, 0, 0);
+}
+
+void GLAPIENTRY glBlendFunc (GLenum sfactor, GLenum dfactor)
+{
+  bench_driver_call(BENCH_BLEND_FUNC, sfactor, dfactor, 0, 0);
+}
+
+void GLAPIENTRY glDepthFunc (GLenum func)
+{
+  bench_driver_call(BENCH_DEPTH_FUNC, func, 0, 0, 0);
+}
+
+void GLAPIENTRY glDepthMask (GLboolean flag)
+{
+  bench_driver_call(BENCH_DEPTH_MASK, flag, 0, 0, 0);
+}
+
+void GLAPIENTRY glViewport (GLint x, GLint y, GLsizei width, GLsizei height)
+{
+  bench_driver_call(BENCH_VIEWPORT, (GLuint)x, (GLuint)y, (GLuint)width, (GLuint)height);
+}
+
+void GLAPIENTRY glPixelStorei (GLenum pname, GLint param)
+{
+  bench_driver_call(BENCH_PIXEL_STORE, pname, (GLuint)param, 0, 0);
+}
+
+void GLAPIENTRY glPixelStoref (GLenum pname, GLfloat param)
+{
+  bench_driver_call(BENCH_PIXEL_STORE, pname, (GLuint)param, 0, 0);
+}
+
+/* and the ones it loads */
+static void GLAPIENTRY bench_glUseProgram (GLuint program)
+{
+  bench_driver_call(BENCH_USE_PROGRAM, program, 0, 0, 0);
+}
+
+static void GLAPIENTRY bench_glDeleteProgram (GLuint program)
+{
+  bench_driver_call(BENCH_DELETE_PROGRAM, program, 0, 0, 0);
+}
+
+static void GLAPIENTRY bench_glBindVertexArray (GLuint array)
+{
+  bench_driver_call(BENCH_BIND_VERTEX_ARRAY, array, 0, 0, 0);
+}
+
+static void GLAPIENTRY bench_glDeleteVertexArrays (GLsizei n, const GLuint* arrays)
+{
+  GLsizei i;
+  for (i = 0; i < n; i++)
+    bench_driver_call(BENCH_DELETE_VERTEX_ARRAY, arrays[i], 0, 0, 0);
+}
+
+static void GLAPIENTRY bench_glBindBuffer (GLenum target, GLuint buffer)
+{
+  bench_driver_call(BENCH_BIND_BUFFER, target, buffer, 0, 0);
+}
+
+static void GLAPIENTRY bench_glBindBufferBase (GLenum target, GLuint index, GLuint buffer)
+{
+  bench_driver_call(BENCH_BIND_BUFFER_BASE, target, index, buffer, 0);
+}
+
+static void GLAPIENTRY bench_glDeleteBuffers (GLsizei n, const GLuint* buffers)
+{
+  GLsizei i;
+  for (i = 0; i < n; i++)
+    bench_driver_call(BENCH_DELETE_BUFFER, buffers[i], 0, 0, 0);
+}
+
+static void GLAPIENTRY bench_glActiveTexture (GLenum texture)
+{
+  bench_driver_call(BENCH_ACTIVE_TEXTURE, texture, 0, 0, 0);
+}
+
+/* (the check binds two units at a time) */
+static void GLAPIENTRY bench_glBindTextures (GLuint first, GLsizei count, const GLuint* textures)
+{
+  (void)count;
+  bench_driver_call(BENCH_BIND_TEXTURES, first, textures ? textures[0] : 0, textures ? textures[1] : 0, textures == NULL);
+}
+
+static void GLAPIENTRY bench_glBindTextureUnit (GLuint unit, GLuint texture)
+{
+  bench_driver_call(BENCH_BIND_TEXTURE_UNIT, unit, texture, 0, 0);
+}
+
+static void GLAPIENTRY bench_glBindMultiTextureEXT (GLenum texunit, GLenum target, GLuint texture)
+{
+  bench_driver_call(BENCH_BIND_MULTI_TEXTURE, texunit, target, texture, 0);
+}
+
+static void GLAPIENTRY bench_glBindImageTexture (GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format)
+{
+  (void)level; (void)layered; (void)layer; (void)access; (void)format;
+  bench_driver_call(BENCH_BIND_IMAGE_TEXTURE, unit, texture, 0, 0);
+}
+
+static void GLAPIENTRY bench_glBlendFuncSeparate (GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+  bench_driver_call(BENCH_BLEND_FUNC_SEPARATE, srcRGB, dstRGB, srcAlpha, dstAlpha);
+}
+
+static void GLAPIENTRY bench_glBlendEquation (GLenum mode)
+{
+  bench_driver_call(BENCH_BLEND_EQUATION, mode, 0, 0, 0);
+}
+
+static const struct
+{
+  const char* name;
+  void (*proc)(void);
+} bench_procs[] =
+{
+  { "glUseProgram", (void (*)(void))bench_glUseProgram },
+  { "glDeleteProgram", (void (*)(void))bench_glDeleteProgram },
+  { "glBindVertexArray", (void (*)(void))bench_glBindVertexArray },
+  { "glDeleteVertexArrays", (void (*)(void))bench_glDeleteVertexArrays },
+  { "glBindBuffer", (void (*)(void))bench_glBindBuffer },
+  { "glBindBufferBase", (void (*)(void))bench_glBindBufferBase },
+  { "glDeleteBuffers", (void (*)(void))bench_glDeleteBuffers },
+  { "glActiveTexture", (void (*)(void))bench_glActiveTexture },
+  { "glBindTextures", (void (*)(void))bench_glBindTextures },
+  { "glBindTextureUnit", (void (*)(void))bench_glBindTextureUnit },
+  { "glBindMultiTextureEXT", (void (*)(void))bench_glBindMultiTextureEXT },
+  { "glBindImageTexture", (void (*)(void))bench_glBindImageTexture },
+  { "glBlendFuncSeparate", (void (*)(void))bench_glBlendFuncSeparate },
+  { "glBlendEquation", (void (*)(void))bench_glBlendEquation }
+};
+#elif defined(GLEW_COMMAND_BUFFER)
+/* GLEW_COMMAND_BUFFER: the stub folds what it is called with into a
+   hash, so that replaying a buffer can be checked against calling */
+static unsigned long bench_gl_hash = 0;
+
+static void bench_gl (GLuint op, unsigned long a0, unsigned long a1, unsigned long a2)
+{
+  bench_gl_hash = ((bench_gl_hash * 31 + op) * 31 + a0) * 31 + (a1 ^ (a2 << 7));
+}
+
+void GLAPIENTRY glBindTexture (GLenum target, GLuint texture)
+{
+  bench_gl(1, target, texture, 0);
+}
+
+void GLAPIENTRY glEnable (GLenum cap)
+{
+  bench_gl(2, cap, 0, 0);
+}
+
+void GLAPIENTRY glDisable (GLenum cap)
+{
+  bench_gl(3, cap, 0, 0);
+}
+
+void GLAPIENTRY glBlendFunc (GLenum sfactor, GLenum dfactor)
+{
+  bench_gl(4, sfactor, dfactor, 0);
+}
+
+void GLAPIENTRY glDepthMask (GLboolean flag)
+{
+  bench_gl(5, flag, 0, 0);
+}
+
+void GLAPIENTRY glViewport (GLint x, GLint y, GLsizei width, GLsizei height)
+{
+  bench_gl(6, (unsigned long)x, (unsigned long)y, (unsigned long)width * 65536 + height);
+}
+
+void GLAPIENTRY glScissor (GLint x, GLint y, GLsizei width, GLsizei height)
+{
+  bench_gl(7, (unsigned long)x, (unsigned long)y, (unsigned long)width * 65536 + height);
+}
+
+void GLAPIENTRY glClearColor (GLclampf red, GLclampf green, GLclampf blue, GLclampf alpha)
+{
+  bench_gl(8, (unsigned long)(red * 255), (unsigned long)(green * 255), (unsigned long)(blue * 255 + alpha * 65280));
+}
+
+void GLAPIENTRY glClear (GLbitfield mask)
+{
+  bench_gl(9, mask, 0, 0);
+}
+
+void GLAPIENTRY glDrawArrays (GLenum mode, GLint first, GLsizei count)
+{
+  bench_gl(10, mode, (unsigned long)first, (unsigned long)count);
+}
+
+void GLAPIENTRY glDrawElements (GLenum mode, GLsizei count, GLenum type, const void* indices)
+{
+  bench_gl(11, mode, (unsigned long)count, type + (unsigned long)(size_t)indices);
+}
+
+static void GLAPIENTRY bench_glUseProgram (GLuint program)
+{
+  bench_gl(12, program, 0, 0);
+}
+
+static void GLAPIENTRY bench_glBindVertexArray (GLuint array)
+{
+  bench_gl(13, array, 0, 0);
+}
+
+static void GLAPIENTRY bench_glUniform4f (GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3)
+{
+  bench_gl(14, (unsigned long)location, (unsigned long)(v0 + v1), (unsigned long)(v2 + v3));
+}
+
+static void GLAPIENTRY bench_glUniformMatrix4fv (GLint location, GLsizei count, GLboolean transpose, const GLfloat* value)
+{
+  GLsizei i;
+  bench_gl(15, (unsigned long)location, (unsigned long)count, transpose);
+  for (i = 0; i < 16 * count; i++)
+    bench_gl_hash = bench_gl_hash * 31 + (unsigned long)value[i];
+}
+
+static void GLAPIENTRY bench_glDrawElementsInstanced (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei primcount)
+{
+  bench_gl(16, mode, (unsigned long)count, type + (unsigned long)(size_t)indices + (unsigned long)primcount);
+}
+
+static const struct
+{
+  const char* name;
+  void (*proc)(void);
+} bench_procs[] =
+{
+  { "glUseProgram", (void (*)(void))bench_glUseProgram },
+  { "glBindVertexArray", (void (*)(void))bench_glBindVertexArray },
+  { "glUniform4f", (void (*)(void))bench_glUniform4f },
+  { "glUniformMatrix4fv", (void (*)(void))bench_glUniformMatrix4fv },
+  { "glDrawElementsInstanced", (void (*)(void))bench_glDrawElementsInstanced }
+};
+#endif
+
+void (*glXGetProcAddressARB (const GLubyte* name)) (void)
+{
+#if defined(GLEW_STATE_CACHE) || defined(GLEW_COMMAND_BUFFER)
+  size_t i;
+#endif
+  bench_resolver_calls++;
+#if defined(GLEW_STATE_CACHE) || defined(GLEW_COMMAND_BUFFER)
+  for (i = 0; i < sizeof(bench_procs)/sizeof(*bench_procs); i++)
+  {
+    if (!strcmp((const char*)name, bench_procs[i].name))
+      return bench_procs[i].proc;
+  }
+#endif
+  if (!strcmp((const char*)name, "glXGetCurrentDisplay"))
+    return (void (*)(void))bench_glXGetCurrentDisplay;
+  if (!strcmp((const char*)name, "glGetStringi"))
+    return (void (*)(void))bench_glGetStringi;
+  return bench_entry_point;
+}
+
+Bool glXQueryVersion (Display* dpy, int* major, int* minor)
+{
+  *major = 1;
+  *minor = 4;
+  return True;
+}
+
+const char* glXGetClientString (Display* dpy, int name)
+{
+  return name == GLX_EXTENSIONS ? bench_glx_extensions : "glewbench";
+}
+
+/* ------------------------------------------------------------------------ */
+
+static double bench_now_ms (void)
+{
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1000.0 + t.tv_nsec / 1000000.0;
+}
+
+/* the real names first, then made up vendor ones, shuffled the same way every time */
+static void bench_make_extensions (void)
+{
+  const int num_real = sizeof(bench_real_extensions)/sizeof(*bench_real_extensions);
+  unsigned int seed = 12345;
+  char* p = bench_extensions;
+  int i;
+  for (i = 0; i < BENCH_EXTENSIONS; i++)
+  {
+    if (i < num_real)
+      strcpy(bench_extension_storage[i], bench_real_extensions[i]);
+    else
+      sprintf(bench_extension_storage[i], "GL_%s_bench_feature_%03d",
+              (i % 3) == 0 ? "NVX" : (i % 3) == 1 ? "AMDX" : "MESAX", i);
+    bench_extension_names[i] = bench_extension_storage[i];
+  }
+  for (i = BENCH_EXTENSIONS - 1; i > 0; i--)
+  {
+    const char* t;
+    int j;
+    seed = seed * 1103515245u + 12345u;
+    j = (int)((seed >> 8) % (unsigned int)(i + 1));
+    t = bench_extension_names[i];
+    bench_extension_names[i] = bench_extension_names[j];
+    bench_extension_names[j] = t;
+  }
+  for (i = 0; i < BENCH_EXTENSIONS; i++)
+  {
+    p += sprintf(p, "%s%s", i ? " " : "", bench_extension_names[i]);
+  }
+}
+
+/* every advertised extension GLEW knows about is found, nothing else is */
+static int bench_check (void)
+{
+  const int num_real = sizeof(bench_real_extensions)/sizeof(*bench_real_extensions);
+  const int num_missing = sizeof(bench_missing_extensions)/sizeof(*bench_missing_extensions);
+  int i, errors = 0;
+  for (i = 0; i < num_real; i++)
+  {
+    if (BENCH_FULL_BUILD && !glewIsSupported(bench_real_extensions[i]))
+    {
+      printf("error: %s is advertised but not supported\n", bench_real_extensions[i]);
+      errors++;
+    }
+  }
+  for (i = 0; i < num_missing; i++)
+  {
+    if (glewIsSupported(bench_missing_extensions[i]))
+    {
+      printf("error: %s is supported but not advertised\n", bench_missing_extensions[i]);
+      errors++;
+    }
+  }
+  return errors;
+}
+
+#ifdef GLEW_LAZY
+/* GLEW_LAZY: only the functions called get looked up, each one once
+   (so this goes first, before anything has been called) */
+static int bench_lazy_check (void)
+{
+  unsigned long calls;
+  GLuint buffer = 0, vao = 0;
+  int errors = 0;
+  bench_resolver_calls = 0;
+  glewInit();
+  calls = bench_resolver_calls;
+  /* glGetStringi for a core profile and glXGetCurrentDisplay, which
+     glxewInit calls, nothing else */
+  if (calls != 2)
+  {
+    printf("error: glewInit looked up %lu functions\n", calls);
+    errors++;
+  }
+  glGenBuffers(1, &buffer);
+  glBindBuffer(GL_ARRAY_BUFFER, buffer);
+  glGenVertexArrays(1, &vao);
+  glBindVertexArray(vao);
+  glBindBuffer(GL_ARRAY_BUFFER, 0);
+  glBindVertexArray(0);
+  if (bench_resolver_calls - calls != 4)
+  {
+    printf("error: 4 functions called, %lu looked up\n", bench_resolver_calls - calls);
+    errors++;
+  }
+  return errors;
+}
+#endif
+
+#ifdef GLEW_INSTRUMENT
+static const GLEWInstrumentStat* bench_find_stat (const GLEWInstrumentStat* stats, GLuint n, const char* name)
+{
+  GLuint i;
+  for (i = 0; i < n; i++)
+  {
+    if (!strcmp(stats[i].name, name))
+      return &stats[i];
+  }
+  return NULL;
+}
+
+/* GLEW_INSTRUMENT: a frame's calls are counted, and the last ones kept
+   with their arguments */
+static int bench_instrument_check (void)
+{
+  static GLEWInstrumentStat stats[4096];
+  GLEWInstrumentCall calls[3];
+  const GLEWInstrumentStat* gen;
+  const GLEWInstrumentStat* bind;
+  GLuint buffer, n;
+  double half;
+  int errors = 0, i;
+  glewInit();
+  glewInstrumentFrame();
+  for (i = 0; i < 3; i++)
+    glGenBuffers(1, &buffer);
+  glBindBuffer(GL_ARRAY_BUFFER, 7);
+  glUniform1f(2, 0.5f);
+  glewInstrumentFrame();
+  n = glewInstrumentStats(stats, sizeof(stats)/sizeof(*stats));
+  gen = bench_find_stat(stats, n, "glGenBuffers");
+  bind = bench_find_stat(stats, n, "glBindBuffer");
+  if (gen == NULL || gen->frameCalls != 3 || bind == NULL || bind->frameCalls != 1)
+  {
+    printf("error: the calls of the frame were not counted\n");
+    errors++;
+  }
+  n = glewInstrumentCalls(calls, 3);
+  if (n == 3)
+    memcpy(&half, &calls[2].arg[1], sizeof(half));
+  if (n != 3 || strcmp(calls[1].name, "glBindBuffer") || strcmp(calls[1].args, "eu") ||
+      calls[1].arg[0] != GL_ARRAY_BUFFER || calls[1].arg[1] != 7 ||
+      strcmp(calls[2].name, "glUniform1f") || strcmp(calls[2].args, "if") || half != 0.5)
+  {
+    printf("error: the last calls were not recorded\n");
+    errors++;
+  }
+  glewInstrumentReport(stdout);
+  return errors;
+}
+#endif
+
+#ifdef GLEW_STATE_CACHE
+static GLuint bench_random (unsigned long* seed)
+{
+  *seed = *seed * 1103515245u + 12345u;
+  return (GLuint)(*seed >> 16) & 0x7fff;
+}
+
+/* a call picked at random, from few enough values that most set what is set */
+static void bench_random_call (BenchCall* c, unsigned long* seed)
+{
+  static const GLenum buffers[] = { GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER, GL_UNIFORM_BUFFER };
+  static const GLenum textures[] = { GL_TEXTURE_2D, GL_TEXTURE_CUBE_MAP };
+  static const GLenum caps[] = { GL_BLEND, GL_DEPTH_TEST, GL_CULL_FACE };
+  static const GLenum factors[] = { GL_ONE, GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA };
+  static const GLenum equations[] = { 0x8006 /* GL_FUNC_ADD */, 0x800A /* GL_FUNC_SUBTRACT */ };
+  static const GLenum funcs[] = { GL_LESS, GL_LEQUAL };
+  GLuint name = bench_random(seed) % BENCH_NAMES;
+  memset(c, 0, sizeof(*c));
+  c->op = (int)(bench_random(seed) % BENCH_OPS);
+  c->a[0] = name;
+  switch (c->op)
+  {
+    case BENCH_BIND_BUFFER:
+      c->a[0] = buffers[bench_random(seed) % 3];
+      c->a[1] = name;
+      break;
+    case BENCH_BIND_BUFFER_BASE:
+      c->a[0] = GL_UNIFORM_BUFFER;
+      c->a[1] = bench_random(seed) % 2;
+      c->a[2] = name;
+      break;
+    case BENCH_ACTIVE_TEXTURE: c->a[0] = GL_TEXTURE0 + bench_random(seed) % BENCH_UNITS; break;
+    case BENCH_BIND_TEXTURE:
+      c->a[0] = textures[bench_random(seed) % 2];
+      c->a[1] = name;
+      break;
+    case BENCH_BIND_TEXTURES:
+      c->a[0] = bench_random(seed) % (BENCH_UNITS - 1);
+      c->a[1] = name;
+      c->a[2] = bench_random(seed) % BENCH_NAMES;
+      c->a[3] = bench_random(seed) % 4 == 0;
+      break;
+    case BENCH_BIND_TEXTURE_UNIT:
+    case BENCH_BIND_IMAGE_TEXTURE:
+      c->a[0] = bench_random(seed) % BENCH_UNITS;
+      c->a[1] = name;
+      break;
+    case BENCH_BIND_MULTI_TEXTURE:
+      c->a[0] = GL_TEXTURE0 + bench_random(seed) % BENCH_UNITS;
+      c->a[1] = textures[bench_random(seed) % 2];
+      c->a[2] = name;
+      break;
+    case BENCH_ENABLE:
+    case BENCH_DISABLE: c->a[0] = caps[bench_random(seed) % 3]; break;
+    case BENCH_BLEND_FUNC:
+    case BENCH_BLEND_FUNC_SEPARATE:
+      c->a[0] = factors[bench_random(seed) % 3];
+      c->a[1] = factors[bench_random(seed) % 3];
+      c->a[2] = c->op == BENCH_BLEND_FUNC ? 0 : factors[bench_random(seed) % 3];
+      c->a[3] = c->op == BENCH_BLEND_FUNC ? 0 : factors[bench_random(seed) % 3];
+      break;
+    case BENCH_BLEND_EQUATION: c->a[0] = equations[bench_random(seed) % 2]; break;
+    case BENCH_DEPTH_FUNC: c->a[0] = funcs[bench_random(seed) % 2]; break;
+    case BENCH_DEPTH_MASK: c->a[0] = bench_random(seed) % 2; break;
+    case BENCH_VIEWPORT:
+      c->a[2] = bench_random(seed) % 2 ? 800 : 1024;
+      c->a[3] = 600;
+      break;
+    case BENCH_PIXEL_STORE:
+      c->a[0] = GL_UNPACK_ALIGNMENT;
+      c->a[1] = bench_random(seed) % 2 ? 1 : 4;
+      break;
+  }
+}
+
+/* the 1.1 names are the stub's in this file, so the cache is called by name */
+static void bench_cache_call (const BenchCall* c)
+{
+  switch (c->op)
+  {
+    case BENCH_USE_PROGRAM: glewCacheUseProgram(c->a[0]); break;
+    case BENCH_DELETE_PROGRAM: glewCacheDeleteProgram(c->a[0]); break;
+    case BENCH_BIND_VERTEX_ARRAY: glewCacheBindVertexArray(c->a[0]); break;
+    case BENCH_DELETE_VERTEX_ARRAY: glewCacheDeleteVertexArrays(1, &c->a[0]); break;
+    case BENCH_BIND_BUFFER: glewCacheBindBuffer(c->a[0], c->a[1]); break;
+    case BENCH_BIND_BUFFER_BASE: glewCacheBindBufferBase(c->a[0], c->a[1], c->a[2]); break;
+    case BENCH_DELETE_BUFFER: glewCacheDeleteBuffers(1, &c->a[0]); break;
+    case BENCH_ACTIVE_TEXTURE: glewCacheActiveTexture(c->a[0]); break;
+    case BENCH_BIND_TEXTURE: glewCacheBindTexture(c->a[0], c->a[1]); break;
+    case BENCH_DELETE_TEXTURE: glewCacheDeleteTextures(1, &c->a[0]); break;
+    case BENCH_BIND_TEXTURES: glewCacheBindTextures(c->a[0], 2, c->a[3] ? NULL : &c->a[1]); break;
+    case BENCH_BIND_TEXTURE_UNIT: glewCacheBindTextureUnit(c->a[0], c->a[1]); break;
+    case BENCH_BIND_MULTI_TEXTURE: glewCacheBindMultiTextureEXT(c->a[0], c->a[1], c->a[2]); break;
+    case BENCH_BIND_IMAGE_TEXTURE: glewCacheBindImageTexture(c->a[0], c->a[1], 0, GL_FALSE, 0, GL_READ_ONLY, GL_RGBA8); break;
+    case BENCH_ENABLE: glewCacheEnable(c->a[0]); break;
+    case BENCH_DISABLE: glewCacheDisable(c->a[0]); break;
+    case BENCH_BLEND_FUNC: glewCacheBlendFunc(c->a[0], c->a[1]); break;
+    case BENCH_BLEND_FUNC_SEPARATE: glewCacheBlendFuncSeparate(c->a[0], c->a[1], c->a[2], c->a[3]); break;
+    case BENCH_BLEND_EQUATION: glewCacheBlendEquation(c->a[0]); break;
+    case BENCH_DEPTH_FUNC: glewCacheDepthFunc(c->a[0]); break;
+    case BENCH_DEPTH_MASK: glewCacheDepthMask((GLboolean)c->a[0]); break;
+    case BENCH_VIEWPORT: glewCacheViewport((GLint)c->a[0], (GLint)c->a[1], (GLsizei)c->a[2], (GLsizei)c->a[3]); break;
+    case BENCH_PIXEL_STORE: glewCachePixelStorei(c->a[0], (GLint)c->a[1]); break;
+  }
+}
+
+/* what the cache did since the last report */
+static void bench_cache_report (const char* name, unsigned long calls)
+{
+  static GLEWStateCacheStat last[32];
+  GLEWStateCacheStat stats[32];
+  GLuint n = glewStateCacheStats(stats, sizeof(stats)/sizeof(*stats)), i;
+  printf("%s: %lu calls, %lu to the driver\n", name, calls, bench_driver_calls);
+  for (i = 0; i < n; i++)
+  {
+    if (stats[i].calls != last[i].calls)
+      printf("  %-24s %8llu calls %8llu dropped\n", stats[i].name,
+             (unsigned long long)(stats[i].calls - last[i].calls),
+             (unsigned long long)(stats[i].dropped - last[i].dropped));
+    last[i] = stats[i];
+  }
+}
+
+/* GLEW_STATE_CACHE: replayed through the cache, random calls leave the
+   driver as every call made would have, with now and then a change made
+   around it (as SOIL makes them) and the cache invalidated; then a frame
+   drawn as the tutorials draw it, to see what is dropped */
+static int bench_cache_check (void)
+{
+  static const GLenum caps[] = { GL_BLEND, GL_DEPTH_TEST, GL_CULL_FACE };
+  BenchState reference;
+  BenchCall c;
+  unsigned long seed = 1, calls;
+  int errors = 0, frame, object, i;
+  glewInit();
+  memset(&bench_driver, 0, sizeof(bench_driver));
+  memset(&reference, 0, sizeof(reference));
+  bench_driver_calls = 0;
+  for (calls = 0; calls < BENCH_CALLS; calls++)
+  {
+    bench_random_call(&c, &seed);
+    bench_state_apply(&reference, &c);
+    if (calls % 1000 == 999)
+    {
+      bench_driver_call(c.op, c.a[0], c.a[1], c.a[2], c.a[3]);
+      glewStateCacheInvalidate();
+    }
+    else
+      bench_cache_call(&c);
+    if (memcmp(&bench_driver, &reference, sizeof(reference)))
+    {
+      printf("error: call %lu (%d) through the cache left the state different\n", calls, c.op);
+      errors++;
+      break;
+    }
+  }
+  bench_cache_report("state cache/random calls", calls);
+
+  glewInit();
+  bench_driver_calls = 0;
+  calls = 0;
+  for (frame = 0; frame < 10; frame++)
+  {
+    glewCacheViewport(0, 0, 800, 600);
+    glewCacheEnable(GL_DEPTH_TEST);
+    glewCacheDepthFunc(GL_LESS);
+    calls += 3;
+    for (object = 0; object < 10; object++)
+    {
+      glewCacheUseProgram(1);
+      glewCacheActiveTexture(GL_TEXTURE0);
+      glewCacheBindTexture(GL_TEXTURE_2D, 1 + object / 5);
+      glewCacheBindVertexArray(1 + object % 2);
+      for (i = 0; i < 3; i++)
+      {
+        if (object < 5)
+          glewCacheDisable(caps[i]);
+        else
+          glewCacheEnable(caps[i]);
+      }
+      glewCacheBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+      calls += 8;
+    }
+    /* a texture loaded, as SOIL does it, outside the cache */
+    if (frame == 0)
+    {
+      glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+      glBindTexture(GL_TEXTURE_2D, 2);
+      glewStateCacheInvalidate();
+    }
+  }
+  bench_cache_report("state cache/10_frames_10_objects", calls);
+  if (bench_driver_calls >= calls)
+  {
+    printf("error: nothing dropped from the frames\n");
+    errors++;
+  }
+  return errors;
+}
+#endif
+
+#ifdef GLEW_COMMAND_BUFFER
+/* a draw as a renderer would submit it, recorded into cb or, without
+   one, called; the matrix changes under the recorder as it would */
+static void bench_cmd_draws (GLEWCommandBuffer* cb, int first, int n)
+{
+  GLfloat m[16] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 };
+  int i;
+  for (i = first; i < first + n; i++)
+  {
+    const void* indices = (const void*)(size_t)(i % 64 * 6 * sizeof(GLuint));
+    m[12] = (GLfloat)(i % 1000);
+    m[13] = (GLfloat)(i / 1000);
+    if (cb != NULL)
+    {
+      glewCmdBindVertexArray(cb, 1 + i % 3);
+      glewCmdBindTexture(cb, GL_TEXTURE_2D, 1 + i % 5);
+      glewCmdUniformMatrix4fv(cb, 0, 1, GL_FALSE, m);
+      glewCmdDrawElements(cb, GL_TRIANGLES, 36, GL_UNSIGNED_INT, indices);
+    }
+    else
+    {
+      glBindVertexArray(1 + i % 3);
+      glBindTexture(GL_TEXTURE_2D, 1 + i % 5);
+      glUniformMatrix4fv(0, 1, GL_FALSE, m);
+      glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, indices);
+    }
+  }
+}
+
+static void bench_cmd_callback (void* data)
+{
+  bench_gl(99, (unsigned long)(size_t)data, 0, 0);
+}
+
+/* every other command there is, recorded or called */
+static void bench_cmd_frame (GLEWCommandBuffer* cb)
+{
+  GLfloat m[16 * 20];
+  int i;
+  for (i = 0; i < 16 * 20; i++) m[i] = (GLfloat)i;
+  if (cb != NULL)
+  {
+    glewCmdViewport(cb, 0, 0, 1024, 768);
+    glewCmdScissor(cb, 8, 8, 1000, 750);
+    glewCmdClearColor(cb, 0.25f, 0.5f, 0.75f, 1.0f);
+    glewCmdClear(cb, GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    glewCmdEnable(cb, GL_BLEND);
+    glewCmdBlendFunc(cb, GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glewCmdDepthMask(cb, GL_FALSE);
+    glewCmdUseProgram(cb, 7);
+    glewCmdUniform4f(cb, 3, 1.0f, 2.0f, 3.0f, 4.0f);
+    /* larger than a chunk of the buffer checked with */
+    glewCmdUniformMatrix4fv(cb, 4, 20, GL_TRUE, m);
+    glewCmdDrawArrays(cb, GL_TRIANGLE_STRIP, 0, 4);
+    glewCmdDrawElementsInstanced(cb, GL_TRIANGLES, 36, GL_UNSIGNED_INT, NULL, 100);
+    glewCmdCallback(cb, bench_cmd_callback, (void*)(size_t)42);
+    glewCmdDisable(cb, GL_BLEND);
+    glewCmdDepthMask(cb, GL_TRUE);
+  }
+  else
+  {
+    glViewport(0, 0, 1024, 768);
+    glScissor(8, 8, 1000, 750);
+    glClearColor(0.25f, 0.5f, 0.75f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glDepthMask(GL_FALSE);
+    glUseProgram(7);
+    glUniform4f(3, 1.0f, 2.0f, 3.0f, 4.0f);
+    glUniformMatrix4fv(4, 20, GL_TRUE, m);
+    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    glDrawElementsInstanced(GL_TRIANGLES, 36, GL_UNSIGNED_INT, NULL, 100);
+    bench_cmd_callback((void*)(size_t)42);
+    glDisable(GL_BLEND);
+    glDepthMask(GL_TRUE);
+  }
+}
+
+/* GLEW_COMMAND_BUFFER: replaying makes the calls made without the
+   buffer, across small chunks and after a reset reuses them */
+static int bench_cmd_check (void)
+{
+  GLEWCommandBuffer* cb = glewCommandBufferCreate(256);
+  unsigned long direct;
+  int errors = 0, pass;
+  glewInit();
+  if (cb == NULL)
+  {
+    printf("error: glewCommandBufferCreate failed\n");
+    return 1;
+  }
+  for (pass = 0; pass < 2; pass++)
+  {
+    /* the second pass records less, into the chunks kept */
+    const int draws = pass == 0 ? 1000 : 10;
+    bench_gl_hash = 0;
+    bench_cmd_frame(NULL);
+    bench_cmd_draws(NULL, 0, draws);
+    direct = bench_gl_hash;
+    glewCommandBufferReset(cb);
+    bench_cmd_frame(cb);
+    bench_cmd_draws(cb, 0, draws);
+    bench_gl_hash = 0;
+    if (glewCommandBufferCount(cb) != (GLuint)(15 + 4 * draws))
+    {
+      printf("error: the command buffer has %u commands, not %d\n",
+             glewCommandBufferCount(cb), 15 + 4 * draws);
+      errors++;
+    }
+    if (!glewCommandBufferReplay(cb))
+    {
+      printf("error: glewCommandBufferReplay failed\n");
+      errors++;
+    }
+    if (bench_gl_hash != direct)
+    {
+      printf("error: replaying %d draws did not make the calls made directly\n", draws);
+      errors++;
+    }
+  }
+  glewCommandBufferDestroy(cb);
+  return errors;
+}
+
+#define BENCH_MAX_THREADS 64
+
+typedef struct
+{
+  GLEWCommandBuffer* cb;
+  int first;
+  int draws;
+} BenchRecorder;
+
+static void* bench_cmd_thread (void* arg)
+{
+  BenchRecorder* r = (BenchRecorder*)arg;
+  glewCommandBufferReset(r->cb);
+  bench_cmd_draws(r->cb, r->first, r->draws);
+  return NULL;
+}
+
+/* BENCH_CALLS draws split between threads, each recording its own;
+   what no thread could be started for is recorded on this one */
+static void bench_cmd_record (BenchRecorder* recorders, int threads)
+{
+  pthread_t t[BENCH_MAX_THREADS];
+  int i, started = 0;
+  for (i = 0; i < threads; i++)
+  {
+    recorders[i].first = BENCH_CALLS / threads * i;
+    recorders[i].draws = i + 1 < threads ? BENCH_CALLS / threads : BENCH_CALLS - recorders[i].first;
+  }
+  while (started < threads && pthread_create(&t[started], NULL, bench_cmd_thread, &recorders[started]) == 0)
+    started++;
+  for (i = started; i < threads; i++)
+    bench_cmd_thread(&recorders[i]);
+  for (i = 0; i < started; i++)
+    pthread_join(t[i], NULL);
+}
+#endif
+
+#ifdef GLEW_MX_TLS
+static void* bench_mx_thread (void* arg)
+{
+  GLEWContext** ctx = (GLEWContext**)arg;
+  ctx[0] = glewGetContext();
+  glewInit();
+  ctx[1] = glewGetContext();
+  return NULL;
+}
+
+#define BENCH_MX_THREADS 4
+
+/* GLEW_MX_TLS: contexts alike share a GLEWContext, and switching to one
+   or calling glewInit on another thread leaves this thread's alone */
+static int bench_mx_check (void)
+{
+  GLEWContext *gl45, *core33, *thread[2] = { NULL, NULL };
+  GLEWContext* many[BENCH_MX_THREADS][2];
+  pthread_t t, threads[BENCH_MX_THREADS];
+  int errors = 0, i;
+  bench_context = &bench_contexts[1];
+  glewInit();
+  gl45 = glewGetContext();
+  bench_context = &bench_contexts[2];
+  glewInit();
+  core33 = glewGetContext();
+  bench_context = &bench_contexts[1];
+  glewInit();
+  if (gl45 == NULL || gl45 == core33 || glewGetContext() != gl45)
+  {
+    printf("error: glewInit did not share the 4.5 context\n");
+    errors++;
+  }
+  if (!GLEW_VERSION_4_5 || glxewGetContext() == NULL || !GLXEW_VERSION_1_3)
+  {
+    printf("error: the 4.5 context is not 4.5 with GLX 1.3\n");
+    errors++;
+  }
+  glewMakeContextCurrent(core33);
+  if (GLEW_VERSION_4_5 || !GLEW_VERSION_3_3)
+  {
+    printf("error: glewMakeContextCurrent did not switch to the 3.3 context\n");
+    errors++;
+  }
+  /* the stub is still the 4.5 context */
+  if (pthread_create(&t, NULL, bench_mx_thread, thread) != 0 || pthread_join(t, NULL) != 0)
+  {
+    printf("error: can not run a thread\n");
+    errors++;
+  }
+  else if (thread[0] != NULL || thread[1] != gl45 || glewGetContext() != core33)
+  {
+    printf("error: the current context is not per thread\n");
+    errors++;
+  }
+  /* the same context on another X server */
+  bench_display = 1;
+  glewInit();
+  if (glewGetContext() == gl45)
+  {
+    printf("error: the 4.5 context on another display was shared\n");
+    errors++;
+  }
+  bench_display = 0;
+  /* threads meeting the 2.1 context at once all end up with one */
+  bench_context = &bench_contexts[0];
+  memset(many, 0, sizeof(many));
+  for (i = 0; i < BENCH_MX_THREADS; i++)
+  {
+    if (pthread_create(&threads[i], NULL, bench_mx_thread, many[i]) != 0)
+      break;
+  }
+  while (i-- > 0)
+    pthread_join(threads[i], NULL);
+  for (i = 1; i < BENCH_MX_THREADS; i++)
+  {
+    if (many[i][1] == NULL || many[i][1] != many[0][1] || many[i][1] == gl45 || many[i][1] == core33)
+    {
+      printf("error: threads initializing the same context at once got different ones\n");
+      errors++;
+      break;
+    }
+  }
+  return errors;
+}
+
+/* glewInit hands back the GLEWContext filled in for a context like this
+   one, so time filling one in, as it does for the first */
+static GLEWContext bench_glew;
+static GLXEWContext bench_glxew;
+
+static GLenum bench_init (void)
+{
+  GLenum err;
+  glewMakeContextCurrent(&bench_glew);
+  err = glewContextInit(&bench_glew);
+  return err != GLEW_OK ? err : glxewContextInit(&bench_glxew);
+}
+#else
+#define bench_init() glewInit()
+#endif
+
+typedef struct
+{
+  const char* name;
+  double best_ms;
+  double mean_ms;
+  unsigned long resolver_calls;
+} BenchResult;
+
+static void bench_print (const BenchResult* r)
+{
+  printf("%-40s %10.4f ms best %10.4f ms mean %8lu resolver calls\n",
+         r->name, r->best_ms, r->mean_ms, r->resolver_calls);
+}
+
+static void bench_begin (BenchResult* r, const char* name)
+{
+  r->name = name;
+  r->best_ms = 1e30;
+  r->mean_ms = 0.0;
+  r->resolver_calls = 0;
+}
+
+static void bench_time (BenchResult* r, double ms, int runs)
+{
+  if (ms < r->best_ms) r->best_ms = ms;
+  r->mean_ms += ms / runs;
+}
+
+int main (int argc, char** argv)
+{
+  BenchResult results[BENCH_CONTEXTS+9];
+  const char* json = NULL;
+  int runs = 200, num_results = 0, errors = 0, c, i, run;
+#ifdef GLEW_COMMAND_BUFFER
+  BenchRecorder recorders[BENCH_MAX_THREADS];
+  int threads = 4;
+#endif
+  FILE* f;
+  for (i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "-runs") && i + 1 < argc)
+      runs = atoi(argv[++i]);
+    else if (!strcmp(argv[i], "-json") && i + 1 < argc)
+      json = argv[++i];
+#ifdef GLEW_COMMAND_BUFFER
+    else if (!strcmp(argv[i], "-threads") && i + 1 < argc)
+      threads = atoi(argv[++i]);
+#endif
+    else
+    {
+#ifdef GLEW_COMMAND_BUFFER
+      printf("usage: %s [-runs N] [-threads N] [-json results.json]\n", argv[0]);
+#else
+      printf("usage: %s [-runs N] [-json results.json]\n", argv[0]);
+#endif
+      return 1;
+    }
+  }
+  if (runs < 1) runs = 1;
+#ifdef GLEW_COMMAND_BUFFER
+  if (threads < 1) threads = 1;
+  if (threads > BENCH_MAX_THREADS) threads = BENCH_MAX_THREADS;
+#endif
+  bench_make_extensions();
+#ifdef GLEW_LAZY
+  bench_context = &bench_contexts[2];
+  errors += bench_lazy_check();
+#endif
+#ifdef GLEW_MX_TLS
+  errors += bench_mx_check();
+#endif
+#ifdef GLEW_INSTRUMENT
+  bench_context = &bench_contexts[2];
+  errors += bench_instrument_check();
+#endif
+#ifdef GLEW_STATE_CACHE
+  bench_context = &bench_contexts[2];
+  errors += bench_cache_check();
+#endif
+#ifdef GLEW_COMMAND_BUFFER
+  bench_context = &bench_contexts[2];
+  errors += bench_cmd_check();
+#endif
+
+  /* glewInit() with 400 extensions, in each kind of context */
+  for (c = 0; c < BENCH_CONTEXTS; c++)
+  {
+    BenchResult* r = &results[num_results++];
+    bench_context = &bench_contexts[c];
+    bench_begin(r, bench_context->name);
+    glewExperimental = bench_context->experimental;
+    for (run = 0; run < runs; run++)
+    {
+      double start;
+      GLenum err;
+      bench_resolver_calls = 0;
+      start = bench_now_ms();
+      err = bench_init();
+      start = bench_now_ms() - start;
+      if (err != GLEW_OK)
+      {
+        printf("error: glewInit failed: %s\n", glewGetErrorString(err));
+        return 1;
+      }
+      bench_time(r, start, runs);
+    }
+    r->resolver_calls = bench_resolver_calls;
+    /* (glewExperimental turns on every extension it could load) */
+    if (!bench_context->experimental)
+      errors += bench_check();
+  }
+  glewExperimental = GL_FALSE;
+
+  /* the same names, one at a time, most of them unknown to GLEW (but
+     for GLEW_MX, from what glewInit found listed, with no walk through
+     the driver's list), and a made up one that is not listed */
+  for (c = 0; c < 2; c++)
+  {
+    BenchResult* r = &results[num_results++];
+    bench_context = &bench_contexts[c == 0 ? 0 : 2];
+    glewInit();
+    bench_begin(r, c == 0 ? "glewGetExtension/400_names" : "glewGetExtension/core_400_names");
+    for (run = 0; run < runs; run++)
+    {
+      double start = bench_now_ms();
+      int found = 0;
+      for (i = 0; i < BENCH_EXTENSIONS; i++)
+        found += glewGetExtension(bench_extension_storage[i]);
+      start = bench_now_ms() - start;
+      if (found != BENCH_EXTENSIONS || glewGetExtension("GL_MESAX_bench_feature_999"))
+      {
+        printf("error: glewGetExtension found %d of %d, or one that is not listed\n", found, BENCH_EXTENSIONS);
+        return 1;
+      }
+      bench_time(r, start, runs);
+    }
+  }
+
+  /* the names GLEW knows, from its table (but for GLEW_MX): listed or
+     not by the driver, whatever glewExperimental did to the flags */
+  {
+    const int num_real = sizeof(bench_real_extensions)/sizeof(*bench_real_extensions);
+    const int num_missing = sizeof(bench_missing_extensions)/sizeof(*bench_missing_extensions);
+    BenchResult* r = &results[num_results++];
+    bench_context = &bench_contexts[3];
+    glewExperimental = GL_TRUE;
+    glewInit();
+    glewExperimental = GL_FALSE;
+    bench_begin(r, "glewGetExtension/known_names");
+    for (run = 0; run < runs; run++)
+    {
+      double start = bench_now_ms();
+      int found = 0, missing = 0;
+      for (i = 0; i < num_real; i++)
+        found += glewGetExtension(bench_real_extensions[i]);
+      for (i = 0; i < num_missing; i++)
+        missing += glewGetExtension(bench_missing_extensions[i]);
+      start = bench_now_ms() - start;
+      if (found != num_real || missing != 0)
+      {
+        printf("error: glewGetExtension found %d of %d listed, %d of %d not\n", found, num_real, missing, num_missing);
+        return 1;
+      }
+      bench_time(r, start, runs);
+    }
+  }
+
+  /* glewIsSupported over the same names, most of them unknown to GLEW */
+  {
+    const int num_real = sizeof(bench_real_extensions)/sizeof(*bench_real_extensions);
+    BenchResult* r = &results[num_results++];
+    bench_context = &bench_contexts[2];
+    glewInit();
+    bench_begin(r, "glewIsSupported/400_names");
+    for (run = 0; run < runs; run++)
+    {
+      double start = bench_now_ms();
+      int found = 0;
+      for (i = 0; i < BENCH_EXTENSIONS; i++)
+        found += glewIsSupported(bench_extension_storage[i]);
+      start = bench_now_ms() - start;
+      if (BENCH_FULL_BUILD && found != num_real)
+      {
+        printf("error: glewIsSupported found %d of %d\n", found, num_real);
+        return 1;
+      }
+      bench_time(r, start, runs);
+    }
+  }
+
+#ifdef GLEW_MX_TLS
+  /* glewInit for a second window, the same as one already initialized */
+  {
+    BenchResult* r = &results[num_results++];
+    bench_context = &bench_contexts[2];
+    bench_begin(r, "glewInit/mx_tls_shared_context");
+    bench_resolver_calls = 0;
+    for (run = 0; run < runs; run++)
+    {
+      double start = bench_now_ms();
+      GLenum err = glewInit();
+      start = bench_now_ms() - start;
+      if (err != GLEW_OK)
+      {
+        printf("error: glewInit failed: %s\n", glewGetErrorString(err));
+        return 1;
+      }
+      bench_time(r, start, runs);
+    }
+    r->resolver_calls = bench_resolver_calls;
+  }
+#endif
+
+  /* a GL call checked for first, as an application would; with
+     GLEW_MX the flag is read through glewGetContext() */
+  {
+    BenchResult* r = &results[num_results++];
+    bench_begin(r, "dispatch/100k_checked_calls");
+    if (!GLEW_ARB_vertex_array_object)
+    {
+      printf("error: GL_ARB_vertex_array_object is not supported\n");
+      return 1;
+    }
+    for (run = 0; run < runs; run++)
+    {
+      double start = bench_now_ms();
+      for (i = 0; i < BENCH_CALLS; i++)
+      {
+        if (GLEW_ARB_vertex_array_object)
+          glBindVertexArray(0);
+      }
+      start = bench_now_ms() - start;
+      bench_time(r, start, runs);
+    }
+  }
+
+#ifdef GLEW_COMMAND_BUFFER
+  /* BENCH_CALLS draws of 4 commands each, made on the GL thread, recorded
+     on threads (starting them included) and replayed on the GL thread */
+  {
+    BenchResult* r = &results[num_results++];
+    static char record_name[64];
+    unsigned long direct;
+    bench_context = &bench_contexts[2];
+    glewInit();
+    bench_begin(r, "cmdbuf/direct_100k_draws");
+    for (run = 0; run < runs; run++)
+    {
+      double start = bench_now_ms();
+      bench_gl_hash = 0;
+      bench_cmd_draws(NULL, 0, BENCH_CALLS);
+      start = bench_now_ms() - start;
+      bench_time(r, start, runs);
+    }
+    direct = bench_gl_hash;
+    for (i = 0; i < threads; i++)
+    {
+      recorders[i].cb = glewCommandBufferCreate(0);
+      if (recorders[i].cb == NULL)
+      {
+        printf("error: glewCommandBufferCreate failed\n");
+        return 1;
+      }
+    }
+    sprintf(record_name, "cmdbuf/record_100k_draws_%d_threads", threads);
+    r = &results[num_results++];
+    bench_begin(r, record_name);
+    for (run = 0; run < runs; run++)
+    {
+      double start = bench_now_ms();
+      bench_cmd_record(recorders, threads);
+      start = bench_now_ms() - start;
+      bench_time(r, start, runs);
+    }
+    r = &results[num_results++];
+    bench_begin(r, "cmdbuf/replay_100k_draws");
+    for (run = 0; run < runs; run++)
+    {
+      double start = bench_now_ms();
+      bench_gl_hash = 0;
+      for (i = 0; i < threads; i++)
+        glewCommandBufferReplay(recorders[i].cb);
+      start = bench_now_ms() - start;
+      bench_time(r, start, runs);
+    }
+    if (bench_gl_hash != direct)
+    {
+      printf("error: replaying the threads' buffers did not make the calls made directly\n");
+      errors++;
+    }
+    for (i = 0; i < threads; i++)
+      glewCommandBufferDestroy(recorders[i].cb);
+  }
+#endif
+
+  for (i = 0; i < num_results; i++)
+    bench_print(&results[i]);
+
+  if (json != NULL)
+  {
+    f = fopen(json, "w");
+    if (f == NULL)
+    {
+      printf("error: can not write %s\n", json);
+      return 1;
+    }
+    fprintf(f, "{\n  \"benchmark\": \"%s\",\n  \"runs\": %d,\n  \"extensions\": %d,\n",
+            BENCH_NAME, runs, BENCH_EXTENSIONS);
+    fprintf(f, "  \"errors\": %d,\n  \"results\":\n  [\n", errors);
+    for (i = 0; i < num_results; i++)
+    {
+      fprintf(f, "    { \"name\": \"%s\", \"best_ms\": %.5f, \"mean_ms\": %.5f, \"resolver_calls\": %lu }%s\n",
+              results[i].name, results[i].best_ms, results[i].mean_ms,
+              results[i].resolver_calls, i + 1 < num_results ? "," : "");
+    }
+    fprintf(f, "  ]\n}\n");
+    fclose(f);
+  }
+  return errors ? 1 : 0;
+}
@@ -30,7 +30,8 @@ int main()
 		return -1;
 	}
 
-	glewExperimental = GL_TRUE;
+	// GLEW reads the extensions of a core profile with glGetStringi, so
+	// glewExperimental is not needed to get at the core functions
 	if (glewInit() != GLEW_OK)
 	{
 		printf( "Failed to initialize GLEW\n" );
@@ -54,4 +55,4 @@ int main()
 	glfwTerminate();
 
     return 0;
-}
\ No newline at end of file
+}
\ No newline at end of file